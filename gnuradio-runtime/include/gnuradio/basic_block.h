@@ -28,6 +28,7 @@
 #include <gnuradio/msg_accepter.h>
 #include <gnuradio/runtime_types.h>
 #include <gnuradio/io_signature.h>
+#include <gnuradio/mpsc_queue.h>
 #include <gnuradio/thread/thread.h>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/function.hpp>
@@ -59,23 +60,53 @@ namespace gr {
                                      public boost::enable_shared_from_this<basic_block>
   {
     typedef boost::function<void(pmt::pmt_t)> msg_handler_t;
-  
+    typedef boost::function<void(std::vector<pmt::pmt_t>&)> batch_msg_handler_t;
+
   private:
     //msg_handler_t d_msg_handler;
     typedef std::map<pmt::pmt_t , msg_handler_t, pmt::comparator> d_msg_handlers_t;
     d_msg_handlers_t d_msg_handlers;
+    typedef std::map<pmt::pmt_t , batch_msg_handler_t, pmt::comparator> d_batch_msg_handlers_t;
+    d_batch_msg_handlers_t d_batch_msg_handlers;
+
+    // Drain scratch for dispatch_pending; handlers on one block are
+    // serialized, so a single vector (reused to keep its capacity)
+    // suffices.
+    std::vector<pmt::pmt_t> d_pending_msgs;
   
-    typedef std::deque<pmt::pmt_t> msg_queue_t;
-    typedef std::map<pmt::pmt_t, msg_queue_t, pmt::comparator> msg_queue_map_t;
-    typedef std::map<pmt::pmt_t, msg_queue_t, pmt::comparator>::iterator msg_queue_map_itr;
+    // Each input message port gets a bounded lock-free queue, so
+    // producers posting to us don't serialize on our mutex.
+    typedef boost::shared_ptr<mpsc_queue> msg_queue_sptr;
+    typedef std::map<pmt::pmt_t, msg_queue_sptr, pmt::comparator> msg_queue_map_t;
+    typedef std::map<pmt::pmt_t, msg_queue_sptr, pmt::comparator>::iterator msg_queue_map_itr;
     std::map<pmt::pmt_t, boost::shared_ptr<boost::condition_variable>, pmt::comparator> msg_queue_ready;
-  
+
     gr::thread::mutex mutex;          //< protects all vars
-  
+    volatile int d_blocking_waiters;  //< # threads in delete_head_blocking
+
+    // Flattened dispatch table for message_port_pub: subscriber
+    // endpoints resolved to their blocks once at (un)subscribe time,
+    // so publishing neither walks the pmt subscriber list nor takes
+    // the block registry lock per message.  Kept in sync with
+    // d_message_subscribers; a subscriber must unsubscribe before it
+    // is destroyed (the registry lookup used to enforce the same
+    // invariant by throwing).
+    struct msg_subscriber_t {
+      basic_block *block;
+      pmt::pmt_t port;
+    };
+    typedef std::map<pmt::pmt_t, std::vector<msg_subscriber_t>, pmt::comparator> msg_dispatch_map_t;
+    msg_dispatch_map_t d_msg_dispatch;
+
+    //! Re-resolve the dispatch entries for output port \p port_id
+    void rebuild_msg_dispatch(pmt::pmt_t port_id);
+
   protected:
     friend class flowgraph;
     friend class flat_flowgraph; // TODO: will be redundant
     friend class tpb_thread_body;
+    friend class single_threaded_scheduler;
+    friend class wsp_worker_pool;
   
     enum vcolor { WHITE, GREY, BLACK };
   
@@ -91,6 +122,11 @@ namespace gr {
 
     msg_queue_map_t msg_queue;
     std::vector<boost::any> d_rpc_vars; // container for all RPC variables
+
+    // recycling pool behind message_blob()
+    gr::thread::mutex d_blob_mutex;
+    std::vector<pmt::pmt_t> d_blob_pool;
+    size_t d_blob_next;
   
     basic_block(void) {} // allows pure virtual interface sub-classes
   
@@ -119,7 +155,15 @@ namespace gr {
      * \brief Tests if there is a handler attached to port \p which_port
      */
     virtual bool has_msg_handler(pmt::pmt_t which_port) {
-      return (d_msg_handlers.find(which_port) != d_msg_handlers.end());
+      return (d_msg_handlers.find(which_port) != d_msg_handlers.end())
+        || has_batch_msg_handler(which_port);
+    }
+
+    /*!
+     * \brief Tests if there is a batch handler attached to port \p which_port
+     */
+    virtual bool has_batch_msg_handler(pmt::pmt_t which_port) {
+      return (d_batch_msg_handlers.find(which_port) != d_batch_msg_handlers.end());
     }
 
     /*
@@ -131,10 +175,31 @@ namespace gr {
     virtual void dispatch_msg(pmt::pmt_t which_port, pmt::pmt_t msg)
     {
       // AA Update this
-      if(has_msg_handler(which_port)) {  // Is there a handler?
-        d_msg_handlers[which_port](msg); // Yes, invoke it.
+      d_msg_handlers_t::iterator it = d_msg_handlers.find(which_port);
+      if(it != d_msg_handlers.end()) {   // Is there a handler?
+        it->second(msg);                 // Yes, invoke it.
+        return;
+      }
+      // A batch handler gets the message as a batch of one.
+      d_batch_msg_handlers_t::iterator bit = d_batch_msg_handlers.find(which_port);
+      if(bit != d_batch_msg_handlers.end()) {
+        std::vector<pmt::pmt_t> msgs(1, msg);
+        bit->second(msgs);
       }
     }
+
+    /*!
+     * \brief Drain port \p which_port's queue and dispatch everything
+     * that was pending.
+     *
+     * A batch handler receives all drained messages in one call; a
+     * per-message handler is invoked once per message. Called by the
+     * schedulers under the same serialization guarantees as
+     * dispatch_msg.
+     *
+     * \returns the number of messages drained from the queue.
+     */
+    size_t dispatch_pending(pmt::pmt_t which_port);
   
     // Message passing interface
     pmt::pmt_t d_message_subscribers;
@@ -160,7 +225,25 @@ namespace gr {
     void message_port_pub(pmt::pmt_t port_id, pmt::pmt_t msg);
     void message_port_sub(pmt::pmt_t port_id, pmt::pmt_t target);
     void message_port_unsub(pmt::pmt_t port_id, pmt::pmt_t target);
-  
+
+    /*!
+     * \brief Get a recycled mutable byte vector of \p nbytes for a
+     * fixed-schema outgoing message.
+     *
+     * The returned u8vector comes from a small per-block pool: once
+     * every consumer of a previously published message has dropped
+     * its reference, that vector is handed out again instead of
+     * paying an alloc/free pair per message. The contents are
+     * whatever the recycled message held — the caller must overwrite
+     * all \p nbytes (via pmt::uniform_vector_writable_elements)
+     * before publishing, and must not touch the vector after
+     * message_port_pub.
+     *
+     * Falls back to a fresh allocation when every pooled vector is
+     * still in flight or has the wrong length.
+     */
+    pmt::pmt_t message_blob(size_t nbytes);
+
     virtual bool message_port_is_hier(pmt::pmt_t port_id) { (void) port_id; std::cout << "is_hier\n"; return false; }
     virtual bool message_port_is_hier_in(pmt::pmt_t port_id) { (void) port_id; std::cout << "is_hier_in\n"; return false; }
     virtual bool message_port_is_hier_out(pmt::pmt_t port_id) { (void) port_id; std::cout << "is_hier_out\n"; return false; }
@@ -187,15 +270,15 @@ namespace gr {
     void _post(pmt::pmt_t which_port, pmt::pmt_t msg);
   
     //! is the queue empty?
-    bool empty_p(pmt::pmt_t which_port) { 
+    bool empty_p(pmt::pmt_t which_port) {
       if(msg_queue.find(which_port) == msg_queue.end())
         throw std::runtime_error("port does not exist!");
-      return msg_queue[which_port].empty(); 
+      return msg_queue[which_port]->empty_p();
     }
-    bool empty_p() { 
+    bool empty_p() {
       bool rv = true;
       BOOST_FOREACH(msg_queue_map_t::value_type &i, msg_queue) {
-        rv &= msg_queue[i.first].empty();
+        rv &= msg_queue[i.first]->empty_p();
       }
       return rv;
     }
@@ -213,13 +296,13 @@ namespace gr {
     }
 
     //! How many messages in the queue?
-    size_t nmsgs(pmt::pmt_t which_port) { 
+    size_t nmsgs(pmt::pmt_t which_port) {
       if(msg_queue.find(which_port) == msg_queue.end())
         throw std::runtime_error("port does not exist!");
-      return msg_queue[which_port].size(); 
+      return msg_queue[which_port]->count();
     }
-  
-    //| Acquires and release the mutex
+
+    //| Lock-free; only takes the mutex to wake blocking consumers
     void insert_tail( pmt::pmt_t which_port, pmt::pmt_t msg);
     /*!
      * \returns returns pmt at head of queue or pmt::pmt_t() if empty.
@@ -230,15 +313,7 @@ namespace gr {
      * \returns returns pmt at head of queue or pmt::pmt_t() if empty.
      */
     pmt::pmt_t delete_head_blocking( pmt::pmt_t which_port);
-  
-    msg_queue_t::iterator get_iterator(pmt::pmt_t which_port) {
-      return msg_queue[which_port].begin();
-    }
 
-    void erase_msg(pmt::pmt_t which_port, msg_queue_t::iterator it) {
-      msg_queue[which_port].erase(it);
-    }
-  
     virtual bool has_msg_port(pmt::pmt_t which_port) {
       if(msg_queue.find(which_port) != msg_queue.end()) {
         return true;
@@ -344,6 +419,34 @@ namespace gr {
       d_msg_handlers[which_port] = msg_handler_t(msg_handler);
     }
 
+    /*!
+     * \brief Set a callback that receives all pending messages in one call.
+     *
+     * \p msg_handler can be any kind of function pointer or function
+     * object that has the signature:
+     * <pre>
+     *    void msg_handler(std::vector<pmt::pmt_t> &msgs);
+     * </pre>
+     *
+     * Where a handler registered with set_msg_handler is invoked once
+     * per message, a batch handler is handed everything queued on the
+     * port since the last dispatch, amortizing the dispatch overhead
+     * and letting the handler batch its own processing. The vector is
+     * scratch owned by the runtime; the handler may consume or modify
+     * it but must not keep a reference past the call.
+     *
+     * The serialization guarantees of set_msg_handler apply
+     * unchanged. A batch handler replaces any per-message handler on
+     * the same port.
+     */
+    template <typename T> void set_batch_msg_handler(pmt::pmt_t which_port, T msg_handler) {
+      if(msg_queue.find(which_port) == msg_queue.end()) {
+        throw std::runtime_error("attempt to set_batch_msg_handler() on bad input message port!");
+      }
+      d_msg_handlers.erase(which_port);
+      d_batch_msg_handlers[which_port] = batch_msg_handler_t(msg_handler);
+    }
+
     virtual void set_processor_affinity(const std::vector<int> &mask)
     { throw std::runtime_error("set_processor_affinity not overloaded in child class."); }
 
@@ -352,6 +455,12 @@ namespace gr {
 
     virtual std::vector<int> processor_affinity()
     { throw std::runtime_error("processor_affinity not overloaded in child class."); }
+
+    virtual int set_thread_priority(int priority)
+    { throw std::runtime_error("set_thread_priority not overloaded in child class."); }
+
+    virtual int thread_priority()
+    { throw std::runtime_error("thread_priority not overloaded in child class."); }
   };
 
   inline bool operator<(basic_block_sptr lhs, basic_block_sptr rhs)
@@ -194,6 +194,20 @@ namespace gr {
     int  output_multiple() const { return d_output_multiple; }
     bool output_multiple_set() const { return d_output_multiple_set; }
 
+    /*!
+     * \brief Enable or disable adaptive chunk-size tuning for this block.
+     *
+     * When enabled, the scheduler measures throughput as a function
+     * of the chunk size granted to work and hill-climbs a preferred
+     * per-block chunk cap at runtime, bounded by output_multiple and
+     * max_noutput_items.  Useful when the cache-optimal chunk size
+     * differs per machine and hand tuning doesn't scale.  It can also
+     * be enabled globally with the chunk_autotune preference in the
+     * DEFAULT section.
+     */
+    void set_chunk_autotune(bool enable) { d_chunk_autotune = enable; }
+    bool chunk_autotune() const { return d_chunk_autotune; }
+
     /*!
      * \brief Constrains buffers to work on a set item alignment (for SIMD)
      *
@@ -297,6 +311,41 @@ namespace gr {
      */
     void set_tag_propagation_policy(tag_propagation_policy_t p);
 
+    /*!
+     * \brief Return the tag keys the scheduler propagates from input
+     * \p which_input.
+     *
+     * An empty vector means no filter is installed and every tag on
+     * that input propagates (the default).
+     */
+    std::vector<pmt::pmt_t> tag_propagation_keys(unsigned int which_input);
+
+    /*!
+     * \brief Restrict tag propagation from input \p which_input to
+     * tags whose key is in \p keys.
+     *
+     * The propagation policies copy every tag downstream, so a block
+     * in a long chain pays for tags it never looks at. Installing a
+     * whitelist of keys (interned PMT symbols) on an input port makes
+     * the scheduler drop everything else when moving that port's tags
+     * to the outputs. The filter composes with the propagation policy;
+     * it does not affect what get_tags_in_range() returns to the block
+     * itself.
+     *
+     * Passing an empty \p keys vector removes the filter from the port.
+     *
+     * \param which_input  which input port's propagation to restrict
+     * \param keys         the tag keys to propagate; all others are dropped
+     */
+    void set_tag_propagation_keys(unsigned int which_input,
+                                  const std::vector<pmt::pmt_t> &keys);
+
+    /*!
+     * \brief Used by the scheduler. Returns the whitelist installed on
+     * input \p which_input, or NULL when every key propagates.
+     */
+    const std::vector<pmt::pmt_t> *tag_propagation_keys_ptr(unsigned int which_input) const;
+
     /*!
      * \brief Return the minimum number of output items this block can
      * produce during a call to work.
@@ -314,6 +363,70 @@ namespace gr {
      */
     void set_min_noutput_items(int m) { d_min_noutput_items = m; }
 
+    /*!
+     * \brief Return how many completed calls to work are batched into
+     * a single neighbor notification (1 = notify every time).
+     */
+    unsigned int notification_interval() const { return d_notify_interval; }
+
+    /*!
+     * \brief Batch neighbor wakeups under the thread-per-block
+     * scheduler.
+     *
+     * By default a block signals its upstream and downstream
+     * neighbors after every call to work.  For high-rate chains this
+     * causes a condition-variable wakeup storm; setting \p n > 1
+     * defers the wakeup until n calls to work have completed.
+     * Deferred notifications are always flushed before the block
+     * itself goes to sleep, so no progress is lost.
+     *
+     * \param n number of work calls per notification; must be >= 1.
+     */
+    void set_notification_interval(unsigned int n)
+    {
+      d_notify_interval = n ? n : 1;
+    }
+
+    /*!
+     * \brief Declare this block a transparent pass-through.
+     *
+     * A transparent block promises that its work function would copy
+     * its input to its output unchanged.  When the flowgraph is
+     * started, a transparent block connected 1-in/1-out with history
+     * 1 is collapsed out of the flattened graph: downstream blocks
+     * read directly from the upstream buffer and the block itself
+     * never executes.  Only declare transparency if the block does no
+     * bookkeeping in work, does not touch tags, and does not
+     * terminate the stream.  The promise must hold for the lifetime
+     * of the flowgraph: a block whose pass-through behavior can be
+     * toggled at runtime (e.g. an enable callback) must not declare
+     * itself transparent, since a collapsed block can never reassert
+     * itself into a started flowgraph.
+     */
+    void set_transparent(bool transparent) { d_transparent = transparent; }
+    bool transparent() const { return d_transparent; }
+
+    /*!
+     * \brief Signature of a work kernel registered with
+     * set_work_kernel: process \p noutput_items items from \p src
+     * into \p dst and return the number of items produced. \p arg is
+     * the context pointer given at registration (typically the block
+     * itself).
+     */
+    typedef int (*work_kernel_t)(const void *src, void *dst,
+                                 int noutput_items, void *arg);
+
+    /*!
+     * \brief Return the registered work kernel, or NULL when the
+     * block uses the normal general_work path. Called by the
+     * scheduler every iteration, so registration may be toggled at
+     * run time.
+     */
+    work_kernel_t work_kernel() const { return d_work_kernel; }
+
+    //! Context pointer passed to the registered work kernel.
+    void *work_kernel_arg() const { return d_work_kernel_arg; }
+
     /*!
      * \brief Return the maximum number of output items this block will
      * handle during a call to work.
@@ -502,6 +615,27 @@ namespace gr {
      */
     float pc_work_time_total();
 
+    /*!
+     * \brief Gets number of completed calls to work.
+     */
+    float pc_nwork_calls();
+
+    /*!
+     * \brief Gets number of scheduler wakeups of this block's thread.
+     */
+    float pc_nwakeups();
+
+    /*!
+     * \brief Gets total clock cycles spent blocked waiting for input.
+     */
+    float pc_input_blocked_time_total();
+
+    /*!
+     * \brief Gets total clock cycles spent blocked waiting for output
+     * buffer space.
+     */
+    float pc_output_blocked_time_total();
+
     /*!
      * \brief Resets the performance counters
      */
@@ -561,6 +695,27 @@ namespace gr {
      */
     int set_thread_priority(int priority);
 
+    /*!
+     * \brief Get the scheduling class this block's thread was asked for
+     */
+    gr::thread::sched_policy thread_sched_policy();
+
+    /*!
+     * \brief Place this block's thread in a scheduling class
+     *
+     * \details
+     * Unlike set_thread_priority, this also selects the scheduling
+     * class (gr::thread::SCHED_POLICY_FIFO, _RR or _OTHER), so the
+     * DSP blocks of a flowgraph can run under a realtime class while
+     * housekeeping blocks stay time-shared. \p priority is the
+     * native priority of the chosen class, not the virtual scale
+     * used by gr::enable_realtime_scheduling, and the realtime
+     * classes need the same privileges as that call. Takes effect
+     * immediately if the flowgraph is running, otherwise when it
+     * starts.
+     */
+    int set_thread_sched(gr::thread::sched_policy policy, int priority);
+
     bool update_rate() const;
 
     // ----------------------------------------------------------------------------
@@ -568,6 +723,7 @@ namespace gr {
   private:
     int                   d_output_multiple;
     bool                  d_output_multiple_set;
+    bool                  d_chunk_autotune;
     int                   d_unaligned;
     bool                  d_is_unaligned;
     double                d_relative_rate;	// approx output_rate / input_rate
@@ -578,11 +734,17 @@ namespace gr {
     bool                  d_max_noutput_items_set;     // if d_max_noutput_items is valid
     int                   d_max_noutput_items;         // value of max_noutput_items for this block
     int                   d_min_noutput_items;
+    unsigned              d_notify_interval;   // work calls per neighbor wakeup
+    bool                  d_transparent;       // pure pass-through; may be collapsed
     tag_propagation_policy_t d_tag_propagation_policy; // policy for moving tags downstream
+    std::vector< std::vector<pmt::pmt_t> > d_tag_propagation_keys; // per-input key whitelists; empty = no filter
     std::vector<int>      d_affinity;              // thread affinity proc. mask
     int                   d_priority;              // thread priority level
+    gr::thread::sched_policy d_sched_policy;       // thread scheduling class
     bool                  d_pc_rpc_set;
     bool                  d_update_rate;           // should sched update rel rate?
+    work_kernel_t         d_work_kernel;           // direct-call fast path, or NULL
+    void                 *d_work_kernel_arg;
 
   protected:
     block(void) {} // allows pure virtual interface sub-classes
@@ -592,6 +754,51 @@ namespace gr {
 
     void set_fixed_rate(bool fixed_rate) { d_fixed_rate = fixed_rate; }
 
+    /*!
+     * \brief Register a direct-call work kernel; pass NULL to return
+     * to the normal general_work path.
+     *
+     * When a kernel is registered and the block is connected strictly
+     * 1-in/1-out, the scheduler calls the function pointer with the
+     * stream pointers instead of going through the general_work ->
+     * work virtual chain, and assumes a 1:1 item relationship in
+     * place of the forecast call. This removes per-iteration
+     * dispatch overhead for cheap structural blocks (copies,
+     * converters) in graphs of many such blocks.
+     *
+     * Only valid for blocks with history 1 and no output_multiple
+     * that consume exactly what they produce; the scheduler still
+     * handles tag propagation and message queues as usual.
+     *
+     * \param kernel function called in place of general_work, or NULL
+     * \param arg context pointer handed back to \p kernel
+     */
+    void set_work_kernel(work_kernel_t kernel, void *arg);
+
+    /*!
+     * \brief Allocate \p nitems items of type \p T of scratch space
+     * for the duration of this work() call.
+     *
+     * The memory comes from a per-block bump arena that the scheduler
+     * resets when work() returns: no destructors run, so \p T must be
+     * plain data, and the pointer must not be kept across calls. Use
+     * this for conversion buffers and tag staging instead of
+     * allocating in work(); once the arena has grown to the
+     * high-water mark of a call, allocation is a pointer bump and
+     * work() no longer touches the heap.
+     *
+     * Only valid while the flowgraph is running (the arena lives in
+     * the block's detail).
+     */
+    template <typename T>
+    T *scratch_alloc(size_t nitems)
+    {
+      return reinterpret_cast<T*>(scratch_alloc_bytes(nitems * sizeof(T)));
+    }
+
+    //! Untyped form of scratch_alloc(); returns 16-byte aligned memory
+    void *scratch_alloc_bytes(size_t nbytes);
+
     /*!
      * \brief  Adds a new tag onto the given output buffer.
      *
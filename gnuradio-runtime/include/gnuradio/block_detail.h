@@ -170,6 +170,20 @@ namespace gr {
 			   const pmt::pmt_t &key,
 			   long id);
 
+    /*!
+     * \brief Bump-allocate \p nbytes of per-work scratch space.
+     *
+     * Backs gr::block::scratch_alloc(). Allocations are 16-byte
+     * aligned and valid only until the current work() call returns;
+     * the scheduler resets the arena afterwards. The arena regrows to
+     * the high-water mark of a call, so in steady state serving a
+     * request is a pointer bump with no heap traffic.
+     */
+    void *scratch_alloc(size_t nbytes);
+
+    //! Invalidate all scratch allocations; the scheduler calls this after work()
+    void scratch_reset();
+
     /*!
      * \brief Set core affinity of block to the cores in the vector
      * mask.
@@ -196,6 +210,14 @@ namespace gr {
      */
     int set_thread_priority(int priority);
 
+    /*!
+     * \brief Place the thread in a scheduling class at a given priority
+     *
+     * \param policy the scheduling class to use
+     * \param priority the native priority within that class
+     */
+    int set_thread_sched(gr::thread::sched_policy policy, int priority);
+
     bool                    threaded;  // set if thread is currently running.
     gr::thread::gr_thread_t thread;    // portable thread handle
 
@@ -229,7 +251,19 @@ namespace gr {
     float pc_work_time_var();
 
     float pc_work_time_total();
- 
+
+    //! Accumulate time spent blocked waiting on a neighbor; \p input
+    //! selects starved (true) vs output-blocked (false).
+    void pc_record_blocked_time(float diff, bool input);
+
+    //! Count one scheduler wakeup of this block's thread.
+    void pc_record_wakeup();
+
+    float pc_nwork_calls();
+    float pc_nwakeups();
+    float pc_input_blocked_time_total();
+    float pc_output_blocked_time_total();
+
     tpb_detail d_tpb;	// used by thread-per-block scheduler
     int d_produce_or;
 
@@ -242,6 +276,16 @@ namespace gr {
     std::vector<buffer_sptr>        d_output;
     bool                            d_done;
 
+    // Per-work scratch arena; see scratch_alloc()
+    char              *d_scratch;
+    size_t             d_scratch_size;
+    size_t             d_scratch_used;
+    std::vector<char*> d_scratch_overflow;
+
+    // Reused by the keyed get_tags_in_range so the filter pass
+    // doesn't allocate per call
+    std::vector<tag_t> d_tag_filter_scratch;
+
     // Performance counters
     float d_ins_noutput_items;
     float d_avg_noutput_items;
@@ -260,6 +304,9 @@ namespace gr {
     float d_avg_work_time;
     float d_var_work_time;
     float d_total_work_time;
+    float d_total_input_blocked_time;
+    float d_total_output_blocked_time;
+    float d_pc_nwakeups;
     float d_pc_counter;
   
     block_detail(unsigned int ninputs, unsigned int noutputs);
@@ -28,7 +28,7 @@
 #include <gnuradio/tags.h>
 #include <boost/weak_ptr.hpp>
 #include <gnuradio/thread/thread.h>
-#include <deque>
+#include <map>
 
 namespace gr {
 
@@ -44,9 +44,23 @@ namespace gr {
    * \param nitems is the minimum number of items the buffer will hold.
    * \param sizeof_item is the size of an item in bytes.
    * \param link is the block that writes to this buffer.
+   * \param allow_explicit_wrap permit the single-mapping fallback
+   *        described below.
+   *
+   * For item sizes that share few factors with the page size, the
+   * rounding required by the double vm mapping can inflate the buffer
+   * far beyond \p nitems.  When \p allow_explicit_wrap is set and
+   * that happens, a plain single mapping of the requested size is
+   * used instead and the seam is handled explicitly: space_available
+   * and items_available then never report past the end of the ring,
+   * so writer and readers wrap in item-sized steps.  The caller must
+   * guarantee every attached block can make progress one item at a
+   * time (history 1, no output_multiple, non-decimating), since a
+   * contiguous run near the seam can get arbitrarily short.
    */
   GR_RUNTIME_API buffer_sptr make_buffer(int nitems, size_t sizeof_item,
-                                         block_sptr link=block_sptr());
+                                         block_sptr link=block_sptr(),
+                                         bool allow_explicit_wrap=false);
 
   /*!
    * \brief Single writer, multiple reader fifo.
@@ -95,8 +109,67 @@ namespace gr {
 
     uint64_t nitems_written() { return d_abs_write_offset; }
 
+    /*!
+     * \brief Hint which NUMA node this buffer's memory should live on.
+     *
+     * On multi-socket machines a doubly mapped buffer lands on
+     * whichever node first touches it, which may be across the
+     * interconnect from both the producer and the consumer.  Setting
+     * a node hint binds the underlying pages (both mappings) to \p
+     * node: already-faulted pages are migrated and untouched pages
+     * fault in there.  Call it after the writer and reader threads
+     * have been pinned with gr::block::set_processor_affinity.
+     *
+     * A negative \p node clears the hint.  The hint is silently
+     * ignored on platforms without NUMA support.
+     */
+    void set_numa_node(int node);
+
+    //! Return the NUMA node hint, or -1 if none has been set.
+    int numa_node() const { return d_numa_node; }
+
+    /*!
+     * \brief Allow this buffer to be grown while the flowgraph runs.
+     *
+     * Set by the scheduler when the buffer_grow_on_block preference
+     * is enabled.  Growable buffers always take the mutex for index
+     * updates (the SPSC fast path is disabled for them).
+     */
+    void set_growable(bool growable) { d_growable = growable; }
+    bool growable() const { return d_growable; }
+
+    /*!
+     * \brief True when this buffer is a plain single mapping whose
+     * wraparound is handled explicitly (see make_buffer); such
+     * buffers cannot be grown.
+     */
+    bool explicit_wrap() const { return d_explicit_wrap; }
+
+    /*!
+     * \brief Reallocate this buffer to hold at least \p min_nitems
+     * (and at least double the current size).
+     *
+     * May only be called from the writer's scheduler thread, between
+     * calls to the writer's work function.  The old double mapping is
+     * kept alive until the buffer is destroyed so a reader that is
+     * mid-work keeps dereferencing valid memory; readers' indices and
+     * absolute offsets are never touched.  Returns false if the
+     * buffer cannot be grown right now (mixed reader wrap states or
+     * allocation failure); the caller may simply retry later.
+     */
+    bool grow(int min_nitems);
+
     size_t get_sizeof_item() { return d_sizeof_item; }
 
+    /*!
+     * \brief Overwrite the entire ring with zero bytes.
+     *
+     * The circular mapping keeps the zeros in place at every offset,
+     * so a writer that only ever emits zeros (e.g. a null source) can
+     * call this once and never touch the buffer again.
+     */
+    void zero_fill();
+
     /*!
      * \brief  Adds a new tag to the buffer.
      *
@@ -104,6 +177,31 @@ namespace gr {
      */
     void add_item_tag(const tag_t &tag);
 
+    /*!
+     * \brief  Adds a batch of tags to the buffer under a single lock.
+     *
+     * The tags are expected in ascending offset order, as returned by
+     * get_tags_in_range(), so each insert can use the position of the
+     * previous one as a hint.
+     *
+     * \param tags       vector of new tags
+     */
+    void add_item_tags(const std::vector<tag_t> &tags);
+
+    /*!
+     * \brief  Adds a batch of tags to the buffer, consuming the source
+     * vector's contents.
+     *
+     * Like add_item_tags(), but transfers each tag's PMT fields by
+     * pointer swap instead of copying them, so no reference counts
+     * are touched.  The vector's tags are left empty; use this for
+     * the last (or only) destination of a scratch vector that is
+     * about to be refilled.
+     *
+     * \param tags       vector of new tags; emptied on return
+     */
+    void move_item_tags(std::vector<tag_t> &tags);
+
     /*!
      * \brief  Removes an existing tag from the buffer.
      *
@@ -125,14 +223,16 @@ namespace gr {
      */
     void prune_tags(uint64_t max_time);
 
-    std::deque<tag_t>::iterator get_tags_begin() { return d_item_tags.begin(); }
-    std::deque<tag_t>::iterator get_tags_end() { return d_item_tags.end(); }
+    std::multimap<uint64_t,tag_t>::iterator get_tags_begin() { return d_item_tags.begin(); }
+    std::multimap<uint64_t,tag_t>::iterator get_tags_end() { return d_item_tags.end(); }
+    std::multimap<uint64_t,tag_t>::iterator get_tags_lower_bound(uint64_t x) { return d_item_tags.lower_bound(x); }
+    std::multimap<uint64_t,tag_t>::iterator get_tags_upper_bound(uint64_t x) { return d_item_tags.upper_bound(x); }
 
     // -------------------------------------------------------------------------
 
   private:
     friend class buffer_reader;
-    friend GR_RUNTIME_API buffer_sptr make_buffer(int nitems, size_t sizeof_item, block_sptr link);
+    friend GR_RUNTIME_API buffer_sptr make_buffer(int nitems, size_t sizeof_item, block_sptr link, bool allow_explicit_wrap);
     friend GR_RUNTIME_API buffer_reader_sptr buffer_add_reader
       (buffer_sptr buf, int nzero_preload, block_sptr link, int delay);
 
@@ -157,8 +257,30 @@ namespace gr {
     unsigned int			d_write_index;	// in items [0,d_bufsize)
     uint64_t                            d_abs_write_offset; // num items written since the start
     bool				d_done;
-    std::deque<tag_t>                   d_item_tags;
+    // Tags ordered by item offset so range queries and pruning are
+    // O(log n) instead of a linear scan of every live tag.
+    std::multimap<uint64_t,tag_t>       d_item_tags;
     uint64_t                            d_last_min_items_read;
+    int					d_numa_node;	// NUMA placement hint, -1 = none
+
+    //
+    // True when this buffer has exactly one reader.  In that case the
+    // write index is only ever stored by the writer thread and the
+    // read index only by the reader thread, so the index updates can
+    // use a store-release/load-acquire protocol instead of taking
+    // d_mutex (which tops contention profiles at high sample rates).
+    // Fan-out connections fall back to the mutex path.
+    //
+    bool				d_single_reader;
+    bool				d_growable;	// runtime growth allowed
+    bool				d_explicit_wrap; // single mapping, seam-limited
+
+    // Mappings retired by grow(); kept alive so stale read pointers
+    // in a reader's current work call stay valid.
+    std::vector<gr::vmcircbuf*>		d_retired_circbufs;
+
+    //! Recompute d_single_reader; called when readers come and go.
+    void update_reader_mode() { d_single_reader = (d_readers.size() == 1); }
 
     unsigned index_add(unsigned a, unsigned b)
     {
@@ -182,6 +304,15 @@ namespace gr {
       return s;
     }
 
+    //! Clamp writable space to the end of the ring for explicit-wrap buffers.
+    int space_to_seam(int space) const
+    {
+      if(!d_explicit_wrap)
+        return space;
+      int to_seam = d_bufsize - d_write_index;
+      return space < to_seam ? space : to_seam;
+    }
+
     virtual bool allocate_buffer(int nitems, size_t sizeof_item);
 
     /*!
@@ -197,7 +328,8 @@ namespace gr {
      * dependent boundary.  This is typically the system page size, but
      * under MS windows is 64KB.
      */
-    buffer(int nitems, size_t sizeof_item, block_sptr link);
+    buffer(int nitems, size_t sizeof_item, block_sptr link,
+           bool allow_explicit_wrap);
 
     /*!
      * \brief disassociate \p reader from this buffer
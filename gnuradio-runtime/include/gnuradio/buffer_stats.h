@@ -0,0 +1,106 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_BUFFER_STATS_H
+#define INCLUDED_GR_RUNTIME_BUFFER_STATS_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/thread/thread.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace gr {
+
+  /*!
+   * \brief Samples the fill level of every live gr::buffer.
+   * \ingroup internal
+   *
+   * Every buffer registers itself on construction, so a snapshot
+   * covers the whole process: one entry per buffer reader (i.e. per
+   * stream edge), computed from racy lock-free reads of the write
+   * and read indices. The numbers may be a few items stale but
+   * taking a snapshot never blocks a running flowgraph.
+   *
+   * Beyond one-shot snapshots, a background sampler can record the
+   * peak fill of every edge between queries; a persistently full
+   * buffer is where backpressure originates. The sampler is started
+   * by gr::top_block when the [ControlPort] buffer_stats preference
+   * is set, and the formatted lists are exported as the "buffer
+   * fills" and "buffer peaks" ControlPort variables on the top
+   * block.
+   */
+  class GR_RUNTIME_API buffer_stats
+  {
+  public:
+    struct entry {
+      std::string writer;	//!< alias of the block writing the buffer
+      std::string reader;	//!< alias of the block reading this edge
+      int items;		//!< items queued for this reader
+      int bufsize;		//!< buffer capacity in items
+    };
+
+    //! One-shot fill levels of every live buffer.  Implemented in
+    //! buffer.cc, next to the registry it walks.
+    static std::vector<entry> snapshot();
+
+    static buffer_stats *singleton();
+
+    /*!
+     * \brief Start the background sampler.
+     * \param period_ms time between snapshots, in milliseconds.
+     */
+    void start(long period_ms = 10);
+
+    //! Stop the background sampler.
+    void stop();
+
+    //! Formatted snapshot, one "writer->reader: items/bufsize" line
+    //! per edge.
+    std::string fill_list();
+
+    /*!
+     * \brief Peak fill fraction of every edge seen by the sampler
+     * since the last call, one "writer->reader: peak%" line per
+     * edge; clears the peaks.
+     */
+    std::string peak_list();
+
+  private:
+    buffer_stats();
+    ~buffer_stats();
+
+    void run();
+
+    gr::thread::mutex d_mutex;
+    gr::thread::thread d_thread;
+    bool d_running;
+    bool d_finished;
+    long d_period_ms;
+
+    // edge name -> peak fill fraction since the last peak_list()
+    std::map<std::string, double> d_peaks;
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_BUFFER_STATS_H */
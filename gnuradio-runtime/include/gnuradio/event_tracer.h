@@ -0,0 +1,135 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_EVENT_TRACER_H
+#define INCLUDED_GR_RUNTIME_EVENT_TRACER_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/high_res_timer.h>
+#include <gnuradio/thread/thread.h>
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace gr {
+
+  /*!
+   * \brief Records scheduler events into a compact binary trace.
+   * \ingroup internal
+   *
+   * When the [Tracer] enable preference is set, every
+   * block_executor logs a (block, event, timestamp, nitems) record
+   * at the start and end of each work() call. Records go into a
+   * per-executor single-producer ring — appending is a couple of
+   * stores, no locks — and a flusher thread drains the rings into
+   * the file named by the [Tracer] file preference (default
+   * ./gr_trace.dat), with block names in a ".names" sidecar.
+   *
+   * The file starts with a 16-byte header (magic "GRTRACE1", then
+   * high_res_timer ticks-per-second as a little-endian uint64)
+   * followed by packed 24-byte records. gr_trace_to_chrome converts
+   * a trace to the chrome://tracing JSON format.
+   */
+  class GR_RUNTIME_API event_tracer
+  {
+  public:
+    enum event_t {
+      EV_WORK_START = 1,
+      EV_WORK_END = 2
+    };
+
+    struct record {
+      uint64_t ticks;		// high_res_timer_now() at the event
+      uint32_t block;		// id from the .names sidecar
+      uint32_t nitems;		// noutput_items in, items produced out
+      uint32_t event;		// event_t
+      uint32_t pad;
+    };
+
+    /*!
+     * \brief Single-producer ring of trace records.
+     *
+     * Only the owning executor appends; the flusher thread is the
+     * only consumer. A full ring drops the record rather than
+     * block the scheduler.
+     */
+    class ring
+    {
+    public:
+      //! Append a record; never blocks.
+      void push(event_t event, uint32_t nitems);
+
+    private:
+      friend class event_tracer;
+
+      ring(uint32_t block_id, size_t capacity);
+
+      uint32_t d_block;
+      size_t d_mask;
+      std::vector<record> d_buf;
+      uint64_t d_ndropped;
+
+      volatile size_t d_head;	// written by the producer
+      volatile size_t d_tail;	// written by the flusher
+    };
+
+    static event_tracer *singleton();
+
+    //! True when the [Tracer] enable preference is set.
+    bool enabled() const { return d_enabled; }
+
+    //! Register an executor under \p name; returns NULL when
+    //! tracing is disabled.
+    ring *attach(const std::string &name);
+
+    //! Flush and discard \p r; may be NULL.
+    void detach(ring *r);
+
+    //! Record an event; \p r may be NULL.
+    static void trace(ring *r, event_t event, uint32_t nitems)
+    {
+      if(r)
+        r->push(event, nitems);
+    }
+
+  private:
+    event_tracer();
+    ~event_tracer();
+
+    void run();
+    void flush(ring *r);
+
+    gr::thread::mutex d_mutex;
+    gr::thread::thread d_thread;
+    bool d_enabled;
+    bool d_finished;
+
+    std::FILE *d_file;
+    std::FILE *d_names;
+    uint32_t d_next_id;
+    std::vector<ring*> d_rings;
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_EVENT_TRACER_H */
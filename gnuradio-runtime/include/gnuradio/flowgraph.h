@@ -27,6 +27,8 @@
 #include <gnuradio/basic_block.h>
 #include <gnuradio/io_signature.h>
 #include <iostream>
+#include <set>
+#include <utility>
 
 namespace gr {
 
@@ -204,6 +206,12 @@ namespace gr {
     edge calc_upstream_edge(basic_block_sptr block, int port);
 
   private:
+    // Destination endpoints currently on the edge list.  Kept in sync
+    // by connect/disconnect/clear so check_dst_not_used() doesn't have
+    // to rescan d_edges on every connect; flattening a graph with many
+    // copies of the same hierarchical block is quadratic without it.
+    std::set<std::pair<basic_block*, int> > d_used_dsts;
+
     void check_valid_port(gr::io_signature::sptr sig, int port);
     void check_valid_port(const msg_endpoint &e);
     void check_dst_not_used(const endpoint &dst);
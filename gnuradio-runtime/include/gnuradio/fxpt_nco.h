@@ -26,7 +26,9 @@
 #include <gnuradio/api.h>
 #include <gnuradio/fxpt.h>
 #include <gnuradio/gr_complex.h>
+#include <volk/volk.h>
 #include <stdint.h>
+#include <cmath>
 
 namespace gr {
 
@@ -87,19 +89,65 @@ namespace gr {
       *cosx = gr::fxpt::cos(d_phase);
     }
 
-    // compute cos and sin for a block of phase angles
+    // compute cos and sin for a block of phase angles.  The phases
+    // are computed up front from the phase increment, so the four
+    // table lookups per round are independent of each other instead
+    // of being serialized behind the phase accumulator.
     void sincos(gr_complex *output, int noutput_items, double ampl=1.0)
     {
-      for(int i = 0; i < noutput_items; i++) {
+      int i = 0;
+      for(; i + 4 <= noutput_items; i += 4) {
+        uint32_t p0 = d_phase;
+        uint32_t p1 = d_phase + d_phase_inc;
+        uint32_t p2 = d_phase + 2*d_phase_inc;
+        uint32_t p3 = d_phase + 3*d_phase_inc;
+        output[i]   = gr_complex(gr::fxpt::cos(p0) * ampl, gr::fxpt::sin(p0) * ampl);
+        output[i+1] = gr_complex(gr::fxpt::cos(p1) * ampl, gr::fxpt::sin(p1) * ampl);
+        output[i+2] = gr_complex(gr::fxpt::cos(p2) * ampl, gr::fxpt::sin(p2) * ampl);
+        output[i+3] = gr_complex(gr::fxpt::cos(p3) * ampl, gr::fxpt::sin(p3) * ampl);
+        step(4);
+      }
+      for(; i < noutput_items; i++) {
         output[i] = gr_complex(gr::fxpt::cos(d_phase) * ampl, gr::fxpt::sin(d_phase) * ampl);
         step();
       }
     }
 
+    // compute cos and sin for a block of phase angles with the volk
+    // rotator kernel: the tone is a phasor recursion with periodic
+    // renormalization rather than table lookups.  The fixed point
+    // phase accumulator stays the canonical state, so every call
+    // starts from the exact phase and float error cannot build up
+    // across calls.
+    void sincos_rotator(gr_complex *output, int noutput_items, double ampl=1.0)
+    {
+      if(noutput_items <= 0)
+        return;
+
+      double ph = gr::fxpt::fixed_to_float(d_phase);
+      double inc = gr::fxpt::fixed_to_float(d_phase_inc);
+      gr_complex phase = gr_complex((float)::cos(ph), (float)::sin(ph));
+      gr_complex incr = gr_complex((float)::cos(inc), (float)::sin(inc));
+
+      for(int i = 0; i < noutput_items; i++)
+        output[i] = gr_complex((float)ampl, 0);
+      volk_32fc_s32fc_x2_rotator_32fc(output, output, incr, &phase, noutput_items);
+
+      step(noutput_items);
+    }
+
     // compute sin for a block of phase angles
     void sin(float *output, int noutput_items, double ampl=1.0)
     {
-      for(int i = 0; i < noutput_items; i++) {
+      int i = 0;
+      for(; i + 4 <= noutput_items; i += 4) {
+        output[i]   = (float)(gr::fxpt::sin(d_phase) * ampl);
+        output[i+1] = (float)(gr::fxpt::sin(d_phase + d_phase_inc) * ampl);
+        output[i+2] = (float)(gr::fxpt::sin(d_phase + 2*d_phase_inc) * ampl);
+        output[i+3] = (float)(gr::fxpt::sin(d_phase + 3*d_phase_inc) * ampl);
+        step(4);
+      }
+      for(; i < noutput_items; i++) {
         output[i] = (float)(gr::fxpt::sin(d_phase) * ampl);
         step();
       }
@@ -108,7 +156,15 @@ namespace gr {
     // compute cos for a block of phase angles
     void cos(float *output, int noutput_items, double ampl=1.0)
     {
-      for(int i = 0; i < noutput_items; i++) {
+      int i = 0;
+      for(; i + 4 <= noutput_items; i += 4) {
+        output[i]   = (float)(gr::fxpt::cos(d_phase) * ampl);
+        output[i+1] = (float)(gr::fxpt::cos(d_phase + d_phase_inc) * ampl);
+        output[i+2] = (float)(gr::fxpt::cos(d_phase + 2*d_phase_inc) * ampl);
+        output[i+3] = (float)(gr::fxpt::cos(d_phase + 3*d_phase_inc) * ampl);
+        step(4);
+      }
+      for(; i < noutput_items; i++) {
         output[i] = (float)(gr::fxpt::cos(d_phase) * ampl);
         step ();
       }
@@ -155,6 +211,155 @@ namespace gr {
     float sin() const { return gr::fxpt::sin(d_phase); }
   };
 
+  /*!
+   * \brief NCO over a private quarter-wave table with phase dithering.
+   * \ingroup misc
+   *
+   * Follows the gr::fxpt_nco interface but looks up a per-instance
+   * direct (uninterpolated) quarter-wave table of 2^(NBITS-2) floats
+   * instead of the shared 8 KB fxpt table, so dozens of oscillators
+   * --- a channelized transmitter, say --- keep their combined
+   * working set inside L1: fxpt_nco_small<12> carries 4 KB,
+   * fxpt_nco_small<10> 1 KB.
+   *
+   * Truncating the phase to NBITS index bits concentrates the
+   * quantization error into discrete spurs whenever the phase
+   * increment divides the table period. With dithering on (the
+   * default) every lookup perturbs its phase by a uniform offset
+   * below one table step, which spreads those spurs into a flat
+   * noise floor of the same power; the accumulator itself is never
+   * touched, so no error builds up. Peak amplitude error is on the
+   * order of pi/2^(NBITS-1) either way; use gr::fxpt or
+   * gr::fxpt_sine_table where more accuracy is needed.
+   */
+  template<int NBITS>
+  class fxpt_nco_small
+  {
+    static const int WORDBITS = 32;
+    static const int QBITS = NBITS - 2;
+    static const int QSHIFT = WORDBITS - 2 - QBITS;
+
+    float d_qtab[1 << QBITS];
+    uint32_t d_phase;
+    int32_t d_phase_inc;
+    uint32_t d_rng;
+    bool d_dither;
+
+    float lookup(uint32_t ux) const
+    {
+      // fold into the first quadrant, as in gr::fxpt_sine_table
+      uint32_t uf;
+      float sign;
+      switch(ux >> (WORDBITS - 2)) {
+      case 0:  uf = ux;                sign =  1.0f; break;
+      case 1:  uf = 0x80000000UL - ux; sign =  1.0f; break;
+      case 2:  uf = ux - 0x80000000UL; sign = -1.0f; break;
+      default: uf = 0 - ux;            sign = -1.0f; break;
+      }
+      int index = (int)(uf >> QSHIFT);
+      if(index == (1 << QBITS))  // uf == 2^30, i.e. x == +/- pi/2
+        index--;
+      return sign * d_qtab[index];
+    }
+
+    // uniform offset below one table step; a plain LCG is plenty
+    // for decorrelating the index truncation
+    uint32_t dithered_phase()
+    {
+      if(!d_dither)
+        return d_phase;
+      d_rng = d_rng * 1664525UL + 1013904223UL;
+      return d_phase + (d_rng >> NBITS);
+    }
+
+  public:
+    fxpt_nco_small()
+      : d_phase(0), d_phase_inc(0), d_rng(0x2545f491UL), d_dither(true)
+    {
+      // sample each segment at its midpoint to center the
+      // truncation error around zero
+      const double incx = 1073741824.0 / (1 << QBITS);    // 2^30 / entries
+      const double to_rad = 3.14159265358979323846 / 2147483648.0;
+      for(int i = 0; i < (1 << QBITS); i++)
+        d_qtab[i] = ::sin((i + 0.5) * incx * to_rad);
+    }
+
+    //! table footprint in bytes
+    static int table_bytes() { return sizeof(float) * (1 << QBITS); }
+
+    // radians
+    void set_phase(float angle) {
+      d_phase = gr::fxpt::float_to_fixed(angle);
+    }
+
+    void adjust_phase(float delta_phase) {
+      d_phase += gr::fxpt::float_to_fixed(delta_phase);
+    }
+
+    // angle_rate is in radians / step
+    void set_freq(float angle_rate) {
+      d_phase_inc = gr::fxpt::float_to_fixed(angle_rate);
+    }
+
+    // angle_rate is a delta in radians / step
+    void adjust_freq(float delta_angle_rate) {
+      d_phase_inc += gr::fxpt::float_to_fixed(delta_angle_rate);
+    }
+
+    void set_dither(bool on) { d_dither = on; }
+    bool dither() const { return d_dither; }
+
+    // increment current phase angle
+    void step() { d_phase += d_phase_inc; }
+    void step(int n) { d_phase += d_phase_inc * n; }
+
+    // units are radians / step
+    float get_phase() const { return gr::fxpt::fixed_to_float(d_phase); }
+    float get_freq() const { return gr::fxpt::fixed_to_float(d_phase_inc); }
+
+    // compute sin and cos for current phase angle; one dither draw
+    // covers both so the pair stays in quadrature
+    void sincos(float *sinx, float *cosx)
+    {
+      uint32_t p = dithered_phase();
+      *sinx = lookup(p);
+      *cosx = lookup(p + 0x40000000UL);
+    }
+
+    // compute cos and sin for a block of phase angles
+    void sincos(gr_complex *output, int noutput_items, double ampl=1.0)
+    {
+      for(int i = 0; i < noutput_items; i++) {
+        uint32_t p = dithered_phase();
+        output[i] = gr_complex((float)(lookup(p + 0x40000000UL) * ampl),
+                               (float)(lookup(p) * ampl));
+        step();
+      }
+    }
+
+    // compute sin for a block of phase angles
+    void sin(float *output, int noutput_items, double ampl=1.0)
+    {
+      for(int i = 0; i < noutput_items; i++) {
+        output[i] = (float)(lookup(dithered_phase()) * ampl);
+        step();
+      }
+    }
+
+    // compute cos for a block of phase angles
+    void cos(float *output, int noutput_items, double ampl=1.0)
+    {
+      for(int i = 0; i < noutput_items; i++) {
+        output[i] = (float)(lookup(dithered_phase() + 0x40000000UL) * ampl);
+        step();
+      }
+    }
+
+    // compute cos or sin for current phase angle (undithered)
+    float cos() const { return lookup(d_phase + 0x40000000UL); }
+    float sin() const { return lookup(d_phase); }
+  };
+
 } /* namespace gr */
 
 #endif /* INCLUDED_GR_FXPT_NCO_H */
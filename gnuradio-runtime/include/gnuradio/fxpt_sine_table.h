@@ -0,0 +1,122 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_FXPT_SINE_TABLE_H
+#define INCLUDED_GR_FXPT_SINE_TABLE_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/types.h>
+#include <cmath>
+
+namespace gr {
+
+  /*!
+   * \brief Quarter-wave fixed point sine table with configurable
+   * resolution.
+   * \ingroup misc
+   *
+   * gr::fxpt looks sine up in a fixed 1024-entry interpolated table
+   * (8 KB); random-phase lookups from many concurrent NCOs evict
+   * each other from L1. This class builds the same piecewise-linear
+   * approximation at construction time at any resolution and stores
+   * only the first quarter wave, mapping the other quadrants onto it
+   * by symmetry. The footprint is 2^(NBITS-2) two-float entries:
+   * fxpt_sine_table<10> matches the accuracy of the stock table in a
+   * quarter of the space, and fxpt_sine_table<8> costs 512 bytes.
+   *
+   * NBITS is the log2 of the equivalent full-wave table length,
+   * 4 <= NBITS <= 16. The phase convention matches gr::fxpt:
+   * -2**31 is -pi, 0 is 0, 2**31-1 is pi - epsilon.
+   */
+  template<int NBITS>
+  class fxpt_sine_table
+  {
+  private:
+    static const int WORDBITS = 32;
+    static const int QBITS = NBITS - 2;             // quarter-wave entries
+    static const int QSHIFT = WORDBITS - 2 - QBITS; // folded phase -> index
+
+    float d_table[1 << QBITS][2];
+
+    float lookup(gr_uint32 ux) const
+    {
+      // fold into the first quadrant: sine is mirrored about pi/2
+      // and odd about pi
+      gr_uint32 uf;
+      float sign;
+      switch(ux >> (WORDBITS - 2)) {
+      case 0:  uf = ux;                sign =  1.0f; break;
+      case 1:  uf = 0x80000000UL - ux; sign =  1.0f; break;
+      case 2:  uf = ux - 0x80000000UL; sign = -1.0f; break;
+      default: uf = 0 - ux;            sign = -1.0f; break;
+      }
+      int index = (int)(uf >> QSHIFT);
+      if(index == (1 << QBITS))  // uf == 2^30, i.e. x == +/- pi/2
+        index--;
+      return sign * (d_table[index][0] * (uf >> 1) + d_table[index][1]);
+    }
+
+  public:
+    fxpt_sine_table()
+    {
+      // same segment fit as gen_sine_table.py, restricted to [0, pi/2)
+      const double incx = 1073741824.0 / (1 << QBITS);    // 2^30 / entries
+      const double to_rad = 3.14159265358979323846 / 2147483648.0;
+      for(int i = 0; i < (1 << QBITS); i++) {
+        double a = i * incx;
+        double b = (i + 1) * incx;
+        double fa = ::sin(a * to_rad);
+        double fb = ::sin(b * to_rad);
+        double fm = ::sin((a + b) / 2 * to_rad);
+        double m = (fb - fa) / (b - a);
+        double c = (3*a + b) * (fa - fb) / (4 * (b - a)) + (fm + fa) / 2;
+        d_table[i][0] = 2 * m;
+        d_table[i][1] = c;
+      }
+    }
+
+    //! \brief Table footprint in bytes.
+    static int table_bytes() { return sizeof(float) * 2 * (1 << QBITS); }
+
+    //! \brief Given a fixed point angle x, return float sine(x)
+    float sin(gr_int32 x) const
+    {
+      return lookup((gr_uint32)x);
+    }
+
+    //! \brief Given a fixed point angle x, return float cosine(x)
+    float cos(gr_int32 x) const
+    {
+      return lookup((gr_uint32)x + 0x40000000UL);
+    }
+
+    //! \brief Given a fixed point angle x, return sin(x) and cos(x)
+    void sincos(gr_int32 x, float *s, float *c) const
+    {
+      *s = sin(x);
+      *c = cos(x);
+    }
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_FXPT_SINE_TABLE_H */
@@ -104,6 +104,21 @@ namespace gr {
     void connect(basic_block_sptr src, int src_port,
                  basic_block_sptr dst, int dst_port);
 
+    /*!
+     * \brief Wire together two blocks with a per-connection buffer
+     * size override
+     *
+     * Like the four-argument connect, but additionally requires the
+     * buffer feeding the connection to hold at least \p buffer_nitems
+     * items (rounded up by the allocator), instead of the default
+     * heuristic.  Useful when a decimating chain needs a much deeper
+     * upstream ring.  \p src must be a non-hierarchical block, since
+     * the buffer belongs to its output port.
+     */
+    void connect(basic_block_sptr src, int src_port,
+                 basic_block_sptr dst, int dst_port,
+                 int buffer_nitems);
+
     /*!
      * \brief Add gr-blocks or hierarchical blocks to internal graph
      * and wire together
@@ -233,6 +248,24 @@ namespace gr {
      * call could be misleading.
      */
     std::vector<int> processor_affinity();
+
+    /*!
+     * \brief Set the thread priority of all blocks in hier_block2.
+     *
+     * \param priority the priority to set on each block's thread.
+     */
+    int set_thread_priority(int priority);
+
+    /*!
+     * \brief Get the current thread priority.
+     *
+     * \details This returns the thread priority value for the first
+     * block in the hier_block2's list of blocks with the assumption
+     * that they have always only been set through the hier_block2's
+     * interface. If any block has been individually set, then this
+     * call could be misleading.
+     */
+    int thread_priority();
   };
 
   /*!
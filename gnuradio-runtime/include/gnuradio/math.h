@@ -63,6 +63,25 @@ namespace gr {
     return fast_atan2f(z.imag(), z.real());
   }
 
+  /*!
+   * \brief Buffer-oriented fast arc tangent
+   * \ingroup misc
+   *
+   * \param y vector of y components
+   * \param x vector of x components
+   * \param out output angles in radians
+   * \param n number of points
+   *
+   * Runs the fast_atan2f table kernel over a whole buffer, keeping
+   * the per-sample work inside one translation unit instead of
+   * paying a cross-library call for every sample.
+   */
+  GR_RUNTIME_API void fast_atan2f_vec(const float *y, const float *x,
+                                      float *out, int n);
+
+  //! \brief Buffer-oriented fast arc tangent of complex samples
+  GR_RUNTIME_API void fast_atan2f_vec(const gr_complex *in, float *out, int n);
+
   /* This bounds x by +/- clip without a branch */
   static inline float
   branchless_clip(float x, float clip)
@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_MPSC_QUEUE_H
+#define INCLUDED_GR_RUNTIME_MPSC_QUEUE_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/thread/thread.h>
+#include <pmt/pmt.h>
+
+namespace gr {
+
+  /*!
+   * \brief Bounded lock-free queue of pmts, used for message port
+   * delivery.
+   * \ingroup internal
+   *
+   * A fixed-capacity ring in the style of Vyukov's bounded MPMC
+   * queue: every cell carries a sequence number that hands ownership
+   * back and forth between producers and the consumer, so
+   * insert_tail and delete_head_nowait are lock-free on compilers
+   * that provide atomic builtins (elsewhere a mutex guards the index
+   * arithmetic).
+   *
+   * The policy chosen at construction time decides what insert_tail
+   * does when the queue is full: BLOCK waits for the consumer to
+   * drain, DROP_OLDEST discards the message at the head to make
+   * room.
+   */
+  class GR_RUNTIME_API mpsc_queue
+  {
+  public:
+    enum overflow_policy {
+      BLOCK,		//!< insert_tail waits for space
+      DROP_OLDEST	//!< insert_tail discards the oldest queued message
+    };
+
+    /*!
+     * \param capacity maximum number of queued messages; rounded up
+     *        to a power of two.
+     * \param policy what insert_tail does when the queue is full.
+     */
+    mpsc_queue(size_t capacity, overflow_policy policy);
+    ~mpsc_queue();
+
+    //! Append \p msg, honoring the overflow policy.  Any thread.
+    void insert_tail(const pmt::pmt_t &msg);
+
+    /*!
+     * \returns the pmt at the head of the queue, or pmt::pmt_t() if
+     * the queue is empty.
+     */
+    pmt::pmt_t delete_head_nowait();
+
+    /*!
+     * Drain every message currently in the queue, appending them to
+     * \p msgs in arrival order.
+     *
+     * \returns the number of messages appended.
+     */
+    size_t delete_all_nowait(std::vector<pmt::pmt_t> &msgs);
+
+    //! Advisory: racy snapshot under concurrent insertion.
+    bool empty_p() const { return count() == 0; }
+
+    //! Advisory: racy snapshot under concurrent insertion.
+    size_t count() const;
+
+    size_t capacity() const { return d_mask + 1; }
+
+    //! Number of messages discarded by the DROP_OLDEST policy.
+    size_t ndropped() const { return d_ndropped; }
+
+  private:
+    struct cell {
+      volatile size_t	d_seq;
+      pmt::pmt_t	d_value;
+    };
+
+    //! Append \p msg; returns false if the queue is full.
+    bool try_insert(const pmt::pmt_t &msg);
+
+    cell	       *d_buffer;
+    size_t		d_mask;
+    overflow_policy	d_policy;
+    volatile size_t	d_ndropped;
+
+    // The producer and consumer cursors live on separate cache lines
+    // so producers don't steal the line the consumer is spinning on.
+    char		d_pad0[64];
+    volatile size_t	d_enqueue_pos;
+    char		d_pad1[64];
+    volatile size_t	d_dequeue_pos;
+
+    gr::thread::mutex	d_mutex;	// only used by the non-atomic fallback
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_MPSC_QUEUE_H */
@@ -0,0 +1,87 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_PHILOX_RANDOM_H
+#define INCLUDED_GR_PHILOX_RANDOM_H
+
+#include <gnuradio/api.h>
+#include <stdint.h>
+
+namespace gr {
+
+  /*!
+   * \brief Counter-based pseudo random number generator with batched
+   * output.
+   * \ingroup math_blk
+   *
+   * \details
+   * Philox-4x32 generator: each 128-bit output block is a pure
+   * function of (seed, stream, counter), so the variate stream is
+   * fully determined by the seed regardless of how the scheduler
+   * slices the buffers that consume it, and a stream can be
+   * repositioned with set_position(). Unlike gr::random it fills
+   * whole buffers per call; counter blocks are independent, so the
+   * generation loop has no loop-carried state to serialize it.
+   *
+   * Normal deviates come from the Box-Muller transform applied to
+   * the uniform output, four per counter block.
+   */
+  class GR_RUNTIME_API philox_random
+  {
+  public:
+    philox_random(uint64_t seed = 0, uint64_t stream = 0);
+
+    //! Restart the generator with a new seed; the counter rewinds to 0.
+    void reseed(uint64_t seed, uint64_t stream = 0);
+
+    //! Counter of the next unconsumed 128-bit block
+    uint64_t position() const { return d_counter; }
+
+    //! Jump to an absolute block counter; pending cached variates
+    //! are dropped.
+    void set_position(uint64_t counter);
+
+    //! Fill \p out with \p n uniform deviates in [0.0, 1.0)
+    void uniform(float *out, int n);
+
+    //! Fill \p out with \p n normal deviates, zero mean, variance 1
+    void gaussian(float *out, int n);
+
+  private:
+    // one Philox-4x32-10 block at the current counter; advances it
+    void gen_block(uint32_t r[4]);
+    void gen_uniform(float u[4]);
+
+    uint64_t d_counter;
+    uint32_t d_key0, d_key1;
+    uint32_t d_stream0, d_stream1;
+
+    // leftover variates of a partially consumed block, so the output
+    // stream does not depend on the caller's buffer boundaries
+    float d_cache[4];
+    int d_ncached;
+    int d_cache_type;
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_PHILOX_RANDOM_H */
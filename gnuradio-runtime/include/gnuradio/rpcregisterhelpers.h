@@ -30,6 +30,7 @@
 #include <gnuradio/rpcmanager.h>
 #include <gnuradio/rpcserver_selector.h>
 #include <gnuradio/rpcserver_base.h>
+#include <gnuradio/rpcsnapshot.h>
 #include <gnuradio/block_registry.h>
 
 // Base classes
@@ -785,6 +786,44 @@ template<typename Tfrom> class rpcbasic_register_variable_rw : public rpcbasic_r
 };
 
 
+/*
+ * This class exports a value the block publishes into a preallocated
+ * snapshot slot (see gr::rpc_snapshot).
+ *
+ * The query callback reads the slot with its seqlock and never calls
+ * into the block, so ControlPort polling cannot contend with the DSP
+ * threads.  The block calls publish() from its work thread whenever
+ * the value changes; before the first publish, queries return a
+ * default-constructed value.
+ */
+template<typename Tfrom>
+class rpcbasic_register_snapshot : public rpcbasic_base
+{
+protected:
+  rpcbasic_register_get< rpcbasic_register_snapshot<Tfrom>, Tfrom > d_rpc_reg;
+  gr::rpc_snapshot<Tfrom> d_snapshot;
+  Tfrom get()
+  {
+    Tfrom v = Tfrom();
+    d_snapshot.read(v);
+    return v;
+  }
+public:
+  rpcbasic_register_snapshot(const std::string& namebase,
+			     const char* functionbase,
+			     const pmt::pmt_t &min, const pmt::pmt_t &max, const pmt::pmt_t &def,
+			     const char* units_ = "",
+			     const char* desc_ = "",
+			     priv_lvl_t minpriv_ = RPC_PRIVLVL_MIN,
+			     DisplayType display_=DISPNULL) :
+    d_rpc_reg(namebase, functionbase, this, &rpcbasic_register_snapshot::get,
+	      min, max, def, units_, desc_, minpriv_, display_)
+  {
+  }
+
+  //! Publish a new value; call from the block's work thread only.
+  void publish(const Tfrom &v) { d_snapshot.publish(v); }
+};
 
 
 #endif
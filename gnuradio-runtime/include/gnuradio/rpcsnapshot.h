@@ -0,0 +1,150 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_RPCSNAPSHOT_H
+#define INCLUDED_GR_RUNTIME_RPCSNAPSHOT_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/thread/thread.h>
+
+/*
+ * Full fences for the seqlock below, where the compiler offers them.
+ * Without them the slot degrades to taking a mutex on both sides; the
+ * interface is unchanged.
+ */
+#if defined(__GNUC__)
+
+#define GR_RPCSNAPSHOT_HAVE_FENCE 1
+
+static inline void
+gr_rpcsnapshot_fence()
+{
+  __sync_synchronize();
+}
+
+#elif defined(_MSC_VER)
+
+#define GR_RPCSNAPSHOT_HAVE_FENCE 1
+#include <intrin.h>
+#include <windows.h>
+
+static inline void
+gr_rpcsnapshot_fence()
+{
+  _ReadWriteBarrier();
+  ::MemoryBarrier();
+}
+
+#else
+
+#define GR_RPCSNAPSHOT_HAVE_FENCE 0
+
+#endif
+
+namespace gr {
+
+  /*!
+   * \brief Single-writer snapshot slot for ControlPort exports.
+   * \ingroup internal
+   *
+   * A block publishes a plain value into the slot from its work
+   * thread; the ControlPort query thread reads the last published
+   * value without ever calling into the block, so polling a few
+   * hundred knobs at 10 Hz cannot contend with the DSP threads.
+   *
+   * The slot is double buffered under a sequence count: the writer
+   * stores into the buffer the readers are not looking at and then
+   * advances the count, and a reader retries its copy if the count
+   * moved underneath it.  publish() never waits, regardless of how
+   * many readers are polling.
+   *
+   * T must be copyable without side effects (scalars, complex, small
+   * PODs) and there must be exactly one writer per slot.
+   */
+  template<typename T>
+  class rpc_snapshot
+  {
+  public:
+    rpc_snapshot()
+      : d_seq(0), d_valid(false)
+    {
+      d_buf[0] = T();
+      d_buf[1] = T();
+    }
+
+    //! Store \p v as the current snapshot.  Writer thread only.
+    void publish(const T &v)
+    {
+#if GR_RPCSNAPSHOT_HAVE_FENCE
+      unsigned int s = d_seq;
+      d_buf[((s >> 1) + 1) & 1] = v;
+      gr_rpcsnapshot_fence();
+      d_seq = s + 2;
+      d_valid = true;
+#else
+      gr::thread::scoped_lock l(d_mutex);
+      d_buf[0] = v;
+      d_valid = true;
+#endif
+    }
+
+    /*!
+     * Copy the most recent snapshot into \p v.  Any thread.
+     * \returns false if nothing has been published yet.
+     */
+    bool read(T &v) const
+    {
+#if GR_RPCSNAPSHOT_HAVE_FENCE
+      if(!d_valid)
+        return false;
+      for(;;) {
+        unsigned int s = d_seq;
+        gr_rpcsnapshot_fence();
+        T copy = d_buf[(s >> 1) & 1];
+        gr_rpcsnapshot_fence();
+        if(d_seq == s) {
+          v = copy;
+          return true;
+        }
+        boost::this_thread::yield();
+      }
+#else
+      gr::thread::scoped_lock l(d_mutex);
+      if(!d_valid)
+        return false;
+      v = d_buf[0];
+      return true;
+#endif
+    }
+
+  private:
+    volatile unsigned int d_seq;
+    volatile bool d_valid;
+    T d_buf[2];
+#if !GR_RPCSNAPSHOT_HAVE_FENCE
+    mutable gr::thread::mutex d_mutex;
+#endif
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_RPCSNAPSHOT_H */
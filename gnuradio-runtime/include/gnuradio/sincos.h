@@ -30,6 +30,13 @@ namespace gr {
   // compute sine and cosine at the same time
   GR_RUNTIME_API void sincos (double x, double *sin, double *cos);
   GR_RUNTIME_API void sincosf (float x, float *sin, float *cos);
+
+  /*!
+   * Compute sine and cosine over a whole buffer using the gr::fxpt
+   * table kernel; branch-free per sample and accurate to the same
+   * grade the NCO and VCO run at (about 1e-5).
+   */
+  GR_RUNTIME_API void sincosf_vec (const float *x, float *sin, float *cos, int n);
 }
 
 #endif /* INCLUDED_GR_SINCOS_H */
@@ -38,6 +38,7 @@ namespace gr {
   {
   private:
     unsigned d_decimation;
+    int d_decimation_shift; // log2(decimation) when it is a power of two, else -1
 
   protected:
     sync_decimator(void) {} // allows pure virtual interface sub-classes
@@ -51,6 +52,17 @@ namespace gr {
     void set_decimation(unsigned decimation)
     {
       d_decimation = decimation;
+
+      // Most decimation cascades use power-of-two factors; caching
+      // the shift count lets the scheduler's rate-conversion path
+      // replace its integer divide with a shift.
+      d_decimation_shift = -1;
+      if(decimation != 0 && (decimation & (decimation - 1)) == 0) {
+        d_decimation_shift = 0;
+        while((1U << d_decimation_shift) != decimation)
+          d_decimation_shift++;
+      }
+
       set_relative_rate(1.0 / decimation);
     }
 
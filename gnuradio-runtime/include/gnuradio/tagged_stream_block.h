@@ -39,10 +39,16 @@ namespace gr {
   private:
     pmt::pmt_t d_length_tag_key; //!< This is the key for the tag that stores the PDU length
     gr_vector_int d_n_input_items_reqd; //!< How many input items do I need to process the next PDU?
+    bool d_multi_pdu; //!< Process all complete PDUs per work call instead of one
+
+    int general_work_multi(int noutput_items,
+                           gr_vector_int &ninput_items,
+                           gr_vector_const_void_star &input_items,
+                           gr_vector_void_star &output_items);
 
   protected:
     std::string d_length_tag_key_str;
-    tagged_stream_block(void) {} // allows pure virtual interface sub-classes
+    tagged_stream_block(void) : d_multi_pdu(false) {} // allows pure virtual interface sub-classes
     tagged_stream_block(const std::string &name,
                         gr::io_signature::sptr input_signature,
                         gr::io_signature::sptr output_signature,
@@ -92,6 +98,54 @@ namespace gr {
      */
     virtual void update_length_tags(int n_produced, int n_ports);
 
+    /*!
+     * \brief Process every complete PDU in the input buffer per work
+     *        call instead of exactly one.
+     *
+     * Off by default.  When enabled, general_work() gathers all PDUs
+     * whose input is complete and whose output fits the output buffer
+     * and hands them to work_multi() in one call, which amortizes the
+     * per-call scheduler overhead over many PDUs.  That matters for
+     * short PDUs at high packet rates.
+     *
+     * Gathering past the first PDU only happens when every input port
+     * carries the length tag key at the PDU boundary; otherwise the
+     * block degrades to one PDU per call.  The PDU length tags on the
+     * outputs are set by the base class in this mode, so blocks that
+     * override update_length_tags() or parse_length_tags() with
+     * non-standard semantics should leave it off.
+     */
+    void set_multi_pdu_mode(bool multi);
+
+    /*!
+     * \brief Process a batch of complete PDUs laid out back-to-back
+     *        in the input buffers.
+     *
+     * Only called in multi-PDU mode (see set_multi_pdu_mode()).  The
+     * default implementation calls work() once per PDU with offset
+     * buffer pointers; override it to vectorize across packets.
+     *
+     * PDUs must be processed in order, but an implementation may stop
+     * early; unprocessed PDUs are offered again on the next call.
+     * For every PDU fully processed, append the number of items it
+     * produced to \p pdu_noutput_items (empty on entry) -- that's
+     * where the base class gets the output length tags and the input
+     * consumption from.
+     *
+     * \param noutput_items The size of the writable output buffer
+     * \param pdu_ninput_items The exact size of the items on every input,
+     *                         per PDU; PDU k starts where PDU k-1 ended
+     * \param[out] pdu_noutput_items Number of items produced, per processed PDU
+     * \param input_items See gr::block
+     * \param output_items See gr::block
+     * \returns the total number of items produced, or WORK_DONE
+     */
+    virtual int work_multi(int noutput_items,
+                           const std::vector<gr_vector_int> &pdu_ninput_items,
+                           gr_vector_int &pdu_noutput_items,
+                           gr_vector_const_void_star &input_items,
+                           gr_vector_void_star &output_items);
+
   public:
     /*! \brief Don't override this.
      */
@@ -25,6 +25,7 @@
 
 #include <gnuradio/api.h>
 #include <pmt/pmt.h>
+#include <algorithm>
 
 namespace gr {
   
@@ -45,6 +46,21 @@ namespace gr {
     //! Used by gr_buffer to mark a tagged as deleted by a specific block. You can usually ignore this.
     std::vector<long> marked_deleted;
 
+    /*!
+     * Exchange contents with \p t by pointer swap. Unlike copying a
+     * tag, this touches no PMT reference counts, so it is the cheap
+     * way to transfer a tag out of a scratch vector that is about to
+     * be discarded or refilled.
+     */
+    inline void swap(tag_t &t)
+    {
+      std::swap(offset, t.offset);
+      key.swap(t.key);
+      value.swap(t.value);
+      srcid.swap(t.srcid);
+      marked_deleted.swap(t.marked_deleted);
+    }
+
     /*!
      * Comparison function to test which tag, \p x or \p y, came
      * first in time
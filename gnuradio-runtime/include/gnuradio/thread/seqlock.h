@@ -0,0 +1,100 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_THREAD_SEQLOCK_H
+#define INCLUDED_THREAD_SEQLOCK_H
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace gr {
+  namespace thread {
+
+    /*!
+     * \brief Lock-free publication of a value from one writer to any
+     * number of readers.
+     *
+     * \details
+     * A sequence counter is bumped to an odd value before the writer
+     * updates the stored value and to an even value afterwards.
+     * Readers copy the value and retry if the counter was odd or
+     * changed in the meantime, so they never block the writer.  This
+     * is meant for probe-style blocks whose work() publishes a
+     * measurement that monitoring threads poll at a high rate: the
+     * DSP thread never takes a lock and can never be preempted while
+     * holding one.
+     *
+     * Only a single thread may call write().  T must be copyable and
+     * must tolerate being copied while it is concurrently written
+     * (plain scalars, PODs and vectors of them are fine; anything
+     * with invariants between members is not).
+     */
+    template <class T>
+    class seqlock
+    {
+    private:
+      volatile unsigned int d_seq;
+      T d_value;
+
+      static inline void memory_barrier()
+      {
+#ifdef _MSC_VER
+        _ReadWriteBarrier();
+#else
+        __sync_synchronize();
+#endif
+      }
+
+    public:
+      seqlock() : d_seq(0), d_value() {}
+      seqlock(const T &value) : d_seq(0), d_value(value) {}
+
+      //! publish a new value (single writer only)
+      void write(const T &value)
+      {
+        d_seq++;
+        memory_barrier();
+        d_value = value;
+        memory_barrier();
+        d_seq++;
+      }
+
+      //! fetch the last published value; retries while a write is in flight
+      T read() const
+      {
+        unsigned int seq0;
+        T value;
+        do {
+          seq0 = d_seq;
+          memory_barrier();
+          value = d_value;
+          memory_barrier();
+        } while(seq0 != d_seq || (seq0 & 1));
+        return value;
+      }
+    };
+
+  } /* namespace thread */
+} /* namespace gr */
+
+#endif /* INCLUDED_THREAD_SEQLOCK_H */
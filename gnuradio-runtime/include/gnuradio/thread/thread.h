@@ -47,6 +47,20 @@ namespace gr {
     typedef boost::unique_lock<boost::mutex> scoped_lock;
     typedef boost::condition_variable        condition_variable;
 
+    /*! \brief Scheduling classes a thread can be placed in.
+     *
+     * SCHED_POLICY_OTHER is the normal time-shared class;
+     * SCHED_POLICY_FIFO and SCHED_POLICY_RR are the POSIX realtime
+     * classes (SCHED_FIFO/SCHED_RR). The realtime classes usually
+     * require elevated privileges, just like
+     * gr::enable_realtime_scheduling.
+     */
+    enum sched_policy {
+      SCHED_POLICY_OTHER = 0,
+      SCHED_POLICY_FIFO  = 1,
+      SCHED_POLICY_RR    = 2,
+    };
+
     /*! \brief a system-dependent typedef for the underlying thread type.
      */
 #if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
@@ -150,6 +164,62 @@ namespace gr {
      */
     GR_RUNTIME_API int set_thread_priority(gr_thread_t thread, int priority);
 
+    /*! \brief Place a thread in a scheduling class at a given priority.
+     *
+     * \p priority is the native priority of the chosen class (see
+     * sched_get_priority_min/max); it is clamped to the legal range
+     * and ignored for SCHED_POLICY_OTHER, which only accepts 0.
+     *
+     * \returns 0 on success, otherwise the error returned by the
+     * underlying scheduler call (e.g. EPERM without realtime
+     * privileges). Not implemented on Windows, where it falls back to
+     * set_thread_priority.
+     */
+    GR_RUNTIME_API int set_thread_sched(gr_thread_t thread,
+                                        sched_policy policy, int priority);
+
+    /*! \brief Get the scheduling class a thread is currently in.
+     *
+     * Not implemented on Windows; always returns SCHED_POLICY_OTHER
+     * there.
+     */
+    GR_RUNTIME_API sched_policy thread_sched(gr_thread_t thread);
+
+    /*!
+     * \brief Mutex that uses priority inheritance where the platform
+     * offers it.
+     *
+     * On POSIX systems the mutex is created with
+     * PTHREAD_PRIO_INHERIT, so a low-priority thread holding it (a
+     * ControlPort getter, say) is boosted while a realtime work
+     * thread waits, instead of inverting their priorities. Elsewhere
+     * it behaves exactly like gr::thread::mutex.
+     *
+     * Lock it with pi_scoped_lock or any of the boost lock adapters.
+     */
+    class GR_RUNTIME_API pi_mutex
+    {
+    public:
+      pi_mutex();
+      ~pi_mutex();
+
+      void lock();
+      void unlock();
+      bool try_lock();
+
+    private:
+      pi_mutex(const pi_mutex&);            // no copy
+      pi_mutex &operator=(const pi_mutex&); // no assign
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+      boost::mutex d_mutex;
+#else
+      pthread_mutex_t d_mutex;
+#endif
+    };
+
+    typedef boost::unique_lock<pi_mutex> pi_scoped_lock;
+
   } /* namespace thread */
 } /* namespace gr */
 
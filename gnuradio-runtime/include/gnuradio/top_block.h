@@ -127,6 +127,26 @@ namespace gr {
      */
     std::string msg_edge_list();
 
+    /*!
+     * Returns a string that lists the current fill level of every
+     * stream buffer in the process, one edge per line (see
+     * gr::buffer_stats).
+     */
+    std::string buffer_fill_list();
+
+    /*!
+     * Returns a string that lists the peak fill fraction of every
+     * stream buffer seen since the last call; resets the peaks (see
+     * gr::buffer_stats).
+     */
+    std::string buffer_peak_list();
+
+    /*!
+     * Returns a string that lists, per block, how often its work()
+     * call overran the watchdog deadline (see gr::work_watchdog).
+     */
+    std::string work_stall_list();
+
     /*!
      * Displays flattened flowgraph edges and block connectivity
      */
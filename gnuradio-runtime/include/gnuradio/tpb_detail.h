@@ -40,22 +40,31 @@ namespace gr {
     gr::thread::condition_variable	input_cond;
     bool				output_changed;
     gr::thread::condition_variable	output_cond;
+    unsigned int			notify_interval;	//< work calls per wakeup
+    unsigned int			pending_upstream;	//< deferred upstream wakeups
+    unsigned int			pending_downstream;	//< deferred downstream wakeups
 
   public:
     tpb_detail()
-      : input_changed(false), output_changed(false) { }
+      : input_changed(false), output_changed(false),
+        notify_interval(1), pending_upstream(0), pending_downstream(0) { }
 
     //! Called by us to tell all our upstream blocks that their output
-    //! may have changed.
+    //! may have changed.  Deferred when notify_interval > 1.
     void notify_upstream(block_detail *d);
 
     //! Called by us to tell all our downstream blocks that their
-    //! input may have changed.
+    //! input may have changed.  Deferred when notify_interval > 1.
     void notify_downstream(block_detail *d);
 
     //! Called by us to notify both upstream and downstream
     void notify_neighbors(block_detail *d);
 
+    //! Deliver any deferred neighbor wakeups immediately.  Must be
+    //! called before the block blocks or exits, or neighbors waiting
+    //! on a batched notification would sleep forever.
+    void flush_notifications(block_detail *d);
+
     //! Called by pmt msg posters
     void notify_msg() {
       input_cond.notify_one();
@@ -71,6 +80,10 @@ namespace gr {
     }
 
   private:
+    //! Immediate (unbatched) versions of the notify methods.
+    void do_notify_upstream(block_detail *d);
+    void do_notify_downstream(block_detail *d);
+
     //! Used by notify_downstream
     void set_input_changed()
     {
@@ -0,0 +1,113 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_WORK_WATCHDOG_H
+#define INCLUDED_GR_RUNTIME_WORK_WATCHDOG_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/high_res_timer.h>
+#include <gnuradio/thread/thread.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace gr {
+
+  /*!
+   * \brief Detects blocks whose work() call has stalled.
+   * \ingroup internal
+   *
+   * When the [Watchdog] enable preference is set, every
+   * block_executor stamps a per-block cell on entry to work() and
+   * clears it on return. A monitor thread scans the cells and
+   * reports any block that has been inside work() longer than the
+   * [Watchdog] deadline_ms preference (default 1000) through the
+   * logger, once per stall. The running per-block stall counts are
+   * exported as the "work stalls" ControlPort variable on the top
+   * block.
+   *
+   * The hot path is a single timestamp store; with the watchdog
+   * disabled the executor carries a NULL slot and nothing is
+   * stamped at all.
+   */
+  class GR_RUNTIME_API work_watchdog
+  {
+  public:
+    //! One cell per executor; written lock-free on every work() call.
+    struct slot {
+      std::string name;
+      volatile high_res_timer_type start;	// 0 outside work()
+    };
+
+    static work_watchdog *singleton();
+
+    //! True when the [Watchdog] enable preference is set.
+    bool enabled() const { return d_enabled; }
+
+    //! Register an executor under \p name; returns NULL when the
+    //! watchdog is disabled.
+    slot *attach(const std::string &name);
+
+    //! Unregister; \p s may be NULL.
+    void detach(slot *s);
+
+    //! Stamp entry to work().  \p s may be NULL.
+    static void enter(slot *s)
+    {
+      if(s)
+        s->start = high_res_timer_now();
+    }
+
+    //! Stamp return from work().  \p s may be NULL.
+    static void leave(slot *s)
+    {
+      if(s)
+        s->start = 0;
+    }
+
+    //! "block: count" lines for every block that has overrun the
+    //! deadline so far.
+    std::string stall_list();
+
+  private:
+    work_watchdog();
+    ~work_watchdog();
+
+    void run();
+
+    gr::thread::mutex d_mutex;
+    gr::thread::thread d_thread;
+    bool d_enabled;
+    bool d_finished;
+    long d_deadline_ms;
+
+    std::vector<slot*> d_slots;
+
+    // per-block overrun counts, and the work() entry stamp we last
+    // warned about so each stall is reported once
+    std::map<std::string, long> d_stalls;
+    std::map<slot*, high_res_timer_type> d_reported;
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_WORK_WATCHDOG_H */
@@ -130,6 +130,23 @@ PMT_API pmt_t string_to_symbol(const std::string &s);
 //! Alias for pmt_string_to_symbol
 PMT_API pmt_t intern(const std::string &s);
 
+/*!
+ * Return the symbol whose name is \p name, caching the result by the
+ * address of \p name.  Only meaningful for string literals (whose
+ * addresses are stable for the life of the process); use the
+ * PMT_SYMBOL macro rather than calling this directly.
+ */
+PMT_API pmt_t intern_literal(const char *name);
+
+/*!
+ * Return the symbol for the string literal \p name.  The first
+ * execution of a given site interns the symbol; later executions
+ * return it by the literal's address without touching the symbol
+ * table.  Use for hot symbols built in per-item paths (tag keys and
+ * the like); for strings computed at runtime use pmt::intern().
+ */
+#define PMT_SYMBOL(name) (::pmt::intern_literal(name ""))
+
 
 /*!
  * If \p is a symbol, return the name of the symbol as a string.
@@ -642,6 +659,16 @@ PMT_API bool eqv(const pmt_t& x, const pmt_t& y);
  */
 PMT_API bool equal(const pmt_t& x, const pmt_t& y);
 
+/*!
+ * \brief Return true if \p obj holds the only reference to its
+ * underlying object.
+ *
+ * Useful for recycling schemes: an object whose use count has
+ * dropped back to one (the caller's own handle) can safely be
+ * refilled in place.
+ */
+PMT_API bool is_unique(const pmt_t& obj);
+
 
 //! Return the number of elements in v
 PMT_API size_t length(const pmt_t& v);
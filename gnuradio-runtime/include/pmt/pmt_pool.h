@@ -31,8 +31,9 @@ namespace pmt {
 /*!
  * \brief very simple thread-safe fixed-size allocation pool
  *
- * FIXME may want to go to global allocation with per-thread free list.
- * This would eliminate virtually all lock contention.
+ * The chain interface (malloc_chain / free_chain) lets callers that
+ * keep their own per-thread free lists move many items across the
+ * mutex at once.
  */
 class PMT_API pmt_pool {
 
@@ -40,6 +41,8 @@ class PMT_API pmt_pool {
     struct item	*d_next;
   };
 
+  item *alloc_one();	// d_mutex must be held
+
   typedef boost::unique_lock<boost::mutex>  scoped_lock;
   mutable boost::mutex 		d_mutex;
   boost::condition_variable	d_cond;
@@ -66,6 +69,18 @@ public:
 
   void *malloc();
   void free(void *p);
+
+  /*!
+   * \brief allocate \p n items at once, linked through their first
+   * word; returns the head of the chain.  The mutex is taken once.
+   */
+  void *malloc_chain(size_t n);
+
+  /*!
+   * \brief free a chain of \p n items linked through their first word.
+   * The mutex is taken once.
+   */
+  void free_chain(void *head, size_t n);
 };
 
 } /* namespace pmt */
@@ -26,10 +26,31 @@
 
 #include <gnuradio/basic_block.h>
 #include <gnuradio/block_registry.h>
+#include <gnuradio/prefs.h>
 #include <stdexcept>
 #include <sstream>
 #include <iostream>
 
+/*
+ * Full (StoreLoad) fence for the delete_head_blocking handshake: the
+ * waiter's count increment must be visible before it tests the queue
+ * for emptiness, and the producer's queue insert must be visible
+ * before it tests the waiter count.  Mirrors the fence selection in
+ * mpsc_queue.cc.  Where no fence is available the producer cannot
+ * safely skip the notify, so it always takes the mutex.
+ */
+#if defined(__GNUC__)
+#define GR_WAITER_HAVE_FENCE 1
+#define GR_WAITER_FENCE() __sync_synchronize()
+#elif defined(_MSC_VER)
+#define GR_WAITER_HAVE_FENCE 1
+#include <intrin.h>
+#include <windows.h>
+#define GR_WAITER_FENCE() do { _ReadWriteBarrier(); ::MemoryBarrier(); } while(0)
+#else
+#define GR_WAITER_FENCE()
+#endif
+
 namespace gr {
 
   static long s_next_id = 0;
@@ -44,7 +65,8 @@ namespace gr {
   basic_block::basic_block(const std::string &name,
                            io_signature::sptr input_signature,
                            io_signature::sptr output_signature)
-    : d_name(name),
+    : d_blocking_waiters(0),
+      d_name(name),
       d_input_signature(input_signature),
       d_output_signature(output_signature),
       d_unique_id(s_next_id++),
@@ -52,6 +74,7 @@ namespace gr {
       d_symbol_name(global_block_registry.register_symbolic_name(this)),
       d_color(WHITE),
       d_rpc_set(false),
+      d_blob_next(0),
       d_message_subscribers(pmt::make_dict())
   {
     s_ncurrently_allocated++;
@@ -75,6 +98,37 @@ namespace gr {
     global_block_registry.register_symbolic_name(this, name); 
   }
 
+  pmt::pmt_t
+  basic_block::message_blob(size_t nbytes)
+  {
+    // Keep the pool small; a handful of blobs covers the usual case of
+    // one or two messages in flight per subscriber.
+    static const size_t s_pool_max = 16;
+
+    gr::thread::scoped_lock guard(d_blob_mutex);
+
+    // Look for a blob nobody else references anymore. pmt::is_unique
+    // is true only when we hold the last handle, so handing it back
+    // out cannot alias a message still queued downstream.
+    for(size_t i = 0; i < d_blob_pool.size(); i++) {
+      pmt::pmt_t v = d_blob_pool[i];
+      if(pmt::is_unique(v) && pmt::length(v) == nbytes)
+        return v;
+    }
+
+    pmt::pmt_t v = pmt::make_u8vector(nbytes, 0);
+    if(d_blob_pool.size() < s_pool_max) {
+      d_blob_pool.push_back(v);
+    }
+    else {
+      // Pool is full of in-flight or differently-sized blobs; replace
+      // round-robin so a size change eventually flushes stale entries.
+      d_blob_pool[d_blob_next] = v;
+      d_blob_next = (d_blob_next + 1) % s_pool_max;
+    }
+    return v;
+  }
+
   // ** Message passing interface **
 
   //  - register a new input message port
@@ -84,7 +138,15 @@ namespace gr {
     if(!pmt::is_symbol(port_id)) {
       throw std::runtime_error("message_port_register_in: bad port id");
     }
-    msg_queue[port_id] = msg_queue_t();
+
+    prefs *p = prefs::singleton();
+    size_t capacity =
+      static_cast<size_t>(p->get_long("DEFAULT", "max_messages", 100));
+    mpsc_queue::overflow_policy policy = mpsc_queue::DROP_OLDEST;
+    if(p->get_string("DEFAULT", "msg_overflow_policy", "drop-oldest") == "block")
+      policy = mpsc_queue::BLOCK;
+
+    msg_queue[port_id] = msg_queue_sptr(new mpsc_queue(capacity, policy));
     msg_queue_ready[port_id] = boost::shared_ptr<boost::condition_variable>(new boost::condition_variable());
   }
 
@@ -111,6 +173,7 @@ namespace gr {
       throw std::runtime_error("message_port_register_out: port already in use");
     }
     d_message_subscribers = pmt::dict_add(d_message_subscribers, port_id, pmt::PMT_NIL);
+    d_msg_dispatch[port_id];  // create the (empty) dispatch entry
   }
 
   pmt::pmt_t
@@ -128,54 +191,67 @@ namespace gr {
   //  - publish a message on a message port
   void basic_block::message_port_pub(pmt::pmt_t port_id, pmt::pmt_t msg)
   {
-    if(!pmt::dict_has_key(d_message_subscribers, port_id)) {
+    msg_dispatch_map_t::iterator it = d_msg_dispatch.find(port_id);
+    if(it == d_msg_dispatch.end()) {
       throw std::runtime_error("port does not exist");
     }
-  
-    pmt::pmt_t currlist = pmt::dict_ref(d_message_subscribers, port_id, pmt::PMT_NIL);
-    // iterate through subscribers on port
-    while(pmt::is_pair(currlist)) {
-      pmt::pmt_t target = pmt::car(currlist);
 
-      pmt::pmt_t block = pmt::car(target);
-      pmt::pmt_t port = pmt::cdr(target);
-    
-      currlist = pmt::cdr(currlist);
-      basic_block_sptr blk = global_block_registry.block_lookup(block);
-      //blk->post(msg);
-      blk->post(port, msg);
-    }
+    // post straight to the resolved endpoints; see rebuild_msg_dispatch
+    std::vector<msg_subscriber_t> &subs = it->second;
+    for(size_t i = 0; i < subs.size(); i++)
+      subs[i].block->post(subs[i].port, msg);
   }
 
   //  - subscribe to a message port
   void
   basic_block::message_port_sub(pmt::pmt_t port_id, pmt::pmt_t target){
-    if(!pmt::dict_has_key(d_message_subscribers, port_id)){ 
+    if(!pmt::dict_has_key(d_message_subscribers, port_id)){
       std::stringstream ss;
       ss << "Port does not exist: \"" << pmt::write_string(port_id) << "\" on block: "
          << pmt::write_string(target) << std::endl;
       throw std::runtime_error(ss.str());
     }
     pmt::pmt_t currlist = pmt::dict_ref(d_message_subscribers,port_id,pmt::PMT_NIL);
-  
+
     // ignore re-adds of the same target
-    if(!pmt::list_has(currlist, target))
+    if(!pmt::list_has(currlist, target)) {
       d_message_subscribers = pmt::dict_add(d_message_subscribers,port_id,pmt::list_add(currlist,target));
+      rebuild_msg_dispatch(port_id);
+    }
   }
 
   void
   basic_block::message_port_unsub(pmt::pmt_t port_id, pmt::pmt_t target)
   {
-    if(!pmt::dict_has_key(d_message_subscribers, port_id)) { 
+    if(!pmt::dict_has_key(d_message_subscribers, port_id)) {
       std::stringstream ss;
       ss << "Port does not exist: \"" << pmt::write_string(port_id) << "\" on block: "
          << pmt::write_string(target) << std::endl;
       throw std::runtime_error(ss.str());
     }
-  
+
     // ignore unsubs of unknown targets
     pmt::pmt_t currlist = pmt::dict_ref(d_message_subscribers,port_id,pmt::PMT_NIL);
     d_message_subscribers = pmt::dict_add(d_message_subscribers,port_id,pmt::list_rm(currlist,target));
+    rebuild_msg_dispatch(port_id);
+  }
+
+  void
+  basic_block::rebuild_msg_dispatch(pmt::pmt_t port_id)
+  {
+    std::vector<msg_subscriber_t> &subs = d_msg_dispatch[port_id];
+    subs.clear();
+
+    pmt::pmt_t currlist = pmt::dict_ref(d_message_subscribers, port_id, pmt::PMT_NIL);
+    while(pmt::is_pair(currlist)) {
+      pmt::pmt_t target = pmt::car(currlist);
+      currlist = pmt::cdr(currlist);
+
+      msg_subscriber_t s;
+      s.block = global_block_registry.block_lookup(pmt::car(target)).get();
+      s.port = pmt::cdr(target);
+      subs.push_back(s);
+    }
   }
 
   void
@@ -187,15 +263,30 @@ namespace gr {
   void
   basic_block::insert_tail(pmt::pmt_t which_port, pmt::pmt_t msg)
   {
-    gr::thread::scoped_lock guard(mutex);
-
     if((msg_queue.find(which_port) == msg_queue.end()) || (msg_queue_ready.find(which_port) == msg_queue_ready.end())) {
       std::cout << "target port = " << pmt::symbol_to_string(which_port) << std::endl;
       throw std::runtime_error("attempted to insert_tail on invalid queue!");
     }
 
-    msg_queue[which_port].push_back(msg);
-    msg_queue_ready[which_port]->notify_one();
+    msg_queue[which_port]->insert_tail(msg);
+
+#ifdef GR_WAITER_HAVE_FENCE
+    // Only take the mutex when somebody is parked in
+    // delete_head_blocking; the normal consumer (tpb_thread_body) is
+    // woken through the block registry below.  The fence orders our
+    // queue insert before the waiter-count load, pairing with the
+    // fence after the increment in delete_head_blocking.
+    GR_WAITER_FENCE();
+    if(d_blocking_waiters) {
+      gr::thread::scoped_lock guard(mutex);
+      msg_queue_ready[which_port]->notify_one();
+    }
+#else
+    {
+      gr::thread::scoped_lock guard(mutex);
+      msg_queue_ready[which_port]->notify_one();
+    }
+#endif
 
     // wake up thread if BLKD_IN or BLKD_OUT
     global_block_registry.notify_blk(alias());
@@ -204,29 +295,61 @@ namespace gr {
   pmt::pmt_t
   basic_block::delete_head_nowait(pmt::pmt_t which_port)
   {
-    gr::thread::scoped_lock guard(mutex);
+    if(msg_queue.find(which_port) == msg_queue.end())
+      throw std::runtime_error("port does not exist!");
 
-    if(empty_p(which_port)) {
-      return pmt::pmt_t();
-    }
+    return msg_queue[which_port]->delete_head_nowait();
+  }
 
-    pmt::pmt_t m(msg_queue[which_port].front());
-    msg_queue[which_port].pop_front();
+  size_t
+  basic_block::dispatch_pending(pmt::pmt_t which_port)
+  {
+    msg_queue_map_itr q = msg_queue.find(which_port);
+    if(q == msg_queue.end())
+      throw std::runtime_error("port does not exist!");
+
+    d_pending_msgs.resize(0);
+    size_t n = q->second->delete_all_nowait(d_pending_msgs);
+    if(n == 0)
+      return 0;
+
+    d_batch_msg_handlers_t::iterator bit = d_batch_msg_handlers.find(which_port);
+    if(bit != d_batch_msg_handlers.end()) {
+      bit->second(d_pending_msgs);
+    }
+    else {
+      d_msg_handlers_t::iterator it = d_msg_handlers.find(which_port);
+      if(it != d_msg_handlers.end()) {
+        for(size_t i = 0; i < d_pending_msgs.size(); i++)
+          it->second(d_pending_msgs[i]);
+      }
+    }
 
-    return m;
+    // Drop our references now rather than holding them until the
+    // next dispatch; the vector keeps its capacity.
+    d_pending_msgs.clear();
+    return n;
   }
 
   pmt::pmt_t
   basic_block::delete_head_blocking(pmt::pmt_t which_port)
   {
+    if(msg_queue.find(which_port) == msg_queue.end())
+      throw std::runtime_error("port does not exist!");
+
     gr::thread::scoped_lock guard(mutex);
 
-    while(empty_p(which_port)) {
+    // Announce ourselves before the emptiness check; the fence keeps
+    // the increment from reordering past the queue load, so a
+    // producer that inserts after our check is guaranteed to see the
+    // flag and notify (see the matching fence in insert_tail).
+    d_blocking_waiters++;
+    GR_WAITER_FENCE();
+    pmt::pmt_t m;
+    while(!(m = msg_queue[which_port]->delete_head_nowait())) {
       msg_queue_ready[which_port]->wait(guard);
     }
-
-    pmt::pmt_t m(msg_queue[which_port].front());
-    msg_queue[which_port].pop_front();
+    d_blocking_waiters--;
     return m;
   }
 
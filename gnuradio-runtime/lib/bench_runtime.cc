@@ -0,0 +1,474 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Microbenchmarks for the runtime scheduler. Each benchmark prints a
+ * JSON record so CI can diff results between releases:
+ *
+ *   bench_runtime [--items N] [--output FILE]
+ *
+ * Covered: raw buffer produce/consume, tag propagation throughput at
+ * several tag densities, message port round-trip time, single-item
+ * scheduler handoff (wakeup) latency and pipeline throughput vs chain
+ * length. Only runtime facilities are used -- the stream blocks the
+ * benchmarks need are defined locally so gr-blocks is not required.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/top_block.h>
+#include <gnuradio/sync_block.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/buffer.h>
+#include <gnuradio/high_res_timer.h>
+#include <gnuradio/tags.h>
+#include <pmt/pmt.h>
+
+#include <boost/bind.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  using namespace gr;
+
+  static double
+  to_seconds(high_res_timer_type ticks)
+  {
+    return (double)ticks / (double)high_res_timer_tps();
+  }
+
+  // ------------------------------------------------------------------
+  // result collection
+  // ------------------------------------------------------------------
+  static std::vector<std::string> s_results;
+
+  static void
+  record(const std::string &bench, const std::string &params,
+         double value, const std::string &units)
+  {
+    std::ostringstream os;
+    os << "  {\"bench\": \"" << bench << "\", "
+       << "\"params\": {" << params << "}, "
+       << "\"value\": " << value << ", "
+       << "\"units\": \"" << units << "\"}";
+    s_results.push_back(os.str());
+  }
+
+  // ------------------------------------------------------------------
+  // local stream blocks
+  // ------------------------------------------------------------------
+
+  //! Emits uint64 items, optionally tagging every tag_interval-th one
+  class bench_source : public sync_block
+  {
+  private:
+    uint64_t d_total;
+    uint64_t d_sent;
+    int d_tag_interval;
+    bool d_stamp;
+    pmt::pmt_t d_key;
+
+  public:
+    typedef boost::shared_ptr<bench_source> sptr;
+
+    bench_source(uint64_t total, int tag_interval, bool stamp)
+      : sync_block("bench_source",
+                   io_signature::make(0, 0, 0),
+                   io_signature::make(1, 1, sizeof(uint64_t))),
+        d_total(total), d_sent(0), d_tag_interval(tag_interval),
+        d_stamp(stamp), d_key(pmt::mp("bench"))
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star &input_items,
+             gr_vector_void_star &output_items)
+    {
+      if(d_sent >= d_total)
+        return -1;  // WORK_DONE
+
+      uint64_t *out = (uint64_t*)output_items[0];
+      uint64_t n = std::min((uint64_t)noutput_items, d_total - d_sent);
+
+      if(d_stamp) {
+        // one timestamped item per call; the sink measures handoff
+        n = 1;
+        out[0] = (uint64_t)high_res_timer_now();
+      }
+      else {
+        memset(out, 0, n*sizeof(uint64_t));
+        if(d_tag_interval > 0) {
+          uint64_t start = nitems_written(0);
+          uint64_t first = start + (d_tag_interval
+                                    - start % d_tag_interval) % d_tag_interval;
+          for(uint64_t o = first; o < start + n; o += d_tag_interval)
+            add_item_tag(0, o, d_key, pmt::PMT_T);
+        }
+      }
+
+      d_sent += n;
+      return (int)n;
+    }
+  };
+
+  //! Pass-through copy, participates in normal tag propagation
+  class bench_copy : public sync_block
+  {
+  public:
+    typedef boost::shared_ptr<bench_copy> sptr;
+
+    bench_copy()
+      : sync_block("bench_copy",
+                   io_signature::make(1, 1, sizeof(uint64_t)),
+                   io_signature::make(1, 1, sizeof(uint64_t)))
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star &input_items,
+             gr_vector_void_star &output_items)
+    {
+      memcpy(output_items[0], input_items[0],
+             noutput_items*sizeof(uint64_t));
+      return noutput_items;
+    }
+  };
+
+  //! Consumes everything; optionally accumulates per-item handoff latency
+  class bench_sink : public sync_block
+  {
+  private:
+    bool d_measure;
+    uint64_t d_count;
+    high_res_timer_type d_latency;
+
+  public:
+    typedef boost::shared_ptr<bench_sink> sptr;
+
+    bench_sink(bool measure)
+      : sync_block("bench_sink",
+                   io_signature::make(1, 1, sizeof(uint64_t)),
+                   io_signature::make(0, 0, 0)),
+        d_measure(measure), d_count(0), d_latency(0)
+    {
+    }
+
+    uint64_t count() const { return d_count; }
+    high_res_timer_type total_latency() const { return d_latency; }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star &input_items,
+             gr_vector_void_star &output_items)
+    {
+      if(d_measure) {
+        const uint64_t *in = (const uint64_t*)input_items[0];
+        high_res_timer_type now = high_res_timer_now();
+        for(int i = 0; i < noutput_items; i++)
+          d_latency += now - (high_res_timer_type)in[i];
+      }
+      d_count += noutput_items;
+      return noutput_items;
+    }
+  };
+
+  // ------------------------------------------------------------------
+  // message blocks
+  // ------------------------------------------------------------------
+
+  //! Echoes every message from "in" to "out"
+  class bench_pong : public block
+  {
+  public:
+    typedef boost::shared_ptr<bench_pong> sptr;
+
+    bench_pong()
+      : block("bench_pong",
+              io_signature::make(0, 0, 0),
+              io_signature::make(0, 0, 0))
+    {
+      message_port_register_in(pmt::mp("in"));
+      message_port_register_out(pmt::mp("out"));
+      set_msg_handler(pmt::mp("in"),
+                      boost::bind(&bench_pong::handle, this, _1));
+    }
+
+    void handle(pmt::pmt_t msg)
+    {
+      message_port_pub(pmt::mp("out"), msg);
+    }
+  };
+
+  //! Originates round trips and signals when the last one returns
+  class bench_ping : public block
+  {
+  private:
+    int d_remaining;
+    bool d_done;
+    boost::mutex d_mutex;
+    boost::condition_variable d_cond;
+
+  public:
+    typedef boost::shared_ptr<bench_ping> sptr;
+
+    bench_ping(int count)
+      : block("bench_ping",
+              io_signature::make(0, 0, 0),
+              io_signature::make(0, 0, 0)),
+        d_remaining(count), d_done(false)
+    {
+      message_port_register_in(pmt::mp("in"));
+      message_port_register_out(pmt::mp("out"));
+      set_msg_handler(pmt::mp("in"),
+                      boost::bind(&bench_ping::handle, this, _1));
+    }
+
+    void kick()
+    {
+      message_port_pub(pmt::mp("out"), pmt::PMT_T);
+    }
+
+    void handle(pmt::pmt_t msg)
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      if(--d_remaining > 0) {
+        lock.unlock();
+        message_port_pub(pmt::mp("out"), msg);
+      }
+      else {
+        d_done = true;
+        d_cond.notify_all();
+      }
+    }
+
+    void wait_done()
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      while(!d_done)
+        d_cond.wait(lock);
+    }
+  };
+
+  // ------------------------------------------------------------------
+  // benchmarks
+  // ------------------------------------------------------------------
+
+  static void
+  bench_buffer_produce_consume(uint64_t items)
+  {
+    const int chunk = 1024;
+    buffer_sptr buf(make_buffer(64*1024, sizeof(uint64_t), block_sptr()));
+    buffer_reader_sptr rdr(buffer_add_reader(buf, 0, block_sptr()));
+
+    uint64_t done = 0;
+    high_res_timer_type t0 = high_res_timer_now();
+    while(done < items) {
+      int n = std::min(chunk, buf->space_available());
+      if(n > 0) {
+        memset(buf->write_pointer(), 0, n*sizeof(uint64_t));
+        buf->update_write_pointer(n);
+      }
+      int avail = rdr->items_available();
+      if(avail > 0) {
+        rdr->update_read_pointer(avail);
+        done += avail;
+      }
+    }
+    double secs = to_seconds(high_res_timer_now() - t0);
+
+    std::ostringstream p;
+    p << "\"items\": " << items << ", \"chunk\": " << chunk;
+    record("buffer_produce_consume", p.str(),
+           secs*1e9/(double)(items/chunk), "ns_per_chunk");
+  }
+
+  static void
+  bench_tag_propagation(uint64_t items, int tag_interval, int nblocks)
+  {
+    top_block_sptr tb = make_top_block("bench_tags");
+    bench_source::sptr src(gnuradio::get_initial_sptr
+                           (new bench_source(items, tag_interval, false)));
+    bench_sink::sptr snk(gnuradio::get_initial_sptr
+                         (new bench_sink(false)));
+
+    basic_block_sptr prev = src;
+    for(int i = 0; i < nblocks; i++) {
+      bench_copy::sptr cp(gnuradio::get_initial_sptr(new bench_copy()));
+      tb->connect(prev, 0, cp, 0);
+      prev = cp;
+    }
+    tb->connect(prev, 0, snk, 0);
+
+    high_res_timer_type t0 = high_res_timer_now();
+    tb->run();
+    double secs = to_seconds(high_res_timer_now() - t0);
+
+    std::ostringstream p;
+    p << "\"items\": " << items << ", \"tag_interval\": " << tag_interval
+      << ", \"nblocks\": " << nblocks;
+    record("tag_propagation", p.str(),
+           (double)items/secs/1e6, "Msamples_per_s");
+  }
+
+  static void
+  bench_message_round_trip(int count)
+  {
+    top_block_sptr tb = make_top_block("bench_msgs");
+    bench_ping::sptr ping(gnuradio::get_initial_sptr(new bench_ping(count)));
+    bench_pong::sptr pong(gnuradio::get_initial_sptr(new bench_pong()));
+
+    // minimal stream path so the topology is never empty
+    bench_source::sptr src(gnuradio::get_initial_sptr
+                           (new bench_source(1, 0, false)));
+    bench_sink::sptr snk(gnuradio::get_initial_sptr(new bench_sink(false)));
+    tb->connect(src, 0, snk, 0);
+
+    tb->msg_connect(ping, "out", pong, "in");
+    tb->msg_connect(pong, "out", ping, "in");
+
+    tb->start();
+    high_res_timer_type t0 = high_res_timer_now();
+    ping->kick();
+    ping->wait_done();
+    double secs = to_seconds(high_res_timer_now() - t0);
+    tb->stop();
+    tb->wait();
+
+    std::ostringstream p;
+    p << "\"count\": " << count;
+    record("message_round_trip", p.str(),
+           secs*1e6/(double)count, "us_per_round_trip");
+  }
+
+  static void
+  bench_scheduler_wakeup(int count)
+  {
+    top_block_sptr tb = make_top_block("bench_wakeup");
+    bench_source::sptr src(gnuradio::get_initial_sptr
+                           (new bench_source(count, 0, true)));
+    bench_sink::sptr snk(gnuradio::get_initial_sptr(new bench_sink(true)));
+    src->set_max_noutput_items(1);
+    tb->connect(src, 0, snk, 0);
+    tb->run();
+
+    double avg = to_seconds(snk->total_latency())*1e6
+                 / (double)std::max<uint64_t>(1, snk->count());
+
+    std::ostringstream p;
+    p << "\"count\": " << count;
+    record("scheduler_wakeup", p.str(), avg, "us_per_item");
+  }
+
+  static void
+  bench_pipeline_scaling(uint64_t items, int nblocks)
+  {
+    top_block_sptr tb = make_top_block("bench_pipeline");
+    bench_source::sptr src(gnuradio::get_initial_sptr
+                           (new bench_source(items, 0, false)));
+    bench_sink::sptr snk(gnuradio::get_initial_sptr(new bench_sink(false)));
+
+    basic_block_sptr prev = src;
+    for(int i = 0; i < nblocks; i++) {
+      bench_copy::sptr cp(gnuradio::get_initial_sptr(new bench_copy()));
+      tb->connect(prev, 0, cp, 0);
+      prev = cp;
+    }
+    tb->connect(prev, 0, snk, 0);
+
+    high_res_timer_type t0 = high_res_timer_now();
+    tb->run();
+    double secs = to_seconds(high_res_timer_now() - t0);
+
+    std::ostringstream p;
+    p << "\"items\": " << items << ", \"nblocks\": " << nblocks;
+    record("pipeline_scaling", p.str(),
+           (double)items/secs/1e6, "Msamples_per_s");
+  }
+
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  uint64_t items = 2000000;
+  std::string output;
+
+  for(int i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "--items") && i+1 < argc)
+      items = strtoull(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "--output") && i+1 < argc)
+      output = argv[++i];
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--items N] [--output FILE]" << std::endl;
+      return 1;
+    }
+  }
+
+  bench_buffer_produce_consume(items);
+
+  bench_tag_propagation(items, 0, 4);     // no tags: baseline
+  bench_tag_propagation(items, 1000, 4);
+  bench_tag_propagation(items, 100, 4);
+  bench_tag_propagation(items, 10, 4);
+
+  bench_message_round_trip(20000);
+
+  bench_scheduler_wakeup(20000);
+
+  bench_pipeline_scaling(items, 1);
+  bench_pipeline_scaling(items, 2);
+  bench_pipeline_scaling(items, 4);
+  bench_pipeline_scaling(items, 8);
+  bench_pipeline_scaling(items, 16);
+
+  std::ostringstream doc;
+  doc << "[" << std::endl;
+  for(size_t i = 0; i < s_results.size(); i++) {
+    doc << s_results[i];
+    if(i + 1 < s_results.size())
+      doc << ",";
+    doc << std::endl;
+  }
+  doc << "]" << std::endl;
+
+  if(output.empty()) {
+    std::cout << doc.str();
+  }
+  else {
+    std::ofstream f(output.c_str());
+    f << doc.str();
+  }
+
+  return 0;
+}
@@ -41,6 +41,7 @@ namespace gr {
     : basic_block(name, input_signature, output_signature),
       d_output_multiple (1),
       d_output_multiple_set(false),
+      d_chunk_autotune(false),
       d_unaligned(0),
       d_is_unaligned(false),
       d_relative_rate (1.0),
@@ -50,10 +51,15 @@ namespace gr {
       d_max_noutput_items_set(false),
       d_max_noutput_items(0),
       d_min_noutput_items(0),
+      d_notify_interval(1),
+      d_transparent(false),
       d_tag_propagation_policy(TPP_ALL_TO_ALL),
       d_priority(-1),
+      d_sched_policy(gr::thread::SCHED_POLICY_OTHER),
       d_pc_rpc_set(false),
       d_update_rate(false),
+      d_work_kernel(0),
+      d_work_kernel_arg(0),
       d_max_output_buffer(std::max(output_signature->max_streams(),1), -1),
       d_min_output_buffer(std::max(output_signature->max_streams(),1), -1)
   {
@@ -123,6 +129,28 @@ namespace gr {
     d_history = history;
   }
 
+  void
+  block::set_work_kernel(work_kernel_t kernel, void *arg)
+  {
+    if(kernel) {
+      // the scheduler substitutes a 1:1 forecast for registered
+      // kernels, so anything that perturbs the item relationship
+      // disqualifies the block
+      if(d_history != 1)
+        throw std::invalid_argument("block::set_work_kernel: history must be 1");
+      if(d_output_multiple_set)
+        throw std::invalid_argument("block::set_work_kernel: output_multiple must not be set");
+    }
+    d_work_kernel = kernel;
+    d_work_kernel_arg = arg;
+  }
+
+  void *
+  block::scratch_alloc_bytes(size_t nbytes)
+  {
+    return d_detail->scratch_alloc(nbytes);
+  }
+
   void
   block::declare_sample_delay(unsigned delay)
   {
@@ -339,6 +367,32 @@ namespace gr {
     d_tag_propagation_policy = p;
   }
 
+  std::vector<pmt::pmt_t>
+  block::tag_propagation_keys(unsigned int which_input)
+  {
+    if(which_input < d_tag_propagation_keys.size())
+      return d_tag_propagation_keys[which_input];
+    return std::vector<pmt::pmt_t>();
+  }
+
+  void
+  block::set_tag_propagation_keys(unsigned int which_input,
+                                  const std::vector<pmt::pmt_t> &keys)
+  {
+    if(which_input >= d_tag_propagation_keys.size())
+      d_tag_propagation_keys.resize(which_input + 1);
+    d_tag_propagation_keys[which_input] = keys;
+  }
+
+  const std::vector<pmt::pmt_t> *
+  block::tag_propagation_keys_ptr(unsigned int which_input) const
+  {
+    if(which_input < d_tag_propagation_keys.size()
+       && !d_tag_propagation_keys[which_input].empty())
+      return &d_tag_propagation_keys[which_input];
+    return 0;
+  }
+
   int
   block::max_noutput_items()
   {
@@ -410,6 +464,23 @@ namespace gr {
     return d_priority;
   }
 
+  gr::thread::sched_policy
+  block::thread_sched_policy()
+  {
+    return d_sched_policy;
+  }
+
+  int
+  block::set_thread_sched(gr::thread::sched_policy policy, int priority)
+  {
+    d_sched_policy = policy;
+    d_priority = priority;
+    if(d_detail) {
+      return d_detail->set_thread_sched(policy, priority);
+    }
+    return 0;
+  }
+
   void
   block::expand_minmax_buffer(int port)
   {
@@ -725,6 +796,50 @@ namespace gr {
     }
   }
 
+  float
+  block::pc_nwork_calls()
+  {
+    if(d_detail) {
+      return d_detail->pc_nwork_calls();
+    }
+    else {
+      return 0;
+    }
+  }
+
+  float
+  block::pc_nwakeups()
+  {
+    if(d_detail) {
+      return d_detail->pc_nwakeups();
+    }
+    else {
+      return 0;
+    }
+  }
+
+  float
+  block::pc_input_blocked_time_total()
+  {
+    if(d_detail) {
+      return d_detail->pc_input_blocked_time_total();
+    }
+    else {
+      return 0;
+    }
+  }
+
+  float
+  block::pc_output_blocked_time_total()
+  {
+    if(d_detail) {
+      return d_detail->pc_output_blocked_time_total();
+    }
+    else {
+      return 0;
+    }
+  }
+
   void
   block::reset_perf_counters()
   {
@@ -808,6 +923,34 @@ namespace gr {
         "", "Total clock cycles in calls to work", RPC_PRIVLVL_MIN,
         DISPTIME | DISPOPTSTRIP)));
 
+    d_rpc_vars.push_back(
+      rpcbasic_sptr(new rpcbasic_register_get<block, float>(
+        alias(), "nwork calls", &block::pc_nwork_calls,
+        pmt::mp(0), pmt::mp(1e9), pmt::mp(0),
+        "", "Number of completed calls to work", RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
+    d_rpc_vars.push_back(
+      rpcbasic_sptr(new rpcbasic_register_get<block, float>(
+        alias(), "nwakeups", &block::pc_nwakeups,
+        pmt::mp(0), pmt::mp(1e9), pmt::mp(0),
+        "", "Number of scheduler wakeups", RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
+    d_rpc_vars.push_back(
+      rpcbasic_sptr(new rpcbasic_register_get<block, float>(
+        alias(), "input blocked time", &block::pc_input_blocked_time_total,
+        pmt::mp(0), pmt::mp(1e9), pmt::mp(0),
+        "", "Total clock cycles blocked waiting for input", RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
+    d_rpc_vars.push_back(
+      rpcbasic_sptr(new rpcbasic_register_get<block, float>(
+        alias(), "output blocked time", &block::pc_output_blocked_time_total,
+        pmt::mp(0), pmt::mp(1e9), pmt::mp(0),
+        "", "Total clock cycles blocked waiting for output space", RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
     d_rpc_vars.push_back(
       rpcbasic_sptr(new rpcbasic_register_get<block, std::vector<float> >(
         alias(), "input \% full", &block::pc_input_buffers_full,
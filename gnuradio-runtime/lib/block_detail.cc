@@ -32,6 +32,9 @@ namespace gr {
 
   static long s_ncurrently_allocated = 0;
 
+  // details are created from several threads during startup
+  static gr::thread::mutex s_count_mutex;
+
   long
   block_detail_ncurrently_allocated()
   {
@@ -43,6 +46,9 @@ namespace gr {
       d_ninputs(ninputs), d_noutputs(noutputs),
       d_input(ninputs), d_output(noutputs),
       d_done(false),
+      d_scratch(0),
+      d_scratch_size(0),
+      d_scratch_used(0),
       d_ins_noutput_items(0),
       d_avg_noutput_items(0), 
       d_var_noutput_items(0),
@@ -58,14 +64,23 @@ namespace gr {
       d_ins_work_time(0),
       d_avg_work_time(0),
       d_var_work_time(0),
+      d_total_work_time(0),
+      d_total_input_blocked_time(0),
+      d_total_output_blocked_time(0),
+      d_pc_nwakeups(0),
       d_pc_counter(0)
   {
+    gr::thread::scoped_lock guard(s_count_mutex);
     s_ncurrently_allocated++;
   }
 
   block_detail::~block_detail()
   {
     // should take care of itself
+    scratch_reset();
+    delete [] d_scratch;
+
+    gr::thread::scoped_lock guard(s_count_mutex);
     s_ncurrently_allocated--;
   }
 
@@ -201,7 +216,7 @@ namespace gr {
                                   const pmt::pmt_t &key,
 				  long id)
   {
-    std::vector<tag_t> found_items;
+    std::vector<tag_t> &found_items = d_tag_filter_scratch;
 
     v.resize(0);
 
@@ -219,6 +234,43 @@ namespace gr {
     }
   }
 
+  void *
+  block_detail::scratch_alloc(size_t nbytes)
+  {
+    // Keep every allocation 16-byte aligned.
+    nbytes = (nbytes + 15) & ~((size_t)15);
+
+    if(d_scratch_used + nbytes <= d_scratch_size) {
+      void *p = d_scratch + d_scratch_used;
+      d_scratch_used += nbytes;
+      return p;
+    }
+
+    // The chunk is full. Satisfy this request from the heap; the
+    // running d_scratch_used still tracks total demand so
+    // scratch_reset() can regrow the chunk once to cover it.
+    d_scratch_used += nbytes;
+    char *p = new char[nbytes];
+    d_scratch_overflow.push_back(p);
+    return p;
+  }
+
+  void
+  block_detail::scratch_reset()
+  {
+    if(!d_scratch_overflow.empty()) {
+      for(size_t i = 0; i < d_scratch_overflow.size(); i++)
+        delete [] d_scratch_overflow[i];
+      d_scratch_overflow.clear();
+
+      // Regrow to the high-water mark of the call that overflowed.
+      delete [] d_scratch;
+      d_scratch_size = d_scratch_used;
+      d_scratch = new char[d_scratch_size];
+    }
+    d_scratch_used = 0;
+  }
+
   void
   block_detail::set_processor_affinity(const std::vector<int> &mask)
   {
@@ -256,6 +308,14 @@ namespace gr {
     return -1;
   }
 
+  int
+  block_detail::set_thread_sched(gr::thread::sched_policy policy, int priority){
+    if(threaded) {
+      return gr::thread::set_thread_sched(thread, policy, priority);
+    }
+    return -1;
+  }
+
   void
   block_detail::start_perf_counters()
   {
@@ -343,6 +403,48 @@ namespace gr {
   block_detail::reset_perf_counters()
   {
     d_pc_counter = 0;
+    d_total_input_blocked_time = 0;
+    d_total_output_blocked_time = 0;
+    d_pc_nwakeups = 0;
+  }
+
+  void
+  block_detail::pc_record_blocked_time(float diff, bool input)
+  {
+    if(input)
+      d_total_input_blocked_time += diff;
+    else
+      d_total_output_blocked_time += diff;
+  }
+
+  void
+  block_detail::pc_record_wakeup()
+  {
+    d_pc_nwakeups += 1;
+  }
+
+  float
+  block_detail::pc_nwork_calls()
+  {
+    return d_pc_counter;
+  }
+
+  float
+  block_detail::pc_nwakeups()
+  {
+    return d_pc_nwakeups;
+  }
+
+  float
+  block_detail::pc_input_blocked_time_total()
+  {
+    return d_total_input_blocked_time;
+  }
+
+  float
+  block_detail::pc_output_blocked_time_total()
+  {
+    return d_total_output_blocked_time;
   }
 
   float
@@ -90,11 +90,32 @@ namespace gr {
     return min_space;
   }
 
+  // Drop every tag in rtags whose key is not in keys, in place.
+  static void
+  filter_tags_by_key(std::vector<tag_t> &rtags,
+                     const std::vector<pmt::pmt_t> &keys)
+  {
+    std::vector<tag_t>::iterator w = rtags.begin();
+    std::vector<tag_t>::iterator t;
+    for(t = rtags.begin(); t != rtags.end(); t++) {
+      for(size_t k = 0; k < keys.size(); k++) {
+        if(pmt::eqv(keys[k], t->key)) {
+          *w++ = *t;
+          break;
+        }
+      }
+    }
+    rtags.erase(w, rtags.end());
+  }
+
   static bool
-  propagate_tags(block::tag_propagation_policy_t policy, block_detail *d,
+  propagate_tags(block *b, block_detail *d,
                  const std::vector<uint64_t> &start_nitems_read, double rrate,
-                 std::vector<tag_t> &rtags, long block_id)
+                 std::vector<tag_t> &rtags)
   {
+    block::tag_propagation_policy_t policy = b->tag_propagation_policy();
+    long block_id = b->unique_id();
+
     // Move tags downstream
     // if a sink, we don't need to move downstream
     if(d->sink_p()) {
@@ -111,21 +132,23 @@ namespace gr {
         d->get_tags_in_range(rtags, i, start_nitems_read[i],
                              d->nitems_read(i), block_id);
 
-        std::vector<tag_t>::iterator t;
-        if(rrate == 1.0) {
-          for(t = rtags.begin(); t != rtags.end(); t++) {
-            for(int o = 0; o < d->noutputs(); o++)
-              d->output(o)->add_item_tag(*t);
-          }
-        }
-        else {
-          for(t = rtags.begin(); t != rtags.end(); t++) {
-            tag_t new_tag = *t;
-            new_tag.offset = ((double)new_tag.offset * rrate) + 0.5;
-            for(int o = 0; o < d->noutputs(); o++)
-              d->output(o)->add_item_tag(new_tag);
-          }
+        const std::vector<pmt::pmt_t> *keys = b->tag_propagation_keys_ptr(i);
+        if(keys)
+          filter_tags_by_key(rtags, *keys);
+
+        // Rescale in the scratch vector, then hand each output the
+        // whole range at once; one lock per output rather than one
+        // per tag.
+        if(rrate != 1.0) {
+          std::vector<tag_t>::iterator t;
+          for(t = rtags.begin(); t != rtags.end(); t++)
+            t->offset = ((double)t->offset * rrate) + 0.5;
         }
+        // The last destination takes the tags by swap; rtags is
+        // refilled from scratch on the next input anyway.
+        for(int o = 0; o < d->noutputs() - 1; o++)
+          d->output(o)->add_item_tags(rtags);
+        d->output(d->noutputs() - 1)->move_item_tags(rtags);
       }
       break;
     case block::TPP_ONE_TO_ONE:
@@ -137,12 +160,14 @@ namespace gr {
           d->get_tags_in_range(rtags, i, start_nitems_read[i],
                                d->nitems_read(i), block_id);
 
+          const std::vector<pmt::pmt_t> *keys = b->tag_propagation_keys_ptr(i);
+          if(keys)
+            filter_tags_by_key(rtags, *keys);
+
           std::vector<tag_t>::iterator t;
-          for(t = rtags.begin(); t != rtags.end(); t++) {
-            tag_t new_tag = *t;
-            new_tag.offset = ((double)new_tag.offset * rrate) + 0.5;
-            d->output(i)->add_item_tag(new_tag);
-          }
+          for(t = rtags.begin(); t != rtags.end(); t++)
+            t->offset = ((double)t->offset * rrate) + 0.5;
+          d->output(i)->move_item_tags(rtags);
         }
       }
       else  {
@@ -158,7 +183,8 @@ namespace gr {
   }
 
   block_executor::block_executor(block_sptr block, int max_noutput_items)
-    : d_block(block), d_log(0), d_max_noutput_items(max_noutput_items)
+    : d_block(block), d_log(0), d_max_noutput_items(max_noutput_items),
+      d_consec_blkd_out(0)
   {
     if(ENABLE_LOGGING) {
       std::string name = str(boost::format("sst-%03d.log") % which_scheduler++);
@@ -168,22 +194,106 @@ namespace gr {
              << d_block << std::endl;
     }
 
+    prefs *p = prefs::singleton();
+    d_autogrow = p->get_bool("DEFAULT", "buffer_grow_on_block", false);
+    d_grow_threshold = static_cast<int>(p->get_long("DEFAULT", "buffer_grow_threshold", 64));
+    d_grow_max_bytes = p->get_long("DEFAULT", "buffer_grow_max_size", 1 << 26);
+
+    if(d_autogrow) {
+      block_detail *d = d_block->detail().get();
+      for(int i = 0; i < d->noutputs(); i++)
+        d->output(i)->set_growable(true);
+    }
+
+    d_tune = d_block->chunk_autotune()
+      || p->get_bool("DEFAULT", "chunk_autotune", false);
+    d_tune_chunk = 8192;
+    d_tune_dir = 1;
+    d_tune_prev_rate = 0;
+    d_tune_items = 0;
+    d_tune_ticks = 0;
+    d_tune_window = high_res_timer_tps() / 100;	// 10 ms of work time
+
 #ifdef GR_PERFORMANCE_COUNTERS
-    prefs *prefs = prefs::singleton();
-    d_use_pc = prefs->get_bool("PerfCounters", "on", false);
+    d_use_pc = p->get_bool("PerfCounters", "on", false);
 #endif /* GR_PERFORMANCE_COUNTERS */
 
+    d_wd_slot = work_watchdog::singleton()->attach(d_block->alias());
+    d_trace_ring = event_tracer::singleton()->attach(d_block->alias());
+
     d_block->start();			// enable any drivers, etc.
   }
 
+  void
+  block_executor::try_grow_output_buffers()
+  {
+    block        *m = d_block.get();
+    block_detail *d = m->detail().get();
+
+    for(int i = 0; i < d->noutputs(); i++) {
+      buffer_sptr buf = d->output(i);
+
+      bool full;
+      {
+        gr::thread::scoped_lock guard(*buf->mutex());
+        full = round_down(buf->space_available(), m->output_multiple())
+          < std::max(m->min_noutput_items(), 1);
+      }
+      if(!full)
+        continue;
+
+      long new_nitems = 2L * buf->bufsize();
+      if(new_nitems * (long)buf->get_sizeof_item() > d_grow_max_bytes)
+        continue;
+
+      if(buf->grow(new_nitems)) {
+        std::cerr << "gr::block_executor: grew output buffer " << i
+                  << " of <block " << m->name()
+                  << " (" << m->unique_id() << ")> to "
+                  << buf->bufsize() << " items\n";
+      }
+    }
+    d_consec_blkd_out = 0;
+  }
+
   block_executor::~block_executor()
   {
     if(ENABLE_LOGGING)
       delete d_log;
 
+    work_watchdog::singleton()->detach(d_wd_slot);
+    event_tracer::singleton()->detach(d_trace_ring);
+
     d_block->stop();			// stop any drivers, etc.
   }
 
+  void
+  block_executor::update_chunk_tuning()
+  {
+    static const int TUNE_MIN_CHUNK = 256;
+
+    double rate = (double)d_tune_items * high_res_timer_tps()
+      / (double)d_tune_ticks;
+
+    // 1-D hill climb: keep moving while the rate holds up, turn
+    // around when it drops noticeably.  The 2% dead band keeps
+    // measurement noise from flapping the direction.
+    if(d_tune_prev_rate > 0 && rate < d_tune_prev_rate * 0.98)
+      d_tune_dir = -d_tune_dir;
+    d_tune_prev_rate = rate;
+
+    int multiple = d_block->output_multiple();
+    int next = d_tune_dir > 0 ? d_tune_chunk * 2 : d_tune_chunk / 2;
+    next = round_down(next, multiple);
+    next = std::max(next, (int)round_up(std::max(TUNE_MIN_CHUNK, multiple), multiple));
+    next = std::min(next, std::max(multiple, (int)round_down(d_max_noutput_items, multiple)));
+    if(next > 0)
+      d_tune_chunk = next;
+
+    d_tune_items = 0;
+    d_tune_ticks = 0;
+  }
+
   block_executor::state
   block_executor::run_one_iteration()
   {
@@ -193,14 +303,24 @@ namespace gr {
     int new_alignment = 0;
     int alignment_state = -1;
     double rrate;
-    
+    block::work_kernel_t kernel = 0;
+
     block        *m = d_block.get();
     block_detail *d = m->detail().get();
 
     LOG(*d_log << std::endl << m);
 
     max_noutput_items = round_down(d_max_noutput_items, m->output_multiple());
-    
+
+    // Cap requests at the current preferred chunk; the measurement
+    // after work nudges the cap toward whatever this machine's caches
+    // like best.
+    if(d_tune) {
+      int cap = round_down(d_tune_chunk, m->output_multiple());
+      if(cap >= m->output_multiple())
+        max_noutput_items = std::min(max_noutput_items, cap);
+    }
+
     if(d->done()){
       assert(0);
       return DONE;
@@ -223,6 +343,8 @@ namespace gr {
 
       if(noutput_items == 0){		// we're output blocked
         LOG(*d_log << "  BLKD_OUT\n");
+        if(d_autogrow && ++d_consec_blkd_out >= d_grow_threshold)
+          try_grow_output_buffers();
         return BLKD_OUT;
       }
 
@@ -261,6 +383,19 @@ namespace gr {
       // take a swag at how much output we can sink
       noutput_items = (int)(max_items_avail * m->relative_rate ());
       noutput_items = round_down(noutput_items, m->output_multiple ());
+
+      // Honor an optional lower bound so cheap sinks can batch their
+      // input; once any upstream is done we take whatever remains.
+      if(noutput_items < m->min_noutput_items()) {
+        bool upstream_done = false;
+        for(int i = 0; i < d->ninputs(); i++)
+          upstream_done = upstream_done || d_input_done[i];
+        if(!upstream_done) {
+          LOG(*d_log << "  BLKD_IN (min_noutput_items)\n");
+          return BLKD_IN;
+        }
+      }
+
       noutput_items = std::min(noutput_items, max_noutput_items);
       LOG(*d_log << "  max_items_avail = " << max_items_avail << std::endl);
       LOG(*d_log << "  noutput_items = " << noutput_items << std::endl);
@@ -311,6 +446,8 @@ namespace gr {
 
       if(noutput_items == 0) {		// we're output blocked
         LOG(*d_log << "  BLKD_OUT\n");
+        if(d_autogrow && ++d_consec_blkd_out >= d_grow_threshold)
+          try_grow_output_buffers();
         return BLKD_OUT;
       }
 
@@ -368,7 +505,12 @@ namespace gr {
       }
 
       // ask the block how much input they need to produce noutput_items
-      m->forecast (noutput_items, d_ninput_items_required);
+      if(d->ninputs() == 1 && d->noutputs() == 1)
+        kernel = m->work_kernel();
+      if(kernel)    // registered kernels are strictly 1:1 with history 1
+        d_ninput_items_required[0] = noutput_items;
+      else
+        m->forecast (noutput_items, d_ninput_items_required);
 
       // See if we've got sufficient input available
       int i;
@@ -434,8 +576,38 @@ namespace gr {
 #endif /* GR_PERFORMANCE_COUNTERS */
     
       // Do the actual work of the block
-      int n = m->general_work(noutput_items, d_ninput_items,
-                              d_input_items, d_output_items);
+      work_watchdog::enter(d_wd_slot);
+      event_tracer::trace(d_trace_ring, event_tracer::EV_WORK_START,
+                          noutput_items);
+      high_res_timer_type tune_start = 0;
+      if(d_tune)
+        tune_start = high_res_timer_now();
+      int n;
+      if(kernel) {
+        // direct call, bypassing the general_work -> work virtual
+        // chain; the kernel consumes what it produces
+        n = kernel(d_input_items[0], d_output_items[0], noutput_items,
+                   m->work_kernel_arg());
+        if(n > 0)
+          m->consume_each(n);
+      }
+      else {
+        n = m->general_work(noutput_items, d_ninput_items,
+                            d_input_items, d_output_items);
+      }
+      if(d_tune && n > 0) {
+        d_tune_items += n;
+        d_tune_ticks += high_res_timer_now() - tune_start;
+        if(d_tune_ticks >= d_tune_window)
+          update_chunk_tuning();
+      }
+      event_tracer::trace(d_trace_ring, event_tracer::EV_WORK_END,
+                          n < 0 ? 0 : n);
+      work_watchdog::leave(d_wd_slot);
+
+      // Scratch handed out via block::scratch_alloc() is only good
+      // for the duration of the call.
+      d->scratch_reset();
 
 #ifdef GR_PERFORMANCE_COUNTERS
       if(d_use_pc)
@@ -462,9 +634,9 @@ namespace gr {
       }
 
       // Now propagate the tags based on the new relative rate
-      if(!propagate_tags(m->tag_propagation_policy(), d,
+      if(!propagate_tags(m, d,
                          d_start_nitems_read, m->relative_rate(),
-                         d_returned_tags, m->unique_id()))
+                         d_returned_tags))
         goto were_done;
 
       if(n == block::WORK_DONE)
@@ -473,6 +645,8 @@ namespace gr {
       if(n != block::WORK_CALLED_PRODUCE)
         d->produce_each(n);     // advance write pointers
 
+      d_consec_blkd_out = 0;
+
       if(d->d_produce_or > 0)   // block produced something
         return READY;
 
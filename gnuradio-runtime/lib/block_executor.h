@@ -26,6 +26,9 @@
 #include <gnuradio/api.h>
 #include <gnuradio/runtime_types.h>
 #include <gnuradio/tags.h>
+#include <gnuradio/work_watchdog.h>
+#include <gnuradio/event_tracer.h>
+#include <gnuradio/high_res_timer.h>
 #include <fstream>
 
 namespace gr {
@@ -51,10 +54,42 @@ namespace gr {
     std::vector<tag_t>          d_returned_tags;
     int                         d_max_noutput_items;
 
+    // Optional auto-grow of output buffers (buffer_grow_on_block pref):
+    // after d_grow_threshold consecutive output-blocked iterations the
+    // full output buffers are reallocated to double their size.
+    bool                        d_autogrow;
+    int                         d_grow_threshold;
+    long                        d_grow_max_bytes;
+    int                         d_consec_blkd_out;
+
+    //! Attempt to grow the output buffers we're blocked on.
+    void try_grow_output_buffers();
+
+    // Adaptive chunk sizing (block::set_chunk_autotune or the
+    // chunk_autotune pref): items/sec is measured over windows of
+    // work time and a preferred chunk cap is hill-climbed at runtime.
+    bool                        d_tune;
+    int                         d_tune_chunk;      // current cap, in items
+    int                         d_tune_dir;        // +1 grow, -1 shrink
+    double                      d_tune_prev_rate;  // previous window's items/sec
+    uint64_t                    d_tune_items;      // items produced this window
+    high_res_timer_type         d_tune_ticks;      // work time this window
+    high_res_timer_type         d_tune_window;     // window length, in ticks
+
+    //! Close a measurement window and nudge the preferred chunk.
+    void update_chunk_tuning();
+
 #ifdef GR_PERFORMANCE_COUNTERS
     bool d_use_pc;
 #endif /* GR_PERFORMANCE_COUNTERS */
 
+    // stall-detection cell stamped around every work() call; NULL
+    // when the watchdog is disabled
+    work_watchdog::slot *d_wd_slot;
+
+    // scheduler event trace ring; NULL when tracing is disabled
+    event_tracer::ring *d_trace_ring;
+
   public:
     block_executor(block_sptr block, int max_noutput_items=100000);
     ~block_executor();
@@ -25,19 +25,43 @@
 #endif
 
 #include <gnuradio/buffer.h>
+#include <gnuradio/buffer_stats.h>
+#include <gnuradio/block.h>
 #include <gnuradio/math.h>
 #include "vmcircbuf.h"
+#include <volk/volk.h>
 #include <stdexcept>
 #include <iostream>
 #include <assert.h>
 #include <algorithm>
+#include <string.h>
 #include <boost/math/common_factor_rt.hpp>
 
+// Full memory barrier used by the lock-free single-reader index
+// updates.  Platforms without a known barrier primitive simply keep
+// the mutex path for every connection.
+#if defined(__GNUC__)
+#define GR_BUFFER_HAVE_FENCES 1
+static inline void buffer_memory_barrier() { __sync_synchronize(); }
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define GR_BUFFER_HAVE_FENCES 1
+static inline void buffer_memory_barrier() { _ReadWriteBarrier(); ::MemoryBarrier(); }
+#else
+static inline void buffer_memory_barrier() { }
+#endif
+
 namespace gr {
 
   static long s_buffer_count = 0;		// counts for debugging storage mgmt
   static long s_buffer_reader_count = 0;
 
+  // every live buffer, so buffer_stats can walk them
+  static std::vector<buffer*> s_buffers;
+
+  // the startup path can allocate buffers from several threads
+  static gr::thread::mutex s_count_mutex;
+
   /* ----------------------------------------------------------------------------
   			Notes on storage management
 
@@ -79,29 +103,71 @@ namespace gr {
   }
 
 
-  buffer::buffer(int nitems, size_t sizeof_item, block_sptr link)
+  buffer::buffer(int nitems, size_t sizeof_item, block_sptr link,
+                 bool allow_explicit_wrap)
     : d_base(0), d_bufsize(0), d_max_reader_delay(0), d_vmcircbuf(0),
       d_sizeof_item(sizeof_item), d_link(link),
       d_write_index(0), d_abs_write_offset(0), d_done(false),
-      d_last_min_items_read(0)
+      d_last_min_items_read(0), d_numa_node(-1), d_single_reader(false),
+      d_growable(false),
+      // allocate_buffer clears this again unless it actually takes
+      // the single-mapping fallback
+      d_explicit_wrap(allow_explicit_wrap)
   {
     if(!allocate_buffer (nitems, sizeof_item))
       throw std::bad_alloc ();
 
+    gr::thread::scoped_lock guard(s_count_mutex);
     s_buffer_count++;
+    s_buffers.push_back(this);
   }
 
   buffer_sptr
-  make_buffer(int nitems, size_t sizeof_item, block_sptr link)
+  make_buffer(int nitems, size_t sizeof_item, block_sptr link,
+              bool allow_explicit_wrap)
   {
-    return buffer_sptr(new buffer(nitems, sizeof_item, link));
+    return buffer_sptr(new buffer(nitems, sizeof_item, link,
+                                  allow_explicit_wrap));
   }
 
   buffer::~buffer()
   {
+    if(d_explicit_wrap)
+      volk_free(d_base);
     delete d_vmcircbuf;
+    for(size_t i = 0; i < d_retired_circbufs.size(); i++)
+      delete d_retired_circbufs[i];
     assert(d_readers.size() == 0);
+    gr::thread::scoped_lock guard(s_count_mutex);
     s_buffer_count--;
+    s_buffers.erase(std::find(s_buffers.begin(), s_buffers.end(), this));
+  }
+
+  std::vector<buffer_stats::entry>
+  buffer_stats::snapshot()
+  {
+    // Holding s_count_mutex pins the buffer and reader lists; the
+    // indices themselves are read without the buffer mutex, so the
+    // item counts are racy snapshots good enough for monitoring.
+    gr::thread::scoped_lock guard(s_count_mutex);
+
+    std::vector<entry> v;
+    for(size_t i = 0; i < s_buffers.size(); i++) {
+      buffer *b = s_buffers[i];
+      block_sptr wl = b->link();
+      for(size_t r = 0; r < b->nreaders(); r++) {
+        buffer_reader *rd = b->reader(r);
+        block_sptr rl = rd->link();
+
+        entry e;
+        e.writer = wl ? wl->alias() : "(none)";
+        e.reader = rl ? rl->alias() : "(none)";
+        e.items = rd->items_available();
+        e.bufsize = b->bufsize();
+        v.push_back(e);
+      }
+    }
+    return v;
   }
 
   /*!
@@ -121,6 +187,27 @@ namespace gr {
     if(nitems % min_nitems != 0)
       nitems = ((nitems / min_nitems) + 1) * min_nitems;
 
+    // When the rounding blows the buffer up -- item sizes sharing few
+    // factors with the page size -- and the caller allowed it, use a
+    // plain single mapping of the requested size instead and handle
+    // the seam explicitly (space_available and items_available stop
+    // at the end of the ring).
+    if(d_explicit_wrap &&
+       nitems > 2 * orig_nitems && nitems * (int)sizeof_item > granularity) {
+      d_bufsize = orig_nitems;
+      d_base = (char*)volk_malloc(d_bufsize * d_sizeof_item,
+                                  volk_get_alignment());
+      if(d_base == 0) {
+        std::cerr << "gr::buffer::allocate_buffer: failed to allocate buffer of size "
+                  << d_bufsize * d_sizeof_item / 1024 << " KB\n";
+        return false;
+      }
+      if(d_numa_node >= 0)
+        set_numa_node(d_numa_node);
+      return true;
+    }
+    d_explicit_wrap = false;
+
     // If we rounded-up a whole bunch, give the user a heads up.
     // This only happens if sizeof_item is not a power of two.
 
@@ -142,14 +229,108 @@ namespace gr {
     }
 
     d_base = (char*)d_vmcircbuf->pointer_to_first_copy();
+
+    if(d_numa_node >= 0)
+      set_numa_node(d_numa_node);
+
     return true;
   }
 
+  void
+  buffer::set_numa_node(int node)
+  {
+    d_numa_node = node < 0 ? -1 : node;
+
+    if(d_numa_node < 0 || d_base == 0)
+      return;
+
+    // Bind both copies of the double mapping (explicit-wrap buffers
+    // have only one) so the policy covers the whole address range.
+    size_t factor = d_explicit_wrap ? 1 : 2;
+    if(!gr::vmcircbuf_sysconfig::bind_to_node(d_base,
+                                              factor * (size_t)d_bufsize * d_sizeof_item,
+                                              d_numa_node)) {
+      std::cerr << "gr::buffer::set_numa_node: binding to node "
+                << d_numa_node << " failed (unsupported platform?)\n";
+    }
+  }
+
+  bool
+  buffer::grow(int min_nitems)
+  {
+    gr::thread::scoped_lock guard(d_mutex);
+
+    // an explicit-wrap buffer has no second mapping to remap in place
+    if(d_explicit_wrap)
+      return false;
+
+    // Classify each reader: "wrapped" means its unread region crosses
+    // the end of the ring.  The in-place remap below keeps reader
+    // indices untouched, which only works when all readers agree.
+    bool have_wrapped = false, have_unwrapped = false;
+    for(size_t i = 0; i < d_readers.size(); i++) {
+      if(d_readers[i]->d_read_index > d_write_index)
+        have_wrapped = true;
+      else
+        have_unwrapped = true;
+    }
+    if(have_wrapped && have_unwrapped)
+      return false;
+
+    int old_nitems = d_bufsize;
+    int granularity = gr::vmcircbuf_sysconfig::granularity();
+    int min_grow_nitems = minimum_buffer_items(d_sizeof_item, granularity);
+
+    long nitems = std::max((long)min_nitems, 2L * old_nitems);
+    if(nitems % min_grow_nitems != 0)
+      nitems = ((nitems / min_grow_nitems) + 1) * min_grow_nitems;
+
+    gr::vmcircbuf *c = gr::vmcircbuf_sysconfig::make(nitems * d_sizeof_item);
+    if(c == 0)
+      return false;
+
+    char *new_base = (char*)c->pointer_to_first_copy();
+
+    // Copy both old mappings so any unread region -- wrapped or not --
+    // occupies the same indices in the new ring (for index i in
+    // [0, 2*old), new[i] == old ring at i mod old).
+    memcpy(new_base, d_base, 2 * (size_t)old_nitems * d_sizeof_item);
+
+    // Publish in an order that keeps a concurrent lock-free reader of
+    // (write index, bufsize, base) consistent at every step; each is
+    // a single word store.
+    if(have_wrapped) {
+      unsigned new_write_index = d_write_index + old_nitems;
+      d_write_index = new_write_index;
+    }
+    buffer_memory_barrier();
+    d_bufsize = nitems;
+    buffer_memory_barrier();
+
+    // The old mapping stays alive until the buffer dies, so a read
+    // pointer captured before this call remains valid.
+    d_retired_circbufs.push_back(d_vmcircbuf);
+    d_vmcircbuf = c;
+    d_base = new_base;
+
+    if(d_numa_node >= 0)
+      gr::vmcircbuf_sysconfig::bind_to_node(d_base,
+                                            2 * (size_t)d_bufsize * d_sizeof_item,
+                                            d_numa_node);
+    return true;
+  }
+
+  void
+  buffer::zero_fill()
+  {
+    memset(d_base, 0, (size_t)d_bufsize * d_sizeof_item);
+  }
+
   int
   buffer::space_available()
   {
     if(d_readers.empty())
-      return d_bufsize - 1;	// See comment below
+      return space_to_seam(d_bufsize - 1);	// See comment below
 
     else {
       // Find out the maximum amount of data available to our readers
@@ -168,7 +349,7 @@ namespace gr {
 
       // The -1 ensures that the case d_write_index == d_read_index is
       // unambiguous.  It indicates that there is no data for the reader
-      return d_bufsize - most_data - 1;
+      return space_to_seam(d_bufsize - most_data - 1);
     }
   }
 
@@ -181,6 +362,18 @@ namespace gr {
   void
   buffer::update_write_pointer(int nitems)
   {
+#ifdef GR_BUFFER_HAVE_FENCES
+    if(d_single_reader && !d_growable) {
+      // SPSC fast path: we are the only thread that ever stores the
+      // write index.  Make the freshly written items visible before
+      // publishing the new index to the reader.
+      unsigned new_index = index_add(d_write_index, nitems);
+      buffer_memory_barrier();
+      d_write_index = new_index;
+      d_abs_write_offset += nitems;
+      return;
+    }
+#endif
     gr::thread::scoped_lock guard(*mutex());
     d_write_index = index_add(d_write_index, nitems);
     d_abs_write_offset += nitems;
@@ -204,7 +397,12 @@ namespace gr {
                                                           nzero_preload),
                                            link));
     r->declare_sample_delay(delay);
-    buf->d_readers.push_back(r.get ());
+    {
+      // paired with buffer_stats::snapshot, which walks d_readers
+      gr::thread::scoped_lock guard(s_count_mutex);
+      buf->d_readers.push_back(r.get ());
+      buf->update_reader_mode();
+    }
 
     return r;
   }
@@ -219,22 +417,62 @@ namespace gr {
       throw std::invalid_argument("buffer::drop_reader");    // we didn't find it...
 
     d_readers.erase(result);
+    update_reader_mode();
   }
 
   void
   buffer::add_item_tag(const tag_t &tag)
   {
     gr::thread::scoped_lock guard(*mutex());
-    d_item_tags.push_back(tag);
+    d_item_tags.insert(std::pair<uint64_t,tag_t>(tag.offset, tag));
+  }
+
+  void
+  buffer::add_item_tags(const std::vector<tag_t> &tags)
+  {
+    if(tags.empty())
+      return;
+
+    gr::thread::scoped_lock guard(*mutex());
+
+    // The incoming tags are sorted and almost always newer than
+    // anything already stored, so hinting with the previous insert
+    // position makes each insert amortized constant time.
+    std::multimap<uint64_t,tag_t>::iterator hint = d_item_tags.end();
+    std::vector<tag_t>::const_iterator t;
+    for(t = tags.begin(); t != tags.end(); t++) {
+      hint = d_item_tags.insert(hint, std::pair<uint64_t,tag_t>(t->offset, *t));
+    }
+  }
+
+  void
+  buffer::move_item_tags(std::vector<tag_t> &tags)
+  {
+    if(tags.empty())
+      return;
+
+    gr::thread::scoped_lock guard(*mutex());
+
+    // Same hinted insert as add_item_tags, but the stored tag starts
+    // out empty and the fields are swapped in from the source, which
+    // costs no PMT reference count traffic.
+    std::multimap<uint64_t,tag_t>::iterator hint = d_item_tags.end();
+    std::vector<tag_t>::iterator t;
+    for(t = tags.begin(); t != tags.end(); t++) {
+      hint = d_item_tags.insert(hint, std::pair<uint64_t,tag_t>(t->offset, tag_t()));
+      hint->second.swap(*t);
+    }
   }
 
   void
   buffer::remove_item_tag(const tag_t &tag, long id)
   {
     gr::thread::scoped_lock guard(*mutex());
-    for(std::deque<tag_t>::iterator it = d_item_tags.begin(); it != d_item_tags.end(); ++it) {
-      if(*it == tag) {
-	(*it).marked_deleted.push_back(id);
+    std::multimap<uint64_t,tag_t>::iterator it = d_item_tags.lower_bound(tag.offset);
+    std::multimap<uint64_t,tag_t>::iterator end = d_item_tags.upper_bound(tag.offset);
+    for(; it != end; ++it) {
+      if(it->second == tag) {
+	it->second.marked_deleted.push_back(id);
       }
     }
   }
@@ -251,23 +489,13 @@ namespace gr {
        buffer's mutex al la the scoped_lock line below.
     */
     //gr::thread::scoped_lock guard(*mutex());
-    std::deque<tag_t>::iterator itr = d_item_tags.begin();
-
-    uint64_t item_time;
 
-    // Since tags are not guarenteed to be in any particular order, we
-    // need to erase here instead of pop_front. An erase in the middle
-    // invalidates all iterators; so this resets the iterator to find
-    // more. Mostly, we wil be erasing from the front and
-    // therefore lose little time this way.
-    while(itr != d_item_tags.end()) {
-      item_time = (*itr).offset;
-      if(item_time+d_max_reader_delay + bufsize() < max_time) {
-        d_item_tags.erase(itr);
-        itr = d_item_tags.begin();
-      }
-      else
-        itr++;
+    // The container is ordered by offset, so expired tags are a
+    // prefix: erase from the front and stop at the first survivor.
+    std::multimap<uint64_t,tag_t>::iterator itr = d_item_tags.begin();
+    while(itr != d_item_tags.end()
+          && itr->first + d_max_reader_delay + bufsize() < max_time) {
+      d_item_tags.erase(itr++);
     }
   }
 
@@ -284,6 +512,7 @@ namespace gr {
     : d_buffer(buffer), d_read_index(read_index), d_abs_read_offset(0), d_link(link),
       d_attr_delay(0)
   {
+    gr::thread::scoped_lock guard(s_count_mutex);
     s_buffer_reader_count++;
 
     buffer->d_max_reader_delay = 0;
@@ -291,6 +520,9 @@ namespace gr {
 
   buffer_reader::~buffer_reader()
   {
+    // taken before dropping ourselves so buffer_stats::snapshot
+    // never sees a half-removed reader
+    gr::thread::scoped_lock guard(s_count_mutex);
     d_buffer->drop_reader(this);
     s_buffer_reader_count--;
   }
@@ -312,7 +544,14 @@ namespace gr {
   int
   buffer_reader::items_available() const
   {
-    return d_buffer->index_sub(d_buffer->d_write_index, d_read_index);
+    int n = d_buffer->index_sub(d_buffer->d_write_index, d_read_index);
+
+    // an explicit-wrap buffer only ever hands out the contiguous run
+    // up to the end of the ring
+    if(d_buffer->d_explicit_wrap)
+      n = std::min(n, (int)(d_buffer->d_bufsize - d_read_index));
+
+    return n;
   }
 
   const void *
@@ -324,6 +563,18 @@ namespace gr {
   void
   buffer_reader::update_read_pointer(int nitems)
   {
+#ifdef GR_BUFFER_HAVE_FENCES
+    if(d_buffer->d_single_reader && !d_buffer->d_growable) {
+      // SPSC fast path: only this thread stores the read index.  The
+      // barrier keeps our reads of the consumed items from being
+      // reordered past the index store that frees the space.
+      unsigned new_index = d_buffer->index_add(d_read_index, nitems);
+      buffer_memory_barrier();
+      d_read_index = new_index;
+      d_abs_read_offset += nitems;
+      return;
+    }
+#endif
     gr::thread::scoped_lock guard(*mutex());
     d_read_index = d_buffer->index_add (d_read_index, nitems);
     d_abs_read_offset += nitems;
@@ -338,19 +589,28 @@ namespace gr {
     gr::thread::scoped_lock guard(*mutex());
 
     v.resize(0);
-    std::deque<tag_t>::iterator itr = d_buffer->get_tags_begin();
+
+    // Tags are keyed on their (undelayed) offset, so translate the
+    // requested range back by our sample delay and jump straight to
+    // the first candidate instead of scanning every tag.
+    uint64_t lower = (abs_start < d_attr_delay) ? 0 : abs_start - d_attr_delay;
+    uint64_t upper = (abs_end < d_attr_delay) ? 0 : abs_end - d_attr_delay;
+
+    std::multimap<uint64_t,tag_t>::iterator itr = d_buffer->get_tags_lower_bound(lower);
+    std::multimap<uint64_t,tag_t>::iterator end = d_buffer->get_tags_lower_bound(upper);
 
     uint64_t item_time;
-    while(itr != d_buffer->get_tags_end()) {
-      item_time = (*itr).offset + d_attr_delay;
+    while(itr != end) {
+      item_time = itr->second.offset + d_attr_delay;
 
       if((item_time >= abs_start) && (item_time < abs_end)) {
 	std::vector<long>::iterator id_itr;
-	id_itr = std::find(itr->marked_deleted.begin(), itr->marked_deleted.end(), id);
+	id_itr = std::find(itr->second.marked_deleted.begin(),
+                           itr->second.marked_deleted.end(), id);
 
         // If id is not in the vector of marked blocks
-	if(id_itr == itr->marked_deleted.end()) {
-          tag_t t = *itr;
+	if(id_itr == itr->second.marked_deleted.end()) {
+          tag_t t = itr->second;
           t.offset += d_attr_delay;
 	  v.push_back(t);
 	  v.back().marked_deleted.clear();
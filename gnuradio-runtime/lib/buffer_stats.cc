@@ -0,0 +1,137 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/buffer_stats.h>
+#include <boost/format.hpp>
+#include <sstream>
+
+namespace gr {
+
+  // snapshot() lives in buffer.cc, next to the buffer registry
+
+  buffer_stats *
+  buffer_stats::singleton()
+  {
+    static buffer_stats instance;
+    return &instance;
+  }
+
+  buffer_stats::buffer_stats()
+    : d_running(false), d_finished(false), d_period_ms(10)
+  {
+  }
+
+  buffer_stats::~buffer_stats()
+  {
+    stop();
+  }
+
+  void
+  buffer_stats::start(long period_ms)
+  {
+    gr::thread::scoped_lock guard(d_mutex);
+
+    if(period_ms < 1)
+      period_ms = 1;
+    d_period_ms = period_ms;
+
+    if(d_running)
+      return;
+
+    d_finished = false;
+    d_thread = gr::thread::thread(boost::bind(&buffer_stats::run, this));
+    d_running = true;
+  }
+
+  void
+  buffer_stats::stop()
+  {
+    {
+      gr::thread::scoped_lock guard(d_mutex);
+      if(!d_running)
+        return;
+      d_finished = true;
+      d_running = false;
+    }
+
+    d_thread.interrupt();
+    d_thread.join();
+  }
+
+  void
+  buffer_stats::run()
+  {
+    try {
+      while(!d_finished) {
+        std::vector<entry> snap = snapshot();
+
+        {
+          gr::thread::scoped_lock guard(d_mutex);
+          for(size_t i = 0; i < snap.size(); i++) {
+            std::string edge = snap[i].writer + "->" + snap[i].reader;
+            double fill = (double)snap[i].items / snap[i].bufsize;
+            std::map<std::string, double>::iterator it = d_peaks.find(edge);
+            if(it == d_peaks.end() || fill > it->second)
+              d_peaks[edge] = fill;
+          }
+        }
+
+        boost::this_thread::sleep(boost::posix_time::milliseconds(d_period_ms));
+      }
+    }
+    catch(boost::thread_interrupted&) {
+    }
+  }
+
+  std::string
+  buffer_stats::fill_list()
+  {
+    std::vector<entry> snap = snapshot();
+
+    std::stringstream s;
+    for(size_t i = 0; i < snap.size(); i++) {
+      s << boost::format("%s->%s: %d/%d\n")
+        % snap[i].writer % snap[i].reader
+        % snap[i].items % snap[i].bufsize;
+    }
+    return s.str();
+  }
+
+  std::string
+  buffer_stats::peak_list()
+  {
+    gr::thread::scoped_lock guard(d_mutex);
+
+    std::stringstream s;
+    std::map<std::string, double>::iterator it;
+    for(it = d_peaks.begin(); it != d_peaks.end(); it++) {
+      s << boost::format("%s: %.1f%%\n") % it->first % (100.0*it->second);
+    }
+    d_peaks.clear();
+    return s.str();
+  }
+
+} /* namespace gr */
@@ -0,0 +1,189 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/event_tracer.h>
+#include <gnuradio/logger.h>
+#include <gnuradio/prefs.h>
+#include <string.h>
+#include <algorithm>
+
+// Release/acquire ordering between the producer's record store and
+// its head update, mirroring the fences in buffer.cc.
+#if defined(__GNUC__)
+static inline void tracer_memory_barrier() { __sync_synchronize(); }
+#elif defined(_MSC_VER)
+#include <intrin.h>
+static inline void tracer_memory_barrier() { _ReadWriteBarrier(); ::MemoryBarrier(); }
+#else
+static inline void tracer_memory_barrier() { }
+#endif
+
+namespace gr {
+
+  // records buffered per executor before the flusher must catch up
+  static const size_t s_ring_capacity = 1 << 14;
+
+  event_tracer::ring::ring(uint32_t block_id, size_t capacity)
+    : d_block(block_id), d_mask(capacity - 1), d_buf(capacity),
+      d_ndropped(0), d_head(0), d_tail(0)
+  {
+  }
+
+  void
+  event_tracer::ring::push(event_t event, uint32_t nitems)
+  {
+    size_t h = d_head;
+    if(h - d_tail > d_mask) {	// full; never block the scheduler
+      d_ndropped++;
+      return;
+    }
+
+    record &r = d_buf[h & d_mask];
+    r.ticks = high_res_timer_now();
+    r.block = d_block;
+    r.nitems = nitems;
+    r.event = event;
+    r.pad = 0;
+
+    tracer_memory_barrier();
+    d_head = h + 1;
+  }
+
+  event_tracer *
+  event_tracer::singleton()
+  {
+    static event_tracer instance;
+    return &instance;
+  }
+
+  event_tracer::event_tracer()
+    : d_finished(false), d_file(0), d_names(0), d_next_id(0)
+  {
+    prefs *p = prefs::singleton();
+    d_enabled = p->get_bool("Tracer", "enable", false);
+    if(!d_enabled)
+      return;
+
+    std::string path = p->get_string("Tracer", "file", "./gr_trace.dat");
+    d_file = fopen(path.c_str(), "wb");
+    d_names = fopen((path + ".names").c_str(), "w");
+    if(!d_file || !d_names) {
+      GR_LOG_GETLOGGER(LOG, "gr_log.event_tracer");
+      GR_LOG_WARN(LOG, "event_tracer: cannot open trace file " + path
+                  + "; tracing disabled");
+      d_enabled = false;
+      return;
+    }
+
+    // header: magic, then timestamp resolution
+    fwrite("GRTRACE1", 1, 8, d_file);
+    uint64_t tps = (uint64_t)high_res_timer_tps();
+    fwrite(&tps, sizeof(tps), 1, d_file);
+
+    d_thread = gr::thread::thread(boost::bind(&event_tracer::run, this));
+  }
+
+  event_tracer::~event_tracer()
+  {
+    if(d_enabled) {
+      d_finished = true;
+      d_thread.interrupt();
+      d_thread.join();
+    }
+
+    gr::thread::scoped_lock guard(d_mutex);
+    for(size_t i = 0; i < d_rings.size(); i++) {
+      flush(d_rings[i]);
+      delete d_rings[i];
+    }
+    d_rings.clear();
+
+    if(d_file)
+      fclose(d_file);
+    if(d_names)
+      fclose(d_names);
+  }
+
+  event_tracer::ring *
+  event_tracer::attach(const std::string &name)
+  {
+    if(!d_enabled)
+      return 0;
+
+    gr::thread::scoped_lock guard(d_mutex);
+    ring *r = new ring(d_next_id, s_ring_capacity);
+    fprintf(d_names, "%u %s\n", d_next_id, name.c_str());
+    fflush(d_names);
+    d_next_id++;
+    d_rings.push_back(r);
+    return r;
+  }
+
+  void
+  event_tracer::detach(ring *r)
+  {
+    if(!r)
+      return;
+
+    gr::thread::scoped_lock guard(d_mutex);
+    flush(r);
+    d_rings.erase(std::find(d_rings.begin(), d_rings.end(), r));
+    delete r;
+  }
+
+  //! Drain every record the producer has published.  d_mutex held.
+  void
+  event_tracer::flush(ring *r)
+  {
+    size_t t = r->d_tail;
+    size_t h = r->d_head;
+    tracer_memory_barrier();
+
+    while(t != h) {
+      fwrite(&r->d_buf[t & r->d_mask], sizeof(record), 1, d_file);
+      t++;
+    }
+    r->d_tail = t;
+  }
+
+  void
+  event_tracer::run()
+  {
+    try {
+      while(!d_finished) {
+        {
+          gr::thread::scoped_lock guard(d_mutex);
+          for(size_t i = 0; i < d_rings.size(); i++)
+            flush(d_rings[i]);
+        }
+        boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+      }
+    }
+    catch(boost::thread_interrupted&) {
+    }
+  }
+
+} /* namespace gr */
@@ -25,13 +25,20 @@
 #endif
 
 #include "flat_flowgraph.h"
+#include "kernel_chain_block.h"
+#include "vmcircbuf.h"
 #include <gnuradio/block_detail.h>
 #include <gnuradio/buffer.h>
 #include <gnuradio/prefs.h>
 #include <volk/volk.h>
 #include <iostream>
+#include <fstream>
 #include <map>
+#include <algorithm>
+#include <cstdlib>
+#include <boost/bind.hpp>
 #include <boost/format.hpp>
+#include <boost/thread/thread.hpp>
 
 namespace gr {
 
@@ -62,8 +69,7 @@ namespace gr {
     basic_block_vector_t blocks = calc_used_blocks();
 
     // Assign block details to blocks
-    for(basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++)
-      cast_to_block_sptr(*p)->set_detail(allocate_block_detail(*p));
+    allocate_block_details(blocks);
 
     // Connect inputs to outputs for each block
     for(basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++) {
@@ -84,6 +90,144 @@ namespace gr {
     }
   }
 
+  void
+  flat_flowgraph::collapse_transparent_blocks()
+  {
+    // Snapshot the block list, since the rewrites below edit d_edges.
+    basic_block_vector_t blocks = calc_used_blocks();
+
+    for(basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++) {
+      block_sptr grblock = cast_to_block_sptr(*p);
+      if(!grblock || !grblock->transparent())
+        continue;
+
+      // Only a plain 1-in/1-out pass-through without history can be
+      // aliased away; anything else keeps its copy.
+      if(calc_used_ports(*p, true).size() != 1 ||
+         calc_used_ports(*p, false).size() != 1 ||
+         grblock->history() != 1 ||
+         ((*p)->input_signature()->sizeof_stream_item(0) !=
+          (*p)->output_signature()->sizeof_stream_item(0))) {
+        if(FLAT_FLOWGRAPH_DEBUG)
+          std::cout << "not collapsing transparent block " << (*p) << std::endl;
+        continue;
+      }
+
+      edge up = calc_upstream_edge(*p, 0);
+
+      edge_vector_t out_edges;
+      for(edge_viter_t e = d_edges.begin(); e != d_edges.end(); e++) {
+        if(e->src().block() == *p)
+          out_edges.push_back(*e);
+      }
+
+      // Re-point every downstream reader at the upstream buffer.  If
+      // the upstream block is itself transparent, its own collapse
+      // pass moves these edges one more hop.
+      disconnect(up.src(), up.dst());
+      for(edge_viter_t e = out_edges.begin(); e != out_edges.end(); e++) {
+        disconnect(e->src(), e->dst());
+        connect(up.src(), e->dst());
+      }
+
+      if(FLAT_FLOWGRAPH_DEBUG)
+        std::cout << "collapsed transparent block " << (*p) << std::endl;
+    }
+  }
+
+  // number of edges leaving a block's outputs
+  static int
+  count_out_edges(const edge_vector_t &edges, basic_block_sptr block)
+  {
+    int n = 0;
+    for(edge_vector_t::const_iterator e = edges.begin(); e != edges.end(); e++)
+      if(e->src().block() == block)
+        n++;
+    return n;
+  }
+
+  bool
+  flat_flowgraph::can_fuse(basic_block_sptr block)
+  {
+    block_sptr grblock = cast_to_block_sptr(block);
+    if(!grblock || !grblock->work_kernel())
+      return false;
+
+    // chain members must be plain 1-in/1-out with history 1, like
+    // the kernel contract itself
+    if(calc_used_ports(block, true).size() != 1 ||
+       calc_used_ports(block, false).size() != 1 ||
+       grblock->history() != 1 ||
+       grblock->output_multiple_set())
+      return false;
+
+    // the composite cannot forward message ports
+    if(pmt::length(block->message_ports_in()) != 0 ||
+       pmt::length(block->message_ports_out()) != 0)
+      return false;
+
+    return true;
+  }
+
+  void
+  flat_flowgraph::fuse_kernel_chains()
+  {
+    // Snapshot the block list, since the rewrites below edit d_edges.
+    basic_block_vector_t blocks = calc_used_blocks();
+
+    for(basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++) {
+      if(!can_fuse(*p))
+        continue;
+
+      // Only start at a chain head; a fusable predecessor with a
+      // single reader extends its own chain through us instead.
+      edge up = calc_upstream_edge(*p, 0);
+      if(can_fuse(up.src().block()) && count_out_edges(d_edges, up.src().block()) == 1)
+        continue;
+
+      // Walk downstream while the link is exclusive and the next
+      // block is fusable; the last block's output may fan out.
+      std::vector<block_sptr> chain;
+      basic_block_sptr cur = *p;
+      chain.push_back(cast_to_block_sptr(cur));
+      while(count_out_edges(d_edges, cur) == 1) {
+        basic_block_sptr next = calc_downstream_blocks(cur, 0)[0];
+        if(!can_fuse(next))
+          break;
+        chain.push_back(cast_to_block_sptr(next));
+        cur = next;
+      }
+
+      if(chain.size() < 2)
+        continue;
+
+      kernel_chain_block::sptr fused = kernel_chain_block::make(chain);
+
+      edge_vector_t out_edges;
+      for(edge_viter_t e = d_edges.begin(); e != d_edges.end(); e++) {
+        if(e->src().block() == cur)
+          out_edges.push_back(*e);
+      }
+
+      // Splice the composite in: upstream -> fused -> every reader
+      // of the chain's last block.
+      disconnect(up.src(), up.dst());
+      for(size_t i = 0; i + 1 < chain.size(); i++) {
+        edge mid = calc_upstream_edge(chain[i + 1], 0);
+        disconnect(mid.src(), mid.dst());
+      }
+      connect(up.src(), endpoint(fused, 0));
+      for(edge_viter_t e = out_edges.begin(); e != out_edges.end(); e++) {
+        disconnect(e->src(), e->dst());
+        connect(endpoint(fused, 0), e->dst());
+      }
+
+      if(FLAT_FLOWGRAPH_DEBUG)
+        std::cout << "fused kernel chain of " << chain.size()
+                  << " blocks ending at " << cur << std::endl;
+    }
+  }
+
   block_detail_sptr
   flat_flowgraph::allocate_block_detail(basic_block_sptr block)
   {
@@ -113,6 +257,70 @@ namespace gr {
     return detail;
   }
 
+  void
+  flat_flowgraph::allocate_block_details(const basic_block_vector_t &blocks)
+  {
+    // Buffer allocation dominates startup time on large graphs, so
+    // fan it out over a pool of workers claiming blocks off a shared
+    // index.  The vmcircbuf layer serializes the actual mapping
+    // syscalls internally; reserving and faulting in the new buffers
+    // proceeds in parallel.
+    size_t nthreads = boost::thread::hardware_concurrency();
+    if(nthreads > blocks.size() / 16)
+      nthreads = blocks.size() / 16;
+
+    if(nthreads < 2) {		// too few blocks to be worth a pool
+      for(size_t i = 0; i < blocks.size(); i++)
+        cast_to_block_sptr(blocks[i])->set_detail(allocate_block_detail(blocks[i]));
+      return;
+    }
+
+    // Force selection of the circular buffer factory up front; its
+    // first-use probing is not safe to run from several threads.
+    vmcircbuf_sysconfig::granularity();
+
+    size_t next = 0;
+    std::string error;
+    gr::thread::mutex mutex;
+    boost::thread_group pool;
+    for(size_t i = 0; i < nthreads; i++)
+      pool.create_thread(boost::bind(&flat_flowgraph::allocate_details_worker,
+                                     this, boost::ref(blocks),
+                                     &next, &mutex, &error));
+    pool.join_all();
+
+    if(!error.empty())
+      throw std::runtime_error(error);
+  }
+
+  void
+  flat_flowgraph::allocate_details_worker(const basic_block_vector_t &blocks,
+                                          size_t *next, gr::thread::mutex *mutex,
+                                          std::string *error)
+  {
+    while(true) {
+      size_t i;
+      {
+        gr::thread::scoped_lock guard(*mutex);
+        if(!error->empty() || *next >= blocks.size())
+          return;
+        i = (*next)++;
+      }
+
+      try {
+        cast_to_block_sptr(blocks[i])->set_detail(allocate_block_detail(blocks[i]));
+      }
+      catch(const std::exception &e) {
+        // Record the first failure and wind the pool down; the
+        // caller rethrows it once everyone has joined.
+        gr::thread::scoped_lock guard(*mutex);
+        if(error->empty())
+          *error = e.what();
+        return;
+      }
+    }
+  }
+
   buffer_sptr
   flat_flowgraph::allocate_buffer(basic_block_sptr block, int port)
   {
@@ -149,6 +357,12 @@ namespace gr {
         throw std::runtime_error("problems allocating a buffer with the given min output buffer constraint!");
     }
 
+    // A single mapping with explicit wraparound (see make_buffer)
+    // hands out seam-limited contiguous runs, which is deadlock-free
+    // only if this block and every reader can make progress one item
+    // at a time.
+    bool allow_explicit_wrap = (grblock->output_multiple() == 1);
+
     for(basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++) {
       block_sptr dgrblock = cast_to_block_sptr(*p);
       if(!dgrblock)
@@ -158,6 +372,10 @@ namespace gr {
       int multiple      = dgrblock->output_multiple();
       int history       = dgrblock->history();
       nitems = std::max(nitems, static_cast<int>(2*(decimation*multiple+history)));
+
+      if(!dgrblock->fixed_rate() || dgrblock->relative_rate() < 1.0 ||
+         history != 1 || multiple != 1)
+        allow_explicit_wrap = false;
     }
 
     //  std::cout << "make_buffer(" << nitems << ", " << item_size << ", " << grblock << "\n";
@@ -165,14 +383,39 @@ namespace gr {
     // throw and exit.
     buffer_sptr b;
     try {
-      b = make_buffer(nitems, item_size, grblock);
+      b = make_buffer(nitems, item_size, grblock, allow_explicit_wrap);
     }
     catch(std::bad_alloc&) {
-      b = make_buffer(nitems, item_size, grblock);
+      b = make_buffer(nitems, item_size, grblock, allow_explicit_wrap);
     }
     return b;
   }
 
+  // Pad a block's history preload up to a volk alignment boundary.
+  // The circular buffers are page aligned and sized in whole
+  // alignment units, so a preload that is a multiple of the alignment
+  // (in items) puts the in[0] passed to work on an aligned address;
+  // the scheduler's aligned-consumption logic then keeps it there, so
+  // blocks with history (FIR filters and friends) stay on the aligned
+  // volk kernels in steady state.  The pad only prepends a few more
+  // zero history items at startup.  For item sizes that don't divide
+  // the alignment no pad can help, so the plain preload is returned.
+  static int
+  aligned_history_preload(buffer_sptr buffer, block_sptr block)
+  {
+    int preload = block->history() - 1;
+    if(preload <= 0)
+      return preload;
+
+    size_t itemsize = buffer->get_sizeof_item();
+    size_t alignment = volk_get_alignment();
+    if(itemsize == 0 || alignment % itemsize != 0)
+      return preload;
+
+    int align_items = (int)(alignment / itemsize);
+    return ((preload + align_items - 1) / align_items) * align_items;
+  }
+
   void
   flat_flowgraph::connect_block_inputs(basic_block_sptr block)
   {
@@ -199,29 +442,41 @@ namespace gr {
       if(FLAT_FLOWGRAPH_DEBUG)
         std::cout << "Setting input " << dst_port << " from edge " << (*e) << std::endl;
 
-      detail->set_input(dst_port, buffer_add_reader(src_buffer, grblock->history()-1, grblock,
+      detail->set_input(dst_port, buffer_add_reader(src_buffer,
+                                                    aligned_history_preload(src_buffer, grblock),
+                                                    grblock,
                                                     grblock->sample_delay(src_port)));
     }
   }
 
   void
   flat_flowgraph::merge_connections(flat_flowgraph_sptr old_ffg)
+  {
+    merge_block_connections(old_ffg, d_blocks);
+  }
+
+  void
+  flat_flowgraph::merge_block_connections(flat_flowgraph_sptr old_ffg,
+                                          const basic_block_vector_t &blocks)
   {
     // Allocate block details if needed.  Only new blocks that aren't pruned out
     // by flattening will need one; existing blocks still in the new flowgraph will
     // already have one.
-    for(basic_block_viter_t p = d_blocks.begin(); p != d_blocks.end(); p++) {
+    basic_block_vector_t new_blocks;
+    for(size_t n = 0; n < blocks.size(); n++) {
+      basic_block_vector_t::const_iterator p = blocks.begin() + n;
       block_sptr block = cast_to_block_sptr(*p);
 
       if(!block->detail()) {
         if(FLAT_FLOWGRAPH_DEBUG)
           std::cout << "merge: allocating new detail for block " << (*p) << std::endl;
-        block->set_detail(allocate_block_detail(block));
+        new_blocks.push_back(*p);
       }
       else
         if(FLAT_FLOWGRAPH_DEBUG)
           std::cout << "merge: reusing original detail for block " << (*p) << std::endl;
     }
+    allocate_block_details(new_blocks);
 
     // Calculate the old edges that will be going away, and clear the
     // buffer readers on the RHS.
@@ -250,7 +505,8 @@ namespace gr {
     }
 
     // Now connect inputs to outputs, reusing old buffer readers if they exist
-    for(basic_block_viter_t p = d_blocks.begin(); p != d_blocks.end(); p++) {
+    for(size_t n = 0; n < blocks.size(); n++) {
+      basic_block_vector_t::const_iterator p = blocks.begin() + n;
       block_sptr block = cast_to_block_sptr(*p);
 
       if(FLAT_FLOWGRAPH_DEBUG)
@@ -287,7 +543,9 @@ namespace gr {
               std::cout << "needs a new reader" << std::endl;
 
             // Create new buffer reader and assign
-            detail->set_input(i, buffer_add_reader(src_buffer, block->history()-1, block));
+            detail->set_input(i, buffer_add_reader(src_buffer,
+                                                   aligned_history_preload(src_buffer, block),
+                                                   block));
           }
         }
       }
@@ -307,6 +565,75 @@ namespace gr {
     }
   }
 
+  static bool
+  has_matching_edge(const edge_vector_t &edges, const edge &e)
+  {
+    for(edge_vector_t::const_iterator p = edges.begin(); p != edges.end(); p++)
+      if(p->src() == e.src() && p->dst() == e.dst())
+        return true;
+    return false;
+  }
+
+  bool
+  flat_flowgraph::calc_changed_blocks(flat_flowgraph_sptr old_ffg,
+                                      basic_block_vector_t &changed_old,
+                                      basic_block_vector_t &changed_new)
+  {
+    // Message port connections aren't merged incrementally, so any
+    // change there forces a full restart.
+    if(d_msg_edges.size() != old_ffg->d_msg_edges.size())
+      return false;
+    for(msg_edge_viter_t e = d_msg_edges.begin(); e != d_msg_edges.end(); e++) {
+      msg_edge_viter_t o;
+      for(o = old_ffg->d_msg_edges.begin(); o != old_ffg->d_msg_edges.end(); o++)
+        if(e->src() == o->src() && e->dst() == o->dst())
+          break;
+      if(o == old_ffg->d_msg_edges.end())
+        return false;
+    }
+
+    basic_block_vector_t result;
+
+    // Blocks entering or leaving the graph
+    for(basic_block_viter_t p = d_blocks.begin(); p != d_blocks.end(); p++)
+      if(!old_ffg->has_block_p(*p))
+        result.push_back(*p);
+    for(basic_block_viter_t p = old_ffg->d_blocks.begin();
+        p != old_ffg->d_blocks.end(); p++)
+      if(!has_block_p(*p))
+        result.push_back(*p);
+
+    // Both endpoints of every edge added or removed.  The source side
+    // matters too: its buffer gains or loses a reader, which can't
+    // happen under a running writer.
+    for(edge_viter_t e = d_edges.begin(); e != d_edges.end(); e++) {
+      if(!has_matching_edge(old_ffg->d_edges, *e)) {
+        result.push_back(e->src().block());
+        result.push_back(e->dst().block());
+      }
+    }
+    for(edge_viter_t e = old_ffg->d_edges.begin();
+        e != old_ffg->d_edges.end(); e++) {
+      if(!has_matching_edge(d_edges, *e)) {
+        result.push_back(e->src().block());
+        result.push_back(e->dst().block());
+      }
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    changed_old.clear();
+    changed_new.clear();
+    for(size_t i = 0; i < result.size(); i++) {
+      if(old_ffg->has_block_p(result[i]))
+        changed_old.push_back(result[i]);
+      if(has_block_p(result[i]))
+        changed_new.push_back(result[i]);
+    }
+    return true;
+  }
+
   void
   flat_flowgraph::setup_buffer_alignment(block_sptr block)
   {
@@ -437,6 +764,97 @@ namespace gr {
     }
   }
 
+  // Number of cores sharing the lowest-level cache domain (an L3 on
+  // most machines); falls back to the whole machine when the topology
+  // is not exposed.
+  static int
+  cache_domain_size(int ncores)
+  {
+#ifdef __linux__
+    std::ifstream f("/sys/devices/system/cpu/cpu0/cache/index3/shared_cpu_list");
+    if(f) {
+      std::string line;
+      std::getline(f, line);
+      int count = 0;
+      const char *s = line.c_str();
+      while(*s) {
+        char *end;
+        long a = strtol(s, &end, 10);
+        if(end == s)
+          break;
+        long b = a;
+        if(*end == '-') {
+          s = end + 1;
+          b = strtol(s, &end, 10);
+        }
+        count += (int)(b - a + 1);
+        if(*end == ',')
+          end++;
+        s = end;
+      }
+      if(count > 0 && count <= ncores)
+        return count;
+    }
+#endif
+    return ncores;
+  }
+
+  void
+  flat_flowgraph::assign_core_placement()
+  {
+    int ncores = (int)boost::thread::hardware_concurrency();
+    if(ncores <= 1)
+      return;
+
+    int domain = cache_domain_size(ncores);
+
+    std::vector<basic_block_vector_t> chains = partition();
+    int core = 0;
+
+    for(std::vector<basic_block_vector_t>::iterator c = chains.begin();
+        c != chains.end(); c++) {
+
+      // Average measured work time over the chain; zero on a first
+      // start, before any counters have accumulated.
+      double total = 0;
+      for(basic_block_viter_t p = c->begin(); p != c->end(); p++)
+        total += cast_to_block_sptr(*p)->pc_work_time_total();
+      double avg = c->size() ? total / c->size() : 0;
+
+      // Start each disjoint chain on a fresh cache domain so
+      // independent chains do not share an L3 with each other.
+      if(core % domain)
+        core += domain - core % domain;
+      if(core >= ncores)
+        core = 0;
+
+      bool first = true;
+      for(basic_block_viter_t p = c->begin(); p != c->end(); p++) {
+        block_sptr block = cast_to_block_sptr(*p);
+
+        // A manually pinned block keeps its placement.
+        if(block->processor_affinity().size() > 0)
+          continue;
+
+        // Blocks doing a small fraction of the chain's work share a
+        // core with their neighbor; the rest advance to the next
+        // core of the same domain.
+        double w = block->pc_work_time_total();
+        if(!first && (avg <= 0 || w >= 0.1*avg)) {
+          core++;
+          if(core >= ncores)
+            core = 0;
+        }
+
+        if(FLAT_FLOWGRAPH_DEBUG)
+          std::cout << "placing " << block << " on core " << core << std::endl;
+
+        block->set_processor_affinity(std::vector<int>(1, core));
+        first = false;
+      }
+    }
+  }
+
   void
   flat_flowgraph::enable_pc_rpc()
   {
@@ -48,10 +48,52 @@ namespace gr {
 
     // Wire list of gr::block together in new flat_flowgraph
     void setup_connections();
-  
+
+    /*!
+     * Remove transparent pass-through blocks (see
+     * block::set_transparent) from the edge list, re-pointing their
+     * downstream readers directly at the upstream buffer.  Must be
+     * called before validate().
+     */
+    void collapse_transparent_blocks();
+
+    /*!
+     * Fuse linear chains of blocks with registered work kernels (see
+     * block::set_work_kernel) into a single composite block that runs
+     * the kernels back-to-back on one buffer segment, eliminating the
+     * interior ring buffers and thread crossings.  A chain link must
+     * be an exclusive 1-in/1-out connection; the last block of a
+     * chain may fan out.  Must be called before validate(), after
+     * collapse_transparent_blocks().
+     */
+    void fuse_kernel_chains();
+
     // Merge applicable connections from existing flat flowgraph
     void merge_connections(flat_flowgraph_sptr sfg);
 
+    /*!
+     * Compute the set of blocks whose wiring differs from \p old_ffg:
+     * blocks present on only one side, plus both endpoints of every
+     * edge added or removed.  \p changed_old gets the members of that
+     * set used in \p old_ffg (whose execution must stop) and
+     * \p changed_new the members used here (to rewire and start).
+     * Returns false when the difference can't be expressed per block
+     * (message port connections changed), in which case the caller
+     * must fall back to a full restart.
+     */
+    bool calc_changed_blocks(flat_flowgraph_sptr old_ffg,
+                             basic_block_vector_t &changed_old,
+                             basic_block_vector_t &changed_new);
+
+    /*!
+     * Like merge_connections, but only touches the given blocks; the
+     * rest of the graph keeps its wiring and may keep running while
+     * this happens, provided every buffer being rewired belongs to a
+     * stopped block.
+     */
+    void merge_block_connections(flat_flowgraph_sptr old_ffg,
+                                 const basic_block_vector_t &blocks);
+
     // Return a string list of edges
     std::string edge_list();
 
@@ -74,11 +116,36 @@ namespace gr {
      */
     void enable_pc_rpc();
 
+    /*!
+     * Compute a processor affinity for every block thread from the
+     * connection topology and pin the blocks accordingly.  Adjacent
+     * blocks of a chain are placed on neighboring cores so they share
+     * a cache domain, while disjoint chains are started on separate
+     * domains.  Blocks whose measured work time (from the performance
+     * counters, available after the flowgraph has run once) is small
+     * compared to their chain's average share a core with their
+     * neighbor instead of consuming one of their own.  Blocks with a
+     * manually set affinity are left untouched.
+     */
+    void assign_core_placement();
+
   private:
     flat_flowgraph();
 
+    //! True when \p block can be a member of a fused kernel chain.
+    bool can_fuse(basic_block_sptr block);
+
     block_detail_sptr allocate_block_detail(basic_block_sptr block);
     buffer_sptr allocate_buffer(basic_block_sptr block, int port);
+
+    /* Allocate block details (and their output buffers) for all of
+     * the given blocks, fanning the work out over a thread pool on
+     * large graphs so startup stays fast.
+     */
+    void allocate_block_details(const basic_block_vector_t &blocks);
+    void allocate_details_worker(const basic_block_vector_t &blocks,
+                                 size_t *next, gr::thread::mutex *mutex,
+                                 std::string *error);
     void connect_block_inputs(basic_block_sptr block);
 
     /* When reusing a flowgraph's blocks, this call makes sure all of
@@ -73,6 +73,7 @@ namespace gr {
 
     // All ist klar, Herr Kommisar
     d_edges.push_back(edge(src,dst));
+    d_used_dsts.insert(std::make_pair(dst.block().get(), dst.port()));
   }
 
   void
@@ -81,6 +82,7 @@ namespace gr {
     for(edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++) {
       if(src == p->src() && dst == p->dst()) {
         d_edges.erase(p);
+        d_used_dsts.erase(std::make_pair(dst.block().get(), dst.port()));
         return;
       }
     }
@@ -126,6 +128,7 @@ namespace gr {
     // Boost shared pointers will deallocate as needed
     d_blocks.clear();
     d_edges.clear();
+    d_used_dsts.clear();
   }
 
   void
@@ -162,7 +165,12 @@ namespace gr {
   void
   flowgraph::check_dst_not_used(const endpoint &dst)
   {
-    // A destination is in use if it is already on the edge list
+    // A destination is in use if it is already on the edge list.  The
+    // endpoint set answers that without walking d_edges; the scan below
+    // only runs on the error path, to name the conflicting edge.
+    if(d_used_dsts.count(std::make_pair(dst.block().get(), dst.port())) == 0)
+      return;
+
     for(edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++)
       if(p->dst() == dst) {
         std::stringstream msg;
@@ -27,8 +27,10 @@
 #include <gnuradio/hier_block2.h>
 #include <gnuradio/io_signature.h>
 #include <gnuradio/flowgraph.h>
+#include <gnuradio/block.h>
 #include "hier_block2_detail.h"
 #include <iostream>
+#include <stdexcept>
 
 namespace gr {
 
@@ -85,6 +87,28 @@ namespace gr {
     d_detail->connect(src, src_port, dst, dst_port);
   }
 
+  void
+  hier_block2::connect(basic_block_sptr src, int src_port,
+                       basic_block_sptr dst, int dst_port,
+                       int buffer_nitems)
+  {
+    if(buffer_nitems <= 0)
+      throw std::invalid_argument("connect: buffer_nitems must be > 0");
+
+    // The buffer belongs to the source's output port; record the
+    // depth request as a min_output_buffer constraint, which survives
+    // flattening because it lives on the block itself.
+    block_sptr src_block = cast_to_block_sptr(src);
+    if(!src_block)
+      throw std::invalid_argument("connect: buffer size override requires a non-hierarchical source block");
+
+    d_detail->connect(src, src_port, dst, dst_port);
+
+    long current = src_block->min_output_buffer(src_port);
+    if(buffer_nitems > current)
+      src_block->set_min_output_buffer(src_port, buffer_nitems);
+  }
+
   void
   hier_block2::msg_connect(basic_block_sptr src, pmt::pmt_t srcport,
                            basic_block_sptr dst, pmt::pmt_t dstport)
@@ -176,6 +200,18 @@ namespace gr {
     return d_detail->processor_affinity();
   }
 
+  int
+  hier_block2::set_thread_priority(int priority)
+  {
+    return d_detail->set_thread_priority(priority);
+  }
+
+  int
+  hier_block2::thread_priority()
+  {
+    return d_detail->thread_priority();
+  }
+
   std::string
   dot_graph(hier_block2_sptr hierblock2)
   {
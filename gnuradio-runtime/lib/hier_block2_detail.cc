@@ -709,4 +709,22 @@ namespace gr {
     return tmp[0]->processor_affinity();
   }
 
+  int
+  hier_block2_detail::set_thread_priority(int priority)
+  {
+    int ret = 0;
+    basic_block_vector_t tmp = d_fg->calc_used_blocks();
+    for(basic_block_viter_t p = tmp.begin(); p != tmp.end(); p++) {
+      ret = (*p)->set_thread_priority(priority);
+    }
+    return ret;
+  }
+
+  int
+  hier_block2_detail::thread_priority()
+  {
+    basic_block_vector_t tmp = d_fg->calc_used_blocks();
+    return tmp[0]->thread_priority();
+  }
+
 } /* namespace gr */
@@ -58,6 +58,9 @@ namespace gr {
     void unset_processor_affinity();
     std::vector<int> processor_affinity();
 
+    int set_thread_priority(int priority);
+    int thread_priority();
+
   private:
     // Private implementation data
     hier_block2 *d_owner;
@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "kernel_chain_block.h"
+#include <gnuradio/io_signature.h>
+#include <stdexcept>
+
+namespace gr {
+
+  kernel_chain_block::sptr
+  kernel_chain_block::make(const std::vector<block_sptr> &chain)
+  {
+    return gnuradio::get_initial_sptr(new kernel_chain_block(chain));
+  }
+
+  kernel_chain_block::kernel_chain_block(const std::vector<block_sptr> &chain)
+    : sync_block("kernel_chain",
+                 io_signature::make(1, 1, chain.front()->input_signature()->sizeof_stream_item(0)),
+                 io_signature::make(1, 1, chain.back()->output_signature()->sizeof_stream_item(0))),
+      d_chain(chain)
+  {
+    for(size_t i = 0; i < chain.size(); i++) {
+      if(!chain[i]->work_kernel())
+        throw std::invalid_argument("kernel_chain_block: block has no registered work kernel");
+      d_kernels.push_back(chain[i]->work_kernel());
+      d_args.push_back(chain[i]->work_kernel_arg());
+      if(i + 1 < chain.size())
+        d_stage_sizes.push_back(chain[i]->output_signature()->sizeof_stream_item(0));
+    }
+    d_scratch.resize(d_stage_sizes.size());
+  }
+
+  int
+  kernel_chain_block::work(int noutput_items,
+                           gr_vector_const_void_star &input_items,
+                           gr_vector_void_star &output_items)
+  {
+    const void *src = input_items[0];
+    int n = noutput_items;
+
+    for(size_t i = 0; i < d_kernels.size(); i++) {
+      void *dst;
+      if(i + 1 == d_kernels.size()) {
+        dst = output_items[0];
+      }
+      else {
+        if(d_scratch[i].size() < (size_t)n * d_stage_sizes[i])
+          d_scratch[i].resize((size_t)n * d_stage_sizes[i]);
+        dst = &d_scratch[i][0];
+      }
+
+      n = d_kernels[i](src, dst, n, d_args[i]);
+      if(n <= 0)
+        return n;
+
+      src = dst;
+    }
+
+    return n;
+  }
+
+} /* namespace gr */
@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_KERNEL_CHAIN_BLOCK_H
+#define INCLUDED_GR_RUNTIME_KERNEL_CHAIN_BLOCK_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/sync_block.h>
+#include <vector>
+
+namespace gr {
+
+  /*!
+   * \brief Composite block that runs the registered work kernels of a
+   * linear chain of 1:1 blocks back-to-back.
+   * \ingroup internal
+   *
+   * Built by flat_flowgraph::fuse_kernel_chains. The fused chain
+   * executes in one thread on one pass over the data, with small heap
+   * scratch buffers between stages, eliminating the ring buffers and
+   * thread handoffs of the interior edges. The original blocks are
+   * kept alive and their runtime setters keep working -- each kernel
+   * reads its state through the context pointer registered with
+   * block::set_work_kernel -- but the blocks themselves never
+   * execute, so their kernels must stay registered while the
+   * flowgraph runs.
+   */
+  class GR_RUNTIME_API kernel_chain_block : public sync_block
+  {
+  public:
+    typedef boost::shared_ptr<kernel_chain_block> sptr;
+
+    /*!
+     * \param chain the fused blocks, upstream first; every block must
+     *              have a registered work kernel.
+     */
+    static sptr make(const std::vector<block_sptr> &chain);
+
+    int work(int noutput_items,
+             gr_vector_const_void_star &input_items,
+             gr_vector_void_star &output_items);
+
+  private:
+    kernel_chain_block(const std::vector<block_sptr> &chain);
+
+    std::vector<block_sptr> d_chain;    // keeps the fused blocks alive
+    std::vector<block::work_kernel_t> d_kernels;
+    std::vector<void*> d_args;
+    std::vector<size_t> d_stage_sizes;  // itemsize out of each interior stage
+    std::vector<std::vector<char> > d_scratch;
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_KERNEL_CHAIN_BLOCK_H */
@@ -31,13 +31,40 @@
 #endif
 
 #include <gnuradio/logger.h>
+#include <gnuradio/prefs.h>
 #include <stdexcept>
 #include <algorithm>
+#include <string.h>
 
 
 #ifdef ENABLE_GR_LOG
 #ifdef HAVE_LOG4CPP
 
+// Fences and compare-and-swap for the async appender ring; without
+// them the appender falls back to a mutex around the index
+// arithmetic (same scheme as mpsc_queue.cc).
+#if defined(__GNUC__)
+#define GR_LOG_HAVE_ATOMICS 1
+static inline void log_fence() { __sync_synchronize(); }
+static inline bool log_cas(volatile size_t *p, size_t oldval, size_t newval)
+{
+  return __sync_bool_compare_and_swap(p, oldval, newval);
+}
+#elif defined(_MSC_VER)
+#define GR_LOG_HAVE_ATOMICS 1
+#include <intrin.h>
+#include <windows.h>
+static inline void log_fence() { _ReadWriteBarrier(); ::MemoryBarrier(); }
+static inline bool log_cas(volatile size_t *p, size_t oldval, size_t newval)
+{
+  return _InterlockedCompareExchangePointer((void * volatile *)p,
+                                            (void *)newval, (void *)oldval)
+    == (void *)oldval;
+}
+#else
+static inline void log_fence() { }
+#endif
+
 namespace gr {
 
   bool logger_config::logger_configured(false);
@@ -149,6 +176,182 @@ namespace gr {
     logger_configured = false;
   }
 
+  /************************ BEGIN ASYNC APPENDER ***********************/
+
+  static inline void
+  copy_truncated(char *dst, size_t dstlen, const std::string &src)
+  {
+    size_t n = std::min(src.size(), dstlen - 1);
+    memcpy(dst, src.data(), n);
+    dst[n] = '\0';
+  }
+
+  async_appender::async_appender(log4cpp::Appender *target, size_t capacity)
+    : log4cpp::AppenderSkeleton("async::" + target->getName()),
+      d_target(target), d_ndropped(0),
+      d_enqueue_pos(0), d_dequeue_pos(0),
+      d_finished(false)
+  {
+    size_t cap = 2;
+    while(cap < capacity)
+      cap *= 2;
+    d_mask = cap - 1;
+
+    d_buffer = new cell[cap];
+    for(size_t i = 0; i < cap; i++)
+      d_buffer[i].d_seq = i;
+
+    d_thread = new boost::thread(boost::bind(&async_appender::run, this));
+  }
+
+  async_appender::~async_appender()
+  {
+    close();
+    delete d_target;
+    delete[] d_buffer;
+  }
+
+  void
+  async_appender::_append(const log4cpp::LoggingEvent &event)
+  {
+    if(!try_insert(event))
+      d_ndropped++;	// full; never block the logging thread
+  }
+
+  bool
+  async_appender::try_insert(const log4cpp::LoggingEvent &event)
+  {
+#ifdef GR_LOG_HAVE_ATOMICS
+    for(;;) {
+      size_t pos = d_enqueue_pos;
+      cell *c = &d_buffer[pos & d_mask];
+      log_fence();
+      size_t seq = c->d_seq;
+      intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+      if(dif == 0) {
+        if(!log_cas(&d_enqueue_pos, pos, pos + 1))
+          continue;		// another producer claimed this cell
+        copy_truncated(c->d_category, sizeof(c->d_category),
+                       event.categoryName);
+        copy_truncated(c->d_message, sizeof(c->d_message), event.message);
+        c->d_priority = event.priority;
+        log_fence();
+        c->d_seq = pos + 1;	// hand the cell to the writer
+        return true;
+      }
+      if(dif < 0)
+        return false;		// the writer hasn't freed this cell: full
+      // dif > 0: raced; reload d_enqueue_pos
+    }
+#else
+    boost::mutex::scoped_lock guard(d_mutex);
+    size_t pos = d_enqueue_pos;
+    cell *c = &d_buffer[pos & d_mask];
+    if((intptr_t)c->d_seq - (intptr_t)pos != 0)
+      return false;
+    copy_truncated(c->d_category, sizeof(c->d_category), event.categoryName);
+    copy_truncated(c->d_message, sizeof(c->d_message), event.message);
+    c->d_priority = event.priority;
+    c->d_seq = pos + 1;
+    d_enqueue_pos = pos + 1;
+    return true;
+#endif
+  }
+
+  void
+  async_appender::run()
+  {
+    size_t reported_drops = 0;
+    boost::system_time next_report =
+      boost::get_system_time() + boost::posix_time::seconds(1);
+
+    try {
+      for(;;) {
+        bool idle = true;
+
+        // single consumer, so claiming the head cell needs no CAS
+        size_t pos = d_dequeue_pos;
+        cell *c = &d_buffer[pos & d_mask];
+        log_fence();
+        if((intptr_t)c->d_seq - (intptr_t)(pos + 1) == 0) {
+          log4cpp::LoggingEvent event(c->d_category, c->d_message, "",
+                                      c->d_priority);
+          log_fence();
+          c->d_seq = pos + d_mask + 1;	// hand the cell back to producers
+          d_dequeue_pos = pos + 1;
+
+          d_target->doAppend(event);
+          idle = false;
+        }
+
+        if(boost::get_system_time() >= next_report) {
+          next_report = boost::get_system_time() + boost::posix_time::seconds(1);
+          size_t dropped = d_ndropped;
+          if(dropped != reported_drops) {
+            log4cpp::LoggingEvent event(
+              getName(),
+              str(boost::format("dropped %d log messages")
+                  % (dropped - reported_drops)),
+              "", log4cpp::Priority::WARN);
+            d_target->doAppend(event);
+            reported_drops = dropped;
+          }
+        }
+
+        if(idle) {
+          if(d_finished)
+            return;		// queue drained; done
+          boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+        }
+      }
+    }
+    catch(boost::thread_interrupted&) {
+    }
+  }
+
+  bool
+  async_appender::reopen()
+  {
+    return d_target->reopen();
+  }
+
+  void
+  async_appender::close()
+  {
+    if(d_thread) {
+      d_finished = true;
+      d_thread->join();		// drains the queue on the way out
+      delete d_thread;
+      d_thread = 0;
+      d_target->close();
+    }
+  }
+
+  bool
+  async_appender::requiresLayout() const
+  {
+    return false;
+  }
+
+  void
+  async_appender::setLayout(log4cpp::Layout *layout)
+  {
+    d_target->setLayout(layout);
+  }
+
+  // Honor the [Log] async preference for a freshly built appender.
+  static log4cpp::Appender *
+  maybe_async(log4cpp::Appender *app)
+  {
+    prefs *p = prefs::singleton();
+    if(!p->get_bool("Log", "async", false))
+      return app;
+    return new async_appender(app, p->get_long("Log", "async_queue_depth", 1024));
+  }
+
+  /************************* END ASYNC APPENDER ************************/
+
   /***************** Functions to call log4cpp methods *************************/
 
   logger_ptr
@@ -250,7 +453,7 @@ namespace gr {
 
     layout->setConversionPattern(pattern);
     app->setLayout(layout);
-    logger->setAppender(app);
+    logger->setAppender(maybe_async(app));
   }
 
   void
@@ -263,7 +466,7 @@ namespace gr {
                             filename);
     layout->setConversionPattern(pattern);
     app->setLayout(layout);
-    logger->setAppender(app);
+    logger->setAppender(maybe_async(app));
   }
 
   void
@@ -277,7 +480,7 @@ namespace gr {
                                    filesize, bkup_index, append, mode);
     layout->setConversionPattern(pattern);
     app->setLayout(layout);
-    logger->setAppender(app);
+    logger->setAppender(maybe_async(app));
   }
 
   std::vector<std::string>
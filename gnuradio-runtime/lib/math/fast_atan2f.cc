@@ -199,4 +199,21 @@ namespace gr {
   #endif
   }
 
+  void
+  fast_atan2f_vec(const float *y, const float *x, float *out, int n)
+  {
+    // The calls inline within this translation unit, so a buffer is
+    // processed without the per-sample cross-library call that the
+    // scalar entry point costs its callers.
+    for(int i = 0; i < n; i++)
+      out[i] = fast_atan2f(y[i], x[i]);
+  }
+
+  void
+  fast_atan2f_vec(const gr_complex *in, float *out, int n)
+  {
+    for(int i = 0; i < n; i++)
+      out[i] = fast_atan2f(in[i].imag(), in[i].real());
+  }
+
 } /* namespace gr */
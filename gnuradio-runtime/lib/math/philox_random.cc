@@ -0,0 +1,182 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <gnuradio/philox_random.h>
+#include <cmath>
+#include <cstring>
+
+namespace gr {
+
+  // Philox-4x32 round constants (Salmon et al., "Parallel random
+  // numbers: as easy as 1, 2, 3", SC'11)
+  static const uint32_t PHILOX_M0 = 0xD2511F53;
+  static const uint32_t PHILOX_M1 = 0xCD9E8D57;
+  static const uint32_t PHILOX_W0 = 0x9E3779B9;
+  static const uint32_t PHILOX_W1 = 0xBB67AE85;
+
+  enum { CACHE_NONE, CACHE_UNIFORM, CACHE_GAUSSIAN };
+
+  philox_random::philox_random(uint64_t seed, uint64_t stream)
+  {
+    reseed(seed, stream);
+  }
+
+  void
+  philox_random::reseed(uint64_t seed, uint64_t stream)
+  {
+    d_key0 = (uint32_t)seed;
+    d_key1 = (uint32_t)(seed >> 32);
+    d_stream0 = (uint32_t)stream;
+    d_stream1 = (uint32_t)(stream >> 32);
+    d_counter = 0;
+    d_ncached = 0;
+    d_cache_type = CACHE_NONE;
+  }
+
+  void
+  philox_random::set_position(uint64_t counter)
+  {
+    d_counter = counter;
+    d_ncached = 0;
+    d_cache_type = CACHE_NONE;
+  }
+
+  void
+  philox_random::gen_block(uint32_t r[4])
+  {
+    uint32_t c0 = (uint32_t)d_counter;
+    uint32_t c1 = (uint32_t)(d_counter >> 32);
+    uint32_t c2 = d_stream0;
+    uint32_t c3 = d_stream1;
+    uint32_t k0 = d_key0;
+    uint32_t k1 = d_key1;
+
+    for(int round = 0; round < 10; round++) {
+      uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+      uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+      uint32_t hi0 = (uint32_t)(p0 >> 32), lo0 = (uint32_t)p0;
+      uint32_t hi1 = (uint32_t)(p1 >> 32), lo1 = (uint32_t)p1;
+
+      uint32_t n0 = hi1 ^ c1 ^ k0;
+      uint32_t n1 = lo1;
+      uint32_t n2 = hi0 ^ c3 ^ k1;
+      uint32_t n3 = lo0;
+      c0 = n0; c1 = n1; c2 = n2; c3 = n3;
+
+      k0 += PHILOX_W0;
+      k1 += PHILOX_W1;
+    }
+
+    r[0] = c0; r[1] = c1; r[2] = c2; r[3] = c3;
+    d_counter++;
+  }
+
+  void
+  philox_random::gen_uniform(float u[4])
+  {
+    // (x + 0.5) * 2^-32 keeps the result inside (0, 1), so the
+    // Box-Muller log never sees zero
+    uint32_t r[4];
+    gen_block(r);
+    for(int k = 0; k < 4; k++)
+      u[k] = ((float)r[k] + 0.5f) * (1.0f/4294967296.0f);
+  }
+
+  void
+  philox_random::uniform(float *out, int n)
+  {
+    int i = 0;
+
+    if(d_cache_type == CACHE_UNIFORM) {
+      while(d_ncached > 0 && i < n)
+        out[i++] = d_cache[4 - d_ncached--];
+    }
+
+    while(n - i >= 4) {
+      gen_uniform(&out[i]);
+      i += 4;
+    }
+
+    if(i < n) {
+      float u[4];
+      gen_uniform(u);
+      int left = n - i;
+      for(int k = 0; k < left; k++)
+        out[i + k] = u[k];
+      memcpy(d_cache, u, sizeof(u));
+      d_ncached = 4 - left;
+      d_cache_type = CACHE_UNIFORM;
+    }
+    else if(d_ncached == 0) {
+      d_cache_type = CACHE_NONE;
+    }
+  }
+
+  void
+  philox_random::gaussian(float *out, int n)
+  {
+    int i = 0;
+
+    if(d_cache_type == CACHE_GAUSSIAN) {
+      while(d_ncached > 0 && i < n)
+        out[i++] = d_cache[4 - d_ncached--];
+    }
+
+    float u[4];
+    while(n - i >= 4) {
+      gen_uniform(u);
+      // Box-Muller: each uniform pair makes one normal pair
+      for(int k = 0; k < 4; k += 2) {
+        float r = sqrtf(-2.0f*logf(u[k]));
+        float phi = 2.0f*(float)M_PI*u[k+1];
+        out[i + k]     = r*cosf(phi);
+        out[i + k + 1] = r*sinf(phi);
+      }
+      i += 4;
+    }
+
+    if(i < n) {
+      float g[4];
+      gen_uniform(u);
+      for(int k = 0; k < 4; k += 2) {
+        float r = sqrtf(-2.0f*logf(u[k]));
+        float phi = 2.0f*(float)M_PI*u[k+1];
+        g[k]     = r*cosf(phi);
+        g[k + 1] = r*sinf(phi);
+      }
+      int left = n - i;
+      for(int k = 0; k < left; k++)
+        out[i + k] = g[k];
+      memcpy(d_cache, g, sizeof(g));
+      d_ncached = 4 - left;
+      d_cache_type = CACHE_GAUSSIAN;
+    }
+    else if(d_ncached == 0) {
+      d_cache_type = CACHE_NONE;
+    }
+  }
+
+} /* namespace gr */
@@ -131,3 +131,27 @@ qa_fast_atan2f::t2()
   CPPUNIT_ASSERT(std::isnan(gr_atan2f));
 }
 
+void
+qa_fast_atan2f::t3()
+{
+  static const unsigned int N = 1000;
+  float ys[N], xs[N], out[N];
+  gr_complex cs[N];
+
+  for(unsigned int i = 0; i < N; i++) {
+    float phi = -M_PI + i*(2*M_PI/N);
+    ys[i] = 2.0*sinf(phi);
+    xs[i] = 2.0*cosf(phi);
+    cs[i] = gr_complex(xs[i], ys[i]);
+  }
+
+  /* The buffer version must agree with the scalar kernel exactly */
+  gr::fast_atan2f_vec(ys, xs, out, N);
+  for(unsigned int i = 0; i < N; i++)
+    CPPUNIT_ASSERT_EQUAL(gr::fast_atan2f(ys[i], xs[i]), out[i]);
+
+  gr::fast_atan2f_vec(cs, out, N);
+  for(unsigned int i = 0; i < N; i++)
+    CPPUNIT_ASSERT_EQUAL(gr::fast_atan2f(cs[i]), out[i]);
+}
+
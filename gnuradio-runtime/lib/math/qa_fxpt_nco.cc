@@ -112,6 +112,29 @@ qa_fxpt_nco::t1()
 void
 qa_fxpt_nco::t2()
 {
+  // The volk rotator path is a phasor recursion, so it is held to a
+  // looser tolerance than the table: float rounding accumulates over
+  // the kernel's 512-sample renormalization window.
+  static const float ROTATOR_TOLERANCE = 1e-3;
+
+  gr::fxpt_nco table_nco;
+  gr::fxpt_nco rot_nco;
+  gr_complex   table_block[SIN_COS_BLOCK_SIZE];
+  gr_complex   rot_block[SIN_COS_BLOCK_SIZE];
+
+  table_nco.set_freq((float)(2 * M_PI / SIN_COS_FREQ));
+  rot_nco.set_freq((float)(2 * M_PI / SIN_COS_FREQ));
+
+  table_nco.sincos(table_block, SIN_COS_BLOCK_SIZE, 0.5);
+  rot_nco.sincos_rotator(rot_block, SIN_COS_BLOCK_SIZE, 0.5);
+
+  for(int i = 0; i < SIN_COS_BLOCK_SIZE; i++) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(table_block[i].real(), rot_block[i].real(), ROTATOR_TOLERANCE);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(table_block[i].imag(), rot_block[i].imag(), ROTATOR_TOLERANCE);
+  }
+
+  // Both paths advance the same fixed point accumulator
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(table_nco.get_phase(), rot_nco.get_phase(), SIN_COS_TOLERANCE);
 }
 
 void
@@ -0,0 +1,125 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <qa_fxpt_sine_table.h>
+#include <gnuradio/fxpt_sine_table.h>
+#include <gnuradio/fxpt_nco.h>
+#include <gnuradio/fxpt.h>
+#include <cppunit/TestAssert.h>
+#include <math.h>
+
+static const float SIN_COS_TOLERANCE = 1e-5;
+
+void
+qa_fxpt_sine_table::t0()
+{
+  // a table with the stock segment density matches gr::fxpt's
+  // accuracy from a quarter of the memory
+  gr::fxpt_sine_table<10> table;
+
+  CPPUNIT_ASSERT_EQUAL(2048, gr::fxpt_sine_table<10>::table_bytes());
+
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( 0,           table.sin(0x00000000), SIN_COS_TOLERANCE);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( 0.707106781, table.sin(0x20000000), SIN_COS_TOLERANCE);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( 1,           table.sin(0x40000000), SIN_COS_TOLERANCE);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( 0.707106781, table.sin(0x60000000), SIN_COS_TOLERANCE);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( 0,           table.sin(0x7fffffff), SIN_COS_TOLERANCE);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( 0,           table.sin(0x80000000), SIN_COS_TOLERANCE);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(-1,           table.sin(-0x40000000), SIN_COS_TOLERANCE);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(-0.707106781, table.sin(-0x20000000), SIN_COS_TOLERANCE);
+
+  for(float p = -M_PI; p < M_PI; p += 2 * M_PI / 3600) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sin(p),
+                                 table.sin(gr::fxpt::float_to_fixed(p)),
+                                 SIN_COS_TOLERANCE);
+  }
+}
+
+void
+qa_fxpt_sine_table::t1()
+{
+  gr::fxpt_sine_table<10> table;
+
+  for(float p = -M_PI; p < M_PI; p += 2 * M_PI / 3600) {
+    float s, c;
+    table.sincos(gr::fxpt::float_to_fixed(p), &s, &c);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sin(p), s, SIN_COS_TOLERANCE);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(cos(p), c, SIN_COS_TOLERANCE);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(c, table.cos(gr::fxpt::float_to_fixed(p)),
+                                 SIN_COS_TOLERANCE);
+  }
+}
+
+void
+qa_fxpt_sine_table::t2()
+{
+  // a quarter-size table: error grows with the square of the
+  // segment width, so 16x the stock tolerance
+  gr::fxpt_sine_table<8> table;
+
+  CPPUNIT_ASSERT_EQUAL(512, gr::fxpt_sine_table<8>::table_bytes());
+
+  for(float p = -M_PI; p < M_PI; p += 2 * M_PI / 3600) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sin(p),
+                                 table.sin(gr::fxpt::float_to_fixed(p)),
+                                 1e-4);
+  }
+}
+
+void
+qa_fxpt_sine_table::t3()
+{
+  // undithered, the small NCO's error is bounded by half a table
+  // step; dithered it stays zero-mean noise of the same scale
+  gr::fxpt_nco_small<12> nco;
+  nco.set_freq(0.1234);
+  nco.set_dither(false);
+
+  const double step_error = M_PI / (1 << 11);
+
+  for(int i = 0; i < 10000; i++) {
+    float s, c;
+    nco.sincos(&s, &c);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sin(nco.get_phase()), s, step_error);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(cos(nco.get_phase()), c, step_error);
+    nco.step();
+  }
+
+  gr::fxpt_nco_small<12> dithered;
+  dithered.set_freq(0.1234);
+  CPPUNIT_ASSERT(dithered.dither());
+
+  double acc = 0;
+  const int n = 100000;
+  for(int i = 0; i < n; i++) {
+    float s, c;
+    dithered.sincos(&s, &c);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sin(dithered.get_phase()), s, 2 * step_error);
+    acc += s - sin(dithered.get_phase());
+    dithered.step();
+  }
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0, acc / n, 1e-4);
+}
@@ -61,8 +61,25 @@ qa_sincos::t2()
     c_cos = cosf(x);
     
     gr::sincosf(x, &gr_sin, &gr_cos);
-    
+
     CPPUNIT_ASSERT_DOUBLES_EQUAL(c_sin, gr_sin, 0.0001);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(c_cos, gr_cos, 0.0001);
   }
 }
+
+void
+qa_sincos::t3()
+{
+  static const unsigned int N = 1000;
+  float x[N], gr_sin[N], gr_cos[N];
+
+  for(unsigned i = 0; i < N; i++)
+    x[i] = -5.0 + i/100.0;
+
+  gr::sincosf_vec(x, gr_sin, gr_cos, N);
+
+  for(unsigned i = 0; i < N; i++) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sinf(x[i]), gr_sin[i], 0.0001);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(cosf(x[i]), gr_cos[i], 0.0001);
+  }
+}
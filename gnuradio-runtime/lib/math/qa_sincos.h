@@ -31,11 +31,13 @@ class qa_sincos : public CppUnit::TestCase
   CPPUNIT_TEST_SUITE(qa_sincos);
   CPPUNIT_TEST(t1);
   CPPUNIT_TEST(t2);
+  CPPUNIT_TEST(t3);
   CPPUNIT_TEST_SUITE_END();
-  
+
 private:
   void t1();
   void t2();
+  void t3();
 };
 
 #endif /* _QA_SINCOS_H_ */
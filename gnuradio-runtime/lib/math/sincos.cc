@@ -29,6 +29,7 @@
 #endif
 
 #include <gnuradio/sincos.h>
+#include <gnuradio/fxpt.h>
 #include <math.h>
 
 namespace gr {
@@ -82,4 +83,16 @@ namespace gr {
 
 #endif
 
+  // ----------------------------------------------------------------
+
+  void
+  sincosf_vec(const float *x, float *sinx, float *cosx, int n)
+  {
+    // The fxpt table kernel is branch-free per sample and avoids a
+    // libm call per point; its accuracy is the grade the NCO and VCO
+    // already run at.
+    for(int i = 0; i < n; i++)
+      fxpt::sincos(fxpt::float_to_fixed(x[i]), &sinx[i], &cosx[i]);
+  }
+
 } /* namespace gr */
@@ -0,0 +1,232 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/mpsc_queue.h>
+#include <boost/thread/thread.hpp>
+#include <algorithm>
+
+/*
+ * Pick up full fences and compare-and-swap where the compiler offers
+ * them.  Without them the queue degrades to taking d_mutex around the
+ * index arithmetic; the algorithm itself is unchanged.
+ */
+#if defined(__GNUC__)
+
+#define GR_MPSC_HAVE_ATOMICS 1
+
+static inline void
+mpsc_fence()
+{
+  __sync_synchronize();
+}
+
+static inline bool
+mpsc_cas(volatile size_t *p, size_t oldval, size_t newval)
+{
+  return __sync_bool_compare_and_swap(p, oldval, newval);
+}
+
+#elif defined(_MSC_VER)
+
+#define GR_MPSC_HAVE_ATOMICS 1
+#include <intrin.h>
+#include <windows.h>
+
+static inline void
+mpsc_fence()
+{
+  _ReadWriteBarrier();
+  ::MemoryBarrier();
+}
+
+static inline bool
+mpsc_cas(volatile size_t *p, size_t oldval, size_t newval)
+{
+  return _InterlockedCompareExchangePointer((void * volatile *)p,
+                                            (void *)newval, (void *)oldval)
+    == (void *)oldval;
+}
+
+#else
+
+static inline void
+mpsc_fence()
+{
+}
+
+// Only ever called with d_mutex held.
+static inline bool
+mpsc_cas(volatile size_t *p, size_t oldval, size_t newval)
+{
+  if(*p != oldval)
+    return false;
+  *p = newval;
+  return true;
+}
+
+#endif
+
+#ifdef GR_MPSC_HAVE_ATOMICS
+#define GR_MPSC_GUARD()
+#else
+#define GR_MPSC_GUARD() gr::thread::scoped_lock guard(d_mutex)
+#endif
+
+namespace gr {
+
+  static size_t
+  round_up_pow2(size_t n)
+  {
+    size_t v = 1;
+    while(v < n)
+      v <<= 1;
+    return v;
+  }
+
+  mpsc_queue::mpsc_queue(size_t capacity, overflow_policy policy)
+    : d_policy(policy), d_ndropped(0),
+      d_enqueue_pos(0), d_dequeue_pos(0)
+  {
+    size_t n = round_up_pow2(std::max(capacity, (size_t)2));
+    d_mask = n - 1;
+    d_buffer = new cell[n];
+    for(size_t i = 0; i < n; i++)
+      d_buffer[i].d_seq = i;
+  }
+
+  mpsc_queue::~mpsc_queue()
+  {
+    delete [] d_buffer;
+  }
+
+  bool
+  mpsc_queue::try_insert(const pmt::pmt_t &msg)
+  {
+    GR_MPSC_GUARD();
+
+    cell *c;
+    size_t pos = d_enqueue_pos;
+
+    for(;;) {
+      c = &d_buffer[pos & d_mask];
+      size_t seq = c->d_seq;
+      mpsc_fence();
+      intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+      if(dif == 0) {		// cell is ours if we can claim pos
+        if(mpsc_cas(&d_enqueue_pos, pos, pos + 1))
+          break;
+        pos = d_enqueue_pos;
+      }
+      else if(dif < 0)		// consumer hasn't released it: full
+        return false;
+      else			// another producer claimed it
+        pos = d_enqueue_pos;
+    }
+
+    c->d_value = msg;
+    mpsc_fence();
+    c->d_seq = pos + 1;		// hand the cell to the consumer
+    return true;
+  }
+
+  void
+  mpsc_queue::insert_tail(const pmt::pmt_t &msg)
+  {
+    if(try_insert(msg))		// fast path
+      return;
+
+    if(d_policy == DROP_OLDEST) {
+      // Make room by discarding from the head.  This is the one spot
+      // where a producer acts as a consumer, which is why the dequeue
+      // side is written multi-consumer safe.
+      while(!try_insert(msg)) {
+        if(delete_head_nowait())
+          d_ndropped++;		// advisory; not atomic
+      }
+    }
+    else {			// BLOCK
+      while(!try_insert(msg))
+        boost::this_thread::yield();
+    }
+  }
+
+  pmt::pmt_t
+  mpsc_queue::delete_head_nowait()
+  {
+    GR_MPSC_GUARD();
+
+    cell *c;
+    size_t pos = d_dequeue_pos;
+
+    for(;;) {
+      c = &d_buffer[pos & d_mask];
+      size_t seq = c->d_seq;
+      mpsc_fence();
+      intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+
+      if(dif == 0) {		// cell is filled; claim it
+        if(mpsc_cas(&d_dequeue_pos, pos, pos + 1))
+          break;
+        pos = d_dequeue_pos;
+      }
+      else if(dif < 0)		// producer hasn't filled it: empty
+        return pmt::pmt_t();
+      else			// another dequeuer claimed it
+        pos = d_dequeue_pos;
+    }
+
+    pmt::pmt_t msg = c->d_value;
+    c->d_value = pmt::pmt_t();	// drop the queue's reference
+    mpsc_fence();
+    c->d_seq = pos + d_mask + 1; // hand the cell back to producers
+    return msg;
+  }
+
+  size_t
+  mpsc_queue::delete_all_nowait(std::vector<pmt::pmt_t> &msgs)
+  {
+    size_t n = 0;
+    pmt::pmt_t msg;
+
+    // One claim per message; the batching win is on the caller's
+    // side, which makes a single handler call for the whole drain.
+    while((msg = delete_head_nowait())) {
+      msgs.push_back(msg);
+      n++;
+    }
+    return n;
+  }
+
+  size_t
+  mpsc_queue::count() const
+  {
+    size_t tail = d_dequeue_pos;
+    size_t head = d_enqueue_pos;
+    return (head > tail) ? head - tail : 0;
+  }
+
+} /* namespace gr */
@@ -31,6 +31,43 @@
 #include <pmt/pmt_pool.h>
 #include <stdio.h>
 #include <string.h>
+#include <assert.h>
+#include <boost/thread/mutex.hpp>
+
+/*
+ * Fence and pointer compare-and-swap used by the lock-free symbol
+ * lookup paths.  Platforms without them simply take the symbol table
+ * mutex on every lookup.
+ */
+#if defined(__GNUC__)
+#define PMT_SYMBOL_HAVE_ATOMICS 1
+static inline void symbol_fence() { __sync_synchronize(); }
+static inline bool
+symbol_cas(const char *volatile *p, const char *oldval, const char *newval)
+{
+  return __sync_bool_compare_and_swap(p, oldval, newval);
+}
+#elif defined(_MSC_VER)
+#define PMT_SYMBOL_HAVE_ATOMICS 1
+#include <intrin.h>
+#include <windows.h>
+static inline void symbol_fence() { _ReadWriteBarrier(); ::MemoryBarrier(); }
+static inline bool
+symbol_cas(const char *volatile *p, const char *oldval, const char *newval)
+{
+  return _InterlockedCompareExchangePointer((void *volatile *)p,
+					    (void *)newval, (void *)oldval)
+    == (void *)oldval;
+}
+#else
+#define PMT_SYMBOL_HAVE_ATOMICS 0
+static inline void symbol_fence() { }
+static inline bool
+symbol_cas(const char *volatile *p, const char *oldval, const char *newval)
+{
+  return false;
+}
+#endif
 
 namespace pmt {
 
@@ -38,12 +75,95 @@ static const int CACHE_LINE_SIZE = 64;		// good guess
 
 # if (PMT_LOCAL_ALLOCATOR)
 
-static pmt_pool global_pmt_pool(sizeof(pmt_pair), CACHE_LINE_SIZE);
+/*
+ * All pmts are carved out of fixed-size pool items (pmt_pair is the
+ * most common type and, padded to a cache line, also holds the other
+ * small ones).  A per-thread free list sits in front of the shared
+ * pool so that the fast path of operator new/delete -- and thus of
+ * cons, mp and friends -- takes no lock; items move between the
+ * thread caches and the mutex-guarded pool a chain at a time.
+ */
+
+static const size_t THREAD_CACHE_REFILL = 64;	// items fetched when empty
+static const size_t THREAD_CACHE_MAX = 256;	// items held before draining
+
+static pmt_pool &
+the_pmt_pool()
+{
+  // Deliberately never destroyed: the thread caches drain into it
+  // from thread-exit handlers that may run after static destructors.
+  static pmt_pool *pool = new pmt_pool(sizeof(pmt_pair), CACHE_LINE_SIZE);
+  return *pool;
+}
+
+class pmt_thread_cache {
+public:
+  pmt_thread_cache() : d_freelist(0), d_n_items(0) {}
+
+  ~pmt_thread_cache()
+  {
+    the_pmt_pool().free_chain(d_freelist, d_n_items);
+  }
+
+  void *malloc()
+  {
+    if (!d_freelist){
+      d_freelist = (item *) the_pmt_pool().malloc_chain(THREAD_CACHE_REFILL);
+      d_n_items = THREAD_CACHE_REFILL;
+    }
+    item *p = d_freelist;
+    d_freelist = p->d_next;
+    d_n_items--;
+    return p;
+  }
+
+  void free(void *foo)
+  {
+    if (d_n_items >= THREAD_CACHE_MAX){
+      // Give half back so a thread that mostly frees (e.g. a message
+      // sink) doesn't hoard what its producers keep allocating.
+      item *head = d_freelist;
+      item *p = head;
+      for (size_t i = 1; i < THREAD_CACHE_MAX / 2; i++)
+	p = p->d_next;
+      d_freelist = p->d_next;
+      p->d_next = 0;
+      the_pmt_pool().free_chain(head, THREAD_CACHE_MAX / 2);
+      d_n_items -= THREAD_CACHE_MAX / 2;
+    }
+    item *p = (item *) foo;
+    p->d_next = d_freelist;
+    d_freelist = p;
+    d_n_items++;
+  }
+
+private:
+  struct item { item *d_next; };
+
+  item	 *d_freelist;
+  size_t  d_n_items;
+};
+
+static boost::thread_specific_ptr<pmt_thread_cache> s_thread_cache;
+
+static inline pmt_thread_cache *
+thread_cache()
+{
+  pmt_thread_cache *c = s_thread_cache.get();
+  if (!c){
+    c = new pmt_thread_cache();
+    s_thread_cache.reset(c);
+  }
+  return c;
+}
 
 void *
 pmt_base::operator new(size_t size)
 {
-  void *p = global_pmt_pool.malloc();
+  if (size > CACHE_LINE_SIZE)	// doesn't fit a pool item; rare
+    return ::operator new(size);
+
+  void *p = thread_cache()->malloc();
 
   // fprintf(stderr, "pmt_base::new p = %p\n", p);
   assert((reinterpret_cast<intptr_t>(p) & (CACHE_LINE_SIZE - 1)) == 0);
@@ -53,7 +173,11 @@ pmt_base::operator new(size_t size)
 void
 pmt_base::operator delete(void *p, size_t size)
 {
-  global_pmt_pool.free(p);
+  if (size > CACHE_LINE_SIZE){
+    ::operator delete(p);
+    return;
+  }
+  thread_cache()->free(p);
 }
 
 #endif
@@ -208,7 +332,8 @@ to_bool(pmt_t val)
 ////////////////////////////////////////////////////////////////////////////
 
 static const unsigned int SYMBOL_HASH_TABLE_SIZE = 701;
-static std::vector<pmt_t> s_symbol_hash_table(SYMBOL_HASH_TABLE_SIZE);
+static pmt_symbol *volatile s_symbol_hash_table[SYMBOL_HASH_TABLE_SIZE];
+static boost::mutex s_symbol_table_mutex;	// serializes inserts only
 
 pmt_symbol::pmt_symbol(const std::string &name) : d_name(name){}
 
@@ -241,16 +366,33 @@ string_to_symbol(const std::string &name)
 {
   unsigned hash = hash_string(name) % SYMBOL_HASH_TABLE_SIZE;
 
-  // Does a symbol with this name already exist?
-  for (pmt_t sym = s_symbol_hash_table[hash]; sym; sym = _symbol(sym)->next()){
-    if (name == _symbol(sym)->name())
-      return sym;		// Yes.  Return it
+#if PMT_SYMBOL_HAVE_ATOMICS
+  // Lookups run without the lock.  Buckets only ever gain entries, a
+  // symbol's name and chain link are immutable by the time its bucket
+  // head is swung over to it, and the table's reference keeps every
+  // symbol alive for the life of the process, so a chain walked from a
+  // head pointer read at any instant stays valid under concurrent
+  // interns.
+  for (pmt_symbol *sym = s_symbol_hash_table[hash]; sym; sym = sym->next_symbol()){
+    if (name == sym->name())
+      return pmt_t(sym);		// Yes.  Return it
+  }
+#endif
+
+  boost::mutex::scoped_lock guard(s_symbol_table_mutex);
+
+  // Did another thread intern it since our unlocked scan?
+  for (pmt_symbol *sym = s_symbol_hash_table[hash]; sym; sym = sym->next_symbol()){
+    if (name == sym->name())
+      return pmt_t(sym);
   }
 
   // Nope.  Make a new one.
   pmt_t sym = pmt_t(new pmt_symbol(name));
-  _symbol(sym)->set_next(s_symbol_hash_table[hash]);
-  s_symbol_hash_table[hash] = sym;
+  _symbol(sym)->set_next(pmt_t(s_symbol_hash_table[hash]));
+  intrusive_ptr_add_ref(sym.get());	// the table's own (never released) reference
+  symbol_fence();			// build the node before publishing it
+  s_symbol_hash_table[hash] = _symbol(sym);
   return sym;
 }
 
@@ -261,6 +403,57 @@ intern(const std::string &name)
   return string_to_symbol(name);
 }
 
+/*
+ * Per-call-site cache behind PMT_SYMBOL.  Hot symbols are string
+ * literals, and a literal's address is a stable identity for its call
+ * site, so a small open-addressed table maps the address straight to
+ * the interned symbol without hashing or comparing the characters
+ * again.  Slots are claimed with a compare-and-swap and published
+ * behind a fence; entries are never removed.
+ */
+static const size_t SYMBOL_LITERAL_CACHE_SIZE = 1024;	// power of 2
+
+struct symbol_literal_slot {
+  const char *volatile key;
+  pmt_symbol *sym;
+};
+
+static symbol_literal_slot s_symbol_literal_cache[SYMBOL_LITERAL_CACHE_SIZE];
+static char s_symbol_literal_busy;	// sentinel key while a slot is being filled
+
+pmt_t
+intern_literal(const char *name)
+{
+#if PMT_SYMBOL_HAVE_ATOMICS
+  size_t h = (size_t)name / sizeof(void *);	// literals share alignment
+
+  for (unsigned int probe = 0; probe < 8; probe++){
+    symbol_literal_slot *slot =
+      &s_symbol_literal_cache[(h + probe) % SYMBOL_LITERAL_CACHE_SIZE];
+    const char *key = slot->key;
+
+    if (key == name)
+      return pmt_t(slot->sym);
+
+    if (key == 0){
+      // Not cached yet; intern it and try to claim the slot.
+      pmt_t sym = string_to_symbol(name);
+      if (symbol_cas(&slot->key, 0, &s_symbol_literal_busy)){
+	slot->sym = _symbol(sym);
+	intrusive_ptr_add_ref(slot->sym);	// cache's own (never released) reference
+	symbol_fence();				// fill the slot before publishing the key
+	slot->key = name;
+      }
+      return sym;
+    }
+    // slot belongs to some other literal (or is mid-fill); probe onward
+  }
+#endif
+
+  // cache full around this address (or no atomics); still correct
+  return string_to_symbol(name);
+}
+
 const std::string
 symbol_to_string(const pmt_t& sym)
 {
@@ -288,6 +481,31 @@ is_number(pmt_t x)
 
 pmt_integer::pmt_integer(long value) : d_value(value) {}
 
+/*
+ * Immortal interned cells for the integers that dominate tag and
+ * message traffic (lengths, counts, port and stream indices).  The
+ * cells are built once at static-init time with an extra reference so
+ * they are never returned to the allocator; for values in range
+ * from_long is a table load instead of an allocation.  The cells are
+ * ordinary pmt_integers, so to_long and friends are unaffected.
+ */
+static const long SMALL_INT_MIN = -16;
+static const long SMALL_INT_MAX = 255;
+static pmt_integer *s_small_int[SMALL_INT_MAX - SMALL_INT_MIN + 1];
+static bool s_small_int_ready = false;
+
+static struct small_int_initializer {
+  small_int_initializer()
+  {
+    for (long i = SMALL_INT_MIN; i <= SMALL_INT_MAX; i++){
+      pmt_integer *p = new pmt_integer(i);
+      intrusive_ptr_add_ref(p);		// never dies
+      s_small_int[i - SMALL_INT_MIN] = p;
+    }
+    s_small_int_ready = true;
+  }
+} s_small_int_init;
+
 bool
 is_integer(pmt_t x)
 {
@@ -298,6 +516,9 @@ is_integer(pmt_t x)
 pmt_t
 from_long(long x)
 {
+  // the ready flag covers calls from other static initializers
+  if (s_small_int_ready && x >= SMALL_INT_MIN && x <= SMALL_INT_MAX)
+    return pmt_t(s_small_int[x - SMALL_INT_MIN]);
   return pmt_t(new pmt_integer(x));
 }
 
@@ -351,6 +572,42 @@ to_uint64(pmt_t x)
 
 pmt_real::pmt_real(double value) : d_value(value) {}
 
+/*
+ * from_double is the hottest PMT constructor in receive chains: every
+ * rx_freq / rx_rate / rx_time tag carries one, and the same handful
+ * of values repeats millions of times.  A small per-thread
+ * direct-mapped cache keyed on the bit pattern hands back the
+ * previously built (immutable) cell instead of allocating a fresh
+ * one.  Keying on the bits rather than the value keeps -0.0 and NaN
+ * payloads exact.
+ */
+static const size_t DOUBLE_CACHE_SIZE = 16;	// power of 2
+
+class pmt_double_cache {
+public:
+  pmt_t lookup(double x)
+  {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    entry &e = d_entry[(size_t)((bits ^ (bits >> 32)) & (DOUBLE_CACHE_SIZE - 1))];
+    if (e.d_cell && e.d_bits == bits)
+      return e.d_cell;
+    e.d_cell = pmt_t(new pmt_real(x));
+    e.d_bits = bits;
+    return e.d_cell;
+  }
+
+private:
+  struct entry {
+    uint64_t	d_bits;
+    pmt_t	d_cell;
+  };
+
+  entry d_entry[DOUBLE_CACHE_SIZE];
+};
+
+static boost::thread_specific_ptr<pmt_double_cache> s_double_cache;
+
 bool
 is_real(pmt_t x)
 {
@@ -360,7 +617,12 @@ is_real(pmt_t x)
 pmt_t
 from_double(double x)
 {
-  return pmt_t(new pmt_real(x));
+  pmt_double_cache *c = s_double_cache.get();
+  if (!c){
+    c = new pmt_double_cache();
+    s_double_cache.reset(c);
+  }
+  return c->lookup(x);
 }
 
 double
@@ -1075,6 +1337,12 @@ equal(const pmt_t& x, const pmt_t& y)
   return false;
 }
 
+bool
+is_unique(const pmt_t& obj)
+{
+  return obj->use_count() == 1;
+}
+
 size_t
 length(const pmt_t& x)
 {
@@ -32,7 +32,7 @@
  * See pmt.h for the public interface
  */
 
-#define PMT_LOCAL_ALLOCATOR 0		// define to 0 or 1
+#define PMT_LOCAL_ALLOCATOR 1		// define to 0 or 1
 namespace pmt {
 
 class PMT_API pmt_base : boost::noncopyable {
@@ -71,6 +71,8 @@ public:
   virtual bool is_c32vector() const { return false; }
   virtual bool is_c64vector() const { return false; }
 
+  long use_count() const { return count_; }
+
   friend void intrusive_ptr_add_ref(pmt_base* p);
   friend void intrusive_ptr_release(pmt_base* p);
 
@@ -104,6 +106,10 @@ public:
 
   pmt_t next() { return d_next; }		// symbol table link
   void set_next(pmt_t next) { d_next = next; }
+
+  // chain walk without reference count traffic; d_next is immutable
+  // once the symbol is published in the table
+  pmt_symbol *next_symbol() { return static_cast<pmt_symbol*>(d_next.get()); }
 };
 
 class pmt_integer : public pmt_base
@@ -52,17 +52,11 @@ pmt_pool::~pmt_pool()
   }
 }
 
-void *
-pmt_pool::malloc()
+pmt_pool::item *
+pmt_pool::alloc_one()
 {
-  scoped_lock guard(d_mutex);
   item *p;
 
-  if (d_max_items != 0){
-    while (d_n_items >= d_max_items)
-      d_cond.wait(guard);
-  }
-
   if (d_freelist){	// got something?
     p = d_freelist;
     d_freelist = p->d_next;
@@ -94,6 +88,37 @@ pmt_pool::malloc()
   return p;
 }
 
+void *
+pmt_pool::malloc()
+{
+  scoped_lock guard(d_mutex);
+
+  if (d_max_items != 0){
+    while (d_n_items >= d_max_items)
+      d_cond.wait(guard);
+  }
+
+  return alloc_one();
+}
+
+void *
+pmt_pool::malloc_chain(size_t n)
+{
+  scoped_lock guard(d_mutex);
+  item *head = 0;
+
+  for (size_t i = 0; i < n; i++){
+    if (d_max_items != 0){
+      while (d_n_items >= d_max_items)
+	d_cond.wait(guard);
+    }
+    item *p = alloc_one();
+    p->d_next = head;
+    head = p;
+  }
+  return head;
+}
+
 void
 pmt_pool::free(void *foo)
 {
@@ -110,4 +135,24 @@ pmt_pool::free(void *foo)
     d_cond.notify_one();
 }
 
+void
+pmt_pool::free_chain(void *head, size_t n)
+{
+  if (!head)
+    return;
+
+  scoped_lock guard(d_mutex);
+
+  item *p = (item *) head;
+  while (p){
+    item *next = p->d_next;
+    p->d_next = d_freelist;
+    d_freelist = p;
+    p = next;
+  }
+  d_n_items -= n;
+  if (d_max_items != 0)
+    d_cond.notify_all();
+}
+
 } /* namespace pmt */
@@ -24,6 +24,7 @@
 #endif
 
 #include <vector>
+#include <algorithm>
 #include <pmt/pmt.h>
 #include "pmt_int.h"
 #include "pmt/pmt_serial_tags.h"
@@ -94,6 +95,135 @@ serialize_untagged_u64(uint64_t i, std::streambuf &sb)
   return sb.sputc((i >> 0) & 0xff) != std::streambuf::traits_type::eof();
 }
 
+// ----------------------------------------------------------------
+// bulk primitives
+//
+// Stage the big-endian wire form of whole arrays through a chunk
+// buffer so a uniform vector costs a few sputn/sgetn calls instead
+// of one virtual streambuf call per byte.
+// ----------------------------------------------------------------
+
+static const size_t WIRE_CHUNK_ITEMS = 512;
+
+static bool
+serialize_untagged_u8_array(const uint8_t *p, size_t n, std::streambuf &sb)
+{
+  // u8 needs no conversion; hand the payload straight to the stream
+  return sb.sputn((const char *)p, n) == (std::streamsize)n;
+}
+
+static bool
+serialize_untagged_u16_array(const uint16_t *p, size_t n, std::streambuf &sb)
+{
+  char buf[2 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    char *q = buf;
+    for(size_t i = 0; i < chunk; i++) {
+      *q++ = (p[i] >> 8) & 0xff;
+      *q++ = (p[i] >> 0) & 0xff;
+    }
+    if(sb.sputn(buf, q - buf) != q - buf)
+      return false;
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+static bool
+serialize_untagged_u32_array(const uint32_t *p, size_t n, std::streambuf &sb)
+{
+  char buf[4 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    char *q = buf;
+    for(size_t i = 0; i < chunk; i++) {
+      *q++ = (p[i] >> 24) & 0xff;
+      *q++ = (p[i] >> 16) & 0xff;
+      *q++ = (p[i] >>  8) & 0xff;
+      *q++ = (p[i] >>  0) & 0xff;
+    }
+    if(sb.sputn(buf, q - buf) != q - buf)
+      return false;
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+static bool
+serialize_untagged_u64_array(const uint64_t *p, size_t n, std::streambuf &sb)
+{
+  char buf[8 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    char *q = buf;
+    for(size_t i = 0; i < chunk; i++) {
+      for(int shift = 56; shift >= 0; shift -= 8)
+	*q++ = (p[i] >> shift) & 0xff;
+    }
+    if(sb.sputn(buf, q - buf) != q - buf)
+      return false;
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+static bool
+serialize_untagged_f64_array(const double *p, size_t n, std::streambuf &sb)
+{
+  typedef union {
+    double id;
+    uint64_t ii;
+  } iu_t;
+
+  char buf[8 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    char *q = buf;
+    for(size_t i = 0; i < chunk; i++) {
+      iu_t iu;
+      iu.id = p[i];
+      for(int shift = 56; shift >= 0; shift -= 8)
+	*q++ = (iu.ii >> shift) & 0xff;
+    }
+    if(sb.sputn(buf, q - buf) != q - buf)
+      return false;
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+// floats are widened to f64 on the wire
+static bool
+serialize_untagged_f32_array(const float *p, size_t n, std::streambuf &sb)
+{
+  typedef union {
+    double id;
+    uint64_t ii;
+  } iu_t;
+
+  char buf[8 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    char *q = buf;
+    for(size_t i = 0; i < chunk; i++) {
+      iu_t iu;
+      iu.id = p[i];
+      for(int shift = 56; shift >= 0; shift -= 8)
+	*q++ = (iu.ii >> shift) & 0xff;
+    }
+    if(sb.sputn(buf, q - buf) != q - buf)
+      return false;
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
 // ----------------------------------------------------------------
 // input primitives
 // ----------------------------------------------------------------
@@ -214,6 +344,137 @@ deserialize_untagged_f64(double *ip, std::streambuf &sb)
   return t != std::streambuf::traits_type::eof();
 }
 
+static bool
+deserialize_untagged_u8_array(uint8_t *p, size_t n, std::streambuf &sb)
+{
+  // read straight into the vector's storage; no per-byte calls and
+  // no intermediate copy
+  return sb.sgetn((char *)p, n) == (std::streamsize)n;
+}
+
+static bool
+deserialize_untagged_u16_array(uint16_t *p, size_t n, std::streambuf &sb)
+{
+  char buf[2 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    std::streamsize nbytes = 2 * chunk;
+    if(sb.sgetn(buf, nbytes) != nbytes)
+      return false;
+    const unsigned char *q = (const unsigned char *)buf;
+    for(size_t i = 0; i < chunk; i++) {
+      p[i] = ((uint16_t)q[0] << 8) | q[1];
+      q += 2;
+    }
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+static bool
+deserialize_untagged_u32_array(uint32_t *p, size_t n, std::streambuf &sb)
+{
+  char buf[4 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    std::streamsize nbytes = 4 * chunk;
+    if(sb.sgetn(buf, nbytes) != nbytes)
+      return false;
+    const unsigned char *q = (const unsigned char *)buf;
+    for(size_t i = 0; i < chunk; i++) {
+      p[i] = ((uint32_t)q[0] << 24) | ((uint32_t)q[1] << 16)
+	| ((uint32_t)q[2] << 8) | q[3];
+      q += 4;
+    }
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+static bool
+deserialize_untagged_u64_array(uint64_t *p, size_t n, std::streambuf &sb)
+{
+  char buf[8 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    std::streamsize nbytes = 8 * chunk;
+    if(sb.sgetn(buf, nbytes) != nbytes)
+      return false;
+    const unsigned char *q = (const unsigned char *)buf;
+    for(size_t i = 0; i < chunk; i++) {
+      uint64_t v = 0;
+      for(int k = 0; k < 8; k++)
+	v = (v << 8) | q[k];
+      p[i] = v;
+      q += 8;
+    }
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+static bool
+deserialize_untagged_f64_array(double *p, size_t n, std::streambuf &sb)
+{
+  typedef union {
+    double id;
+    uint64_t ii;
+  } iu_t;
+
+  char buf[8 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    std::streamsize nbytes = 8 * chunk;
+    if(sb.sgetn(buf, nbytes) != nbytes)
+      return false;
+    const unsigned char *q = (const unsigned char *)buf;
+    for(size_t i = 0; i < chunk; i++) {
+      iu_t iu;
+      iu.ii = 0;
+      for(int k = 0; k < 8; k++)
+	iu.ii = (iu.ii << 8) | q[k];
+      p[i] = iu.id;
+      q += 8;
+    }
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
+// floats travel as f64 on the wire
+static bool
+deserialize_untagged_f32_array(float *p, size_t n, std::streambuf &sb)
+{
+  typedef union {
+    double id;
+    uint64_t ii;
+  } iu_t;
+
+  char buf[8 * WIRE_CHUNK_ITEMS];
+  while(n > 0) {
+    size_t chunk = std::min(n, WIRE_CHUNK_ITEMS);
+    std::streamsize nbytes = 8 * chunk;
+    if(sb.sgetn(buf, nbytes) != nbytes)
+      return false;
+    const unsigned char *q = (const unsigned char *)buf;
+    for(size_t i = 0; i < chunk; i++) {
+      iu_t iu;
+      iu.ii = 0;
+      for(int k = 0; k < 8; k++)
+	iu.ii = (iu.ii << 8) | q[k];
+      p[i] = static_cast<float>(iu.id);
+      q += 8;
+    }
+    p += chunk;
+    n -= chunk;
+  }
+  return true;
+}
+
 static bool
 deserialize_tuple(pmt_t *tuple, std::streambuf &sb)
 {
@@ -261,8 +522,7 @@ serialize(pmt_t obj, std::streambuf &sb)
     size_t len = s.size();
     ok = serialize_untagged_u8(PST_SYMBOL, sb);
     ok &= serialize_untagged_u16(len, sb);
-    for(size_t i = 0; i < len; i++)
-      ok &= serialize_untagged_u8(s[i], sb);
+    ok &= sb.sputn(s.data(), len) == (std::streamsize)len;
     return ok;
   }
 
@@ -334,9 +594,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u8(u8vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const uint8_t *data = u8vector_elements(obj, len);
+      ok &= serialize_untagged_u8_array(data, vec_len, sb);
       return ok;
     }
 
@@ -348,9 +608,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u8(s8vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const int8_t *data = s8vector_elements(obj, len);
+      ok &= serialize_untagged_u8_array((const uint8_t *)data, vec_len, sb);
       return ok;
     }
 
@@ -362,9 +622,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u16(u16vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const uint16_t *data = u16vector_elements(obj, len);
+      ok &= serialize_untagged_u16_array(data, vec_len, sb);
       return ok;
     }
 
@@ -376,9 +636,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u16(s16vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const int16_t *data = s16vector_elements(obj, len);
+      ok &= serialize_untagged_u16_array((const uint16_t *)data, vec_len, sb);
       return ok;
     }
 
@@ -390,9 +650,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u32(u32vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const uint32_t *data = u32vector_elements(obj, len);
+      ok &= serialize_untagged_u32_array(data, vec_len, sb);
       return ok;
     }
 
@@ -404,9 +664,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u32(s32vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const int32_t *data = s32vector_elements(obj, len);
+      ok &= serialize_untagged_u32_array((const uint32_t *)data, vec_len, sb);
       return ok;
     }
 
@@ -418,9 +678,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u64(u64vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const uint64_t *data = u64vector_elements(obj, len);
+      ok &= serialize_untagged_u64_array(data, vec_len, sb);
       return ok;
     }
 
@@ -432,9 +692,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_u64(s64vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const int64_t *data = s64vector_elements(obj, len);
+      ok &= serialize_untagged_u64_array((const uint64_t *)data, vec_len, sb);
       return ok;
     }
 
@@ -446,9 +706,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_f64(f32vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const float *data = f32vector_elements(obj, len);
+      ok &= serialize_untagged_f32_array(data, vec_len, sb);
       return ok;
     }
 
@@ -460,9 +720,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	ok &= serialize_untagged_f64(f64vector_ref(obj, i), sb);
-      }
+      size_t len;
+      const double *data = f64vector_elements(obj, len);
+      ok &= serialize_untagged_f64_array(data, vec_len, sb);
       return ok;
     }
 
@@ -474,11 +734,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	std::complex<float> c = c32vector_ref(obj, i);
-	ok &= serialize_untagged_f64(c.real(), sb);
-	ok &= serialize_untagged_f64(c.imag(), sb);
-      }
+      size_t len;
+      const std::complex<float> *data = c32vector_elements(obj, len);
+      ok &= serialize_untagged_f32_array((const float *)data, 2 * vec_len, sb);
       return ok;
     }
 
@@ -490,11 +748,9 @@ serialize(pmt_t obj, std::streambuf &sb)
       for(size_t i=0; i<npad; i++) {
 	ok &= serialize_untagged_u8(0, sb);
       }
-      for(size_t i=0; i<vec_len; i++) {
-	std::complex<double> c = c64vector_ref(obj, i);
-	ok &= serialize_untagged_f64(c.real(), sb);
-	ok &= serialize_untagged_f64(c.imag(), sb);
-      }
+      size_t len;
+      const std::complex<double> *data = c64vector_elements(obj, len);
+      ok &= serialize_untagged_f64_array((const double *)data, 2 * vec_len, sb);
       return ok;
     }
   }
@@ -623,118 +879,100 @@ deserialize(std::streambuf &sb)
       case(UVI_U8):
 	{
 	  pmt_t vec = make_u8vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u8(&u8, sb);
-	    u8vector_set(vec, i, u8);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u8_array(u8vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_S8):
 	{
 	  pmt_t vec = make_s8vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u8(&u8, sb);
-	    s8vector_set(vec, i, u8);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u8_array((uint8_t *)s8vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_U16):
 	{
 	  pmt_t vec = make_u16vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u16(&u16, sb);
-	    u16vector_set(vec, i, u16);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u16_array(u16vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_S16):
 	{
 	  pmt_t vec = make_s16vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u16(&u16, sb);
-	    s16vector_set(vec, i, u16);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u16_array((uint16_t *)s16vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_U32):
 	{
 	  pmt_t vec = make_u32vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u32(&u32, sb);
-	    u32vector_set(vec, i, u32);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u32_array(u32vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_S32):
 	{
 	  pmt_t vec = make_s32vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u32(&u32, sb);
-	    s32vector_set(vec, i, u32);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u32_array((uint32_t *)s32vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_U64):
 	{
 	  pmt_t vec = make_u64vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u64(&u64, sb);
-	    u64vector_set(vec, i, u64);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u64_array(u64vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_S64):
 	{
 	  pmt_t vec = make_s64vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_u64(&u64, sb);
-	    s64vector_set(vec, i, u64);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_u64_array((uint64_t *)s64vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_F32):
 	{
 	  pmt_t vec = make_f32vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_f64(&f64, sb);
-	    f32vector_set(vec, i, static_cast<float>(f64));
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_f32_array(f32vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_F64):
 	{
 	  pmt_t vec = make_f64vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    deserialize_untagged_f64(&f64, sb);
-	    f64vector_set(vec, i, f64);
-	  }
+	  size_t len;
+	  if(!deserialize_untagged_f64_array(f64vector_writable_elements(vec, len), nitems, sb))
+	    goto error;
 	  return vec;
 	}
       case(UVI_C32):
 	{
 	  pmt_t vec = make_c32vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    float re, im;
-	    deserialize_untagged_f64(&f64, sb);
-	    re = static_cast<float>(f64);
-	    deserialize_untagged_f64(&f64, sb);
-	    im = static_cast<float>(f64);
-	    c32vector_set(vec, i, std::complex<float>(re, im));
-	  }
+	  size_t len;
+	  float *data = (float *)c32vector_writable_elements(vec, len);
+	  if(!deserialize_untagged_f32_array(data, 2 * (size_t)nitems, sb))
+	    goto error;
 	  return vec;
 	}
 
       case(UVI_C64):
 	{
 	  pmt_t vec = make_c64vector(nitems, 0);
-	  for(uint32_t i=0; i<nitems; i++) {
-	    double re, im;
-	    deserialize_untagged_f64(&f64, sb);
-	    re = f64;
-	    deserialize_untagged_f64(&f64, sb);
-	    im = f64;
-	    c64vector_set(vec, i, std::complex<double>(re, im));
-	  }
+	  size_t len;
+	  double *data = (double *)c64vector_writable_elements(vec, len);
+	  if(!deserialize_untagged_f64_array(data, 2 * (size_t)nitems, sb))
+	    goto error;
 	  return vec;
 	}
 
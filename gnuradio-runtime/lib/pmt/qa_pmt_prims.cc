@@ -98,6 +98,11 @@ qa_pmt_prims::test_integers()
   CPPUNIT_ASSERT_THROW(pmt::to_long(pmt::PMT_T), pmt::wrong_type);
   CPPUNIT_ASSERT_EQUAL(-1L, pmt::to_long(m1));
   CPPUNIT_ASSERT_EQUAL(1L, pmt::to_long(p1));
+
+  // small values are interned; anything else still round-trips
+  CPPUNIT_ASSERT(pmt::eq(pmt::from_long(42), pmt::from_long(42)));
+  CPPUNIT_ASSERT_EQUAL(123456789L, pmt::to_long(pmt::from_long(123456789)));
+  CPPUNIT_ASSERT_EQUAL(-123456789L, pmt::to_long(pmt::from_long(-123456789)));
 }
 
 void
@@ -125,6 +130,11 @@ qa_pmt_prims::test_reals()
   CPPUNIT_ASSERT_EQUAL(-1.0, pmt::to_double(m1));
   CPPUNIT_ASSERT_EQUAL(1.0, pmt::to_double(p1));
   CPPUNIT_ASSERT_EQUAL(1.0, pmt::to_double(pmt::from_long(1)));
+
+  // repeated values come out of the per-thread cache bit-exact
+  CPPUNIT_ASSERT(pmt::eqv(pmt::from_double(2.4e9), pmt::from_double(2.4e9)));
+  CPPUNIT_ASSERT_EQUAL(2.4e9, pmt::to_double(pmt::from_double(2.4e9)));
+  CPPUNIT_ASSERT_EQUAL(2.5e9, pmt::to_double(pmt::from_double(2.5e9)));
 }
 
 void
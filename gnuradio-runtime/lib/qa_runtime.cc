@@ -35,6 +35,7 @@
 #include <qa_circular_file.h>
 #include <qa_fxpt.h>
 #include <qa_fxpt_nco.h>
+#include <qa_fxpt_sine_table.h>
 #include <qa_fxpt_vco.h>
 #include <qa_logger.h>
 #include <qa_math.h>
@@ -52,6 +53,7 @@ qa_runtime::suite()
   s->addTest(qa_circular_file::suite());
   s->addTest(qa_fxpt::suite());
   s->addTest(qa_fxpt_nco::suite());
+  s->addTest(qa_fxpt_sine_table::suite());
   s->addTest(qa_fxpt_vco::suite());
   s->addTest(qa_logger::suite());
   s->addTest(qa_math::suite());
@@ -61,6 +61,25 @@ namespace gr {
      * \brief Block until the graph is done.
      */
     virtual void wait() = 0;
+
+    /*!
+     * \brief Stop and join the execution contexts of only the given
+     * blocks, leaving the rest of the graph running.
+     *
+     * Returns false when this scheduler cannot restart individual
+     * blocks (the default); nothing has been stopped in that case and
+     * the caller must fall back to a full stop()/wait() restart.
+     */
+    virtual bool stop_blocks(const block_vector_t &blocks);
+
+    /*!
+     * \brief Begin executing the given blocks, whose details and
+     * buffers must already be wired up.
+     *
+     * Only valid on schedulers whose stop_blocks() returns true.
+     */
+    virtual void start_blocks(const block_vector_t &blocks,
+                              int max_noutput_items);
   };
 
 } /* namespace gr */
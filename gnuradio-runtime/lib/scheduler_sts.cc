@@ -25,6 +25,8 @@
 
 #include "scheduler_sts.h"
 #include "single_threaded_scheduler.h"
+#include <gnuradio/prefs.h>
+#include <gnuradio/thread/thread.h>
 #include <gnuradio/thread/thread_body_wrapper.h>
 
 namespace gr {
@@ -32,14 +34,18 @@ namespace gr {
   class sts_container
   {
     block_vector_t d_blocks;
+    int d_max_noutput_items;
+    int d_cpu;		// processor to pin to, or -1 for unpinned
 
   public:
-    sts_container(block_vector_t blocks)
-      : d_blocks(blocks) {}
+    sts_container(block_vector_t blocks, int max_noutput_items, int cpu)
+      : d_blocks(blocks), d_max_noutput_items(max_noutput_items), d_cpu(cpu) {}
 
     void operator()()
     {
-      make_single_threaded_scheduler(d_blocks)->run();
+      if(d_cpu >= 0)
+        gr::thread::thread_bind_to_processor(d_cpu);
+      make_single_threaded_scheduler(d_blocks, d_max_noutput_items)->run();
     }
   };
 
@@ -60,12 +66,19 @@ namespace gr {
     // For each partition, create a thread to evaluate it using
     // an instance of the gr_single_threaded_scheduler
 
+    // Pinning each partition's thread to its own processor removes
+    // the scheduler's last source of run-to-run timing variation,
+    // which matters when benchmarking.  Off by default.
+    bool pin = prefs::singleton()->get_bool("DEFAULT", "sts_pin_threads", false);
+    int cpu = 0;
+
     for(std::vector<basic_block_vector_t>::iterator p = graphs.begin();
         p != graphs.end(); p++) {
 
       block_vector_t blocks = flat_flowgraph::make_block_vector(*p);
       d_threads.create_thread(
-        gr::thread::thread_body_wrapper<sts_container>(sts_container(blocks),
+        gr::thread::thread_body_wrapper<sts_container>(
+          sts_container(blocks, max_noutput_items, pin ? cpu++ : -1),
 						  "single-threaded-scheduler"));
     }
   }
@@ -53,10 +53,9 @@ namespace gr {
 
   scheduler_tpb::scheduler_tpb(flat_flowgraph_sptr ffg,
                                int max_noutput_items)
-    : scheduler(ffg, max_noutput_items)
+    : scheduler(ffg, max_noutput_items),
+      d_next_thread_num(0)
   {
-    int block_max_noutput_items;
-    
     // Get a topologically sorted vector of all the blocks in use.
     // Being topologically sorted probably isn't going to matter, but
     // there's a non-zero chance it might help...
@@ -65,31 +64,9 @@ namespace gr {
     used_blocks = ffg->topological_sort(used_blocks);
     block_vector_t blocks = flat_flowgraph::make_block_vector(used_blocks);
 
-    // Ensure that the done flag is clear on all blocks
-
-    for(size_t i = 0; i < blocks.size(); i++) {
-      blocks[i]->detail()->set_done(false);
-    }
-
     // Fire off a thead for each block
 
-    for(size_t i = 0; i < blocks.size(); i++) {
-      std::stringstream name;
-      name << "thread-per-block[" << i << "]: " << blocks[i];
-
-      // If set, use internal value instead of global value
-      if(blocks[i]->is_set_max_noutput_items()) {
-        block_max_noutput_items = blocks[i]->max_noutput_items();
-      }
-      else {
-        block_max_noutput_items = max_noutput_items;
-      }
-    
-      d_threads.create_thread(
-	    gr::thread::thread_body_wrapper<tpb_container>
-            (tpb_container(blocks[i], block_max_noutput_items),
-             name.str()));
-    }
+    start_blocks(blocks, max_noutput_items);
   }
 
   scheduler_tpb::~scheduler_tpb()
@@ -107,6 +84,60 @@ namespace gr {
   scheduler_tpb::wait()
   {
     d_threads.join_all();
+    d_block_threads.clear();	// join_all leaves only dead threads behind
+  }
+
+  bool
+  scheduler_tpb::stop_blocks(const block_vector_t &blocks)
+  {
+    // Interrupt all of the requested threads first, then join them,
+    // so blocks parked against each other's buffers wind down together.
+    for(size_t i = 0; i < blocks.size(); i++) {
+      std::map<block_sptr, boost::thread*>::iterator t =
+        d_block_threads.find(blocks[i]);
+      if(t != d_block_threads.end())
+        t->second->interrupt();
+    }
+
+    for(size_t i = 0; i < blocks.size(); i++) {
+      std::map<block_sptr, boost::thread*>::iterator t =
+        d_block_threads.find(blocks[i]);
+      if(t == d_block_threads.end())
+        continue;
+      t->second->join();
+      d_threads.remove_thread(t->second);
+      delete t->second;
+      d_block_threads.erase(t);
+    }
+    return true;
+  }
+
+  void
+  scheduler_tpb::start_blocks(const block_vector_t &blocks,
+                              int max_noutput_items)
+  {
+    int block_max_noutput_items;
+
+    for(size_t i = 0; i < blocks.size(); i++) {
+      // Ensure that the done flag is clear
+      blocks[i]->detail()->set_done(false);
+
+      std::stringstream name;
+      name << "thread-per-block[" << d_next_thread_num++ << "]: " << blocks[i];
+
+      // If set, use internal value instead of global value
+      if(blocks[i]->is_set_max_noutput_items()) {
+        block_max_noutput_items = blocks[i]->max_noutput_items();
+      }
+      else {
+        block_max_noutput_items = max_noutput_items;
+      }
+
+      d_block_threads[blocks[i]] = d_threads.create_thread(
+	    gr::thread::thread_body_wrapper<tpb_container>
+            (tpb_container(blocks[i], block_max_noutput_items),
+             name.str()));
+    }
   }
 
 } /* namespace gr */
@@ -25,6 +25,7 @@
 #include <gnuradio/api.h>
 #include <gnuradio/thread/thread_group.h>
 #include "scheduler.h"
+#include <map>
 
 namespace gr {
 
@@ -35,6 +36,11 @@ namespace gr {
   {
     gr::thread::thread_group d_threads;
 
+    // Per-block thread handles so individual blocks can be stopped
+    // and restarted without touching the rest of the graph.
+    std::map<block_sptr, boost::thread*> d_block_threads;
+    int d_next_thread_num;
+
   protected:
     /*!
      * \brief Construct a scheduler and begin evaluating the graph.
@@ -59,6 +65,17 @@ namespace gr {
      * \brief Block until the graph is done.
      */
     void wait();
+
+    /*!
+     * \brief Stop and join only the given blocks' threads; the rest
+     * of the graph keeps running.
+     */
+    bool stop_blocks(const block_vector_t &blocks);
+
+    /*!
+     * \brief Fire off a thread for each of the given blocks.
+     */
+    void start_blocks(const block_vector_t &blocks, int max_noutput_items);
   };
 
 } /* namespace gr */
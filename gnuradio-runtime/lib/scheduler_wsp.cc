@@ -0,0 +1,357 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "scheduler_wsp.h"
+#include "block_executor.h"
+#include <gnuradio/block_detail.h>
+#include <gnuradio/prefs.h>
+#include <gnuradio/thread/thread_body_wrapper.h>
+#include <boost/thread.hpp>
+#include <boost/foreach.hpp>
+#include <pmt/pmt.h>
+#include <deque>
+#include <list>
+#include <sstream>
+
+namespace gr {
+
+  /*!
+   * \brief One schedulable unit of work: a block plus its executor.
+   */
+  struct wsp_task
+  {
+    block_sptr block;
+    block_executor exec;
+
+    wsp_task(block_sptr blk, int max_noutput_items)
+      : block(blk), exec(blk, max_noutput_items) {}
+  };
+
+  typedef boost::shared_ptr<wsp_task> wsp_task_sptr;
+
+  /*!
+   * \brief Shared state for the pool of worker threads.
+   *
+   * Each worker owns a run queue of READY tasks and a private list
+   * of blocked tasks.  A worker pops work from the front of its own
+   * queue and steals from the back of other workers' queues when its
+   * own is empty.  Blocked tasks are polled for the input/output
+   * changed flags that tpb_detail sets on notification.
+   */
+  class wsp_worker_pool
+  {
+  public:
+    struct worker
+    {
+      gr::thread::mutex mutex;          // protects runnable
+      std::deque<wsp_task_sptr> runnable;
+      std::list<wsp_task_sptr> blocked; // touched only by the owning worker
+    };
+
+    wsp_worker_pool(int nworkers, size_t max_nmsgs)
+      : d_nalive(0), d_max_nmsgs(max_nmsgs)
+    {
+      // array rather than vector: worker holds a mutex and can't be
+      // copied into place
+      d_workers = new worker[nworkers];
+      d_nworkers = nworkers;
+    }
+
+    ~wsp_worker_pool()
+    {
+      delete [] d_workers;
+    }
+
+    //! Seed worker \p w with a task before the pool starts running.
+    void assign(int w, wsp_task_sptr task)
+    {
+      d_workers[w].runnable.push_back(task);
+      d_nalive++;
+    }
+
+    //! Main loop for worker \p me; returns when all tasks are done.
+    void run_worker(int me)
+    {
+      worker &self = d_workers[me];
+
+      while(1) {
+        boost::this_thread::interruption_point();
+
+        {
+          gr::thread::scoped_lock guard(d_mutex);
+          if(d_nalive == 0)
+            return;
+        }
+
+        wsp_task_sptr task = next_task(self);
+        if(!task) {
+          // Nothing runnable here or anywhere else; sleep until a
+          // neighbor makes progress.  The timed wait also lets us
+          // notice message-port activity, which only signals the
+          // per-block condition variables.
+          gr::thread::scoped_lock guard(d_mutex);
+          d_cond.timed_wait(guard, boost::posix_time::milliseconds(1));
+          continue;
+        }
+
+        run_one(self, task);
+      }
+    }
+
+    //! Wake any sleeping workers; called on progress and on stop().
+    void notify_all()
+    {
+      gr::thread::scoped_lock guard(d_mutex);
+      d_cond.notify_all();
+    }
+
+  private:
+    //! Pop local work, unblock local tasks, or steal; may return NULL.
+    wsp_task_sptr next_task(worker &self)
+    {
+      {
+        gr::thread::scoped_lock guard(self.mutex);
+        if(!self.runnable.empty()) {
+          wsp_task_sptr task = self.runnable.front();
+          self.runnable.pop_front();
+          return task;
+        }
+      }
+
+      // Promote blocked tasks whose neighbors have notified them.
+      std::list<wsp_task_sptr>::iterator it = self.blocked.begin();
+      while(it != self.blocked.end()) {
+        if(task_runnable(*it)) {
+          wsp_task_sptr task = *it;
+          it = self.blocked.erase(it);
+          return task;
+        }
+        ++it;
+      }
+
+      // Steal from the back of another worker's queue.
+      for(int v = 0; v < d_nworkers; v++) {
+        worker &victim = d_workers[v];
+        if(&victim == &self)
+          continue;
+        gr::thread::scoped_lock guard(victim.mutex);
+        if(!victim.runnable.empty()) {
+          wsp_task_sptr task = victim.runnable.back();
+          victim.runnable.pop_back();
+          return task;
+        }
+      }
+
+      return wsp_task_sptr();
+    }
+
+    //! True if a blocked task has been notified or has pending messages.
+    bool task_runnable(wsp_task_sptr task)
+    {
+      block_detail *d = task->block->detail().get();
+      gr::thread::scoped_lock guard(d->d_tpb.mutex);
+      return d->d_tpb.input_changed || d->d_tpb.output_changed
+        || !task->block->empty_handled_p();
+    }
+
+    void run_one(worker &self, wsp_task_sptr task)
+    {
+      block_sptr block = task->block;
+      block_detail *d = block->detail().get();
+      pmt::pmt_t msg;
+
+      // Handle any queued up messages, as tpb_thread_body does.
+      BOOST_FOREACH(basic_block::msg_queue_map_t::value_type &i, block->msg_queue) {
+        if(block->has_msg_handler(i.first)) {
+          block->dispatch_pending(i.first);
+        }
+        else {
+          if(block->nmsgs(i.first) > d_max_nmsgs) {
+            // No handler attached; prune from the front to bound memory.
+            msg = block->delete_head_nowait(i.first);
+          }
+        }
+      }
+
+      d->d_tpb.clear_changed();
+
+      block_executor::state s;
+      if(d->noutputs() > 0 || d->ninputs() > 0)
+        s = task->exec.run_one_iteration();
+      else
+        s = block_executor::BLKD_IN;
+
+      switch(s) {
+      case block_executor::READY:
+        d->d_tpb.notify_neighbors(d);
+        requeue(self, task);
+        notify_all();
+        break;
+
+      case block_executor::READY_NO_OUTPUT:
+        d->d_tpb.notify_upstream(d);
+        requeue(self, task);
+        notify_all();
+        break;
+
+      case block_executor::DONE:
+        d->d_tpb.notify_neighbors(d);
+        d->d_tpb.flush_notifications(d);
+        retire();
+        break;
+
+      case block_executor::BLKD_IN:
+      case block_executor::BLKD_OUT:
+        d->d_tpb.flush_notifications(d);
+        if(task_runnable(task))       // notified while we were running
+          requeue(self, task);
+        else
+          self.blocked.push_back(task);
+        break;
+
+      default:
+        throw std::runtime_error("possible memory corruption in scheduler");
+      }
+    }
+
+    void requeue(worker &self, wsp_task_sptr task)
+    {
+      gr::thread::scoped_lock guard(self.mutex);
+      self.runnable.push_back(task);
+    }
+
+    void retire()
+    {
+      gr::thread::scoped_lock guard(d_mutex);
+      d_nalive--;
+      if(d_nalive == 0)
+        d_cond.notify_all();
+    }
+
+    worker *d_workers;
+    int d_nworkers;
+    gr::thread::mutex d_mutex;          // protects d_nalive and d_cond
+    gr::thread::condition_variable d_cond;
+    int d_nalive;
+    size_t d_max_nmsgs;
+  };
+
+  class wsp_container
+  {
+    boost::shared_ptr<wsp_worker_pool> d_pool;
+    int d_worker;
+
+  public:
+    wsp_container(boost::shared_ptr<wsp_worker_pool> pool, int worker)
+      : d_pool(pool), d_worker(worker) {}
+
+    void operator()()
+    {
+      d_pool->run_worker(d_worker);
+    }
+  };
+
+  scheduler_sptr
+  scheduler_wsp::make(flat_flowgraph_sptr ffg, int max_noutput_items)
+  {
+    return scheduler_sptr(new scheduler_wsp(ffg, max_noutput_items));
+  }
+
+  scheduler_wsp::scheduler_wsp(flat_flowgraph_sptr ffg,
+                               int max_noutput_items)
+    : scheduler(ffg, max_noutput_items)
+  {
+    int block_max_noutput_items;
+
+    // Keep the topological order: assigning consecutive blocks to the
+    // same worker keeps producer/consumer pairs on the same core.
+
+    basic_block_vector_t used_blocks = ffg->calc_used_blocks();
+    used_blocks = ffg->topological_sort(used_blocks);
+    block_vector_t blocks = flat_flowgraph::make_block_vector(used_blocks);
+
+    // Ensure that the done flag is clear on all blocks
+
+    for(size_t i = 0; i < blocks.size(); i++) {
+      blocks[i]->detail()->set_done(false);
+    }
+
+    prefs *p = prefs::singleton();
+    int nworkers = static_cast<int>(p->get_long("DEFAULT", "wsp_nthreads", 0));
+    if(nworkers <= 0)
+      nworkers = boost::thread::hardware_concurrency();
+    if(nworkers <= 0)
+      nworkers = 1;
+    if(nworkers > (int)blocks.size())
+      nworkers = blocks.size();
+
+    size_t max_nmsgs = static_cast<size_t>(p->get_long("DEFAULT", "max_messages", 100));
+
+    d_pool.reset(new wsp_worker_pool(nworkers, max_nmsgs));
+
+    // Distribute blocks in contiguous topological runs.
+    for(size_t i = 0; i < blocks.size(); i++) {
+      if(blocks[i]->is_set_max_noutput_items())
+        block_max_noutput_items = blocks[i]->max_noutput_items();
+      else
+        block_max_noutput_items = max_noutput_items;
+
+      blocks[i]->detail()->threaded = false;
+      blocks[i]->detail()->d_tpb.notify_interval = blocks[i]->notification_interval();
+
+      int w = (i * nworkers) / blocks.size();
+      d_pool->assign(w, wsp_task_sptr(new wsp_task(blocks[i],
+                                                   block_max_noutput_items)));
+    }
+
+    for(int w = 0; w < nworkers; w++) {
+      std::stringstream name;
+      name << "work-stealing-pool[" << w << "]";
+      d_threads.create_thread(
+        gr::thread::thread_body_wrapper<wsp_container>
+          (wsp_container(d_pool, w), name.str()));
+    }
+  }
+
+  scheduler_wsp::~scheduler_wsp()
+  {
+    stop();
+  }
+
+  void
+  scheduler_wsp::stop()
+  {
+    d_threads.interrupt_all();
+    if(d_pool)
+      d_pool->notify_all();
+  }
+
+  void
+  scheduler_wsp::wait()
+  {
+    d_threads.join_all();
+  }
+
+} /* namespace gr */
@@ -0,0 +1,81 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef INCLUDED_GR_SCHEDULER_WSP_H
+#define INCLUDED_GR_SCHEDULER_WSP_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/thread/thread_group.h>
+#include "scheduler.h"
+
+namespace gr {
+
+  class wsp_worker_pool;
+
+  /*!
+   * \brief Concrete scheduler that runs blocks as tasks on a
+   * fixed-size work-stealing thread pool.
+   *
+   * Unlike the thread-per-block scheduler, the number of kernel
+   * threads is bounded by the pool size (by default the number of
+   * hardware threads, overridable with the "wsp_nthreads" preference
+   * in the DEFAULT section).  Blocks are assigned to per-worker run
+   * queues in topological order, so a block's upstream and downstream
+   * neighbors tend to execute on the same core; idle workers steal
+   * tasks from the back of other workers' queues.
+   *
+   * Select it by setting the GR_SCHEDULER environment variable to
+   * "WSP".
+   */
+  class GR_RUNTIME_API scheduler_wsp : public scheduler
+  {
+    boost::shared_ptr<wsp_worker_pool> d_pool;
+    gr::thread::thread_group d_threads;
+
+  protected:
+    /*!
+     * \brief Construct a scheduler and begin evaluating the graph.
+     *
+     * The scheduler will continue running until all blocks report
+     * that they are done or the stop method is called.
+     */
+    scheduler_wsp(flat_flowgraph_sptr ffg, int max_noutput_items);
+
+  public:
+    static scheduler_sptr make(flat_flowgraph_sptr ffg,
+                               int max_noutput_items=100000);
+
+    ~scheduler_wsp();
+
+    /*!
+     * \brief Tell the scheduler to stop executing.
+     */
+    void stop();
+
+    /*!
+     * \brief Block until the graph is done.
+     */
+    void wait();
+  };
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SCHEDULER_WSP_H */
@@ -1,6 +1,6 @@
 /* -*- c++ -*- */
 /*
- * Copyright 2004 Free Software Foundation, Inc.
+ * Copyright 2004,2014 Free Software Foundation, Inc.
  *
  * This file is part of GNU Radio
  *
@@ -30,6 +30,7 @@
 #include <gnuradio/buffer.h>
 #include <boost/thread.hpp>
 #include <boost/format.hpp>
+#include <boost/foreach.hpp>
 #include <iostream>
 #include <limits>
 #include <assert.h>
@@ -49,14 +50,17 @@ namespace gr {
   static int which_scheduler  = 0;
 
   single_threaded_scheduler_sptr
-  make_single_threaded_scheduler(const std::vector<block_sptr> &blocks)
+  make_single_threaded_scheduler(const std::vector<block_sptr> &blocks,
+                                 int max_noutput_items)
   {
     return single_threaded_scheduler_sptr
-      (new single_threaded_scheduler(blocks));
+      (new single_threaded_scheduler(blocks, max_noutput_items));
   }
 
-  single_threaded_scheduler::single_threaded_scheduler(const std::vector<block_sptr> &blocks)
-    : d_blocks(blocks), d_enabled(true), d_log(0)
+  single_threaded_scheduler::single_threaded_scheduler(const std::vector<block_sptr> &blocks,
+                                                       int max_noutput_items)
+    : d_blocks(blocks), d_max_noutput_items(max_noutput_items),
+      d_enabled(true), d_log(0)
   {
     if(ENABLE_LOGGING) {
       std::string name = str(boost::format("sst-%d.log") % which_scheduler++);
@@ -76,7 +80,6 @@ namespace gr {
   void
   single_threaded_scheduler::run()
   {
-    // d_enabled = true;    // KLUDGE
     main_loop ();
   }
 
@@ -124,160 +127,141 @@ namespace gr {
     return min_space;
   }
 
-  void
-  single_threaded_scheduler::main_loop()
-  {
-    static const int DEFAULT_CAPACITY = 16;
-
-    int				noutput_items;
-    gr_vector_int		ninput_items_required(DEFAULT_CAPACITY);
-    gr_vector_int		ninput_items(DEFAULT_CAPACITY);
-    gr_vector_const_void_star	input_items(DEFAULT_CAPACITY);
-    gr_vector_void_star		output_items(DEFAULT_CAPACITY);
-    unsigned int		bi;
-    unsigned int		nalive;
-    int				max_items_avail;
-    bool			made_progress_last_pass;
-    bool			making_progress;
-
-    for(unsigned i = 0; i < d_blocks.size (); i++)
-      d_blocks[i]->detail()->set_done (false);		// reset any done flags
-
-    for(unsigned i = 0; i < d_blocks.size (); i++)	// enable any drivers, etc.
-      d_blocks[i]->start();
-
-    bi = 0;
-    made_progress_last_pass = true;
-    making_progress = false;
-
-    // Loop while there are still blocks alive
-
-    nalive = d_blocks.size ();
-    while(d_enabled && nalive > 0) {
-      if(boost::this_thread::interruption_requested())
-        break;
-
-      block *m = d_blocks[bi].get ();
-      block_detail *d = m->detail().get ();
-
-      LOG(*d_log << std::endl << m);
-
-      if(d->done ())
-        goto next_block;
-
-      if(d->source_p ()) {
-        // Invoke sources as a last resort. As long as the previous
-        // pass made progress, don't call a source.
-        if(made_progress_last_pass) {
-          LOG(*d_log << "  Skipping source\n");
-          goto next_block;
-        }
-
-        ninput_items_required.resize (0);
-        ninput_items.resize (0);
-        input_items.resize (0);
-        output_items.resize (d->noutputs ());
-
-        // determine the minimum available output space
-        noutput_items = min_available_space (d, m->output_multiple ());
-        LOG(*d_log << " source\n  noutput_items = " << noutput_items << std::endl);
-        if(noutput_items == -1)    // we're done
-          goto were_done;
+  namespace {
+    enum block_status {
+      RAN,		// produced output; worth calling again
+      BLKD,		// can't run now; waiting on input or output space
+      WERE_DONE		// block is finished
+    };
+  }
 
-        if(noutput_items == 0) {   // we're output blocked
-          LOG(*d_log << "  BLKD_OUT\n");
-          goto next_block;
+  //
+  // Try to run one maximal call to m's work function: as much output
+  // as the downstream buffers can take, bounded by the input
+  // actually available.
+  //
+  //
+  // Move the tags consumed by the last call to work downstream,
+  // following the block's propagation policy.  This mirrors what the
+  // thread-per-block executor does.
+  //
+  static void
+  propagate_tags(block *m, block_detail *d,
+                 const std::vector<uint64_t> &start_nitems_read,
+                 std::vector<tag_t> &rtags)
+  {
+    double rrate = m->relative_rate ();
+
+    switch(m->tag_propagation_policy ()) {
+    case block::TPP_DONT:
+      break;
+
+    case block::TPP_ALL_TO_ALL:
+      for(int i = 0; i < d->ninputs (); i++) {
+        d->get_tags_in_range(rtags, i, start_nitems_read[i],
+                             d->nitems_read(i), m->unique_id());
+        if(rtags.empty())
+          continue;
+        if(rrate != 1.0) {
+          std::vector<tag_t>::iterator t;
+          for(t = rtags.begin(); t != rtags.end(); t++)
+            t->offset = ((double)t->offset * rrate) + 0.5;
         }
-
-        goto setup_call_to_work;   // jump to common code
+        for(int o = 0; o < d->noutputs () - 1; o++)
+          d->output(o)->add_item_tags(rtags);
+        d->output(d->noutputs () - 1)->move_item_tags(rtags);
       }
+      break;
 
-      else if(d->sink_p ()) {
-        ninput_items_required.resize (d->ninputs ());
-        ninput_items.resize (d->ninputs ());
-        input_items.resize (d->ninputs ());
-        output_items.resize (0);
-        LOG(*d_log << " sink\n");
-
-        max_items_avail = 0;
+    case block::TPP_ONE_TO_ONE:
+      if(d->ninputs () == d->noutputs ()) {
         for(int i = 0; i < d->ninputs (); i++) {
-          ninput_items[i] = d->input(i)->items_available();
-          //if (ninput_items[i] == 0 && d->input(i)->done())
-          if(ninput_items[i] < m->output_multiple() && d->input(i)->done())
-            goto were_done;
-
-          max_items_avail = std::max (max_items_avail, ninput_items[i]);
-        }
-
-        // take a swag at how much output we can sink
-        noutput_items = (int) (max_items_avail * m->relative_rate ());
-        noutput_items = round_down (noutput_items, m->output_multiple ());
-        LOG(*d_log << "  max_items_avail = " << max_items_avail << std::endl);
-        LOG(*d_log << "  noutput_items = " << noutput_items << std::endl);
-
-        if(noutput_items == 0) {      // we're blocked on input
-          LOG(*d_log << "  BLKD_IN\n");
-          goto next_block;
+          d->get_tags_in_range(rtags, i, start_nitems_read[i],
+                               d->nitems_read(i), m->unique_id());
+          if(rtags.empty())
+            continue;
+          std::vector<tag_t>::iterator t;
+          for(t = rtags.begin(); t != rtags.end(); t++)
+            t->offset = ((double)t->offset * rrate) + 0.5;
+          d->output(i)->move_item_tags(rtags);
         }
-
-        goto try_again;    // Jump to code shared with regular case.
       }
-
       else {
-        // do the regular thing
-        ninput_items_required.resize(d->ninputs ());
-        ninput_items.resize(d->ninputs ());
-        input_items.resize(d->ninputs ());
-        output_items.resize(d->noutputs ());
-
-        max_items_avail = 0;
-        for(int i = 0; i < d->ninputs (); i++) {
-          ninput_items[i] = d->input(i)->items_available ();
-          max_items_avail = std::max(max_items_avail, ninput_items[i]);
-        }
+        std::cerr << "Error: single_threaded_scheduler: propagation_policy "
+                  << "'ONE-TO-ONE' requires ninputs == noutputs" << std::endl;
+      }
+      break;
 
-        // determine the minimum available output space
-        noutput_items = min_available_space(d, m->output_multiple ());
-        if(ENABLE_LOGGING){
-          *d_log << " regular ";
-          if(m->relative_rate() >= 1.0)
-            *d_log << "1:" << m->relative_rate() << std::endl;
-          else
-            *d_log << 1.0/m->relative_rate() << ":1\n";
-          *d_log << "  max_items_avail = " << max_items_avail << std::endl;
-          *d_log << "  noutput_items = " << noutput_items << std::endl;
-        }
-        if(noutput_items == -1)    // we're done
-          goto were_done;
+    default:
+      break;
+    }
+  }
 
-        if(noutput_items == 0) {   // we're output blocked
-          LOG(*d_log << "  BLKD_OUT\n");
-          goto next_block;
-        }
+  static block_status
+  run_one_block(block *m, block_detail *d,
+                gr_vector_int &ninput_items_required,
+                gr_vector_int &ninput_items,
+                gr_vector_const_void_star &input_items,
+                gr_vector_void_star &output_items,
+                std::vector<uint64_t> &start_nitems_read,
+                std::vector<tag_t> &rtags,
+                int max_noutput_items)
+  {
+    int noutput_items;
+    int max_items_avail = 0;
+
+    ninput_items_required.resize(d->ninputs ());
+    ninput_items.resize(d->ninputs ());
+    input_items.resize(d->ninputs ());
+    output_items.resize(d->noutputs ());
+
+    for(int i = 0; i < d->ninputs (); i++) {
+      ninput_items[i] = d->input(i)->items_available ();
+      if(d->sink_p ()
+         && ninput_items[i] < m->output_multiple ()
+         && d->input(i)->done ())
+        return WERE_DONE;
+      max_items_avail = std::max (max_items_avail, ninput_items[i]);
+    }
 
-#if 0
-        // Compute best estimate of noutput_items that we can really use.
-        noutput_items =
-          std::min((unsigned)noutput_items,
-                   std::max((unsigned)m->output_multiple(),
-                              round_up((unsigned)(max_items_avail * m->relative_rate()),
-                                       m->output_multiple())));
+    if(d->sink_p ()) {
+      // take a swag at how much output we can sink
+      noutput_items = (int)(max_items_avail * m->relative_rate ());
+      noutput_items = round_down (noutput_items, m->output_multiple ());
+      if(noutput_items == 0)    // we're blocked on input
+        return BLKD;
+    }
+    else {
+      // determine the minimum available output space
+      noutput_items = min_available_space (d, m->output_multiple ());
+      if(noutput_items == -1)   // downstream is done, therefore we're done
+        return WERE_DONE;
+      if(noutput_items == 0)    // we're output blocked
+        return BLKD;
+    }
 
-        LOG(*d_log << "  revised noutput_items = " << noutput_items << std::endl);
-#endif
+    // Capping the request makes the chunk-size sequence reproducible
+    // from run to run, independent of how full the buffers happen to
+    // be when we get here.
+    if(max_noutput_items > 0) {
+      int cap = round_down (max_noutput_items, m->output_multiple ());
+      if(cap > 0 && noutput_items > cap)
+        noutput_items = cap;
+    }
 
-      try_again:
-        if(m->fixed_rate()) {
+    if(!d->source_p ()) {
+      while(1) {
+        if(m->fixed_rate ()) {
           // try to work it forward starting with max_items_avail.
           // We want to try to consume all the input we've got.
-          int reqd_noutput_items = m->fixed_rate_ninput_to_noutput(max_items_avail);
-          reqd_noutput_items = round_up(reqd_noutput_items, m->output_multiple());
+          int reqd_noutput_items = m->fixed_rate_ninput_to_noutput (max_items_avail);
+          reqd_noutput_items = round_up (reqd_noutput_items, m->output_multiple ());
           if(reqd_noutput_items > 0 && reqd_noutput_items <= noutput_items)
             noutput_items = reqd_noutput_items;
         }
 
         // ask the block how much input they need to produce noutput_items
-        m->forecast(noutput_items, ninput_items_required);
+        m->forecast (noutput_items, ninput_items_required);
 
         // See if we've got sufficient input available
         int i;
@@ -285,77 +269,141 @@ namespace gr {
           if(ninput_items_required[i] > ninput_items[i])   // not enough
             break;
 
-        if(i < d->ninputs()) {    // not enough input on input[i]
-          // if we can, try reducing the size of our output request
-          if(noutput_items > m->output_multiple ()){
-            noutput_items /= 2;
-            noutput_items = round_up (noutput_items, m->output_multiple ());
-            goto try_again;
-          }
+        if(i >= d->ninputs ())    // enough on every input
+          break;
 
-          // We're blocked on input
-          LOG(*d_log << "  BLKD_IN\n");
-          if(d->input(i)->done())    // If the upstream block is done, we're done
-            goto were_done;
-
-          // Is it possible to ever fulfill this request?
-          if(ninput_items_required[i] > d->input(i)->max_possible_items_available ()) {
-            // Nope, never going to happen...
-            std::cerr << "\nsched: <block " << m->name()
-                      << " (" << m->unique_id() << ")>"
-                      << " is requesting more input data\n"
-                      << "  than we can provide.\n"
-                      << "  ninput_items_required = "
-                      << ninput_items_required[i] << "\n"
-                      << "  max_possible_items_available = "
-                      << d->input(i)->max_possible_items_available() << "\n"
-                      << "  If this is a filter, consider reducing the number of taps.\n";
-            goto were_done;
-          }
+        // if we can, try reducing the size of our output request
+        if(noutput_items > m->output_multiple ()) {
+          noutput_items /= 2;
+          noutput_items = round_up (noutput_items, m->output_multiple ());
+          continue;
+        }
 
-          goto next_block;
+        // We're blocked on input
+        if(d->input(i)->done ())    // If the upstream block is done, we're done
+          return WERE_DONE;
+
+        // Is it possible to ever fulfill this request?
+        if(ninput_items_required[i] > d->input(i)->max_possible_items_available ()) {
+          // Nope, never going to happen...
+          std::cerr << "\nsched: <block " << m->name()
+                    << " (" << m->unique_id() << ")>"
+                    << " is requesting more input data\n"
+                    << "  than we can provide.\n"
+                    << "  ninput_items_required = "
+                    << ninput_items_required[i] << "\n"
+                    << "  max_possible_items_available = "
+                    << d->input(i)->max_possible_items_available() << "\n"
+                    << "  If this is a filter, consider reducing the number of taps.\n";
+          return WERE_DONE;
         }
 
-        // We've got enough data on each input to produce noutput_items.
-        // Finish setting up the call to work.
-        for(int i = 0; i < d->ninputs (); i++)
-          input_items[i] = d->input(i)->read_pointer();
+        return BLKD;
+      }
+
+      for(int i = 0; i < d->ninputs (); i++)
+        input_items[i] = d->input(i)->read_pointer ();
+    }
 
-      setup_call_to_work:
+    for(int i = 0; i < d->noutputs (); i++)
+      output_items[i] = d->output(i)->write_pointer ();
 
-        for(int i = 0; i < d->noutputs (); i++)
-          output_items[i] = d->output(i)->write_pointer();
+    start_nitems_read.resize(d->ninputs ());
+    for(int i = 0; i < d->ninputs (); i++)
+      start_nitems_read[i] = d->nitems_read(i);
 
-        // Do the actual work of the block
-        int n = m->general_work(noutput_items, ninput_items,
-                                input_items, output_items);
-        LOG(*d_log << "  general_work: noutput_items = " << noutput_items
-            << " result = " << n << std::endl);
+    // Do the actual work of the block
+    int n = m->general_work (noutput_items, ninput_items,
+                             input_items, output_items);
 
-        if(n == -1)             // block is done
-          goto were_done;
+    if(n == -1)             // block is done
+      return WERE_DONE;
 
-        d->produce_each(n);     // advance write pointers
-        if(n > 0)
-          making_progress = true;
+    d->produce_each (n);    // advance write pointers
 
-        goto next_block;
-      }
-      assert(0);
-
-    were_done:
-      LOG(*d_log << "  were_done\n");
-      d->set_done (true);
-      nalive--;
-
-    next_block:
-      if(++bi >= d_blocks.size ()) {
-        bi = 0;
-        made_progress_last_pass = making_progress;
-        making_progress = false;
+    if(!d->sink_p ())
+      propagate_tags(m, d, start_nitems_read, rtags);
+
+    return n > 0 ? RAN : BLKD;
+  }
+
+  void
+  single_threaded_scheduler::main_loop()
+  {
+    static const int DEFAULT_CAPACITY = 16;
+
+    gr_vector_int		ninput_items_required(DEFAULT_CAPACITY);
+    gr_vector_int		ninput_items(DEFAULT_CAPACITY);
+    gr_vector_const_void_star	input_items(DEFAULT_CAPACITY);
+    gr_vector_void_star		output_items(DEFAULT_CAPACITY);
+    std::vector<uint64_t>	start_nitems_read(DEFAULT_CAPACITY);
+    std::vector<tag_t>		rtags;
+    unsigned int		nalive;
+
+    for(unsigned i = 0; i < d_blocks.size (); i++)
+      d_blocks[i]->detail()->set_done (false);		// reset any done flags
+
+    for(unsigned i = 0; i < d_blocks.size (); i++)	// enable any drivers, etc.
+      d_blocks[i]->start();
+
+    // The blocks arrive from flowgraph::partition() in topological
+    // order, so one pass over them sweeps data from the sources to
+    // the sinks.  Each block is run repeatedly until it can make no
+    // more progress, so a pass moves the largest chunks the buffers
+    // allow; this is aimed at offline (e.g. file-to-file) graphs
+    // rather than real-time ones.
+
+    nalive = d_blocks.size ();
+    while(d_enabled && nalive > 0) {
+      bool made_progress = false;
+
+      for(unsigned bi = 0; bi < d_blocks.size (); bi++) {
+        if(boost::this_thread::interruption_requested())
+          goto out_of_here;
+
+        block *m = d_blocks[bi].get ();
+        block_detail *d = m->detail().get ();
+
+        if(d->done ())
+          continue;
+
+        // service any pending messages before running the block
+        BOOST_FOREACH(basic_block::msg_queue_map_t::value_type &q, m->msg_queue) {
+          if(m->dispatch_pending(q.first))
+            made_progress = true;
+        }
+
+        LOG(*d_log << std::endl << m);
+
+        // run this block for as long as it can make progress
+        for(;;) {
+          block_status status = run_one_block(m, d,
+                                              ninput_items_required,
+                                              ninput_items,
+                                              input_items, output_items,
+                                              start_nitems_read, rtags,
+                                              d_max_noutput_items);
+          if(status == RAN) {
+            made_progress = true;
+            continue;
+          }
+          if(status == WERE_DONE) {
+            LOG(*d_log << "  were_done\n");
+            d->set_done (true);
+            nalive--;
+          }
+          break;
+        }
       }
+
+      // Nothing ran in a whole pass; we're waiting on something
+      // external (a live source, a message).  Sleep instead of
+      // spinning; the sleep is also an interruption point.
+      if(!made_progress)
+        boost::this_thread::sleep(boost::posix_time::microseconds(100));
     }
 
+  out_of_here:
     for(unsigned i = 0; i < d_blocks.size(); i++)    // disable any drivers, etc.
       d_blocks[i]->stop();
   }
@@ -33,8 +33,24 @@ namespace gr {
   typedef boost::shared_ptr<single_threaded_scheduler> single_threaded_scheduler_sptr;
 
   /*!
-   * \brief Simple scheduler for stream computations.
+   * \brief Run-to-completion scheduler for stream computations.
    * \ingroup internal
+   *
+   * Runs the blocks of one topologically sorted partition on a single
+   * thread, sweeping each pass from the sources toward the sinks and
+   * running every block until it can make no more progress before
+   * moving on.  Data therefore moves through the graph in the largest
+   * chunks the buffers allow, which suits offline (e.g. file-to-file)
+   * graphs; thread-per-block remains the better choice for real-time
+   * ones.  Select it by setting the GR_SCHEDULER environment variable
+   * to "STS"; separate partitions of the flow graph still run in
+   * parallel, one thread each.
+   *
+   * Because the iteration order is fixed and chunk sizes are capped
+   * at max_noutput_items, two runs of the same graph execute the same
+   * sequence of work calls, which makes this mode suitable for
+   * reproducible A/B benchmarking (see gr_benchmark and the
+   * sts_pin_threads preference).
    */
   class GR_RUNTIME_API single_threaded_scheduler
   {
@@ -46,19 +62,23 @@ namespace gr {
 
   private:
     const std::vector<block_sptr> d_blocks;
+    int d_max_noutput_items;
     volatile bool d_enabled;
     std::ofstream *d_log;
 
-    single_threaded_scheduler(const std::vector<block_sptr> &blocks);
+    single_threaded_scheduler(const std::vector<block_sptr> &blocks,
+                              int max_noutput_items);
 
     void main_loop();
 
     friend GR_RUNTIME_API single_threaded_scheduler_sptr
-      make_single_threaded_scheduler(const std::vector<block_sptr> &blocks);
+      make_single_threaded_scheduler(const std::vector<block_sptr> &blocks,
+                                     int max_noutput_items);
   };
 
   GR_RUNTIME_API single_threaded_scheduler_sptr
-  make_single_threaded_scheduler(const std::vector<block_sptr> &blocks);
+  make_single_threaded_scheduler(const std::vector<block_sptr> &blocks,
+                                 int max_noutput_items);
 
 } /* namespace gr */
 
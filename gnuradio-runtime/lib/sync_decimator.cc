@@ -54,7 +54,12 @@ namespace gr {
   int
   sync_decimator::fixed_rate_ninput_to_noutput(int ninput_items)
   {
-    return std::max(0, ninput_items - (int)history() + 1) / decimation();
+    // This runs once per scheduler iteration for every decimating
+    // block, so use the shift form when the factor allows it.
+    int navail = std::max(0, ninput_items - (int)history() + 1);
+    if(d_decimation_shift >= 0)
+      return navail >> d_decimation_shift;
+    return navail / decimation();
   }
 
   int
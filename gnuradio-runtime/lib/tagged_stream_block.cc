@@ -36,10 +36,17 @@ namespace gr {
     : block(name, input_signature, output_signature),
       d_length_tag_key(pmt::string_to_symbol(length_tag_key)),
       d_n_input_items_reqd(input_signature->min_streams(), 0),
+      d_multi_pdu(false),
       d_length_tag_key_str(length_tag_key)
   {
   }
 
+  void
+  tagged_stream_block::set_multi_pdu_mode(bool multi)
+  {
+    d_multi_pdu = multi;
+  }
+
   // This is evil hackery: We trick the scheduler into creating the right number of input items
   void
   tagged_stream_block::forecast(int noutput_items,
@@ -99,6 +106,10 @@ namespace gr {
       return work(noutput_items, ninput_items, input_items, output_items);
     }
 
+    if(d_multi_pdu) {
+      return general_work_multi(noutput_items, ninput_items, input_items, output_items);
+    }
+
     if(d_n_input_items_reqd[0] == 0) { // Otherwise, it's already set from a previous call
       std::vector<std::vector<tag_t> > tags(input_items.size(), std::vector<tag_t>());
       for(unsigned i = 0; i < input_items.size(); i++) {
@@ -143,4 +154,192 @@ namespace gr {
     return n_produced;
   }
 
+  int
+  tagged_stream_block::general_work_multi(int noutput_items,
+                                          gr_vector_int &ninput_items,
+                                          gr_vector_const_void_star &input_items,
+                                          gr_vector_void_star &output_items)
+  {
+    unsigned ninputs = input_items.size();
+
+    // The first PDU follows the same rules as the single-PDU path,
+    // including keeping d_n_input_items_reqd across calls once its
+    // length tags have been pruned.
+    if(d_n_input_items_reqd[0] == 0) {
+      std::vector<std::vector<tag_t> > tags(ninputs, std::vector<tag_t>());
+      for(unsigned i = 0; i < ninputs; i++) {
+        get_tags_in_range(tags[i], i, nitems_read(i), nitems_read(i)+1);
+      }
+      d_n_input_items_reqd.assign(ninputs, -1);
+      parse_length_tags(tags, d_n_input_items_reqd);
+    }
+    for(unsigned i = 0; i < ninputs; i++) {
+      if(d_n_input_items_reqd[i] == -1) {
+        GR_LOG_FATAL(d_logger, boost::format("Missing a required length tag on port %1% at item #%2%") % i % nitems_read(i));
+        throw std::runtime_error("Missing length tag.");
+      }
+      if(d_n_input_items_reqd[i] > ninput_items[i]) {
+        return 0;
+      }
+    }
+
+    int min_output_size = calculate_output_stream_length(d_n_input_items_reqd);
+    if(noutput_items < min_output_size) {
+      set_min_noutput_items(min_output_size);
+      return 0;
+    }
+    set_min_noutput_items(1);
+
+    // Gather further complete PDUs while both sides have room.  A PDU
+    // whose length tags are already pruned but which doesn't fit stays
+    // in d_n_input_items_reqd for the next call.
+    std::vector<gr_vector_int> pdu_ninput_items(1, d_n_input_items_reqd);
+    gr_vector_int in_offsets = d_n_input_items_reqd; // items claimed so far, per port
+    int nout_reqd = min_output_size;
+    bool leftover = false;
+
+    while(true) {
+      bool can_look = true;
+      for(unsigned i = 0; i < ninputs; i++) {
+        if(in_offsets[i] >= ninput_items[i]) {
+          can_look = false;
+        }
+      }
+      if(!can_look) {
+        break;
+      }
+
+      // Only gather on when every port carries the length tag key at
+      // the boundary; parse_length_tags() prunes the tags, so we must
+      // not parse a PDU some port can't describe yet.
+      std::vector<std::vector<tag_t> > tags(ninputs, std::vector<tag_t>());
+      bool have_all_tags = true;
+      for(unsigned i = 0; i < ninputs; i++) {
+        get_tags_in_range(tags[i], i,
+                          nitems_read(i) + in_offsets[i],
+                          nitems_read(i) + in_offsets[i] + 1);
+        bool found = false;
+        for(unsigned k = 0; k < tags[i].size(); k++) {
+          if(tags[i][k].key == d_length_tag_key) {
+            found = true;
+          }
+        }
+        if(!found) {
+          have_all_tags = false;
+        }
+      }
+      if(!have_all_tags) {
+        break;
+      }
+
+      gr_vector_int n_reqd(ninputs, -1);
+      parse_length_tags(tags, n_reqd);
+      bool parsed = true;
+      for(unsigned i = 0; i < ninputs; i++) {
+        if(n_reqd[i] == -1) {
+          parsed = false;
+        }
+      }
+      if(!parsed) { // a custom parse_length_tags() couldn't size it
+        d_n_input_items_reqd = n_reqd;
+        leftover = true;
+        break;
+      }
+
+      bool fits_input = true;
+      for(unsigned i = 0; i < ninputs; i++) {
+        if(in_offsets[i] + n_reqd[i] > ninput_items[i]) {
+          fits_input = false;
+        }
+      }
+      int pdu_output_size = calculate_output_stream_length(n_reqd);
+      if(!fits_input || nout_reqd + pdu_output_size > noutput_items) {
+        d_n_input_items_reqd = n_reqd;
+        leftover = true;
+        break;
+      }
+
+      pdu_ninput_items.push_back(n_reqd);
+      for(unsigned i = 0; i < ninputs; i++) {
+        in_offsets[i] += n_reqd[i];
+      }
+      nout_reqd += pdu_output_size;
+    }
+
+    // WORK CALLED HERE //
+    gr_vector_int pdu_noutput_items;
+    int n_produced = work_multi(noutput_items, pdu_ninput_items, pdu_noutput_items,
+                                input_items, output_items);
+    //////////////////////
+
+    if(n_produced == WORK_DONE) {
+      return n_produced;
+    }
+
+    size_t n_pdus_done = pdu_noutput_items.size();
+    if(n_pdus_done < pdu_ninput_items.size()) {
+      // work_multi() stopped early; offer the first unprocessed PDU
+      // again next call (its length tags are already pruned).
+      d_n_input_items_reqd = pdu_ninput_items[n_pdus_done];
+      leftover = true;
+    }
+
+    gr_vector_int n_consumed(ninputs, 0);
+    uint64_t out_offset = 0;
+    for(size_t n = 0; n < n_pdus_done; n++) {
+      for(unsigned i = 0; i < ninputs; i++) {
+        n_consumed[i] += pdu_ninput_items[n][i];
+      }
+      if(pdu_noutput_items[n] > 0) {
+        for(unsigned i = 0; i < output_items.size(); i++) {
+          add_item_tag(i, nitems_written(i) + out_offset,
+                       d_length_tag_key,
+                       pmt::from_long(pdu_noutput_items[n]));
+        }
+        out_offset += pdu_noutput_items[n];
+      }
+    }
+    for(unsigned i = 0; i < ninputs; i++) {
+      consume(i, n_consumed[i]);
+    }
+
+    if(!leftover) {
+      d_n_input_items_reqd.assign(ninputs, 0);
+    }
+
+    return n_produced;
+  }
+
+  int
+  tagged_stream_block::work_multi(int noutput_items,
+                                  const std::vector<gr_vector_int> &pdu_ninput_items,
+                                  gr_vector_int &pdu_noutput_items,
+                                  gr_vector_const_void_star &input_items,
+                                  gr_vector_void_star &output_items)
+  {
+    gr_vector_const_void_star in(input_items);
+    gr_vector_void_star out(output_items);
+    int n_produced_total = 0;
+
+    for(size_t n = 0; n < pdu_ninput_items.size(); n++) {
+      gr_vector_int pdu_items = pdu_ninput_items[n];
+
+      int n_produced = work(noutput_items - n_produced_total, pdu_items, in, out);
+      if(n_produced == WORK_DONE) {
+        return (n_produced_total > 0) ? n_produced_total : WORK_DONE;
+      }
+      pdu_noutput_items.push_back(n_produced);
+      n_produced_total += n_produced;
+
+      for(unsigned i = 0; i < in.size(); i++) {
+        in[i] = (const char*)in[i] + pdu_ninput_items[n][i] * input_signature()->sizeof_stream_item(i);
+      }
+      for(unsigned i = 0; i < out.size(); i++) {
+        out[i] = (char*)out[i] + n_produced * output_signature()->sizeof_stream_item(i);
+      }
+    }
+
+    return n_produced_total;
+  }
+
 }  /* namespace gr */
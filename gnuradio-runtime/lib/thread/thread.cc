@@ -104,13 +104,41 @@ namespace gr {
       return -1;
     }
     
-    int 
+    int
     set_thread_priority(gr_thread_t thread, int priority)
     {
       // Not implemented on Windows
       return -1;
     }
 
+    int
+    set_thread_sched(gr_thread_t thread, sched_policy policy, int priority)
+    {
+      // Scheduling classes are not exposed on Windows; fall back to
+      // the plain priority call.
+      return set_thread_priority(thread, priority);
+    }
+
+    sched_policy
+    thread_sched(gr_thread_t thread)
+    {
+      // Not implemented on Windows
+      return SCHED_POLICY_OTHER;
+    }
+
+    pi_mutex::pi_mutex()
+    {
+      // No priority inheritance on Windows; plain mutex.
+    }
+
+    pi_mutex::~pi_mutex()
+    {
+    }
+
+    void pi_mutex::lock() { d_mutex.lock(); }
+    void pi_mutex::unlock() { d_mutex.unlock(); }
+    bool pi_mutex::try_lock() { return d_mutex.try_lock(); }
+
   } /* namespace thread */
 } /* namespace gr */
 
@@ -171,13 +199,48 @@ namespace gr {
       return -1;
     }
     
-    int 
+    int
     set_thread_priority(gr_thread_t thread, int priority)
     {
       // Not implemented on OSX
       return -1;
     }
 
+    int
+    set_thread_sched(gr_thread_t thread, sched_policy policy, int priority)
+    {
+      // Not implemented on OSX
+      return -1;
+    }
+
+    sched_policy
+    thread_sched(gr_thread_t thread)
+    {
+      // Not implemented on OSX
+      return SCHED_POLICY_OTHER;
+    }
+
+    pi_mutex::pi_mutex()
+    {
+      pthread_mutexattr_t attr;
+      pthread_mutexattr_init(&attr);
+#ifdef PTHREAD_PRIO_INHERIT
+      // advisory; without the protocol we still have a working mutex
+      pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+#endif
+      pthread_mutex_init(&d_mutex, &attr);
+      pthread_mutexattr_destroy(&attr);
+    }
+
+    pi_mutex::~pi_mutex()
+    {
+      pthread_mutex_destroy(&d_mutex);
+    }
+
+    void pi_mutex::lock() { pthread_mutex_lock(&d_mutex); }
+    void pi_mutex::unlock() { pthread_mutex_unlock(&d_mutex); }
+    bool pi_mutex::try_lock() { return pthread_mutex_trylock(&d_mutex) == 0; }
+
   } /* namespace thread */
 } /* namespace gr */
 
@@ -185,6 +248,8 @@ namespace gr {
 
 #include <sstream>
 #include <stdexcept>
+#include <algorithm>
+#include <string.h>
 #include <pthread.h>
 
 namespace gr {
@@ -274,7 +339,7 @@ namespace gr {
       return (ret==0)?priority:ret;
     }
     
-    int 
+    int
     set_thread_priority(gr_thread_t thread, int priority)
     {
       int policy;
@@ -284,6 +349,63 @@ namespace gr {
       return pthread_setschedparam(thread, policy, &param);
     }
 
+    int
+    set_thread_sched(gr_thread_t thread, sched_policy policy, int priority)
+    {
+      int native;
+      switch(policy) {
+      case SCHED_POLICY_FIFO: native = SCHED_FIFO;  break;
+      case SCHED_POLICY_RR:   native = SCHED_RR;    break;
+      default:                native = SCHED_OTHER; break;
+      }
+
+      struct sched_param param;
+      memset(&param, 0, sizeof(param));
+      if(native != SCHED_OTHER) {
+        // clamp to the legal range of the class; SCHED_OTHER only
+        // accepts priority 0
+        int lo = sched_get_priority_min(native);
+        int hi = sched_get_priority_max(native);
+        param.sched_priority = std::max(lo, std::min(hi, priority));
+      }
+      return pthread_setschedparam(thread, native, &param);
+    }
+
+    sched_policy
+    thread_sched(gr_thread_t thread)
+    {
+      int native;
+      struct sched_param param;
+      if(pthread_getschedparam(thread, &native, &param) != 0)
+        return SCHED_POLICY_OTHER;
+      if(native == SCHED_FIFO)
+        return SCHED_POLICY_FIFO;
+      if(native == SCHED_RR)
+        return SCHED_POLICY_RR;
+      return SCHED_POLICY_OTHER;
+    }
+
+    pi_mutex::pi_mutex()
+    {
+      pthread_mutexattr_t attr;
+      pthread_mutexattr_init(&attr);
+#ifdef PTHREAD_PRIO_INHERIT
+      // advisory; without the protocol we still have a working mutex
+      pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+#endif
+      pthread_mutex_init(&d_mutex, &attr);
+      pthread_mutexattr_destroy(&attr);
+    }
+
+    pi_mutex::~pi_mutex()
+    {
+      pthread_mutex_destroy(&d_mutex);
+    }
+
+    void pi_mutex::lock() { pthread_mutex_lock(&d_mutex); }
+    void pi_mutex::unlock() { pthread_mutex_unlock(&d_mutex); }
+    bool pi_mutex::try_lock() { return pthread_mutex_trylock(&d_mutex) == 0; }
+
   } /* namespace thread */
 } /* namespace gr */
 
@@ -26,6 +26,8 @@
 
 #include "top_block_impl.h"
 #include <gnuradio/top_block.h>
+#include <gnuradio/buffer_stats.h>
+#include <gnuradio/work_watchdog.h>
 #include <gnuradio/io_signature.h>
 #include <gnuradio/prefs.h>
 #include <gnuradio/high_res_timer.h>
@@ -109,6 +111,24 @@ namespace gr {
     return d_impl->msg_edge_list();
   }
 
+  std::string
+  top_block::buffer_fill_list()
+  {
+    return buffer_stats::singleton()->fill_list();
+  }
+
+  std::string
+  top_block::buffer_peak_list()
+  {
+    return buffer_stats::singleton()->peak_list();
+  }
+
+  std::string
+  top_block::work_stall_list()
+  {
+    return work_watchdog::singleton()->stall_list();
+  }
+
   void
   top_block::dump()
   {
@@ -169,6 +189,37 @@ namespace gr {
            RPC_PRIVLVL_MIN, DISPNULL)));
     }
 
+    if(prefs::singleton()->get_bool("ControlPort", "buffer_stats", false)) {
+      buffer_stats::singleton()->start(
+        prefs::singleton()->get_long("ControlPort", "buffer_stats_period_ms", 10));
+
+      add_rpc_variable(
+        rpcbasic_sptr(new rpcbasic_register_get<top_block, std::string>(
+	   alias(), "buffer fills",
+	   &top_block::buffer_fill_list,
+           pmt::mp(""), pmt::mp(""), pmt::mp(""),
+           "edges", "Current fill level of every stream buffer",
+           RPC_PRIVLVL_MIN, DISPNULL)));
+
+      add_rpc_variable(
+        rpcbasic_sptr(new rpcbasic_register_get<top_block, std::string>(
+	   alias(), "buffer peaks",
+	   &top_block::buffer_peak_list,
+           pmt::mp(""), pmt::mp(""), pmt::mp(""),
+           "edges", "Peak fill of every stream buffer since last query",
+           RPC_PRIVLVL_MIN, DISPNULL)));
+    }
+
+    if(work_watchdog::singleton()->enabled()) {
+      add_rpc_variable(
+        rpcbasic_sptr(new rpcbasic_register_get<top_block, std::string>(
+	   alias(), "work stalls",
+	   &top_block::work_stall_list,
+           pmt::mp(""), pmt::mp(""), pmt::mp(""),
+           "blocks", "Per-block count of work() deadline overruns",
+           RPC_PRIVLVL_MIN, DISPNULL)));
+    }
+
 #ifdef GNURADIO_HRT_USE_CLOCK_GETTIME
     std::string initial_clock = prefs::singleton()->get_string("PerfCounters", "clock", "thread");
     if(initial_clock.compare("thread") == 0){
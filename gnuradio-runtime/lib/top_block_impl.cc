@@ -28,6 +28,7 @@
 #include "flat_flowgraph.h"
 #include "scheduler_sts.h"
 #include "scheduler_tpb.h"
+#include "scheduler_wsp.h"
 #include <gnuradio/top_block.h>
 #include <gnuradio/prefs.h>
 
@@ -49,7 +50,8 @@ namespace gr {
     scheduler_maker f;
   } scheduler_table[] = {
     { "TPB", scheduler_tpb::make },    // first entry is default
-    { "STS", scheduler_sts::make }
+    { "STS", scheduler_sts::make },
+    { "WSP", scheduler_wsp::make }
   };
 
   static scheduler_sptr
@@ -105,6 +107,13 @@ namespace gr {
     // Create new flat flow graph by flattening hierarchy
     d_ffg = d_owner->flatten();
 
+    // Alias away transparent pass-through blocks
+    d_ffg->collapse_transparent_blocks();
+
+    // Optionally fuse chains of kernel-registered 1:1 blocks
+    if(prefs::singleton()->get_bool("Scheduler", "fuse_kernel_chains", false))
+      d_ffg->fuse_kernel_chains();
+
     // Validate new simple flow graph and wire it up
     d_ffg->validate();
     d_ffg->setup_connections();
@@ -115,6 +124,11 @@ namespace gr {
     if(p->get_bool("ControlPort", "on", false) && p->get_bool("PerfCounters", "export", false))
       d_ffg->enable_pc_rpc();
 
+    // Optionally compute a core placement for the block threads from
+    // the flowgraph topology.
+    if(p->get_bool("Scheduler", "auto_core_placement", false))
+      d_ffg->assign_core_placement();
+
     d_scheduler = make_scheduler(d_ffg, d_max_noutput_items);
     d_state = RUNNING;
   }
@@ -167,20 +181,65 @@ namespace gr {
   void
   top_block_impl::restart()
   {
-    stop();		     // Stop scheduler and wait for completion
-    wait();
-
     // Create new simple flow graph
     flat_flowgraph_sptr new_ffg = d_owner->flatten();
+    new_ffg->collapse_transparent_blocks();
+    if(prefs::singleton()->get_bool("Scheduler", "fuse_kernel_chains", false))
+      new_ffg->fuse_kernel_chains();
     new_ffg->validate();		 // check consistency, sanity, etc
+
+    // When only a few connections changed, rewire just those blocks
+    // and leave the others running.
+    if(try_partial_restart(new_ffg))
+      return;
+
+    stop();		     // Stop scheduler and wait for completion
+    wait();
+
     new_ffg->merge_connections(d_ffg);   // reuse buffers, etc
     d_ffg = new_ffg;
 
+    // Recompute the placement; the reused block details now carry
+    // measured work times from the previous run.
+    if(prefs::singleton()->get_bool("Scheduler", "auto_core_placement", false))
+      d_ffg->assign_core_placement();
+
     // Create a new scheduler to execute it
     d_scheduler = make_scheduler(d_ffg, d_max_noutput_items);
     d_state = RUNNING;
   }
 
+  bool
+  top_block_impl::try_partial_restart(flat_flowgraph_sptr new_ffg)
+  {
+    basic_block_vector_t changed_old, rewire;
+    if(!d_scheduler ||
+       !new_ffg->calc_changed_blocks(d_ffg, changed_old, rewire))
+      return false;
+
+    if(changed_old.empty() && rewire.empty()) {	// same wiring; nothing to do
+      d_ffg = new_ffg;
+      return true;
+    }
+
+    // Blocks leaving the old graph have their threads stopped; blocks
+    // used in the new one are rewired and then (re)started.
+    block_vector_t to_stop, to_start;
+    for(size_t i = 0; i < changed_old.size(); i++)
+      to_stop.push_back(cast_to_block_sptr(changed_old[i]));
+    for(size_t i = 0; i < rewire.size(); i++)
+      to_start.push_back(cast_to_block_sptr(rewire[i]));
+
+    if(!d_scheduler->stop_blocks(to_stop))
+      return false;		// scheduler wants the full restart
+
+    new_ffg->merge_block_connections(d_ffg, rewire);
+    d_ffg = new_ffg;
+
+    d_scheduler->start_blocks(to_start, d_max_noutput_items);
+    return true;
+  }
+
   std::string
   top_block_impl::edge_list()
   {
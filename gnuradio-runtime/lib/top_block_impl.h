@@ -86,6 +86,14 @@ namespace gr {
 
   private:
     void restart();
+
+    /* Try to rewire only the blocks whose connections changed,
+     * leaving the rest of the graph running.  Returns false when the
+     * change set can't be determined or the scheduler can't restart
+     * individual blocks, in which case restart() does its usual full
+     * stop/merge/start cycle.
+     */
+    bool try_partial_restart(flat_flowgraph_sptr new_ffg);
   };
 
 } /* namespace gr */
@@ -37,6 +37,49 @@ namespace gr {
    */
   void
   tpb_detail::notify_upstream(block_detail *d)
+  {
+    // Batch wakeups when the block asked for a notification interval
+    // greater than one; only the owning thread touches the pending
+    // counters, so no lock is needed here.
+    if(notify_interval > 1 && ++pending_upstream < notify_interval)
+      return;
+
+    pending_upstream = 0;
+    do_notify_upstream(d);
+  }
+
+  void
+  tpb_detail::notify_downstream(block_detail *d)
+  {
+    if(notify_interval > 1 && ++pending_downstream < notify_interval)
+      return;
+
+    pending_downstream = 0;
+    do_notify_downstream(d);
+  }
+
+  void
+  tpb_detail::notify_neighbors(block_detail *d)
+  {
+    notify_downstream(d);
+    notify_upstream(d);
+  }
+
+  void
+  tpb_detail::flush_notifications(block_detail *d)
+  {
+    if(pending_downstream > 0) {
+      pending_downstream = 0;
+      do_notify_downstream(d);
+    }
+    if(pending_upstream > 0) {
+      pending_upstream = 0;
+      do_notify_upstream(d);
+    }
+  }
+
+  void
+  tpb_detail::do_notify_upstream(block_detail *d)
   {
     // For each of our inputs, tell the guy upstream that we've
     // consumed some input, and that he most likely has more output
@@ -49,7 +92,7 @@ namespace gr {
   }
 
   void
-  tpb_detail::notify_downstream(block_detail *d)
+  tpb_detail::do_notify_downstream(block_detail *d)
   {
     // For each of our outputs, tell the guys downstream that they
     // have new input available.
@@ -61,11 +104,4 @@ namespace gr {
     }
   }
 
-  void
-  tpb_detail::notify_neighbors(block_detail *d)
-  {
-    notify_downstream(d);
-    notify_upstream(d);
-  }
-
 } /* namespace gr */
@@ -77,11 +77,18 @@ namespace gr {
       gr::thread::thread_bind_to_processor(d->thread, block->processor_affinity());
     }
 
-    // Set thread priority if it was set before fg was started
-    if(block->thread_priority() > 0) {
+    // Set thread scheduling class/priority if set before fg was started
+    if(block->thread_sched_policy() != gr::thread::SCHED_POLICY_OTHER) {
+      gr::thread::set_thread_sched(d->thread, block->thread_sched_policy(),
+                                   block->thread_priority());
+    }
+    else if(block->thread_priority() > 0) {
       gr::thread::set_thread_priority(d->thread, block->thread_priority());
     }
 
+    // Pick up the block's neighbor notification batching setting.
+    d->d_tpb.notify_interval = block->notification_interval();
+
     while(1) {
       boost::this_thread::interruption_point();
 
@@ -91,9 +98,7 @@ namespace gr {
         // any messages. This is mostly a protection for the unknown
         // startup sequence of the threads.
         if(block->has_msg_handler(i.first)) {
-          while((msg = block->delete_head_nowait(i.first))) {
-            block->dispatch_msg(i.first,msg);
-          }
+          block->dispatch_pending(i.first);
         }
         else {
           // If we don't have a handler but are building up messages,
@@ -125,10 +130,16 @@ namespace gr {
 
       case block_executor::DONE:		// Game over.
         d->d_tpb.notify_neighbors(d);
+        d->d_tpb.flush_notifications(d);
         return;
 
       case block_executor::BLKD_IN:		// Wait for input.
       {
+        // Don't go to sleep owing neighbors a deferred wakeup.
+        d->d_tpb.flush_notifications(d);
+#ifdef GR_PERFORMANCE_COUNTERS
+        gr::high_res_timer_type blkd_start = gr::high_res_timer_now_perfmon();
+#endif
         gr::thread::scoped_lock guard(d->d_tpb.mutex);
         while(!d->d_tpb.input_changed) {
 
@@ -139,11 +150,9 @@ namespace gr {
           // handle all pending messages
           BOOST_FOREACH(basic_block::msg_queue_map_t::value_type &i, block->msg_queue) {
             if(block->has_msg_handler(i.first)) {
-                while((msg = block->delete_head_nowait(i.first))) {
-                  guard.unlock();			// release lock while processing msg
-                  block->dispatch_msg(i.first, msg);
-                  guard.lock();
-                }
+                guard.unlock();			// release lock while processing msgs
+                block->dispatch_pending(i.first);
+                guard.lock();
             }
             else {
                 // leave msg in queue if no handler is defined
@@ -158,11 +167,19 @@ namespace gr {
 	    return;
 	  }
         }
+#ifdef GR_PERFORMANCE_COUNTERS
+        d->pc_record_blocked_time(gr::high_res_timer_now_perfmon() - blkd_start, true);
+        d->pc_record_wakeup();
+#endif
       }
       break;
 
       case block_executor::BLKD_OUT:	// Wait for output buffer space.
       {
+	d->d_tpb.flush_notifications(d);
+#ifdef GR_PERFORMANCE_COUNTERS
+	gr::high_res_timer_type blkd_start = gr::high_res_timer_now_perfmon();
+#endif
 	gr::thread::scoped_lock guard(d->d_tpb.mutex);
 	while(!d->d_tpb.output_changed) {
 	  // wait for output room or message
@@ -172,11 +189,9 @@ namespace gr {
 	  // handle all pending messages
           BOOST_FOREACH(basic_block::msg_queue_map_t::value_type &i, block->msg_queue) {
             if(block->has_msg_handler(i.first)) {
-                while((msg = block->delete_head_nowait(i.first))) {
-                  guard.unlock();			// release lock while processing msg
-                  block->dispatch_msg(i.first, msg);
-                  guard.lock();
-                }
+                guard.unlock();			// release lock while processing msgs
+                block->dispatch_pending(i.first);
+                guard.lock();
             }
             else {
                 // leave msg in queue if no handler is defined
@@ -188,6 +203,10 @@ namespace gr {
                 }
             }
         }
+#ifdef GR_PERFORMANCE_COUNTERS
+	d->pc_record_blocked_time(gr::high_res_timer_now_perfmon() - blkd_start, false);
+	d->pc_record_wakeup();
+#endif
       }
       break;
 
@@ -34,11 +34,17 @@
 #include "vmcircbuf_prefs.h"
 #include "local_sighandler.h"
 
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
 // all the factories we know about
 #include "vmcircbuf_createfilemapping.h"
 #include "vmcircbuf_sysv_shm.h"
 #include "vmcircbuf_mmap_shm_open.h"
 #include "vmcircbuf_mmap_tmpfile.h"
+#include "vmcircbuf_hugepage.h"
 
 gr::thread::mutex s_vm_mutex;
 
@@ -111,6 +117,10 @@ namespace gr {
     result.push_back(gr::vmcircbuf_mmap_shm_open_factory::singleton());
 #endif
     result.push_back (gr::vmcircbuf_mmap_tmpfile_factory::singleton());
+#ifdef TRY_SHM_VMCIRCBUF
+    // Last on purpose: only used when named in vmcircbuf_default_factory.
+    result.push_back(gr::vmcircbuf_hugepage_factory::singleton());
+#endif
 
     return result;
   }
@@ -122,6 +132,32 @@ namespace gr {
     s_default_factory = f;
   }
 
+  bool
+  vmcircbuf_sysconfig::bind_to_node(void *base, size_t size, int node)
+  {
+#if defined(__linux__) && defined(SYS_mbind)
+    // Avoid a hard libnuma dependency; mbind(2) is all we need.
+    // These match the values in <numaif.h>.
+    const int GR_MPOL_PREFERRED = 1;
+    const unsigned GR_MPOL_MF_MOVE = (1 << 1);
+
+    if(base == 0 || node < 0 || node >= (int)(8 * sizeof(unsigned long)))
+      return false;
+
+    unsigned long nodemask = 1UL << node;
+    long r = syscall(SYS_mbind, base, (unsigned long)size,
+                     GR_MPOL_PREFERRED, &nodemask,
+                     (unsigned long)(8 * sizeof(nodemask)),
+                     GR_MPOL_MF_MOVE);
+    return r == 0;
+#else
+    (void)base;
+    (void)size;
+    (void)node;
+    return false;
+#endif
+  }
+
 
   // ------------------------------------------------------------------------
   //		    test code for vmcircbuf factories
@@ -98,6 +98,20 @@ namespace gr {
     static int granularity()         { return get_default_factory()->granularity(); }
     static vmcircbuf *make(int size) { return get_default_factory()->make(size);    }
 
+    /*!
+     * \brief Bind an address range to a NUMA node.
+     *
+     * Applies a preferred-node memory policy to [base, base+size) so
+     * that untouched pages fault in on \p node (first-touch binding)
+     * and already-faulted pages are migrated there.  For a doubly
+     * mapped circular buffer, pass the first copy and twice the
+     * buffer size so both mappings are covered.
+     *
+     * Returns true on success, false when NUMA binding is
+     * unsupported on this platform or the syscall fails.
+     */
+    static bool bind_to_node(void *base, size_t size, int node);
+
     // N.B. not all factories are guaranteed to work.
     // It's too hard to check everything at config time, so we check at runtime
     static std::vector<vmcircbuf_factory*> all_factories();
@@ -0,0 +1,210 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "vmcircbuf_hugepage.h"
+#include <stdexcept>
+#include <assert.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#ifdef HAVE_SYS_IPC_H
+#include <sys/ipc.h>
+#endif
+#ifdef HAVE_SYS_SHM_H
+#include <sys/shm.h>
+#endif
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "pagesize.h"
+
+// SHM_HUGETLB is Linux-specific and may be missing from older headers.
+#if defined(__linux__) && !defined(SHM_HUGETLB)
+#define SHM_HUGETLB 04000
+#endif
+
+#define MAX_HUGEPAGE_ATTEMPTS 3
+
+namespace gr {
+
+  /*
+   * Return the system huge page size in bytes, or 0 if unknown.
+   * Parsed once from /proc/meminfo ("Hugepagesize:    2048 kB").
+   */
+  static int
+  hugepagesize()
+  {
+#ifdef __linux__
+    static int s_size = -1;
+
+    if(s_size >= 0)
+      return s_size;
+
+    s_size = 0;
+    FILE *fp = fopen("/proc/meminfo", "r");
+    if(fp) {
+      char line[256];
+      while(fgets(line, sizeof(line), fp)) {
+        long kb;
+        if(sscanf(line, "Hugepagesize: %ld kB", &kb) == 1) {
+          s_size = (int)(kb * 1024);
+          break;
+        }
+      }
+      fclose(fp);
+    }
+    return s_size;
+#else
+    return 0;
+#endif
+  }
+
+  vmcircbuf_hugepage::vmcircbuf_hugepage(int size)
+    : gr::vmcircbuf(size)
+  {
+#if !defined(__linux__) || !defined(HAVE_SYS_SHM_H)
+    fprintf(stderr, "gr::vmcircbuf_hugepage: huge page shared memory is not available\n");
+    throw std::runtime_error("gr::vmcircbuf_hugepage");
+#else
+    gr::thread::scoped_lock guard(s_vm_mutex);
+
+    int hpagesize = hugepagesize();
+    if(hpagesize == 0)
+      hpagesize = gr::pagesize();
+
+    if(size <= 0 || (size % hpagesize) != 0) {
+      fprintf(stderr, "gr::vmcircbuf_hugepage: invalid size = %d\n", size);
+      throw std::runtime_error("gr::vmcircbuf_hugepage");
+    }
+
+    static bool s_warned = false;
+
+    // Attempt to allocate buffers (handle transient address-space races)
+    int attempts_remain(MAX_HUGEPAGE_ATTEMPTS);
+    while(attempts_remain-- > 0) {
+
+      int shmid = -1;
+      bool huge = true;
+
+      if((shmid = shmget(IPC_PRIVATE, size, IPC_CREAT | SHM_HUGETLB | 0700)) == -1) {
+        // No huge pages reserved (or no permission).  Fall back to
+        // normal pages rather than killing the flowgraph.
+        huge = false;
+        if(!s_warned) {
+          perror("gr::vmcircbuf_hugepage: shmget(SHM_HUGETLB), falling back to normal pages");
+          s_warned = true;
+        }
+        if((shmid = shmget(IPC_PRIVATE, size, IPC_CREAT | 0700)) == -1) {
+          perror("gr::vmcircbuf_hugepage: shmget");
+          continue;
+        }
+      }
+
+      // Attach once to find 2 * size worth of contiguous address
+      // space that the kernel likes, then remap both halves there.
+      void *first_copy = shmat(shmid, 0, 0);
+      if(first_copy == (void*)-1) {
+        perror("gr::vmcircbuf_hugepage: shmat (1)");
+        shmctl(shmid, IPC_RMID, 0);
+        continue;
+      }
+      shmdt(first_copy);
+
+      // There is a race between the detach and the attaches below if
+      // something else grabs the hole; just try again if it bites.
+      if(shmat(shmid, first_copy, 0) == (void*)-1) {
+        perror("gr::vmcircbuf_hugepage: shmat (2)");
+        shmctl(shmid, IPC_RMID, 0);
+        continue;
+      }
+
+      if(shmat(shmid, (char*)first_copy + size, 0) == (void*)-1) {
+        perror("gr::vmcircbuf_hugepage: shmat (3)");
+        shmdt(first_copy);
+        shmctl(shmid, IPC_RMID, 0);
+        continue;
+      }
+
+      shmctl(shmid, IPC_RMID, 0);
+
+      // Now remember the important stuff
+      d_base = (char*)first_copy;
+      d_size = size;
+      (void)huge;
+      break;
+    }
+    if(attempts_remain < 0) {
+      throw std::runtime_error("gr::vmcircbuf_hugepage");
+    }
+#endif
+  }
+
+  vmcircbuf_hugepage::~vmcircbuf_hugepage()
+  {
+#if defined(__linux__) && defined(HAVE_SYS_SHM_H)
+    gr::thread::scoped_lock guard(s_vm_mutex);
+
+    if(shmdt(d_base) == -1 || shmdt(d_base + d_size) == -1) {
+      perror("gr::vmcircbuf_hugepage: shmdt");
+    }
+#endif
+  }
+
+  // ----------------------------------------------------------------
+  //			The factory interface
+  // ----------------------------------------------------------------
+
+  gr::vmcircbuf_factory *vmcircbuf_hugepage_factory::s_the_factory = 0;
+
+  gr::vmcircbuf_factory *
+  vmcircbuf_hugepage_factory::singleton()
+  {
+    if(s_the_factory)
+      return s_the_factory;
+
+    s_the_factory = new gr::vmcircbuf_hugepage_factory();
+    return s_the_factory;
+  }
+
+  int
+  vmcircbuf_hugepage_factory::granularity()
+  {
+    int hpagesize = hugepagesize();
+    return hpagesize ? hpagesize : gr::pagesize();
+  }
+
+  gr::vmcircbuf *
+  vmcircbuf_hugepage_factory::make(int size)
+  {
+    try {
+      return new vmcircbuf_hugepage(size);
+    }
+    catch (...) {
+      return 0;
+    }
+  }
+
+} /* namespace gr */
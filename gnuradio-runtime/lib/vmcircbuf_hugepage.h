@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef GR_VMCIRCBUF_HUGEPAGE_H
+#define GR_VMCIRCBUF_HUGEPAGE_H
+
+#include <gnuradio/api.h>
+#include "vmcircbuf.h"
+
+namespace gr {
+
+  /*!
+   * \brief concrete class to implement circular buffers backed by
+   * huge pages (SysV shm with SHM_HUGETLB)
+   * \ingroup internal
+   *
+   * Backing the double mapping with 2MB pages cuts TLB pressure for
+   * large stream buffers.  If no huge pages are available the
+   * constructor falls back to normal pages with a one-time warning,
+   * so selecting this factory never makes a flowgraph fail that
+   * would otherwise run.
+   */
+  class GR_RUNTIME_API vmcircbuf_hugepage : public gr::vmcircbuf
+  {
+  public:
+    vmcircbuf_hugepage(int size);
+    virtual ~vmcircbuf_hugepage();
+  };
+
+  /*!
+   * \brief concrete factory for huge-page backed circular buffers
+   *
+   * Not part of the automatic factory probe order; select it
+   * explicitly by setting vmcircbuf_default_factory to
+   * "gr::vmcircbuf_hugepage_factory" via gr::vmcircbuf_prefs.
+   */
+  class GR_RUNTIME_API vmcircbuf_hugepage_factory : public gr::vmcircbuf_factory
+  {
+  private:
+    static gr::vmcircbuf_factory *s_the_factory;
+
+  public:
+    static gr::vmcircbuf_factory *singleton();
+
+    virtual const char *name() const { return "gr::vmcircbuf_hugepage_factory"; }
+
+    /*!
+     * \brief return granularity of mapping: the system huge page
+     * size, typically 2MB
+     */
+    virtual int granularity();
+
+    /*!
+     * \brief return a gr::vmcircbuf, or 0 if unable.
+     *
+     * Call this to create a doubly mapped circular buffer.
+     */
+    virtual gr::vmcircbuf *make(int size);
+  };
+
+} /* namespace gr */
+
+#endif /* GR_VMCIRCBUF_HUGEPAGE_H */
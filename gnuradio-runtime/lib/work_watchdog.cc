@@ -0,0 +1,148 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/work_watchdog.h>
+#include <gnuradio/logger.h>
+#include <gnuradio/prefs.h>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <sstream>
+
+namespace gr {
+
+  work_watchdog *
+  work_watchdog::singleton()
+  {
+    static work_watchdog instance;
+    return &instance;
+  }
+
+  work_watchdog::work_watchdog()
+    : d_finished(false)
+  {
+    prefs *p = prefs::singleton();
+    d_enabled = p->get_bool("Watchdog", "enable", false);
+    d_deadline_ms = p->get_long("Watchdog", "deadline_ms", 1000);
+    if(d_deadline_ms < 1)
+      d_deadline_ms = 1;
+
+    if(d_enabled)
+      d_thread = gr::thread::thread(boost::bind(&work_watchdog::run, this));
+  }
+
+  work_watchdog::~work_watchdog()
+  {
+    if(d_enabled) {
+      d_finished = true;
+      d_thread.interrupt();
+      d_thread.join();
+    }
+  }
+
+  work_watchdog::slot *
+  work_watchdog::attach(const std::string &name)
+  {
+    if(!d_enabled)
+      return 0;
+
+    slot *s = new slot();
+    s->name = name;
+    s->start = 0;
+
+    gr::thread::scoped_lock guard(d_mutex);
+    d_slots.push_back(s);
+    return s;
+  }
+
+  void
+  work_watchdog::detach(slot *s)
+  {
+    if(!s)
+      return;
+
+    gr::thread::scoped_lock guard(d_mutex);
+    d_slots.erase(std::find(d_slots.begin(), d_slots.end(), s));
+    d_reported.erase(s);
+    delete s;
+  }
+
+  void
+  work_watchdog::run()
+  {
+    GR_LOG_GETLOGGER(LOG, "gr_log.work_watchdog");
+
+    // scan often enough to catch an overrun soon after the deadline
+    long period_ms = std::min(std::max(d_deadline_ms/4, 1L), 100L);
+    const high_res_timer_type deadline =
+      high_res_timer_tps()/1000 * d_deadline_ms;
+
+    try {
+      while(!d_finished) {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(period_ms));
+
+        gr::thread::scoped_lock guard(d_mutex);
+        high_res_timer_type now = high_res_timer_now();
+
+        for(size_t i = 0; i < d_slots.size(); i++) {
+          slot *s = d_slots[i];
+          high_res_timer_type start = s->start;
+
+          if(start == 0 || now - start < deadline) {
+            // not stalled (any more): arm for the next overrun
+            d_reported.erase(s);
+            continue;
+          }
+
+          if(d_reported[s] == start)
+            continue;		// this stall was already reported
+          d_reported[s] = start;
+          d_stalls[s->name]++;
+
+          long ms = (long)((now - start)/(high_res_timer_tps()/1000));
+          GR_LOG_WARN(LOG, str(boost::format(
+            "block %s has been in work() for %d ms (deadline %d ms)")
+            % s->name % ms % d_deadline_ms));
+        }
+      }
+    }
+    catch(boost::thread_interrupted&) {
+    }
+  }
+
+  std::string
+  work_watchdog::stall_list()
+  {
+    gr::thread::scoped_lock guard(d_mutex);
+
+    std::stringstream str;
+    std::map<std::string, long>::iterator it;
+    for(it = d_stalls.begin(); it != d_stalls.end(); it++) {
+      str << boost::format("%s: %d\n") % it->first % it->second;
+    }
+    return str.str();
+  }
+
+} /* namespace gr */
@@ -49,6 +49,8 @@ class gr::block : public gr::basic_block
   unsigned sample_delay(int which) const;
 
   int  output_multiple () const;
+  void set_chunk_autotune(bool enable);
+  bool chunk_autotune() const;
   double relative_rate () const;
 
   bool start();
@@ -64,6 +66,10 @@ class gr::block : public gr::basic_block
   bool is_set_max_noutput_items();
   void set_min_noutput_items(int m);
   int min_noutput_items() const;
+  void set_notification_interval(unsigned int n);
+  unsigned int notification_interval() const;
+  void set_transparent(bool transparent);
+  bool transparent() const;
 
   // Methods to manage block's min/max buffer sizes.
   long max_output_buffer(int i);
@@ -96,6 +102,10 @@ class gr::block : public gr::basic_block
   float pc_work_time_avg();
   float pc_work_time_var();
   float pc_work_time_total();
+  float pc_nwork_calls();
+  float pc_nwakeups();
+  float pc_input_blocked_time_total();
+  float pc_output_blocked_time_total();
 
   // Methods to manage processor affinity.
   void set_processor_affinity(const std::vector<int> &mask);
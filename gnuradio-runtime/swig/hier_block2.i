@@ -91,6 +91,9 @@ namespace gr {
     void unset_processor_affinity();
     std::vector<int> processor_affinity();
 
+    int set_thread_priority(int priority);
+    int thread_priority();
+
     gr::hier_block2_sptr to_hier_block2(); // Needed for Python type coercion
   };
 
@@ -66,6 +66,16 @@ namespace gr {
       virtual void set_reference(float reference) = 0;
       virtual void set_gain(float gain) = 0;
       virtual void set_max_gain(float max_gain) = 0;
+
+      /*!
+       * Set the block size for block-mode gain updates. When nonzero,
+       * the attack/decay decision and gain update happen once per
+       * block of this many samples from the mean input magnitude, and
+       * the gain is applied with a single vector multiply. 0 (the
+       * default) keeps the per-sample loop.
+       */
+      virtual void set_block_size(int size) = 0;
+      virtual int block_size() const = 0;
     };
 
   } /* namespace analog */
@@ -62,6 +62,16 @@ namespace gr {
       virtual void set_reference(float reference) = 0;
       virtual void set_gain(float gain) = 0;
       virtual void set_max_gain(float max_gain) = 0;
+
+      /*!
+       * Set the block size for block-mode gain updates. When nonzero,
+       * the gain is updated once per block of this many samples from
+       * the mean input magnitude and applied with a single vector
+       * multiply instead of per sample, trading gain smoothness for
+       * throughput. 0 (the default) keeps the per-sample loop.
+       */
+      virtual void set_block_size(int size) = 0;
+      virtual int block_size() const = 0;
     };
 
   } /* namespace analog */
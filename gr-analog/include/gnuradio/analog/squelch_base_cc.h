@@ -32,6 +32,13 @@ namespace gr {
     /*!
      * \brief basic squelch block; to be subclassed for other squelches.
      * \ingroup level_blk
+     *
+     * \details
+     * When the squelch opens, a "squelch_sob" stream tag is attached
+     * to the first output item of the burst, and "squelch_eob" to the
+     * last item when it closes. With \p gate set, nothing at all is
+     * produced while closed, so the tags let downstream blocks track
+     * channel activity without processing silence.
      */
     class ANALOG_API squelch_base_cc : virtual public block
     {
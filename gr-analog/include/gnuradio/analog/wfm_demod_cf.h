@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_ANALOG_WFM_DEMOD_CF_H
+#define INCLUDED_ANALOG_WFM_DEMOD_CF_H
+
+#include <gnuradio/analog/api.h>
+#include <gnuradio/sync_decimator.h>
+
+namespace gr {
+  namespace analog {
+
+    /*!
+     * \brief Fused broadcast FM demodulator.
+     * \ingroup modulators_blk
+     *
+     * \details
+     * Demodulates a broadcast FM signal from complex baseband to
+     * audio in a single block: quadrature demodulation, the
+     * decimating audio low-pass filter, and FM deemphasis. This is
+     * equivalent to the wfm_rcv hierarchical block, but the three
+     * stages run back to back over each chunk of samples instead of
+     * as separate blocks, which avoids two buffer round trips through
+     * the scheduler per channel. Use it when running many FM channels
+     * in one process.
+     *
+     * The audio filter taps and deemphasis coefficients are computed
+     * the same way wfm_rcv computes them, so the output matches the
+     * hierarchical block.
+     */
+    class ANALOG_API wfm_demod_cf : virtual public sync_decimator
+    {
+    public:
+      // gr::analog::wfm_demod_cf::sptr
+      typedef boost::shared_ptr<wfm_demod_cf> sptr;
+
+      /*!
+       * Build the fused broadcast FM demodulator.
+       *
+       * \param quad_rate input sample rate of the complex baseband input.
+       * \param audio_decimation decimation from quad_rate to the audio rate.
+       * \param max_dev maximum deviation of the FM signal (Hz).
+       * \param tau deemphasis time constant in seconds (75us US, 50us EUR).
+       */
+      static sptr make(double quad_rate, int audio_decimation,
+		       double max_dev = 75e3, double tau = 75e-6);
+    };
+
+  } /* namespace analog */
+} /* namespace gr */
+
+#endif /* INCLUDED_ANALOG_WFM_DEMOD_CF_H */
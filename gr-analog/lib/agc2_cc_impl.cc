@@ -46,7 +46,8 @@ namespace gr {
                    io_signature::make(1, 1, sizeof(gr_complex)),
                    io_signature::make(1, 1, sizeof(gr_complex))),
 	kernel::agc2_cc(attack_rate, decay_rate,
-			reference, gain, 65536)
+			reference, gain, 65536),
+	d_block_size(0)
     {
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(gr_complex);
@@ -57,6 +58,12 @@ namespace gr {
     {
     }
 
+    void
+    agc2_cc_impl::set_block_size(int size)
+    {
+      d_block_size = std::max(0, size);
+    }
+
     int
     agc2_cc_impl::work(int noutput_items,
 		       gr_vector_const_void_star &input_items,
@@ -64,6 +71,40 @@ namespace gr {
     {
       const gr_complex *in = (const gr_complex*)input_items[0];
       gr_complex *out = (gr_complex*)output_items[0];
+
+      if(d_block_size > 0) {
+	if(d_mag.size() < (size_t)d_block_size)
+	  d_mag.resize(d_block_size);
+
+	for(int i = 0; i < noutput_items; i += d_block_size) {
+	  int num = std::min(d_block_size, noutput_items - i);
+
+	  // one attack/decay decision and gain update per chunk from
+	  // the mean input magnitude, scaled by the chunk length to
+	  // keep the per-sample loop's time constant
+	  volk_32fc_magnitude_32f(&d_mag[0], &in[i], num);
+	  float sum = 0;
+	  volk_32f_accumulator_s32f(&sum, &d_mag[0], num);
+
+	  float g = kernel::agc2_cc::gain();
+	  volk_32f_s32f_multiply_32f((float*)&out[i], (const float*)&in[i],
+				     g, 2 * num);
+
+	  float tmp = -reference() + g * sum / num;
+	  float rate = decay_rate();
+	  if(tmp > g)
+	    rate = attack_rate();
+	  g -= num * tmp * rate;
+
+	  if(g < 0.0)
+	    g = 10e-5;
+	  if(max_gain() > 0.0 && g > max_gain())
+	    g = max_gain();
+	  kernel::agc2_cc::set_gain(g);
+	}
+	return noutput_items;
+      }
+
       scaleN(out, in, noutput_items);
       return noutput_items;
     }
@@ -42,7 +42,8 @@ namespace gr {
       : sync_block("agc_cc",
                    io_signature::make(1, 1, sizeof(gr_complex)),
                    io_signature::make(1, 1, sizeof(gr_complex))),
-	kernel::agc_cc(rate, reference, gain, 65536)
+	kernel::agc_cc(rate, reference, gain, 65536),
+	d_block_size(0)
     {
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(gr_complex);
@@ -53,6 +54,12 @@ namespace gr {
     {
     }
 
+    void
+    agc_cc_impl::set_block_size(int size)
+    {
+      d_block_size = std::max(0, size);
+    }
+
     int
     agc_cc_impl::work(int noutput_items,
 		      gr_vector_const_void_star &input_items,
@@ -60,6 +67,33 @@ namespace gr {
     {
       const gr_complex *in = (const gr_complex*)input_items[0];
       gr_complex *out = (gr_complex*)output_items[0];
+
+      if(d_block_size > 0) {
+	if(d_mag.size() < (size_t)d_block_size)
+	  d_mag.resize(d_block_size);
+
+	for(int i = 0; i < noutput_items; i += d_block_size) {
+	  int num = std::min(d_block_size, noutput_items - i);
+
+	  // one gain per chunk: mean input magnitude, a single volk
+	  // multiply, then one loop update scaled by the chunk length
+	  // to keep the same time constant as the per-sample loop
+	  volk_32fc_magnitude_32f(&d_mag[0], &in[i], num);
+	  float sum = 0;
+	  volk_32f_accumulator_s32f(&sum, &d_mag[0], num);
+
+	  float g = kernel::agc_cc::gain();
+	  volk_32f_s32f_multiply_32f((float*)&out[i], (const float*)&in[i],
+				     g, 2 * num);
+
+	  g += num * rate() * (reference() - g * sum / num);
+	  if(max_gain() > 0.0 && g > max_gain())
+	    g = max_gain();
+	  kernel::agc_cc::set_gain(g);
+	}
+	return noutput_items;
+      }
+
       scaleN(out, in, noutput_items);
       return noutput_items;
     }
@@ -45,9 +45,16 @@ namespace gr {
       void set_gain(float gain) { kernel::agc_cc::set_gain(gain); }
       void set_max_gain(float max_gain) { kernel::agc_cc::set_max_gain(max_gain); }
 
+      void set_block_size(int size);
+      int block_size() const { return d_block_size; }
+
       int work(int noutput_items,
 	       gr_vector_const_void_star &input_items,
 	       gr_vector_void_star &output_items);
+
+    private:
+      int d_block_size;
+      std::vector<float> d_mag;
     };
 
   } /* namespace analog */
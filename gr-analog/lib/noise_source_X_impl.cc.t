@@ -46,7 +46,8 @@ namespace gr {
 		    io_signature::make(1, 1, sizeof(@TYPE@))),
       d_type(type),
       d_ampl(ampl),
-      d_rng(seed)
+      d_rng(seed),
+      d_batch_rng((uint64_t)seed)
     {
     }
     
@@ -81,29 +82,40 @@ namespace gr {
 #if @IS_COMPLEX@	// complex?
 
       case GR_UNIFORM:
+	// batch-generate the raw deviates, then scale in a second
+	// vectorizable pass
+	d_scratch.resize(2*noutput_items);
+	d_batch_rng.uniform(&d_scratch[0], 2*noutput_items);
 	for(int i = 0; i < noutput_items; i++) {
-	  out[i] = gr_complex(d_ampl * ((d_rng.ran1() * 2.0) - 1.0),
-			      d_ampl * ((d_rng.ran1() * 2.0) - 1.0));
+	  out[i] = gr_complex(d_ampl * (d_scratch[2*i]*2.0f - 1.0f),
+			      d_ampl * (d_scratch[2*i+1]*2.0f - 1.0f));
 	}
 	break;
 
       case GR_GAUSSIAN:
+	d_scratch.resize(2*noutput_items);
+	d_batch_rng.gaussian(&d_scratch[0], 2*noutput_items);
 	for(int i = 0; i < noutput_items; i++) {
-	  out[i] = d_ampl * d_rng.rayleigh_complex();
+	  out[i] = gr_complex(d_ampl * d_scratch[2*i],
+			      d_ampl * d_scratch[2*i+1]);
 	}
 	break;
 
 #else			// nope...
 
       case GR_UNIFORM:
+	d_scratch.resize(noutput_items);
+	d_batch_rng.uniform(&d_scratch[0], noutput_items);
 	for(int i = 0; i < noutput_items; i++) {
-	  out[i] = (@TYPE@)(d_ampl * ((d_rng.ran1() * 2.0) - 1.0));
+	  out[i] = (@TYPE@)(d_ampl * (d_scratch[i]*2.0f - 1.0f));
 	}
 	break;
 
       case GR_GAUSSIAN:
+	d_scratch.resize(noutput_items);
+	d_batch_rng.gaussian(&d_scratch[0], noutput_items);
 	for(int i = 0; i < noutput_items; i++) {
-	  out[i] = (@TYPE@)(d_ampl * d_rng.gasdev());
+	  out[i] = (@TYPE@)(d_ampl * d_scratch[i]);
 	}
 	break;
 
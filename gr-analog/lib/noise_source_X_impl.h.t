@@ -27,6 +27,8 @@
 
 #include <gnuradio/analog/@BASE_NAME@.h>
 #include <gnuradio/random.h>
+#include <gnuradio/philox_random.h>
+#include <vector>
 
 namespace gr {
   namespace analog {
@@ -36,6 +38,10 @@ namespace gr {
       noise_type_t d_type;
       float d_ampl;
       gr::random d_rng;
+      // batched counter-based generator for the uniform and Gaussian
+      // types; the scalar d_rng still serves the others
+      gr::philox_random d_batch_rng;
+      std::vector<float> d_scratch;
 
     public:
       @IMPL_NAME@(noise_type_t type, float ampl, long seed = 0);
@@ -107,22 +107,32 @@ namespace gr {
 
       float error;
       float t_imag, t_real;
+      static const int chunk = 512;
+      float sample_phase[chunk];
 
-      for(int i = 0; i < noutput_items; i++) {
-	gr::sincosf(d_phase, &t_imag, &t_real);
-	optr[i] = iptr[i] * gr_complex(t_real, -t_imag);
+      // batch the loop-independent sample phases through the
+      // vectorized atan2; the loop recurrence itself stays scalar
+      for(int n = 0; n < noutput_items; n += chunk) {
+	int num = std::min(chunk, noutput_items - n);
+	gr::fast_atan2f_vec(&iptr[n], sample_phase, num);
 
-	error = phase_detector(iptr[i], d_phase);
+	for(int k = 0; k < num; k++) {
+	  int i = n + k;
+	  gr::sincosf(d_phase, &t_imag, &t_real);
+	  optr[i] = iptr[i] * gr_complex(t_real, -t_imag);
 
-	advance_loop(error);
-	phase_wrap();
-	frequency_limit();
+	  error = mod_2pi(sample_phase[k] - d_phase);
 
-	d_locksig = d_locksig * (1.0 - d_alpha) + \
-	  d_alpha*(iptr[i].real() * t_real + iptr[i].imag() * t_imag);
+	  advance_loop(error);
+	  phase_wrap();
+	  frequency_limit();
 
-	if((d_squelch_enable) && !lock_detector())
-	  optr[i] = 0;
+	  d_locksig = d_locksig * (1.0 - d_alpha) + \
+	    d_alpha*(iptr[i].real() * t_real + iptr[i].imag() * t_imag);
+
+	  if((d_squelch_enable) && !lock_detector())
+	    optr[i] = 0;
+	}
       }
       return noutput_items;
     }
@@ -83,16 +83,25 @@ namespace gr {
       float *optr = (float*)output_items[0];
 
       float error;
-      int size = noutput_items;
+      static const int chunk = 512;
+      float sample_phase[chunk];
 
-      while(size-- > 0) {
-	*optr++ = d_freq;
+      // the phase of the raw samples does not depend on the loop
+      // state, so batch it through the vectorized atan2 and keep only
+      // the sequential loop recurrence scalar
+      for(int i = 0; i < noutput_items; i += chunk) {
+	int num = std::min(chunk, noutput_items - i);
+	gr::fast_atan2f_vec(&iptr[i], sample_phase, num);
 
-	error = phase_detector(*iptr++, d_phase);
+	for(int k = 0; k < num; k++) {
+	  optr[i + k] = d_freq;
 
-	advance_loop(error);
-	phase_wrap();
-	frequency_limit();
+	  error = mod_2pi(sample_phase[k] - d_phase);
+
+	  advance_loop(error);
+	  phase_wrap();
+	  frequency_limit();
+	}
       }
       return noutput_items;
     }
@@ -85,17 +85,25 @@ namespace gr {
 
       float error;
       float t_imag, t_real;
-      int size = noutput_items;
+      static const int chunk = 512;
+      float sample_phase[chunk];
 
-      while(size-- > 0) {
-	gr::sincosf(d_phase,&t_imag,&t_real);
-	*optr++ = gr_complex(t_real,t_imag);
+      // batch the loop-independent sample phases through the
+      // vectorized atan2; the loop recurrence itself stays scalar
+      for(int i = 0; i < noutput_items; i += chunk) {
+	int num = std::min(chunk, noutput_items - i);
+	gr::fast_atan2f_vec(&iptr[i], sample_phase, num);
 
-	error = phase_detector(*iptr++,d_phase);
+	for(int k = 0; k < num; k++) {
+	  gr::sincosf(d_phase,&t_imag,&t_real);
+	  optr[i + k] = gr_complex(t_real,t_imag);
 
-	advance_loop(error);
-	phase_wrap();
-	frequency_limit();
+	  error = mod_2pi(sample_phase[k] - d_phase);
+
+	  advance_loop(error);
+	  phase_wrap();
+	  frequency_limit();
+	}
       }
       return noutput_items;
     }
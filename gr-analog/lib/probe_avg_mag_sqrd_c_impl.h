@@ -25,6 +25,7 @@
 
 #include <gnuradio/analog/probe_avg_mag_sqrd_c.h>
 #include <gnuradio/filter/single_pole_iir.h>
+#include <gnuradio/thread/seqlock.h>
 
 namespace gr {
   namespace analog {
@@ -34,7 +35,8 @@ namespace gr {
     private:
       double d_threshold;
       bool d_unmuted;
-      double d_level;
+      // published without locking so pollers never contend with work()
+      thread::seqlock<double> d_level;
       filter::single_pole_iir<double,double,double> d_iir;
 
     public:
@@ -42,7 +44,7 @@ namespace gr {
       ~probe_avg_mag_sqrd_c_impl();
 
       bool unmuted() const { return d_unmuted; }
-      double level() const { return d_level; }
+      double level() const { return d_level.read(); }
 
       double threshold() const;
 
@@ -66,7 +66,7 @@ namespace gr {
       }
 
       d_unmuted = d_iir.prev_output() >= d_threshold;
-      d_level = d_iir.prev_output();
+      d_level.write(d_iir.prev_output());
       return noutput_items;
     }
 
@@ -64,11 +64,12 @@ namespace gr {
       gr_complex *in = (gr_complex*)input_items[0];
       float *out = (float*)output_items[0];
 
-      std::vector<gr_complex> tmp(noutput_items);
-      volk_32fc_x2_multiply_conjugate_32fc(&tmp[0], &in[1], &in[0], noutput_items);
-      for(int i = 0; i < noutput_items; i++) {
-        out[i] = d_gain * gr::fast_atan2f(imag(tmp[i]), real(tmp[i]));
-      }
+      if(d_tmp.size() < (size_t)noutput_items)
+	d_tmp.resize(noutput_items);
+
+      volk_32fc_x2_multiply_conjugate_32fc(&d_tmp[0], &in[1], &in[0], noutput_items);
+      gr::fast_atan2f_vec(&d_tmp[0], out, noutput_items);
+      volk_32f_s32f_multiply_32f(out, out, d_gain, noutput_items);
 
       return noutput_items;
     }
@@ -32,6 +32,7 @@ namespace gr {
     {
     private:
       float d_gain;
+      std::vector<gr_complex> d_tmp;
 
     public:
       quadrature_demod_cf_impl(float gain);
@@ -31,6 +31,8 @@
 #include <gnuradio/io_signature.h>
 #include <stdexcept>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <gnuradio/gr_complex.h>
 
 namespace gr {
@@ -50,24 +52,94 @@ namespace gr {
 		    io_signature::make(0, 0, 0),
 		    io_signature::make(1, 1, sizeof(@TYPE@))),
       d_sampling_freq(sampling_freq), d_waveform(waveform),
-      d_frequency(frequency), d_ampl(ampl), d_offset(offset)
+      d_frequency(frequency), d_ampl(ampl), d_offset(offset),
+      d_table_pos(0)
     {
       d_nco.set_freq(2 * M_PI * d_frequency / d_sampling_freq);
+      update_table();
     }
 
     @IMPL_NAME@::~@IMPL_NAME@()
     {
     }
 
+    void
+    @IMPL_NAME@::update_table()
+    {
+      d_table.clear();
+      d_table_pos = 0;
+
+      if(d_waveform == GR_CONST_WAVE)
+	return;
+
+      double f = d_frequency / d_sampling_freq;
+      f -= floor(f);
+      if(!(f >= 0.0 && f < 1.0))	// non-finite sample rate/frequency
+	return;
+
+      // Smallest period holding a whole number of waveform cycles;
+      // cap it so the table stays cache-resident.
+      static const unsigned int MAX_PERIOD = 16384;
+      unsigned int period = 0;
+      for(unsigned int n = 1; n <= MAX_PERIOD; n++) {
+	double cycles = f * n;
+	if(fabs(cycles - floor(cycles + 0.5)) < 1e-9) {
+	  period = n;
+	  break;
+	}
+      }
+      if(period == 0)
+	return;
+
+      // Render one period with the live NCO, which ends up back at
+      // its starting phase.
+      d_table.resize(period);
+      generate(&d_table[0], period);
+    }
+
     int
     @IMPL_NAME@::work(int noutput_items,
 		      gr_vector_const_void_star &input_items,
 		      gr_vector_void_star &output_items)
     {
       @TYPE@ *optr = (@TYPE@*)output_items[0];
+
+      if(!d_table.empty()) {
+	unsigned int period = d_table.size();
+	int w = std::min((unsigned int)noutput_items,
+			 period - d_table_pos);
+	memcpy(optr, &d_table[d_table_pos], w*sizeof(@TYPE@));
+
+	if(w < noutput_items) {
+	  // now at a period boundary: lay down one full period from
+	  // the table, then double the copied span out of the output
+	  // buffer itself so short periods still move in big chunks
+	  int start = w;
+	  int span = std::min(noutput_items - w, (int)period);
+	  memcpy(&optr[w], &d_table[0], span*sizeof(@TYPE@));
+	  w += span;
+	  while(w < noutput_items) {
+	    int c = std::min(noutput_items - w, span);
+	    memcpy(&optr[w], &optr[start], c*sizeof(@TYPE@));
+	    w += c;
+	    span += c;
+	  }
+	}
+
+	d_table_pos = (d_table_pos + noutput_items) % period;
+	return noutput_items;
+      }
+
+      generate(optr, noutput_items);
+      return noutput_items;
+    }
+
+    void
+    @IMPL_NAME@::generate(@TYPE@ *optr, int noutput_items)
+    {
       @TYPE@ t;
 
-      switch(d_waveform) { 
+      switch(d_waveform) {
 
 #if @IS_COMPLEX@	// complex?
 
@@ -213,8 +285,6 @@ namespace gr {
       default:
 	throw std::runtime_error("analog::sig_source: invalid waveform");
       }
-
-      return noutput_items;
     }
 
     void
@@ -222,12 +292,14 @@ namespace gr {
     {
       d_sampling_freq = sampling_freq;
       d_nco.set_freq (2 * M_PI * d_frequency / d_sampling_freq);
+      update_table();
     }
 
     void
     @NAME@::set_waveform(gr_waveform_t waveform)
     {
       d_waveform = waveform;
+      update_table();
     }
 
     void
@@ -235,18 +307,21 @@ namespace gr {
     {
       d_frequency = frequency;
       d_nco.set_freq(2 * M_PI * d_frequency / d_sampling_freq);
+      update_table();
     }
 
     void
     @NAME@::set_amplitude(double ampl)
     {
       d_ampl = ampl;
+      update_table();
     }
 
     void
     @NAME@::set_offset(@TYPE@ offset)
     {
       d_offset = offset;
+      update_table();
     }
 
   } /* namespace analog */
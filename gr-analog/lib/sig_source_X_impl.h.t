@@ -28,6 +28,7 @@
 #include <gnuradio/analog/@BASE_NAME@.h>
 #include <gnuradio/sync_block.h>
 #include <gnuradio/fxpt_nco.h>
+#include <vector>
 
 namespace gr {
   namespace analog {
@@ -42,6 +43,16 @@ namespace gr {
       @TYPE@		d_offset;
       gr::fxpt_nco	d_nco;
 
+      // When the frequency divides the sample rate rationally the
+      // waveform repeats after a whole number of samples; one period
+      // is rendered up front and work() plays it back with wrapped
+      // copies. Empty when no short period exists.
+      std::vector<@TYPE@> d_table;
+      unsigned int	d_table_pos;
+
+      void generate(@TYPE@ *optr, int noutput_items);
+      void update_table();
+
     public:
       @IMPL_NAME@(double sampling_freq, gr_waveform_t waveform,
 		  double wave_freq, double ampl, @TYPE@ offset = 0);
@@ -37,6 +37,8 @@ namespace gr {
     {
       set_ramp(ramp);
       set_gate(gate);
+      d_sob_key = pmt::intern("squelch_sob");
+      d_eob_key = pmt::intern("squelch_eob");
       d_state = ST_MUTED;
       d_envelope = d_ramp ? 0.0 : 1.0;
       d_ramped = 0;
@@ -95,12 +97,22 @@ namespace gr {
 	case ST_MUTED:
 	  if(!mute()) {
 	    d_state = d_ramp ? ST_ATTACK : ST_UNMUTED; // If not ramping, go straight to unmuted
+
+	    // tag the first item of the burst; with gating enabled
+	    // this is the only way downstream sees the transition
+	    add_item_tag(0, nitems_written(0) + j, d_sob_key,
+			 pmt::PMT_NIL, alias_pmt());
 	  }
 	  break;
 
 	case ST_UNMUTED:
 	  if(mute()) {
 	    d_state = d_ramp ? ST_DECAY : ST_MUTED;    // If not ramping, go straight to muted
+	    if(d_state == ST_MUTED && nitems_written(0) + j > 0) {
+	      // close on the last item actually produced
+	      add_item_tag(0, nitems_written(0) + j - 1, d_eob_key,
+			   pmt::PMT_NIL, alias_pmt());
+	    }
 	  }
 	  break;
 
@@ -116,6 +128,11 @@ namespace gr {
 	  d_envelope = 0.5-std::cos(M_PI*(--d_ramped)/d_ramp)/2.0; // FIXME: precalculate window for speed
 	  if(d_ramped == 0.0) {
 	    d_state = ST_MUTED;
+	    if(nitems_written(0) + j > 0) {
+	      // close on the last item actually produced
+	      add_item_tag(0, nitems_written(0) + j - 1, d_eob_key,
+			   pmt::PMT_NIL, alias_pmt());
+	    }
 	  }
 	  break;
 	};
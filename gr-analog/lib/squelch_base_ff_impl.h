@@ -37,6 +37,8 @@ namespace gr {
       double d_envelope;
       enum { ST_MUTED, ST_ATTACK, ST_UNMUTED, ST_DECAY } d_state;
 
+      pmt::pmt_t d_sob_key, d_eob_key;
+
     protected:
       virtual void update_state(const float &sample) {};
       virtual bool mute() const { return false; };
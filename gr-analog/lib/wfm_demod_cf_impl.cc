@@ -0,0 +1,128 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "wfm_demod_cf_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/math.h>
+#include <volk/volk.h>
+#include <math.h>
+
+namespace gr {
+  namespace analog {
+
+    wfm_demod_cf::sptr
+    wfm_demod_cf::make(double quad_rate, int audio_decimation,
+		       double max_dev, double tau)
+    {
+      return gnuradio::get_initial_sptr
+	(new wfm_demod_cf_impl(quad_rate, audio_decimation,
+			       max_dev, tau));
+    }
+
+    wfm_demod_cf_impl::wfm_demod_cf_impl(double quad_rate,
+					 int audio_decimation,
+					 double max_dev, double tau)
+      : sync_decimator("wfm_demod_cf",
+		       io_signature::make(1, 1, sizeof(gr_complex)),
+		       io_signature::make(1, 1, sizeof(float)),
+		       audio_decimation)
+    {
+      d_gain = quad_rate / (2.0 * M_PI * max_dev);
+
+      // same audio filter wfm_rcv builds in python
+      double audio_rate = quad_rate / audio_decimation;
+      double transition_width = audio_rate / 32;
+      std::vector<float> audio_taps =
+	filter::firdes::low_pass(1.0, quad_rate,
+				 audio_rate/2 - transition_width,
+				 transition_width,
+				 filter::firdes::WIN_HAMMING);
+      d_audio_filter = new filter::kernel::fir_filter_fff(audio_decimation,
+							  audio_taps);
+
+      // bilinear-transformed single-pole deemphasis at the audio
+      // rate, matching fm_emph.py
+      double w_pp = tan(1.0 / (tau * 2.0 * audio_rate));
+      double a1 = (w_pp - 1.0) / (w_pp + 1.0);
+      double b0 = w_pp / (1.0 + w_pp);
+      std::vector<double> fftaps(2), fbtaps(2);
+      fftaps[0] = b0;
+      fftaps[1] = b0;
+      fbtaps[0] = 1.0;
+      fbtaps[1] = a1;
+      d_deemph = new filter::kernel::iir_filter<float,float,double>(fftaps,
+								    fbtaps);
+
+      // one extra sample of history for the quadrature demod, the
+      // rest for the audio filter
+      set_history(audio_taps.size() + 1);
+
+      const int alignment_multiple =
+	volk_get_alignment() / sizeof(gr_complex);
+      set_alignment(std::max(1, alignment_multiple));
+    }
+
+    wfm_demod_cf_impl::~wfm_demod_cf_impl()
+    {
+      delete d_audio_filter;
+      delete d_deemph;
+    }
+
+    int
+    wfm_demod_cf_impl::work(int noutput_items,
+			    gr_vector_const_void_star &input_items,
+			    gr_vector_void_star &output_items)
+    {
+      const gr_complex *in = (const gr_complex*)input_items[0];
+      float *out = (float*)output_items[0];
+
+      // demodulated samples needed by the decimating audio filter,
+      // including the filter's look-back into history
+      const int ndemod = noutput_items * decimation()
+	+ d_audio_filter->ntaps() - 1;
+
+      if(d_tmp.size() < (size_t)ndemod) {
+	d_tmp.resize(ndemod);
+	d_demod.resize(ndemod);
+      }
+
+      // one pass per stage over the chunk: quadrature demod at the
+      // full rate, decimating FIR, then deemphasis at the audio rate
+      volk_32fc_x2_multiply_conjugate_32fc(&d_tmp[0], &in[1], &in[0], ndemod);
+      gr::fast_atan2f_vec(&d_tmp[0], &d_demod[0], ndemod);
+      volk_32f_s32f_multiply_32f(&d_demod[0], &d_demod[0], d_gain, ndemod);
+
+      d_audio_filter->filterNdec(out, &d_demod[0],
+				 noutput_items, decimation());
+
+      d_deemph->filter_n(out, out, noutput_items);
+
+      return noutput_items;
+    }
+
+  } /* namespace analog */
+} /* namespace gr */
@@ -0,0 +1,56 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_ANALOG_WFM_DEMOD_CF_IMPL_H
+#define INCLUDED_ANALOG_WFM_DEMOD_CF_IMPL_H
+
+#include <gnuradio/analog/wfm_demod_cf.h>
+#include <gnuradio/filter/fir_filter.h>
+#include <gnuradio/filter/iir_filter.h>
+
+namespace gr {
+  namespace analog {
+
+    class wfm_demod_cf_impl : public wfm_demod_cf
+    {
+    private:
+      float d_gain;
+      filter::kernel::fir_filter_fff *d_audio_filter;
+      filter::kernel::iir_filter<float,float,double> *d_deemph;
+
+      std::vector<gr_complex> d_tmp;
+      std::vector<float> d_demod;
+
+    public:
+      wfm_demod_cf_impl(double quad_rate, int audio_decimation,
+			double max_dev, double tau);
+      ~wfm_demod_cf_impl();
+
+      int work(int noutput_items,
+	       gr_vector_const_void_star &input_items,
+	       gr_vector_void_star &output_items);
+    };
+
+  } /* namespace analog */
+} /* namespace gr */
+
+#endif /* INCLUDED_ANALOG_WFM_DEMOD_CF_IMPL_H */
@@ -74,6 +74,7 @@
 #include "gnuradio/analog/simple_squelch_cc.h"
 #include "gnuradio/analog/squelch_base_cc.h"
 #include "gnuradio/analog/squelch_base_ff.h"
+#include "gnuradio/analog/wfm_demod_cf.h"
 %}
 
 %include "gnuradio/analog/cpm.h"
@@ -116,6 +117,7 @@
 %include "gnuradio/analog/simple_squelch_cc.h"
 %include "gnuradio/analog/squelch_base_cc.h"
 %include "gnuradio/analog/squelch_base_ff.h"
+%include "gnuradio/analog/wfm_demod_cf.h"
 
 GR_SWIG_BLOCK_MAGIC2(analog, agc_cc);
 GR_SWIG_BLOCK_MAGIC2(analog, agc_ff);
@@ -152,3 +154,4 @@ GR_SWIG_BLOCK_MAGIC2(analog, sig_source_i);
 GR_SWIG_BLOCK_MAGIC2(analog, sig_source_f);
 GR_SWIG_BLOCK_MAGIC2(analog, sig_source_c);
 GR_SWIG_BLOCK_MAGIC2(analog, simple_squelch_cc);
+GR_SWIG_BLOCK_MAGIC2(analog, wfm_demod_cf);
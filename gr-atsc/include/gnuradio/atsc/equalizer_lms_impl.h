@@ -61,6 +61,11 @@ protected:
 private:
   std::vector<double>	d_taps;
 
+  // Float shadow of d_taps for the hot filtering dot product, which
+  // goes through volk; the taps themselves stay double so the tiny
+  // LMS updates don't wash out.  Refreshed whenever the taps adapt.
+  std::vector<float>	d_taps_f;
+
   void filterN (const float *input_samples,
 		float *output_samples,
 		int nsamples);
@@ -28,6 +28,9 @@
 #include <gnuradio/atsc/api.h>
 #include <gnuradio/atsc/types.h>
 #include <gnuradio/atsc/interleaver_fifo.h>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 
 #if (USE_SIMPLE_SLICER)
 #include <gnuradio/atsc/fake_single_viterbi_impl.h>
@@ -72,11 +75,35 @@ public:
   void decode_helper (unsigned char out[OUTPUT_SIZE],
 		      const float in[INPUT_SIZE]);
 
+  //! run one of the 12 decoders over its subset of the input symbols
+  void decode_coder (int coder, unsigned char *out,
+		     const float symbols_in[INPUT_SIZE]);
+
+  //! claim and decode coders until the current pass runs dry
+  void run_coders ();
+  void worker_loop ();
 
   single_viterbi_t	viterbi[NCODERS];
   fifo_t		*fifo[NCODERS];
   bool			debug;
 
+  // The 12 decoders are completely independent (disjoint state,
+  // disjoint output dibits), so decode_helper spreads them over a
+  // small persistent pool; the calling thread decodes alongside the
+  // workers, and each coder writes into its own buffer which gets
+  // OR-merged at the end to avoid read-modify-write races on shared
+  // output bytes.
+  int			d_nworkers;
+  bool			d_shutdown;
+  unsigned int		d_seq;		// bumped to start a pass
+  int			d_next_coder;
+  int			d_inflight;
+  const float	       *d_sym_in;
+  unsigned char		d_coder_out[NCODERS][OUTPUT_SIZE];
+  boost::mutex		d_task_mutex;
+  boost::condition_variable d_task_cond;
+  boost::condition_variable d_done_cond;
+  boost::thread_group	d_workers;
 };
 
 
@@ -24,6 +24,7 @@
 #include <assert.h>
 #include <algorithm>
 #include <gnuradio/atsc/pnXXX_impl.h>
+#include <volk/volk.h>
 
 #include <stdio.h>
 
@@ -42,10 +43,11 @@ static int          get_field_sync_training_sequence_length (int offset);
 static const float *get_field_sync_training_sequence (int which_field, int offset);
 
 
-atsci_equalizer_lms::atsci_equalizer_lms () : d_taps (NTAPS)
+atsci_equalizer_lms::atsci_equalizer_lms () : d_taps (NTAPS), d_taps_f (NTAPS)
 {
   for (int i = 0; i < NTAPS; i++) {
     d_taps[i] = 0.0;
+    d_taps_f[i] = 0.0;
   }
   trainingfile=fopen("taps.txt","w");
 }
@@ -62,6 +64,7 @@ atsci_equalizer_lms::reset ()
 
   for (int i = 0; i < NTAPS; i++) {
     d_taps[i] = 0.0;
+    d_taps_f[i] = 0.0;
   }
 }
 
@@ -175,28 +178,11 @@ atsci_equalizer_lms::filter_field_sync (const float *input_samples,
 float
 atsci_equalizer_lms::filter1 (const float input[])
 {
-  static const int N_UNROLL = 4;
-
-  float	acc0 = 0;
-  float	acc1 = 0;
-  float	acc2 = 0;
-  float	acc3 = 0;
-
-
-  unsigned	i = 0;
-  unsigned	n = (NTAPS / N_UNROLL) * N_UNROLL;
-
-  for (i = 0; i < n; i += N_UNROLL){
-    acc0 += d_taps[i + 0] * input[i + 0];
-    acc1 += d_taps[i + 1] * input[i + 1];
-    acc2 += d_taps[i + 2] * input[i + 2];
-    acc3 += d_taps[i + 3] * input[i + 3];
-  }
-
-  for (; i < (unsigned) NTAPS; i++)
-    acc0 += d_taps[i] * input[i];
-
-  return (acc0 + acc1 + acc2 + acc3);
+  // this runs on every symbol, so it gets the SIMD kernel; the
+  // float shadow of the taps is kept current by adapt1
+  float acc;
+  volk_32f_x2_dot_prod_32f (&acc, input, &d_taps_f[0], NTAPS);
+  return acc;
 }
 
 //
@@ -211,9 +197,12 @@ atsci_equalizer_lms::adapt1 (const float input[], float ideal_output)
   double y = filter1 (input);
   double e = y - ideal_output;
 
-  // update taps...
+  // update taps... adaptation only runs on the field sync training
+  // sequence, so the double-precision loop stays scalar and just
+  // refreshes the float shadow used by filter1
   for (int i = 0; i < NTAPS; i++){
     d_taps[i] = d_taps[i] - BETA * e * (double)(input[i]);
+    d_taps_f[i] = (float) d_taps[i];
   }
 
   return y;
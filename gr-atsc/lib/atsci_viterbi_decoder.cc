@@ -26,6 +26,7 @@
 #include <cmath>
 #include "atsci_viterbi_mux.cc"
 #include <string.h>
+#include <boost/bind.hpp>
 
 
 /* How many separate Trellis encoders / Viterbi decoders run in parallel */
@@ -39,6 +40,22 @@ static const float	DSEG_SYNC_SYM4 =  5;
 atsci_viterbi_decoder::atsci_viterbi_decoder ()
 {
   debug = true;
+  d_shutdown = false;
+  d_seq = 0;
+  d_next_coder = NCODERS;
+  d_inflight = 0;
+  d_sym_in = 0;
+
+  d_nworkers = (int) boost::thread::hardware_concurrency ();
+  if (d_nworkers > NCODERS)
+    d_nworkers = NCODERS;
+  if (d_nworkers < 1)
+    d_nworkers = 1;
+
+  // The thread that calls decode() claims coders too, so spawn one
+  // worker fewer; a single-core host keeps the plain serial path.
+  for (int i = 0; i < d_nworkers - 1; i++)
+    d_workers.create_thread (boost::bind (&atsci_viterbi_decoder::worker_loop, this));
 
   /*
    * These fifo's handle the alignment problem caused by the
@@ -60,10 +77,58 @@ atsci_viterbi_decoder::atsci_viterbi_decoder ()
 
 atsci_viterbi_decoder::~atsci_viterbi_decoder ()
 {
+  {
+    boost::mutex::scoped_lock lock (d_task_mutex);
+    d_shutdown = true;
+    d_task_cond.notify_all ();
+  }
+  d_workers.join_all ();
+
   for (int i = 0; i < NCODERS; i++)
     delete fifo[i];
 }
 
+void
+atsci_viterbi_decoder::worker_loop ()
+{
+  unsigned int last_seq = 0;
+
+  while (1){
+    {
+      boost::mutex::scoped_lock lock (d_task_mutex);
+      while (d_seq == last_seq && !d_shutdown)
+	d_task_cond.wait (lock);
+      if (d_shutdown)
+	return;
+      last_seq = d_seq;
+    }
+    run_coders ();
+  }
+}
+
+void
+atsci_viterbi_decoder::run_coders ()
+{
+  while (1){
+    int coder;
+    {
+      boost::mutex::scoped_lock lock (d_task_mutex);
+      if (d_next_coder >= NCODERS)
+	return;
+      coder = d_next_coder++;
+    }
+
+    memset (d_coder_out[coder], 0, OUTPUT_SIZE);
+    decode_coder (coder, d_coder_out[coder], d_sym_in);
+
+    {
+      boost::mutex::scoped_lock lock (d_task_mutex);
+      if (--d_inflight == 0)
+	d_done_cond.notify_all ();
+    }
+  }
+}
+
 void
 atsci_viterbi_decoder::reset ()
 {
@@ -112,12 +177,6 @@ atsci_viterbi_decoder::decode_helper (unsigned char out[OUTPUT_SIZE],
 {
   int encoder;
   unsigned int i;
-  int dbi;
-  int dbwhere;
-  int dbindex;
-  int shift;
-  unsigned char dibit;
-  float symbol;
 
   /* Memset is not necessary if it's all working... */
   memset (out, 0, OUTPUT_SIZE);
@@ -153,24 +212,63 @@ atsci_viterbi_decoder::decode_helper (unsigned char out[OUTPUT_SIZE],
 
   /* Now run each of the 12 Trellis encoders over their subset of
      the input symbols */
-  for (encoder = 0; encoder < NCODERS; encoder++) {
-    dbi = 0;			/* Reinitialize dibit index for new encoder */
-    fifo_t	*dibit_fifo = fifo[encoder];
-
-    /* Feed all the incoming symbols into one encoder;
-       pump them into the relevant dibits. */
-    for (i = 0; i < enco_which_max; i++) {
-      symbol = symbols_in[enco_which_syms[encoder][i]];
-      dibit = dibit_fifo->stuff (viterbi[encoder].decode (symbol));
-      // printf ("%d\n", dibit);
-      /* Store the dibit into the output data segment */
-      dbwhere = enco_which_dibits[encoder][dbi++];
-      dbindex = dbwhere >> 3;
-      shift = dbwhere & 0x7;
-      out[dbindex] =
-	(out[dbindex] & ~(0x03 << shift)) | (dibit << shift);
-    } /* Symbols fed into one encoder */
-  } /* Encoders */
+  if (d_nworkers <= 1) {
+    for (encoder = 0; encoder < NCODERS; encoder++)
+      decode_coder (encoder, out, symbols_in);
+    return;
+  }
+
+  /* Hand the coders to the pool; this thread decodes its share too */
+  {
+    boost::mutex::scoped_lock lock (d_task_mutex);
+    d_sym_in = symbols_in;
+    d_next_coder = 0;
+    d_inflight = NCODERS;
+    d_seq++;
+    d_task_cond.notify_all ();
+  }
+
+  run_coders ();
+
+  {
+    boost::mutex::scoped_lock lock (d_task_mutex);
+    while (d_inflight > 0)
+      d_done_cond.wait (lock);
+  }
+
+  /* Each coder wrote disjoint dibits into its own zeroed buffer, so
+     merging is a straight OR */
+  for (encoder = 0; encoder < NCODERS; encoder++)
+    for (i = 0; i < (unsigned int) OUTPUT_SIZE; i++)
+      out[i] |= d_coder_out[encoder][i];
 
   // fflush (stdout);
 }
+
+void
+atsci_viterbi_decoder::decode_coder (int coder, unsigned char *out,
+				     const float symbols_in[INPUT_SIZE])
+{
+  unsigned int i;
+  int dbi = 0;
+  int dbwhere;
+  int dbindex;
+  int shift;
+  unsigned char dibit;
+  float symbol;
+  fifo_t	*dibit_fifo = fifo[coder];
+
+  /* Feed all the incoming symbols into one encoder;
+     pump them into the relevant dibits. */
+  for (i = 0; i < enco_which_max; i++) {
+    symbol = symbols_in[enco_which_syms[coder][i]];
+    dibit = dibit_fifo->stuff (viterbi[coder].decode (symbol));
+    // printf ("%d\n", dibit);
+    /* Store the dibit into the output data segment */
+    dbwhere = enco_which_dibits[coder][dbi++];
+    dbindex = dbwhere >> 3;
+    shift = dbwhere & 0x7;
+    out[dbindex] =
+      (out[dbindex] & ~(0x03 << shift)) | (dibit << shift);
+  } /* Symbols fed into one encoder */
+}
@@ -74,6 +74,12 @@ namespace gr {
                       prefs::singleton()->get_long("audio_alsa", "nperiods", 4));
     }
 
+    static bool
+    default_use_mmap()
+    {
+      return prefs::singleton()->get_bool("audio_alsa", "mmap", true);
+    }
+
     // ----------------------------------------------------------------
 
     alsa_sink::alsa_sink(int sampling_rate,
@@ -92,7 +98,9 @@ namespace gr {
         d_period_size(0),
         d_buffer_size_bytes(0), d_buffer(0),
         d_worker(0), d_special_case_mono_to_stereo(false),
-        d_nunderuns(0), d_nsuspends(0), d_ok_to_block(ok_to_block)
+        d_use_mmap(default_use_mmap()), d_start_threshold(0),
+        d_nunderuns(0), d_nsuspends(0), d_consecutive_underruns(0),
+        d_ok_to_block(ok_to_block)
     {
       CHATTY_DEBUG = prefs::singleton()->get_bool("audio_alsa", "verbose", false);
 
@@ -142,17 +150,29 @@ namespace gr {
 
       // fill in portions of the d_hw_params that we know now...
 
-      // Specify the access methods we implement
-      // For now, we only handle RW_INTERLEAVED...
+      // Specify the access methods we implement.
+      // Prefer mmap'd transfers when the device supports them: the
+      // sample conversion goes straight into the DMA buffer instead
+      // of through a syscall per period. Fall back to RW_INTERLEAVED.
       snd_pcm_access_mask_t *access_mask;
       snd_pcm_access_mask_t **access_mask_ptr = &access_mask; // FIXME: workaround for compiler warning
       snd_pcm_access_mask_alloca(access_mask_ptr);
       snd_pcm_access_mask_none(access_mask);
-      snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_INTERLEAVED);
-      // snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_NONINTERLEAVED);
-
-      if((error = snd_pcm_hw_params_set_access_mask(d_pcm_handle,
-                                                    d_hw_params, access_mask)) < 0)
+      if(d_use_mmap)
+        snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_MMAP_INTERLEAVED);
+      else
+        snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_INTERLEAVED);
+
+      error = snd_pcm_hw_params_set_access_mask(d_pcm_handle,
+                                                d_hw_params, access_mask);
+      if(error < 0 && d_use_mmap) {
+        d_use_mmap = false;
+        snd_pcm_access_mask_none(access_mask);
+        snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_INTERLEAVED);
+        error = snd_pcm_hw_params_set_access_mask(d_pcm_handle,
+                                                  d_hw_params, access_mask);
+      }
+      if(error < 0)
         bail("failed to set access mask", error);
 
       // set sample format
@@ -258,9 +278,10 @@ namespace gr {
       // Tell the PCM device to wait to start until we've filled
       // it's buffers half way full. This helps avoid audio underruns.
 
+      d_start_threshold = d_nperiods * d_period_size / 2;
       err = snd_pcm_sw_params_set_start_threshold(d_pcm_handle,
                                                   d_sw_params,
-                                                  d_nperiods * d_period_size / 2);
+                                                  d_start_threshold);
       if(err < 0)
         bail("snd_pcm_sw_params_set_start_threshold", err);
 
@@ -491,7 +512,11 @@ namespace gr {
       const unsigned char *buffer = (const unsigned char *)vbuffer;
 
       while(nframes > 0){
-        int r = snd_pcm_writei(d_pcm_handle, buffer, nframes);
+        int r;
+        if(d_use_mmap)
+          r = snd_pcm_mmap_writei(d_pcm_handle, buffer, nframes);
+        else
+          r = snd_pcm_writei(d_pcm_handle, buffer, nframes);
         if(r == -EAGAIN) {
           if(d_ok_to_block == true)
             continue;  // try again
@@ -501,6 +526,21 @@ namespace gr {
         else if(r == -EPIPE) {  // underrun
           d_nunderuns++;
           fputs("aU", stderr);
+
+          // A run of underruns means we're restarting the stream with
+          // too little queued for this machine; back the start
+          // threshold off toward a full buffer before preparing again.
+          if(++d_consecutive_underruns >= 4
+             && d_start_threshold < d_nperiods * d_period_size) {
+            d_start_threshold = std::min((snd_pcm_uframes_t)(2 * d_start_threshold),
+                                         (snd_pcm_uframes_t)(d_nperiods * d_period_size));
+            if(snd_pcm_sw_params_current(d_pcm_handle, d_sw_params) == 0
+               && snd_pcm_sw_params_set_start_threshold(d_pcm_handle, d_sw_params,
+                                                        d_start_threshold) == 0)
+              snd_pcm_sw_params(d_pcm_handle, d_sw_params);
+            d_consecutive_underruns = 0;
+          }
+
           if((r = snd_pcm_prepare (d_pcm_handle)) < 0){
             output_error_msg("snd_pcm_prepare failed. Can't recover from underrun", r);
             return false;
@@ -523,6 +563,7 @@ namespace gr {
           return false;
         }
 
+        d_consecutive_underruns = 0;
         nframes -= r;
         buffer += r * sizeof_frame;
       }
@@ -64,10 +64,13 @@ namespace gr {
       char                *d_buffer;
       work_t               d_worker;		// the work method to use
       bool                 d_special_case_mono_to_stereo;
+      bool                 d_use_mmap;	// use mmap'd transfers instead of writei
+      snd_pcm_uframes_t    d_start_threshold; // frames queued before the stream starts
 
       // random stats
       int  d_nunderuns;   // count of underruns
       int  d_nsuspends;   // count of suspends
+      int  d_consecutive_underruns; // used to adapt the start threshold
       bool d_ok_to_block; // defaults to "true", controls blocking/non-block I/O
 
       void output_error_msg(const char *msg, int err);
@@ -76,6 +76,12 @@ namespace gr {
                       prefs::singleton()->get_long("audio_alsa", "nperiods", 4));
     }
 
+    static bool
+    default_use_mmap()
+    {
+      return prefs::singleton()->get_bool("audio_alsa", "mmap", true);
+    }
+
     // ----------------------------------------------------------------
 
     alsa_source::alsa_source(int sampling_rate,
@@ -95,6 +101,7 @@ namespace gr {
         d_buffer_size_bytes(0), d_buffer(0),
         d_worker(0), d_hw_nchan(0),
         d_special_case_stereo_to_mono(false),
+        d_use_mmap(default_use_mmap()),
         d_noverruns(0), d_nsuspends(0)
     {
       CHATTY_DEBUG = prefs::singleton()->get_bool("audio_alsa", "verbose", false);
@@ -139,17 +146,29 @@ namespace gr {
 
       // fill in portions of the d_hw_params that we know now...
 
-      // Specify the access methods we implement
-      // For now, we only handle RW_INTERLEAVED...
+      // Specify the access methods we implement.
+      // Prefer mmap'd transfers when the device supports them: the
+      // sample conversion reads straight out of the DMA buffer instead
+      // of through a syscall per period. Fall back to RW_INTERLEAVED.
       snd_pcm_access_mask_t *access_mask;
       snd_pcm_access_mask_t **access_mask_ptr = &access_mask; // FIXME: workaround for compiler warning
       snd_pcm_access_mask_alloca(access_mask_ptr);
       snd_pcm_access_mask_none(access_mask);
-      snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_INTERLEAVED);
-      // snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_NONINTERLEAVED);
-
-      if((error = snd_pcm_hw_params_set_access_mask(d_pcm_handle,
-                                                    d_hw_params, access_mask)) < 0)
+      if(d_use_mmap)
+        snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_MMAP_INTERLEAVED);
+      else
+        snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_INTERLEAVED);
+
+      error = snd_pcm_hw_params_set_access_mask(d_pcm_handle,
+                                                d_hw_params, access_mask);
+      if(error < 0 && d_use_mmap) {
+        d_use_mmap = false;
+        snd_pcm_access_mask_none(access_mask);
+        snd_pcm_access_mask_set(access_mask, SND_PCM_ACCESS_RW_INTERLEAVED);
+        error = snd_pcm_hw_params_set_access_mask(d_pcm_handle,
+                                                  d_hw_params, access_mask);
+      }
+      if(error < 0)
         bail("failed to set access mask", error);
 
       // set sample format
@@ -460,7 +479,11 @@ namespace gr {
       unsigned char *buffer = (unsigned char*)vbuffer;
 
       while(nframes > 0) {
-        int r = snd_pcm_readi (d_pcm_handle, buffer, nframes);
+        int r;
+        if(d_use_mmap)
+          r = snd_pcm_mmap_readi(d_pcm_handle, buffer, nframes);
+        else
+          r = snd_pcm_readi(d_pcm_handle, buffer, nframes);
         if(r == -EAGAIN)
           continue;   // try again
 
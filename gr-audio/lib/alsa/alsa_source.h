@@ -68,6 +68,7 @@ namespace gr {
       work_t               d_worker;		// the work method to use
       unsigned int         d_hw_nchan;		// # of configured h/w channels
       bool                 d_special_case_stereo_to_mono;
+      bool                 d_use_mmap;	// use mmap'd transfers instead of readi
 
       // random stats
       int d_noverruns;  // count of overruns
@@ -41,7 +41,8 @@ namespace gr {
      * tag's value. The tags are propagated using the all-to-all
      * policy.
      *
-     * It also stores a copy of all tags it sees flow past it. These
+     * It also stores a copy of the most recent tags it sees flow past
+     * it (a bounded ring, so memory stays flat in long runs). These
      * tags can be recalled externally with the data() member.
      *
      * This block is only meant for testing and showing how to use the tags.
@@ -0,0 +1,86 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_BIT_CORRELATOR_H
+#define INCLUDED_GR_BLOCKS_BIT_CORRELATOR_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/blocks/count_bits.h>
+#include <stdint.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Word-parallel helpers for 64-bit shift-register bit
+     * correlators.
+     *
+     * Sync-word searches that shift one bit at a time into a 64-bit
+     * register and compare after every bit can instead pack 64 input
+     * bits into one word; the register contents at every alignment
+     * inside the batch are then available as a double shift of
+     * (previous register, packed word), and each candidate test is
+     * one xor and popcount. Used by the access-code correlators and
+     * the pager sync search.
+     */
+    class BLOCKS_API bit_correlator
+    {
+    public:
+      //! Pack 64 unpacked bytes (LSB of each) into a word, first byte
+      //! in the most significant bit
+      static inline uint64_t pack64(const unsigned char *in)
+      {
+        uint64_t packed = 0;
+        for(int k = 0; k < 64; k++)
+          packed = (packed << 1) | (in[k] & 0x1);
+        return packed;
+      }
+
+      /*!
+       * Shift register contents after \p k bits of \p packed have
+       * been shifted into \p prev, for \p k in [0, 64]. A partial
+       * batch of n < 64 bits must sit in the most significant bits
+       * of \p packed, with \p k at most n.
+       */
+      static inline uint64_t window(uint64_t prev, uint64_t packed,
+                                    unsigned int k)
+      {
+        if(k == 0)
+          return prev;
+        if(k == 64)
+          return packed;
+        return (prev << k) | (packed >> (64 - k));
+      }
+
+      //! Hamming distance between \p reg and \p pattern over the bits
+      //! selected by \p mask
+      static inline unsigned int distance(uint64_t reg, uint64_t pattern,
+                                          uint64_t mask)
+      {
+        return count_bits64((reg ^ pattern) & mask);
+      }
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_BIT_CORRELATOR_H */
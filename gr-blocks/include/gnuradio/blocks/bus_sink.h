@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_BUS_SINK_H
+#define INCLUDED_GR_BLOCKS_BUS_SINK_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Write a stream onto a named shared-memory sample bus.
+     * \ingroup networking_tools_blk
+     *
+     * \details
+     * The bus is a single-writer ring in a named POSIX shared memory
+     * segment that any number of bus_source blocks, in this process
+     * or others on the same host, can read with independent cursors.
+     * Samples are written once and fanned out by the readers, so one
+     * wideband stream can feed many analysis flowgraphs without a
+     * per-consumer network copy.
+     *
+     * The sink never overwrites samples an attached reader has not
+     * consumed yet: a reader that stops consuming eventually blocks
+     * the writer (and with it the producing flowgraph). Readers that
+     * attach later start at the current write position. The segment
+     * is unlinked when the sink is destroyed; attached readers keep
+     * their mapping until they too go away.
+     */
+    class BLOCKS_API bus_sink : virtual public sync_block
+    {
+    public:
+      // gr::blocks::bus_sink::sptr
+      typedef boost::shared_ptr<bus_sink> sptr;
+
+      /*!
+       * \brief Create a sample bus and a sink writing to it.
+       *
+       * \param itemsize      The size (in bytes) of the item datatype
+       * \param name          System-wide name of the bus; sources use the same name
+       * \param bufsize_items Ring capacity in items. Sizes the tolerance for
+       *                      scheduling jitter between the writer and the
+       *                      slowest reader.
+       */
+      static sptr make(size_t itemsize,
+                       const std::string &name,
+                       size_t bufsize_items = 65536);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_BUS_SINK_H */
@@ -0,0 +1,70 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_BUS_SOURCE_H
+#define INCLUDED_GR_BLOCKS_BUS_SOURCE_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Read a stream from a named shared-memory sample bus.
+     * \ingroup networking_tools_blk
+     *
+     * \details
+     * Counterpart of bus_sink: attaches a private read cursor to the
+     * named bus and streams everything the writer publishes from the
+     * moment of attachment on. Up to 16 sources can read the same bus
+     * concurrently, from this process or others on the same host,
+     * each at its own pace.
+     *
+     * The item size and ring capacity must match the sink's; the
+     * first of sink or sources to come up creates the segment and
+     * the rest validate against it. A source that cannot keep up
+     * eventually back-pressures the writer rather than losing
+     * samples.
+     */
+    class BLOCKS_API bus_source : virtual public sync_block
+    {
+    public:
+      // gr::blocks::bus_source::sptr
+      typedef boost::shared_ptr<bus_source> sptr;
+
+      /*!
+       * \brief Attach a source to the sample bus \p name.
+       *
+       * \param itemsize      The size (in bytes) of the item datatype
+       * \param name          System-wide name of the bus, as given to bus_sink
+       * \param bufsize_items Ring capacity in items; must match the sink's
+       */
+      static sptr make(size_t itemsize,
+                       const std::string &name,
+                       size_t bufsize_items = 65536);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_BUS_SOURCE_H */
@@ -0,0 +1,60 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_COMPLEX_TO_INTERLEAVED_HALF_H
+#define INCLUDED_BLOCKS_COMPLEX_TO_INTERLEAVED_HALF_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_interpolator.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Convert stream of complex to a stream of interleaved
+     * IEEE 754 half precision (binary16) values.
+     * \ingroup type_converters_blk
+     *
+     * \details
+     * The output stream contains short-sized halves with twice as
+     * many output items as input items: for every complex input item
+     * we produce the real part and the imaginary part converted to
+     * half precision. Together with
+     * gr::blocks::interleaved_half_to_complex this halves the
+     * bandwidth of complex recording and display paths.
+     */
+    class BLOCKS_API complex_to_interleaved_half : virtual public sync_interpolator
+    {
+    public:
+      // gr::blocks::complex_to_interleaved_half::sptr
+      typedef boost::shared_ptr<complex_to_interleaved_half> sptr;
+
+      /*!
+       * Build a complex to interleaved halves block.
+       */
+      static sptr make();
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_COMPLEX_TO_INTERLEAVED_HALF_H */
@@ -45,6 +45,11 @@ namespace gr {
      * each vector, each item is converted using the above
      * function. So above, m is from 0 to noutput_items*vlen for each
      * call to work.
+     *
+     * In approximate mode the exact square root is replaced with a
+     * fast magnitude estimate that is within 4%% of the true value,
+     * which is cheaper and good enough for display consumers like
+     * waterfall feeds.
      */
     class BLOCKS_API complex_to_mag : virtual public sync_block
     {
@@ -56,8 +61,13 @@ namespace gr {
        * Build a complex to magnitude block.
        *
        * \param vlen vector len (default 1)
+       * \param approx use the fast magnitude estimate (default false)
        */
-      static sptr make(size_t vlen=1);
+      static sptr make(size_t vlen=1, bool approx=false);
+
+      //! Switch between the exact and the approximate magnitude.
+      virtual void set_approx(bool approx) = 0;
+      virtual bool approx() const = 0;
     };
 
   } /* namespace blocks */
@@ -0,0 +1,65 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_COMPLEX_TO_MAG_SQUARED_DECIM_H
+#define INCLUDED_BLOCKS_COMPLEX_TO_MAG_SQUARED_DECIM_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_decimator.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief complex in, magnitude squared of one in every \p decim
+     * samples out (float)
+     * \ingroup type_converters_blk
+     *
+     * \details
+     * Calculates the magnitude squared of one input sample in every
+     * \p decim:
+     *
+     * \li output[0][m] = |input[0][m*decim]|^2
+     *
+     * Equivalent to complex_to_mag_squared followed by keep_one_in_n,
+     * but traverses the input buffer only once and never touches the
+     * discarded samples, which matters for wideband channel-power
+     * scanning.
+     */
+    class BLOCKS_API complex_to_mag_squared_decim : virtual public sync_decimator
+    {
+    public:
+      // gr::blocks::complex_to_mag_squared_decim::sptr
+      typedef boost::shared_ptr<complex_to_mag_squared_decim> sptr;
+
+      /*!
+       * Build a decimating complex to magnitude squared block.
+       *
+       * \param decim keep one output for every decim input samples
+       */
+      static sptr make(int decim);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_COMPLEX_TO_MAG_SQUARED_DECIM_H */
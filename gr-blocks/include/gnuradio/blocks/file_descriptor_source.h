@@ -33,6 +33,16 @@ namespace gr {
     /*!
      * \brief Read stream from file descriptor.
      * \ingroup file_operators_blk
+     *
+     * \details
+     * In non-blocking mode the descriptor is switched to O_NONBLOCK
+     * and work() waits in poll(2) for a bounded interval instead of
+     * blocking in read(2), so a stalled pipe cannot hang the
+     * scheduler. Gaps in the stream are announced with stream tags:
+     * the first item produced after the pipe ran dry carries an
+     * "fd_underrun" tag, and at end of stream the last item carries
+     * an "fd_eof" tag (when end of file coincides with an empty work
+     * call there is no item to attach the tag to).
      */
     class BLOCKS_API file_descriptor_source : virtual public sync_block
     {
@@ -51,8 +61,12 @@ namespace gr {
        * \param itemsize item size of the incoming data stream.
        * \param fd file descriptor (as an integer).
        * \param repeat repeat the data stream continuously.
+       * \param nonblock use non-blocking reads with a poll-based
+       *        wait and the underrun/EOF tag protocol; requires
+       *        poll(2), so it is only available on POSIX systems.
        */
-      static sptr make(size_t itemsize, int fd, bool repeat=false);
+      static sptr make(size_t itemsize, int fd, bool repeat=false,
+                       bool nonblock=false);
     };
 
   } /* namespace blocks */
@@ -25,6 +25,7 @@
 
 #include <gnuradio/blocks/api.h>
 #include <gnuradio/sync_block.h>
+#include <stdint.h>
 
 namespace gr {
   namespace blocks {
@@ -32,6 +33,24 @@ namespace gr {
     const char METADATA_VERSION = 0;
     const size_t METADATA_HEADER_SIZE = 149;
 
+    const uint32_t METADATA_INDEX_MAGIC = 0x47524958;   // "GRIX"
+    const uint32_t METADATA_INDEX_VERSION = 1;
+
+    /*!
+     * One entry of the optional footer index (see
+     * gr::blocks::file_meta_sink::set_index). All fields are 8 bytes,
+     * stored in the byte order of the machine that wrote the capture,
+     * just like the sample data itself.
+     */
+    struct meta_index_entry {
+      uint64_t hdr_offset;   //!< byte offset of the segment header
+      uint64_t data_offset;  //!< byte offset of the first data byte
+      uint64_t nbytes;       //!< data bytes in the segment
+      uint64_t time_secs;    //!< rx_time of the first item, whole seconds
+      double time_fracs;     //!< rx_time of the first item, fractional seconds
+      double samp_rate;      //!< sample rate of the segment
+    };
+
     enum gr_file_types {
       GR_FILE_BYTE=0,
       GR_FILE_CHAR=0,
@@ -66,6 +85,18 @@ namespace gr {
      * the first header (at position 0 in the file) and reading where
      * the data segment starts plus the data segment size. Following
      * will either be a new header or EOF.
+     *
+     * When set_index(true) is called, a footer index is appended when
+     * the file is closed: an array of ::meta_index_entry records, one
+     * per segment, followed by a 16-byte trailer (uint64_t number of
+     * entries, uint32_t ::METADATA_INDEX_VERSION, uint32_t
+     * ::METADATA_INDEX_MAGIC). The footer lives at the end of the
+     * header stream (the data file when the headers are inline, the
+     * .hdr file when detached) and lets gr::blocks::file_meta_source
+     * seek to a timestamp without scanning every header. Readers
+     * unaware of the footer cannot parse an inline file past the last
+     * segment, so leave the index off if such readers must consume
+     * the capture, or use a detached header.
      */
     class BLOCKS_API file_meta_sink : virtual public sync_block
     {
@@ -104,6 +135,12 @@ namespace gr {
       virtual void do_update() = 0;
 
       virtual void set_unbuffered(bool unbuffered) = 0;
+
+      /*!
+       * Enable writing the footer index on close for fast seeking
+       * (off by default; see the class description for the layout).
+       */
+      virtual void set_index(bool index) = 0;
     };
 
   } /* namespace blocks */
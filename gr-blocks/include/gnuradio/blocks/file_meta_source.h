@@ -47,6 +47,12 @@ namespace gr {
      *
      * Any item inside of the extra header dictionary is ready out and
      * made into a stream tag.
+     *
+     * If the file was written with the footer index enabled
+     * (gr::blocks::file_meta_sink::set_index), the index is loaded
+     * when the file is opened and seek_timestamp() can jump straight
+     * to the segment containing a given time without scanning the
+     * intervening headers.
      */
     class BLOCKS_API file_meta_source : virtual public sync_block
     {
@@ -74,6 +80,19 @@ namespace gr {
 			const std::string &hdr_filename="") = 0;
       virtual void close() = 0;
       virtual void do_update() = 0;
+
+      /*!
+       * \brief Seek to the segment containing the given rx_time.
+       *
+       * Only available when the file carries a footer index; returns
+       * false if there is no index or the seek failed. The segment's
+       * header is re-emitted as stream tags, so downstream blocks see
+       * the rx_time and rx_rate at the new position.
+       *
+       * \param secs whole seconds of the target time.
+       * \param fracs fractional seconds of the target time.
+       */
+      virtual bool seek_timestamp(uint64_t secs, double fracs) = 0;
     };
 
   } /* namespace blocks */
@@ -26,6 +26,7 @@
 #include <gnuradio/blocks/api.h>
 #include <gnuradio/blocks/file_sink_base.h>
 #include <gnuradio/sync_block.h>
+#include <stdint.h>
 
 namespace gr {
   namespace blocks {
@@ -41,14 +42,59 @@ namespace gr {
       // gr::blocks::file_sink::sptr
       typedef boost::shared_ptr<file_sink> sptr;
 
+      /*!
+       * What the items look like on the disk.
+       */
+      enum disk_format_t {
+        FORMAT_RAW = 0,  //!< stream items are written as they are
+        FORMAT_SC16      //!< fc32 in the graph, interleaved 16-bit I/Q on disk
+      };
+
       /*!
        * \brief Make a file sink.
+       *
+       * In async mode, work() only appends into a ring of large
+       * staging buffers and a dedicated writer thread does the disk
+       * I/O, so a filesystem hiccup stalls the writer instead of the
+       * flowgraph.  If the ring fills up because the disk can't keep
+       * up, incoming items are dropped and counted; query ndropped()
+       * to find out how many.
+       *
        * \param itemsize size of the input data items.
        * \param filename name of the file to open and write output to.
        * \param append if true, data is appended to the file instead of
        *        overwriting the initial content.
+       * \param async if true, write from a separate thread through a
+       *        ring of staging buffers instead of inside work().
+       * \param compress if true, chunks are compressed on the writer
+       *        thread before they hit the disk (implies \p async).
+       *        Each staging chunk becomes one independently
+       *        compressed chunk in the file, so the capture stays
+       *        seekable; gr::blocks::file_source detects the format
+       *        and decompresses transparently. Incompressible chunks
+       *        are stored, so the cost on noise-like data is only
+       *        the chunk framing.
+       * \param format on-disk item format. FORMAT_SC16 takes fc32
+       *        items from the graph and stores interleaved shorts,
+       *        halving the disk bandwidth; the conversion replaces
+       *        the copy the sink makes anyway, so no extra buffer
+       *        pass is added. \p itemsize stays the stream item size
+       *        (vlen * sizeof(gr_complex)).
+       * \param scale multiplier applied before the narrowing
+       *        conversion when \p format is FORMAT_SC16 (full scale
+       *        32768.0 maps +/-1.0 onto the full short range). Use
+       *        the same value at the file_source to get the original
+       *        amplitudes back.
+       */
+      static sptr make(size_t itemsize, const char *filename, bool append=false,
+                       bool async=false, bool compress=false,
+                       disk_format_t format=FORMAT_RAW, float scale=32768.0f);
+
+      /*!
+       * \brief Number of items dropped because the staging ring was
+       * full (always 0 in synchronous mode).
        */
-      static sptr make(size_t itemsize, const char *filename, bool append=false);
+      virtual uint64_t ndropped() const = 0;
     };
 
   } /* namespace blocks */
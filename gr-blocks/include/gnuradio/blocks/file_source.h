@@ -40,6 +40,23 @@ namespace gr {
       // gr::blocks::file_source::sptr
       typedef boost::shared_ptr<file_source> sptr;
 
+      /*!
+       * How the file is read off the disk.
+       */
+      enum io_mode_t {
+        IO_MODE_STDIO = 0, //!< buffered stdio (the default)
+        IO_MODE_MMAP,      //!< map the file; kernel readahead, one copy
+        IO_MODE_DIRECT     //!< O_DIRECT through an aligned staging buffer
+      };
+
+      /*!
+       * What the items look like on the disk.
+       */
+      enum disk_format_t {
+        FORMAT_RAW = 0,  //!< disk items are exactly the stream items
+        FORMAT_SC16      //!< interleaved 16-bit I/Q on disk, fc32 in the graph
+      };
+
       /*!
        * \brief Create a file source.
        *
@@ -51,11 +68,39 @@ namespace gr {
        * If \p repeat is turned on, the file will repeat the file after
        * it's reached the end.
        *
+       * \p io_mode selects how the data gets off the disk: the
+       * default buffered stdio, an mmap of the whole file with
+       * sequential-readahead advice, or O_DIRECT reads that bypass
+       * the page cache entirely (useful when replaying captures much
+       * larger than memory).  The last two fall back to stdio on
+       * platforms that don't support them.
+       *
+       * Captures written by gr::blocks::file_sink with compression
+       * enabled are recognized by their magic number (in the default
+       * stdio mode) and decompressed transparently; a prefetch
+       * thread inflates the next chunk while the current one is
+       * being consumed.  seek() on such a file hops over whole
+       * compressed chunks using only their framing headers.
+       *
+       * With \p format set to FORMAT_SC16, the file holds interleaved
+       * 16-bit I/Q (as written by gr::blocks::file_sink with the same
+       * format) and the block produces fc32, widening during the copy
+       * off the disk instead of in a separate conversion block.
+       * \p itemsize stays the stream item size
+       * (vlen * sizeof(gr_complex)) and \p scale must match the
+       * sink's to recover the original amplitudes.
+       *
        * \param itemsize	the size of each item in the file, in bytes
        * \param filename	name of the file to source from
        * \param repeat	repeat file from start
+       * \param io_mode	how to read the file (see io_mode_t)
+       * \param format	on-disk item format (see disk_format_t)
+       * \param scale	divisor applied when widening FORMAT_SC16 items
        */
-      static sptr make(size_t itemsize, const char *filename, bool repeat = false);
+      static sptr make(size_t itemsize, const char *filename, bool repeat = false,
+                       io_mode_t io_mode = IO_MODE_STDIO,
+                       disk_format_t format = FORMAT_RAW,
+                       float scale = 32768.0f);
 
       /*!
        * \brief seek file to \p seek_point relative to \p whence
@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_LATENCY_PROBE_H
+#define INCLUDED_GR_BLOCKS_LATENCY_PROBE_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Collect latency statistics from timestamps stamped by a
+     * gr::blocks::latency_tagger upstream.
+     * \ingroup measurement_tools_blk
+     *
+     * \details
+     * For every tag with the configured key, the probe subtracts the
+     * stamped gr::high_res_timer_now() value from the current timer,
+     * maintaining count, mean, standard deviation, minimum and
+     * maximum of the observed latencies in seconds. The statistics
+     * are available through the accessors below and are exported over
+     * ControlPort when it is enabled.
+     *
+     * The block is a sink; to probe mid-stream, let the stream fan
+     * out to the probe and the rest of the graph.
+     */
+    class BLOCKS_API latency_probe : virtual public sync_block
+    {
+    public:
+      // gr::blocks::latency_probe::sptr
+      typedef boost::shared_ptr<latency_probe> sptr;
+
+      /*!
+       * Build a latency probe block.
+       *
+       * \param itemsize size of each stream item
+       * \param key name of the tag carrying the timestamps (defaults
+       *            to "latency")
+       */
+      static sptr make(size_t itemsize, const std::string &key="latency");
+
+      //! Number of latency measurements collected since the last reset.
+      virtual int num_measurements() = 0;
+
+      //! Mean observed latency in seconds.
+      virtual double latency_avg() = 0;
+
+      //! Standard deviation of the observed latencies in seconds.
+      virtual double latency_stddev() = 0;
+
+      //! Smallest observed latency in seconds.
+      virtual double latency_min() = 0;
+
+      //! Largest observed latency in seconds.
+      virtual double latency_max() = 0;
+
+      //! Forget all collected measurements.
+      virtual void reset() = 0;
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_LATENCY_PROBE_H */
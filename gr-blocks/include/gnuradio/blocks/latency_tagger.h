@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_LATENCY_TAGGER_H
+#define INCLUDED_GR_BLOCKS_LATENCY_TAGGER_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Stamp the host's high resolution timer into stream tags
+     * at a fixed item interval.
+     * \ingroup measurement_tools_blk
+     *
+     * \details
+     * Place this at the ingress of a flowgraph (right after the
+     * source) and a gr::blocks::latency_probe anywhere downstream:
+     * the probe subtracts the stamped gr::high_res_timer_now() value
+     * from the time it sees the tag, giving the processing latency of
+     * everything between the two blocks. Several probes with the same
+     * key measure per-hop latency from a single tagger.
+     *
+     * The stream itself passes through unmodified; every \p interval
+     * items a tag with key \p key and the current timer value (a
+     * uint64 PMT) is attached.
+     */
+    class BLOCKS_API latency_tagger : virtual public sync_block
+    {
+    public:
+      // gr::blocks::latency_tagger::sptr
+      typedef boost::shared_ptr<latency_tagger> sptr;
+
+      /*!
+       * Build a latency tagger block.
+       *
+       * \param itemsize size of each stream item
+       * \param interval number of items between timestamps
+       * \param key name of the tag to stamp (defaults to "latency")
+       */
+      static sptr make(size_t itemsize, int interval,
+                       const std::string &key="latency");
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_LATENCY_TAGGER_H */
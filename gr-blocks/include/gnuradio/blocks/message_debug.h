@@ -47,6 +47,12 @@ namespace gr {
      *            access using the get_message function.
      * \li print_pdu: specifically designed to handle formatted PDUs
      *                (see pdu.h).
+     *
+     * Messages posted to the print and print_pdu ports are queued
+     * through a bounded lock-free ring and formatted by a background
+     * thread, so the posting block never waits on console I/O. When
+     * messages arrive faster than they can be printed the oldest
+     * queued entries are dropped and summarized once a second.
      */
     class BLOCKS_API message_debug : virtual public block
     {
@@ -80,6 +86,35 @@ namespace gr {
        * \return a message at index \p i as a pmt_t.
        */
       virtual pmt::pmt_t get_message(int i) = 0;
+
+      /*!
+       * \brief When enabled, messages on the print and print_pdu
+       * ports are only counted, never queued or printed.
+       *
+       * This turns the block into pure instrumentation: the handler
+       * bumps a counter and returns, so leaving a message_debug
+       * wired into a flowgraph does not change its timing.
+       */
+      virtual void set_count_only(bool enable) = 0;
+
+      /*!
+       * \brief Reports the number of messages received on the print
+       * and print_pdu ports, including any that were dropped or
+       * suppressed by count-only mode.
+       */
+      virtual long message_count() = 0;
+
+      /*!
+       * \brief Cap the number of entries printed per second; 0 (the
+       * default) means unlimited.
+       *
+       * Messages over the budget stay queued; once the queue fills,
+       * the oldest are dropped and reported in the once-a-second
+       * drop summary.
+       *
+       * \param limit maximum printed entries per second, or 0.
+       */
+      virtual void set_print_limit(int limit) = 0;
     };
 
   } /* namespace blocks */
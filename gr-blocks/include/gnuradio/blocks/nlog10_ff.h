@@ -32,11 +32,19 @@ namespace gr {
     /*!
      * \brief output = n*log10(input) + k
      * \ingroup math_operators_blk
+     *
+     * \details
+     * By default every sample goes through libm's log10. For
+     * high-rate dB conversion (e.g., spectrum displays) an
+     * approximate mode can be enabled that evaluates a cubic
+     * polynomial on the floating-point mantissa instead; with n=10
+     * the result is within about 0.005 dB of the exact value, at a
+     * fraction of the cost.
      */
     class BLOCKS_API nlog10_ff : virtual public sync_block
     {
     public:
-      
+
       // gr::blocks::nlog10_ff::sptr
       typedef boost::shared_ptr<nlog10_ff> sptr;
 
@@ -47,6 +55,15 @@ namespace gr {
        * \param k     Scalar additive constant
        */
       static sptr make(float n=1.0, size_t vlen=1, float k=0.0);
+
+      /*!
+       * \brief Enable or disable the fast approximate log (default:
+       * disabled, i.e., exact libm log10).
+       */
+      virtual void set_approx_mode(bool enable) = 0;
+
+      //! Return true when the fast approximate log is in use.
+      virtual bool approx_mode() const = 0;
     };
 
   } /* namespace blocks */
@@ -38,6 +38,19 @@ namespace gr {
       BLOCKS_API size_t itemsize(vector_type type);
       BLOCKS_API bool type_matches(vector_type type, pmt::pmt_t v);
       BLOCKS_API pmt::pmt_t make_pdu_vector(vector_type type, const uint8_t* buf, size_t items);
+
+      /*!
+       * \brief Like make_pdu_vector, but recycles payload vectors
+       * through a small process-wide pool.
+       *
+       * A vector is reused once every downstream consumer has
+       * dropped its reference, so steady-state PDU streams with a
+       * stable packet size stop allocating per packet. Falls back to
+       * a fresh allocation when no released vector of the right type
+       * and length is available.
+       */
+      BLOCKS_API pmt::pmt_t make_pdu_vector_pooled(vector_type type, const uint8_t* buf, size_t items);
+
       BLOCKS_API vector_type type_from_pmt(pmt::pmt_t vector);
 
     } /* namespace pdu */
@@ -42,10 +42,18 @@ namespace gr {
       /*!
        * \brief Make an complex rotator block
        * \param phase_inc rotational velocity
+       * \param reset_tag_key If non-empty, a stream tag with this key
+       *        resets the rotator phase at the tagged sample: to the
+       *        tag's value (radians) if it carries a number, to zero
+       *        otherwise. Useful for keeping bursts phase-aligned.
        */
-      static sptr make(double phase_inc = 0.0);
+      static sptr make(double phase_inc = 0.0,
+                       const std::string &reset_tag_key = "");
 
       virtual void set_phase_inc(double phase_inc) = 0;
+
+      //! Set the current rotator phase (radians)
+      virtual void set_phase(double phase) = 0;
     };
 
   } /* namespace blocks */
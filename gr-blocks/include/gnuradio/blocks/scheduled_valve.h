@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_SCHEDULED_VALVE_H
+#define INCLUDED_GR_SCHEDULED_VALVE_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Stream valve that opens and closes at exact sample offsets.
+     * \ingroup misc_blk
+     *
+     * \details
+     * While open, input is copied to the output; while closed, input
+     * is consumed and dropped. Unlike gr::blocks::copy, the
+     * transitions are commanded ahead of time via the "cmd" message
+     * port and take effect at an exact absolute input offset (in the
+     * sense of nitems_read), so the cut is sample-accurate regardless
+     * of message latency.
+     *
+     * A command is a PMT pair (offset . open) with offset a uint64
+     * absolute item offset and open a boolean. Commands are held in a
+     * queue ordered by offset and applied as work passes their
+     * offset; a command whose offset has already been consumed is
+     * applied immediately. Since message handlers run in the block's
+     * thread between calls to work, commands must be sent at least
+     * one buffer ahead of their offset to be guaranteed exact.
+     */
+    class BLOCKS_API scheduled_valve : virtual public block
+    {
+    public:
+      // gr::blocks::scheduled_valve::sptr
+      typedef boost::shared_ptr<scheduled_valve> sptr;
+
+      /*!
+       * Build a scheduled valve block.
+       *
+       * \param itemsize size of the stream items in bytes.
+       * \param open whether the valve starts open.
+       */
+      static sptr make(size_t itemsize, bool open = true);
+
+      //! Current valve state; changes as scheduled commands are applied
+      virtual bool open() const = 0;
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SCHEDULED_VALVE_H */
@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_SHM_SINK_H
+#define INCLUDED_GR_SHM_SINK_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Write a stream to a named shared memory ring for another
+     * process.
+     * \ingroup networking_tools_blk
+     *
+     * \details
+     * Creates a named POSIX shared memory segment holding a sample
+     * ring and a tag ring, and publishes the input stream into it for
+     * a gr::blocks::shm_source in another process on the same host.
+     * Unlike the UDP pair, samples cross the process boundary with a
+     * single copy on each side and no syscalls in the data path, and
+     * stream tags are forwarded with their exact item offsets.
+     *
+     * Flow control is lossless: when the ring is full the sink waits
+     * for the reader, so backpressure propagates across the process
+     * boundary. Start the sink process before the source process; the
+     * segment is created here and removed when this block is
+     * destroyed.
+     */
+    class BLOCKS_API shm_sink : virtual public sync_block
+    {
+    public:
+      // gr::blocks::shm_sink::sptr
+      typedef boost::shared_ptr<shm_sink> sptr;
+
+      /*!
+       * Build a shared memory sink.
+       *
+       * \param itemsize size of the stream items in bytes.
+       * \param name name of the shared memory segment, e.g. "/rx0".
+       * \param buffer_items capacity of the ring in items.
+       */
+      static sptr make(size_t itemsize, const std::string &name,
+                       int buffer_items = 65536);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SHM_SINK_H */
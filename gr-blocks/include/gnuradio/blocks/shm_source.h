@@ -0,0 +1,66 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_SHM_SOURCE_H
+#define INCLUDED_GR_SHM_SOURCE_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Read a stream published by gr::blocks::shm_sink in
+     * another process.
+     * \ingroup networking_tools_blk
+     *
+     * \details
+     * Attaches to the named shared memory segment created by a
+     * gr::blocks::shm_sink on the same host and produces the stream
+     * it carries, reattaching forwarded stream tags at their exact
+     * item offsets. The sink process must have created the segment
+     * before this block is constructed.
+     *
+     * When the sink's flowgraph stops, the source drains whatever is
+     * left in the ring and then signals done.
+     */
+    class BLOCKS_API shm_source : virtual public sync_block
+    {
+    public:
+      // gr::blocks::shm_source::sptr
+      typedef boost::shared_ptr<shm_source> sptr;
+
+      /*!
+       * Build a shared memory source.
+       *
+       * \param itemsize size of the stream items in bytes; must match
+       *                 the sink's.
+       * \param name name of the shared memory segment, e.g. "/rx0".
+       */
+      static sptr make(size_t itemsize, const std::string &name);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SHM_SOURCE_H */
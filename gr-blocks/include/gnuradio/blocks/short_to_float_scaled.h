@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_SHORT_TO_FLOAT_SCALED_H
+#define INCLUDED_BLOCKS_SHORT_TO_FLOAT_SCALED_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Convert a stream of shorts to floats and apply an affine
+     * transform, out = in * scale + offset, in a single pass.
+     * \ingroup type_converters_blk
+     *
+     * \details
+     * Fuses the common short_to_float -> multiply_const_ff ->
+     * add_const_ff chain into one block and one buffer traversal.
+     * Note that unlike short_to_float, whose scale is a divider, the
+     * scale here is a multiplier.
+     */
+    class BLOCKS_API short_to_float_scaled : virtual public sync_block
+    {
+    public:
+      // gr::blocks::short_to_float_scaled::sptr
+      typedef boost::shared_ptr<short_to_float_scaled> sptr;
+
+      /*!
+       * Build a fused short to float converter.
+       *
+       * \param vlen vector length of data streams.
+       * \param scale multiplicative scale applied to each sample.
+       * \param offset additive offset applied after scaling.
+       */
+      static sptr make(size_t vlen=1, float scale=1.0, float offset=0.0);
+
+      /*!
+       * Get the multiplicative scale value.
+       */
+      virtual float scale() const = 0;
+
+      /*!
+       * Set the multiplicative scale value.
+       */
+      virtual void set_scale(float scale) = 0;
+
+      /*!
+       * Get the additive offset value.
+       */
+      virtual float offset() const = 0;
+
+      /*!
+       * Set the additive offset value.
+       */
+      virtual void set_offset(float offset) = 0;
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_SHORT_TO_FLOAT_SCALED_H */
@@ -0,0 +1,84 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_STREAM_SELECTOR_H
+#define INCLUDED_BLOCKS_STREAM_SELECTOR_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Route one of N input streams to the output, switchable
+     * at runtime.
+     * \ingroup stream_operators_blk
+     *
+     * \details
+     * Copies the selected input stream to the output. The other
+     * inputs are consumed as they arrive without being copied, so
+     * upstream blocks (e.g. a backup receiver) keep running at full
+     * rate and switching over does not replay stale samples.
+     *
+     * The active input can be changed while the flowgraph is running,
+     * either with set_input_index() or by posting an integer to the
+     * "select" message port; no lock()/unlock() is needed. The switch
+     * takes effect between two work calls, so the output is always
+     * item-aligned: samples before the switch come entirely from the
+     * old input, samples after it entirely from the new one.
+     *
+     * Stream tags of the selected input are propagated with their
+     * offsets mapped into the output stream; tags on inactive inputs
+     * are dropped.
+     */
+    class BLOCKS_API stream_selector : virtual public block
+    {
+    public:
+      // gr::blocks::stream_selector::sptr
+      typedef boost::shared_ptr<stream_selector> sptr;
+
+      /*!
+       * \brief Create a stream selector.
+       *
+       * \param itemsize item size of the input and output streams
+       * \param input_index input that is initially routed to the output
+       */
+      static sptr make(size_t itemsize, int input_index=0);
+
+      /*!
+       * \brief Select the input routed to the output.
+       *
+       * Takes effect with the next work call. Out-of-range indices
+       * throw; the same request via the "select" message port is
+       * logged and ignored instead.
+       */
+      virtual void set_input_index(int input_index) = 0;
+
+      //! Returns the currently selected input
+      virtual int input_index() const = 0;
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_STREAM_SELECTOR_H */
@@ -52,8 +52,12 @@ namespace gr {
      * help clean up the output and allow you to focus in on a
      * particular tag of interest.
      *
-     * The tags from the last call to this work function are stored
-     * and can be retrieved using the function 'current_tags'.
+     * The most recently seen tags are stored in a bounded ring and
+     * can be retrieved using the function 'current_tags'.  The ring
+     * holds set_max_tags() entries (default 1024), so the block can
+     * stay attached to a tag-dense graph indefinitely without
+     * growing.  With set_sampling(n) only every nth matching tag is
+     * stored and displayed; the total count still reflects every tag.
      */
     class BLOCKS_API tag_debug : virtual public sync_block
     {
@@ -73,13 +77,16 @@ namespace gr {
                        const std::string &key_filter="");
 
       /*!
-       * \brief Returns a vector of tag_t items as of the last call to
-       * work.
+       * \brief Returns a vector of the most recently stored tag_t
+       * items, oldest first.
        */
       virtual std::vector<tag_t> current_tags() = 0;
 
       /*!
-       * \brief Return the total number of tags in the tag queue.
+       * \brief Return the total number of matching tags seen so far.
+       *
+       * Maintained as an atomic counter, so this is cheap to poll
+       * (e.g., over ControlPort) no matter how many tags have passed.
        */
       virtual int num_tags() = 0;
 
@@ -88,6 +95,18 @@ namespace gr {
        */
       virtual void set_display(bool d) = 0;
 
+      /*!
+       * \brief Set how many tags the ring of stored tags can hold.
+       */
+      virtual void set_max_tags(unsigned int max_tags) = 0;
+
+      /*!
+       * \brief Store and display only every \p nth matching tag.
+       *
+       * A value of 1 (the default) keeps every tag.
+       */
+      virtual void set_sampling(unsigned int nth) = 0;
+
       /*!
        * \brief Set a new key to filter with.
        */
@@ -0,0 +1,77 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_TCP_SINK_H
+#define INCLUDED_GR_TCP_SINK_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Send a stream of items over a TCP connection
+     * \ingroup networking_tools_blk
+     *
+     * \details
+     * Counterpart to gr::blocks::tcp_source.  TCP_NODELAY is enabled
+     * by default so small writes leave immediately instead of sitting
+     * behind Nagle's algorithm.  Connection setup is non-blocking:
+     * while no peer is connected the block drops its input rather
+     * than stalling the flowgraph, and it quietly reconnects (client
+     * mode) or waits for the next peer (server mode) if the
+     * connection goes away.
+     *
+     * With \p framed set, each packet on the input — delimited by
+     * "packet_len" tags as produced by the tagged-stream blocks — is
+     * length-prefixed with a 32-bit little-endian byte count.
+     * Untagged input is sent raw.
+     */
+    class BLOCKS_API tcp_sink : virtual public sync_block
+    {
+    public:
+      // gr::blocks::tcp_sink::sptr
+      typedef boost::shared_ptr<tcp_sink> sptr;
+
+      /*!
+       * \brief Create a TCP sink.
+       *
+       * \param itemsize size of the stream items in bytes
+       * \param host     address to connect to (client) or bind (server);
+       *                 empty or "0.0.0.0" binds all interfaces
+       * \param port     TCP port to connect to or listen on
+       * \param server   listen for the peer instead of connecting out
+       * \param nodelay  set TCP_NODELAY on the connection
+       * \param framed   length-prefix packets delimited by packet_len tags
+       */
+      static sptr make(size_t itemsize,
+                       const std::string &host, int port,
+                       bool server = false,
+                       bool nodelay = true,
+                       bool framed = false);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_TCP_SINK_H */
@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_TCP_SOURCE_H
+#define INCLUDED_GR_TCP_SOURCE_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Receive a stream of items over a TCP connection
+     * \ingroup networking_tools_blk
+     *
+     * \details
+     * TCP transport tuned for low-latency sample-over-LAN links: the
+     * socket is serviced by a dedicated receiver thread off an epoll
+     * loop (poll elsewhere), reads land in a large ring buffer in one
+     * recv per wakeup instead of small chunks, and on Linux
+     * TCP_QUICKACK can be re-armed after every read so acks go out
+     * immediately instead of after the delayed-ack timer.
+     *
+     * In server mode the block listens on \p port and serves one peer
+     * at a time; a new connection replaces the old one.  In client
+     * mode it keeps trying to connect to \p host : \p port and
+     * reconnects if the peer goes away.  When the ring fills, the
+     * block stops reading and lets TCP flow control push back on the
+     * sender rather than dropping.
+     *
+     * With \p framed set, the peer length-prefixes each packet with a
+     * 32-bit little-endian byte count (as written by
+     * gr::blocks::tcp_sink in framed mode) and the block tags the
+     * first item of every packet with "packet_len" (the length in
+     * items), so the output feeds tagged-stream blocks directly.
+     * Frame lengths must be a multiple of \p itemsize.
+     */
+    class BLOCKS_API tcp_source : virtual public sync_block
+    {
+    public:
+      // gr::blocks::tcp_source::sptr
+      typedef boost::shared_ptr<tcp_source> sptr;
+
+      /*!
+       * \brief Create a TCP source.
+       *
+       * \param itemsize size of the stream items in bytes
+       * \param host     address to connect to (client) or bind (server);
+       *                 empty or "0.0.0.0" binds all interfaces
+       * \param port     TCP port to connect to or listen on
+       * \param server   listen for the peer instead of connecting out
+       * \param quickack on Linux, re-arm TCP_QUICKACK after every read
+       * \param framed   parse 32-bit length prefixes and tag packets
+       */
+      static sptr make(size_t itemsize,
+                       const std::string &host, int port,
+                       bool server = true,
+                       bool quickack = true,
+                       bool framed = false);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_TCP_SOURCE_H */
@@ -55,6 +55,22 @@ namespace gr {
 
       //! Get the sample rate in samples per second.
       virtual double sample_rate() const = 0;
+
+      /*! \brief Enable or disable precision pacing.
+       *
+       * In precision mode the block releases samples in fixed-size
+       * chunks and sleeps to an absolute deadline computed from the
+       * total sample count, so timing errors do not accumulate and
+       * the output does not come out in bursts.
+       *
+       * \param enable Turn precision pacing on or off.
+       * \param granularity Number of items released per chunk; 0
+       *        picks a chunk of about 10 ms worth of samples.
+       */
+      virtual void set_precision_pacing(bool enable, int granularity=0) = 0;
+
+      //! Average rate actually achieved since the last rate change.
+      virtual double achieved_sample_rate() const = 0;
     };
 
   } /* namespace blocks */
@@ -40,6 +40,11 @@ namespace gr {
      *
      * Possible type strings: float, double, complex_float, complex_double
      *
+     * For the float type only, the names fast_exp, fast_exp2,
+     * fast_log, fast_log2 and fast_log10 select approximate
+     * polynomial implementations that avoid libm entirely (max
+     * error ~1.4e-3 in log2 units, ~2e-4 relative for exp).
+     *
      * output[i] = trans_fcn(input[i])
      */
     class BLOCKS_API transcendental : virtual public sync_block
@@ -0,0 +1,67 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_UDP_PDU_H
+#define INCLUDED_BLOCKS_UDP_PDU_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief High-rate UDP interface that translates datagrams to
+     * PDUs, receiving them in batches.
+     * \ingroup networking_tools_blk
+     *
+     * Unlike gr::blocks::socket_pdu, which reads one datagram per
+     * event loop pass, this block pulls whole batches of datagrams
+     * from the kernel with a single recvmmsg(2) call and recycles
+     * the payload vectors through the PDU pool, so the per-packet
+     * overhead stays flat at high packet rates. Linux only.
+     *
+     * Received datagrams are published on the "pdus" output port;
+     * PDUs arriving on the "pdus" input port are sent back to the
+     * most recent remote sender.
+     */
+    class BLOCKS_API udp_pdu : virtual public block
+    {
+    public:
+      // gr::blocks::udp_pdu::sptr
+      typedef boost::shared_ptr<udp_pdu> sptr;
+
+      /*!
+       * \brief Construct a batched UDP PDU interface
+       * \param addr local address to bind to ("" for all interfaces)
+       * \param port local port to bind to
+       * \param MTU maximum datagram size
+       * \param batch maximum datagrams fetched per recvmmsg call
+       */
+      static sptr make(std::string addr, std::string port,
+                       int MTU=1500, unsigned int batch=64);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_UDP_PDU_H */
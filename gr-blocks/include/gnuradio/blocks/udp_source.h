@@ -25,6 +25,7 @@
 
 #include <gnuradio/blocks/api.h>
 #include <gnuradio/sync_block.h>
+#include <stdint.h>
 
 namespace gr {
   namespace blocks {
@@ -51,11 +52,15 @@ namespace gr {
        * \param payload_size UDP payload size by default set to 1472 =
        *                     (1500 MTU - (8 byte UDP header) - (20 byte IP header))
        * \param eof          Interpret zero-length packet as EOF (default: true)
+       * \param buffer_size  Socket receive buffer depth in bytes; 0 leaves
+       *                     the OS default. Deep buffers ride out scheduler
+       *                     hiccups on fast sample feeds.
        */
       static sptr make(size_t itemsize,
                        const std::string &host, int port,
                        int payload_size=1472,
-                       bool eof=true);
+                       bool eof=true,
+                       int buffer_size=0);
 
       /*! \brief Change the connection to a new destination
        *
@@ -76,6 +81,11 @@ namespace gr {
 
       /*! \brief return the port number of the socket */
       virtual int get_port() = 0;
+
+      /*! \brief return the number of packets dropped because the
+       *  receive ring was full
+       */
+      virtual uint64_t ndropped() const = 0;
     };
 
   } /* namespace blocks */
@@ -0,0 +1,63 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_VECTOR_ASSEMBLE_H
+#define INCLUDED_BLOCKS_VECTOR_ASSEMBLE_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+#include <vector>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Concatenate N input vectors into one output vector.
+     * \ingroup stream_operators_blk
+     *
+     * \details
+     * Input stream k carries vectors of \p vlens[k] items; each
+     * output vector is the concatenation of one vector from every
+     * input, in port order.  This is the inverse of slicing a vector
+     * into sub-bands and avoids the per-item buffers that
+     * vector_to_streams / streams_to_vector would allocate.
+     */
+    class BLOCKS_API vector_assemble : virtual public sync_block
+    {
+    public:
+      // gr::blocks::vector_assemble::sptr
+      typedef boost::shared_ptr<vector_assemble> sptr;
+
+      /*!
+       * Make a vector assemble block.
+       *
+       * \param itemsize size of a single item inside the vectors, in bytes
+       * \param vlens    vector (list/tuple) of input vector lengths;
+       *                 the output vectors have length sum(vlens)
+       */
+      static sptr make(size_t itemsize, const std::vector<int> &vlens);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_VECTOR_ASSEMBLE_H */
@@ -0,0 +1,64 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_VECTOR_SLICE_VCC_H
+#define INCLUDED_BLOCKS_VECTOR_SLICE_VCC_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Extract the index range [\p start, \p end) out of each
+     * input vector of complexes.
+     * \ingroup stream_operators_blk
+     *
+     * \details
+     * Each consumer that only cares about a group of bins out of an
+     * FFT output can attach its own slice instead of going through
+     * vector_to_streams and streams_to_vector, which allocates one
+     * stream buffer per bin.  The slice is a single strided memcpy
+     * per vector.
+     */
+    class BLOCKS_API vector_slice_vcc : virtual public sync_block
+    {
+    public:
+      // gr::blocks::vector_slice_vcc::sptr
+      typedef boost::shared_ptr<vector_slice_vcc> sptr;
+
+      /*!
+       * Make a vector slice block.
+       *
+       * \param vlen_in length of the input vectors
+       * \param start   first index to extract
+       * \param end     one past the last index to extract; the output
+       *                vectors have length (end - start)
+       */
+      static sptr make(size_t vlen_in, size_t start, size_t end);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_VECTOR_SLICE_VCC_H */
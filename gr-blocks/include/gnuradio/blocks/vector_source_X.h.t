@@ -76,6 +76,16 @@ namespace gr {
       virtual void rewind() = 0;
       virtual void set_data(const std::vector<@TYPE@> &data,
                             const std::vector<tag_t> &tags=std::vector<tag_t>()) = 0;
+
+      /*!
+       * Enable zero-copy repeat mode.  When repeating untagged data
+       * whose length divides the output buffer size, the source fills
+       * the circular buffer once and afterwards only advances the
+       * stream, never copying the vector again.  Output is identical
+       * to the normal repeat mode; this is purely a fast path for
+       * high-rate periodic sources.
+       */
+      virtual void set_zero_copy(bool zero_copy) = 0;
     };
 
   } /* namespace blocks */
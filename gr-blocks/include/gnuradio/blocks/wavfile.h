@@ -35,8 +35,8 @@ namespace gr {
      * \param[in]  fp          File pointer to an opened, empty file.
      * \param[out] sample_rate Stores the sample rate [S/s]
      * \param[out] nchans      Number of channels
-     * \param[out] bytes_per_sample Bytes per sample, can either be 1 or 2 (corresponding o
-     *                              8 or 16 bit samples, respectively)
+     * \param[out] bytes_per_sample Bytes per sample, can be 1, 2 or 4 (corresponding to
+     *                              8 or 16 bit PCM or 32 bit IEEE-float samples, respectively)
      * \param[out] first_sample_pos Number of the first byte containing a sample. Use this
      *                              with fseek() to jump from the end of the file to the
      *                              first sample when in repeat mode.
@@ -84,6 +84,26 @@ namespace gr {
     void
     wav_write_sample(FILE *fp, short int sample, int bytes_per_sample);
 
+    /*!
+     * \brief Write a block of PCM samples to an open WAV file at the
+     * current position.
+     *
+     * \details
+     * Equivalent to calling wav_write_sample() per sample, but converts
+     * and byte-swaps in chunks and makes one fwrite() per chunk, which
+     * is much cheaper for multichannel recordings.
+     */
+    void
+    wav_write_samples(FILE *fp, const short *samples, int nsamples,
+                      int bytes_per_sample);
+
+    /*!
+     * \brief Write a block of 32-bit IEEE-float samples to an open WAV
+     * file at the current position.  Takes care of endianness.
+     */
+    void
+    wav_write_floats(FILE *fp, const float *samples, int nsamples);
+
 
     /*!
      * \brief Complete a WAV header
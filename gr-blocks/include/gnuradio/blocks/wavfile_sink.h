@@ -47,7 +47,7 @@ namespace gr {
        * \param filename The .wav file to be opened
        * \param n_channels Number of channels (2 = stereo or I/Q output)
        * \param sample_rate Sample rate [S/s]
-       * \param bits_per_sample 16 or 8 bit, default is 16
+       * \param bits_per_sample 8 or 16 bit PCM or 32 bit IEEE float, default is 16
        */
       static sptr make(const char *filename,
 		       int n_channels,
@@ -42,6 +42,8 @@ GR_CHECK_HDR_N_DEF(linux/ppdev.h HAVE_LINUX_PPDEV_H)
 GR_CHECK_HDR_N_DEF(dev/ppbus/ppi.h HAVE_DEV_PPBUS_PPI_H)
 GR_CHECK_HDR_N_DEF(unistd.h HAVE_UNISTD_H)
 GR_CHECK_HDR_N_DEF(malloc.h HAVE_MALLOC_H)
+GR_CHECK_HDR_N_DEF(poll.h HAVE_POLL_H)
+GR_CHECK_HDR_N_DEF(sys/uio.h HAVE_SYS_UIO_H)
 
 ########################################################################
 CHECK_CXX_SOURCE_COMPILES("
@@ -45,6 +45,10 @@ namespace gr {
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(float);
       set_alignment(std::max(1, alignment_multiple));
+
+      //resolve the concrete impls once; work() then skips the dispatcher
+      d_volk_add_a = volk_32f_x2_add_32f_get_impl(true);
+      d_volk_add_u = volk_32f_x2_add_32f_get_impl(false);
     }
 
     int
@@ -56,8 +60,13 @@ namespace gr {
       int noi = d_vlen*noutput_items;
       
       memcpy(out, input_items[0], noi*sizeof(float));
-      for(size_t i = 1; i < input_items.size(); i++)
-        volk_32f_x2_add_32f(out, out, (const float*)input_items[i], noi);
+      for(size_t i = 1; i < input_items.size(); i++) {
+        const float *in = (const float*)input_items[i];
+        if(volk_is_aligned(VOLK_OR_PTR(out, in)))
+          d_volk_add_a(out, out, in, noi);
+        else
+          d_volk_add_u(out, out, in, noi);
+      }
       return noutput_items;
     }
 
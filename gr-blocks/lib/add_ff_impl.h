@@ -24,6 +24,7 @@
 #define INCLUDED_BLOCKS_ADD_FF_IMPL_H
 
 #include <gnuradio/blocks/add_ff.h>
+#include <volk/volk_typedefs.h>
 
 namespace gr {
   namespace blocks {
@@ -31,6 +32,8 @@ namespace gr {
     class BLOCKS_API add_ff_impl : public add_ff
     {
       size_t d_vlen;
+      p_32f_x2_add_32f d_volk_add_a;
+      p_32f_x2_add_32f d_volk_add_u;
 
     public:
       add_ff_impl(size_t vlen);
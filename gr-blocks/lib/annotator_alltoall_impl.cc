@@ -45,7 +45,8 @@ namespace gr {
       : sync_block("annotator_alltoall",
                       io_signature::make(1, -1, sizeof_stream_item),
                       io_signature::make(1, -1, sizeof_stream_item)),
-        d_itemsize(sizeof_stream_item), d_when((uint64_t)when)
+        d_itemsize(sizeof_stream_item), d_when((uint64_t)when),
+        d_max_stored(65536)
     {
       set_tag_propagation_policy(TPP_ALL_TO_ALL);
 
@@ -79,6 +80,8 @@ namespace gr {
         std::vector<tag_t>::iterator itr;
         for(itr = all_tags.begin(); itr != all_tags.end(); itr++) {
           d_stored_tags.push_back(*itr);
+          while(d_stored_tags.size() > d_max_stored)
+            d_stored_tags.pop_front();
         }
       }
 
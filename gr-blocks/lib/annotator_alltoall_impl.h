@@ -24,6 +24,7 @@
 #define	INCLUDED_GR_ANNOTATOR_ALLTOALL_IMPL_H
 
 #include <gnuradio/blocks/annotator_alltoall.h>
+#include <deque>
 
 namespace gr {
   namespace blocks {
@@ -34,7 +35,10 @@ namespace gr {
       size_t d_itemsize;
       uint64_t d_when;
       uint64_t d_tag_counter;
-      std::vector<tag_t> d_stored_tags;
+      // Bounded ring of the most recently seen tags; keeps memory
+      // flat when the block is left in a long-running graph.
+      std::deque<tag_t> d_stored_tags;
+      size_t d_max_stored;
 
     public:
       annotator_alltoall_impl(int when, size_t sizeof_stream_item);
@@ -42,7 +46,7 @@ namespace gr {
 
       std::vector<tag_t> data() const
       {
-        return d_stored_tags;
+        return std::vector<tag_t>(d_stored_tags.begin(), d_stored_tags.end());
       }
 
       int work(int noutput_items,
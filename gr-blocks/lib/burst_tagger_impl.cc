@@ -27,6 +27,8 @@
 #include "burst_tagger_impl.h"
 #include <gnuradio/io_signature.h>
 #include <string.h>
+#include <stdint.h>
+#include <algorithm>
 
 namespace gr {
   namespace blocks {
@@ -95,17 +97,42 @@ namespace gr {
 
       memcpy(out, signal, noutput_items * d_itemsize);
 
-      for(int i = 0; i < noutput_items; i++) {
-        if(trigger[i] > 0) {
+      int i = 0;
+      while(i < noutput_items) {
+        // Scan the trigger stream four samples at a time. A 64-bit
+        // word cannot flip the current state if it is all zeros
+        // (while idle) or if every 16-bit lane is positive, i.e. no
+        // sign bit set and no zero lane (while inside a burst). Only
+        // words that may contain an edge fall through to the scalar
+        // check below.
+        while(i + 4 <= noutput_items) {
+          uint64_t w;
+          memcpy(&w, &trigger[i], sizeof(w));
           if(d_state == false) {
-            d_state = true;
-            add_item_tag(0, nitems_written(0)+i, d_true_key, d_true_value, d_id);
+            if(w != 0)
+              break;
           }
+          else {
+            if((w & 0x8000800080008000ULL) ||
+               ((w - 0x0001000100010001ULL) & ~w & 0x8000800080008000ULL))
+              break;
+          }
+          i += 4;
         }
-        else {
-          if(d_state == true) {
-            d_state = false;
-            add_item_tag(0, nitems_written(0)+i, d_false_key, d_false_value, d_id);
+
+        int end = std::min(noutput_items, i + 4);
+        for(; i < end; i++) {
+          if(trigger[i] > 0) {
+            if(d_state == false) {
+              d_state = true;
+              add_item_tag(0, nitems_written(0)+i, d_true_key, d_true_value, d_id);
+            }
+          }
+          else {
+            if(d_state == true) {
+              d_state = false;
+              add_item_tag(0, nitems_written(0)+i, d_false_key, d_false_value, d_id);
+            }
           }
         }
       }
@@ -0,0 +1,203 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bus_buffer.h"
+#include <boost/thread/thread.hpp>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+  namespace blocks {
+
+    static const uint32_t BUS_MAGIC = 0x47524253; // "GRBS"
+    static const size_t CONTROL_BYTES = 4096;     // control page; data follows
+
+    // 64-bit cursor loads must not tear on 32-bit machines, so go
+    // through the read-modify-write builtin.
+    static inline uint64_t
+    load64(volatile uint64_t *p)
+    {
+      return __sync_fetch_and_add(p, 0);
+    }
+
+    bus_buffer::bus_buffer(const std::string &name,
+                           size_t itemsize, size_t bufsize_items)
+      : d_name(name)
+    {
+      namespace bip = boost::interprocess;
+
+      if(itemsize == 0 || bufsize_items == 0)
+        throw std::invalid_argument("bus_buffer: itemsize and bufsize must be > 0");
+
+      size_t total = CONTROL_BYTES + itemsize * bufsize_items;
+
+      d_shm = bip::shared_memory_object(bip::open_or_create,
+                                        d_name.c_str(),
+                                        bip::read_write);
+      bip::offset_t cur_size = 0;
+      if(!d_shm.get_size(cur_size) || (size_t)cur_size < total)
+        d_shm.truncate(total);
+
+      d_region = bip::mapped_region(d_shm, bip::read_write);
+      d_ctl = reinterpret_cast<control*>(d_region.get_address());
+      d_data = reinterpret_cast<char*>(d_region.get_address()) + CONTROL_BYTES;
+
+      // Fresh POSIX shm is zero-filled, so state 0 means nobody has
+      // initialized the segment yet. First to swap 0 -> 1 does; the
+      // rest wait for 2.
+      if(__sync_bool_compare_and_swap(&d_ctl->state, 0u, 1u)) {
+        d_ctl->magic = BUS_MAGIC;
+        d_ctl->bufsize = bufsize_items;
+        d_ctl->itemsize = itemsize;
+        d_ctl->max_readers = MAX_READERS;
+        d_ctl->write_cursor = 0;
+        for(unsigned int i = 0; i < MAX_READERS; i++) {
+          d_ctl->readers[i].state = 0;
+          d_ctl->readers[i].read_cursor = 0;
+        }
+        __sync_synchronize();
+        d_ctl->state = 2;
+      }
+      else {
+        int tries = 5000;
+        while(d_ctl->state != 2 && tries-- > 0)
+          boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+        if(d_ctl->state != 2)
+          throw std::runtime_error("bus_buffer: segment never became ready: " + d_name);
+      }
+
+      if(d_ctl->magic != BUS_MAGIC)
+        throw std::runtime_error("bus_buffer: not a sample bus segment: " + d_name);
+      if(d_ctl->itemsize != itemsize || d_ctl->bufsize != bufsize_items)
+        throw std::runtime_error("bus_buffer: geometry mismatch on bus: " + d_name);
+    }
+
+    bus_buffer::~bus_buffer()
+    {
+    }
+
+    uint64_t
+    bus_buffer::space_available()
+    {
+      uint64_t w = load64(&d_ctl->write_cursor);
+      uint64_t space = d_ctl->bufsize;
+
+      // Never lap an attached reader; with no readers attached the
+      // writer is free-running and late joiners start at 'now'.
+      for(unsigned int i = 0; i < MAX_READERS; i++) {
+        if(d_ctl->readers[i].state == 2) {
+          uint64_t backlog = w - load64(&d_ctl->readers[i].read_cursor);
+          if(d_ctl->bufsize - backlog < space)
+            space = d_ctl->bufsize - backlog;
+        }
+      }
+      return space;
+    }
+
+    void
+    bus_buffer::write(const void *buf, uint64_t nitems)
+    {
+      const char *src = reinterpret_cast<const char*>(buf);
+      uint64_t w = load64(&d_ctl->write_cursor);
+      uint64_t idx = w % d_ctl->bufsize;
+      uint64_t first = d_ctl->bufsize - idx;
+      if(first > nitems)
+        first = nitems;
+
+      memcpy(d_data + idx * d_ctl->itemsize, src, first * d_ctl->itemsize);
+      if(nitems > first)
+        memcpy(d_data, src + first * d_ctl->itemsize,
+               (nitems - first) * d_ctl->itemsize);
+
+      // Publish: the data stores above must land before the cursor
+      // moves; the add is a full barrier.
+      __sync_add_and_fetch(&d_ctl->write_cursor, nitems);
+    }
+
+    int
+    bus_buffer::attach_reader()
+    {
+      for(unsigned int i = 0; i < MAX_READERS; i++) {
+        if(__sync_bool_compare_and_swap(&d_ctl->readers[i].state, 0u, 1u)) {
+          // Start at the current write position, and only then become
+          // visible to the writer's space accounting.
+          d_ctl->readers[i].read_cursor = load64(&d_ctl->write_cursor);
+          __sync_synchronize();
+          d_ctl->readers[i].state = 2;
+          return (int)i;
+        }
+      }
+      throw std::runtime_error("bus_buffer: no free reader slot on bus: " + d_name);
+    }
+
+    void
+    bus_buffer::detach_reader(int slot)
+    {
+      __sync_synchronize();
+      d_ctl->readers[slot].state = 0;
+    }
+
+    uint64_t
+    bus_buffer::items_available(int slot)
+    {
+      return load64(&d_ctl->write_cursor)
+        - load64(&d_ctl->readers[slot].read_cursor);
+    }
+
+    uint64_t
+    bus_buffer::read(int slot, void *buf, uint64_t max_items)
+    {
+      char *dst = reinterpret_cast<char*>(buf);
+      uint64_t r = load64(&d_ctl->readers[slot].read_cursor);
+      uint64_t nitems = load64(&d_ctl->write_cursor) - r;
+      if(nitems > max_items)
+        nitems = max_items;
+      if(nitems == 0)
+        return 0;
+
+      uint64_t idx = r % d_ctl->bufsize;
+      uint64_t first = d_ctl->bufsize - idx;
+      if(first > nitems)
+        first = nitems;
+
+      memcpy(dst, d_data + idx * d_ctl->itemsize, first * d_ctl->itemsize);
+      if(nitems > first)
+        memcpy(dst + first * d_ctl->itemsize, d_data,
+               (nitems - first) * d_ctl->itemsize);
+
+      // Free the space only after the copies are done.
+      __sync_add_and_fetch(&d_ctl->readers[slot].read_cursor, nitems);
+      return nitems;
+    }
+
+    void
+    bus_buffer::remove(const std::string &name)
+    {
+      boost::interprocess::shared_memory_object::remove(name.c_str());
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
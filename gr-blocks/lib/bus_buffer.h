@@ -0,0 +1,113 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_BUS_BUFFER_H
+#define INCLUDED_GR_BLOCKS_BUS_BUFFER_H
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <stdint.h>
+#include <string>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * \brief Shared-memory sample ring behind bus_sink / bus_source.
+     *
+     * One writer and up to MAX_READERS readers, in any mix of
+     * processes, share a named POSIX shm segment: one page of control
+     * followed by the data ring. Every cursor is a monotonically
+     * increasing 64-bit item count, so writer and readers synchronize
+     * without locks; the writer publishes with a barriered cursor
+     * bump and never overwrites data an attached reader has not
+     * consumed yet.
+     *
+     * First to attach (writer or reader) initializes the segment;
+     * later arrivals validate the item size and capacity against what
+     * they were constructed with. This is an implementation detail of
+     * the bus blocks and not installed.
+     */
+    class bus_buffer
+    {
+    public:
+      static const unsigned int MAX_READERS = 16;
+
+      struct reader_slot {
+        volatile uint32_t state;        // 0 free, 1 claiming, 2 attached
+        uint32_t pad;
+        volatile uint64_t read_cursor;  // items consumed by this reader
+      };
+
+      struct control {
+        volatile uint32_t state;        // 0 fresh, 1 initializing, 2 ready
+        uint32_t magic;
+        uint64_t bufsize;               // ring capacity in items
+        uint32_t itemsize;              // bytes per item
+        uint32_t max_readers;
+        volatile uint64_t write_cursor; // items ever written
+        reader_slot readers[MAX_READERS];
+      };
+
+      /*!
+       * Attach to (creating if necessary) the bus \p name with
+       * \p bufsize_items items of \p itemsize bytes each. Throws
+       * std::runtime_error on a geometry mismatch with an already
+       * initialized segment.
+       */
+      bus_buffer(const std::string &name, size_t itemsize, size_t bufsize_items);
+      ~bus_buffer();
+
+      const std::string &name() const { return d_name; }
+      uint64_t bufsize() const { return d_ctl->bufsize; }
+      size_t itemsize() const { return d_ctl->itemsize; }
+
+      // writer side
+      //! Items writable right now without lapping the slowest attached reader
+      uint64_t space_available();
+      //! Copy \p nitems into the ring and publish them; caller checks space first
+      void write(const void *buf, uint64_t nitems);
+
+      // reader side
+      //! Claim a reader slot starting at the current write position
+      int attach_reader();
+      void detach_reader(int slot);
+      //! Items the writer has published past this reader's cursor
+      uint64_t items_available(int slot);
+      //! Copy out up to \p max_items items; returns the number copied
+      uint64_t read(int slot, void *buf, uint64_t max_items);
+
+      //! Unlink the named segment; mappings already attached stay valid
+      static void remove(const std::string &name);
+
+    private:
+      std::string d_name;
+      boost::interprocess::shared_memory_object d_shm;
+      boost::interprocess::mapped_region d_region;
+      control *d_ctl;
+      char *d_data;
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_BUS_BUFFER_H */
@@ -0,0 +1,88 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bus_sink_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/thread/thread.hpp>
+
+namespace gr {
+  namespace blocks {
+
+    bus_sink::sptr
+    bus_sink::make(size_t itemsize,
+                   const std::string &name,
+                   size_t bufsize_items)
+    {
+      return gnuradio::get_initial_sptr
+        (new bus_sink_impl(itemsize, name, bufsize_items));
+    }
+
+    bus_sink_impl::bus_sink_impl(size_t itemsize,
+                                 const std::string &name,
+                                 size_t bufsize_items)
+      : sync_block("bus_sink",
+                   io_signature::make(1, 1, itemsize),
+                   io_signature::make(0, 0, 0)),
+        d_itemsize(itemsize),
+        d_bus(new bus_buffer(name, itemsize, bufsize_items))
+    {
+    }
+
+    bus_sink_impl::~bus_sink_impl()
+    {
+      std::string name = d_bus->name();
+      delete d_bus;
+
+      // Unlink the segment; attached readers keep their mapping
+      // until they detach.
+      bus_buffer::remove(name);
+    }
+
+    int
+    bus_sink_impl::work(int noutput_items,
+                        gr_vector_const_void_star &input_items,
+                        gr_vector_void_star &output_items)
+    {
+      const char *in = (const char*)input_items[0];
+
+      // Never lap a reader; if everyone is behind, wait for the
+      // slowest one to make room.
+      uint64_t space = d_bus->space_available();
+      if(space == 0) {
+        boost::this_thread::sleep(boost::posix_time::microseconds(100));
+        return 0;
+      }
+
+      int n = noutput_items;
+      if((uint64_t)n > space)
+        n = (int)space;
+
+      d_bus->write(in, n);
+      return n;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bus_source_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/thread/thread.hpp>
+
+namespace gr {
+  namespace blocks {
+
+    bus_source::sptr
+    bus_source::make(size_t itemsize,
+                     const std::string &name,
+                     size_t bufsize_items)
+    {
+      return gnuradio::get_initial_sptr
+        (new bus_source_impl(itemsize, name, bufsize_items));
+    }
+
+    bus_source_impl::bus_source_impl(size_t itemsize,
+                                     const std::string &name,
+                                     size_t bufsize_items)
+      : sync_block("bus_source",
+                   io_signature::make(0, 0, 0),
+                   io_signature::make(1, 1, itemsize)),
+        d_itemsize(itemsize),
+        d_bus(new bus_buffer(name, itemsize, bufsize_items)),
+        d_slot(-1)
+    {
+      d_slot = d_bus->attach_reader();
+    }
+
+    bus_source_impl::~bus_source_impl()
+    {
+      if(d_slot >= 0)
+        d_bus->detach_reader(d_slot);
+      delete d_bus;
+    }
+
+    int
+    bus_source_impl::work(int noutput_items,
+                          gr_vector_const_void_star &input_items,
+                          gr_vector_void_star &output_items)
+    {
+      char *out = (char*)output_items[0];
+
+      uint64_t n = d_bus->read(d_slot, out, noutput_items);
+      if(n == 0) {
+        // Nothing published since our cursor; don't spin on the
+        // scheduler while the writer is idle.
+        boost::this_thread::sleep(boost::posix_time::microseconds(100));
+        return 0;
+      }
+
+      return (int)n;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
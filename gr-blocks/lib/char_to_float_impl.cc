@@ -45,6 +45,17 @@ namespace gr {
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(float);
       set_alignment(std::max(1, alignment_multiple));
+      set_work_kernel(&char_to_float_impl::convert_kernel, this);
+    }
+
+    int
+    char_to_float_impl::convert_kernel(const void *src, void *dst,
+				       int noutput_items, void *arg)
+    {
+      char_to_float_impl *self = static_cast<char_to_float_impl*>(arg);
+      volk_8i_s32f_convert_32f_u((float *)dst, (const int8_t *)src,
+				 self->d_scale, self->d_vlen*noutput_items);
+      return noutput_items;
     }
 
     int
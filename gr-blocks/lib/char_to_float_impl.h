@@ -33,6 +33,11 @@ namespace gr {
       size_t d_vlen;
       float d_scale;
 
+      // direct-call fast path for 1-in/1-out connections
+      // (see block::set_work_kernel)
+      static int convert_kernel(const void *src, void *dst,
+                                int noutput_items, void *arg);
+
     public:
       char_to_float_impl(size_t vlen, float scale);
 
@@ -0,0 +1,217 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "chunk_compress.h"
+#include <cstring>
+
+/*
+ * Greedy byte-oriented LZ with a 64 kB window, in the style of the
+ * fast LZ family: a sequence is a token byte (literal run length in
+ * the high nibble, match length - 4 in the low nibble, 15 meaning
+ * "continued in following bytes"), the literals, a 2-byte
+ * little-endian match offset and any match length continuation
+ * bytes.  A chunk ends in a sequence with no match.
+ */
+
+namespace gr {
+  namespace blocks {
+
+    static const size_t MINMATCH = 4;
+    static const size_t LASTLITERALS = 5;     // matches end before these
+    static const size_t MFLIMIT = 12;         // matches start before these
+    static const size_t MAX_OFFSET = 65535;
+    static const int HASH_BITS = 13;
+
+    static inline uint32_t
+    read32(const unsigned char *p)
+    {
+      uint32_t v;
+      memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    static inline uint32_t
+    hash32(uint32_t seq)
+    {
+      return (seq * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    size_t
+    chunk_compress_bound(size_t n)
+    {
+      return n + n/255 + 16;
+    }
+
+    size_t
+    chunk_compress(const unsigned char *src, size_t n, unsigned char *dst)
+    {
+      if(n < MFLIMIT + 1)
+        return 0;                     // too short to ever shrink
+
+      uint32_t tab[1 << HASH_BITS];   // position + 1, 0 = empty
+      memset(tab, 0, sizeof(tab));
+
+      const size_t mflimit = n - MFLIMIT;
+      const size_t matchlimit = n - LASTLITERALS;
+      size_t ip = 0, anchor = 0, op = 0;
+
+      while(ip < mflimit) {
+        uint32_t seq = read32(src + ip);
+        uint32_t h = hash32(seq);
+        size_t cand = tab[h];
+        tab[h] = (uint32_t)(ip + 1);
+
+        if(cand == 0 || ip + 1 - cand > MAX_OFFSET
+           || read32(src + cand - 1) != seq) {
+          ip++;
+          continue;
+        }
+        size_t ref = cand - 1;
+
+        size_t mlen = MINMATCH;
+        while(ip + mlen < matchlimit && src[ref + mlen] == src[ip + mlen])
+          mlen++;
+
+        // token + literal run
+        size_t litlen = ip - anchor;
+        unsigned char *token = &dst[op++];
+        if(litlen >= 15) {
+          *token = 15 << 4;
+          size_t rest = litlen - 15;
+          while(rest >= 255) {
+            dst[op++] = 255;
+            rest -= 255;
+          }
+          dst[op++] = (unsigned char)rest;
+        }
+        else
+          *token = (unsigned char)(litlen << 4);
+        memcpy(&dst[op], &src[anchor], litlen);
+        op += litlen;
+
+        // offset + match length
+        size_t offset = ip - ref;
+        dst[op++] = (unsigned char)(offset & 0xff);
+        dst[op++] = (unsigned char)(offset >> 8);
+        size_t ml = mlen - MINMATCH;
+        if(ml >= 15) {
+          *token |= 15;
+          size_t rest = ml - 15;
+          while(rest >= 255) {
+            dst[op++] = 255;
+            rest -= 255;
+          }
+          dst[op++] = (unsigned char)rest;
+        }
+        else
+          *token |= (unsigned char)ml;
+
+        ip += mlen;
+        anchor = ip;
+      }
+
+      // trailing literals
+      size_t litlen = n - anchor;
+      unsigned char *token = &dst[op++];
+      if(litlen >= 15) {
+        *token = 15 << 4;
+        size_t rest = litlen - 15;
+        while(rest >= 255) {
+          dst[op++] = 255;
+          rest -= 255;
+        }
+        dst[op++] = (unsigned char)rest;
+      }
+      else
+        *token = (unsigned char)(litlen << 4);
+      memcpy(&dst[op], &src[anchor], litlen);
+      op += litlen;
+
+      if(op >= n)
+        return 0;                     // did not shrink; store raw
+      return op;
+    }
+
+    size_t
+    chunk_decompress(const unsigned char *src, size_t n,
+                     unsigned char *dst, size_t rawsize)
+    {
+      size_t ip = 0, op = 0;
+
+      while(ip < n) {
+        unsigned token = src[ip++];
+
+        size_t litlen = token >> 4;
+        if(litlen == 15) {
+          unsigned char b;
+          do {
+            if(ip >= n)
+              return (size_t)-1;
+            b = src[ip++];
+            litlen += b;
+          } while(b == 255);
+        }
+        if(ip + litlen > n || op + litlen > rawsize)
+          return (size_t)-1;
+        memcpy(&dst[op], &src[ip], litlen);
+        ip += litlen;
+        op += litlen;
+
+        if(ip >= n)                   // sequence without a match ends the chunk
+          break;
+
+        if(ip + 2 > n)
+          return (size_t)-1;
+        size_t offset = src[ip] | ((size_t)src[ip + 1] << 8);
+        ip += 2;
+        if(offset == 0 || offset > op)
+          return (size_t)-1;
+
+        size_t mlen = (token & 15) + MINMATCH;
+        if((token & 15) == 15) {
+          unsigned char b;
+          do {
+            if(ip >= n)
+              return (size_t)-1;
+            b = src[ip++];
+            mlen += b;
+          } while(b == 255);
+        }
+        if(op + mlen > rawsize)
+          return (size_t)-1;
+
+        // byte-wise on purpose: the match may overlap its output
+        const unsigned char *m = &dst[op - offset];
+        for(size_t i = 0; i < mlen; i++)
+          dst[op + i] = m[i];
+        op += mlen;
+      }
+
+      return op == rawsize ? op : (size_t)-1;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,79 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_CHUNK_COMPRESS_H
+#define INCLUDED_GR_BLOCKS_CHUNK_COMPRESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Self-contained byte-oriented LZ codec used by the compressed
+ * capture format of file_sink/file_source.  One chunk is compressed
+ * independently of the others, so a reader can skip chunks using
+ * only the framing headers without decompressing them.
+ *
+ * Compressed capture file layout:
+ *
+ *   uint32_t  CHUNK_COMPRESS_MAGIC
+ *   uint32_t  CHUNK_COMPRESS_VERSION
+ *   repeated chunks:
+ *     uint32_t  raw_len     uncompressed bytes in this chunk
+ *     uint32_t  comp_len    payload bytes; == raw_len means the
+ *                           payload is stored uncompressed
+ *     payload
+ *
+ * All fields are in the byte order of the writing machine, like the
+ * sample data itself.
+ */
+
+namespace gr {
+  namespace blocks {
+
+    static const uint32_t CHUNK_COMPRESS_MAGIC = 0x4752435A;   // "GRCZ"
+    static const uint32_t CHUNK_COMPRESS_VERSION = 1;
+
+    //! Worst-case compressed size for \p n input bytes.
+    size_t chunk_compress_bound(size_t n);
+
+    /*!
+     * Compress \p n bytes from \p src into \p dst (at least
+     * chunk_compress_bound(n) bytes). Returns the compressed size,
+     * or 0 if the data did not shrink; the caller then stores the
+     * chunk uncompressed.
+     */
+    size_t chunk_compress(const unsigned char *src, size_t n,
+                          unsigned char *dst);
+
+    /*!
+     * Decompress a chunk produced by chunk_compress. \p rawsize must
+     * be the raw_len recorded in the chunk header and \p dst must
+     * hold that many bytes. Returns the number of bytes produced,
+     * or (size_t)-1 if the payload is corrupt.
+     */
+    size_t chunk_decompress(const unsigned char *src, size_t n,
+                            unsigned char *dst, size_t rawsize);
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_CHUNK_COMPRESS_H */
@@ -58,11 +58,9 @@ namespace gr {
       int noi = noutput_items * d_vlen;
       
       // The fast_atan2f is faster than Volk
-      for (int i = 0; i < noi; i++){
-	//    out[i] = std::arg (in[i]);
-	out[i] = gr::fast_atan2f(in[i]);
-      }
-      
+      gr::fast_atan2f_vec(in, out, noi);
+
+
       return noutput_items;
     }
 
@@ -0,0 +1,63 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "complex_to_interleaved_half_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+  namespace blocks {
+
+    complex_to_interleaved_half::sptr complex_to_interleaved_half::make()
+    {
+      return gnuradio::get_initial_sptr(new complex_to_interleaved_half_impl());
+    }
+
+    complex_to_interleaved_half_impl::complex_to_interleaved_half_impl()
+      : sync_interpolator("complex_to_interleaved_half",
+			     io_signature::make (1, 1, sizeof(gr_complex)),
+			     io_signature::make (1, 1, sizeof(short)),
+			     2)
+    {
+    }
+
+    int
+    complex_to_interleaved_half_impl::work(int noutput_items,
+					   gr_vector_const_void_star &input_items,
+					   gr_vector_void_star &output_items)
+    {
+      const float *in = (const float *) input_items[0];
+      uint16_t *out = (uint16_t *) output_items[0];
+
+      // A complex stream is laid out as interleaved floats already;
+      // noutput_items counts halves.
+      volk_32f_convert_16h(out, in, noutput_items);
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
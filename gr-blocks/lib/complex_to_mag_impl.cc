@@ -31,16 +31,16 @@
 namespace gr {
   namespace blocks {
 
-    complex_to_mag::sptr complex_to_mag::make(size_t vlen)
+    complex_to_mag::sptr complex_to_mag::make(size_t vlen, bool approx)
     {
-      return gnuradio::get_initial_sptr(new complex_to_mag_impl(vlen));
+      return gnuradio::get_initial_sptr(new complex_to_mag_impl(vlen, approx));
     }
 
-    complex_to_mag_impl::complex_to_mag_impl(size_t vlen)
+    complex_to_mag_impl::complex_to_mag_impl(size_t vlen, bool approx)
       : sync_block("complex_to_mag",
 		      io_signature::make (1, 1, sizeof(gr_complex)*vlen),
 		      io_signature::make (1, 1, sizeof(float)*vlen)),
-	d_vlen(vlen)
+	d_vlen(vlen), d_approx(approx)
     {
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(float);
@@ -57,8 +57,11 @@ namespace gr {
       int noi = noutput_items * d_vlen;
 
       // turned out to be faster than aligned/unaligned switching
-      volk_32fc_magnitude_32f_u(out, in, noi);
-      
+      if(d_approx)
+	volk_32fc_magnitude_est_32f_u(out, in, noi);
+      else
+	volk_32fc_magnitude_32f_u(out, in, noi);
+
       return noutput_items;
     }
 
@@ -31,9 +31,13 @@ namespace gr {
     class BLOCKS_API complex_to_mag_impl : public complex_to_mag
     {
       size_t d_vlen;
+      bool d_approx;
 
     public:
-      complex_to_mag_impl(size_t vlen);
+      complex_to_mag_impl(size_t vlen, bool approx);
+
+      void set_approx(bool approx) { d_approx = approx; }
+      bool approx() const { return d_approx; }
 
       int work(int noutput_items,
 	       gr_vector_const_void_star &input_items,
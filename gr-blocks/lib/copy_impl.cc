@@ -45,6 +45,19 @@ namespace gr {
         d_itemsize(itemsize),
         d_enabled(true)
     {
+      // Not declared transparent: set_enabled() may turn the copy
+      // into a sample dropper at any time, but a collapsed block is
+      // aliased out of the started flowgraph and never runs again.
+      set_work_kernel(&copy_impl::copy_kernel, this);
+    }
+
+    int
+    copy_impl::copy_kernel(const void *src, void *dst,
+                           int noutput_items, void *arg)
+    {
+      copy_impl *self = static_cast<copy_impl*>(arg);
+      memcpy(dst, src, noutput_items * self->d_itemsize);
+      return noutput_items;
     }
 
     copy_impl::~copy_impl()
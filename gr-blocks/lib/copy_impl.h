@@ -34,6 +34,11 @@ namespace gr {
       size_t d_itemsize;
       bool d_enabled;
 
+      // direct-call fast path used by the scheduler when the copy is
+      // connected 1-in/1-out (see block::set_work_kernel)
+      static int copy_kernel(const void *src, void *dst,
+                             int noutput_items, void *arg);
+
     public:
       copy_impl(size_t itemsize);
       ~copy_impl();
@@ -41,7 +46,13 @@ namespace gr {
       void forecast(int noutput_items, gr_vector_int &ninput_items_required);
       bool check_topology(int ninputs, int noutputs);
 
-      void set_enabled(bool enable) { d_enabled = enable; }
+      void set_enabled(bool enable)
+      {
+        d_enabled = enable;
+        // a disabled copy consumes without producing, which the
+        // kernel contract cannot express
+        set_work_kernel(enable ? &copy_impl::copy_kernel : 0, this);
+      }
       bool enabled() const { return d_enabled;}
 
       int general_work(int noutput_items,
@@ -43,6 +43,11 @@ namespace gr {
 
       std::vector<gr_complex> d_buffer;
 
+      // collection is armed by get() and disarmed when the buffer
+      // fills; work() reads the flag unlocked, so a probe nobody is
+      // polling costs a single branch per call
+      volatile bool d_collect;
+
     public:
       ctrlport_probe2_c_impl(const std::string &id, const std::string &desc,
                              int len, unsigned int disp_mask);
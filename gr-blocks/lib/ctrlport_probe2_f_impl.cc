@@ -43,7 +43,8 @@ namespace gr {
     : sync_block("probe2_f",
                  io_signature::make(1, 1, sizeof(float)),
                  io_signature::make(0, 0, 0)),
-      d_id(id), d_desc(desc), d_len(len), d_disp_mask(disp_mask)
+      d_id(id), d_desc(desc), d_len(len), d_disp_mask(disp_mask),
+          d_collect(false)
     {
       set_length(len);
     }
@@ -70,6 +71,7 @@ namespace gr {
     {
       mutex_buffer.lock();
       d_buffer.clear();
+      d_collect = true;
       mutex_buffer.unlock();
 
       // wait for condition
@@ -110,6 +112,11 @@ namespace gr {
     {
       const float *in = (const float*)input_items[0];
 
+      // without an outstanding get() there is nothing to collect;
+      // skip the lock entirely so dormant probes stay free
+      if(!d_collect)
+        return noutput_items;
+
       // copy samples to get buffer if we need samples
       mutex_buffer.lock();
       if(d_buffer.size() < d_len) {
@@ -123,6 +130,7 @@ namespace gr {
     
         // notify the waiting get() if we fill up the buffer
         if(d_buffer.size() == d_len) {
+          d_collect = false;
           condition_buffer_ready.notify_one();
         }
       }
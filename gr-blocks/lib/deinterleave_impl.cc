@@ -26,10 +26,38 @@
 
 #include "deinterleave_impl.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <stdint.h>
 
 namespace gr {
   namespace blocks {
 
+    /*
+     * Deinterleave is a transpose; do it in tiles sized so the
+     * strided side stays in L1.  Each channel's items are gathered
+     * from the tile's window of the input and written in a long
+     * sequential run, instead of round-robining one memcpy per item.
+     */
+    static const size_t TILE_BYTES_PER_CHAN = 16384;
+
+    template <typename T>
+    static inline void
+    deinterleave_typed(T **out, const T *in, size_t nchan, size_t nitems_per_chan)
+    {
+      size_t tile = std::max((size_t)1, TILE_BYTES_PER_CHAN / (nchan * sizeof(T)));
+
+      for (size_t base = 0; base < nitems_per_chan; base += tile) {
+	size_t end = std::min(base + tile, nitems_per_chan);
+	for (unsigned int n = 0; n < nchan; n++) {
+	  const T *src = in + base * nchan + n;
+	  T *dst = out[n] + base;
+	  for (size_t i = 0; i < end - base; i++)
+	    dst[i] = src[i * nchan];
+	}
+      }
+    }
+
     deinterleave::sptr deinterleave::make(size_t itemsize)
     {
       return gnuradio::get_initial_sptr(new deinterleave_impl(itemsize));
@@ -59,16 +87,60 @@ namespace gr {
       size_t nchan = output_items.size();
       size_t itemsize = d_itemsize;
       const char *in = (const char *)input_items[0];
-      char **out = (char **)&output_items[0];
-      
-      for (int i = 0; i < noutput_items; i++){
-	for (unsigned int n = 0; n < nchan; n++){
-	  memcpy(out[n], in, itemsize);
-	  out[n] += itemsize;
-	  in += itemsize;
+
+      if (nchan == 1) {
+	memcpy(output_items[0], in, noutput_items * itemsize);
+	return noutput_items;
+      }
+
+      // Splitting a pairwise-interleaved stream onto two outputs is
+      // exactly the volk complex-to-I/Q deinterleave kernels.
+      if (nchan == 2 && itemsize == sizeof(int16_t)) {
+	volk_16ic_deinterleave_16i_x2((int16_t *)output_items[0],
+				      (int16_t *)output_items[1],
+				      (const lv_16sc_t *)in,
+				      noutput_items);
+	return noutput_items;
+      }
+      if (nchan == 2 && itemsize == sizeof(float)) {
+	volk_32fc_deinterleave_32f_x2((float *)output_items[0],
+				      (float *)output_items[1],
+				      (const lv_32fc_t *)in,
+				      noutput_items);
+	return noutput_items;
+      }
+
+      switch (itemsize) {
+      case 1:
+	deinterleave_typed((uint8_t **)&output_items[0], (const uint8_t *)in,
+			   nchan, noutput_items);
+	break;
+      case 2:
+	deinterleave_typed((uint16_t **)&output_items[0], (const uint16_t *)in,
+			   nchan, noutput_items);
+	break;
+      case 4:
+	deinterleave_typed((uint32_t **)&output_items[0], (const uint32_t *)in,
+			   nchan, noutput_items);
+	break;
+      case 8:
+	deinterleave_typed((uint64_t **)&output_items[0], (const uint64_t *)in,
+			   nchan, noutput_items);
+	break;
+      default:
+	{
+	  char **out = (char **)&output_items[0];
+	  for (int i = 0; i < noutput_items; i++){
+	    for (unsigned int n = 0; n < nchan; n++){
+	      memcpy(out[n], in, itemsize);
+	      out[n] += itemsize;
+	      in += itemsize;
+	    }
+	  }
 	}
+	break;
       }
-      
+
       return noutput_items;
     }
 
@@ -0,0 +1,104 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_FAST_MATH_H
+#define INCLUDED_GR_BLOCKS_FAST_MATH_H
+
+#include <stdint.h>
+
+/*
+ * Fast approximate float transcendentals for sample-rate conversion
+ * blocks where libm calls dominate the profile (dB conversion, AGC
+ * style exponentials). They trade accuracy for speed by operating
+ * directly on the IEEE-754 representation:
+ *
+ *   log2: split off the exponent, evaluate a least-squares cubic on
+ *         the mantissa in [1,2).  Max abs error ~1.4e-3 in log2
+ *         (~0.004 dB through 10*log10).
+ *   exp2: split into integer and fractional parts, cubic on 2^f for
+ *         f in [0,1), exponent reassembled through the bit pattern.
+ *         Max relative error ~2e-4.
+ *
+ * Inputs are assumed finite; denormals, zero and negative arguments
+ * to the log family are not handled (callers clamp, as nlog10_ff
+ * always has). Not installed -- internal to gr-blocks.
+ */
+
+namespace gr {
+  namespace blocks {
+
+    static inline float
+    fast_log2(float x)
+    {
+      union { float f; uint32_t i; } u;
+      u.f = x;
+      int e = (int)((u.i >> 23) & 0xff) - 127;
+      u.i = (u.i & 0x007fffff) | 0x3f800000;  // mantissa in [1,2)
+      float m = u.f;
+      return (float)e +
+        (((0.15391353f * m - 1.02949276f) * m + 3.01073030f) * m - 2.13381654f);
+    }
+
+    static inline float
+    fast_log(float x)
+    {
+      return fast_log2(x) * 0.69314718f;  // ln(2)
+    }
+
+    static inline float
+    fast_log10(float x)
+    {
+      return fast_log2(x) * 0.30102999f;  // log10(2)
+    }
+
+    static inline float
+    fast_exp2(float x)
+    {
+      // clamp to the finite single-precision range
+      if(x > 127.0f)
+        x = 127.0f;
+      else if(x < -126.0f)
+        x = -126.0f;
+
+      int ipart = (int)x;
+      if(x < (float)ipart)  // floor for negative arguments
+        ipart--;
+      float f = x - (float)ipart;
+
+      float p =
+        ((0.07901994f * f + 0.22412644f) * f + 0.69683858f) * f + 0.99981196f;
+
+      union { float f; uint32_t i; } u;
+      u.i = (uint32_t)(ipart + 127) << 23;  // 2^ipart
+      return u.f * p;
+    }
+
+    static inline float
+    fast_exp(float x)
+    {
+      return fast_exp2(x * 1.44269504f);  // log2(e)
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_FAST_MATH_H */
@@ -38,26 +38,48 @@
 #ifdef HAVE_IO_H
 #include <io.h>
 #endif
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
 
 namespace gr {
   namespace blocks {
 
+    static const pmt::pmt_t EOF_KEY = pmt::string_to_symbol("fd_eof");
+    static const pmt::pmt_t UNDERRUN_KEY = pmt::string_to_symbol("fd_underrun");
+
     file_descriptor_source::sptr
-    file_descriptor_source::make(size_t itemsize, int fd, bool repeat)
+    file_descriptor_source::make(size_t itemsize, int fd, bool repeat,
+                                 bool nonblock)
     {
       return gnuradio::get_initial_sptr
-        (new file_descriptor_source_impl(itemsize, fd, repeat));
+        (new file_descriptor_source_impl(itemsize, fd, repeat, nonblock));
     }
 
     file_descriptor_source_impl::file_descriptor_source_impl(size_t itemsize,
                                                              int fd,
-                                                             bool repeat)
+                                                             bool repeat,
+                                                             bool nonblock)
       : sync_block("file_descriptor_source",
                       io_signature::make(0, 0, 0),
                       io_signature::make(1, 1, itemsize)),
         d_itemsize(itemsize), d_fd(fd), d_repeat(repeat),
-        d_residue(new unsigned char[itemsize]), d_residue_len (0)
+        d_nonblock(nonblock),
+        d_residue(new unsigned char[itemsize]), d_residue_len (0),
+        d_underrun(false), d_eof(false)
     {
+      if(nonblock) {
+#if defined(HAVE_POLL_H) && defined(O_NONBLOCK)
+        int flags = fcntl(d_fd, F_GETFL, 0);
+        if(flags == -1 || fcntl(d_fd, F_SETFL, flags | O_NONBLOCK) == -1)
+          throw std::runtime_error("file_descriptor_source: failed to set O_NONBLOCK");
+#else
+        throw std::runtime_error("file_descriptor_source: nonblocking mode not supported on this platform");
+#endif
+      }
     }
 
     file_descriptor_source_impl::~file_descriptor_source_impl()
@@ -80,6 +102,32 @@ namespace gr {
         d_residue_len = 0;
       }
 
+#ifdef HAVE_SYS_UIO_H
+      // Scatter the read across the output span and the residue
+      // buffer, so a read that runs past the last whole item parks
+      // the partial tail directly where the next call picks it up.
+      struct iovec iov[2];
+      iov[0].iov_base = buf + nbytes_read;
+      iov[0].iov_len = nitems * d_itemsize - nbytes_read;
+      iov[1].iov_base = d_residue;
+      iov[1].iov_len = d_itemsize - 1;
+      int r = readv(d_fd, iov, 2);
+      if(r <= 0) {
+        handle_residue(buf, nbytes_read);
+        return r;
+      }
+
+      r += nbytes_read;
+      int span = nitems * d_itemsize;
+      if(r >= span) {
+        // output span is full; any surplus bytes already sit in the
+        // residue buffer
+        d_residue_len = r - span;
+        return nitems;
+      }
+
+      r = handle_residue(buf, r);
+#else
       int r = read(d_fd, buf + nbytes_read,
                    nitems * d_itemsize - nbytes_read);
       if(r <= 0) {
@@ -88,6 +136,7 @@ namespace gr {
       }
 
       r = handle_residue(buf, r + nbytes_read);
+#endif
 
       if(r == 0)     // block until we get something
         return read_items(buf, nitems);
@@ -108,6 +157,22 @@ namespace gr {
       return nitems_read;
     }
 
+    bool
+    file_descriptor_source_impl::wait_readable()
+    {
+#ifdef HAVE_POLL_H
+      // Bounded wait so stopping the flowgraph stays responsive even
+      // when the far end of the pipe has gone quiet.
+      struct pollfd pfd;
+      pfd.fd = d_fd;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+      return poll(&pfd, 1, 100) > 0;
+#else
+      return true;
+#endif
+    }
+
     int
     file_descriptor_source_impl::work(int noutput_items,
                                       gr_vector_const_void_star &input_items,
@@ -115,22 +180,37 @@ namespace gr {
     {
       assert(noutput_items > 0);
 
+      if(d_eof)
+        return -1;
+
       char *o = (char*)output_items[0];
       int nread = 0;
 
-      while(1) {
+      while(nread < noutput_items) {
         int r = read_items(o, noutput_items - nread);
         if(r == -1) {
           if(errno == EINTR)
             continue;
+#ifdef O_NONBLOCK
+          else if(d_nonblock && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if(nread > 0)       // ship what has arrived so far
+              break;
+            if(wait_readable())
+              continue;
+            d_underrun = true;  // pipe hiccup; tag the next batch
+            return 0;
+          }
+#endif
           else {
             perror("file_descriptor_source[read]");
             return -1;
           }
         }
         else if(r == 0) {	  // end of file
-          if(!d_repeat)
+          if(!d_repeat) {
+            d_eof = true;
             break;
+          }
           else {
             flush_residue();
             if(lseek(d_fd, 0, SEEK_SET) == -1) {
@@ -142,13 +222,24 @@ namespace gr {
         else {
           o += r * d_itemsize;
           nread += r;
-          break;
+          if(!d_nonblock)       // classic behavior: one read per call
+            break;
         }
       }
 
       if(nread == 0)	// EOF
         return -1;
 
+      if(d_underrun) {
+        add_item_tag(0, nitems_written(0), UNDERRUN_KEY,
+                     pmt::PMT_T, alias_pmt());
+        d_underrun = false;
+      }
+      if(d_eof) {
+        add_item_tag(0, nitems_written(0) + nread - 1, EOF_KEY,
+                     pmt::PMT_T, alias_pmt());
+      }
+
       return nread;
     }
 
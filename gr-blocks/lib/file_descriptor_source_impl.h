@@ -34,17 +34,25 @@ namespace gr {
       size_t d_itemsize;
       int    d_fd;
       bool   d_repeat;
+      bool   d_nonblock;
 
       unsigned char *d_residue;
       unsigned long  d_residue_len;
 
+      bool d_underrun;  // pipe ran dry; tag the next batch
+      bool d_eof;       // end of stream seen
+
+      //! Wait (bounded) for the descriptor to become readable
+      bool wait_readable();
+
     protected:
       int read_items(char *buf, int nitems);
       int handle_residue(char *buf, int nbytes_read);
       void flush_residue() { d_residue_len = 0; }
 
     public:
-      file_descriptor_source_impl(size_t itemsize, int fd, bool repeat);
+      file_descriptor_source_impl(size_t itemsize, int fd, bool repeat,
+                                  bool nonblock);
       ~file_descriptor_source_impl();
 
       int work(int noutput_items,
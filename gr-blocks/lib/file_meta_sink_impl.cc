@@ -85,7 +85,8 @@ namespace gr {
 	d_itemsize(itemsize),
 	d_samp_rate(samp_rate), d_relative_rate(relative_rate),
 	d_max_seg_size(max_segment_size), d_total_seg_size(0),
-	d_updated(false), d_unbuffered(false)
+	d_updated(false), d_unbuffered(false),
+	d_write_index(false)
     {
       d_fp = 0;
       d_new_fp = 0;
@@ -131,10 +132,14 @@ namespace gr {
 
       do_update();
 
-      if(d_state == STATE_DETACHED)
+      if(d_state == STATE_DETACHED) {
+	index_new_segment(d_hdr_fp);
 	write_header(d_hdr_fp, d_header, d_extra);
-      else
+      }
+      else {
+	index_new_segment(d_fp);
 	write_header(d_fp, d_header, d_extra);
+      }
     }
 
     file_meta_sink_impl::~file_meta_sink_impl()
@@ -204,6 +209,16 @@ namespace gr {
       gr::thread::scoped_lock guard(d_mutex); // hold mutex for duration of this function
       update_last_header();
 
+      if(d_write_index) {
+	if(d_state == STATE_DETACHED) {
+	  if(d_hdr_fp)
+	    write_index_footer(d_hdr_fp);
+	}
+	else if(d_fp)
+	  write_index_footer(d_fp);
+      }
+      d_index.clear();
+
       if(d_state == STATE_DETACHED) {
 	if(d_new_hdr_fp) {
 	  fclose(d_new_hdr_fp);
@@ -302,6 +317,7 @@ namespace gr {
 	update_last_header_detached();
       else
 	update_last_header_inline();
+      index_sync_last();
     }
 
     void
@@ -349,10 +365,71 @@ namespace gr {
       s = pmt::from_uint64(METADATA_HEADER_SIZE + d_extra_size);
       update_header(mp("strt"), s);
 
-      if(d_state == STATE_DETACHED)
+      if(d_state == STATE_DETACHED) {
+	index_new_segment(d_hdr_fp);
 	write_header(d_hdr_fp, d_header, d_extra);
-      else
+      }
+      else {
+	index_new_segment(d_fp);
 	write_header(d_fp, d_header, d_extra);
+      }
+    }
+
+    void
+    file_meta_sink_impl::index_new_segment(FILE *fp)
+    {
+      // Segments are always tracked in memory; the footer only hits
+      // the disk on close() when set_index(true) has been called.
+      meta_index_entry e;
+      e.hdr_offset = (uint64_t)ftell(fp);
+      if(d_state == STATE_DETACHED)
+	e.data_offset = (uint64_t)ftell(d_fp);
+      else
+	e.data_offset = e.hdr_offset + METADATA_HEADER_SIZE + d_extra_size;
+      e.nbytes = 0;
+
+      pmt::pmt_t r = pmt::dict_ref(d_header, mp("rx_time"), pmt::PMT_NIL);
+      e.time_secs = pmt::to_uint64(pmt::tuple_ref(r, 0));
+      e.time_fracs = pmt::to_double(pmt::tuple_ref(r, 1));
+      e.samp_rate = pmt::to_double(pmt::dict_ref(d_header, mp("rx_rate"),
+						 pmt::PMT_NIL));
+
+      d_index.push_back(e);
+    }
+
+    void
+    file_meta_sink_impl::index_sync_last()
+    {
+      // Mirror whatever update_last_header just rewrote on disk into
+      // the in-memory index entry for the current segment.
+      if(d_index.empty())
+	return;
+
+      meta_index_entry &e = d_index.back();
+      e.nbytes = d_itemsize*d_total_seg_size;
+
+      pmt::pmt_t r = pmt::dict_ref(d_header, mp("rx_time"), pmt::PMT_NIL);
+      e.time_secs = pmt::to_uint64(pmt::tuple_ref(r, 0));
+      e.time_fracs = pmt::to_double(pmt::tuple_ref(r, 1));
+      e.samp_rate = pmt::to_double(pmt::dict_ref(d_header, mp("rx_rate"),
+						 pmt::PMT_NIL));
+    }
+
+    void
+    file_meta_sink_impl::write_index_footer(FILE *fp)
+    {
+      if(d_index.empty())
+	return;
+
+      fwrite(&d_index[0], sizeof(meta_index_entry), d_index.size(), fp);
+
+      uint64_t nentries = d_index.size();
+      uint32_t version = METADATA_INDEX_VERSION;
+      uint32_t magic = METADATA_INDEX_MAGIC;
+      fwrite(&nentries, sizeof(nentries), 1, fp);
+      fwrite(&version, sizeof(version), 1, fp);
+      fwrite(&magic, sizeof(magic), 1, fp);
+      fflush(fp);
     }
 
     void
@@ -50,6 +50,8 @@ namespace gr {
       size_t d_extra_size;
       bool d_updated;
       bool d_unbuffered;
+      bool d_write_index;
+      std::vector<meta_index_entry> d_index;
 
       boost::mutex d_mutex;
       FILE *d_new_fp, *d_new_hdr_fp;
@@ -64,6 +66,9 @@ namespace gr {
       void update_last_header_detached();
       void write_and_update();
       void update_rx_time();
+      void index_new_segment(FILE *fp);
+      void index_sync_last();
+      void write_index_footer(FILE *fp);
 
       bool _open(FILE **fp, const char *filename);
 
@@ -85,6 +90,11 @@ namespace gr {
 	d_unbuffered = unbuffered;
       }
 
+      void set_index(bool index)
+      {
+	d_write_index = index;
+      }
+
       int work(int noutput_items,
 	       gr_vector_const_void_star &input_items,
 	       gr_vector_void_star &output_items);
@@ -77,7 +77,8 @@ namespace gr {
 		      io_signature::make(1, 1, 1)),
 	d_itemsize(0), d_samp_rate(0),
 	d_seg_size(0),
-	d_updated(false), d_repeat(repeat)
+	d_updated(false), d_repeat(repeat),
+	d_index_start(0)
     {
       d_fp = 0;
       d_new_fp = 0;
@@ -95,6 +96,8 @@ namespace gr {
 
       do_update();
 
+      load_index();
+
       pmt::pmt_t hdr = pmt::PMT_NIL, extras = pmt::PMT_NIL;
       if(read_header(hdr, extras)) {
 	parse_header(hdr, 0, d_tags);
@@ -275,6 +278,99 @@ namespace gr {
       }
     }
 
+    void
+    file_meta_source_impl::load_index()
+    {
+      // The footer index lives at the end of the header stream: the
+      // data file for inline headers, the .hdr file when detached.
+      FILE *fp;
+      if(d_state == STATE_DETACHED)
+	fp = d_hdr_fp;
+      else
+	fp = d_fp;
+
+      d_index.clear();
+      d_index_start = 0;
+
+      // Quietly fall back to sequential header parsing if the
+      // trailer is not there; that is just a v0 file.
+      long trailer = sizeof(uint64_t) + 2*sizeof(uint32_t);
+      if(fseek(fp, 0, SEEK_END) == -1)
+	return;
+      long filesize = ftell(fp);
+      if(filesize < trailer + (long)sizeof(meta_index_entry)) {
+	fseek(fp, 0, SEEK_SET);
+	return;
+      }
+
+      uint64_t nentries;
+      uint32_t version, magic;
+      fseek(fp, filesize - trailer, SEEK_SET);
+      bool ok = (fread(&nentries, sizeof(nentries), 1, fp) == 1)
+	&& (fread(&version, sizeof(version), 1, fp) == 1)
+	&& (fread(&magic, sizeof(magic), 1, fp) == 1);
+
+      if(!ok
+	 || magic != METADATA_INDEX_MAGIC
+	 || version != METADATA_INDEX_VERSION
+	 || nentries == 0
+	 || (uint64_t)filesize <
+	    trailer + nentries*sizeof(meta_index_entry)) {
+	fseek(fp, 0, SEEK_SET);
+	return;
+      }
+
+      d_index_start = filesize - trailer - nentries*sizeof(meta_index_entry);
+      d_index.resize(nentries);
+      fseek(fp, d_index_start, SEEK_SET);
+      if(fread(&d_index[0], sizeof(meta_index_entry), nentries, fp)
+	 != nentries) {
+	d_index.clear();
+	d_index_start = 0;
+      }
+      fseek(fp, 0, SEEK_SET);
+    }
+
+    bool
+    file_meta_source_impl::seek_timestamp(uint64_t secs, double fracs)
+    {
+      if(d_index.empty())
+	return false;
+
+      gr::thread::scoped_lock lock(d_mutex);
+
+      // Last segment starting at or before the target time.
+      double target = (double)secs + fracs;
+      size_t lo = 0, hi = d_index.size() - 1;
+      while(lo < hi) {
+	size_t mid = (lo + hi + 1)/2;
+	double t = (double)d_index[mid].time_secs + d_index[mid].time_fracs;
+	if(t <= target)
+	  lo = mid;
+	else
+	  hi = mid - 1;
+      }
+      const meta_index_entry &e = d_index[lo];
+
+      if(d_state == STATE_DETACHED) {
+	if(fseek(d_hdr_fp, (long)e.hdr_offset, SEEK_SET) == -1)
+	  return false;
+	if(fseek(d_fp, (long)e.data_offset, SEEK_SET) == -1)
+	  return false;
+      }
+      else {
+	if(fseek(d_fp, (long)e.hdr_offset, SEEK_SET) == -1)
+	  return false;
+      }
+
+      // Force the next call to work to parse the header we just
+      // seeked to, re-emitting the rx_time/rx_rate tags at the new
+      // position.
+      d_seg_size = 0;
+      d_tags.clear();
+      return true;
+    }
+
     bool
     file_meta_source_impl::open(const std::string &filename,
 				const std::string &hdr_filename)
@@ -371,7 +467,12 @@ namespace gr {
       // the new tags to send and set the next segment size.
       if(d_seg_size == 0) {
 	pmt::pmt_t hdr=pmt::PMT_NIL, extras=pmt::PMT_NIL;
-	if(read_header(hdr, extras)) {
+	// With a footer index present, the headers end where the
+	// index begins; stop there instead of parsing footer bytes.
+	FILE *hfp = (d_state == STATE_DETACHED) ? d_hdr_fp : d_fp;
+	bool have_hdr = !(d_index_start > 0 &&
+			  (uint64_t)ftell(hfp) >= d_index_start);
+	if(have_hdr && read_header(hdr, extras)) {
 	  parse_header(hdr, nitems_written(0), d_tags);
 	  parse_extras(extras, nitems_written(0), d_tags);
 	}
@@ -57,6 +57,9 @@ namespace gr {
 
       std::vector<tag_t> d_tags;
 
+      std::vector<meta_index_entry> d_index;
+      uint64_t d_index_start;
+
     protected:
       bool _open(FILE **fp, const char *filename);
       bool read_header(pmt_t &hdr, pmt_t &extras);
@@ -64,6 +67,7 @@ namespace gr {
 			std::vector<tag_t> &tags);
       void parse_extras(pmt_t extras, uint64_t offset,
 			std::vector<tag_t> &tags);
+      void load_index();
 
     public:
       file_meta_source_impl(const std::string &filename,
@@ -78,6 +82,8 @@ namespace gr {
       void close();
       void do_update();
 
+      bool seek_timestamp(uint64_t secs, double fracs);
+
       int work(int noutput_items,
 	       gr_vector_const_void_star &input_items,
 	       gr_vector_void_star &output_items);
@@ -25,30 +25,242 @@
 #endif
 
 #include "file_sink_impl.h"
+#include "chunk_compress.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/gr_complex.h>
+#include <volk/volk.h>
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
+#include <stdlib.h>
 
 namespace gr {
   namespace blocks {
 
+    // 16 chunks of 4 MB gives the writer thread 64 MB (~160 ms at
+    // 400 MB/s) of slack before anything gets dropped.
+    static const int ASYNC_NCHUNKS = 16;
+    static const size_t ASYNC_CHUNK_SIZE = 4 << 20;
+    static const size_t ASYNC_CHUNK_ALIGNMENT = 4096;
+
+    static char *
+    alloc_chunk(size_t size)
+    {
+#ifdef _WIN32
+      return new char[size];
+#else
+      void *p = 0;
+      if(posix_memalign(&p, ASYNC_CHUNK_ALIGNMENT, size) != 0)
+        throw std::runtime_error("file_sink: can't allocate staging buffer");
+      return (char*)p;
+#endif
+    }
+
+    static void
+    free_chunk(char *p)
+    {
+#ifdef _WIN32
+      delete [] p;
+#else
+      free(p);
+#endif
+    }
+
     file_sink::sptr
-    file_sink::make(size_t itemsize, const char *filename, bool append)
+    file_sink::make(size_t itemsize, const char *filename, bool append,
+                    bool async, bool compress,
+                    disk_format_t format, float scale)
     {
       return gnuradio::get_initial_sptr
-        (new file_sink_impl(itemsize, filename, append));
+        (new file_sink_impl(itemsize, filename, append, async, compress,
+                            format, scale));
     }
 
-    file_sink_impl::file_sink_impl(size_t itemsize, const char *filename, bool append)
+    file_sink_impl::file_sink_impl(size_t itemsize, const char *filename,
+                                   bool append, bool async, bool compress,
+                                   disk_format_t format, float scale)
       : sync_block("file_sink",
                       io_signature::make(1, 1, itemsize),
                       io_signature::make(0, 0, 0)),
         file_sink_base(filename, true, append),
-        d_itemsize(itemsize)
+        d_itemsize(format == FORMAT_SC16 ? itemsize/2 : itemsize),
+        d_async(async || compress),
+        d_compress(compress), d_comp_buf(0),
+        d_format(format), d_scale(scale),
+        d_conv_buf(0), d_conv_bufsize(0),
+        d_chunk_size(ASYNC_CHUNK_SIZE),
+        d_cur(-1), d_cur_nbytes(0), d_ndropped(0),
+        d_writer_exit(false)
     {
+      if(d_format == FORMAT_SC16 && itemsize % sizeof(gr_complex) != 0)
+        throw std::invalid_argument(
+          "file_sink: FORMAT_SC16 needs complex float stream items");
+
+      if(d_compress)
+        d_comp_buf = new char[chunk_compress_bound(d_chunk_size)];
+
+      if(d_async) {
+        for(int i = 0; i < ASYNC_NCHUNKS; i++) {
+          d_chunks.push_back(alloc_chunk(d_chunk_size));
+          d_free.push_back(i);
+        }
+        d_writer = boost::thread(boost::bind(&file_sink_impl::writer_loop, this));
+      }
     }
 
     file_sink_impl::~file_sink_impl()
     {
+      if(d_async) {
+        {
+          gr::thread::scoped_lock lock(d_ring_mutex);
+          push_current_chunk();
+          d_writer_exit = true;
+          d_ring_cond.notify_all();
+        }
+        d_writer.join();
+
+        for(size_t i = 0; i < d_chunks.size(); i++)
+          free_chunk(d_chunks[i]);
+      }
+      delete [] d_comp_buf;
+      volk_free(d_conv_buf);
+    }
+
+    // d_ring_mutex must be held
+    void
+    file_sink_impl::push_current_chunk()
+    {
+      if(d_cur >= 0 && d_cur_nbytes > 0) {
+        d_filled.push_back(std::make_pair(d_cur, d_cur_nbytes));
+        d_cur = -1;
+        d_cur_nbytes = 0;
+        d_ring_cond.notify_all();
+      }
+    }
+
+    bool
+    file_sink_impl::stop()
+    {
+      if(!d_async)
+        return true;
+
+      // Hand the writer whatever is buffered and wait for the drain,
+      // so the file is complete when the flowgraph finishes.
+      gr::thread::scoped_lock lock(d_ring_mutex);
+      push_current_chunk();
+      while(!d_filled.empty() && !d_writer_exit)
+        d_ring_cond.wait(lock);
+      return true;
+    }
+
+    void
+    file_sink_impl::writer_loop()
+    {
+      gr::thread::scoped_lock lock(d_ring_mutex);
+
+      while(1) {
+        while(d_filled.empty() && !d_writer_exit)
+          d_ring_cond.wait(lock);
+
+        if(d_filled.empty() && d_writer_exit)
+          return;
+
+        std::pair<int,size_t> c = d_filled.front();
+        d_filled.pop_front();
+
+        lock.unlock();		// never do disk I/O under the ring mutex
+        write_chunk(d_chunks[c.first], c.second);
+        lock.lock();
+
+        d_free.push_back(c.first);
+        d_ring_cond.notify_all();	// stop() may be waiting for the drain
+      }
+    }
+
+    // Runs only on the writer thread, which therefore owns d_fp.
+    void
+    file_sink_impl::write_chunk(const char *buf, size_t nbytes)
+    {
+      do_update();		// update d_fp is reqd
+
+      if(!d_fp)
+        return;			// drop output on the floor
+
+      if(d_compress) {
+        if(ftell(d_fp) == 0) {	// fresh file; emit the format header
+          uint32_t magic = CHUNK_COMPRESS_MAGIC;
+          uint32_t version = CHUNK_COMPRESS_VERSION;
+          write_bytes((const char*)&magic, sizeof(magic));
+          write_bytes((const char*)&version, sizeof(version));
+        }
+
+        uint32_t raw_len = (uint32_t)nbytes;
+        uint32_t comp_len =
+          (uint32_t)chunk_compress((const unsigned char*)buf, nbytes,
+                                   (unsigned char*)d_comp_buf);
+        if(comp_len == 0)
+          comp_len = raw_len;	// didn't shrink; store the chunk as is
+
+        write_bytes((const char*)&raw_len, sizeof(raw_len));
+        write_bytes((const char*)&comp_len, sizeof(comp_len));
+        write_bytes(comp_len == raw_len ? buf : d_comp_buf, comp_len);
+      }
+      else
+        write_bytes(buf, nbytes);
+
+      if(d_unbuffered)
+        fflush(d_fp);
+    }
+
+    void
+    file_sink_impl::write_bytes(const char *buf, size_t nbytes)
+    {
+      while(nbytes) {
+        size_t count = fwrite(buf, 1, nbytes, d_fp);
+        if(count == 0) {
+          if(ferror(d_fp)) {
+            fprintf(stderr, "file_sink write failed with error %d\n", fileno(d_fp));
+            clearerr(d_fp);
+          }
+          return;
+        }
+        nbytes -= count;
+        buf += count;
+      }
+    }
+
+    int
+    file_sink_impl::work_async(int noutput_items, const char *in)
+    {
+      size_t nbytes = (size_t)noutput_items * d_itemsize;
+
+      gr::thread::scoped_lock lock(d_ring_mutex);
+
+      while(nbytes) {
+        if(d_cur < 0) {
+          if(d_free.empty()) {
+            // Disk can't keep up; count the loss rather than stall
+            // the flowgraph.
+            d_ndropped += nbytes / d_itemsize;
+            break;
+          }
+          d_cur = d_free.front();
+          d_free.pop_front();
+          d_cur_nbytes = 0;
+        }
+
+        size_t n = std::min(nbytes, d_chunk_size - d_cur_nbytes);
+        memcpy(d_chunks[d_cur] + d_cur_nbytes, in, n);
+        d_cur_nbytes += n;
+        in += n;
+        nbytes -= n;
+
+        if(d_cur_nbytes == d_chunk_size)
+          push_current_chunk();
+      }
+
+      return noutput_items;
     }
 
     int
@@ -56,7 +268,28 @@ namespace gr {
                          gr_vector_const_void_star &input_items,
                          gr_vector_void_star &output_items)
     {
-      char *inbuf = (char*)input_items[0];
+      const char *inbuf = (const char*)input_items[0];
+
+      if(d_format == FORMAT_SC16) {
+        // narrow into the staging buffer; from here down only the
+        // on-disk representation exists
+        size_t nbytes = (size_t)noutput_items * d_itemsize;
+        if(nbytes > d_conv_bufsize) {
+          volk_free(d_conv_buf);
+          d_conv_buf = (char*)volk_malloc(nbytes, volk_get_alignment());
+          if(!d_conv_buf)
+            throw std::runtime_error("file_sink: can't allocate conversion buffer");
+          d_conv_bufsize = nbytes;
+        }
+        volk_32f_s32f_convert_16i((int16_t*)d_conv_buf,
+                                  (const float*)inbuf, d_scale,
+                                  (unsigned int)(nbytes / sizeof(int16_t)));
+        inbuf = d_conv_buf;
+      }
+
+      if(d_async)
+        return work_async(noutput_items, inbuf);
+
       int  nwritten = 0;
 
       do_update();                    // update d_fp is reqd
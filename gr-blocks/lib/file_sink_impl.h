@@ -24,6 +24,11 @@
 #define INCLUDED_GR_FILE_SINK_IMPL_H
 
 #include <gnuradio/blocks/file_sink.h>
+#include <gnuradio/thread/thread.h>
+#include <boost/thread/thread.hpp>
+#include <deque>
+#include <utility>
+#include <vector>
 
 namespace gr {
   namespace blocks {
@@ -31,12 +36,51 @@ namespace gr {
     class file_sink_impl : public file_sink
     {
     private:
-      size_t d_itemsize;
+      size_t d_itemsize;                        // on-disk item size
+      bool d_async;
+      bool d_compress;
+      char *d_comp_buf;                         // writer-thread scratch
+
+      // FORMAT_SC16: work narrows fc32 items into this buffer first
+      // and the disk paths below never see floats.
+      disk_format_t d_format;
+      float d_scale;
+      char *d_conv_buf;
+      size_t d_conv_bufsize;
+
+      // Async mode: work memcpys into the chunk being filled; full
+      // chunks go on d_filled and the writer thread flushes them to
+      // disk, returning them to d_free.  The ring mutex only guards
+      // the index queues, never the disk I/O.
+      std::vector<char*> d_chunks;
+      size_t d_chunk_size;                      // bytes per chunk
+      std::deque<int> d_free;                   // chunks ready for filling
+      std::deque<std::pair<int,size_t> > d_filled; // chunk index, bytes
+      int d_cur;                                // chunk being filled, -1 = none
+      size_t d_cur_nbytes;
+      volatile uint64_t d_ndropped;             // items dropped on overflow
+      bool d_writer_exit;
+      gr::thread::mutex d_ring_mutex;
+      gr::thread::condition_variable d_ring_cond;
+      boost::thread d_writer;
+
+      void writer_loop();
+      void write_chunk(const char *buf, size_t nbytes);
+      void write_bytes(const char *buf, size_t nbytes);
+      void push_current_chunk();                // d_ring_mutex must be held
+
+      int work_async(int noutput_items, const char *in);
 
     public:
-      file_sink_impl(size_t itemsize, const char *filename, bool append=false);
+      file_sink_impl(size_t itemsize, const char *filename, bool append,
+                     bool async, bool compress,
+                     disk_format_t format, float scale);
       ~file_sink_impl();
 
+      uint64_t ndropped() const { return d_ndropped; }
+
+      bool stop();
+
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
                gr_vector_void_star &output_items);
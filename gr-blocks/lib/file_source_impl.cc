@@ -26,13 +26,25 @@
 
 #include <gnuradio/thread/thread.h>
 #include "file_source_impl.h"
+#include "chunk_compress.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/gr_complex.h>
+#include <volk/volk.h>
+#include <boost/bind.hpp>
 #include <cstdio>
+#include <cstring>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <algorithm>
 #include <stdexcept>
 #include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 // win32 (mingw/msvc) specific
 #ifdef HAVE_IO_H
@@ -53,36 +65,210 @@
 namespace gr {
   namespace blocks {
 
-    file_source::sptr file_source::make(size_t itemsize, const char *filename, bool repeat)
+    // O_DIRECT wants the buffer, the offset and the length aligned to
+    // the logical block size; 4k covers everything current.
+    static const size_t DIRECT_ALIGNMENT = 4096;
+    static const size_t DIRECT_BUFSIZE = 4 << 20;
+
+    // Refuse compressed chunk headers claiming more than this; a
+    // corrupt header must not turn into a giant allocation.
+    static const size_t COMP_MAX_CHUNK = 256 << 20;
+
+    static bool
+    read_fully(FILE *fp, char *buf, size_t nbytes)
+    {
+      while(nbytes) {
+	size_t r = fread(buf, 1, nbytes, fp);
+	if(r == 0)
+	  return false;
+	buf += r;
+	nbytes -= r;
+      }
+      return true;
+    }
+
+    file_source::sptr file_source::make(size_t itemsize, const char *filename,
+                                        bool repeat, io_mode_t io_mode,
+                                        disk_format_t format, float scale)
     {
       return gnuradio::get_initial_sptr
-	(new file_source_impl(itemsize, filename, repeat));
+	(new file_source_impl(itemsize, filename, repeat, io_mode,
+			      format, scale));
     }
 
-    file_source_impl::file_source_impl(size_t itemsize, const char *filename, bool repeat)
+    file_source_impl::file_source_impl(size_t itemsize, const char *filename,
+                                       bool repeat, io_mode_t io_mode,
+                                       disk_format_t format, float scale)
       : sync_block("file_source",
 		      io_signature::make(0, 0, 0),
 		      io_signature::make(1, 1, itemsize)),
-	d_itemsize(itemsize), d_fp(0), d_new_fp(0), d_repeat(repeat),
-	d_updated(false)
+	d_itemsize(format == FORMAT_SC16 ? itemsize/2 : itemsize),
+	d_fp(0), d_new_fp(0), d_repeat(repeat),
+	d_updated(false), d_io_mode(io_mode),
+	d_raw_fd(-1), d_new_raw_fd(-1),
+	d_map_base(0), d_map_size(0), d_map_offset(0),
+	d_direct_buf(0), d_direct_bufsize(0),
+	d_direct_avail(0), d_direct_pos(0), d_direct_skip(0),
+	d_compressed(false), d_comp_buf(0), d_comp_bufsize(0),
+	d_comp_skip(0), d_comp_gen(0),
+	d_rd_slot(0), d_wr_slot(0),
+	d_prefetch_exit(false), d_prefetch_running(false),
+	d_format(format), d_scale(scale),
+	d_conv_buf(0), d_conv_bufsize(0)
     {
+      memset(d_slots, 0, sizeof(d_slots));
+
+      if(d_format == FORMAT_SC16 && itemsize % sizeof(gr_complex) != 0)
+	throw std::invalid_argument(
+	  "file_source: FORMAT_SC16 needs complex float stream items");
+#ifdef _WIN32
+      if(d_io_mode != IO_MODE_STDIO) {
+	fprintf(stderr, "file_source: io_mode not supported on this platform, using stdio\n");
+	d_io_mode = IO_MODE_STDIO;
+      }
+#else
+#ifndef O_DIRECT
+      if(d_io_mode == IO_MODE_DIRECT) {
+	fprintf(stderr, "file_source: O_DIRECT not supported on this platform, using stdio\n");
+	d_io_mode = IO_MODE_STDIO;
+      }
+#endif
+      if(d_io_mode == IO_MODE_DIRECT) {
+	void *p = 0;
+	if(posix_memalign(&p, DIRECT_ALIGNMENT, DIRECT_BUFSIZE) != 0)
+	  throw std::runtime_error("file_source: can't allocate aligned buffer");
+	d_direct_buf = (char*)p;
+	d_direct_bufsize = DIRECT_BUFSIZE;
+      }
+#endif
       open(filename, repeat);
     }
 
     file_source_impl::~file_source_impl()
     {
+      {
+	gr::thread::scoped_lock lock(d_slot_mutex);
+	d_prefetch_exit = true;
+	d_slot_cond.notify_all();
+      }
+      if(d_prefetch_running)
+	d_prefetch.join();
+      delete [] d_comp_buf;
+      delete [] d_slots[0].buf;
+      delete [] d_slots[1].buf;
+      volk_free(d_conv_buf);
+
       if(d_fp)
         fclose ((FILE*)d_fp);
       if(d_new_fp)
         fclose ((FILE*)d_new_fp);
+#ifndef _WIN32
+      unmap_file();
+      if(d_raw_fd >= 0)
+	::close(d_raw_fd);
+      if(d_new_raw_fd >= 0)
+	::close(d_new_raw_fd);
+      free(d_direct_buf);
+#endif
     }
-    
+
     bool
     file_source_impl::seek(long seek_point, int whence)
     {
-      return fseek((FILE*)d_fp, seek_point *d_itemsize, whence) == 0;
-    }
+      gr::thread::scoped_lock lock(fp_mutex);
+
+      if(d_compressed) {
+	// The chunk headers let us hop over whole chunks without
+	// inflating them; only absolute positioning is supported.
+	if(whence != SEEK_SET || seek_point < 0 || !d_fp)
+	  return false;
+
+	uint64_t target = (uint64_t)seek_point * d_itemsize;
+	if(fseek(d_fp, 2*sizeof(uint32_t), SEEK_SET) == -1)
+	  return false;
+	while(target > 0) {
+	  uint32_t raw_len, comp_len;
+	  if(fread(&raw_len, sizeof(raw_len), 1, d_fp) != 1
+	     || fread(&comp_len, sizeof(comp_len), 1, d_fp) != 1)
+	    return false;	// seek beyond EOF
+	  if(target < raw_len) {
+	    // chunk holding the target; inflate it on the next
+	    // refill and discard the difference
+	    fseek(d_fp, -2*(long)sizeof(uint32_t), SEEK_CUR);
+	    break;
+	  }
+	  if(fseek(d_fp, comp_len, SEEK_CUR) == -1)
+	    return false;
+	  target -= raw_len;
+	}
+	d_comp_skip = (size_t)target;
+
+	// void anything the prefetcher has in flight
+	gr::thread::scoped_lock slock(d_slot_mutex);
+	d_comp_gen++;
+	for(int i = 0; i < 2; i++) {
+	  d_slots[i].full = d_slots[i].eof = false;
+	  d_slots[i].pos = d_slots[i].nbytes = 0;
+	}
+	d_rd_slot = d_wr_slot = 0;
+	d_slot_cond.notify_all();
+	return true;
+      }
+
+      if(d_io_mode == IO_MODE_STDIO)
+	return fseek((FILE*)d_fp, seek_point *d_itemsize, whence) == 0;
+
+#ifndef _WIN32
+      int64_t point = (int64_t)seek_point * (int64_t)d_itemsize;
 
+      if(d_io_mode == IO_MODE_MMAP) {
+	int64_t pos;
+	switch(whence) {
+	case SEEK_SET: pos = point; break;
+	case SEEK_CUR: pos = (int64_t)d_map_offset + point; break;
+	case SEEK_END: pos = (int64_t)d_map_size + point; break;
+	default: return false;
+	}
+	if(pos < 0 || (uint64_t)pos > d_map_size)
+	  return false;
+	d_map_offset = pos;
+	return true;
+      }
+
+      // IO_MODE_DIRECT: compute the absolute target, then land on an
+      // aligned offset and discard the difference after the refill.
+      if(d_raw_fd < 0)
+	return false;
+
+      int64_t target;
+      switch(whence) {
+      case SEEK_SET:
+	target = point;
+	break;
+      case SEEK_CUR:
+	// the descriptor is ahead of us by what's left in the staging buffer
+	target = (int64_t)lseek(d_raw_fd, 0, SEEK_CUR)
+	  - (int64_t)(d_direct_avail - d_direct_pos) + point;
+	break;
+      case SEEK_END:
+	target = (int64_t)lseek(d_raw_fd, 0, SEEK_END) + point;
+	break;
+      default:
+	return false;
+      }
+      if(target < 0)
+	return false;
+
+      int64_t aligned = target & ~(int64_t)(DIRECT_ALIGNMENT - 1);
+      if(lseek(d_raw_fd, (off_t)aligned, SEEK_SET) == (off_t)-1)
+	return false;
+      d_direct_avail = d_direct_pos = 0;
+      d_direct_skip = (size_t)(target - aligned);
+      return true;
+#else
+      return false;
+#endif
+    }
 
     void
     file_source_impl::open(const char *filename, bool repeat)
@@ -91,22 +277,46 @@ namespace gr {
       gr::thread::scoped_lock lock(fp_mutex);
 
       int fd;
+      int flags = O_RDONLY | OUR_O_LARGEFILE | OUR_O_BINARY;
+
+#ifdef O_DIRECT
+      if(d_io_mode == IO_MODE_DIRECT)
+	flags |= O_DIRECT;
+#endif
 
       // we use "open" to use to the O_LARGEFILE flag
-      if((fd = ::open(filename, O_RDONLY | OUR_O_LARGEFILE | OUR_O_BINARY)) < 0) {
-	perror(filename);
-	throw std::runtime_error("can't open file");
+      if((fd = ::open(filename, flags)) < 0) {
+#ifdef O_DIRECT
+	// not every filesystem does O_DIRECT; retry buffered
+	if(d_io_mode == IO_MODE_DIRECT &&
+	   (fd = ::open(filename, flags & ~O_DIRECT)) >= 0) {
+	  fprintf(stderr, "file_source: %s: O_DIRECT not supported here, reading buffered\n",
+		  filename);
+	}
+	else
+#endif
+	{
+	  perror(filename);
+	  throw std::runtime_error("can't open file");
+	}
       }
 
-      if(d_new_fp) {
-	fclose(d_new_fp);
-	d_new_fp = 0;
-      }
+      if(d_io_mode == IO_MODE_STDIO) {
+	if(d_new_fp) {
+	  fclose(d_new_fp);
+	  d_new_fp = 0;
+	}
 
-      if((d_new_fp = fdopen (fd, "rb")) == NULL) {
-	perror(filename);
-	::close(fd);	// don't leak file descriptor if fdopen fails
-	throw std::runtime_error("can't open file");
+	if((d_new_fp = fdopen (fd, "rb")) == NULL) {
+	  perror(filename);
+	  ::close(fd);	// don't leak file descriptor if fdopen fails
+	  throw std::runtime_error("can't open file");
+	}
+      }
+      else {
+	if(d_new_raw_fd >= 0)
+	  ::close(d_new_raw_fd);
+	d_new_raw_fd = fd;
       }
 
       d_updated = true;
@@ -123,6 +333,10 @@ namespace gr {
 	fclose(d_new_fp);
 	d_new_fp = NULL;
       }
+      if(d_new_raw_fd >= 0) {
+	::close(d_new_raw_fd);
+	d_new_raw_fd = -1;
+      }
       d_updated = true;
     }
 
@@ -132,25 +346,353 @@ namespace gr {
       if(d_updated) {
 	gr::thread::scoped_lock lock(fp_mutex); // hold while in scope
 
-	if(d_fp)
-	  fclose(d_fp);
+	if(d_io_mode == IO_MODE_STDIO) {
+	  if(d_fp)
+	    fclose(d_fp);
+
+	  d_fp = d_new_fp;    // install new file pointer
+	  d_new_fp = 0;
+	  detect_compressed();
+	}
+	else {
+	  if(d_io_mode == IO_MODE_MMAP)
+	    unmap_file();
+	  if(d_raw_fd >= 0)
+	    ::close(d_raw_fd);
+
+	  d_raw_fd = d_new_raw_fd;	// install new descriptor
+	  d_new_raw_fd = -1;
+	  d_direct_avail = d_direct_pos = d_direct_skip = 0;
 
-	d_fp = d_new_fp;    // install new file pointer
-	d_new_fp = 0;
+	  if(d_io_mode == IO_MODE_MMAP && d_raw_fd >= 0) {
+	    if(!map_file(d_raw_fd) && d_map_size != 0)
+	      throw std::runtime_error("file_source: can't mmap file");
+	  }
+	}
 	d_updated = false;
       }
     }
 
+    bool
+    file_source_impl::map_file(int fd)
+    {
+#ifndef _WIN32
+      struct stat st;
+      if(fstat(fd, &st) < 0)
+	return false;
+
+      d_map_size = st.st_size;
+      d_map_offset = 0;
+      if(d_map_size == 0)	// nothing to map; treated as instant EOF
+	return false;
+
+      void *base = mmap(0, (size_t)d_map_size, PROT_READ, MAP_SHARED, fd, 0);
+      if(base == MAP_FAILED) {
+	perror("file_source: mmap");
+	return false;
+      }
+
+#ifdef MADV_SEQUENTIAL
+      madvise(base, (size_t)d_map_size, MADV_SEQUENTIAL); // aggressive readahead
+#endif
+      d_map_base = base;
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    void
+    file_source_impl::unmap_file()
+    {
+#ifndef _WIN32
+      if(d_map_base) {
+	munmap(d_map_base, (size_t)d_map_size);
+	d_map_base = 0;
+      }
+      d_map_size = 0;
+      d_map_offset = 0;
+#endif
+    }
+
+    int
+    file_source_impl::refill_direct()
+    {
+#ifndef _WIN32
+      ssize_t r = ::read(d_raw_fd, d_direct_buf, d_direct_bufsize);
+      if(r < 0) {
+	perror("file_source: read");
+	d_direct_avail = d_direct_pos = 0;
+	return -1;
+      }
+
+      d_direct_avail = (size_t)r;
+      d_direct_pos = 0;
+
+      if(d_direct_skip) {	// discard up to a seek's alignment slop
+	d_direct_pos = std::min(d_direct_skip, d_direct_avail);
+	d_direct_skip -= d_direct_pos;
+      }
+      return r > 0 ? 1 : 0;
+#else
+      return -1;
+#endif
+    }
+
+    void
+    file_source_impl::detect_compressed()
+    {
+      d_compressed = false;
+      if(d_fp) {
+	uint32_t magic = 0, version = 0;
+	if(fread(&magic, sizeof(magic), 1, d_fp) == 1
+	   && fread(&version, sizeof(version), 1, d_fp) == 1
+	   && magic == CHUNK_COMPRESS_MAGIC
+	   && version == CHUNK_COMPRESS_VERSION) {
+	  d_compressed = true;
+	}
+	else
+	  fseek(d_fp, 0, SEEK_SET);	// plain capture; rewind the probe
+      }
+
+      gr::thread::scoped_lock lock(d_slot_mutex);
+      d_comp_gen++;
+      d_comp_skip = 0;
+      for(int i = 0; i < 2; i++) {
+	d_slots[i].full = d_slots[i].eof = false;
+	d_slots[i].pos = d_slots[i].nbytes = 0;
+      }
+      d_rd_slot = d_wr_slot = 0;
+      if(d_compressed && !d_prefetch_running) {
+	d_prefetch =
+	  boost::thread(boost::bind(&file_source_impl::prefetch_loop, this));
+	d_prefetch_running = true;
+      }
+      d_slot_cond.notify_all();
+    }
+
+    void
+    file_source_impl::prefetch_loop()
+    {
+      while(1) {
+	int slot;
+	uint32_t gen;
+	{
+	  gr::thread::scoped_lock lock(d_slot_mutex);
+	  while(!d_prefetch_exit
+		&& (d_slots[d_wr_slot].full || d_slots[d_wr_slot].eof))
+	    d_slot_cond.wait(lock);
+	  if(d_prefetch_exit)
+	    return;
+	  slot = d_wr_slot;
+	  gen = d_comp_gen;
+	}
+
+	int r = read_chunk(d_slots[slot], gen);
+
+	gr::thread::scoped_lock lock(d_slot_mutex);
+	if(d_prefetch_exit)
+	  return;
+	if(gen != d_comp_gen || r < 0)
+	  continue;		// seek/reopen raced us; chunk is void
+	if(r > 0)
+	  d_slots[slot].full = true;
+	else
+	  d_slots[slot].eof = true;
+	d_wr_slot ^= 1;
+	d_slot_cond.notify_all();
+      }
+    }
+
+    int
+    file_source_impl::read_chunk(comp_slot &s, uint32_t gen)
+    {
+      gr::thread::scoped_lock lock(fp_mutex);
+
+      // d_comp_gen only changes under both mutexes, so this check
+      // can't be raced once we hold fp_mutex
+      if(gen != d_comp_gen)
+	return -1;
+      if(!d_fp)
+	return 0;
+
+      bool rewound = false;
+      while(1) {
+	uint32_t raw_len, comp_len;
+	bool short_read =
+	  fread(&raw_len, sizeof(raw_len), 1, d_fp) != 1
+	  || fread(&comp_len, sizeof(comp_len), 1, d_fp) != 1;
+
+	if(!short_read) {
+	  if(raw_len == 0 || raw_len > COMP_MAX_CHUNK
+	     || comp_len == 0 || comp_len > chunk_compress_bound(raw_len)) {
+	    fprintf(stderr, "file_source: corrupt compressed chunk header\n");
+	    return 0;
+	  }
+
+	  if(raw_len > s.bufsize) {
+	    delete [] s.buf;
+	    s.buf = new char[raw_len];
+	    s.bufsize = raw_len;
+	  }
+
+	  if(comp_len == raw_len)	// stored chunk
+	    short_read = !read_fully(d_fp, s.buf, raw_len);
+	  else {
+	    if(comp_len > d_comp_bufsize) {
+	      delete [] d_comp_buf;
+	      d_comp_buf = new char[comp_len];
+	      d_comp_bufsize = comp_len;
+	    }
+	    short_read = !read_fully(d_fp, d_comp_buf, comp_len);
+	    if(!short_read
+	       && chunk_decompress((const unsigned char*)d_comp_buf, comp_len,
+				   (unsigned char*)s.buf, raw_len)
+		  != raw_len) {
+	      fprintf(stderr, "file_source: corrupt compressed chunk\n");
+	      return 0;
+	    }
+	  }
+	}
+
+	if(short_read) {	// EOF, possibly mid-chunk on a torn tail
+	  if(!d_repeat || rewound)
+	    return 0;
+	  if(fseek(d_fp, 2*sizeof(uint32_t), SEEK_SET) == -1)
+	    return 0;
+	  rewound = true;
+	  continue;
+	}
+
+	s.nbytes = raw_len;
+	s.pos = 0;
+	if(d_comp_skip) {	// a seek landed inside this chunk
+	  s.pos = std::min(d_comp_skip, s.nbytes);
+	  d_comp_skip -= s.pos;
+	  if(s.pos == s.nbytes)
+	    continue;
+	}
+	return 1;
+      }
+    }
+
+    int
+    file_source_impl::work_compressed(int noutput_items,
+				      gr_vector_void_star &output_items)
+    {
+      char *o = (char*)output_items[0];
+      size_t bytes_wanted = (size_t)noutput_items * d_itemsize;
+      size_t bytes_out = 0;
+
+      gr::thread::scoped_lock lock(d_slot_mutex);
+      int last = d_rd_slot;
+
+      while(bytes_out < bytes_wanted) {
+	comp_slot &s = d_slots[d_rd_slot];
+
+	if(s.eof)
+	  break;
+	if(!s.full) {
+	  if(bytes_out > 0)
+	    break;		// return what we have instead of waiting
+	  while(!s.full && !s.eof && !d_prefetch_exit)
+	    d_slot_cond.wait(lock);
+	  if(!s.full)
+	    break;
+	}
+
+	size_t n = std::min(bytes_wanted - bytes_out, s.nbytes - s.pos);
+	memcpy(o + bytes_out, s.buf + s.pos, n);
+	s.pos += n;
+	bytes_out += n;
+	last = d_rd_slot;
+
+	if(s.pos == s.nbytes) {	// retire the slot to the prefetcher
+	  s.full = false;
+	  d_rd_slot ^= 1;
+	  d_slot_cond.notify_all();
+	}
+      }
+
+      // Never emit a fraction of an item; push a torn tail back into
+      // the slot it came from.  (If the tail straddled a pathologically
+      // tiny final chunk it is simply dropped with the EOF.)
+      size_t leftover = bytes_out % d_itemsize;
+      if(leftover) {
+	comp_slot &s = d_slots[last];
+	if(s.pos >= leftover && !s.eof) {
+	  if(!s.full) {		// we had just retired it; take it back
+	    s.full = true;
+	    d_rd_slot = last;
+	  }
+	  s.pos -= leftover;
+	}
+	bytes_out -= leftover;
+      }
+
+      if(bytes_out == 0)
+	return -1;		// EOF
+      return (int)(bytes_out / d_itemsize);
+    }
+
     int
     file_source_impl::work(int noutput_items,
 			   gr_vector_const_void_star &input_items,
 			   gr_vector_void_star &output_items)
+    {
+      do_update();       // update d_fp is reqd
+
+      if(d_format == FORMAT_SC16) {
+	// let the disk path fill the staging buffer with shorts,
+	// then widen into the output in one pass
+	size_t nbytes = (size_t)noutput_items * d_itemsize;
+	if(nbytes > d_conv_bufsize) {
+	  volk_free(d_conv_buf);
+	  d_conv_buf = (char*)volk_malloc(nbytes, volk_get_alignment());
+	  if(!d_conv_buf)
+	    throw std::runtime_error("file_source: can't allocate conversion buffer");
+	  d_conv_bufsize = nbytes;
+	}
+
+	gr_vector_void_star staged(1);
+	staged[0] = d_conv_buf;
+	int n = read_items(noutput_items, staged);
+	if(n > 0)
+	  volk_16i_s32f_convert_32f((float*)output_items[0],
+				    (const int16_t*)d_conv_buf, d_scale,
+				    (unsigned int)((size_t)n * d_itemsize
+						   / sizeof(int16_t)));
+	return n;
+      }
+
+      return read_items(noutput_items, output_items);
+    }
+
+    int
+    file_source_impl::read_items(int noutput_items,
+				 gr_vector_void_star &output_items)
+    {
+      if(d_compressed)
+	return work_compressed(noutput_items, output_items);
+
+      switch(d_io_mode) {
+      case IO_MODE_MMAP:
+	return work_mmap(noutput_items, output_items);
+      case IO_MODE_DIRECT:
+	return work_direct(noutput_items, output_items);
+      default:
+	return work_stdio(noutput_items, output_items);
+      }
+    }
+
+    int
+    file_source_impl::work_stdio(int noutput_items,
+				 gr_vector_void_star &output_items)
     {
       char *o = (char*)output_items[0];
       int i;
       int size = noutput_items;
 
-      do_update();       // update d_fp is reqd
       if(d_fp == NULL)
 	throw std::runtime_error("work with file not open");
 
@@ -188,5 +730,94 @@ namespace gr {
       return noutput_items;
     }
 
+    int
+    file_source_impl::work_mmap(int noutput_items,
+				gr_vector_void_star &output_items)
+    {
+#ifndef _WIN32
+      char *o = (char*)output_items[0];
+      uint64_t bytes_wanted = (uint64_t)noutput_items * d_itemsize;
+      uint64_t bytes_out = 0;
+
+      gr::thread::scoped_lock lock(fp_mutex); // hold for the rest of this function
+
+      if(!d_map_base && d_map_size != 0)
+	throw std::runtime_error("work with file not open");
+
+      while(bytes_out < bytes_wanted) {
+	uint64_t n = std::min(bytes_wanted - bytes_out,
+			      d_map_size - d_map_offset);
+	n -= n % d_itemsize;	// whole items only
+
+	if(n == 0) {		// at (or within one item of) EOF
+	  if(!d_repeat || d_map_size < d_itemsize)
+	    break;
+	  d_map_offset = 0;
+	  continue;
+	}
+
+	memcpy(o + bytes_out, (char*)d_map_base + d_map_offset, (size_t)n);
+	d_map_offset += n;
+	bytes_out += n;
+      }
+
+      if(bytes_out == 0)
+	return -1;		// EOF
+      return (int)(bytes_out / d_itemsize);
+#else
+      return -1;
+#endif
+    }
+
+    int
+    file_source_impl::work_direct(int noutput_items,
+				  gr_vector_void_star &output_items)
+    {
+#ifndef _WIN32
+      char *o = (char*)output_items[0];
+      size_t bytes_wanted = (size_t)noutput_items * d_itemsize;
+      size_t bytes_out = 0;
+
+      gr::thread::scoped_lock lock(fp_mutex); // hold for the rest of this function
+
+      if(d_raw_fd < 0)
+	throw std::runtime_error("work with file not open");
+
+      while(bytes_out < bytes_wanted) {
+	if(d_direct_pos == d_direct_avail) {
+	  int r = refill_direct();
+	  if(r < 0)
+	    break;		// read error
+	  if(r == 0) {		// EOF
+	    if(!d_repeat)
+	      break;
+	    if(lseek(d_raw_fd, 0, SEEK_SET) == (off_t)-1)
+	      break;
+	    if(refill_direct() <= 0)
+	      break;		// empty file or error
+	  }
+	}
+
+	size_t n = std::min(bytes_wanted - bytes_out,
+			    d_direct_avail - d_direct_pos);
+	memcpy(o + bytes_out, d_direct_buf + d_direct_pos, n);
+	d_direct_pos += n;
+	bytes_out += n;
+      }
+
+      // A truncated tail can leave a torn item behind; push it back
+      // so we never emit a fraction of an item.
+      size_t leftover = bytes_out % d_itemsize;
+      bytes_out -= leftover;
+      d_direct_pos -= leftover;
+
+      if(bytes_out == 0)
+	return -1;		// EOF
+      return (int)(bytes_out / d_itemsize);
+#else
+      return -1;
+#endif
+    }
+
   } /* namespace blocks */
 } /* namespace gr */
@@ -24,7 +24,9 @@
 #define INCLUDED_BLOCKS_FILE_SOURCE_IMPL_H
 
 #include <gnuradio/blocks/file_source.h>
-#include <boost/thread/mutex.hpp>
+#include <gnuradio/thread/thread.h>
+#include <boost/thread/thread.hpp>
+#include <stdint.h>
 
 namespace gr {
   namespace blocks {
@@ -32,17 +34,90 @@ namespace gr {
     class BLOCKS_API file_source_impl : public file_source
     {
     private:
-      size_t d_itemsize;
+      size_t d_itemsize;        // on-disk item size
       FILE *d_fp;
       FILE *d_new_fp;
       bool d_repeat;
       bool d_updated;
+      io_mode_t d_io_mode;
       boost::mutex fp_mutex;
-      
+
+      // Non-stdio modes keep a raw descriptor; open() parks the
+      // replacement in d_new_raw_fd until do_update installs it.
+      int d_raw_fd;
+      int d_new_raw_fd;
+
+      // IO_MODE_MMAP: the whole file is mapped read-only and work
+      // copies straight out of the mapping.
+      void     *d_map_base;
+      uint64_t  d_map_size;     // bytes
+      uint64_t  d_map_offset;   // read position, bytes
+
+      // IO_MODE_DIRECT: aligned staging buffer refilled a full,
+      // aligned chunk at a time.
+      char   *d_direct_buf;
+      size_t  d_direct_bufsize;
+      size_t  d_direct_avail;   // valid bytes in staging buffer
+      size_t  d_direct_pos;     // read position in staging buffer
+      size_t  d_direct_skip;    // bytes to discard after a seek
+
+      // Compressed captures (see chunk_compress.h), auto-detected by
+      // magic when a file is installed in stdio mode.  A prefetch
+      // thread inflates the next chunk into one slot of a ping-pong
+      // pair while work drains the other, so decompression overlaps
+      // the consumer instead of stalling it.
+      struct comp_slot {
+	char   *buf;
+	size_t  bufsize;
+	size_t  nbytes;         // valid bytes
+	size_t  pos;            // read position
+	bool    full;
+	bool    eof;
+      };
+      bool      d_compressed;
+      char     *d_comp_buf;     // compressed payload staging
+      size_t    d_comp_bufsize;
+      size_t    d_comp_skip;    // bytes to discard after a seek (fp_mutex)
+      uint32_t  d_comp_gen;     // bumped on seek/reopen to void stale chunks
+      comp_slot d_slots[2];
+      int       d_rd_slot;
+      int       d_wr_slot;
+      bool      d_prefetch_exit;
+      bool      d_prefetch_running;
+
+      // FORMAT_SC16: the disk paths above fill this buffer with
+      // shorts and work widens them into the output in one pass.
+      disk_format_t d_format;
+      float     d_scale;
+      char     *d_conv_buf;
+      size_t    d_conv_bufsize;
+      gr::thread::mutex d_slot_mutex;
+      gr::thread::condition_variable d_slot_cond;
+      boost::thread d_prefetch;
+
       void do_update();
+      bool map_file(int fd);
+      void unmap_file();
+      //! refill the staging buffer: 1 = data, 0 = EOF, -1 = error
+      int refill_direct();
+
+      //! fp_mutex must be held; checks the new d_fp for the magic
+      void detect_compressed();
+      void prefetch_loop();
+      //! inflate the next chunk: 1 = data, 0 = EOF, -1 = stale, retry
+      int read_chunk(comp_slot &s, uint32_t gen);
+
+      //! dispatch to the io-mode/compression path, in disk items
+      int read_items(int noutput_items, gr_vector_void_star &output_items);
+
+      int work_stdio(int noutput_items, gr_vector_void_star &output_items);
+      int work_mmap(int noutput_items, gr_vector_void_star &output_items);
+      int work_direct(int noutput_items, gr_vector_void_star &output_items);
+      int work_compressed(int noutput_items, gr_vector_void_star &output_items);
 
     public:
-      file_source_impl(size_t itemsize, const char *filename, bool repeat);
+      file_source_impl(size_t itemsize, const char *filename, bool repeat,
+                       io_mode_t io_mode, disk_format_t format, float scale);
       ~file_source_impl();
 
       bool seek(long seek_point, int whence);
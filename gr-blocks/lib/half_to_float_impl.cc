@@ -0,0 +1,64 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "half_to_float_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+  namespace blocks {
+
+    half_to_float::sptr half_to_float::make(size_t vlen)
+    {
+      return gnuradio::get_initial_sptr(new half_to_float_impl(vlen));
+    }
+
+    half_to_float_impl::half_to_float_impl(size_t vlen)
+      : sync_block("half_to_float",
+		      io_signature::make (1, 1, sizeof(short)*vlen),
+		      io_signature::make (1, 1, sizeof(float)*vlen)),
+	d_vlen(vlen)
+    {
+      const int alignment_multiple =
+	volk_get_alignment() / sizeof(float);
+      set_alignment(std::max(1, alignment_multiple));
+    }
+
+    int
+    half_to_float_impl::work(int noutput_items,
+			     gr_vector_const_void_star &input_items,
+			     gr_vector_void_star &output_items)
+    {
+      const uint16_t *in = (const uint16_t *) input_items[0];
+      float *out = (float *) output_items[0];
+
+      volk_16h_convert_32f(out, in, d_vlen*noutput_items);
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+}/* namespace gr */
@@ -55,10 +55,20 @@ namespace gr {
       const @I_TYPE@ *in = (const @I_TYPE@ *)input_items[0];
       @O_TYPE@ *out = (@O_TYPE@ *)output_items[0];
 
+      // Kahan-compensated summation so that long decimation windows
+      // do not lose the small samples against an already large
+      // accumulator. For the integer types the compensation is
+      // identically zero.
       for (int i = 0; i < noutput_items; i++) {
-	out[i] = (@O_TYPE@)0;
-	for (int j = 0; j < d_decim; j++)
-	  out[i] += in[i*d_decim+j];
+	@I_TYPE@ sum = 0;
+	@I_TYPE@ comp = 0;
+	for (int j = 0; j < d_decim; j++) {
+	  @I_TYPE@ y = in[i*d_decim+j] - comp;
+	  @I_TYPE@ t = sum + y;
+	  comp = (t - sum) - y;
+	  sum = t;
+	}
+	out[i] = (@O_TYPE@)sum;
       }
       
       return noutput_items;
@@ -26,10 +26,38 @@
 
 #include "interleave_impl.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <stdint.h>
 
 namespace gr {
   namespace blocks {
 
+    /*
+     * Interleave is a transpose; do it in tiles sized so the strided
+     * side stays in L1.  Each channel's items are read in a long
+     * sequential run and scattered into the tile's window of the
+     * output, instead of round-robining one memcpy per item.
+     */
+    static const size_t TILE_BYTES_PER_CHAN = 16384;
+
+    template <typename T>
+    static inline void
+    interleave_typed(T *out, const T **in, size_t nchan, size_t nitems_per_chan)
+    {
+      size_t tile = std::max((size_t)1, TILE_BYTES_PER_CHAN / (nchan * sizeof(T)));
+
+      for (size_t base = 0; base < nitems_per_chan; base += tile) {
+	size_t end = std::min(base + tile, nitems_per_chan);
+	for (unsigned int n = 0; n < nchan; n++) {
+	  const T *src = in[n] + base;
+	  T *dst = out + base * nchan + n;
+	  for (size_t i = 0; i < end - base; i++)
+	    dst[i * nchan] = src[i];
+	}
+      }
+    }
+
     interleave::sptr interleave::make(size_t itemsize)
     {
       return gnuradio::get_initial_sptr(new interleave_impl(itemsize));
@@ -58,15 +86,53 @@ namespace gr {
     {
       size_t nchan = input_items.size();
       size_t itemsize = d_itemsize;
-      const char **in = (const char **)&input_items[0];
+      size_t nitems_per_chan = noutput_items / nchan;
       char *out = (char *)output_items[0];
-      
-      for (int i = 0; i < noutput_items; i += nchan) {
-	for (unsigned int n = 0; n < nchan; n++) {
-	  memcpy (out, in[n], itemsize);
-	  out += itemsize;
-	  in[n] += itemsize;
+
+      if (nchan == 1) {
+	memcpy(out, input_items[0], noutput_items * itemsize);
+	return noutput_items;
+      }
+
+      // Two float streams into one complex stream is exactly the volk
+      // interleave kernel.
+      if (nchan == 2 && itemsize == sizeof(float)) {
+	volk_32f_x2_interleave_32fc((lv_32fc_t *)out,
+				    (const float *)input_items[0],
+				    (const float *)input_items[1],
+				    nitems_per_chan);
+	return noutput_items;
+      }
+
+      switch (itemsize) {
+      case 1:
+	interleave_typed((uint8_t *)out, (const uint8_t **)&input_items[0],
+			 nchan, nitems_per_chan);
+	break;
+      case 2:
+	interleave_typed((uint16_t *)out, (const uint16_t **)&input_items[0],
+			 nchan, nitems_per_chan);
+	break;
+      case 4:
+	interleave_typed((uint32_t *)out, (const uint32_t **)&input_items[0],
+			 nchan, nitems_per_chan);
+	break;
+      case 8:
+	interleave_typed((uint64_t *)out, (const uint64_t **)&input_items[0],
+			 nchan, nitems_per_chan);
+	break;
+      default:
+	{
+	  const char **in = (const char **)&input_items[0];
+	  for (int i = 0; i < noutput_items; i += nchan) {
+	    for (unsigned int n = 0; n < nchan; n++) {
+	      memcpy (out, in[n], itemsize);
+	      out += itemsize;
+	      in[n] += itemsize;
+	    }
+	  }
 	}
+	break;
       }
 
       return noutput_items;
@@ -0,0 +1,62 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "interleaved_half_to_complex_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+  namespace blocks {
+
+    interleaved_half_to_complex::sptr interleaved_half_to_complex::make()
+    {
+      return gnuradio::get_initial_sptr(new interleaved_half_to_complex_impl());
+    }
+
+    interleaved_half_to_complex_impl::interleaved_half_to_complex_impl()
+      : sync_decimator("interleaved_half_to_complex",
+			  io_signature::make (1, 1, sizeof(short)),
+			  io_signature::make (1, 1, sizeof(gr_complex)),
+			  2)
+    {
+    }
+
+    int
+    interleaved_half_to_complex_impl::work(int noutput_items,
+					   gr_vector_const_void_star &input_items,
+					   gr_vector_void_star &output_items)
+    {
+      const uint16_t *in = (const uint16_t *) input_items[0];
+      float *out = (float *) output_items[0];
+
+      // Each complex output item consumes two halves.
+      volk_16h_convert_32f(out, in, 2*noutput_items);
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
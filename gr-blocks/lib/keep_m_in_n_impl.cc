@@ -26,6 +26,7 @@
 
 #include "keep_m_in_n_impl.h"
 #include <gnuradio/io_signature.h>
+#include <string.h>
 
 namespace gr {
   namespace blocks {
@@ -49,8 +50,13 @@ namespace gr {
       assert(d_n > 0);
       assert(d_m <= d_n);
       assert(d_offset <= (d_n-d_m));
-      
+
       set_output_multiple(m);
+      set_relative_rate((double)d_m / (double)d_n);
+
+      // tags are remapped in bulk in general_work so a tag on a kept
+      // item lands exactly on that item downstream
+      set_tag_propagation_policy(TPP_DONT);
     }
 
     void
@@ -78,9 +84,32 @@ namespace gr {
 	// perform copy
 	memcpy( optr, iptr, d_m*d_itemsize );
       }
-      
-      consume_each(d_n);
-      return d_m;
+
+      // remap tags over the whole span: a tag on a kept item keeps its
+      // exact position, a tag on a skipped item moves to the next kept
+      // one
+      std::vector<tag_t> tags;
+      std::vector<tag_t>::iterator t;
+      get_tags_in_range(tags, 0, nitems_read(0),
+			nitems_read(0) + (uint64_t)blks*d_n);
+      for(t = tags.begin(); t != tags.end(); t++) {
+	uint64_t rel = t->offset - nitems_read(0);
+	uint64_t blk = rel / d_n;
+	long pos = (long)(rel % d_n) - d_offset;
+	if(pos < 0) {
+	  pos = 0;
+	}
+	else if(pos >= d_m) {
+	  pos = 0;
+	  blk++;
+	}
+	tag_t new_tag = *t;
+	new_tag.offset = nitems_written(0) + blk*d_m + pos;
+	add_item_tag(0, new_tag);
+      }
+
+      consume_each(blks*d_n);
+      return blks*d_m;
     }
     
   } /* namespace blocks */
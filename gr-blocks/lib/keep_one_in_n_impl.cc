@@ -26,6 +26,8 @@
 
 #include "keep_one_in_n_impl.h"
 #include <gnuradio/io_signature.h>
+#include <string.h>
+#include <stdint.h>
 
 namespace gr {
   namespace blocks {
@@ -75,29 +77,76 @@ namespace gr {
       char *out = (char *) output_items[0];
       
       size_t item_size = input_signature ()->sizeof_stream_item (0);
+      int	    navail = ninput_items[0];
       int	    ni = 0;
       int	    no = 0;
 
-      while (ni < ninput_items[0] && no < noutput_items){
-	d_count--;
-	if (d_count <= 0){
-	  memcpy (out, in, item_size);		// copy 1 item
-	  out += item_size;
-	  no++;
-	  d_count = d_n;
+      // index of the first kept item in this call's input, from the
+      // countdown phase carried across calls
+      long first = (long)d_count - 1;
+
+      if (first < navail) {
+	no = std::min((long)noutput_items, (navail - 1 - first)/d_n + 1);
+
+	// strided gather of single items; typed loops for the common
+	// item sizes so the compiler can vectorize, memcpy runs for
+	// the rest
+	const char *ip = in + first*item_size;
+	switch (item_size) {
+	case 1: {
+	  const uint8_t *s = (const uint8_t*)ip;
+	  uint8_t *d = (uint8_t*)out;
+	  for (int i = 0; i < no; i++)
+	    d[i] = s[(long)i*d_n];
+	  break;
+	}
+	case 2: {
+	  const uint16_t *s = (const uint16_t*)ip;
+	  uint16_t *d = (uint16_t*)out;
+	  for (int i = 0; i < no; i++)
+	    d[i] = s[(long)i*d_n];
+	  break;
+	}
+	case 4: {
+	  const uint32_t *s = (const uint32_t*)ip;
+	  uint32_t *d = (uint32_t*)out;
+	  for (int i = 0; i < no; i++)
+	    d[i] = s[(long)i*d_n];
+	  break;
+	}
+	case 8: {
+	  const uint64_t *s = (const uint64_t*)ip;
+	  uint64_t *d = (uint64_t*)out;
+	  for (int i = 0; i < no; i++)
+	    d[i] = s[(long)i*d_n];
+	  break;
+	}
+	default:
+	  for (int i = 0; i < no; i++)
+	    memcpy (out + (size_t)i*item_size,
+		    ip + (size_t)i*d_n*item_size, item_size);
+	  break;
 	}
-	in += item_size;
-	ni++;
       }
 
-      // Because we have set TPP_DONT, we have to propagate the tags here manually.
-      // Adjustment of the tag sample value is done using the float d_decim_rate.
+      // When output space limited us, stop right after the last kept
+      // item; otherwise eat the trailing skipped items too.  Either
+      // way d_count carries the distance to the next kept item.
+      if (no == noutput_items && no > 0)
+	ni = first + (long)(no - 1)*d_n + 1;
+      else
+	ni = navail;
+      d_count = (int)(first + (long)no*d_n - ni + 1);
+
+      // Because we have set TPP_DONT, we have to propagate the tags here
+      // manually; the integer division keeps large offsets exact where
+      // the old float scale did not.
       std::vector<tag_t> tags;
       std::vector<tag_t>::iterator t;
       get_tags_in_range(tags, 0, nitems_read(0), nitems_read(0)+ni);
       for(t = tags.begin(); t != tags.end(); t++) {
 	tag_t new_tag = *t;
-	new_tag.offset *= d_decim_rate;
+	new_tag.offset /= (uint64_t)d_n;
 	add_item_tag(0, new_tag);
       }
 
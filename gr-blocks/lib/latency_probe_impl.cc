@@ -0,0 +1,209 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "latency_probe_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/high_res_timer.h>
+#include <cmath>
+
+namespace gr {
+  namespace blocks {
+
+    latency_probe::sptr
+    latency_probe::make(size_t itemsize, const std::string &key)
+    {
+      return gnuradio::get_initial_sptr
+        (new latency_probe_impl(itemsize, key));
+    }
+
+    latency_probe_impl::latency_probe_impl(size_t itemsize,
+                                           const std::string &key)
+      : sync_block("latency_probe",
+                   io_signature::make(1, 1, itemsize),
+                   io_signature::make(0, 0, 0)),
+        d_key(pmt::string_to_symbol(key)),
+        d_count(0), d_mean(0), d_m2(0), d_min(0), d_max(0)
+    {
+    }
+
+    latency_probe_impl::~latency_probe_impl()
+    {
+    }
+
+    int
+    latency_probe_impl::num_measurements()
+    {
+      gr::thread::pi_scoped_lock l(d_mutex);
+      return static_cast<int>(d_count);
+    }
+
+    double
+    latency_probe_impl::latency_avg()
+    {
+      gr::thread::pi_scoped_lock l(d_mutex);
+      return d_mean;
+    }
+
+    double
+    latency_probe_impl::latency_stddev()
+    {
+      gr::thread::pi_scoped_lock l(d_mutex);
+      if(d_count < 2)
+        return 0;
+      return ::sqrt(d_m2 / (d_count - 1));
+    }
+
+    double
+    latency_probe_impl::latency_min()
+    {
+      gr::thread::pi_scoped_lock l(d_mutex);
+      return d_min;
+    }
+
+    double
+    latency_probe_impl::latency_max()
+    {
+      gr::thread::pi_scoped_lock l(d_mutex);
+      return d_max;
+    }
+
+    void
+    latency_probe_impl::reset()
+    {
+      gr::thread::pi_scoped_lock l(d_mutex);
+      d_count = 0;
+      d_mean = 0;
+      d_m2 = 0;
+      d_min = 0;
+      d_max = 0;
+      publish_snapshots();
+    }
+
+    // Call with d_mutex held.
+    void
+    latency_probe_impl::publish_snapshots()
+    {
+#ifdef GR_CTRLPORT
+      if(!d_rpc_avg)
+        return;
+      d_rpc_avg->publish(d_mean);
+      d_rpc_stddev->publish(d_count < 2 ? 0 : ::sqrt(d_m2 / (d_count - 1)));
+      d_rpc_min->publish(d_min);
+      d_rpc_max->publish(d_max);
+      d_rpc_count->publish(static_cast<int>(d_count));
+#endif
+    }
+
+    int
+    latency_probe_impl::work(int noutput_items,
+                             gr_vector_const_void_star &input_items,
+                             gr_vector_void_star &output_items)
+    {
+      uint64_t abs_start = nitems_read(0);
+      uint64_t abs_end = abs_start + noutput_items;
+
+      d_tags.clear();
+      get_tags_in_range(d_tags, 0, abs_start, abs_end, d_key);
+      if(d_tags.empty())
+        return noutput_items;
+
+      gr::high_res_timer_type now = gr::high_res_timer_now();
+      double tps = (double)gr::high_res_timer_tps();
+
+      gr::thread::pi_scoped_lock l(d_mutex);
+      for(size_t i = 0; i < d_tags.size(); i++) {
+        if(!pmt::is_uint64(d_tags[i].value))
+          continue;
+
+        gr::high_res_timer_type stamped =
+          (gr::high_res_timer_type)pmt::to_uint64(d_tags[i].value);
+        double latency = (now - stamped) / tps;
+
+        d_count++;
+        if(d_count == 1) {
+          d_mean = latency;
+          d_min = latency;
+          d_max = latency;
+        }
+        else {
+          double delta = latency - d_mean;
+          d_mean += delta / d_count;
+          d_m2 += delta * (latency - d_mean);
+          if(latency < d_min) d_min = latency;
+          if(latency > d_max) d_max = latency;
+        }
+      }
+      publish_snapshots();
+
+      return noutput_items;
+    }
+
+    void
+    latency_probe_impl::setup_rpc()
+    {
+#ifdef GR_CTRLPORT
+      // snapshot exports: the work thread publishes, pollers read the
+      // slots without touching this block
+      d_rpc_avg.reset(
+        new rpcbasic_register_snapshot<double>(
+          alias(), "avg",
+          pmt::mp(0), pmt::mp(1), pmt::mp(0),
+          "s", "Mean latency",
+          RPC_PRIVLVL_MIN, DISPTIME | DISPOPTSTRIP));
+      add_rpc_variable(d_rpc_avg);
+      d_rpc_stddev.reset(
+        new rpcbasic_register_snapshot<double>(
+          alias(), "stddev",
+          pmt::mp(0), pmt::mp(1), pmt::mp(0),
+          "s", "Latency standard deviation",
+          RPC_PRIVLVL_MIN, DISPTIME | DISPOPTSTRIP));
+      add_rpc_variable(d_rpc_stddev);
+      d_rpc_min.reset(
+        new rpcbasic_register_snapshot<double>(
+          alias(), "min",
+          pmt::mp(0), pmt::mp(1), pmt::mp(0),
+          "s", "Smallest latency",
+          RPC_PRIVLVL_MIN, DISPTIME | DISPOPTSTRIP));
+      add_rpc_variable(d_rpc_min);
+      d_rpc_max.reset(
+        new rpcbasic_register_snapshot<double>(
+          alias(), "max",
+          pmt::mp(0), pmt::mp(1), pmt::mp(0),
+          "s", "Largest latency",
+          RPC_PRIVLVL_MIN, DISPTIME | DISPOPTSTRIP));
+      add_rpc_variable(d_rpc_max);
+      d_rpc_count.reset(
+        new rpcbasic_register_snapshot<int>(
+          alias(), "count",
+          pmt::mp(0), pmt::mp(65536), pmt::mp(0),
+          "", "Number of measurements",
+          RPC_PRIVLVL_MIN, DISPTIME | DISPOPTSTRIP));
+      add_rpc_variable(d_rpc_count);
+#endif /* GR_CTRLPORT */
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,80 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_LATENCY_PROBE_IMPL_H
+#define INCLUDED_GR_BLOCKS_LATENCY_PROBE_IMPL_H
+
+#include <gnuradio/blocks/latency_probe.h>
+#include <gnuradio/thread/thread.h>
+#ifdef GR_CTRLPORT
+#include <gnuradio/rpcregisterhelpers.h>
+#endif
+
+namespace gr {
+  namespace blocks {
+
+    class latency_probe_impl : public latency_probe
+    {
+    private:
+      pmt::pmt_t d_key;
+      std::vector<tag_t> d_tags;
+
+      // protects the statistics; priority inheritance so a getter
+      // holding it cannot invert priorities with a realtime work thread
+      gr::thread::pi_mutex d_mutex;
+      uint64_t d_count;
+      double d_mean;
+      double d_m2;                 // sum of squared deviations (Welford)
+      double d_min;
+      double d_max;
+
+#ifdef GR_CTRLPORT
+      // snapshot slots; ControlPort polls read these without taking
+      // d_mutex (see gr::rpc_snapshot)
+      boost::shared_ptr<rpcbasic_register_snapshot<double> >
+        d_rpc_avg, d_rpc_stddev, d_rpc_min, d_rpc_max;
+      boost::shared_ptr<rpcbasic_register_snapshot<int> > d_rpc_count;
+#endif
+      void publish_snapshots();
+
+    public:
+      latency_probe_impl(size_t itemsize, const std::string &key);
+      ~latency_probe_impl();
+
+      int num_measurements();
+      double latency_avg();
+      double latency_stddev();
+      double latency_min();
+      double latency_max();
+      void reset();
+
+      void setup_rpc();
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_LATENCY_PROBE_IMPL_H */
@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "latency_tagger_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/high_res_timer.h>
+#include <string.h>
+
+namespace gr {
+  namespace blocks {
+
+    latency_tagger::sptr
+    latency_tagger::make(size_t itemsize, int interval,
+                         const std::string &key)
+    {
+      return gnuradio::get_initial_sptr
+        (new latency_tagger_impl(itemsize, interval, key));
+    }
+
+    latency_tagger_impl::latency_tagger_impl(size_t itemsize, int interval,
+                                             const std::string &key)
+      : sync_block("latency_tagger",
+                   io_signature::make(1, 1, itemsize),
+                   io_signature::make(1, 1, itemsize)),
+        d_itemsize(itemsize),
+        d_interval((interval < 1) ? 1 : interval),
+        d_next_stamp(0),
+        d_key(pmt::string_to_symbol(key)),
+        d_srcid(pmt::string_to_symbol(name()))
+    {
+    }
+
+    latency_tagger_impl::~latency_tagger_impl()
+    {
+    }
+
+    int
+    latency_tagger_impl::work(int noutput_items,
+                              gr_vector_const_void_star &input_items,
+                              gr_vector_void_star &output_items)
+    {
+      const char *in = (const char*)input_items[0];
+      char *out = (char*)output_items[0];
+
+      memcpy(out, in, noutput_items * d_itemsize);
+
+      uint64_t end = nitems_written(0) + noutput_items;
+      while(d_next_stamp < end) {
+        add_item_tag(0, d_next_stamp, d_key,
+                     pmt::from_uint64((uint64_t)gr::high_res_timer_now()),
+                     d_srcid);
+        d_next_stamp += d_interval;
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
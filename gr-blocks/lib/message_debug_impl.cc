@@ -26,12 +26,28 @@
 
 #include "message_debug_impl.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/high_res_timer.h>
 #include <cstdio>
 #include <iostream>
 
 namespace gr {
   namespace blocks {
-    
+
+    // depth of each print ring; overflowing entries are dropped
+    // oldest-first and summarized
+    static const size_t s_queue_depth = 256;
+
+    // handlers run concurrently from every upstream thread
+    static inline void
+    atomic_incr(volatile long *p)
+    {
+#if defined(__GNUC__)
+      __sync_fetch_and_add(p, 1);
+#else
+      (*p)++;	// best effort
+#endif
+    }
+
     message_debug::sptr
     message_debug::make()
     {
@@ -41,6 +57,15 @@ namespace gr {
 
     void
     message_debug_impl::print(pmt::pmt_t msg)
+    {
+      atomic_incr(&d_msg_count);
+      if(d_count_only)
+        return;
+      d_print_queue.insert_tail(msg);
+    }
+
+    void
+    message_debug_impl::do_print(pmt::pmt_t msg)
     {
       std::cout << "******* MESSAGE DEBUG PRINT ********\n";
       pmt::print(msg);
@@ -56,6 +81,15 @@ namespace gr {
 
     void
     message_debug_impl::print_pdu(pmt::pmt_t pdu)
+    {
+      atomic_incr(&d_msg_count);
+      if(d_count_only)
+        return;
+      d_pdu_queue.insert_tail(pdu);
+    }
+
+    void
+    message_debug_impl::do_print_pdu(pmt::pmt_t pdu)
     {
       pmt::pmt_t meta = pmt::car(pdu);
       pmt::pmt_t vector = pmt::cdr(pdu);
@@ -96,10 +130,96 @@ namespace gr {
       return d_messages[i];
     }
 
+    void
+    message_debug_impl::set_count_only(bool enable)
+    {
+      d_count_only = enable;
+    }
+
+    long
+    message_debug_impl::message_count()
+    {
+      return d_msg_count;
+    }
+
+    void
+    message_debug_impl::set_print_limit(int limit)
+    {
+      d_print_limit = limit;
+    }
+
+    void
+    message_debug_impl::run_print_thread()
+    {
+      high_res_timer_type window_start = high_res_timer_now();
+      const high_res_timer_type window_len = high_res_timer_tps();
+      size_t last_dropped = 0;
+      int nprinted = 0;
+
+      try {
+      while(!d_finished) {
+        // once a second: summarize drops and reset the print budget
+        if(high_res_timer_now() - window_start >= window_len) {
+          window_start = high_res_timer_now();
+          nprinted = 0;
+
+          size_t dropped = d_print_queue.ndropped() + d_pdu_queue.ndropped();
+          if(dropped != last_dropped) {
+            std::cout << "message_debug: dropped "
+                      << (dropped - last_dropped) << " messages\n";
+            last_dropped = dropped;
+          }
+        }
+
+        // over budget: leave entries queued and let the rings drop
+        // the oldest when the producers outrun us
+        if(d_print_limit > 0 && nprinted >= d_print_limit) {
+          boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+          continue;
+        }
+
+        bool idle = true;
+
+        pmt::pmt_t m = d_print_queue.delete_head_nowait();
+        if(m) {
+          do_print(m);
+          nprinted++;
+          idle = false;
+        }
+
+        m = d_pdu_queue.delete_head_nowait();
+        if(m) {
+          do_print_pdu(m);
+          nprinted++;
+          idle = false;
+        }
+
+        if(idle)
+          boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+      }
+      }
+      catch(boost::thread_interrupted&) {
+        // asked to shut down while sleeping; fall through to the flush
+      }
+
+      // flush whatever is still queued on the way out
+      pmt::pmt_t m;
+      while((m = d_print_queue.delete_head_nowait()))
+        do_print(m);
+      while((m = d_pdu_queue.delete_head_nowait()))
+        do_print_pdu(m);
+    }
+
     message_debug_impl::message_debug_impl()
       : block("message_debug",
                  io_signature::make(0, 0, 0),
-                 io_signature::make(0, 0, 0))
+                 io_signature::make(0, 0, 0)),
+        d_print_queue(s_queue_depth, gr::mpsc_queue::DROP_OLDEST),
+        d_pdu_queue(s_queue_depth, gr::mpsc_queue::DROP_OLDEST),
+        d_finished(false),
+        d_count_only(false),
+        d_print_limit(0),
+        d_msg_count(0)
     {
       message_port_register_in(pmt::mp("print"));
       set_msg_handler(pmt::mp("print"), boost::bind(&message_debug_impl::print, this, _1));
@@ -109,10 +229,15 @@ namespace gr {
 
       message_port_register_in(pmt::mp("print_pdu"));
       set_msg_handler(pmt::mp("print_pdu"), boost::bind(&message_debug_impl::print_pdu, this, _1));
+
+      d_thread = gr::thread::thread(boost::bind(&message_debug_impl::run_print_thread, this));
     }
 
     message_debug_impl::~message_debug_impl()
     {
+      d_finished = true;
+      d_thread.interrupt();
+      d_thread.join();
     }
 
   } /* namespace blocks */
@@ -25,6 +25,7 @@
 
 #include <gnuradio/blocks/message_debug.h>
 #include <gnuradio/block.h>
+#include <gnuradio/mpsc_queue.h>
 #include <gnuradio/thread/thread.h>
 #include <pmt/pmt.h>
 
@@ -39,7 +40,8 @@ namespace gr {
        * \brief Messages received in this port are printed to stdout.
        *
        * This port receives messages from the scheduler's message
-       * handling mechanism and prints it to stdout. This message
+       * handling mechanism and queues them for the printer thread;
+       * the handler itself never touches the console. This message
        * handler function is only meant to be used by the scheduler to
        * handle messages posted to port 'print'.
        *
@@ -51,7 +53,8 @@ namespace gr {
        * \brief PDU formatted messages received in this port are printed to stdout.
        *
        * This port receives messages from the scheduler's message
-       * handling mechanism and prints it to stdout. This message
+       * handling mechanism and queues them for the printer thread;
+       * the handler itself never touches the console. This message
        * handler function is only meant to be used by the scheduler to
        * handle messages posted to port 'print'.
        *
@@ -75,12 +78,38 @@ namespace gr {
       gr::thread::mutex d_mutex;
       std::vector<pmt::pmt_t> d_messages;
 
+      // The print and print_pdu handlers push the raw pmts into
+      // these bounded lock-free rings; the printer thread formats
+      // and writes them, so posting a message never blocks on
+      // console I/O.
+      gr::mpsc_queue d_print_queue;
+      gr::mpsc_queue d_pdu_queue;
+      gr::thread::thread d_thread;
+      bool d_finished;
+      volatile bool d_count_only;
+      volatile int d_print_limit;
+      volatile long d_msg_count;
+
+      //! Printer thread body: drain the rings, honoring the
+      //! per-second print limit and summarizing drops.
+      void run_print_thread();
+
+      //! Format \p msg to stdout.  Printer thread only.
+      void do_print(pmt::pmt_t msg);
+
+      //! Format the PDU \p pdu to stdout.  Printer thread only.
+      void do_print_pdu(pmt::pmt_t pdu);
+
     public:
       message_debug_impl();
       ~message_debug_impl();
 
       int num_messages();
       pmt::pmt_t get_message(int i);
+
+      void set_count_only(bool enable);
+      long message_count();
+      void set_print_limit(int limit);
     };
 
   } /* namespace blocks */
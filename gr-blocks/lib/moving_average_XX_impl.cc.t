@@ -95,16 +95,32 @@ namespace gr {
       const @I_TYPE@ *in = (const @I_TYPE@ *)input_items[0];
       @O_TYPE@ *out = (@O_TYPE@ *)output_items[0];
 
+      // Kahan-compensated running sum. The accumulator is reseeded
+      // exactly from history at the top of every call and num_iter is
+      // capped at d_max_iter, so the compensation term only has to
+      // soak up the low-order bits lost within one bounded run. For
+      // the integer types the compensation is identically zero.
       @I_TYPE@ sum = 0;
+      @I_TYPE@ comp = 0;
+      @I_TYPE@ y, t;
       int num_iter = (noutput_items>d_max_iter) ? d_max_iter : noutput_items;
       for(int i = 0; i < d_length-1; i++) {
-        sum += in[i];
+        y = in[i] - comp;
+        t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
       }
 
       for(int i = 0; i < num_iter; i++) {
-        sum += in[i+d_length-1];
+        y = in[i+d_length-1] - comp;
+        t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
         out[i] = sum * d_scale;
-        sum -= in[i];
+        y = -in[i] - comp;
+        t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
       }
 
       return num_iter;
@@ -45,6 +45,10 @@ namespace gr {
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(gr_complex);
       set_alignment(std::max(1, alignment_multiple));
+
+      //resolve the concrete impls once; work() then skips the dispatcher
+      d_volk_mult_conj_a = volk_32fc_x2_multiply_conjugate_32fc_get_impl(true);
+      d_volk_mult_conj_u = volk_32fc_x2_multiply_conjugate_32fc_get_impl(false);
     }
 
     int
@@ -57,7 +61,10 @@ namespace gr {
       gr_complex *out = (gr_complex *) output_items[0];
       int noi = d_vlen*noutput_items;
       
-      volk_32fc_x2_multiply_conjugate_32fc(out, in0, in1, noi);
+      if(volk_is_aligned(VOLK_OR_PTR(out, VOLK_OR_PTR(in0, in1))))
+        d_volk_mult_conj_a(out, in0, in1, noi);
+      else
+        d_volk_mult_conj_u(out, in0, in1, noi);
       
       return noutput_items;
     }
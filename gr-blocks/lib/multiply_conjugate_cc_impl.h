@@ -24,6 +24,7 @@
 #define INCLUDED_BLOCKS_MULTIPLY_CONJUGATE_CC_IMPL_H
 
 #include <gnuradio/blocks/multiply_conjugate_cc.h>
+#include <volk/volk_typedefs.h>
 
 namespace gr {
   namespace blocks {
@@ -31,6 +32,8 @@ namespace gr {
     class BLOCKS_API multiply_conjugate_cc_impl : public multiply_conjugate_cc
     {
       size_t d_vlen;
+      p_32fc_x2_multiply_conjugate_32fc d_volk_mult_conj_a;
+      p_32fc_x2_multiply_conjugate_32fc d_volk_mult_conj_u;
 
     public:
       multiply_conjugate_cc_impl(size_t vlen);
@@ -47,6 +47,10 @@ namespace gr {
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(gr_complex);
       set_alignment(std::max(1,alignment_multiple));
+
+      //resolve the concrete impls once; work() then skips the dispatcher
+      d_volk_mult_const_a = volk_32fc_s32fc_multiply_32fc_get_impl(true);
+      d_volk_mult_const_u = volk_32fc_s32fc_multiply_32fc_get_impl(false);
     }
 
     int
@@ -58,7 +62,10 @@ namespace gr {
       gr_complex *out = (gr_complex *) output_items[0];
       int noi = d_vlen*noutput_items;
 
-      volk_32fc_s32fc_multiply_32fc(out, in, d_k, noi);
+      if(volk_is_aligned(VOLK_OR_PTR(out, in)))
+        d_volk_mult_const_a(out, in, d_k, noi);
+      else
+        d_volk_mult_const_u(out, in, d_k, noi);
 
       return noutput_items;
     }
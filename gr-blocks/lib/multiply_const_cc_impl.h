@@ -26,6 +26,7 @@
 #define INCLUDED_MULTIPLY_CONST_CC_IMPL_H
 
 #include <gnuradio/blocks/multiply_const_cc.h>
+#include <volk/volk_typedefs.h>
 
 namespace gr {
   namespace blocks {
@@ -34,6 +35,8 @@ namespace gr {
     {
       gr_complex d_k;
       size_t d_vlen;
+      p_32fc_s32fc_multiply_32fc d_volk_mult_const_a;
+      p_32fc_s32fc_multiply_32fc d_volk_mult_const_u;
 
     public:
       multiply_const_cc_impl(gr_complex k, size_t vlen);
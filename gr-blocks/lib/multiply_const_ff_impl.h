@@ -26,6 +26,7 @@
 #define INCLUDED_MULTIPLY_CONST_FF_IMPL_H
 
 #include <gnuradio/blocks/multiply_const_ff.h>
+#include <volk/volk_typedefs.h>
 
 namespace gr {
   namespace blocks {
@@ -34,6 +35,8 @@ namespace gr {
     {
       float d_k;
       size_t d_vlen;
+      p_32f_s32f_multiply_32f d_volk_mult_const_a;
+      p_32f_s32f_multiply_32f d_volk_mult_const_u;
 
     public:
       multiply_const_ff_impl(float k, size_t vlen);
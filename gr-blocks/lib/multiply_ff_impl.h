@@ -24,6 +24,7 @@
 #define INCLUDED_BLOCKS_MULTIPLY_FF_IMPL_H
 
 #include <gnuradio/blocks/multiply_ff.h>
+#include <volk/volk_typedefs.h>
 
 namespace gr {
   namespace blocks {
@@ -31,6 +32,8 @@ namespace gr {
     class BLOCKS_API multiply_ff_impl : public multiply_ff
     {
       size_t d_vlen;
+      p_32f_x2_multiply_32f d_volk_mult_a;
+      p_32f_x2_multiply_32f d_volk_mult_u;
 
     public:
       multiply_ff_impl(size_t vlen);
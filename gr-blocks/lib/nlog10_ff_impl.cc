@@ -25,6 +25,7 @@
 #endif
 
 #include "nlog10_ff_impl.h"
+#include "fast_math.h"
 #include <gnuradio/io_signature.h>
 
 namespace gr {
@@ -39,7 +40,7 @@ namespace gr {
       : sync_block("nlog10_ff",
 		      io_signature::make (1, 1, sizeof(float)*vlen),
 		      io_signature::make (1, 1, sizeof(float)*vlen)),
-	d_n(n), d_vlen(vlen), d_k(k)
+	d_n(n), d_vlen(vlen), d_k(k), d_approx(false)
     {
     }
 
@@ -54,8 +55,15 @@ namespace gr {
       float n = d_n;
       float k = d_k;
 
-      for (int i = 0; i < noi; i++)
-	out[i] = n * log10(std::max(in[i], (float) 1e-18)) + k;
+      if (d_approx) {
+	// cubic on the mantissa; ~0.0005*n absolute error (see fast_math.h)
+	for (int i = 0; i < noi; i++)
+	  out[i] = n * fast_log10(std::max(in[i], (float) 1e-18)) + k;
+      }
+      else {
+	for (int i = 0; i < noi; i++)
+	  out[i] = n * log10(std::max(in[i], (float) 1e-18)) + k;
+      }
 
       return noutput_items;
     }
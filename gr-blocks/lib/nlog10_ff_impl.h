@@ -33,10 +33,14 @@ namespace gr {
       float  d_n;
       size_t d_vlen;
       float  d_k;
+      bool   d_approx;
 
     public:
       nlog10_ff_impl(float n, size_t vlen, float k);
 
+      void set_approx_mode(bool enable) { d_approx = enable; }
+      bool approx_mode() const { return d_approx; }
+
       int work(int noutput_items,
 	       gr_vector_const_void_star &input_items,
 	       gr_vector_void_star &output_items);
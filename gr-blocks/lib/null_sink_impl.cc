@@ -25,7 +25,10 @@
 #endif
 
 #include "null_sink_impl.h"
+#include <gnuradio/block_detail.h>
+#include <gnuradio/buffer.h>
 #include <gnuradio/io_signature.h>
+#include <algorithm>
 
 namespace gr {
   namespace blocks {
@@ -48,6 +51,28 @@ namespace gr {
     {
     }
 
+    bool
+    null_sink_impl::start()
+    {
+      // Ask the scheduler for quarter-buffer batches so per-call
+      // overhead doesn't dominate when we terminate a benchmark
+      // graph.  Explicit-wrap buffers are excluded: they rely on
+      // every attached block making progress one item at a time
+      // near the seam.
+      int min_items = 0;
+      for(int i = 0; i < detail()->ninputs(); i++) {
+        buffer_sptr buf = detail()->input(i)->buffer();
+        if(buf->explicit_wrap())
+          min_items = -1;
+        else if(min_items >= 0)
+          min_items = (min_items == 0) ? buf->bufsize() / 4
+            : std::min(min_items, buf->bufsize() / 4);
+      }
+      if(min_noutput_items() == 0 && min_items > 1)
+        set_min_noutput_items(min_items);
+      return true;
+    }
+
     int
     null_sink_impl::work(int noutput_items,
                          gr_vector_const_void_star &input_items,
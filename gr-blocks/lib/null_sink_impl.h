@@ -34,6 +34,8 @@ namespace gr {
       null_sink_impl(size_t sizeof_stream_item);
       ~null_sink_impl();
 
+      bool start();
+
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
                gr_vector_void_star &output_items);
@@ -26,8 +26,11 @@
 
 #include "pack_k_bits_bb_impl.h"
 #include <gnuradio/io_signature.h>
+#include <boost/detail/endian.hpp>
 #include <stdexcept>
 #include <iostream>
+#include <stdint.h>
+#include <string.h>
 
 namespace gr {
   namespace blocks {
@@ -62,7 +65,28 @@ namespace gr {
       const unsigned char *in = (const unsigned char *)input_items[0];
       unsigned char *out = (unsigned char *)output_items[0];
 
-      for(int i = 0; i < noutput_items; i++) {
+      // Multiply-gather: with unpacked bits sitting in the low bit of
+      // eight consecutive bytes, one multiply by a magic constant
+      // lines them up MSB-first in the top byte of the product. For
+      // k < 8 the surplus bits fall off the final shift.
+#ifdef BOOST_BIG_ENDIAN
+      static const uint64_t gather = 0x0102040810204080ULL;
+#else
+      static const uint64_t gather = 0x8040201008040201ULL;
+#endif
+
+      int i = 0;
+      if(d_k <= 8) {
+        const int nin = noutput_items*d_k;
+        for(; i < noutput_items && (int)(i*d_k) + 8 <= nin; i++) {
+          uint64_t w;
+          memcpy(&w, &in[i*d_k], 8);
+          w &= 0x0101010101010101ULL;
+          out[i] = (unsigned char)(((w*gather) >> 56) >> (8-d_k));
+        }
+      }
+
+      for(; i < noutput_items; i++) {
         out[i] = 0x00;
         for(unsigned int j = 0; j < d_k; j++) {
           out[i] |= (0x01 & in[i*d_k+j])<<(d_k-j-1);
@@ -25,6 +25,9 @@
 #endif
 
 #include <gnuradio/blocks/pdu.h>
+#include <gnuradio/thread/thread.h>
+#include <string.h>
+#include <vector>
 
 namespace gr {
   namespace blocks {
@@ -75,6 +78,45 @@ namespace gr {
 	}
       }
 
+      // Recycling pool for PDU payload vectors. The pool keeps its
+      // own reference to every vector it hands out; once all
+      // downstream consumers have dropped theirs (use count back to
+      // one) the vector can be refilled in place instead of paying a
+      // fresh allocation per packet.
+      static const size_t s_pool_max = 64;
+      static gr::thread::mutex s_pool_mutex;
+      static std::vector<pmt::pmt_t> s_pool;
+      static size_t s_pool_next = 0;
+
+      pmt::pmt_t
+      make_pdu_vector_pooled(vector_type type, const uint8_t *buf, size_t items)
+      {
+	gr::thread::scoped_lock guard(s_pool_mutex);
+
+	for(size_t i = 0; i < s_pool.size(); i++) {
+	  if(pmt::is_unique(s_pool[i])
+	     && pmt::length(s_pool[i]) == items
+	     && type_matches(type, s_pool[i])) {
+	    size_t len;
+	    memcpy(pmt::uniform_vector_writable_elements(s_pool[i], len),
+		   buf, items*itemsize(type));
+	    return s_pool[i];
+	  }
+	}
+
+	pmt::pmt_t v = make_pdu_vector(type, buf, items);
+	if(s_pool.size() < s_pool_max) {
+	  s_pool.push_back(v);
+	}
+	else {
+	  // round-robin eviction; an in-flight vector just loses the
+	  // pool's reference and is freed by its last consumer
+	  s_pool[s_pool_next] = v;
+	  s_pool_next = (s_pool_next + 1) % s_pool_max;
+	}
+	return v;
+      }
+
       vector_type
       type_from_pmt(pmt::pmt_t vector)
       {
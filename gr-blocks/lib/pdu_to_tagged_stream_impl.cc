@@ -65,8 +65,9 @@ namespace gr {
 	out += nout*d_itemsize;
       }
 
-      // if we have space for at least one item output as much as we can
-      if (noutput_items > 0) {
+      // while we have space, drain as many pdus as fit rather than at
+      // most one per work call
+      while (noutput_items > 0) {
 
 	// grab a message if one exists
 	pmt::pmt_t msg(delete_head_nowait(PDU_PORT_ID));
@@ -111,9 +112,13 @@ namespace gr {
 	if (nsave > 0) {
 	  d_remain.resize(nsave*d_itemsize, 0);
 	  memcpy(&d_remain[0], ptr + ncopy*d_itemsize, nsave*d_itemsize);
+	  return nout;
         }
+
+	noutput_items -= ncopy;
+	out += ncopy*d_itemsize;
       }
-      
+
       return nout;
     }
 
@@ -26,6 +26,8 @@
 
 #include "peak_detector2_fb_impl.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
 #include <string.h>
 
 namespace gr {
@@ -46,8 +48,29 @@ namespace gr {
                       io_signature::make(1, 1, sizeof(float)),
                       io_signature::make2(1, 2, sizeof(char), sizeof(float))),
         d_threshold_factor_rise(threshold_factor_rise),
-        d_look_ahead(look_ahead), d_alpha(alpha), d_avg(0.0f), d_found(false)
+        d_look_ahead(look_ahead), d_alpha(alpha), d_avg(0.0f), d_found(false),
+        d_neg(s_chunk)
     {
+      update_ema_weights();
+    }
+
+    void
+    peak_detector2_fb_impl::update_ema_weights()
+    {
+      // the average after n below-threshold samples is
+      //   (1-alpha)^n * avg + sum alpha*(1-alpha)^(n-1-k) * x[k]
+      // so a skipped chunk folds into one dot product against these
+      // precomputed weights
+      d_weights_alpha = d_alpha;
+      float om = 1.0f - d_alpha;
+      d_ema_w.resize(s_chunk);
+      d_ema_pow.resize(s_chunk + 1);
+      d_ema_w[s_chunk-1] = d_alpha;
+      for(int j = s_chunk-2; j >= 0; j--)
+        d_ema_w[j] = d_ema_w[j+1]*om;
+      d_ema_pow[0] = 1.0f;
+      for(int n = 1; n <= s_chunk; n++)
+        d_ema_pow[n] = d_ema_pow[n-1]*om;
     }
 
     peak_detector2_fb_impl::~peak_detector2_fb_impl()
@@ -66,39 +89,79 @@ namespace gr {
 
       memset(optr, 0, noutput_items*sizeof(char));
 
-      for(int i = 0; i < noutput_items; i++) {
-        if(!d_found) {
-          // Have not yet detected presence of peak
-          if(iptr[i] > d_avg * (1.0f + d_threshold_factor_rise)) {
-            d_found = true;
-            d_look_ahead_remaining = d_look_ahead;
-            d_peak_val = -(float)INFINITY;
-          }
-          else {
-            d_avg = d_alpha*iptr[i] + (1.0f - d_alpha)*d_avg;
+      float *sigout = (output_items.size() == 2) ? (float*)output_items[1] : 0;
+      float thr_rise = 1.0f + d_threshold_factor_rise;
+
+      if(d_alpha != d_weights_alpha)
+        update_ema_weights();
+
+      int i = 0;
+      while(i < noutput_items) {
+        int nscalar = 1;
+
+        // While idle (and nobody watches the per-sample average), scan
+        // a whole chunk with volk. The running average stays between
+        // its current value and the smallest sample of the chunk, so
+        // when the chunk maximum cannot beat that conservative
+        // threshold bound no sample in it can trigger, and the chunk
+        // collapses to one dot product updating the average. A chunk
+        // that does hold a candidate is handed to the per-sample
+        // machine in one piece.
+        if(!d_found && !sigout && thr_rise >= 0.0f) {
+          int n = std::min(noutput_items - i, (int)s_chunk);
+          if(n >= 16) {
+            unsigned int max_idx, min_idx;
+            volk_32f_index_max_16u(&max_idx, &iptr[i], n);
+            volk_32f_s32f_multiply_32f(&d_neg[0], &iptr[i], -1.0f, n);
+            volk_32f_index_max_16u(&min_idx, &d_neg[0], n);
+            float avg_lb = std::min(d_avg, iptr[i + min_idx]);
+
+            if(iptr[i + max_idx] <= avg_lb * thr_rise) {
+              float acc;
+              volk_32f_x2_dot_prod_32f(&acc, &iptr[i],
+                                       &d_ema_w[s_chunk - n], n);
+              d_avg = d_ema_pow[n]*d_avg + acc;
+              i += n;
+              continue;
+            }
+            nscalar = n;
           }
         }
-        else {
-          // Detected presence of peak
-          if(iptr[i] > d_peak_val) {
-            d_peak_val = iptr[i];
-            d_peak_ind = i;
+
+        // candidate neighborhood (or debug tap connected): original
+        // per-sample state machine
+        for(int end = i + nscalar; i < end; i++) {
+          if(!d_found) {
+            // Have not yet detected presence of peak
+            if(iptr[i] > d_avg * thr_rise) {
+              d_found = true;
+              d_look_ahead_remaining = d_look_ahead;
+              d_peak_val = -(float)INFINITY;
+            }
+            else {
+              d_avg = d_alpha*iptr[i] + (1.0f - d_alpha)*d_avg;
+            }
           }
-          else if(d_look_ahead_remaining <= 0) {
-            optr[d_peak_ind] = 1;
-            d_found = false;
-            d_avg = iptr[i];
+          else {
+            // Detected presence of peak
+            if(iptr[i] > d_peak_val) {
+              d_peak_val = iptr[i];
+              d_peak_ind = i;
+            }
+            else if(d_look_ahead_remaining <= 0) {
+              optr[d_peak_ind] = 1;
+              d_found = false;
+              d_avg = iptr[i];
+            }
+
+            // Have not yet located peak, loop and keep searching.
+            d_look_ahead_remaining--;
           }
 
-          // Have not yet located peak, loop and keep searching.
-          d_look_ahead_remaining--;
-        }
-
-        // Every iteration of the loop, write debugging signal out if
-        // connected:
-        if(output_items.size() == 2) {
-          float *sigout = (float *)output_items[1];
-          sigout[i] = d_avg;
+          // Every iteration of the loop, write debugging signal out if
+          // connected:
+          if(sigout)
+            sigout[i] = d_avg;
         }
       } // loop
 
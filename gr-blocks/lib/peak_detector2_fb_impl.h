@@ -40,6 +40,17 @@ namespace gr {
       float d_avg;
       bool d_found;
 
+      // Idle-scan fast path: whole chunks whose maximum cannot cross
+      // any reachable threshold are skipped with volk scans instead
+      // of the per-sample state machine.
+      static const int s_chunk = 4096;
+      std::vector<float> d_neg;      // negated chunk, for the vector min
+      std::vector<float> d_ema_w;    // alpha*(1-alpha)^k weights for the chunk EMA
+      std::vector<float> d_ema_pow;  // (1-alpha)^n
+      float d_weights_alpha;
+
+      void update_ema_weights();
+
     public:
       peak_detector2_fb_impl(float threshold_factor_rise,
                              int look_ahead, float alpha);
@@ -59,7 +59,7 @@ namespace gr {
       const @TYPE@ *in = (const @TYPE@ *)input_items[0];
 
       if(noutput_items > 0)
-        d_level = in[noutput_items-1];
+        d_level.write(in[noutput_items-1]);
 
       return noutput_items;
     }
@@ -26,6 +26,7 @@
 #define @GUARD_NAME_IMPL@
 
 #include <gnuradio/blocks/@NAME@.h>
+#include <gnuradio/thread/seqlock.h>
 
 namespace gr {
   namespace blocks {
@@ -33,13 +34,14 @@ namespace gr {
     class @NAME_IMPL@ : public @NAME@
     {
     private:
-      @TYPE@ d_level;
+      // published without locking so pollers never contend with work()
+      gr::thread::seqlock<@TYPE@> d_level;
 
     public:
       @NAME_IMPL@();
       ~@NAME_IMPL@();
 
-      @TYPE@ level() const { return d_level; }
+      @TYPE@ level() const { return d_level.read(); }
 
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
@@ -44,7 +44,8 @@ namespace gr {
     : sync_block("@BASE_NAME@",
                     io_signature::make(1, 1, size*sizeof(@TYPE@)),
                     io_signature::make(0, 0, 0)),
-      d_level(size, 0), d_size(size)
+      d_level(std::vector<@TYPE@>(size, 0)),
+      d_scratch(size, 0), d_size(size)
     {
     }
 
@@ -60,7 +61,8 @@ namespace gr {
       const @TYPE@ *in = (const @TYPE@ *)input_items[0];
 
       for(size_t i=0; i<d_size; i++)
-	d_level[i] = in[(noutput_items-1)*d_size+i];
+	d_scratch[i] = in[(noutput_items-1)*d_size+i];
+      d_level.write(d_scratch);
 
       return noutput_items;
     }
@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <gnuradio/blocks/@NAME@.h>
+#include <gnuradio/thread/seqlock.h>
 
 namespace gr {
   namespace blocks {
@@ -34,14 +35,17 @@ namespace gr {
     class @NAME_IMPL@ : public @NAME@
     {
     private:
-      std::vector<@TYPE@> d_level;
+      // published without locking so pollers never contend with work();
+      // d_scratch keeps the per-call copy allocation-free
+      gr::thread::seqlock<std::vector<@TYPE@> > d_level;
+      std::vector<@TYPE@> d_scratch;
       size_t d_size;
 
     public:
       @NAME_IMPL@(size_t size);
       ~@NAME_IMPL@();
 
-      std::vector<@TYPE@> level() const { return d_level; }
+      std::vector<@TYPE@> level() const { return d_level.read(); }
 
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
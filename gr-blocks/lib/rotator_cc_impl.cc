@@ -27,22 +27,26 @@
 #include "rotator_cc_impl.h"
 #include <gnuradio/io_signature.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace gr {
   namespace blocks {
 
     rotator_cc::sptr
-    rotator_cc::make(double phase_inc)
+    rotator_cc::make(double phase_inc, const std::string &reset_tag_key)
     {
       return gnuradio::get_initial_sptr
-        (new rotator_cc_impl(phase_inc));
+        (new rotator_cc_impl(phase_inc, reset_tag_key));
     }
 
-    rotator_cc_impl::rotator_cc_impl(double phase_inc)
+    rotator_cc_impl::rotator_cc_impl(double phase_inc,
+                                     const std::string &reset_tag_key)
       : sync_block("rotator_cc",
                       io_signature::make(1, 1, sizeof(gr_complex)),
-                      io_signature::make(1, 1, sizeof(gr_complex)))
+                      io_signature::make(1, 1, sizeof(gr_complex))),
+        d_reset_key(reset_tag_key.empty() ? pmt::PMT_NIL
+                                          : pmt::intern(reset_tag_key))
     {
       set_phase_inc(phase_inc);
     }
@@ -57,6 +61,12 @@ namespace gr {
       d_r.set_phase_incr( exp(gr_complex(0, phase_inc)) );
     }
 
+    void
+    rotator_cc_impl::set_phase(double phase)
+    {
+      d_r.set_phase( exp(gr_complex(0, phase)) );
+    }
+
     int
     rotator_cc_impl::work(int noutput_items,
                       gr_vector_const_void_star &input_items,
@@ -65,12 +75,31 @@ namespace gr {
       const gr_complex *in = (const gr_complex *)input_items[0];
       gr_complex *out = (gr_complex *)output_items[0];
 
-#if 0
-      for (int i=0; i<noutput_items; i++)
-      	out[i] = d_r.rotate(in[i]);
-#else
-      d_r.rotateN(out, in, noutput_items);
-#endif
+      if(pmt::eq(d_reset_key, pmt::PMT_NIL)) {
+        d_r.rotateN(out, in, noutput_items);
+        return noutput_items;
+      }
+
+      // Tag-triggered phase resets: rotate segment-wise, snapping the
+      // phase at every tagged sample so bursts start phase-aligned.
+      get_tags_in_range(d_tags, 0, nitems_read(0),
+                        nitems_read(0) + noutput_items, d_reset_key);
+      std::sort(d_tags.begin(), d_tags.end(), tag_t::offset_compare);
+
+      int start = 0;
+      for(size_t t = 0; t < d_tags.size(); t++) {
+        int offset = d_tags[t].offset - nitems_read(0);
+        if(offset > start) {
+          d_r.rotateN(&out[start], &in[start], offset - start);
+          start = offset;
+        }
+        double phase = 0.0;
+        if(pmt::is_number(d_tags[t].value))
+          phase = pmt::to_double(d_tags[t].value);
+        set_phase(phase);
+      }
+      if(start < noutput_items)
+        d_r.rotateN(&out[start], &in[start], noutput_items - start);
 
       return noutput_items;
     }
@@ -37,13 +37,18 @@ namespace gr {
     {
     private:
       rotator d_r;
+      pmt::pmt_t d_reset_key;   // PMT_NIL when tag resets are disabled
+      std::vector<tag_t> d_tags;
 
     public:
-      rotator_cc_impl(double phase_inc = 0.0);
+      rotator_cc_impl(double phase_inc = 0.0,
+                      const std::string &reset_tag_key = "");
       ~rotator_cc_impl();
 
       void set_phase_inc(double phase_inc);
-      
+      void set_phase(double phase);
+
+
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
                gr_vector_void_star &output_items);
@@ -0,0 +1,127 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "scheduled_valve_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/bind.hpp>
+#include <iostream>
+#include <string.h>
+
+namespace gr {
+  namespace blocks {
+
+    scheduled_valve::sptr
+    scheduled_valve::make(size_t itemsize, bool open)
+    {
+      return gnuradio::get_initial_sptr
+        (new scheduled_valve_impl(itemsize, open));
+    }
+
+    scheduled_valve_impl::scheduled_valve_impl(size_t itemsize, bool open)
+      : block("scheduled_valve",
+              io_signature::make(1, 1, itemsize),
+              io_signature::make(1, 1, itemsize)),
+        d_itemsize(itemsize),
+        d_open(open)
+    {
+      message_port_register_in(pmt::mp("cmd"));
+      set_msg_handler(pmt::mp("cmd"),
+                      boost::bind(&scheduled_valve_impl::handle_cmd, this, _1));
+    }
+
+    scheduled_valve_impl::~scheduled_valve_impl()
+    {
+    }
+
+    void
+    scheduled_valve_impl::handle_cmd(pmt::pmt_t msg)
+    {
+      if(!pmt::is_pair(msg)) {
+        std::cerr << "scheduled_valve: expected (offset . open) pair, got "
+                  << msg << std::endl;
+        return;
+      }
+
+      pmt::pmt_t offset = pmt::car(msg);
+      pmt::pmt_t action = pmt::cdr(msg);
+      if(!pmt::is_uint64(offset) || !pmt::is_bool(action)) {
+        std::cerr << "scheduled_valve: expected (uint64 . bool) pair, got "
+                  << msg << std::endl;
+        return;
+      }
+
+      d_cmds.push(cmd_t(pmt::to_uint64(offset), pmt::to_bool(action)));
+    }
+
+    void
+    scheduled_valve_impl::forecast(int noutput_items,
+                                   gr_vector_int &ninput_items_required)
+    {
+      ninput_items_required[0] = noutput_items;
+    }
+
+    int
+    scheduled_valve_impl::general_work(int noutput_items,
+                                       gr_vector_int &ninput_items,
+                                       gr_vector_const_void_star &input_items,
+                                       gr_vector_void_star &output_items)
+    {
+      const char *in = (const char*)input_items[0];
+      char *out = (char*)output_items[0];
+
+      const uint64_t base = nitems_read(0);
+
+      int i = 0;  // items consumed
+      int n = 0;  // items produced
+
+      while(i < noutput_items) {
+        // apply every command scheduled at or before the current
+        // offset; late commands take effect right here
+        while(!d_cmds.empty() && d_cmds.top().first <= base + i) {
+          d_open = d_cmds.top().second;
+          d_cmds.pop();
+        }
+
+        // run unchanged until the next scheduled command or the end
+        // of this buffer, whichever comes first
+        int span = noutput_items - i;
+        if(!d_cmds.empty() && d_cmds.top().first < base + noutput_items)
+          span = (int)(d_cmds.top().first - (base + i));
+
+        if(d_open) {
+          memcpy(&out[n * d_itemsize], &in[i * d_itemsize],
+                 span * d_itemsize);
+          n += span;
+        }
+        i += span;
+      }
+
+      consume_each(noutput_items);
+      return n;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
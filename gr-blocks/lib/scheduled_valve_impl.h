@@ -0,0 +1,66 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_SCHEDULED_VALVE_IMPL_H
+#define INCLUDED_GR_SCHEDULED_VALVE_IMPL_H
+
+#include <gnuradio/blocks/scheduled_valve.h>
+#include <queue>
+#include <functional>
+#include <utility>
+
+namespace gr {
+  namespace blocks {
+
+    class BLOCKS_API scheduled_valve_impl : public scheduled_valve
+    {
+    private:
+      typedef std::pair<uint64_t, bool> cmd_t;
+
+      size_t d_itemsize;
+      bool d_open;
+
+      // earliest offset first; handlers run in the block thread, so
+      // no locking against work() is needed
+      std::priority_queue<cmd_t, std::vector<cmd_t>,
+                          std::greater<cmd_t> > d_cmds;
+
+      void handle_cmd(pmt::pmt_t msg);
+
+    public:
+      scheduled_valve_impl(size_t itemsize, bool open);
+      ~scheduled_valve_impl();
+
+      bool open() const { return d_open; }
+
+      void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+      int general_work(int noutput_items,
+                       gr_vector_int &ninput_items,
+                       gr_vector_const_void_star &input_items,
+                       gr_vector_void_star &output_items);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SCHEDULED_VALVE_IMPL_H */
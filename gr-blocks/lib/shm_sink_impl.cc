@@ -0,0 +1,228 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm_sink_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/thread/thread.hpp>
+#include <stdexcept>
+#include <iostream>
+#include <stdio.h>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <errno.h>
+#endif
+
+namespace gr {
+  namespace blocks {
+
+    // tag ring capacity; a tag entry is ~50-100 bytes, so this is
+    // plenty for any sane tag rate and is dropped-from, not blocked-on
+    static const size_t SHM_TAG_BUFSIZE = 65536;
+
+    shm_sink::sptr
+    shm_sink::make(size_t itemsize, const std::string &name,
+                   int buffer_items)
+    {
+      return gnuradio::get_initial_sptr
+        (new shm_sink_impl(itemsize, name, buffer_items));
+    }
+
+    shm_sink_impl::shm_sink_impl(size_t itemsize, const std::string &name,
+                                 int buffer_items)
+      : sync_block("shm_sink",
+                   io_signature::make(1, 1, itemsize),
+                   io_signature::make(0, 0, 0)),
+        d_itemsize(itemsize), d_name(name),
+        d_hdr(NULL), d_samples(NULL), d_tags(NULL)
+    {
+#if defined(_WIN32)
+      throw std::runtime_error("shm_sink: not supported on this platform");
+#else
+      if(buffer_items <= 0)
+        throw std::invalid_argument("shm_sink: buffer_items must be > 0");
+
+      uint64_t bufsize = (uint64_t)buffer_items * itemsize;
+      d_segsize = sizeof(shm_stream_hdr) + bufsize + SHM_TAG_BUFSIZE;
+
+      int fd = shm_open(d_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+      if(fd == -1 && errno == EEXIST) {
+        // stale segment from a crashed run; take it over
+        shm_unlink(d_name.c_str());
+        fd = shm_open(d_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+      }
+      if(fd == -1) {
+        perror("shm_sink: shm_open");
+        throw std::runtime_error("shm_sink: shm_open");
+      }
+
+      if(ftruncate(fd, (off_t)d_segsize) == -1) {
+        close(fd);
+        shm_unlink(d_name.c_str());
+        perror("shm_sink: ftruncate");
+        throw std::runtime_error("shm_sink: ftruncate");
+      }
+
+      void *base = mmap(0, d_segsize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, (off_t)0);
+      close(fd);
+      if(base == MAP_FAILED) {
+        shm_unlink(d_name.c_str());
+        perror("shm_sink: mmap");
+        throw std::runtime_error("shm_sink: mmap");
+      }
+
+      d_hdr = (shm_stream_hdr*)base;
+      d_samples = (char*)base + sizeof(shm_stream_hdr);
+      d_tags = d_samples + bufsize;
+
+      d_hdr->version = SHM_STREAM_VERSION;
+      d_hdr->itemsize = itemsize;
+      d_hdr->bufsize = bufsize;
+      d_hdr->tag_bufsize = SHM_TAG_BUFSIZE;
+      d_hdr->written = 0;
+      d_hdr->read = 0;
+      d_hdr->tag_written = 0;
+      d_hdr->tag_read = 0;
+      d_hdr->sink_done = 0;
+
+      // publish the magic last so a source never sees a
+      // half-initialized header
+      __sync_synchronize();
+      d_hdr->magic = SHM_STREAM_MAGIC;
+#endif
+    }
+
+    shm_sink_impl::~shm_sink_impl()
+    {
+#if !defined(_WIN32)
+      if(d_hdr) {
+        d_hdr->sink_done = 1;
+        __sync_synchronize();
+        munmap((void*)d_hdr, d_segsize);
+        shm_unlink(d_name.c_str());
+      }
+#endif
+    }
+
+    bool
+    shm_sink_impl::stop()
+    {
+#if !defined(_WIN32)
+      // let a draining source finish instead of blocking teardown
+      d_hdr->sink_done = 1;
+      __sync_synchronize();
+#endif
+      return true;
+    }
+
+    void
+    shm_sink_impl::forward_tags(int nitems)
+    {
+      const uint64_t start = nitems_read(0);
+
+      d_work_tags.clear();
+      get_tags_in_range(d_work_tags, 0, start, start + nitems);
+
+      for(size_t t = 0; t < d_work_tags.size(); t++) {
+        const tag_t &tag = d_work_tags[t];
+
+        std::string payload =
+          pmt::serialize_str(pmt::make_tuple(tag.key, tag.value, tag.srcid));
+
+        uint64_t entry_len = sizeof(uint64_t) + sizeof(uint32_t)
+          + payload.size();
+
+        // tags are metadata; drop rather than stall the sample path
+        // if the reader is not keeping up with the tag ring
+        uint64_t room = d_hdr->tag_bufsize
+          - (d_hdr->tag_written - d_hdr->tag_read);
+        if(entry_len > room) {
+          std::cerr << "shm_sink: tag ring full, dropping tag" << std::endl;
+          continue;
+        }
+
+        uint64_t pos = d_hdr->tag_written;
+        uint32_t len32 = (uint32_t)payload.size();
+        shm_stream_ring_write(d_tags, d_hdr->tag_bufsize, pos,
+                              &tag.offset, sizeof(uint64_t));
+        pos += sizeof(uint64_t);
+        shm_stream_ring_write(d_tags, d_hdr->tag_bufsize, pos,
+                              &len32, sizeof(uint32_t));
+        pos += sizeof(uint32_t);
+        shm_stream_ring_write(d_tags, d_hdr->tag_bufsize, pos,
+                              payload.data(), payload.size());
+
+        __sync_synchronize();
+        d_hdr->tag_written += entry_len;
+      }
+    }
+
+    int
+    shm_sink_impl::work(int noutput_items,
+                        gr_vector_const_void_star &input_items,
+                        gr_vector_void_star &output_items)
+    {
+#if defined(_WIN32)
+      return WORK_DONE;
+#else
+      const char *in = (const char*)input_items[0];
+
+      // wait for room for at least one item; bounded so the
+      // scheduler can still tear the flowgraph down if the reader
+      // has stalled for good
+      int waited_us = 0;
+      uint64_t room = d_hdr->bufsize - (d_hdr->written - d_hdr->read);
+      while(room < d_itemsize && waited_us < 100000) {
+        boost::this_thread::sleep(boost::posix_time::microseconds(100));
+        waited_us += 100;
+        room = d_hdr->bufsize - (d_hdr->written - d_hdr->read);
+      }
+
+      int nitems = (int)std::min((uint64_t)noutput_items,
+                                 room / d_itemsize);
+      if(nitems == 0)
+        return 0;
+
+      // tags first so the reader has them by the time the samples
+      // they refer to become visible
+      forward_tags(nitems);
+
+      shm_stream_ring_write(d_samples, d_hdr->bufsize, d_hdr->written,
+                            in, nitems * d_itemsize);
+
+      __sync_synchronize();
+      d_hdr->written += nitems * d_itemsize;
+
+      return nitems;
+#endif
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,62 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_SHM_SINK_IMPL_H
+#define INCLUDED_GR_SHM_SINK_IMPL_H
+
+#include <gnuradio/blocks/shm_sink.h>
+#include "shm_stream.h"
+
+namespace gr {
+  namespace blocks {
+
+    class shm_sink_impl : public shm_sink
+    {
+    private:
+      size_t d_itemsize;
+      std::string d_name;
+
+      shm_stream_hdr *d_hdr;
+      char *d_samples;
+      char *d_tags;
+      size_t d_segsize;
+
+      std::vector<tag_t> d_work_tags;
+
+      void forward_tags(int nitems);
+
+    public:
+      shm_sink_impl(size_t itemsize, const std::string &name,
+                    int buffer_items);
+      ~shm_sink_impl();
+
+      bool stop();
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SHM_SINK_IMPL_H */
@@ -0,0 +1,201 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm_source_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/thread/thread.hpp>
+#include <stdexcept>
+#include <iostream>
+#include <stdio.h>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#endif
+
+namespace gr {
+  namespace blocks {
+
+    shm_source::sptr
+    shm_source::make(size_t itemsize, const std::string &name)
+    {
+      return gnuradio::get_initial_sptr
+        (new shm_source_impl(itemsize, name));
+    }
+
+    shm_source_impl::shm_source_impl(size_t itemsize,
+                                     const std::string &name)
+      : sync_block("shm_source",
+                   io_signature::make(0, 0, 0),
+                   io_signature::make(1, 1, itemsize)),
+        d_itemsize(itemsize), d_name(name),
+        d_hdr(NULL), d_samples(NULL), d_tags(NULL)
+    {
+#if defined(_WIN32)
+      throw std::runtime_error("shm_source: not supported on this platform");
+#else
+      int fd = shm_open(d_name.c_str(), O_RDWR, 0);
+      if(fd == -1) {
+        perror("shm_source: shm_open");
+        throw std::runtime_error(
+          "shm_source: segment not found; start the shm_sink process first");
+      }
+
+      struct stat st;
+      if(fstat(fd, &st) == -1) {
+        close(fd);
+        perror("shm_source: fstat");
+        throw std::runtime_error("shm_source: fstat");
+      }
+      d_segsize = st.st_size;
+
+      void *base = mmap(0, d_segsize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, (off_t)0);
+      close(fd);
+      if(base == MAP_FAILED) {
+        perror("shm_source: mmap");
+        throw std::runtime_error("shm_source: mmap");
+      }
+
+      d_hdr = (shm_stream_hdr*)base;
+      d_samples = (const char*)base + sizeof(shm_stream_hdr);
+
+      if(d_hdr->magic != SHM_STREAM_MAGIC ||
+         d_hdr->version != SHM_STREAM_VERSION) {
+        munmap(base, d_segsize);
+        throw std::runtime_error(
+          "shm_source: segment is not a gnuradio stream ring");
+      }
+      if(d_hdr->itemsize != itemsize) {
+        munmap(base, d_segsize);
+        throw std::runtime_error(
+          "shm_source: itemsize does not match the sink's");
+      }
+
+      d_tags = d_samples + d_hdr->bufsize;
+      d_start_item = d_hdr->read / d_itemsize;
+#endif
+    }
+
+    shm_source_impl::~shm_source_impl()
+    {
+#if !defined(_WIN32)
+      if(d_hdr)
+        munmap((void*)d_hdr, d_segsize);
+#endif
+    }
+
+    void
+    shm_source_impl::attach_tags(uint64_t end_item)
+    {
+      // consume every forwarded tag that falls inside the items we
+      // are about to produce; offsets are the sink's absolute item
+      // offsets, rebased onto our output
+      while(d_hdr->tag_read < d_hdr->tag_written) {
+        uint64_t pos = d_hdr->tag_read;
+
+        uint64_t offset;
+        uint32_t len;
+        shm_stream_ring_read(&offset, d_tags, d_hdr->tag_bufsize,
+                             pos, sizeof(uint64_t));
+        pos += sizeof(uint64_t);
+        shm_stream_ring_read(&len, d_tags, d_hdr->tag_bufsize,
+                             pos, sizeof(uint32_t));
+        pos += sizeof(uint32_t);
+
+        if(offset >= end_item)
+          break;
+
+        std::string payload(len, '\0');
+        if(len > 0)
+          shm_stream_ring_read(&payload[0], d_tags, d_hdr->tag_bufsize,
+                               pos, len);
+
+        __sync_synchronize();
+        d_hdr->tag_read += sizeof(uint64_t) + sizeof(uint32_t) + len;
+
+        pmt::pmt_t tuple = pmt::deserialize_str(payload);
+        if(pmt::is_tuple(tuple) && pmt::length(tuple) == 3 &&
+           offset >= d_start_item) {
+          add_item_tag(0, offset - d_start_item,
+                       pmt::tuple_ref(tuple, 0),
+                       pmt::tuple_ref(tuple, 1),
+                       pmt::tuple_ref(tuple, 2));
+        }
+      }
+    }
+
+    int
+    shm_source_impl::work(int noutput_items,
+                          gr_vector_const_void_star &input_items,
+                          gr_vector_void_star &output_items)
+    {
+#if defined(_WIN32)
+      return WORK_DONE;
+#else
+      char *out = (char*)output_items[0];
+
+      // wait for at least one item; bounded so flowgraph teardown is
+      // never stuck behind a stalled writer
+      int waited_us = 0;
+      uint64_t avail = d_hdr->written - d_hdr->read;
+      while(avail < d_itemsize && waited_us < 100000) {
+        if(d_hdr->sink_done) {
+          // drain whatever the sink managed to publish, then finish
+          avail = d_hdr->written - d_hdr->read;
+          if(avail < d_itemsize)
+            return WORK_DONE;
+          break;
+        }
+        boost::this_thread::sleep(boost::posix_time::microseconds(100));
+        waited_us += 100;
+        avail = d_hdr->written - d_hdr->read;
+      }
+
+      int nitems = (int)std::min((uint64_t)noutput_items,
+                                 avail / d_itemsize);
+      if(nitems == 0)
+        return 0;
+
+      __sync_synchronize();
+      shm_stream_ring_read(out, d_samples, d_hdr->bufsize,
+                           d_hdr->read, nitems * d_itemsize);
+
+      attach_tags(d_hdr->read / d_itemsize + nitems);
+
+      __sync_synchronize();
+      d_hdr->read += nitems * d_itemsize;
+
+      return nitems;
+#endif
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
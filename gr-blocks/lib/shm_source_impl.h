@@ -0,0 +1,59 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_SHM_SOURCE_IMPL_H
+#define INCLUDED_GR_SHM_SOURCE_IMPL_H
+
+#include <gnuradio/blocks/shm_source.h>
+#include "shm_stream.h"
+
+namespace gr {
+  namespace blocks {
+
+    class shm_source_impl : public shm_source
+    {
+    private:
+      size_t d_itemsize;
+      std::string d_name;
+
+      shm_stream_hdr *d_hdr;
+      const char *d_samples;
+      const char *d_tags;
+      size_t d_segsize;
+
+      uint64_t d_start_item;  // stream item offset of our output item 0
+
+      void attach_tags(uint64_t end_item);
+
+    public:
+      shm_source_impl(size_t itemsize, const std::string &name);
+      ~shm_source_impl();
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SHM_SOURCE_IMPL_H */
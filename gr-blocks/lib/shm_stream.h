@@ -0,0 +1,98 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_SHM_STREAM_H
+#define INCLUDED_GR_SHM_STREAM_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace gr {
+  namespace blocks {
+
+    /*!
+     * Layout of the shared memory segment used by shm_sink/shm_source.
+     *
+     * The header is followed by \p bufsize bytes of sample ring and
+     * \p tag_bufsize bytes of tag ring. Both rings are single writer,
+     * single reader: the byte counters only ever grow, the writer
+     * owns 'written'/'tag_written' and the reader owns
+     * 'read'/'tag_read', so each field has exactly one writing
+     * process and no cross-process locks are needed.
+     *
+     * A tag ring entry is a uint64 absolute item offset, a uint32
+     * payload length, then the pmt-serialized (key value srcid)
+     * tuple.
+     */
+    struct shm_stream_hdr {
+      uint32_t magic;
+      uint32_t version;
+      uint64_t itemsize;
+      uint64_t bufsize;
+      uint64_t tag_bufsize;
+
+      volatile uint64_t written;     // sample bytes ever produced
+      volatile uint64_t read;        // sample bytes ever consumed
+      volatile uint64_t tag_written; // tag ring bytes ever produced
+      volatile uint64_t tag_read;    // tag ring bytes ever consumed
+      volatile uint32_t sink_done;   // writer has detached
+    };
+
+    static const uint32_t SHM_STREAM_MAGIC = 0x47525348; // "GRSH"
+    static const uint32_t SHM_STREAM_VERSION = 1;
+
+    //! Copy into a byte ring at an absolute (unwrapped) position
+    static inline void
+    shm_stream_ring_write(char *ring, uint64_t bufsize,
+                          uint64_t pos, const void *src, size_t len)
+    {
+      uint64_t start = pos % bufsize;
+      if(start + len <= bufsize) {
+        memcpy(ring + start, src, len);
+      }
+      else {
+        size_t first = bufsize - start;
+        memcpy(ring + start, src, first);
+        memcpy(ring, (const char*)src + first, len - first);
+      }
+    }
+
+    //! Copy out of a byte ring at an absolute (unwrapped) position
+    static inline void
+    shm_stream_ring_read(void *dst, const char *ring, uint64_t bufsize,
+                         uint64_t pos, size_t len)
+    {
+      uint64_t start = pos % bufsize;
+      if(start + len <= bufsize) {
+        memcpy(dst, ring + start, len);
+      }
+      else {
+        size_t first = bufsize - start;
+        memcpy(dst, ring + start, first);
+        memcpy((char*)dst + first, ring, len - first);
+      }
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SHM_STREAM_H */
@@ -0,0 +1,77 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "short_to_float_scaled_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+  namespace blocks {
+
+    short_to_float_scaled::sptr
+    short_to_float_scaled::make(size_t vlen, float scale, float offset)
+    {
+      return gnuradio::get_initial_sptr
+	(new short_to_float_scaled_impl(vlen, scale, offset));
+    }
+
+    short_to_float_scaled_impl::short_to_float_scaled_impl(size_t vlen,
+							   float scale,
+							   float offset)
+      : sync_block("short_to_float_scaled",
+		      io_signature::make (1, 1, sizeof(short)*vlen),
+		      io_signature::make (1, 1, sizeof(float)*vlen)),
+	d_vlen(vlen), d_scale(scale), d_offset(offset)
+    {
+      const int alignment_multiple =
+	volk_get_alignment() / sizeof(float);
+      set_alignment(std::max(1, alignment_multiple));
+    }
+
+    int
+    short_to_float_scaled_impl::work(int noutput_items,
+				     gr_vector_const_void_star &input_items,
+				     gr_vector_void_star &output_items)
+    {
+      const short *in = (const short *) input_items[0];
+      float *out = (float *) output_items[0];
+      int n = d_vlen*noutput_items;
+
+      if(d_offset == 0.0 && d_scale != 0.0) {
+	// the volk convert kernel divides by its scalar
+	volk_16i_s32f_convert_32f(out, in, 1.0f/d_scale, n);
+      }
+      else {
+	for(int i = 0; i < n; i++) {
+	  out[i] = (float)in[i]*d_scale + d_offset;
+	}
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+}/* namespace gr */
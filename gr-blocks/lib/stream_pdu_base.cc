@@ -36,6 +36,7 @@
 #include <gnuradio/basic_block.h>
 #include "stream_pdu_base.h"
 #include <boost/format.hpp>
+#include <string.h>
 
 static const long timeout_us = 100*1000; //100ms
 
@@ -87,7 +88,11 @@ namespace gr {
         if (result <= 0)
 	  throw std::runtime_error("stream_pdu_base, bad socket read!");
 
-        pmt::pmt_t vector = pmt::init_u8vector(result, &d_rxbuf[0]);       
+        // recycle the payload vector of an already-consumed PDU when
+        // one of matching size is available
+        pmt::pmt_t vector = d_blk->message_blob(result);
+        size_t o(0);
+        memcpy(pmt::uniform_vector_writable_elements(vector, o), &d_rxbuf[0], result);
         pmt::pmt_t pdu = pmt::cons(pmt::PMT_NIL, vector);
 
         d_blk->message_port_pub(d_port, pdu);
@@ -0,0 +1,168 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "stream_selector_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/format.hpp>
+#include <stdexcept>
+#include <string.h>
+
+namespace gr {
+  namespace blocks {
+
+    stream_selector::sptr
+    stream_selector::make(size_t itemsize, int input_index)
+    {
+      return gnuradio::get_initial_sptr
+	(new stream_selector_impl(itemsize, input_index));
+    }
+
+    stream_selector_impl::stream_selector_impl(size_t itemsize, int input_index)
+      : block("stream_selector",
+		 io_signature::make(1, io_signature::IO_INFINITE, itemsize),
+		 io_signature::make(1, 1, itemsize)),
+	d_itemsize(itemsize),
+	d_ninputs(0),
+	d_input_index(input_index),
+	d_next_index(input_index)
+    {
+      if(input_index < 0)
+	throw std::invalid_argument("stream_selector: input index must be >= 0");
+
+      // Tags of the selected input are propagated by hand so their
+      // offsets land in the right place in the output stream.
+      set_tag_propagation_policy(TPP_DONT);
+
+      message_port_register_in(pmt::mp("select"));
+      set_msg_handler(pmt::mp("select"),
+		      boost::bind(&stream_selector_impl::handle_select, this, _1));
+    }
+
+    stream_selector_impl::~stream_selector_impl()
+    {
+    }
+
+    bool
+    stream_selector_impl::check_topology(int ninputs, int noutputs)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      d_ninputs = ninputs;
+      return d_next_index < ninputs;
+    }
+
+    void
+    stream_selector_impl::set_input_index(int input_index)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      if(input_index < 0 || (d_ninputs > 0 && input_index >= d_ninputs))
+	throw std::invalid_argument("stream_selector: input index out of range");
+      d_next_index = input_index;
+    }
+
+    int
+    stream_selector_impl::input_index() const
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      return d_next_index;
+    }
+
+    void
+    stream_selector_impl::handle_select(pmt::pmt_t msg)
+    {
+      // Accept either a plain integer or a (key . value) pair
+      if(pmt::is_pair(msg) && !pmt::is_integer(msg))
+	msg = pmt::cdr(msg);
+
+      if(!pmt::is_integer(msg)) {
+	GR_LOG_WARN(d_logger, "select message must be an integer; ignored");
+	return;
+      }
+
+      long index = pmt::to_long(msg);
+      gr::thread::scoped_lock lock(d_mutex);
+      if(index < 0 || (d_ninputs > 0 && index >= d_ninputs)) {
+	GR_LOG_WARN(d_logger, boost::format("select index %1% out of range; "
+					    "ignored") % index);
+	return;
+      }
+      d_next_index = (int)index;
+    }
+
+    void
+    stream_selector_impl::forecast(int noutput_items,
+				   gr_vector_int &ninput_items_required)
+    {
+      int active;
+      {
+	gr::thread::scoped_lock lock(d_mutex);
+	active = d_next_index;
+      }
+      for(unsigned i = 0; i < ninput_items_required.size(); i++)
+	ninput_items_required[i] = ((int)i == active) ? noutput_items : 0;
+    }
+
+    int
+    stream_selector_impl::general_work(int noutput_items,
+				       gr_vector_int &ninput_items,
+				       gr_vector_const_void_star &input_items,
+				       gr_vector_void_star &output_items)
+    {
+      // Apply a pending switch between work calls, so every output
+      // item comes entirely from one input
+      {
+	gr::thread::scoped_lock lock(d_mutex);
+	d_input_index = d_next_index;
+      }
+
+      char *out = (char*)output_items[0];
+      const char *in = (const char*)input_items[d_input_index];
+
+      int n = std::min(noutput_items, ninput_items[d_input_index]);
+      memcpy(out, in, (size_t)n * d_itemsize);
+
+      // Propagate the selected input's tags over the copied span
+      std::vector<tag_t> tags;
+      std::vector<tag_t>::iterator t;
+      get_tags_in_range(tags, d_input_index,
+			nitems_read(d_input_index),
+			nitems_read(d_input_index) + n);
+      uint64_t shift = nitems_written(0) - nitems_read(d_input_index);
+      for(t = tags.begin(); t != tags.end(); t++) {
+	tag_t new_tag = *t;
+	new_tag.offset += shift;
+	add_item_tag(0, new_tag);
+      }
+
+      // The selected input advances by what was copied; the others are
+      // drained without a copy so upstream keeps running
+      for(unsigned i = 0; i < ninput_items.size(); i++)
+	consume(i, ((int)i == d_input_index) ? n : ninput_items[i]);
+
+      return n;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,62 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_STREAM_SELECTOR_IMPL_H
+#define INCLUDED_STREAM_SELECTOR_IMPL_H
+
+#include <gnuradio/blocks/stream_selector.h>
+#include <gnuradio/thread/thread.h>
+
+namespace gr {
+  namespace blocks {
+
+    class stream_selector_impl : public stream_selector
+    {
+    private:
+      size_t d_itemsize;
+      int d_ninputs;
+
+      mutable gr::thread::mutex d_mutex;
+      int d_input_index;   // input used by the current work call
+      int d_next_index;    // input requested; applied between work calls
+
+      void handle_select(pmt::pmt_t msg);
+
+    public:
+      stream_selector_impl(size_t itemsize, int input_index);
+      ~stream_selector_impl();
+
+      void set_input_index(int input_index);
+      int input_index() const;
+
+      bool check_topology(int ninputs, int noutputs);
+      void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+      int general_work(int noutput_items,
+		       gr_vector_int &ninput_items,
+		       gr_vector_const_void_star &input_items,
+		       gr_vector_void_star &output_items);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_STREAM_SELECTOR_IMPL_H */
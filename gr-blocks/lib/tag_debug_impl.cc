@@ -47,7 +47,12 @@ namespace gr {
       : sync_block("tag_debug",
                    io_signature::make(1, -1, sizeof_stream_item),
                    io_signature::make(0, 0, 0)),
-        d_name(name), d_display(true)
+        d_name(name),
+        d_max_tags(1024),
+        d_sample_nth(1),
+        d_nseen(0),
+        d_ntags(0),
+        d_display(true)
     {
       set_key_filter(key_filter);
     }
@@ -60,15 +65,13 @@ namespace gr {
     tag_debug_impl::current_tags()
     {
       gr::thread::scoped_lock l(d_mutex);
-      return d_tags;
+      return std::vector<tag_t>(d_tags.begin(), d_tags.end());
     }
 
     int
     tag_debug_impl::num_tags()
     {
-      std::vector<tag_t> t;
-      get_tags_in_range(t, 0, 0, nitems_read(0));
-      return static_cast<int>(t.size());
+      return static_cast<int>(d_ntags);
     }
 
     void
@@ -77,6 +80,22 @@ namespace gr {
       d_display = d;
     }
 
+    void
+    tag_debug_impl::set_max_tags(unsigned int max_tags)
+    {
+      gr::thread::scoped_lock l(d_mutex);
+      d_max_tags = max_tags;
+      while(d_tags.size() > d_max_tags)
+        d_tags.pop_front();
+    }
+
+    void
+    tag_debug_impl::set_sampling(unsigned int nth)
+    {
+      gr::thread::scoped_lock l(d_mutex);
+      d_sample_nth = (nth == 0) ? 1 : nth;
+    }
+
     void
     tag_debug_impl::set_key_filter(const std::string &key_filter)
     {
@@ -106,27 +125,42 @@ namespace gr {
         sout << std::endl << "Tag Debug: " << d_name << std::endl;
       }
 
+      bool displayed = false;
       uint64_t abs_N, end_N;
+      std::vector<tag_t> tags;
+      std::vector<tag_t>::iterator itr;
       for(size_t i = 0; i < input_items.size(); i++) {
         abs_N = nitems_read(i);
         end_N = abs_N + (uint64_t)(noutput_items);
 
-        d_tags.clear();
+        tags.clear();
         if(pmt::is_null(d_filter))
-          get_tags_in_range(d_tags, i, abs_N, end_N);
+          get_tags_in_range(tags, i, abs_N, end_N);
         else
-          get_tags_in_range(d_tags, i, abs_N, end_N, d_filter);
+          get_tags_in_range(tags, i, abs_N, end_N, d_filter);
 
         if(d_display) {
-          sout << "Input Stream: " << std::setw(2) << std::setfill('0') 
+          sout << "Input Stream: " << std::setw(2) << std::setfill('0')
                << i << std::setfill(' ') << std::endl;
-          for(d_tags_itr = d_tags.begin(); d_tags_itr != d_tags.end(); d_tags_itr++) {
-            sout << std::setw(10) << "Offset: " << d_tags_itr->offset
-                 << std::setw(10) << "Source: " 
-                 << (pmt::is_symbol(d_tags_itr->srcid) ? pmt::symbol_to_string(d_tags_itr->srcid) : "n/a")
-                 << std::setw(10) << "Key: " << pmt::symbol_to_string(d_tags_itr->key)
+        }
+
+        for(itr = tags.begin(); itr != tags.end(); itr++) {
+          ++d_ntags;
+          if(d_nseen++ % d_sample_nth != 0)
+            continue;
+
+          d_tags.push_back(*itr);
+          while(d_tags.size() > d_max_tags)
+            d_tags.pop_front();
+
+          if(d_display) {
+            displayed = true;
+            sout << std::setw(10) << "Offset: " << itr->offset
+                 << std::setw(10) << "Source: "
+                 << (pmt::is_symbol(itr->srcid) ? pmt::symbol_to_string(itr->srcid) : "n/a")
+                 << std::setw(10) << "Key: " << pmt::symbol_to_string(itr->key)
                  << std::setw(10) << "Value: ";
-            sout << d_tags_itr->value << std::endl;
+            sout << itr->value << std::endl;
           }
         }
       }
@@ -135,7 +169,7 @@ namespace gr {
         sout << "----------------------------------------------------------------------";
         sout << std::endl;
 
-        if(d_tags.size() > 0)
+        if(displayed)
           std::cout << sout.str();
       }
 
@@ -25,6 +25,8 @@
 
 #include <gnuradio/blocks/tag_debug.h>
 #include <gnuradio/thread/thread.h>
+#include <boost/detail/atomic_count.hpp>
+#include <deque>
 #include <stddef.h>
 
 namespace gr {
@@ -34,8 +36,11 @@ namespace gr {
     {
     private:
       std::string d_name;
-      std::vector<tag_t> d_tags;
-      std::vector<tag_t>::iterator d_tags_itr;
+      std::deque<tag_t> d_tags;         // bounded ring of recent tags
+      size_t d_max_tags;
+      unsigned int d_sample_nth;        // keep 1 in this many tags
+      uint64_t d_nseen;                 // tags seen, for the sampling phase
+      boost::detail::atomic_count d_ntags;
       bool d_display;
       pmt::pmt_t d_filter;
       gr::thread::mutex d_mutex;
@@ -51,6 +56,8 @@ namespace gr {
       int num_tags();
 
       void set_display(bool d);
+      void set_max_tags(unsigned int max_tags);
+      void set_sampling(unsigned int nth);
 
       void set_key_filter(const std::string &key_filter);
       std::string key_filter() const;
@@ -66,8 +66,8 @@ namespace gr {
 	  d_pdu_meta = dict_add(d_pdu_meta, (*d_tags_itr).key, (*d_tags_itr).value);
       }
 
-      // Grab data, throw into vector
-      d_pdu_vector = pdu::make_pdu_vector(d_type, in, ninput_items[0]);
+      // Grab data, throw into vector (recycled through the PDU pool)
+      d_pdu_vector = pdu::make_pdu_vector_pooled(d_type, in, ninput_items[0]);
 
       // Send msg
       pmt::pmt_t msg = pmt::cons(d_pdu_meta, d_pdu_vector);
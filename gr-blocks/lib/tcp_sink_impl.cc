@@ -0,0 +1,302 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tcp_sink_impl.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace gr {
+  namespace blocks {
+
+    static void
+    set_nonblock(int fd)
+    {
+      int flags = fcntl(fd, F_GETFL, 0);
+      fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    }
+
+    static bool
+    resolve(const std::string &host, unsigned short port,
+            struct sockaddr_in *addr)
+    {
+      memset(addr, 0, sizeof(*addr));
+      addr->sin_family = AF_INET;
+      addr->sin_port = htons(port);
+
+      if(host.empty() || host == "0.0.0.0") {
+        addr->sin_addr.s_addr = htonl(INADDR_ANY);
+        return true;
+      }
+
+      struct addrinfo hints, *res = 0;
+      memset(&hints, 0, sizeof(hints));
+      hints.ai_family = AF_INET;
+      hints.ai_socktype = SOCK_STREAM;
+      if(getaddrinfo(host.c_str(), NULL, &hints, &res) != 0 || !res)
+        return false;
+      addr->sin_addr = ((struct sockaddr_in*)res->ai_addr)->sin_addr;
+      freeaddrinfo(res);
+      return true;
+    }
+
+    tcp_sink::sptr
+    tcp_sink::make(size_t itemsize,
+                   const std::string &host, int port,
+                   bool server, bool nodelay, bool framed)
+    {
+      return gnuradio::get_initial_sptr
+        (new tcp_sink_impl(itemsize, host, port, server, nodelay, framed));
+    }
+
+    tcp_sink_impl::tcp_sink_impl(size_t itemsize,
+                                 const std::string &host, int port,
+                                 bool server, bool nodelay, bool framed)
+      : sync_block("tcp_sink",
+                      io_signature::make(1, 1, itemsize),
+                      io_signature::make(0, 0, 0)),
+        d_itemsize(itemsize), d_host(host),
+        d_port(static_cast<unsigned short>(port)),
+        d_server(server), d_nodelay(nodelay), d_framed(framed),
+        d_listen_fd(-1), d_connect_fd(-1), d_conn_fd(-1),
+        d_payload_left(0)
+    {
+      if(d_server) {
+        struct sockaddr_in addr;
+        if(!resolve(d_host, d_port, &addr))
+          throw std::runtime_error("tcp_sink: can't resolve bind address");
+
+        d_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        if(d_listen_fd < 0)
+          throw std::runtime_error("tcp_sink: socket failed");
+
+        int one = 1;
+        setsockopt(d_listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if(bind(d_listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+           listen(d_listen_fd, 1) < 0) {
+          ::close(d_listen_fd);
+          throw std::runtime_error("tcp_sink: can't listen on port");
+        }
+        set_nonblock(d_listen_fd);
+      }
+    }
+
+    tcp_sink_impl::~tcp_sink_impl()
+    {
+      if(d_conn_fd >= 0)
+        ::close(d_conn_fd);
+      if(d_connect_fd >= 0)
+        ::close(d_connect_fd);
+      if(d_listen_fd >= 0)
+        ::close(d_listen_fd);
+    }
+
+    void
+    tcp_sink_impl::setup_peer(int fd)
+    {
+      if(d_nodelay) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      }
+    }
+
+    void
+    tcp_sink_impl::drop_peer()
+    {
+      if(d_conn_fd >= 0) {
+        ::close(d_conn_fd);
+        d_conn_fd = -1;
+      }
+      d_payload_left = 0;   // resync framing on the next connection
+    }
+
+    void
+    tcp_sink_impl::start_connect()
+    {
+      struct sockaddr_in addr;
+      if(!resolve(d_host, d_port, &addr))
+        return;
+
+      int fd = socket(AF_INET, SOCK_STREAM, 0);
+      if(fd < 0)
+        return;
+      set_nonblock(fd);
+
+      if(connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+        d_conn_fd = fd;
+        setup_peer(fd);
+      }
+      else if(errno == EINPROGRESS)
+        d_connect_fd = fd;
+      else
+        ::close(fd);
+    }
+
+    bool
+    tcp_sink_impl::ensure_connected()
+    {
+      if(d_server) {
+        // newest peer wins, as in tcp_source
+        int fd = accept(d_listen_fd, NULL, NULL);
+        if(fd >= 0) {
+          drop_peer();
+          d_conn_fd = fd;
+          setup_peer(fd);
+        }
+        return d_conn_fd >= 0;
+      }
+
+      if(d_conn_fd >= 0)
+        return true;
+
+      if(d_connect_fd >= 0) {
+        struct pollfd pfd;
+        pfd.fd = d_connect_fd;
+        pfd.events = POLLOUT;
+        if(poll(&pfd, 1, 0) > 0) {
+          int err = 0;
+          socklen_t len = sizeof(err);
+          getsockopt(d_connect_fd, SOL_SOCKET, SO_ERROR, &err, &len);
+          if(err == 0) {
+            d_conn_fd = d_connect_fd;
+            d_connect_fd = -1;
+            setup_peer(d_conn_fd);
+            return true;
+          }
+          ::close(d_connect_fd);
+          d_connect_fd = -1;
+        }
+        return false;
+      }
+
+      start_connect();
+      return d_conn_fd >= 0;
+    }
+
+    bool
+    tcp_sink_impl::send_all(const char *buf, size_t nbytes)
+    {
+      while(nbytes > 0) {
+        ssize_t n = send(d_conn_fd, buf, nbytes, MSG_NOSIGNAL);
+        if(n < 0) {
+          if(errno == EINTR)
+            continue;
+          drop_peer();
+          return false;
+        }
+        buf += n;
+        nbytes -= n;
+      }
+      return true;
+    }
+
+    int
+    tcp_sink_impl::work(int noutput_items,
+                        gr_vector_const_void_star &input_items,
+                        gr_vector_void_star &output_items)
+    {
+      const char *in = (const char*)input_items[0];
+
+      // never stall the flowgraph on a missing peer: like file_sink
+      // with a closed file, unconnected input goes on the floor
+      if(!ensure_connected())
+        return noutput_items;
+
+      if(!d_framed) {
+        send_all(in, (size_t)noutput_items * d_itemsize);
+        return noutput_items;
+      }
+
+      std::vector<tag_t> tags;
+      get_tags_in_range(tags, 0, nitems_read(0),
+                        nitems_read(0) + noutput_items,
+                        pmt::intern("packet_len"));
+
+      uint64_t base = nitems_read(0);
+      size_t next_tag = 0;
+      int item = 0;
+
+      while(item < noutput_items) {
+        if(d_payload_left == 0) {
+          // skip tags behind us (shouldn't happen, but stay in sync)
+          while(next_tag < tags.size() &&
+                tags[next_tag].offset < base + item)
+            next_tag++;
+
+          if(next_tag < tags.size() &&
+             tags[next_tag].offset == base + item) {
+            uint32_t len =
+              (uint32_t)pmt::to_long(tags[next_tag].value) * d_itemsize;
+            unsigned char hdr[4];
+            hdr[0] = len & 0xff;
+            hdr[1] = (len >> 8) & 0xff;
+            hdr[2] = (len >> 16) & 0xff;
+            hdr[3] = (len >> 24) & 0xff;
+            if(!send_all((const char*)hdr, 4))
+              return noutput_items;
+            d_payload_left = len;
+            next_tag++;
+          }
+          else {
+            // untagged span: send raw up to the next tag
+            size_t span = noutput_items - item;
+            if(next_tag < tags.size())
+              span = tags[next_tag].offset - (base + item);
+            send_all(in + (size_t)item * d_itemsize, span * d_itemsize);
+            item += span;
+            continue;
+          }
+        }
+
+        size_t n = std::min(d_payload_left,
+                            (size_t)(noutput_items - item) * d_itemsize);
+        if(!send_all(in + (size_t)item * d_itemsize, n))
+          return noutput_items;
+        d_payload_left -= n;
+        item += n / d_itemsize;
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
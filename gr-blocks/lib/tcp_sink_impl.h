@@ -0,0 +1,72 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_TCP_SINK_IMPL_H
+#define INCLUDED_GR_TCP_SINK_IMPL_H
+
+#include <gnuradio/blocks/tcp_sink.h>
+#include <string>
+
+namespace gr {
+  namespace blocks {
+
+    class tcp_sink_impl : public tcp_sink
+    {
+    private:
+      size_t d_itemsize;
+      std::string d_host;
+      unsigned short d_port;
+      bool d_server;
+      bool d_nodelay;
+      bool d_framed;
+
+      int d_listen_fd;      // server mode, -1 otherwise
+      int d_connect_fd;     // client connect in flight, -1 otherwise
+      int d_conn_fd;        // established connection, -1 otherwise
+
+      // framed mode: payload bytes left in the packet being sent,
+      // so packets may span work calls
+      size_t d_payload_left;
+
+      //! progress the non-blocking accept/connect; true when connected
+      bool ensure_connected();
+      void start_connect();
+      void setup_peer(int fd);
+      void drop_peer();
+      //! blocking send of the whole buffer; false on connection loss
+      bool send_all(const char *buf, size_t nbytes);
+
+    public:
+      tcp_sink_impl(size_t itemsize,
+                    const std::string &host, int port,
+                    bool server, bool nodelay, bool framed);
+      ~tcp_sink_impl();
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_TCP_SINK_IMPL_H */
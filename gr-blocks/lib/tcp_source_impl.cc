@@ -0,0 +1,454 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tcp_source_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <poll.h>
+#endif
+
+namespace gr {
+  namespace blocks {
+
+    static const int WAIT_MS = 100;         // wakeup period of the rx thread
+    static const int RETRY_TICKS = 5;       // wait slots between connects
+
+    static void
+    set_nonblock(int fd)
+    {
+      int flags = fcntl(fd, F_GETFL, 0);
+      fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    }
+
+    static bool
+    resolve(const std::string &host, unsigned short port,
+            struct sockaddr_in *addr)
+    {
+      memset(addr, 0, sizeof(*addr));
+      addr->sin_family = AF_INET;
+      addr->sin_port = htons(port);
+
+      if(host.empty() || host == "0.0.0.0") {
+        addr->sin_addr.s_addr = htonl(INADDR_ANY);
+        return true;
+      }
+
+      struct addrinfo hints, *res = 0;
+      memset(&hints, 0, sizeof(hints));
+      hints.ai_family = AF_INET;
+      hints.ai_socktype = SOCK_STREAM;
+      if(getaddrinfo(host.c_str(), NULL, &hints, &res) != 0 || !res)
+        return false;
+      addr->sin_addr = ((struct sockaddr_in*)res->ai_addr)->sin_addr;
+      freeaddrinfo(res);
+      return true;
+    }
+
+    tcp_source::sptr
+    tcp_source::make(size_t itemsize,
+                     const std::string &host, int port,
+                     bool server, bool quickack, bool framed)
+    {
+      return gnuradio::get_initial_sptr
+        (new tcp_source_impl(itemsize, host, port, server, quickack, framed));
+    }
+
+    tcp_source_impl::tcp_source_impl(size_t itemsize,
+                                     const std::string &host, int port,
+                                     bool server, bool quickack, bool framed)
+      : sync_block("tcp_source",
+                      io_signature::make(0, 0, 0),
+                      io_signature::make(1, 1, itemsize)),
+        d_itemsize(itemsize), d_host(host),
+        d_port(static_cast<unsigned short>(port)),
+        d_server(server), d_quickack(quickack), d_framed(framed),
+        d_listen_fd(-1), d_connect_fd(-1), d_conn_fd(-1),
+        d_head(0), d_fill(0), d_rx_exit(false),
+        d_retry_ticks(0), d_frame_left(0)
+    {
+      d_ring = new char[RING_BYTES];
+
+#ifdef __linux__
+      d_epfd = epoll_create(4);
+      if(d_epfd < 0)
+        throw std::runtime_error("tcp_source: epoll_create failed");
+#endif
+
+      if(d_server) {
+        struct sockaddr_in addr;
+        if(!resolve(d_host, d_port, &addr))
+          throw std::runtime_error("tcp_source: can't resolve bind address");
+
+        d_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        if(d_listen_fd < 0)
+          throw std::runtime_error("tcp_source: socket failed");
+
+        int one = 1;
+        setsockopt(d_listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if(bind(d_listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+           listen(d_listen_fd, 1) < 0) {
+          ::close(d_listen_fd);
+          throw std::runtime_error("tcp_source: can't listen on port");
+        }
+        set_nonblock(d_listen_fd);
+        watch(d_listen_fd, false);
+      }
+
+      d_rx_thread = gr::thread::thread(
+        boost::bind(&tcp_source_impl::rx_loop, this));
+    }
+
+    tcp_source_impl::~tcp_source_impl()
+    {
+      {
+        gr::thread::scoped_lock lock(d_ring_mutex);
+        d_rx_exit = true;
+        d_space_cond.notify_all();
+      }
+      d_rx_thread.join();
+
+      if(d_conn_fd >= 0)
+        ::close(d_conn_fd);
+      if(d_connect_fd >= 0)
+        ::close(d_connect_fd);
+      if(d_listen_fd >= 0)
+        ::close(d_listen_fd);
+#ifdef __linux__
+      ::close(d_epfd);
+#endif
+      delete [] d_ring;
+    }
+
+    void
+    tcp_source_impl::watch(int fd, bool for_write)
+    {
+#ifdef __linux__
+      struct epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = for_write ? EPOLLOUT : EPOLLIN;
+      ev.data.fd = fd;
+      epoll_ctl(d_epfd, EPOLL_CTL_ADD, fd, &ev);
+#else
+      (void)fd;
+      (void)for_write;  // the poll() path rebuilds its set every wait
+#endif
+    }
+
+    void
+    tcp_source_impl::unwatch(int fd)
+    {
+#ifdef __linux__
+      epoll_ctl(d_epfd, EPOLL_CTL_DEL, fd, NULL);
+#else
+      (void)fd;
+#endif
+    }
+
+    void
+    tcp_source_impl::start_connect()
+    {
+      struct sockaddr_in addr;
+      if(!resolve(d_host, d_port, &addr)) {
+        d_retry_ticks = RETRY_TICKS;
+        return;
+      }
+
+      int fd = socket(AF_INET, SOCK_STREAM, 0);
+      if(fd < 0) {
+        d_retry_ticks = RETRY_TICKS;
+        return;
+      }
+      set_nonblock(fd);
+
+      if(connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+        d_conn_fd = fd;
+        setup_peer(fd);
+        watch(fd, false);
+      }
+      else if(errno == EINPROGRESS) {
+        d_connect_fd = fd;
+        watch(fd, true);
+      }
+      else {
+        ::close(fd);
+        d_retry_ticks = RETRY_TICKS;
+      }
+    }
+
+    void
+    tcp_source_impl::setup_peer(int fd)
+    {
+      int one = 1;
+      set_nonblock(fd);
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+#ifdef TCP_QUICKACK
+      if(d_quickack)
+        setsockopt(fd, IPPROTO_TCP, TCP_QUICKACK, &one, sizeof(one));
+#endif
+    }
+
+    void
+    tcp_source_impl::drop_peer()
+    {
+      if(d_conn_fd >= 0) {
+        unwatch(d_conn_fd);
+        ::close(d_conn_fd);
+        d_conn_fd = -1;
+      }
+    }
+
+    void
+    tcp_source_impl::advance_connection(int ready_fd)
+    {
+      if(ready_fd == d_listen_fd) {
+        int fd = accept(d_listen_fd, NULL, NULL);
+        if(fd < 0)
+          return;
+        drop_peer();        // one peer at a time; newest wins
+        d_conn_fd = fd;
+        setup_peer(fd);
+        watch(fd, false);
+      }
+      else if(ready_fd == d_connect_fd) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        getsockopt(d_connect_fd, SOL_SOCKET, SO_ERROR, &err, &len);
+        unwatch(d_connect_fd);
+        if(err == 0) {
+          d_conn_fd = d_connect_fd;
+          d_connect_fd = -1;
+          setup_peer(d_conn_fd);
+          watch(d_conn_fd, false);
+        }
+        else {
+          ::close(d_connect_fd);
+          d_connect_fd = -1;
+          d_retry_ticks = RETRY_TICKS;
+        }
+      }
+      else if(ready_fd == d_conn_fd) {
+        drain_socket();
+      }
+    }
+
+    void
+    tcp_source_impl::drain_socket()
+    {
+      while(1) {
+        size_t fill, tail;
+        {
+          gr::thread::scoped_lock lock(d_ring_mutex);
+          fill = d_fill;
+          tail = (d_head + d_fill) % RING_BYTES;
+        }
+        if(fill == RING_BYTES)
+          return;             // full; flow control does the rest
+
+        // largest contiguous span; work() only ever shrinks d_fill, so
+        // a stale snapshot just under-estimates the space
+        size_t span = std::min(RING_BYTES - fill, RING_BYTES - tail);
+
+        ssize_t n = recv(d_conn_fd, d_ring + tail, span, 0);
+        if(n > 0) {
+          gr::thread::scoped_lock lock(d_ring_mutex);
+          d_fill += n;
+          d_data_cond.notify_one();
+          if((size_t)n < span)
+            break;            // socket drained
+        }
+        else if(n == 0) {
+          drop_peer();        // orderly shutdown by the peer
+          return;
+        }
+        else {
+          if(errno == EINTR)
+            continue;
+          if(errno != EAGAIN && errno != EWOULDBLOCK)
+            drop_peer();
+          break;
+        }
+      }
+
+#ifdef TCP_QUICKACK
+      // Linux resets QUICKACK after acks go out; re-arm it per read
+      // batch so ours never wait on the delayed-ack timer.
+      if(d_quickack && d_conn_fd >= 0) {
+        int one = 1;
+        setsockopt(d_conn_fd, IPPROTO_TCP, TCP_QUICKACK, &one, sizeof(one));
+      }
+#endif
+    }
+
+    void
+    tcp_source_impl::rx_loop()
+    {
+      while(1) {
+        {
+          gr::thread::scoped_lock lock(d_ring_mutex);
+          if(d_rx_exit)
+            return;
+          if(d_fill == RING_BYTES) {
+            // ring full: a level-triggered wait on the socket would
+            // spin, so wait for work() to make room instead
+            d_space_cond.timed_wait(lock,
+              boost::posix_time::milliseconds(WAIT_MS));
+            continue;
+          }
+        }
+
+        if(!d_server && d_conn_fd < 0 && d_connect_fd < 0) {
+          if(d_retry_ticks > 0) {
+            d_retry_ticks--;
+            boost::this_thread::sleep(
+              boost::posix_time::milliseconds(WAIT_MS));
+            continue;
+          }
+          start_connect();
+        }
+
+#ifdef __linux__
+        struct epoll_event evs[4];
+        int n = epoll_wait(d_epfd, evs, 4, WAIT_MS);
+        for(int i = 0; i < n; i++)
+          advance_connection(evs[i].data.fd);
+#else
+        struct pollfd pfds[2];
+        int npfd = 0;
+        if(d_listen_fd >= 0) {
+          pfds[npfd].fd = d_listen_fd;
+          pfds[npfd].events = POLLIN;
+          npfd++;
+        }
+        if(d_connect_fd >= 0) {
+          pfds[npfd].fd = d_connect_fd;
+          pfds[npfd].events = POLLOUT;
+          npfd++;
+        }
+        else if(d_conn_fd >= 0) {
+          pfds[npfd].fd = d_conn_fd;
+          pfds[npfd].events = POLLIN;
+          npfd++;
+        }
+        if(npfd == 0) {
+          boost::this_thread::sleep(
+            boost::posix_time::milliseconds(WAIT_MS));
+          continue;
+        }
+        int n = poll(pfds, npfd, WAIT_MS);
+        for(int i = 0; n > 0 && i < npfd; i++)
+          if(pfds[i].revents)
+            advance_connection(pfds[i].fd);
+#endif
+      }
+    }
+
+    // d_ring_mutex must be held
+    size_t
+    tcp_source_impl::take_bytes(char *dst, size_t nbytes)
+    {
+      size_t first = std::min(nbytes, RING_BYTES - d_head);
+      memcpy(dst, d_ring + d_head, first);
+      if(first < nbytes)
+        memcpy(dst + first, d_ring, nbytes - first);
+      d_head = (d_head + nbytes) % RING_BYTES;
+      d_fill -= nbytes;
+      return nbytes;
+    }
+
+    int
+    tcp_source_impl::work(int noutput_items,
+                          gr_vector_const_void_star &input_items,
+                          gr_vector_void_star &output_items)
+    {
+      char *out = (char*)output_items[0];
+      size_t max_bytes = (size_t)noutput_items * d_itemsize;
+
+      gr::thread::scoped_lock lock(d_ring_mutex);
+      if(d_fill == 0)
+        d_data_cond.timed_wait(lock, boost::posix_time::milliseconds(10));
+
+      size_t nout = 0;
+
+      if(!d_framed) {
+        size_t n = std::min(max_bytes, d_fill);
+        n -= n % d_itemsize;
+        if(n)
+          take_bytes(out, n);
+        nout = n;
+      }
+      else {
+        while(nout < max_bytes) {
+          if(d_frame_left == 0) {
+            if(d_fill < 4)
+              break;
+            unsigned char hdr[4];
+            take_bytes((char*)hdr, 4);
+            uint32_t len = (uint32_t)hdr[0] | ((uint32_t)hdr[1] << 8)
+              | ((uint32_t)hdr[2] << 16) | ((uint32_t)hdr[3] << 24);
+            if(len == 0 || len % d_itemsize != 0)
+              throw std::runtime_error(
+                "tcp_source: bad frame header; framed stream out of sync");
+
+            add_item_tag(0, nitems_written(0) + nout / d_itemsize,
+                         pmt::intern("packet_len"),
+                         pmt::from_long(len / d_itemsize));
+            d_frame_left = len;
+          }
+
+          size_t n = std::min(d_frame_left, max_bytes - nout);
+          n = std::min(n, d_fill);
+          n -= n % d_itemsize;
+          if(n == 0)
+            break;
+          take_bytes(out + nout, n);
+          nout += n;
+          d_frame_left -= n;
+        }
+      }
+
+      if(nout)
+        d_space_cond.notify_one();
+
+      return nout / d_itemsize;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,96 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GR_TCP_SOURCE_IMPL_H
+#define INCLUDED_GR_TCP_SOURCE_IMPL_H
+
+#include <gnuradio/blocks/tcp_source.h>
+#include <gnuradio/thread/thread.h>
+#include <string>
+
+namespace gr {
+  namespace blocks {
+
+    class tcp_source_impl : public tcp_source
+    {
+    private:
+      size_t d_itemsize;
+      std::string d_host;
+      unsigned short d_port;
+      bool d_server;
+      bool d_quickack;
+      bool d_framed;
+
+      int d_listen_fd;      // server mode, -1 otherwise
+      int d_connect_fd;     // client connect in flight, -1 otherwise
+      int d_conn_fd;        // established connection, -1 otherwise
+#ifdef __linux__
+      int d_epfd;
+#endif
+
+      // Byte ring the receiver thread fills with large recv()s and
+      // work() drains.  When it fills, the receiver simply stops
+      // reading and TCP flow control pushes back on the sender.
+      static const size_t RING_BYTES = 4 << 20;
+      char   *d_ring;
+      size_t  d_head;       // next byte work() takes
+      size_t  d_fill;       // bytes in the ring
+      bool    d_rx_exit;
+      int     d_retry_ticks;  // wait slots before the next connect attempt
+
+      // framing state: payload bytes left in the packet being emitted
+      size_t  d_frame_left;
+
+      gr::thread::mutex d_ring_mutex;
+      gr::thread::condition_variable d_data_cond;   // ring went non-empty
+      gr::thread::condition_variable d_space_cond;  // ring went non-full
+      gr::thread::thread d_rx_thread;
+
+      void rx_loop();
+      void watch(int fd, bool for_write);
+      void unwatch(int fd);
+      //! accept / finish connect / retry, depending on mode and state
+      void advance_connection(int ready_fd);
+      void start_connect();
+      void setup_peer(int fd);
+      void drop_peer();
+      //! recv into the ring until EAGAIN or the ring is full
+      void drain_socket();
+
+      //! take up to nbytes out of the ring; ring mutex must be held
+      size_t take_bytes(char *dst, size_t nbytes);
+
+    public:
+      tcp_source_impl(size_t itemsize,
+                      const std::string &host, int port,
+                      bool server, bool quickack, bool framed);
+      ~tcp_source_impl();
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_TCP_SOURCE_IMPL_H */
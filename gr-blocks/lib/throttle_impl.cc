@@ -27,7 +27,12 @@
 #include "throttle_impl.h"
 #include <gnuradio/io_signature.h>
 #include <cstring>
+#include <algorithm>
 #include <boost/thread/thread.hpp>
+#ifdef __linux__
+#include <time.h>
+#include <errno.h>
+#endif
 
 pmt::pmt_t throttle_rx_rate_pmt(pmt::intern("rx_rate"));
 
@@ -48,7 +53,9 @@ namespace gr {
                       io_signature::make(1, 1, itemsize),
                       io_signature::make(1, 1, itemsize)),
         d_itemsize(itemsize),
-        d_ignore_tags(ignore_tags)
+        d_ignore_tags(ignore_tags),
+        d_precise(false),
+        d_granularity(0)
     {
       set_sample_rate(samples_per_second);
     }
@@ -65,6 +72,11 @@ namespace gr {
       d_total_samples = 0;
       d_samps_per_tick = rate/boost::posix_time::time_duration::ticks_per_second();
       d_samps_per_us = rate/1e6;
+#ifdef __linux__
+      struct timespec now;
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      d_start_ns = (uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec;
+#endif
     }
 
     double
@@ -73,6 +85,38 @@ namespace gr {
       return d_samps_per_us * 1e6;
     }
 
+    void
+    throttle_impl::set_precision_pacing(bool enable, int granularity)
+    {
+      d_precise = enable;
+      if(granularity > 0)
+        d_granularity = granularity;
+      else  // default to chunks of about 10 ms worth of samples
+        d_granularity = std::max(1, (int)(sample_rate() / 100));
+
+      // restart the deadline sequence from here
+      set_sample_rate(sample_rate());
+    }
+
+    double
+    throttle_impl::achieved_sample_rate() const
+    {
+#ifdef __linux__
+      struct timespec now;
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      uint64_t now_ns = (uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec;
+      if(now_ns <= d_start_ns)
+        return 0;
+      return d_total_samples / ((now_ns - d_start_ns)/1e9);
+#else
+      boost::int64_t ticks = (boost::get_system_time() - d_start).ticks();
+      if(ticks <= 0)
+        return 0;
+      return d_total_samples *
+        (double)boost::posix_time::time_duration::ticks_per_second() / ticks;
+#endif
+    }
+
     int
     throttle_impl::work(int noutput_items,
                         gr_vector_const_void_star &input_items,
@@ -92,6 +136,33 @@ namespace gr {
           }
         }
 
+      const char *in = (const char *)input_items[0];
+      char *out = (char *)output_items[0];
+
+      if(d_precise) {
+        // Release one chunk, sleeping first to the absolute deadline
+        // of the samples already released; the deadline is computed
+        // from the total count, so sleep overshoot never accumulates
+        int n = std::min(noutput_items, d_granularity);
+        double t = d_total_samples / sample_rate();  // seconds since start
+
+#ifdef __linux__
+        uint64_t ns = d_start_ns + (uint64_t)(t*1e9);
+        struct timespec deadline;
+        deadline.tv_sec = ns / 1000000000ULL;
+        deadline.tv_nsec = ns % 1000000000ULL;
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+          ;
+#else
+        boost::this_thread::sleep(d_start + boost::posix_time::microseconds
+                                  ((long long)(t*1e6)));
+#endif
+
+        std::memcpy(out, in, n * d_itemsize);
+        d_total_samples += n;
+        return n;
+      }
+
       //calculate the expected number of samples to have passed through
       boost::system_time now = boost::get_system_time();
       boost::int64_t ticks = (now - d_start).ticks();
@@ -104,8 +175,6 @@ namespace gr {
       }
 
       //copy all samples output[i] <= input[i]
-      const char *in = (const char *)input_items[0];
-      char *out = (char *)output_items[0];
       std::memcpy(out, in, noutput_items * d_itemsize);
       d_total_samples += noutput_items;
       return noutput_items;
@@ -128,6 +197,13 @@ namespace gr {
             pmt::mp(0.0), pmt::mp(100.0e6), pmt::mp(0.0),
             "Hz", "Sample Rate", RPC_PRIVLVL_MIN,
             DISPTIME | DISPOPTSTRIP)));
+
+      d_rpc_vars.push_back(
+        rpcbasic_sptr(new rpcbasic_register_get<throttle, double>(
+            alias(), "achieved_sample_rate", &throttle::achieved_sample_rate,
+            pmt::mp(0.0), pmt::mp(100.0e6), pmt::mp(0.0),
+            "Hz", "Achieved Sample Rate", RPC_PRIVLVL_MIN,
+            DISPTIME | DISPOPTSTRIP)));
 #endif /* GR_CTRLPORT */
     }
 
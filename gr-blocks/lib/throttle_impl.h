@@ -37,6 +37,16 @@ namespace gr {
       double d_samps_per_tick, d_samps_per_us;
       bool d_ignore_tags;
 
+      // Precision pacing: sleep to absolute deadlines derived from
+      // the total sample count so timing errors never accumulate,
+      // and release samples in fixed chunks so the output is smooth
+      // rather than bursty.
+      bool     d_precise;
+      int      d_granularity;   // items per released chunk
+#ifdef __linux__
+      uint64_t d_start_ns;      // monotonic clock at last rate change
+#endif
+
     public:
       throttle_impl(size_t itemsize, double samples_per_sec, bool ignore_tags=true);
       ~throttle_impl();
@@ -46,6 +56,9 @@ namespace gr {
       void set_sample_rate(double rate);
       double sample_rate() const;
 
+      void set_precision_pacing(bool enable, int granularity=0);
+      double achieved_sample_rate() const;
+
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
                gr_vector_void_star &output_items);
@@ -21,6 +21,7 @@
  */
 
 #include "transcendental_impl.h"
+#include "fast_math.h"
 #include <gnuradio/io_signature.h>
 #include <stdexcept>
 #include <complex> //complex math
@@ -108,6 +109,30 @@ namespace gr {
     REGISTER_FUNCTIONS(log10)
     REGISTER_FUNCTIONS(sqrt)
 
+    //macro for the approximate single-precision variants from
+    //fast_math.h; registered under "fast_<fcn>" so callers opt in
+    //explicitly to the reduced accuracy
+#define REGISTER_FAST_FUNCTION(__fcn__)                                 \
+    static int fast_ ## __fcn__ ## _float_work(                         \
+        int noutput_items,                                              \
+        gr_vector_const_void_star &input_items,                         \
+        gr_vector_void_star &output_items)                              \
+    {                                                                   \
+      const float *in = (const float *) input_items[0];                 \
+      float *out = (float *) output_items[0];                           \
+      for (size_t i = 0; i < size_t(noutput_items); i++){               \
+        out[i] = fast_ ## __fcn__(in[i]);                               \
+      }                                                                 \
+      return noutput_items;                                             \
+    }                                                                   \
+    transcendental_registrant fast_ ## __fcn__ ## _float_registrant("fast_" #__fcn__ "_float", &fast_ ## __fcn__ ## _float_work, sizeof(float));
+
+    REGISTER_FAST_FUNCTION(exp)
+    REGISTER_FAST_FUNCTION(log)
+    REGISTER_FAST_FUNCTION(log2)
+    REGISTER_FAST_FUNCTION(log10)
+    REGISTER_FAST_FUNCTION(exp2)
+
 
     transcendental::sptr
     transcendental::make(const std::string &name,
@@ -0,0 +1,224 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "udp_pdu_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/blocks/pdu.h>
+#include <boost/format.hpp>
+#include <stdexcept>
+
+#if (defined(linux) || defined(__linux) || defined(__linux__))
+#include <sys/select.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#endif
+
+namespace gr {
+  namespace blocks {
+
+    udp_pdu::sptr
+    udp_pdu::make(std::string addr, std::string port,
+                  int MTU, unsigned int batch)
+    {
+#if (defined(linux) || defined(__linux) || defined(__linux__))
+      return gnuradio::get_initial_sptr(new udp_pdu_impl(addr, port, MTU, batch));
+#else
+      throw std::runtime_error("udp_pdu not implemented on this platform");
+#endif
+    }
+
+#if (defined(linux) || defined(__linux) || defined(__linux__))
+
+    static const long timeout_us = 100*1000; //100ms
+
+    udp_pdu_impl::udp_pdu_impl(std::string addr, std::string port,
+                               int MTU, unsigned int batch)
+      :	block("udp_pdu",
+              io_signature::make(0, 0, 0),
+              io_signature::make(0, 0, 0)),
+	d_fd(-1),
+	d_mtu(MTU),
+	d_batch(batch),
+	d_started(false),
+	d_finished(false),
+	d_last_addrlen(0)
+    {
+      if (MTU <= 0)
+        throw std::invalid_argument("udp_pdu: MTU must be > 0");
+      if (batch < 1)
+        throw std::invalid_argument("udp_pdu: batch must be >= 1");
+
+      // resolve and bind the local endpoint
+      struct addrinfo hints;
+      struct addrinfo *res = NULL;
+      memset(&hints, 0, sizeof(hints));
+      hints.ai_family = AF_UNSPEC;
+      hints.ai_socktype = SOCK_DGRAM;
+      hints.ai_flags = AI_PASSIVE;
+
+      int err = getaddrinfo(addr.empty() ? NULL : addr.c_str(),
+                            port.c_str(), &hints, &res);
+      if (err != 0)
+        throw std::runtime_error(str(boost::format("gr::udp_pdu: getaddrinfo failed (%s)")
+                                     % gai_strerror(err)));
+
+      d_fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+      if (d_fd < 0) {
+        freeaddrinfo(res);
+        throw std::runtime_error("gr::udp_pdu: socket failed");
+      }
+
+      int reuse = 1;
+      setsockopt(d_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+      if (bind(d_fd, res->ai_addr, res->ai_addrlen) != 0) {
+        close(d_fd);
+        freeaddrinfo(res);
+        throw std::runtime_error("gr::udp_pdu: bind failed");
+      }
+      freeaddrinfo(res);
+
+      d_rxbuf.resize((size_t)d_batch * d_mtu);
+
+      // set up output message port and reader thread
+      message_port_register_out(PDU_PORT_ID);
+      d_thread = gr::thread::thread(boost::bind(&udp_pdu_impl::run, this));
+      d_started = true;
+
+      // set up input message port
+      message_port_register_in(PDU_PORT_ID);
+      set_msg_handler(PDU_PORT_ID, boost::bind(&udp_pdu_impl::send, this, _1));
+    }
+
+    udp_pdu_impl::~udp_pdu_impl()
+    {
+      d_finished = true;
+
+      if (d_started) {
+        d_thread.interrupt();
+        d_thread.join();
+      }
+
+      if (d_fd >= 0)
+        close(d_fd);
+    }
+
+    bool
+    udp_pdu_impl::wait_ready()
+    {
+      timeval tv;
+      tv.tv_sec = 0;
+      tv.tv_usec = timeout_us;
+
+      fd_set rset;
+      FD_ZERO(&rset);
+      FD_SET(d_fd, &rset);
+
+      return ::select(d_fd+1, &rset, NULL, NULL, &tv) > 0;
+    }
+
+    void
+    udp_pdu_impl::run()
+    {
+      // per-datagram scatter/gather descriptors, set up once; every
+      // recvmmsg call refills msg_len and the source addresses in
+      // place
+      std::vector<struct mmsghdr> msgs(d_batch);
+      std::vector<struct iovec> iovs(d_batch);
+      std::vector<struct sockaddr_storage> addrs(d_batch);
+
+      memset(&msgs[0], 0, d_batch*sizeof(struct mmsghdr));
+      for (unsigned int i = 0; i < d_batch; i++) {
+        iovs[i].iov_base = &d_rxbuf[(size_t)i * d_mtu];
+        iovs[i].iov_len = d_mtu;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+      }
+
+      while (!d_finished) {
+        if (!wait_ready())
+          continue;
+
+        // drain everything queued up to one batch in a single
+        // syscall; the select above guarantees at least one datagram
+        const int n = recvmmsg(d_fd, &msgs[0], d_batch, MSG_DONTWAIT, NULL);
+        if (n <= 0) {
+          if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+            continue;
+          throw std::runtime_error("gr::udp_pdu: bad socket read!");
+        }
+
+        for (int i = 0; i < n; i++) {
+          pmt::pmt_t vector =
+            pdu::make_pdu_vector_pooled(pdu::byte_t,
+                                        &d_rxbuf[(size_t)i * d_mtu],
+                                        msgs[i].msg_len);
+          message_port_pub(PDU_PORT_ID, pmt::cons(pmt::PMT_NIL, vector));
+          // recvmmsg shrinks msg_namelen per datagram; restore it
+          msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+        }
+
+        // replies go to whoever we heard from last
+        gr::thread::scoped_lock guard(d_addr_mutex);
+        memcpy(&d_last_addr, &addrs[n-1], sizeof(d_last_addr));
+        d_last_addrlen = sizeof(struct sockaddr_storage);
+      }
+    }
+
+    void
+    udp_pdu_impl::send(pmt::pmt_t msg)
+    {
+      pmt::pmt_t vector = pmt::cdr(msg);
+      size_t offset(0);
+      size_t itemsize(pdu::itemsize(pdu::type_from_pmt(vector)));
+      int len(pmt::length(vector)*itemsize);
+
+      struct sockaddr_storage dest;
+      socklen_t destlen;
+      {
+        gr::thread::scoped_lock guard(d_addr_mutex);
+        if (d_last_addrlen == 0)
+          return;	// no remote heard from yet; nowhere to send
+        memcpy(&dest, &d_last_addr, sizeof(dest));
+        destlen = d_last_addrlen;
+      }
+
+      const int rv = sendto(d_fd, pmt::uniform_vector_elements(vector, offset),
+                            len, 0, (struct sockaddr *)&dest, destlen);
+      if (rv != len) {
+        std::cerr << boost::format("WARNING: udp_pdu::send(pdu) write failed! (d_fd=%d, len=%d, rv=%d)")
+          % d_fd % len % rv << std::endl;
+      }
+    }
+
+#endif /* linux */
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_BLOCKS_UDP_PDU_IMPL_H
+#define INCLUDED_BLOCKS_UDP_PDU_IMPL_H
+
+#include <gnuradio/blocks/udp_pdu.h>
+#include <gnuradio/thread/thread.h>
+
+#if (defined(linux) || defined(__linux) || defined(__linux__))
+#include <sys/socket.h>
+
+namespace gr {
+  namespace blocks {
+
+    class udp_pdu_impl : public udp_pdu
+    {
+    private:
+      int d_fd;
+      int d_mtu;
+      unsigned int d_batch;
+      bool d_started;
+      bool d_finished;
+      gr::thread::thread d_thread;
+
+      // one contiguous buffer carved into d_batch MTU-sized slots
+      std::vector<uint8_t> d_rxbuf;
+
+      // where replies go: the most recent remote sender
+      gr::thread::mutex d_addr_mutex;
+      struct sockaddr_storage d_last_addr;
+      socklen_t d_last_addrlen;
+
+      void run();
+      bool wait_ready();
+
+    public:
+      udp_pdu_impl(std::string addr, std::string port,
+                   int MTU, unsigned int batch);
+      ~udp_pdu_impl();
+
+      void send(pmt::pmt_t msg);
+    };
+
+  } /* namespace blocks */
+} /* namespace gr */
+
+#endif /* linux */
+
+#endif /* INCLUDED_BLOCKS_UDP_PDU_IMPL_H */
@@ -31,8 +31,12 @@
 #include <boost/format.hpp>
 #include <gnuradio/thread/thread.h>
 #include <stdexcept>
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef __linux__
+#include <sys/socket.h>
+#endif
 
 namespace gr {
   namespace blocks {
@@ -124,6 +128,46 @@ namespace gr {
 
       gr::thread::scoped_lock guard(d_mutex);  // protect d_socket
 
+#ifdef __linux__
+      if(d_connected) {
+        // Scatter-gather transmit: point an iovec at each
+        // payload-sized chunk of the input buffer and flush them in
+        // batches with sendmmsg, one syscall per batch instead of
+        // one per packet.
+        const int BATCH = 64;
+        struct mmsghdr msgs[BATCH];
+        struct iovec iovs[BATCH];
+        int fd = d_socket->native_handle();
+
+        ssize_t nchunks = (total_size + d_payload_size - 1) / d_payload_size;
+        ssize_t chunk = 0;
+        while(chunk < nchunks) {
+          int n = (int)std::min((ssize_t)BATCH, nchunks - chunk);
+          memset(msgs, 0, n*sizeof(msgs[0]));
+          for(int i = 0; i < n; i++) {
+            ssize_t off = (chunk + i)*d_payload_size;
+            iovs[i].iov_base = (void*)(in + off);
+            iovs[i].iov_len = std::min((ssize_t)d_payload_size, total_size - off);
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = d_endpoint.data();
+            msgs[i].msg_hdr.msg_namelen = d_endpoint.size();
+          }
+
+          int sent = sendmmsg(fd, msgs, n, 0);
+          if(sent < 0) {
+            GR_LOG_ERROR(d_logger, boost::format("send error: %s") % strerror(errno));
+            return -1;
+          }
+          // A short count just means the batch was cut off; resume
+          // at the first unsent packet
+          chunk += sent;
+        }
+
+        return noutput_items;
+      }
+#endif
+
       while(bytes_sent <  total_size) {
         bytes_to_send = std::min((ssize_t)d_payload_size, (total_size-bytes_sent));
 
@@ -31,6 +31,10 @@
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef __linux__
+#include <sys/socket.h>
+#include <poll.h>
+#endif
 
 namespace gr {
   namespace blocks {
@@ -38,26 +42,40 @@ namespace gr {
     udp_source::sptr
     udp_source::make(size_t itemsize,
                      const std::string &ipaddr, int port,
-                     int payload_size, bool eof)
+                     int payload_size, bool eof,
+                     int buffer_size)
     {
       return gnuradio::get_initial_sptr
         (new udp_source_impl(itemsize, ipaddr, port,
-                             payload_size, eof));
+                             payload_size, eof, buffer_size));
     }
 
     udp_source_impl::udp_source_impl(size_t itemsize,
                                      const std::string &host, int port,
-                                     int payload_size, bool eof)
+                                     int payload_size, bool eof,
+                                     int buffer_size)
       : sync_block("udp_source",
                       io_signature::make(0, 0, 0),
                       io_signature::make(1, 1, itemsize)),
         d_itemsize(itemsize), d_payload_size(payload_size),
-        d_eof(eof), d_connected(false), d_residual(0), d_sent(0), d_offset(0)
+        d_eof(eof), d_connected(false), d_buffer_size(buffer_size),
+        d_residual(0), d_sent(0), d_offset(0)
     {
       // Give us some more room to play.
       d_rxbuf = new char[4*d_payload_size];
       d_residbuf = new char[50*d_payload_size];
 
+#ifdef __linux__
+      d_ring = new char[RING_DEPTH*d_payload_size];
+      d_scratch = new char[RING_DEPTH*d_payload_size];
+      d_ring_len.resize(RING_DEPTH, 0);
+      d_ring_head = 0;
+      d_ring_tail = 0;
+      d_ring_offset = 0;
+      d_ndropped = 0;
+      d_rx_exit = false;
+#endif
+
       connect(host, port);
     }
 
@@ -68,6 +86,10 @@ namespace gr {
 
       delete [] d_rxbuf;
       delete [] d_residbuf;
+#ifdef __linux__
+      delete [] d_ring;
+      delete [] d_scratch;
+#endif
     }
 
     void
@@ -98,10 +120,21 @@ namespace gr {
         boost::asio::socket_base::reuse_address roption(true);
         d_socket->set_option(roption);
 
+        if(d_buffer_size > 0) {
+          boost::asio::socket_base::receive_buffer_size boption(d_buffer_size);
+          d_socket->set_option(boption);
+        }
+
         d_socket->bind(d_endpoint);
 
+#ifdef __linux__
+        // Batch packets straight into the receive ring with recvmmsg
+        d_rx_exit = false;
+        d_rx_thread = gr::thread::thread(boost::bind(&udp_source_impl::rx_loop, this));
+#else
         start_receive();
         d_udp_thread = gr::thread::thread(boost::bind(&udp_source_impl::run_io_service, this));
+#endif
         d_connected = true;
       }
     }
@@ -114,9 +147,14 @@ namespace gr {
       if(!d_connected)
         return;
 
+#ifdef __linux__
+      d_rx_exit = true;     // rx_loop polls with a timeout and notices
+      d_rx_thread.join();
+#else
       d_io_service.reset();
       d_io_service.stop();
       d_udp_thread.join();
+#endif
 
       d_socket->close();
       delete d_socket;
@@ -175,6 +213,89 @@ namespace gr {
       start_receive();
     }
 
+    uint64_t
+    udp_source_impl::ndropped() const
+    {
+#ifdef __linux__
+      return d_ndropped;
+#else
+      return 0;
+#endif
+    }
+
+#ifdef __linux__
+    void
+    udp_source_impl::rx_loop()
+    {
+      const int BATCH = 32;
+      int fd = d_socket->native_handle();
+      struct mmsghdr msgs[BATCH];
+      struct iovec iovs[BATCH];
+
+      while(!d_rx_exit) {
+        // Wait for data with a timeout so disconnect() can stop us
+        struct pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        if(poll(&pfd, 1, 100) <= 0)
+          continue;
+
+        int head, tail;
+        {
+          gr::thread::scoped_lock lock(d_udp_mutex);
+          head = d_ring_head;
+          tail = d_ring_tail;
+        }
+        int free_slots = RING_DEPTH - 1 - ((tail - head + RING_DEPTH) % RING_DEPTH);
+
+        // With the ring full, drain into the scratch buffer so the
+        // socket keeps flowing and the loss is counted
+        bool dropping = (free_slots == 0);
+        int n = dropping ? BATCH : std::min(free_slots, BATCH);
+
+        memset(msgs, 0, sizeof(msgs));
+        for(int i = 0; i < n; i++) {
+          if(dropping)
+            iovs[i].iov_base = d_scratch + i*d_payload_size;
+          else
+            iovs[i].iov_base = d_ring + ((tail + i) % RING_DEPTH)*d_payload_size;
+          iovs[i].iov_len = d_payload_size;
+          msgs[i].msg_hdr.msg_iov = &iovs[i];
+          msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int nrecv = recvmmsg(fd, msgs, n, MSG_DONTWAIT, NULL);
+        if(nrecv <= 0)
+          continue;
+
+        if(dropping) {
+          d_ndropped += nrecv;
+          continue;
+        }
+
+        int nfilled = 0;
+        for(int i = 0; i < nrecv; i++) {
+          int len = (int)msgs[i].msg_len;
+          int slot = (tail + nfilled) % RING_DEPTH;
+          if(d_eof && (len == 1) && (d_ring[slot*d_payload_size] == 0x00)) {
+            // EOF notification; mark the slot and stop filling
+            d_ring_len[slot] = -1;
+            nfilled++;
+            break;
+          }
+          d_ring_len[slot] = len;
+          nfilled++;
+        }
+
+        {
+          gr::thread::scoped_lock lock(d_udp_mutex);
+          d_ring_tail = (tail + nfilled) % RING_DEPTH;
+          d_cond_wait.notify_one();
+        }
+      }
+    }
+#endif
+
     int
     udp_source_impl::work(int noutput_items,
                           gr_vector_const_void_star &input_items,
@@ -184,6 +305,53 @@ namespace gr {
 
       char *out = (char*)output_items[0];
 
+#ifdef __linux__
+      int head, tail;
+      {
+        // Wait until the receiver has filled at least one slot; the
+        // timed wait keeps the work function interruptable
+        boost::unique_lock<boost::mutex> lock(d_udp_mutex);
+        if(d_ring_head == d_ring_tail)
+          d_cond_wait.timed_wait(lock, boost::posix_time::milliseconds(10));
+        head = d_ring_head;
+        tail = d_ring_tail;
+      }
+
+      // Drain filled slots directly into the output stream; the
+      // slots between head and tail are ours until we publish the
+      // new head below
+      int avail = noutput_items * (int)d_itemsize;
+      int nout = 0;
+      bool at_eof = false;
+      while((head != tail) && (nout < avail)) {
+        int len = d_ring_len[head];
+        if(len < 0) {
+          at_eof = true;
+          break;
+        }
+        int left = len - d_ring_offset;
+        int ncopy = std::min(left, avail - nout);
+        memcpy(out + nout, d_ring + head*d_payload_size + d_ring_offset, ncopy);
+        nout += ncopy;
+        if(ncopy == left) {
+          d_ring_offset = 0;
+          head = (head + 1) % RING_DEPTH;
+        }
+        else {
+          d_ring_offset += ncopy;
+        }
+      }
+
+      {
+        gr::thread::scoped_lock lock(d_udp_mutex);
+        d_ring_head = head;
+      }
+
+      if(at_eof && nout == 0)
+        return -1;
+
+      return nout / d_itemsize;
+#else
       // Use async receive_from to get data from UDP buffer and wait
       // on a conditional signal before proceeding. We use this
       // because the conditional wait is interruptable while a
@@ -212,8 +380,9 @@ namespace gr {
       else {
         d_sent += to_send;
       }
-      
+
       return nitems;
+#endif
     }
 
   } /* namespace blocks */
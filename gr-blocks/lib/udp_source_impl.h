@@ -27,6 +27,7 @@
 #include <boost/asio.hpp>
 #include <boost/format.hpp>
 #include <gnuradio/thread/thread.h>
+#include <vector>
 
 namespace gr {
   namespace blocks {
@@ -38,12 +39,33 @@ namespace gr {
       int     d_payload_size; // maximum transmission unit (packet length)
       bool    d_eof;          // look for an EOF signal
       bool    d_connected;    // are we connected?
+      int     d_buffer_size;  // socket receive buffer depth (bytes)
       char   *d_rxbuf;        // get UDP buffer items
       char   *d_residbuf;     // hold buffer between calls
       ssize_t d_residual;     // hold information about number of bytes stored in residbuf
       ssize_t d_sent;         // track how much of d_residbuf we've outputted
       size_t  d_offset;       // point to residbuf location offset
 
+#ifdef __linux__
+      // Preallocated ring of packet buffers. The receiver thread
+      // batches datagrams into free slots with recvmmsg and work()
+      // drains the filled slots straight into the output stream, so
+      // the only copy and the only lock are per work call rather
+      // than per packet. A slot length of -1 marks the EOF packet.
+      static const int RING_DEPTH = 256;
+      char            *d_ring;        // RING_DEPTH * d_payload_size bytes
+      char            *d_scratch;     // receive target while the ring is full
+      std::vector<int> d_ring_len;    // bytes held in each slot
+      int              d_ring_head;   // next slot work() drains
+      int              d_ring_tail;   // next slot the receiver fills
+      int              d_ring_offset; // bytes of the head slot already output
+      uint64_t         d_ndropped;    // packets dropped with the ring full
+      bool             d_rx_exit;
+      gr::thread::thread d_rx_thread;
+
+      void rx_loop();
+#endif
+
       std::string d_host;
       unsigned short d_port;
 
@@ -64,7 +86,8 @@ namespace gr {
     public:
       udp_source_impl(size_t itemsize,
                       const std::string &host, int port,
-                      int payload_size, bool eof);
+                      int payload_size, bool eof,
+                      int buffer_size);
       ~udp_source_impl();
 
       void connect(const std::string &host, int port);
@@ -72,6 +95,7 @@ namespace gr {
 
       int payload_size() { return d_payload_size; }
       int get_port();
+      uint64_t ndropped() const;
 
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
@@ -28,6 +28,7 @@
 #include <gnuradio/io_signature.h>
 #include <stdexcept>
 #include <iostream>
+#include <string.h>
 
 namespace gr {
   namespace blocks {
@@ -48,6 +49,12 @@ namespace gr {
     {
       if(d_k == 0)
         throw std::out_of_range("interpolation must be > 0");
+
+      for(int t = 0; t < 256; t++) {
+        for(int j = 0; j < 8; j++) {
+          d_table[t][j] = (t >> (7-j)) & 0x01;
+        }
+      }
     }
 
     unpack_k_bits_bb_impl::~unpack_k_bits_bb_impl()
@@ -63,10 +70,20 @@ namespace gr {
       unsigned char *out = (unsigned char *)output_items[0];
   
       int n = 0;
-      for(unsigned int i = 0; i < noutput_items/d_k; i++) {
-        unsigned int t = in[i];
-        for(int j = d_k - 1; j >= 0; j--)
-          out[n++] = (t >> j) & 0x01;
+      if(d_k <= 8) {
+        // Table-driven: one lookup and a short copy per input byte;
+        // the low k bits of a byte are the last k entries of its row.
+        for(unsigned int i = 0; i < noutput_items/d_k; i++) {
+          memcpy(&out[n], &d_table[in[i]][8-d_k], d_k);
+          n += d_k;
+        }
+      }
+      else {
+        for(unsigned int i = 0; i < noutput_items/d_k; i++) {
+          unsigned int t = in[i];
+          for(int j = d_k - 1; j >= 0; j--)
+            out[n++] = (t >> j) & 0x01;
+        }
       }
 
       assert(n == noutput_items);
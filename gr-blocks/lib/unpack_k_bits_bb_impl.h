@@ -32,6 +32,7 @@ namespace gr {
     {
     private:
       unsigned d_k;    // number of relevent bits to unpack into k output bytes
+      unsigned char d_table[256][8];  // byte -> its eight bits, MSB first
 
     public:
       unpack_k_bits_bb_impl(unsigned k);
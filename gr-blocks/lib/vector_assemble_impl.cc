@@ -0,0 +1,97 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "vector_assemble_impl.h"
+#include <gnuradio/io_signature.h>
+#include <string.h>
+#include <stdexcept>
+
+namespace gr {
+  namespace blocks {
+
+    static int
+    sum_vlens(const std::vector<int> &vlens)
+    {
+      int sum = 0;
+      for(size_t i = 0; i < vlens.size(); i++)
+        sum += vlens[i];
+      return sum;
+    }
+
+    static std::vector<int>
+    scaled_sizes(const std::vector<int> &vlens, size_t itemsize)
+    {
+      std::vector<int> sizes(vlens.size());
+      for(size_t i = 0; i < vlens.size(); i++)
+        sizes[i] = vlens[i] * itemsize;
+      return sizes;
+    }
+
+    vector_assemble::sptr
+    vector_assemble::make(size_t itemsize, const std::vector<int> &vlens)
+    {
+      return gnuradio::get_initial_sptr
+        (new vector_assemble_impl(itemsize, vlens));
+    }
+
+    vector_assemble_impl::vector_assemble_impl(size_t itemsize,
+                                               const std::vector<int> &vlens)
+      : sync_block("vector_assemble",
+                   io_signature::makev(vlens.size(), vlens.size(),
+                                       scaled_sizes(vlens, itemsize)),
+                   io_signature::make(1, 1, sum_vlens(vlens) * itemsize)),
+        d_itemsize(itemsize),
+        d_vlens(vlens)
+    {
+      if(vlens.empty())
+        throw std::invalid_argument("vector_assemble: need at least one input");
+      for(size_t i = 0; i < vlens.size(); i++) {
+        if(vlens[i] < 1)
+          throw std::invalid_argument("vector_assemble: vector lengths must be >= 1");
+      }
+    }
+
+    int
+    vector_assemble_impl::work(int noutput_items,
+                               gr_vector_const_void_star &input_items,
+                               gr_vector_void_star &output_items)
+    {
+      const char **inv = (const char**)&input_items[0];
+      char *out = (char*)output_items[0];
+
+      for(int i = 0; i < noutput_items; i++) {
+        for(size_t j = 0; j < d_vlens.size(); j++) {
+          size_t nbytes = d_vlens[j] * d_itemsize;
+          memcpy(out, inv[j] + i * nbytes, nbytes);
+          out += nbytes;
+        }
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
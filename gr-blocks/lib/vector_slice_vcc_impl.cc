@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "vector_slice_vcc_impl.h"
+#include <gnuradio/io_signature.h>
+#include <string.h>
+#include <stdexcept>
+
+namespace gr {
+  namespace blocks {
+
+    vector_slice_vcc::sptr
+    vector_slice_vcc::make(size_t vlen_in, size_t start, size_t end)
+    {
+      return gnuradio::get_initial_sptr
+        (new vector_slice_vcc_impl(vlen_in, start, end));
+    }
+
+    vector_slice_vcc_impl::vector_slice_vcc_impl(size_t vlen_in,
+                                                 size_t start, size_t end)
+      : sync_block("vector_slice_vcc",
+                   io_signature::make(1, 1, vlen_in * sizeof(gr_complex)),
+                   io_signature::make(1, 1, (end - start) * sizeof(gr_complex))),
+        d_vlen_in(vlen_in),
+        d_start(start),
+        d_vlen_out(end - start)
+    {
+      if(start >= end || end > vlen_in)
+        throw std::invalid_argument("vector_slice_vcc: need 0 <= start < end <= vlen_in");
+    }
+
+    int
+    vector_slice_vcc_impl::work(int noutput_items,
+                                gr_vector_const_void_star &input_items,
+                                gr_vector_void_star &output_items)
+    {
+      const gr_complex *in = (const gr_complex*)input_items[0] + d_start;
+      gr_complex *out = (gr_complex*)output_items[0];
+
+      for(int i = 0; i < noutput_items; i++) {
+        memcpy(out, in, d_vlen_out * sizeof(gr_complex));
+        in += d_vlen_in;
+        out += d_vlen_out;
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace blocks */
+} /* namespace gr */
@@ -28,6 +28,8 @@
 
 #include <@NAME_IMPL@.h>
 #include <algorithm>
+#include <gnuradio/block_detail.h>
+#include <gnuradio/buffer.h>
 #include <gnuradio/io_signature.h>
 #include <stdexcept>
 
@@ -54,7 +56,10 @@ namespace gr {
       d_offset(0),
       d_vlen(vlen),
       d_tags(tags),
-      d_tagpos(0)
+      d_tagpos(0),
+      d_zero_copy(false),
+      d_primed_items(0),
+      d_primed_bufsize(0)
     {
       if(tags.size() == 0) {
         d_settags = 0;
@@ -85,6 +90,14 @@ namespace gr {
       }
     }
 
+    void
+    @NAME_IMPL@::set_zero_copy(bool zero_copy)
+    {
+      d_zero_copy = zero_copy;
+      d_primed_items = 0;
+      d_primed_bufsize = 0;
+    }
+
     int
     @NAME_IMPL@::work(int noutput_items,
                       gr_vector_const_void_star &input_items,
@@ -111,11 +124,38 @@ namespace gr {
           }
         }
         else {
-          for(int i = 0; i < noutput_items*d_vlen; i++) {
-            optr[i] = d_data[offset++];
-            if(offset >= size) {
-              offset = 0;
+          unsigned int n = (unsigned int)noutput_items * d_vlen;
+
+          if(d_zero_copy) {
+            // Once the circular output buffer has been filled with a
+            // whole number of data periods, every position it has
+            // already holds the sample this call would write, so just
+            // advance the stream without copying.  The priming count
+            // restarts whenever the phase changes (rewind/set_data) or
+            // the buffer is reallocated out from under us.
+            buffer_sptr buf = detail()->output(0);
+            if(buf->bufsize() != d_primed_bufsize) {
+              d_primed_bufsize = buf->bufsize();
+              d_primed_items = 0;
+            }
+            if(((uint64_t)d_primed_bufsize * d_vlen) % size == 0 &&
+               d_primed_items >= (uint64_t)d_primed_bufsize) {
+              d_offset = (offset + n) % size;
+              return noutput_items;
             }
+            d_primed_items += noutput_items;
+          }
+
+          // Wrapped bulk copy instead of a sample-at-a-time loop
+          while(n > 0) {
+            unsigned int chunk = std::min(n, size - offset);
+            memcpy((void*)optr, (const void*)&d_data[offset],
+                   chunk * sizeof(@TYPE@));
+            optr += chunk;
+            offset += chunk;
+            n -= chunk;
+            if(offset >= size)
+              offset = 0;
           }
         }
 
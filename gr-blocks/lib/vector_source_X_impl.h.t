@@ -40,6 +40,9 @@ namespace gr {
       bool d_settags;
       std::vector<tag_t> d_tags;
       unsigned int d_tagpos;
+      bool d_zero_copy;
+      uint64_t d_primed_items;    // items written since priming restarted
+      int d_primed_bufsize;       // bufsize the priming count is valid for
 
     public:
       @NAME_IMPL@(const std::vector<@TYPE@> &data,
@@ -47,9 +50,10 @@ namespace gr {
                   const std::vector<tag_t> &tags);
       ~@NAME_IMPL@();
 
-      void rewind() { d_offset=0; }
+      void rewind() { d_offset=0; d_primed_items=0; }
       void set_data(const std::vector<@TYPE@> &data,
                     const std::vector<tag_t> &tags);
+      void set_zero_copy(bool zero_copy);
 
       int work(int noutput_items,
                gr_vector_const_void_star &input_items,
@@ -32,7 +32,12 @@
 namespace gr {
   namespace blocks {
 
-#define VALID_COMPRESSION_TYPE 0x0001
+#define VALID_COMPRESSION_TYPE 0x0001	// PCM
+#define FLOAT_COMPRESSION_TYPE 0x0003	// IEEE float
+
+// chunking for the block sample writers; all conversion and byte
+// swapping happens in stack buffers of this many samples
+static const int WAV_WRITE_CHUNK = 4096;
 
     // Basically, this is the opposite of htonx() and ntohx()
     // Define host to/from worknet (little endian) short and long
@@ -108,7 +113,9 @@ namespace gr {
       fresult = fread(&fmt_hdr_skip, 1, 4, fp);
 
       fresult = fread(&compression_type, 1, 2, fp);
-      if(wav_to_host(compression_type) != VALID_COMPRESSION_TYPE) {
+      compression_type = wav_to_host(compression_type);
+      if(compression_type != VALID_COMPRESSION_TYPE
+	 && compression_type != FLOAT_COMPRESSION_TYPE) {
 	return false;
       }
 
@@ -127,7 +134,12 @@ namespace gr {
       sample_rate     = wav_to_host(sample_rate);
       bits_per_sample = wav_to_host(bits_per_sample);
 
-      if(bits_per_sample != 8 && bits_per_sample != 16) {
+      if(compression_type == FLOAT_COMPRESSION_TYPE) {
+	if(bits_per_sample != 32) {
+	  return false;
+	}
+      }
+      else if(bits_per_sample != 8 && bits_per_sample != 16) {
 	return false;
       }
 
@@ -181,7 +193,23 @@ namespace gr {
     short int
     wav_read_sample(FILE *fp, int bytes_per_sample)
     {
-      int16_t buf_16bit;
+      int16_t buf_16bit = 0;	// only the low byte is read for 8-bit files
+
+      if(bytes_per_sample == 4) {
+	// IEEE-float file; quantize the nominal [-1,1] sample into the
+	// 16-bit range so callers see the usual short interface
+	union { float f; uint32_t i; } buf;
+	if(fread(&buf.i, 4, 1, fp) != 1) {
+	  return 0;
+	}
+	buf.i = wav_to_host(buf.i);
+	float sample = buf.f * 0x7FFF;
+	if(sample > 0x7FFF)
+	  sample = 0x7FFF;
+	else if(sample < -0x7FFF)
+	  sample = -0x7FFF;
+	return (short)sample;
+      }
 
       if(fread(&buf_16bit, bytes_per_sample, 1, fp) != 1) {
 	return 0;
@@ -214,7 +242,9 @@ namespace gr {
       bits_per_sample = host_to_wav(bits_per_sample);
 
       wav_hdr[16] = 0x10; // no extra bytes
-      wav_hdr[20] = 0x01; // no compression
+      wav_hdr[20] = (bytes_per_sample == 4)
+	? 0x03            // IEEE float
+	: 0x01;           // PCM, no compression
       memcpy((void*)(wav_hdr + 22), (void*)&nchans_f,        2);
       memcpy((void*)(wav_hdr + 24), (void*)&sample_rate_f,   4);
       memcpy((void*)(wav_hdr + 28), (void*)&avg_bytes,       4);
@@ -250,6 +280,58 @@ namespace gr {
     }
 
 
+    void
+    wav_write_samples(FILE *fp, const short *samples, int nsamples,
+		      int bytes_per_sample)
+    {
+      while(nsamples > 0) {
+	int n = nsamples < WAV_WRITE_CHUNK ? nsamples : WAV_WRITE_CHUNK;
+
+	if(bytes_per_sample == 1) {
+	  unsigned char buf[WAV_WRITE_CHUNK];
+	  for(int i = 0; i < n; i++)
+	    buf[i] = (unsigned char)samples[i];
+	  fwrite(buf, 1, n, fp);
+	}
+	else {
+#ifdef BOOST_BIG_ENDIAN
+	  int16_t buf[WAV_WRITE_CHUNK];
+	  for(int i = 0; i < n; i++)
+	    buf[i] = host_to_wav((int16_t)samples[i]);
+	  fwrite(buf, 2, n, fp);
+#else
+	  // already little-endian: one straight fwrite
+	  fwrite(samples, 2, n, fp);
+#endif
+	}
+
+	samples  += n;
+	nsamples -= n;
+      }
+    }
+
+
+    void
+    wav_write_floats(FILE *fp, const float *samples, int nsamples)
+    {
+#ifdef BOOST_BIG_ENDIAN
+      while(nsamples > 0) {
+	int n = nsamples < WAV_WRITE_CHUNK ? nsamples : WAV_WRITE_CHUNK;
+	union { float f; uint32_t i; } buf[WAV_WRITE_CHUNK];
+	for(int i = 0; i < n; i++) {
+	  buf[i].f = samples[i];
+	  buf[i].i = host_to_wav(buf[i].i);
+	}
+	fwrite(buf, 4, n, fp);
+	samples  += n;
+	nsamples -= n;
+      }
+#else
+      fwrite(samples, 4, nsamples, fp);
+#endif
+    }
+
+
     bool
     wavheader_complete(FILE *fp, unsigned int byte_count)
     {
@@ -34,6 +34,7 @@
 #include <fcntl.h>
 #include <gnuradio/thread/thread.h>
 #include <boost/math/special_functions/round.hpp>
+#include <volk/volk.h>
 
 // win32 (mingw/msvc) specific
 #ifdef HAVE_IO_H
@@ -76,8 +77,9 @@ namespace gr {
 	d_sample_rate(sample_rate), d_nchans(n_channels),
 	d_fp(0), d_new_fp(0), d_updated(false)
     {
-      if(bits_per_sample != 8 && bits_per_sample != 16) {
-	throw std::runtime_error("Invalid bits per sample (supports 8 and 16)");
+      if(bits_per_sample != 8 && bits_per_sample != 16
+	 && bits_per_sample != 32) {
+	throw std::runtime_error("Invalid bits per sample (supports 8, 16 and 32)");
       }
       d_bytes_per_sample = bits_per_sample / 8;
       d_bytes_per_sample_new = d_bytes_per_sample;
@@ -93,13 +95,12 @@ namespace gr {
 	d_normalize_shift = 1;
       }
       else {
+	// 16 bit; for 32-bit float files the input samples are written
+	// as-is and these are unused
 	d_max_sample_val = 0x7FFF;
 	d_min_sample_val = -0x7FFF;
 	d_normalize_fac  = d_max_sample_val;
 	d_normalize_shift = 0;
-	if(bits_per_sample != 16) {
-	  fprintf(stderr, "Invalid bits per sample value requested, using 16");
-	}
       }
     }
 
@@ -179,39 +180,48 @@ namespace gr {
       float **in = (float**)&input_items[0];
       int n_in_chans = input_items.size();
 
-      short int sample_buf_s;
-
-      int nwritten;
-
       gr::thread::scoped_lock guard(d_mutex);    // hold mutex for duration of this block
       do_update();      // update: d_fp is reqd
       if(!d_fp)         // drop output on the floor
 	return noutput_items;
 
-      for(nwritten = 0; nwritten < noutput_items; nwritten++) {
+      int nsamples = noutput_items * d_nchans;
+
+      // interleave the channels, writing zeros to channels which are
+      // in the WAV file but don't have any inputs here
+      d_fbuf.resize(nsamples);
+      for(int i = 0; i < noutput_items; i++) {
 	for(int chan = 0; chan < d_nchans; chan++) {
-	  // Write zeros to channels which are in the WAV file
-	  // but don't have any inputs here
-	  if(chan < n_in_chans) {
-	    sample_buf_s =
-	      convert_to_short(in[chan][nwritten]);
-	  }
-	  else {
-	    sample_buf_s = 0;
-	  }
-
-	  wav_write_sample(d_fp, sample_buf_s, d_bytes_per_sample);
-
-	  if(feof(d_fp) || ferror(d_fp)) {
-	    fprintf(stderr, "[%s] file i/o error\n", __FILE__);
-	    close();
-	    exit(-1);
-	  }
-	  d_sample_count++;
+	  d_fbuf[i * d_nchans + chan] =
+	    chan < n_in_chans ? in[chan][i] : 0;
 	}
       }
 
-      return nwritten;
+      if(d_bytes_per_sample == 4) {
+	// float file: samples go out as-is
+	wav_write_floats(d_fp, &d_fbuf[0], nsamples);
+      }
+      else if(d_bytes_per_sample == 2) {
+	d_sbuf.resize(nsamples);
+	volk_32f_s32f_convert_16i(&d_sbuf[0], &d_fbuf[0],
+				  (float)d_normalize_fac, nsamples);
+	wav_write_samples(d_fp, &d_sbuf[0], nsamples, 2);
+      }
+      else {
+	d_sbuf.resize(nsamples);
+	for(int i = 0; i < nsamples; i++)
+	  d_sbuf[i] = convert_to_short(d_fbuf[i]);
+	wav_write_samples(d_fp, &d_sbuf[0], nsamples, 1);
+      }
+
+      if(feof(d_fp) || ferror(d_fp)) {
+	fprintf(stderr, "[%s] file i/o error\n", __FILE__);
+	close();
+	exit(-1);
+      }
+      d_sample_count += nsamples;
+
+      return noutput_items;
     }
 
     short int
@@ -233,7 +243,8 @@ namespace gr {
     wavfile_sink_impl::set_bits_per_sample(int bits_per_sample)
     {
       gr::thread::scoped_lock guard(d_mutex);
-      if(bits_per_sample == 8 || bits_per_sample == 16) {
+      if(bits_per_sample == 8 || bits_per_sample == 16
+	 || bits_per_sample == 32) {
 	d_bytes_per_sample_new = bits_per_sample / 8;
       }
     }
@@ -24,6 +24,7 @@
 #define INCLUDED_GR_WAVFILE_SINK_IMPL_H
 
 #include <gnuradio/blocks/wavfile_sink.h>
+#include <vector>
 
 namespace gr {
   namespace blocks {
@@ -46,6 +47,11 @@ namespace gr {
       bool d_updated;
       boost::mutex d_mutex;
 
+      // scratch buffers so work() converts whole blocks and issues a
+      // single write per call instead of per-sample fwrites
+      std::vector<float> d_fbuf;   // interleaved float samples
+      std::vector<short> d_sbuf;   // converted integer samples
+
       /*!
        * \brief Convert a sample value within [-1;+1] to a corresponding
        *  short integer value
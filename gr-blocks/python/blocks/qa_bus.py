@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+#
+# Copyright 2013 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+from gnuradio import gr, gr_unittest, blocks
+import os
+
+class test_bus(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        # unique name so parallel test runs don't collide
+        self.name = "qa_bus_%d" % (os.getpid(),)
+
+    def tearDown(self):
+        self.tb = None
+
+    def test_001_loopback(self):
+        # One writer, one reader on the same bus in one flowgraph.
+        src_data = [float(x) for x in range(1000)]
+        src = blocks.vector_source_f(src_data, False)
+        snk = blocks.bus_sink(gr.sizeof_float, self.name, 4096)
+        bsrc = blocks.bus_source(gr.sizeof_float, self.name, 4096)
+        head = blocks.head(gr.sizeof_float, len(src_data))
+        dst = blocks.vector_sink_f()
+
+        self.tb.connect(src, snk)
+        self.tb.connect(bsrc, head, dst)
+        self.tb.run()
+
+        self.assertEqual(tuple(src_data), dst.data())
+
+    def test_002_two_readers(self):
+        # Broadcast: both readers see the full stream.
+        src_data = [float(x) for x in range(500)]
+        src = blocks.vector_source_f(src_data, False)
+        snk = blocks.bus_sink(gr.sizeof_float, self.name, 4096)
+        dsts = []
+        for i in range(2):
+            bsrc = blocks.bus_source(gr.sizeof_float, self.name, 4096)
+            head = blocks.head(gr.sizeof_float, len(src_data))
+            dst = blocks.vector_sink_f()
+            self.tb.connect(bsrc, head, dst)
+            dsts.append(dst)
+
+        self.tb.connect(src, snk)
+        self.tb.run()
+
+        for dst in dsts:
+            self.assertEqual(tuple(src_data), dst.data())
+
+if __name__ == '__main__':
+    gr_unittest.run(test_bus, "test_bus.xml")
@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+#
+# Copyright 2013 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+from gnuradio import gr, gr_unittest, blocks
+
+class test_complex_to_mag_squared_decim(gr_unittest.TestCase):
+
+    def setUp (self):
+        self.tb = gr.top_block ()
+
+    def tearDown (self):
+        self.tb = None
+
+    def test_001(self):
+        src_data = (0+1j, 1+0j, 3+4j, 2+2j, 0-1j, -3-4j)
+        expected_data = (1.0, 25.0, 25.0)
+        src = blocks.vector_source_c(src_data)
+        op = blocks.complex_to_mag_squared_decim(2)
+        dst = blocks.vector_sink_f()
+        self.tb.connect(src, op, dst)
+        self.tb.run()
+        self.assertFloatTuplesAlmostEqual(expected_data, dst.data(), 5)
+
+    def test_002(self):
+        # decim of 1 reduces to complex_to_mag_squared
+        src_data = (0+1j, 1+0j, 3+4j)
+        expected_data = (1.0, 1.0, 25.0)
+        src = blocks.vector_source_c(src_data)
+        op = blocks.complex_to_mag_squared_decim(1)
+        dst = blocks.vector_sink_f()
+        self.tb.connect(src, op, dst)
+        self.tb.run()
+        self.assertFloatTuplesAlmostEqual(expected_data, dst.data(), 5)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(test_complex_to_mag_squared_decim, "test_complex_to_mag_squared_decim.xml")
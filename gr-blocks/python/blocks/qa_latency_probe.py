@@ -0,0 +1,79 @@
+#!/usr/bin/env python
+#
+# Copyright 2013 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+from gnuradio import gr, gr_unittest, blocks
+
+class test_latency_probe(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def test_001(self):
+        # tagger and probe back to back; every stamped tag must be
+        # collected and every latency must be a sane non-negative time
+        src_data = [float(x) for x in range(1000)]
+
+        src = blocks.vector_source_f(src_data)
+        tagger = blocks.latency_tagger(gr.sizeof_float, 100)
+        probe = blocks.latency_probe(gr.sizeof_float)
+
+        self.tb.connect(src, tagger, probe)
+        self.tb.run()
+
+        self.assertEqual(probe.num_measurements(), 10)
+        self.assertTrue(probe.latency_min() >= 0)
+        self.assertTrue(probe.latency_max() >= probe.latency_min())
+        self.assertTrue(probe.latency_min() <= probe.latency_avg())
+        self.assertTrue(probe.latency_avg() <= probe.latency_max())
+
+    def test_002(self):
+        # the tagger must not disturb the stream it stamps
+        src_data = [float(x) for x in range(256)]
+
+        src = blocks.vector_source_f(src_data)
+        tagger = blocks.latency_tagger(gr.sizeof_float, 64)
+        snk = blocks.vector_sink_f()
+
+        self.tb.connect(src, tagger, snk)
+        self.tb.run()
+
+        self.assertEqual(tuple(src_data), snk.data())
+
+    def test_003(self):
+        # reset() empties the statistics
+        src = blocks.vector_source_f([0.0] * 100)
+        tagger = blocks.latency_tagger(gr.sizeof_float, 10)
+        probe = blocks.latency_probe(gr.sizeof_float)
+
+        self.tb.connect(src, tagger, probe)
+        self.tb.run()
+
+        self.assertTrue(probe.num_measurements() > 0)
+        probe.reset()
+        self.assertEqual(probe.num_measurements(), 0)
+        self.assertEqual(probe.latency_avg(), 0)
+
+if __name__ == '__main__':
+    gr_unittest.run(test_latency_probe, "test_latency_probe.xml")
@@ -41,6 +41,19 @@ class test_nlog10(gr_unittest.TestCase):
         result_data = dst.data()
         self.assertFloatTuplesAlmostEqual (expected_result, result_data)
 
+    def test_002_approx(self):
+        src_data = (10, 100, 1000, 10000, 100000)
+        expected_result = (10, 20, 30, 40, 50)
+        src = blocks.vector_source_f(src_data)
+        op = blocks.nlog10_ff(10)
+        op.set_approx_mode(True)
+        dst = blocks.vector_sink_f()
+        self.tb.connect (src, op, dst)
+        self.tb.run()
+        result_data = dst.data()
+        # approximate mode is within ~0.005 dB for n=10
+        self.assertFloatTuplesAlmostEqual (expected_result, result_data, 2)
+
 
 if __name__ == '__main__':
     gr_unittest.run(test_nlog10, "test_nlog10.xml")
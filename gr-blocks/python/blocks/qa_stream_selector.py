@@ -0,0 +1,65 @@
+#!/usr/bin/env python
+#
+# Copyright 2014 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+from gnuradio import gr, gr_unittest, blocks
+
+class test_stream_selector(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def test_select_first(self):
+        src0_data = (1, 2, 3, 4, 5)
+        src1_data = (11, 12, 13, 14, 15)
+        src0 = blocks.vector_source_b(src0_data)
+        src1 = blocks.vector_source_b(src1_data)
+        op = blocks.stream_selector(gr.sizeof_char)
+        dst = blocks.vector_sink_b()
+        self.tb.connect(src0, (op, 0))
+        self.tb.connect(src1, (op, 1))
+        self.tb.connect(op, dst)
+        self.tb.run()
+        self.assertEqual(src0_data, dst.data())
+
+    def test_select_second(self):
+        src0_data = (1, 2, 3, 4, 5)
+        src1_data = (11, 12, 13, 14, 15)
+        src0 = blocks.vector_source_b(src0_data)
+        src1 = blocks.vector_source_b(src1_data)
+        op = blocks.stream_selector(gr.sizeof_char, 1)
+        dst = blocks.vector_sink_b()
+        self.tb.connect(src0, (op, 0))
+        self.tb.connect(src1, (op, 1))
+        self.tb.connect(op, dst)
+        self.tb.run()
+        self.assertEqual(src1_data, dst.data())
+        self.assertEqual(op.input_index(), 1)
+
+    def test_bad_index(self):
+        op = blocks.stream_selector(gr.sizeof_char)
+        self.assertRaises(Exception, lambda: op.set_input_index(-1))
+
+if __name__ == '__main__':
+    gr_unittest.run(test_stream_selector, "test_stream_selector.xml")
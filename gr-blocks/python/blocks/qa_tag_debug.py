@@ -21,6 +21,7 @@
 #
 
 from gnuradio import gr, gr_unittest, blocks
+import pmt
 
 class test_tag_debug(gr_unittest.TestCase):
 
@@ -39,5 +40,20 @@ class test_tag_debug(gr_unittest.TestCase):
         self.tb.run()
         x = op.current_tags()
 
+    def test_002(self):
+        # Bounded ring and sampling: strobe a few dozen tags through,
+        # keep every 2nd one in a ring of 8; the counter sees all.
+        src = blocks.tags_strobe(gr.sizeof_int, pmt.intern("TEST"), 10)
+        hed = blocks.head(gr.sizeof_int, 400)
+        op = blocks.tag_debug(gr.sizeof_int, "tag QA")
+        op.set_display(False)
+        op.set_max_tags(8)
+        op.set_sampling(2)
+        self.tb.connect(src, hed, op)
+        self.tb.run()
+        x = op.current_tags()
+        self.assertTrue(len(x) <= 8)
+        self.assertTrue(op.num_tags() >= len(x))
+
 if __name__ == '__main__':
     gr_unittest.run(test_tag_debug, "test_tag_debug.xml")
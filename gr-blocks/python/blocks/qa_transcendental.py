@@ -86,5 +86,24 @@ class test_transcendental(gr_unittest.TestCase):
 
         self.assertFloatTuplesAlmostEqual(expected_result, dst_data, 5)
 
+    def test_04(self):
+        tb = self.tb
+
+        data = 100*[3,]
+        expected_result = 100*[math.log(3),]
+
+        src = blocks.vector_source_f(data, False)
+        op = blocks.transcendental("fast_log", "float")
+        dst = blocks.vector_sink_f()
+
+        tb.connect(src, op)
+        tb.connect(op, dst)
+        tb.run()
+
+        dst_data = dst.data()
+
+        # approximate variant: a couple of places looser than libm
+        self.assertFloatTuplesAlmostEqual(expected_result, dst_data, 2)
+
 if __name__ == '__main__':
     gr_unittest.run(test_transcendental, "test_transcendental.xml")
@@ -127,6 +127,20 @@ class test_type_conversions(gr_unittest.TestCase):
         self.tb.run()
         self.assertFloatTuplesAlmostEqual(expected_data, dst.data(), 5)
 
+    def test_complex_to_mag_approx(self):
+        # the estimate is only promised to be within 4% of the
+        # true magnitude
+        src_data = (1+2j, 3-4j, 5+6j, 7-8j, -9+10j, 0j)
+        expected_data = (sqrt(5), sqrt(25), sqrt(61), sqrt(113), sqrt(181), 0.0)
+        src = blocks.vector_source_c(src_data)
+        op = blocks.complex_to_mag(1, True)
+        dst = blocks.vector_sink_f()
+        self.tb.connect(src, op, dst)
+        self.tb.run()
+        self.assertTrue(op.approx())
+        for expected, actual in zip(expected_data, dst.data()):
+            self.assertTrue(abs(actual - expected) <= 0.04 * expected)
+
     def test_complex_to_mag_squared(self):
         src_data = (1+2j, 3-4j, 5+6j, 7-8j, -9+10j)
         expected_data = (5.0, 25.0, 61.0, 113.0, 181.0)
@@ -241,6 +255,40 @@ class test_type_conversions(gr_unittest.TestCase):
         self.tb.run()
         self.assertEqual(expected_data, dst.data())
 
+    def test_float_to_half_roundtrip(self):
+        # all values exactly representable in binary16
+        src_data = (1.0, -2.5, 0.0, 0.15625, 65504.0)
+        src = blocks.vector_source_f(src_data)
+        f2h = blocks.float_to_half()
+        h2f = blocks.half_to_float()
+        dst = blocks.vector_sink_f()
+        self.tb.connect(src, f2h, h2f, dst)
+        self.tb.run()
+        self.assertEqual(src_data, dst.data())
+
+    def test_float_to_half_rounding(self):
+        # 2049 falls between the halves 2048 and 2050 and rounds to
+        # even; values beyond ~65504 overflow to infinity
+        src_data = (2049.0, 100000.0, -100000.0)
+        expected_data = (2048.0, float('inf'), float('-inf'))
+        src = blocks.vector_source_f(src_data)
+        f2h = blocks.float_to_half()
+        h2f = blocks.half_to_float()
+        dst = blocks.vector_sink_f()
+        self.tb.connect(src, f2h, h2f, dst)
+        self.tb.run()
+        self.assertEqual(expected_data, dst.data())
+
+    def test_complex_to_interleaved_half_roundtrip(self):
+        src_data = (1+2j, 3+4j, 5+6j, -7-8j, 9+10j)
+        src = blocks.vector_source_c(src_data)
+        c2h = blocks.complex_to_interleaved_half()
+        h2c = blocks.interleaved_half_to_complex()
+        dst = blocks.vector_sink_c()
+        self.tb.connect(src, c2h, h2c, dst)
+        self.tb.run()
+        self.assertEqual(src_data, dst.data())
+
     def test_int_to_float_identity(self):
         src_data = (1, 2, 3, 4, 5)
         expected_data = (1.0, 2.0, 3.0, 4.0, 5.0)
@@ -301,6 +349,26 @@ class test_type_conversions(gr_unittest.TestCase):
         self.tb.run()
         self.assertEqual(expected_data, dst.data())
 
+    def test_short_to_float_scaled_identity(self):
+        src_data = (1, 2, 3, 4, 5)
+        expected_data = (1.0, 2.0, 3.0, 4.0, 5.0)
+        src = blocks.vector_source_s(src_data)
+        op = blocks.short_to_float_scaled()
+        dst = blocks.vector_sink_f()
+        self.tb.connect(src, op, dst)
+        self.tb.run()
+        self.assertEqual(expected_data, dst.data())
+
+    def test_short_to_float_scaled_affine(self):
+        src_data = (5, 10, 15, 20, 25)
+        expected_data = (3.5, 6.0, 8.5, 11.0, 13.5)
+        src = blocks.vector_source_s(src_data)
+        op = blocks.short_to_float_scaled(1, 0.5, 1.0)
+        dst = blocks.vector_sink_f()
+        self.tb.connect(src, op, dst)
+        self.tb.run()
+        self.assertEqual(expected_data, dst.data())
+
     def test_uchar_to_float(self):
         src_data = (1, 2, 3, 4, 5)
         expected_data = (1.0, 2.0, 3.0, 4.0, 5.0)
@@ -60,6 +60,22 @@ class test_vector_sink_source(gr_unittest.TestCase):
         expected_result = tuple(src_data)
         self.assertRaises(RuntimeError, lambda : blocks.vector_source_f(src_data, False, 3))
 
+    def test_004(self):
+        # zero-copy repeat emits the same periodic stream
+        src_data = [float(x) for x in range(16)]
+        nitems = 100000
+        expected_result = tuple(src_data * (nitems // len(src_data)))[:nitems]
+
+        src = blocks.vector_source_f(src_data, True)
+        src.set_zero_copy(True)
+        head = blocks.head(gr.sizeof_float, nitems)
+        dst = blocks.vector_sink_f()
+
+        self.tb.connect(src, head, dst)
+        self.tb.run()
+        result_data = dst.data()
+        self.assertEqual(expected_result, result_data)
+
 if __name__ == '__main__':
     gr_unittest.run(test_vector_sink_source, "test_vector_sink_source.xml")
 
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+#
+# Copyright 2013 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+from gnuradio import gr, gr_unittest, blocks
+
+class test_vector_slice(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def test_slice(self):
+        vlen = 8
+        nvecs = 4
+        src_data = [complex(x, -x) for x in range(vlen * nvecs)]
+        expected = []
+        for v in range(nvecs):
+            expected.extend(src_data[v*vlen+2 : v*vlen+5])
+
+        src = blocks.vector_source_c(src_data, False, vlen)
+        op = blocks.vector_slice_vcc(vlen, 2, 5)
+        dst = blocks.vector_sink_c(3)
+
+        self.tb.connect(src, op, dst)
+        self.tb.run()
+        self.assertComplexTuplesAlmostEqual(tuple(expected), dst.data())
+
+    def test_slice_bad_range(self):
+        self.assertRaises(ValueError, lambda: blocks.vector_slice_vcc(8, 5, 5))
+        self.assertRaises(ValueError, lambda: blocks.vector_slice_vcc(8, 2, 9))
+
+    def test_assemble(self):
+        vlens = [2, 3]
+        nvecs = 3
+        in0 = [float(x) for x in range(vlens[0] * nvecs)]
+        in1 = [float(100 + x) for x in range(vlens[1] * nvecs)]
+        expected = []
+        for v in range(nvecs):
+            expected.extend(in0[v*vlens[0] : (v+1)*vlens[0]])
+            expected.extend(in1[v*vlens[1] : (v+1)*vlens[1]])
+
+        src0 = blocks.vector_source_f(in0, False, vlens[0])
+        src1 = blocks.vector_source_f(in1, False, vlens[1])
+        op = blocks.vector_assemble(gr.sizeof_float, vlens)
+        dst = blocks.vector_sink_f(sum(vlens))
+
+        self.tb.connect(src0, (op, 0))
+        self.tb.connect(src1, (op, 1))
+        self.tb.connect(op, dst)
+        self.tb.run()
+        self.assertFloatTuplesAlmostEqual(tuple(expected), dst.data())
+
+    def test_slice_roundtrip(self):
+        # slicing [0,a) and [a,vlen) and assembling them is the identity
+        vlen = 16
+        nvecs = 5
+        src_data = [complex(x, x + 1) for x in range(vlen * nvecs)]
+
+        src = blocks.vector_source_c(src_data, False, vlen)
+        lo = blocks.vector_slice_vcc(vlen, 0, 6)
+        hi = blocks.vector_slice_vcc(vlen, 6, vlen)
+        op = blocks.vector_assemble(gr.sizeof_gr_complex, [6, vlen - 6])
+        dst = blocks.vector_sink_c(vlen)
+
+        self.tb.connect(src, lo, (op, 0))
+        self.tb.connect(src, hi, (op, 1))
+        self.tb.connect(op, dst)
+        self.tb.run()
+        self.assertComplexTuplesAlmostEqual(tuple(src_data), dst.data())
+
+if __name__ == '__main__':
+    gr_unittest.run(test_vector_slice, "test_vector_slice.xml")
@@ -27,8 +27,12 @@
 %include "blocks_swig1_doc.i"
 
 %{
+#include "gnuradio/blocks/scheduled_valve.h"
+#include "gnuradio/blocks/shm_sink.h"
+#include "gnuradio/blocks/shm_source.h"
 #include "gnuradio/blocks/skiphead.h"
 #include "gnuradio/blocks/stream_mux.h"
+#include "gnuradio/blocks/stream_selector.h"
 #include "gnuradio/blocks/stream_to_streams.h"
 #include "gnuradio/blocks/stream_to_tagged_stream.h"
 #include "gnuradio/blocks/stream_to_vector.h"
@@ -37,7 +41,9 @@
 #include "gnuradio/blocks/tag_debug.h"
 #include "gnuradio/blocks/tagged_file_sink.h"
 #include "gnuradio/blocks/throttle.h"
+#include "gnuradio/blocks/vector_assemble.h"
 #include "gnuradio/blocks/vector_map.h"
+#include "gnuradio/blocks/vector_slice_vcc.h"
 #include "gnuradio/blocks/vector_to_stream.h"
 #include "gnuradio/blocks/vector_to_streams.h"
 #include "gnuradio/blocks/vector_insert_b.h"
@@ -59,8 +65,12 @@
 #include "gnuradio/blocks/wavfile_source.h"
 %}
 
+%include "gnuradio/blocks/scheduled_valve.h"
+%include "gnuradio/blocks/shm_sink.h"
+%include "gnuradio/blocks/shm_source.h"
 %include "gnuradio/blocks/skiphead.h"
 %include "gnuradio/blocks/stream_mux.h"
+%include "gnuradio/blocks/stream_selector.h"
 %include "gnuradio/blocks/stream_to_streams.h"
 %include "gnuradio/blocks/stream_to_tagged_stream.h"
 %include "gnuradio/blocks/stream_to_vector.h"
@@ -69,7 +79,9 @@
 %include "gnuradio/blocks/tag_debug.h"
 %include "gnuradio/blocks/tagged_file_sink.h"
 %include "gnuradio/blocks/throttle.h"
+%include "gnuradio/blocks/vector_assemble.h"
 %include "gnuradio/blocks/vector_map.h"
+%include "gnuradio/blocks/vector_slice_vcc.h"
 %include "gnuradio/blocks/vector_to_stream.h"
 %include "gnuradio/blocks/vector_to_streams.h"
 %include "gnuradio/blocks/vector_insert_b.h"
@@ -90,8 +102,12 @@
 %include "gnuradio/blocks/wavfile_sink.h"
 %include "gnuradio/blocks/wavfile_source.h"
 
+GR_SWIG_BLOCK_MAGIC2(blocks, scheduled_valve);
+GR_SWIG_BLOCK_MAGIC2(blocks, shm_sink);
+GR_SWIG_BLOCK_MAGIC2(blocks, shm_source);
 GR_SWIG_BLOCK_MAGIC2(blocks, skiphead);
 GR_SWIG_BLOCK_MAGIC2(blocks, stream_mux);
+GR_SWIG_BLOCK_MAGIC2(blocks, stream_selector);
 GR_SWIG_BLOCK_MAGIC2(blocks, stream_to_streams);
 GR_SWIG_BLOCK_MAGIC2(blocks, stream_to_tagged_stream);
 GR_SWIG_BLOCK_MAGIC2(blocks, stream_to_vector);
@@ -100,7 +116,9 @@ GR_SWIG_BLOCK_MAGIC2(blocks, streams_to_vector);
 GR_SWIG_BLOCK_MAGIC2(blocks, tag_debug);
 GR_SWIG_BLOCK_MAGIC2(blocks, tagged_file_sink);
 GR_SWIG_BLOCK_MAGIC2(blocks, throttle);
+GR_SWIG_BLOCK_MAGIC2(blocks, vector_assemble);
 GR_SWIG_BLOCK_MAGIC2(blocks, vector_map);
+GR_SWIG_BLOCK_MAGIC2(blocks, vector_slice_vcc);
 GR_SWIG_BLOCK_MAGIC2(blocks, vector_to_stream);
 GR_SWIG_BLOCK_MAGIC2(blocks, vector_to_streams);
 GR_SWIG_BLOCK_MAGIC2(blocks, vector_insert_b);
@@ -59,15 +59,19 @@
 #include "gnuradio/blocks/argmax_ss.h"
 #include "gnuradio/blocks/bin_statistics_f.h"
 #include "gnuradio/blocks/burst_tagger.h"
+#include "gnuradio/blocks/bus_sink.h"
+#include "gnuradio/blocks/bus_source.h"
 #include "gnuradio/blocks/char_to_float.h"
 #include "gnuradio/blocks/char_to_short.h"
 #include "gnuradio/blocks/check_lfsr_32k_s.h"
+#include "gnuradio/blocks/complex_to_interleaved_half.h"
 #include "gnuradio/blocks/complex_to_interleaved_short.h"
 #include "gnuradio/blocks/complex_to_float.h"
 #include "gnuradio/blocks/complex_to_real.h"
 #include "gnuradio/blocks/complex_to_imag.h"
 #include "gnuradio/blocks/complex_to_mag.h"
 #include "gnuradio/blocks/complex_to_mag_squared.h"
+#include "gnuradio/blocks/complex_to_mag_squared_decim.h"
 #include "gnuradio/blocks/complex_to_arg.h"
 #include "gnuradio/blocks/conjugate_cc.h"
 #include "gnuradio/blocks/deinterleave.h"
@@ -106,14 +110,18 @@
 %include "gnuradio/blocks/char_to_float.h"
 %include "gnuradio/blocks/bin_statistics_f.h"
 %include "gnuradio/blocks/burst_tagger.h"
+%include "gnuradio/blocks/bus_sink.h"
+%include "gnuradio/blocks/bus_source.h"
 %include "gnuradio/blocks/char_to_short.h"
 %include "gnuradio/blocks/check_lfsr_32k_s.h"
+%include "gnuradio/blocks/complex_to_interleaved_half.h"
 %include "gnuradio/blocks/complex_to_interleaved_short.h"
 %include "gnuradio/blocks/complex_to_float.h"
 %include "gnuradio/blocks/complex_to_real.h"
 %include "gnuradio/blocks/complex_to_imag.h"
 %include "gnuradio/blocks/complex_to_mag.h"
 %include "gnuradio/blocks/complex_to_mag_squared.h"
+%include "gnuradio/blocks/complex_to_mag_squared_decim.h"
 %include "gnuradio/blocks/complex_to_arg.h"
 %include "gnuradio/blocks/conjugate_cc.h"
 %include "gnuradio/blocks/deinterleave.h"
@@ -150,15 +158,19 @@ GR_SWIG_BLOCK_MAGIC2(blocks, argmax_is);
 GR_SWIG_BLOCK_MAGIC2(blocks, argmax_ss);
 GR_SWIG_BLOCK_MAGIC2(blocks, bin_statistics_f);
 GR_SWIG_BLOCK_MAGIC2(blocks, burst_tagger);
+GR_SWIG_BLOCK_MAGIC2(blocks, bus_sink);
+GR_SWIG_BLOCK_MAGIC2(blocks, bus_source);
 GR_SWIG_BLOCK_MAGIC2(blocks, char_to_float);
 GR_SWIG_BLOCK_MAGIC2(blocks, char_to_short);
 GR_SWIG_BLOCK_MAGIC2(blocks, check_lfsr_32k_s);
+GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_interleaved_half);
 GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_interleaved_short);
 GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_float);
 GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_real);
 GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_imag);
 GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_mag);
 GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_mag_squared);
+GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_mag_squared_decim);
 GR_SWIG_BLOCK_MAGIC2(blocks, complex_to_arg);
 GR_SWIG_BLOCK_MAGIC2(blocks, conjugate_cc);
 GR_SWIG_BLOCK_MAGIC2(blocks, deinterleave);
@@ -31,18 +31,23 @@
 #include "gnuradio/blocks/float_to_char.h"
 #include "gnuradio/blocks/float_to_complex.h"
 #include "gnuradio/blocks/float_to_int.h"
+#include "gnuradio/blocks/float_to_half.h"
 #include "gnuradio/blocks/float_to_short.h"
 #include "gnuradio/blocks/float_to_uchar.h"
+#include "gnuradio/blocks/half_to_float.h"
 #include "gnuradio/blocks/int_to_float.h"
 #include "gnuradio/blocks/integrate_ss.h"
 #include "gnuradio/blocks/integrate_ii.h"
 #include "gnuradio/blocks/integrate_ff.h"
 #include "gnuradio/blocks/integrate_cc.h"
 #include "gnuradio/blocks/interleave.h"
+#include "gnuradio/blocks/interleaved_half_to_complex.h"
 #include "gnuradio/blocks/interleaved_short_to_complex.h"
 #include "gnuradio/blocks/interleaved_char_to_complex.h"
 #include "gnuradio/blocks/keep_m_in_n.h"
 #include "gnuradio/blocks/keep_one_in_n.h"
+#include "gnuradio/blocks/latency_probe.h"
+#include "gnuradio/blocks/latency_tagger.h"
 #include "gnuradio/blocks/lfsr_32k_source_s.h"
 #include "gnuradio/blocks/max_ff.h"
 #include "gnuradio/blocks/max_ii.h"
@@ -73,18 +78,23 @@
 %include "gnuradio/blocks/float_to_char.h"
 %include "gnuradio/blocks/float_to_complex.h"
 %include "gnuradio/blocks/float_to_int.h"
+%include "gnuradio/blocks/float_to_half.h"
 %include "gnuradio/blocks/float_to_short.h"
 %include "gnuradio/blocks/float_to_uchar.h"
+%include "gnuradio/blocks/half_to_float.h"
 %include "gnuradio/blocks/int_to_float.h"
 %include "gnuradio/blocks/integrate_ss.h"
 %include "gnuradio/blocks/integrate_ii.h"
 %include "gnuradio/blocks/integrate_ff.h"
 %include "gnuradio/blocks/integrate_cc.h"
 %include "gnuradio/blocks/interleave.h"
+%include "gnuradio/blocks/interleaved_half_to_complex.h"
 %include "gnuradio/blocks/interleaved_short_to_complex.h"
 %include "gnuradio/blocks/interleaved_char_to_complex.h"
 %include "gnuradio/blocks/keep_m_in_n.h"
 %include "gnuradio/blocks/keep_one_in_n.h"
+%include "gnuradio/blocks/latency_probe.h"
+%include "gnuradio/blocks/latency_tagger.h"
 %include "gnuradio/blocks/lfsr_32k_source_s.h"
 %include "gnuradio/blocks/max_ff.h"
 %include "gnuradio/blocks/max_ii.h"
@@ -114,18 +124,23 @@
 GR_SWIG_BLOCK_MAGIC2(blocks, float_to_char);
 GR_SWIG_BLOCK_MAGIC2(blocks, float_to_complex);
 GR_SWIG_BLOCK_MAGIC2(blocks, float_to_int);
+GR_SWIG_BLOCK_MAGIC2(blocks, float_to_half);
 GR_SWIG_BLOCK_MAGIC2(blocks, float_to_short);
 GR_SWIG_BLOCK_MAGIC2(blocks, float_to_uchar);
+GR_SWIG_BLOCK_MAGIC2(blocks, half_to_float);
 GR_SWIG_BLOCK_MAGIC2(blocks, int_to_float);
 GR_SWIG_BLOCK_MAGIC2(blocks, integrate_ss);
 GR_SWIG_BLOCK_MAGIC2(blocks, integrate_ii);
 GR_SWIG_BLOCK_MAGIC2(blocks, integrate_ff);
 GR_SWIG_BLOCK_MAGIC2(blocks, integrate_cc);
 GR_SWIG_BLOCK_MAGIC2(blocks, interleave);
+GR_SWIG_BLOCK_MAGIC2(blocks, interleaved_half_to_complex);
 GR_SWIG_BLOCK_MAGIC2(blocks, interleaved_short_to_complex);
 GR_SWIG_BLOCK_MAGIC2(blocks, interleaved_char_to_complex);
 GR_SWIG_BLOCK_MAGIC2(blocks, keep_m_in_n);
 GR_SWIG_BLOCK_MAGIC2(blocks, keep_one_in_n);
+GR_SWIG_BLOCK_MAGIC2(blocks, latency_probe);
+GR_SWIG_BLOCK_MAGIC2(blocks, latency_tagger);
 GR_SWIG_BLOCK_MAGIC2(blocks, lfsr_32k_source_s);
 GR_SWIG_BLOCK_MAGIC2(blocks, max_ff);
 GR_SWIG_BLOCK_MAGIC2(blocks, max_ii);
@@ -44,6 +44,7 @@
 #include "gnuradio/blocks/sample_and_hold_ff.h"
 #include "gnuradio/blocks/short_to_char.h"
 #include "gnuradio/blocks/short_to_float.h"
+#include "gnuradio/blocks/short_to_float_scaled.h"
 #include "gnuradio/blocks/socket_pdu.h"
 #include "gnuradio/blocks/stretch_ff.h"
 #include "gnuradio/blocks/sub_ff.h"
@@ -59,6 +60,9 @@
 #include "gnuradio/blocks/transcendental.h"
 #include "gnuradio/blocks/tuntap_pdu.h"
 #include "gnuradio/blocks/uchar_to_float.h"
+#include "gnuradio/blocks/tcp_sink.h"
+#include "gnuradio/blocks/tcp_source.h"
+#include "gnuradio/blocks/udp_pdu.h"
 #include "gnuradio/blocks/udp_sink.h"
 #include "gnuradio/blocks/udp_source.h"
 #include "gnuradio/blocks/unpack_k_bits_bb.h"
@@ -85,6 +89,7 @@
 %include "gnuradio/blocks/sample_and_hold_ff.h"
 %include "gnuradio/blocks/short_to_char.h"
 %include "gnuradio/blocks/short_to_float.h"
+%include "gnuradio/blocks/short_to_float_scaled.h"
 %include "gnuradio/blocks/socket_pdu.h"
 %include "gnuradio/blocks/stretch_ff.h"
 %include "gnuradio/blocks/sub_ff.h"
@@ -100,6 +105,9 @@
 %include "gnuradio/blocks/transcendental.h"
 %include "gnuradio/blocks/tuntap_pdu.h"
 %include "gnuradio/blocks/uchar_to_float.h"
+%include "gnuradio/blocks/tcp_sink.h"
+%include "gnuradio/blocks/tcp_source.h"
+%include "gnuradio/blocks/udp_pdu.h"
 %include "gnuradio/blocks/udp_sink.h"
 %include "gnuradio/blocks/udp_source.h"
 %include "gnuradio/blocks/unpack_k_bits_bb.h"
@@ -125,6 +133,7 @@ GR_SWIG_BLOCK_MAGIC2(blocks, sample_and_hold_ii);
 GR_SWIG_BLOCK_MAGIC2(blocks, sample_and_hold_ff);
 GR_SWIG_BLOCK_MAGIC2(blocks, short_to_char);
 GR_SWIG_BLOCK_MAGIC2(blocks, short_to_float);
+GR_SWIG_BLOCK_MAGIC2(blocks, short_to_float_scaled);
 GR_SWIG_BLOCK_MAGIC2(blocks, socket_pdu);
 GR_SWIG_BLOCK_MAGIC2(blocks, stretch_ff);
 GR_SWIG_BLOCK_MAGIC2(blocks, sub_ff);
@@ -140,6 +149,9 @@ GR_SWIG_BLOCK_MAGIC2(blocks, threshold_ff);
 GR_SWIG_BLOCK_MAGIC2(blocks, transcendental);
 GR_SWIG_BLOCK_MAGIC2(blocks, tuntap_pdu);
 GR_SWIG_BLOCK_MAGIC2(blocks, uchar_to_float);
+GR_SWIG_BLOCK_MAGIC2(blocks, tcp_sink);
+GR_SWIG_BLOCK_MAGIC2(blocks, tcp_source);
+GR_SWIG_BLOCK_MAGIC2(blocks, udp_pdu);
 GR_SWIG_BLOCK_MAGIC2(blocks, udp_sink);
 GR_SWIG_BLOCK_MAGIC2(blocks, udp_source);
 GR_SWIG_BLOCK_MAGIC2(blocks, unpack_k_bits_bb);
@@ -63,7 +63,23 @@ namespace gr {
 
       d_timing_offset = filter::fractional_resampler_cc::make(0, epsilon);
 
-      d_multipath = filter::fir_filter_ccc::make(1, d_taps);
+      // Multipath models often have a few echoes spread over a long
+      // delay line; when most taps are zero, the sparse FIR only pays
+      // for the taps that exist.
+      size_t nonzero = 0;
+      for(size_t i = 0; i < d_taps.size(); i++) {
+	if(d_taps[i] != gr_complex(0, 0))
+	  nonzero++;
+      }
+      if(d_taps.size() >= 16 && nonzero * 4 <= d_taps.size()) {
+	std::vector<int> delays;
+	std::vector<gr_complex> values;
+	split_taps(delays, values);
+	d_multipath_sparse = filter::sparse_fir_filter_cc::make(delays, values);
+      }
+      else {
+	d_multipath = filter::fir_filter_ccc::make(1, d_taps);
+      }
 
       d_noise_adder = blocks::add_cc::make();
       d_noise = analog::fastnoise_source_c::make(analog::GR_GAUSSIAN,
@@ -73,8 +89,14 @@ namespace gr {
       d_mixer_offset = blocks::multiply_cc::make();
 
       connect(self(), 0, d_timing_offset, 0);
-      connect(d_timing_offset, 0, d_multipath, 0);
-      connect(d_multipath, 0, d_mixer_offset, 0);
+      if(d_multipath_sparse) {
+	connect(d_timing_offset, 0, d_multipath_sparse, 0);
+	connect(d_multipath_sparse, 0, d_mixer_offset, 0);
+      }
+      else {
+	connect(d_timing_offset, 0, d_multipath, 0);
+	connect(d_multipath, 0, d_mixer_offset, 0);
+      }
       connect(d_freq_offset, 0, d_mixer_offset, 1);
       connect(d_mixer_offset, 0, d_noise_adder, 1);
       connect(d_noise, 0, d_noise_adder, 0);
@@ -89,6 +111,23 @@ namespace gr {
     {
     }
 
+    //! Split d_taps into (delay, value) pairs for the sparse filter
+    void
+    channel_model_impl::split_taps(std::vector<int> &delays,
+				   std::vector<gr_complex> &values) const
+    {
+      for(size_t i = 0; i < d_taps.size(); i++) {
+	if(d_taps[i] != gr_complex(0, 0)) {
+	  delays.push_back((int)i);
+	  values.push_back(d_taps[i]);
+	}
+      }
+      if(delays.empty()) {   // all-zero taps: keep the filter valid
+	delays.push_back(0);
+	values.push_back(gr_complex(0, 0));
+      }
+    }
+
     void
     channel_model_impl::set_noise_voltage(double noise_voltage)
     {
@@ -108,7 +147,15 @@ namespace gr {
       while(d_taps.size() < 2) {
 	d_taps.push_back(0);
       }
-      d_multipath->set_taps(d_taps);
+      if(d_multipath_sparse) {
+	std::vector<int> delays;
+	std::vector<gr_complex> values;
+	split_taps(delays, values);
+	d_multipath_sparse->set_taps(delays, values);
+      }
+      else {
+	d_multipath->set_taps(d_taps);
+      }
     }
 
     void
@@ -132,7 +179,7 @@ namespace gr {
     std::vector<gr_complex>
     channel_model_impl::taps() const
     {
-      return d_multipath->taps();
+      return d_taps;
     }
 
     double
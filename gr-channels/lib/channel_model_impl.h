@@ -31,6 +31,7 @@
 #include <gnuradio/channels/channel_model.h>
 #include <gnuradio/filter/fractional_resampler_cc.h>
 #include <gnuradio/filter/fir_filter_ccc.h>
+#include <gnuradio/filter/sparse_fir_filter_cc.h>
 
 namespace gr {
   namespace channels {
@@ -45,10 +46,16 @@ namespace gr {
       analog::fastnoise_source_c::sptr d_noise;
 
       filter::fractional_resampler_cc::sptr d_timing_offset;
+      // exactly one of these is used, chosen by tap sparsity at
+      // construction time
       filter::fir_filter_ccc::sptr d_multipath;
+      filter::sparse_fir_filter_cc::sptr d_multipath_sparse;
 
       std::vector<gr_complex> d_taps;
 
+      void split_taps(std::vector<int> &delays,
+		      std::vector<gr_complex> &values) const;
+
     public:
       channel_model_impl(double noise_voltage,
 			 double frequency_offset,
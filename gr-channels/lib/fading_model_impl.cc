@@ -22,6 +22,7 @@
 
 #include "fading_model_impl.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
 #include <iostream>
 
 #include <boost/format.hpp>
@@ -116,9 +117,15 @@ namespace gr {
     {
         const gr_complex* in = (const gr_complex*) input_items[0];
         gr_complex* out = (gr_complex*) output_items[0];
-        for(int i=0; i<noutput_items; i++){
-            out[i] = in[i] * d_fader.next_sample();
+
+        // generate the fading gains for the whole buffer, then apply
+        // them with a single vectorized multiply
+        if((int)d_gains.size() < noutput_items){
+            d_gains.resize(noutput_items);
         }
+        d_fader.next_samples(&d_gains[0], noutput_items);
+        volk_32fc_x2_multiply_32fc(out, in, &d_gains[0], noutput_items);
+
         return noutput_items;
     }
 
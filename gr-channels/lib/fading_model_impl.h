@@ -41,6 +41,7 @@ namespace gr {
     {
     private:
       gr::channels::flat_fader_impl d_fader;
+      std::vector<gr_complex> d_gains;   // per-call fading gain buffer
 
     public:
       fading_model_impl(unsigned int N, float fDTs, bool LOS, float K, int seed);
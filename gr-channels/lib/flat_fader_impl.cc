@@ -21,6 +21,8 @@
  */
 
 #include <flat_fader_impl.h>
+#include <volk/volk.h>
+#include <algorithm>
 
 namespace gr {
   namespace channels {
@@ -102,6 +104,72 @@ namespace gr {
 
     }
 
+    void flat_fader_impl::next_samples(gr_complex *H, int count)
+    {
+        // Batched version of next_sample().  The random walk angle
+        // theta moves by at most d_step per sample (~1e-4 rad), so it
+        // is held fixed across a short chunk; every oscillator then
+        // advances at a constant rate and the inner loop is one table
+        // lookup and one add per oscillator, with the oscillators
+        // summed by volk instead of sample-at-a-time.
+        static const int CHUNK = 256;
+
+        for(int base = 0; base < count; base += CHUNK) {
+            int nsamp = std::min(CHUNK, count - base);
+
+            if((int)d_acc_i.size() < nsamp) {
+                d_acc_i.resize(nsamp);
+                d_acc_q.resize(nsamp);
+                d_tmp.resize(nsamp);
+            }
+            std::fill(d_acc_i.begin(), d_acc_i.begin()+nsamp, 0.0f);
+            std::fill(d_acc_q.begin(), d_acc_q.begin()+nsamp, 0.0f);
+
+            for(int n=1; n<d_N; n++){
+                float alpha_n = (2*M_PI*n - M_PI + d_theta)/4*d_N;
+                float w_i = 2*M_PI*d_fDTs*d_table.cos(alpha_n);
+                float w_q = 2*M_PI*d_fDTs*d_table.sin(alpha_n);
+                // start phases reduced in double so a long-running
+                // sample counter does not eat the float mantissa
+                float p_i = (float)::fmod(w_i*(double)d_m + d_psi[n+1], 2*M_PI);
+                float p_q = (float)::fmod(w_q*(double)d_m + d_phi[n+1], 2*M_PI);
+
+                for(int k=0; k<nsamp; k++){
+                    d_tmp[k] = d_table.cos(p_i);
+                    p_i += w_i;
+                }
+                volk_32f_x2_add_32f(&d_acc_i[0], &d_acc_i[0], &d_tmp[0], nsamp);
+
+                for(int k=0; k<nsamp; k++){
+                    d_tmp[k] = d_table.cos(p_q);
+                    p_q += w_q;
+                }
+                volk_32f_x2_add_32f(&d_acc_q[0], &d_acc_q[0], &d_tmp[0], nsamp);
+            }
+
+            if(d_LOS){
+                float w_los = 2*M_PI*d_fDTs*d_table.cos(d_theta_los);
+                float p_los = (float)::fmod(w_los*(double)d_m + d_psi[0], 2*M_PI);
+                float s = scale_sin*scale_nlos;
+                for(int k=0; k<nsamp; k++){
+                    H[base+k] = gr_complex(d_acc_i[k], d_acc_q[k])*s
+                        + gr_complex(d_table.cos(p_los), d_table.sin(p_los))*scale_los;
+                    p_los += w_los;
+                }
+            }
+            else {
+                for(int k=0; k<nsamp; k++){
+                    H[base+k] = gr_complex(d_acc_i[k]*scale_sin, d_acc_q[k]*scale_sin);
+                }
+            }
+
+            d_m += nsamp;
+            for(int k=0; k<nsamp; k++){
+                update_theta();
+            }
+        }
+    }
+
     void flat_fader_impl::update_theta()
     {
         d_theta += (d_step*rv_2());
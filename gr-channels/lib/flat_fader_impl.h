@@ -71,10 +71,14 @@ namespace gr {
         
         float scale_sin, scale_los, scale_nlos;
     
+        // batched accumulation buffers for next_samples()
+        std::vector<float> d_acc_i, d_acc_q, d_tmp;
+
         void update_theta();
-    
+
         flat_fader_impl(unsigned int N, float fDTs, bool LOS, float K, int seed);
         gr_complex next_sample();
+        void next_samples(gr_complex *H, int count);
     
     }; /* class flat_fader_impl */
   } /* namespace channels */
@@ -82,21 +82,45 @@ namespace gr {
         const gr_complex* in = (const gr_complex*) input_items[0];
         gr_complex* out = (gr_complex*) output_items[0];
 
+        size_t nfaders = d_faders.size();
+        size_t ntaps = d_taps.size();
+
+        // run each fader over the whole buffer up front
+        if(d_fader_gains.size() != nfaders){
+            d_fader_gains.resize(nfaders);
+        }
+        for(size_t j=0; j<nfaders; j++){
+            if((int)d_fader_gains[j].size() < noutput_items){
+                d_fader_gains[j].resize(noutput_items);
+            }
+            d_faders[j]->next_samples(&d_fader_gains[j][0], noutput_items);
+        }
+
+        // the sinc interpolation weights depend only on the delays,
+        // which are fixed for the duration of the call
+        if(d_interp.size() != nfaders*ntaps){
+            d_interp.resize(nfaders*ntaps);
+        }
+        for(size_t j=0; j<nfaders; j++){
+            for(size_t k=0; k<ntaps; k++){
+                float dist = k-d_delays[j];
+                d_interp[j*ntaps+k] = d_sintable.sinc(2*M_PI*dist) * d_mags[j];
+            }
+        }
+
         // loop over each output sample
         for(int i=0; i<noutput_items; i++){
 
             // clear the current values in each tap
-            for(size_t j=0; j<d_taps.size(); j++){
+            for(size_t j=0; j<ntaps; j++){
                 d_taps[j] = gr_complex(0,0);
             }
-            
+
             // add each flat fading component to the taps
-            for(size_t j=0; j<d_faders.size(); j++){
-                gr_complex ff_H(d_faders[j]->next_sample());
-                for(size_t k=0; k<d_taps.size(); k++){
-                    float dist = k-d_delays[j];
-                    float interpmag = d_sintable.sinc(2*M_PI*dist);       
-                    d_taps[k] += ff_H * interpmag * d_mags[j];
+            for(size_t j=0; j<nfaders; j++){
+                gr_complex ff_H(d_fader_gains[j][i]);
+                for(size_t k=0; k<ntaps; k++){
+                    d_taps[k] += ff_H * d_interp[j*ntaps+k];
                 }
             }
 
@@ -44,6 +44,9 @@ namespace gr {
       std::vector<float> d_delays;
       std::vector<float> d_mags;
       sincostable d_sintable;
+      // per-call scratch: batched fader gains and tap interpolation weights
+      std::vector<std::vector<gr_complex> > d_fader_gains;
+      std::vector<float> d_interp;
 
     public:
       selective_fading_model_impl(unsigned int N, float fDTs, bool LOS, float K, int seed, std::vector<float> delays, std::vector<float> mags, int ntaps);
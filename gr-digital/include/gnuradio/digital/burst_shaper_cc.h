@@ -0,0 +1,78 @@
+/* -*- c++ -*- */
+/* Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_DIGITAL_BURST_SHAPER_CC_H
+#define INCLUDED_DIGITAL_BURST_SHAPER_CC_H
+
+#include <gnuradio/digital/api.h>
+#include <gnuradio/tagged_stream_block.h>
+
+namespace gr {
+  namespace digital {
+
+    /*!
+     * \brief Apply window ramps and zero padding to tagged bursts
+     * \ingroup packet_operators_blk
+     *
+     * \details
+     * Input: tagged stream of complex bursts, delimited by a length
+     * tag as used by gr::tagged_stream_block.
+     *
+     * Output: each burst with the first half of \p taps multiplied
+     * onto its head, the second half multiplied onto its tail, and
+     * \p pre_padding / \p post_padding zero samples inserted before
+     * and after it.  The length tag is updated to cover the padded
+     * burst.  This replaces the usual multiply_cc plus vector-source
+     * ramp construction with a single pass over the burst.
+     *
+     * \p taps is the complete window: an even number of taps splits
+     * cleanly into ramp-up and ramp-down halves; with an odd number
+     * the middle tap is unused.  Bursts shorter than the two ramps
+     * combined get both ramps applied on top of each other.
+     */
+    class DIGITAL_API burst_shaper_cc : virtual public tagged_stream_block
+    {
+     public:
+      typedef boost::shared_ptr<burst_shaper_cc> sptr;
+
+      /*!
+       * \param taps window function; first half ramps the burst up,
+       *             second half ramps it down
+       * \param pre_padding number of zero samples before each burst
+       * \param post_padding number of zero samples after each burst
+       * \param length_tag_name length tag key
+       */
+      static sptr make(const std::vector<gr_complex> &taps,
+                       int pre_padding = 0,
+                       int post_padding = 0,
+                       const std::string &length_tag_name = "packet_len");
+
+      //! Returns the number of zero samples inserted before each burst
+      virtual int pre_padding() const = 0;
+
+      //! Returns the number of zero samples inserted after each burst
+      virtual int post_padding() const = 0;
+    };
+
+  } // namespace digital
+} // namespace gr
+
+#endif /* INCLUDED_DIGITAL_BURST_SHAPER_CC_H */
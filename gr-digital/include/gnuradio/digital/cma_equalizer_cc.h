@@ -67,6 +67,19 @@ namespace gr {
       virtual void set_gain(float mu) = 0;
       virtual float modulus() const = 0;
       virtual void set_modulus(float mod) = 0;
+
+      /*!
+       * \brief Set the number of symbols filtered between tap updates.
+       *
+       * With the default of 1 the taps adapt after every symbol.
+       * Larger values filter the whole block with fixed taps and apply
+       * one aggregated gradient update per block, which removes the
+       * serial dependency from the inner loop at a marginal cost in
+       * convergence speed.
+       */
+      virtual void set_block_size(int block_size) = 0;
+      virtual int block_size() const = 0;
+
     };
 
   } /* namespace digital */
@@ -82,7 +82,42 @@ namespace gr {
       unsigned int decision_maker_pe(const gr_complex *sample, float *phase_error);
       //! Calculates distance.
       //unsigned int decision_maker_e(const gr_complex *sample, float *error);
-  
+
+      /*! \brief Hard decisions for a whole buffer of samples.
+       *
+       * \details Writes one decision per symbol into \p decisions;
+       * \p samples must hold nsymbols*dimensionality() complex
+       * values. When a hard decision LUT has been generated with
+       * #gen_hard_dec_lut, the decisions come straight out of the
+       * table; otherwise #decision_maker is called per symbol.
+       *
+       * \param samples The complex samples to slice.
+       * \param decisions Output buffer of nsymbols decisions.
+       * \param nsymbols Number of symbols to decide.
+       */
+      void decision_maker_v(const gr_complex *samples,
+                            unsigned char *decisions,
+                            unsigned int nsymbols);
+
+      /*! \brief Generates the hard decision LUT.
+       *
+       * \details Quantizes the complex plane into a 2^precision x
+       * 2^precision grid over the bounding box of the constellation
+       * and stores the symbol of the nearest point for each cell, so
+       * a decision becomes a single table index instead of a search
+       * over all points. Samples outside the box clamp to the edge
+       * cells, which agrees with the nearest-neighbor rule.
+       *
+       * Only defined for dimensionality 1 constellations with no
+       * more than 256 points.
+       *
+       * \param precision Number of bits of precision on each axis.
+       */
+      void gen_hard_dec_lut(int precision);
+
+      //! Returns true if the hard decision LUT has been generated.
+      bool has_hard_dec_lut();
+
       //! Calculates metrics for all points in the constellation.
       //! For use with the viterbi algorithm.
       virtual void calc_metric(const gr_complex *sample, float *metric, gr::digital::trellis_metric_type_t type);
@@ -197,6 +232,43 @@ namespace gr {
        */
       std::vector<float> soft_decision_maker(gr_complex sample);
 
+      /*! \brief Generates the max-log soft decision region table.
+       *
+       * \details Quantizes the complex plane into a 2^precision x
+       * 2^precision grid over the bounding box of the constellation
+       * and stores, for every cell and every bit, the nearest
+       * constellation point carrying a 0 and the nearest carrying a
+       * 1 in that bit. #soft_decision_maker_v then computes max-log
+       * LLRs from the two competitor distances per bit instead of
+       * summing exp() terms over every point, which is the
+       * approximation LDPC and convolutional decoders expect anyway.
+       *
+       * Only defined for dimensionality 1 constellations.
+       *
+       * \param precision Number of bits of precision on each axis.
+       * \param npwr Estimate of the noise power (if known).
+       */
+      void gen_max_log_dec_table(int precision, float npwr=1.0);
+
+      //! Returns true if the max-log region table has been generated.
+      bool has_max_log_dec_table();
+
+      /*! \brief Soft decisions for a whole buffer of samples.
+       *
+       * \details Writes bits_per_symbol() LLRs per sample into \p
+       * llrs, in the same bit order as #soft_decision_maker. When
+       * the max-log region table has been generated with
+       * #gen_max_log_dec_table the decisions come from the table;
+       * otherwise #soft_decision_maker is called per sample.
+       *
+       * \param samples The complex samples to get soft decisions for.
+       * \param llrs Output buffer of nsymbols*bits_per_symbol() floats.
+       * \param nsymbols Number of symbols to process.
+       */
+      void soft_decision_maker_v(const gr_complex *samples,
+                                 float *llrs,
+                                 unsigned int nsymbols);
+
 
     protected:
       std::vector<gr_complex> d_constellation;
@@ -214,6 +286,21 @@ namespace gr {
       int d_lut_precision;
       float d_lut_scale;
 
+      std::vector<unsigned char> d_hard_dec_lut;
+      int d_hard_lut_precision;
+      float d_hard_lut_re_min, d_hard_lut_im_min;
+      float d_hard_lut_re_scale, d_hard_lut_im_scale;
+
+      //! Per-cell, per-bit nearest 0/1 competitor point indices
+      std::vector<unsigned short> d_maxlog_pairs;
+      int d_maxlog_precision;
+      int d_maxlog_bits;
+      float d_maxlog_gain;   // 1/(2*npwr)
+      float d_maxlog_re_min, d_maxlog_im_min;
+      float d_maxlog_re_scale, d_maxlog_im_scale;
+
+      unsigned int hard_lut_decision(const gr_complex *sample);
+
       float get_distance(unsigned int index, const gr_complex *sample);
       unsigned int get_closest_point(const gr_complex *sample);
       void calc_arity();
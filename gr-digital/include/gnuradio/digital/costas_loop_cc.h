@@ -75,10 +75,30 @@ namespace gr {
        */
       static sptr make(float loop_bw, int order);
 
-      /*! 
+      /*!
        * Returns the current value of the loop error.
        */
       virtual float error() const = 0;
+
+      /*!
+       * Set the number of samples processed per loop update.
+       *
+       * The default of 1 is the classic Costas loop: one NCO value,
+       * phase detector evaluation, and loop update per sample.  With a
+       * chunk size of N the block derotates N samples at once with the
+       * current frequency estimate (a volk rotator call instead of a
+       * sincos per sample), averages the phase detector output over the
+       * chunk, and advances the loop once.  This divides the effective
+       * loop update rate by N, so the loop bandwidth should be scaled
+       * accordingly; use small chunks (4-16) unless the residual
+       * carrier dynamics are slow.
+       *
+       * \param chunk number of samples per loop update (>= 1)
+       */
+      virtual void set_chunk_size(int chunk) = 0;
+
+      //! Returns the number of samples processed per loop update.
+      virtual int chunk_size() const = 0;
     };
 
   } /* namespace digital */
@@ -0,0 +1,110 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_DIGITAL_CPMMOD_FUSED_BC_H
+#define INCLUDED_DIGITAL_CPMMOD_FUSED_BC_H
+
+#include <gnuradio/digital/api.h>
+#include <gnuradio/sync_interpolator.h>
+#include <gnuradio/analog/cpm.h>
+
+namespace gr {
+  namespace digital {
+
+    /*!
+     * \brief Monolithic CPM/GMSK modulator
+     * \ingroup modulators_blk
+     *
+     * \details
+     * Single-block equivalent of gr::digital::cpmmod_bc. Instead of
+     * chaining char_to_float, interp_fir_filter_fff and
+     * frequency_modulator_fc as a hier block, symbol upsampling,
+     * pulse-shape filtering (as a polyphase bank over the phase
+     * response), phase integration and the complex exponential (via
+     * the fixed-point sincos table, like the frequency modulator) run
+     * in one fused pass per output sample. This removes two
+     * intermediate streams and two scheduler hops per instance, which
+     * matters when many modulators run in one flowgraph.
+     *
+     * Input and output match cpmmod_bc: symbols from an M-ary
+     * alphabet +/-1, +/-3, ..., +/-(M-1) in, the phase-modulated
+     * signal out.
+     */
+    class DIGITAL_API cpmmod_fused_bc : virtual public sync_interpolator
+    {
+    public:
+      // gr::digital::cpmmod_fused_bc::sptr
+      typedef boost::shared_ptr<cpmmod_fused_bc> sptr;
+
+      /*!
+       * Make fused CPM modulator block.
+       *
+       * \param type The modulation type. Can be one of LREC, LRC, LSRC, TFM
+       *             or GAUSSIAN. See gr_cpm::phase_response() for a
+       *             detailed description.
+       * \param h The modulation index. \f$ h \cdot \pi\f$ is the maximum
+       *          phase change that can occur between two symbols.  Set
+       *          this to 0.5 for Minimum Shift Keying variants.
+       * \param samples_per_sym Samples per symbol.
+       * \param L The length of the phase duration in symbols. For L=1, this
+       *          yields full- response CPM symbols, for L > 1,
+       *          partial-response.
+       * \param beta For LSRC, this is the rolloff factor. For Gaussian
+       *             pulses, this is the 3 dB time-bandwidth product.
+       */
+      static sptr make(analog::cpm::cpm_type type, float h,
+		       int samples_per_sym,
+		       int L, double beta=0.3);
+
+      /*!
+       * Make fused GMSK modulator block (type GAUSSIAN, h = 0.5).
+       *
+       * \param samples_per_sym Samples per symbol.
+       * \param L The length of the phase duration in symbols.
+       * \param beta The 3 dB time-bandwidth product.
+       */
+      static sptr make_gmskmod_fused_bc(int samples_per_sym=2,
+					int L=4, double beta=0.3);
+
+      //! Return the phase response FIR taps
+      virtual std::vector<float> taps() const = 0;
+
+      //! Return the type of CPM modulator
+      virtual int type() const = 0;
+
+      //! Return the modulation index of the modulator.
+      virtual float index() const = 0;
+
+      //! Return the number of samples per symbol
+      virtual int samples_per_sym() const = 0;
+
+      //! Return the length of the phase duration (in symbols)
+      virtual int length() const = 0;
+
+      //! Return the value of beta for the modulator
+      virtual double beta() const = 0;
+    };
+
+  } /* namespace digital */
+} /* namespace gr */
+
+#endif /* INCLUDED_DIGITAL_CPMMOD_FUSED_BC_H */
@@ -52,6 +52,35 @@ namespace gr {
     DIGITAL_API unsigned int 
     crc32(const std::string buf);
 
+    /*!
+     * \brief Streaming CRC-32 accumulator (IEEE 802.3 polynomial,
+     * reflected, as used by gr::digital::crc32_bb)
+     * \ingroup packet_operators_blk
+     *
+     * \details
+     * Checksums data straight out of the caller's buffer, a chunk at
+     * a time, with no intermediate copies.  The implementation uses
+     * slice-by-8 tables and, where the build enables it, carry-less
+     * multiply (PCLMULQDQ) folding behind a runtime CPU check.
+     */
+    class DIGITAL_API crc32_accum
+    {
+    public:
+      crc32_accum() { reset(); }
+
+      //! Start a new checksum
+      void reset() { d_crc = 0xffffffff; }
+
+      //! Fold \p len bytes at \p data into the running checksum
+      void update(const unsigned char *data, size_t len);
+
+      //! Return the finished CRC (final inversion applied)
+      unsigned int result() const { return d_crc ^ 0xffffffff; }
+
+    private:
+      unsigned int d_crc;
+    };
+
   } /* namespace digital */
 } /* namespace gr */
 
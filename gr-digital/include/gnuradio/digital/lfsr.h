@@ -155,6 +155,12 @@ namespace gr {
       }
 
       int mask() const { return d_mask; }
+
+      /*!
+       * Current shift register contents; block-oriented scrambler
+       * code uses this to detect when the sequence has wrapped.
+       */
+      uint32_t shift_register() const { return d_shift_register; }
     };
 
   } /* namespace digital */
@@ -62,6 +62,20 @@ namespace gr {
      */
     class DIGITAL_API ofdm_equalizer_simpledfe : public ofdm_equalizer_1d_pilots
     {
+     private:
+      //! Per pilot-carrier-set scatter tables of the data carrier positions
+      std::vector<std::vector<int> > d_data_carriers;
+
+      // Aligned scratch buffers (d_fft_len entries each) for the
+      // batched per-symbol equalize-and-update pass
+      gr_complex *d_in_buf;
+      gr_complex *d_chan_buf;
+      gr_complex *d_eq_buf;
+      gr_complex *d_est_buf;
+      float *d_mag_buf;
+      float *d_recip_buf;
+      unsigned char *d_dec_buf;
+
      public:
       typedef boost::shared_ptr<ofdm_equalizer_simpledfe> sptr;
 
@@ -0,0 +1,101 @@
+/* -*- c++ -*- */
+/* Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_DIGITAL_OFDM_RX_ENGINE_VCC_H
+#define INCLUDED_DIGITAL_OFDM_RX_ENGINE_VCC_H
+
+#include <gnuradio/digital/api.h>
+#include <gnuradio/digital/ofdm_equalizer_base.h>
+#include <gnuradio/block.h>
+
+namespace gr {
+  namespace digital {
+
+    /*!
+     * \brief Fused OFDM receiver: channel estimation, equalization and
+     *        serialization in one block.
+     * \ingroup ofdm_blk
+     *
+     * \details
+     * This block performs the work of the chain
+     * ofdm_chanest_vcvc -> ofdm_frame_equalizer_vcvc -> ofdm_serializer_vcc
+     * in a single pass per frame. The output is bit-identical to the
+     * chained blocks, but every OFDM symbol is touched exactly once
+     * instead of passing through three stream buffers with a tag
+     * resynchronization at every hop.
+     *
+     * A frame consists of one or two sync symbols followed by a fixed
+     * number of data symbols. Per frame, the sync symbol(s) are used to
+     * estimate the coarse carrier offset and the initial channel taps
+     * (same algorithms as ofdm_chanest_vcvc). The data symbols are then
+     * shifted, phase-corrected and equalized with the given equalizer
+     * object, and the occupied carriers are picked out into a tagged
+     * stream of complex scalars.
+     *
+     * If a tag with the key \p packet_len_tag_key is found on the frame,
+     * its value caps the number of output items, just like in
+     * ofdm_serializer_vcc; the tag is replaced with the actual number of
+     * items produced. All other tags are placed on the output item
+     * corresponding to the symbol they were on (tags on the sync symbols
+     * go on the first output item).
+     *
+     * Input: Complex vectors of length \p fft_len (frames of
+     *        sync + data symbols)
+     * Output: Complex scalars, in the same order as specified in
+     *         occupied_carriers, tagged with the packet length.
+     */
+    class DIGITAL_API ofdm_rx_engine_vcc : virtual public block
+    {
+     public:
+      typedef boost::shared_ptr<ofdm_rx_engine_vcc> sptr;
+
+      /*!
+       * \param sync_symbol1 See ofdm_chanest_vcvc.
+       * \param sync_symbol2 See ofdm_chanest_vcvc.
+       * \param n_data_symbols The number of data symbols following the sync symbol(s) in every frame.
+       * \param equalizer The equalizer object that will do the actual work
+       * \param cp_len Length of the cyclic prefix in samples (required to correct the frequency offset)
+       * \param occupied_carriers See ofdm_carrier_allocator_cvc.
+       * \param packet_len_tag_key The key of the tag identifying the number of complex symbols in this packet.
+       * \param eq_noise_red_len See ofdm_chanest_vcvc.
+       * \param max_carr_offset See ofdm_chanest_vcvc.
+       * \param force_one_sync_symbol See ofdm_chanest_vcvc.
+       * \param input_is_shifted If the input has the DC carrier on index 0 (i.e. it is not FFT shifted), set this to false
+       */
+      static sptr make(
+	  const std::vector<gr_complex> &sync_symbol1,
+	  const std::vector<gr_complex> &sync_symbol2,
+	  int n_data_symbols,
+	  ofdm_equalizer_base::sptr equalizer,
+	  int cp_len,
+	  const std::vector<std::vector<int> > &occupied_carriers,
+	  const std::string &packet_len_tag_key="packet_len",
+	  int eq_noise_red_len=0,
+	  int max_carr_offset=-1,
+	  bool force_one_sync_symbol=false,
+	  bool input_is_shifted=true
+      );
+    };
+
+  } // namespace digital
+} // namespace gr
+
+#endif /* INCLUDED_DIGITAL_OFDM_RX_ENGINE_VCC_H */
@@ -102,6 +102,19 @@ namespace gr {
 	      int bits_per_byte=1);
 
     protected:
+      /*!
+       * Gather \p nsyms header symbols (of \p d_bits_per_byte bits
+       * each, LSB first) into one 64-bit word.
+       */
+      unsigned long long extract_header_word(const unsigned char *in, int nsyms);
+
+      /*!
+       * Scatter the low bits of \p word onto \p nsyms header symbols
+       * of \p d_bits_per_byte bits each, LSB first.  Inverse of
+       * extract_header_word().
+       */
+      void insert_header_word(unsigned char *out, unsigned long long word, int nsyms);
+
       long d_header_len;
       pmt::pmt_t d_len_tag_key;
       pmt::pmt_t d_num_tag_key;
@@ -26,10 +26,35 @@
 
 #include "additive_scrambler_bb_impl.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <string.h>
+#include <stdint.h>
 
 namespace gr {
   namespace digital {
-    
+
+    //! Largest keystream table we're willing to precompute (bytes)
+    static const size_t MAX_KEYSTREAM_LEN = 1 << 22;
+
+    // XOR a run of keystream into the input.  The compiler turns the
+    // word loop into SIMD loads/stores; memcpy keeps the accesses
+    // legal at any alignment.
+    static inline void
+    _xor_bytes(unsigned char *out, const unsigned char *in,
+	       const unsigned char *key, int n)
+    {
+      int i = 0;
+      for(; i + 8 <= n; i += 8) {
+	uint64_t v, k;
+	memcpy(&v, in + i, 8);
+	memcpy(&k, key + i, 8);
+	v ^= k;
+	memcpy(out + i, &v, 8);
+      }
+      for(; i < n; i++)
+	out[i] = in[i] ^ key[i];
+    }
+
     additive_scrambler_bb::sptr
     additive_scrambler_bb::make (int mask, int seed,
 				 int len, int count,
@@ -52,7 +77,8 @@ namespace gr {
 	d_lfsr(mask, seed, len),
 	d_count(reset_tag_key.empty() ? count : -1),
 	d_bytes(0), d_len(len), d_seed(seed),
-	d_bits_per_byte(bits_per_byte), d_reset_tag_key(pmt::string_to_symbol(reset_tag_key))
+	d_bits_per_byte(bits_per_byte), d_reset_tag_key(pmt::string_to_symbol(reset_tag_key)),
+	d_key_pos(0), d_key_loop(0)
     {
       if (d_count < -1) {
       	throw std::invalid_argument("count must be non-negative!");
@@ -60,6 +86,7 @@ namespace gr {
       if (d_bits_per_byte < 1 || d_bits_per_byte > 8) {
       	throw std::invalid_argument("bits_per_byte must be in [1, 8]");
       }
+      _build_keystream();
     }
 
     additive_scrambler_bb_impl::~additive_scrambler_bb_impl()
@@ -112,6 +139,70 @@ namespace gr {
       return reset_index;
     }
 
+    //! Advance the LFSR by one output byte's worth of bits
+    static inline unsigned char
+    _next_scramble_byte(digital::lfsr &l, int bits_per_byte)
+    {
+      unsigned char scramble_byte = 0x00;
+      for (int k = 0; k < bits_per_byte; k++) {
+	scramble_byte ^= (l.next_bit() << k);
+      }
+      return scramble_byte;
+    }
+
+    // Tabulate the scramble bytes of the free-running LFSR, so work()
+    // can XOR whole words of keystream instead of clocking the
+    // register one bit at a time.  The byte sequence is eventually
+    // periodic but the seed need not lie on the cycle (masks without
+    // an x^0 tap have a transient), so we run Brent's cycle detection
+    // on the advance-one-byte map to find the cycle length lam and
+    // the transient length mu, store mu+lam bytes and loop back to
+    // offset mu on wrap.  If that exceeds MAX_KEYSTREAM_LEN bytes we
+    // leave the table empty and work() keeps the bit-serial loop.
+    void
+    additive_scrambler_bb_impl::_build_keystream()
+    {
+      digital::lfsr x0(d_lfsr.mask(), d_seed, d_len);
+
+      digital::lfsr tortoise = x0, hare = x0;
+      size_t power = 1, lam = 1;
+      _next_scramble_byte(hare, d_bits_per_byte);
+      while (tortoise.shift_register() != hare.shift_register()) {
+	if (power == lam) {
+	  tortoise = hare;
+	  power *= 2;
+	  lam = 0;
+	}
+	_next_scramble_byte(hare, d_bits_per_byte);
+	lam++;
+	if (lam > MAX_KEYSTREAM_LEN) {
+	  return;
+	}
+      }
+
+      tortoise = x0;
+      hare = x0;
+      for (size_t i = 0; i < lam; i++) {
+	_next_scramble_byte(hare, d_bits_per_byte);
+      }
+      size_t mu = 0;
+      while (tortoise.shift_register() != hare.shift_register()) {
+	_next_scramble_byte(tortoise, d_bits_per_byte);
+	_next_scramble_byte(hare, d_bits_per_byte);
+	mu++;
+	if (mu + lam > MAX_KEYSTREAM_LEN) {
+	  return;
+	}
+      }
+
+      d_keystream.reserve(mu + lam);
+      digital::lfsr l = x0;
+      for (size_t i = 0; i < mu + lam; i++) {
+	d_keystream.push_back(_next_scramble_byte(l, d_bits_per_byte));
+      }
+      d_key_loop = (int)mu;
+    }
+
     int
     additive_scrambler_bb_impl::work(int noutput_items,
 				     gr_vector_const_void_star &input_items,
@@ -121,15 +212,44 @@ namespace gr {
       unsigned char *out = (unsigned char *)output_items[0];
       int reset_index = _get_next_reset_index(noutput_items);
 
-      for(int i = 0; i < noutput_items; i++) {
-	unsigned char scramble_byte = 0x00;
-	for (int k = 0; k < d_bits_per_byte; k++) {
-	  scramble_byte ^= (d_lfsr.next_bit() << k);
+      if (d_keystream.empty()) {
+	// Period too long to tabulate; clock the LFSR bit by bit.
+	for(int i = 0; i < noutput_items; i++) {
+	  unsigned char scramble_byte = 0x00;
+	  for (int k = 0; k < d_bits_per_byte; k++) {
+	    scramble_byte ^= (d_lfsr.next_bit() << k);
+	  }
+	  out[i] = in[i] ^ scramble_byte;
+	  d_bytes++;
+	  if (i == reset_index) {
+	    d_lfsr.reset();
+	    d_bytes = 0;
+	    reset_index = _get_next_reset_index(noutput_items, reset_index);
+	  }
+	}
+	return noutput_items;
+      }
+
+      int i = 0;
+      while (i < noutput_items) {
+	// The item at reset_index is still scrambled with the current
+	// keystream phase; the reset takes effect after it.
+	bool do_reset = (reset_index >= i && reset_index < noutput_items);
+	int end = do_reset ? reset_index + 1 : noutput_items;
+	int n = end - i;
+	d_bytes += n;
+	while (n > 0) {
+	  int chunk = (int)std::min((size_t)n, d_keystream.size() - (size_t)d_key_pos);
+	  _xor_bytes(&out[i], &in[i], &d_keystream[d_key_pos], chunk);
+	  d_key_pos += chunk;
+	  if (d_key_pos == (int)d_keystream.size()) {
+	    d_key_pos = d_key_loop;
+	  }
+	  i += chunk;
+	  n -= chunk;
 	}
-	out[i] = in[i] ^ scramble_byte;
-	d_bytes++;
-	if (i == reset_index) {
-	  d_lfsr.reset();
+	if (do_reset) {
+	  d_key_pos = 0;
 	  d_bytes = 0;
 	  reset_index = _get_next_reset_index(noutput_items, reset_index);
 	}
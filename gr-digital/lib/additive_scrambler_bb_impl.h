@@ -25,6 +25,7 @@
 
 #include <gnuradio/digital/additive_scrambler_bb.h>
 #include <gnuradio/digital/lfsr.h>
+#include <vector>
 
 namespace gr {
   namespace digital {
@@ -40,8 +41,12 @@ namespace gr {
       int      d_seed;
       int      d_bits_per_byte;
       pmt::pmt_t d_reset_tag_key; //!< Reset the LFSR when this tag is received
+      std::vector<unsigned char> d_keystream; //!< Precomputed scramble bytes (empty: use bit loop)
+      int      d_key_pos;  //!< Read position in d_keystream
+      int      d_key_loop; //!< Where the keystream cycle restarts after wrapping
 
       int _get_next_reset_index(int noutput_items, int last_reset_index=-1);
+      void _build_keystream();
 
     public:
       additive_scrambler_bb_impl(int mask, int seed,
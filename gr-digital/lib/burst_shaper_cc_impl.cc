@@ -0,0 +1,138 @@
+/* -*- c++ -*- */
+/* Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <cstring>
+#include <stdexcept>
+#include "burst_shaper_cc_impl.h"
+
+namespace gr {
+  namespace digital {
+
+    burst_shaper_cc::sptr
+    burst_shaper_cc::make(const std::vector<gr_complex> &taps,
+                          int pre_padding,
+                          int post_padding,
+                          const std::string &length_tag_name)
+    {
+      return gnuradio::get_initial_sptr(
+          new burst_shaper_cc_impl(taps, pre_padding, post_padding,
+                                   length_tag_name));
+    }
+
+    burst_shaper_cc_impl::burst_shaper_cc_impl(
+        const std::vector<gr_complex> &taps,
+        int pre_padding,
+        int post_padding,
+        const std::string &length_tag_name)
+      : tagged_stream_block("burst_shaper_cc",
+                   io_signature::make(1, 1, sizeof(gr_complex)),
+                   io_signature::make(1, 1, sizeof(gr_complex)),
+                   length_tag_name),
+        d_up_ramp(taps.begin(), taps.begin() + taps.size()/2),
+        d_down_ramp(taps.end() - taps.size()/2, taps.end()),
+        d_pre_padding(pre_padding),
+        d_post_padding(post_padding)
+    {
+      if (d_pre_padding < 0 || d_post_padding < 0) {
+        throw std::invalid_argument("Padding must be non-negative.");
+      }
+      set_tag_propagation_policy(TPP_DONT);
+    }
+
+    burst_shaper_cc_impl::~burst_shaper_cc_impl()
+    {
+    }
+
+    int
+    burst_shaper_cc_impl::calculate_output_stream_length(
+        const gr_vector_int &ninput_items)
+    {
+      return ninput_items[0] + d_pre_padding + d_post_padding;
+    }
+
+    int
+    burst_shaper_cc_impl::work(int noutput_items,
+                               gr_vector_int &ninput_items,
+                               gr_vector_const_void_star &input_items,
+                               gr_vector_void_star &output_items)
+    {
+      const gr_complex *in = (const gr_complex *) input_items[0];
+      gr_complex *out = (gr_complex *) output_items[0];
+      int burst_len = ninput_items[0];
+      int up = d_up_ramp.size();
+      int down = d_down_ramp.size();
+
+      memset(out, 0, d_pre_padding * sizeof(gr_complex));
+      out += d_pre_padding;
+
+      if (burst_len >= up + down) {
+        // the common case: one volk multiply per ramp, one memcpy for
+        // the flat middle of the burst
+        if (up) {
+          volk_32fc_x2_multiply_32fc(out, in, &d_up_ramp[0], up);
+        }
+        memcpy(out + up, in + up,
+               (burst_len - up - down) * sizeof(gr_complex));
+        if (down) {
+          volk_32fc_x2_multiply_32fc(out + burst_len - down,
+                                     in + burst_len - down,
+                                     &d_down_ramp[0], down);
+        }
+      }
+      else {
+        // burst shorter than the ramps: overlap them
+        for (int i = 0; i < burst_len; i++) {
+          gr_complex gain(1, 0);
+          if (i < up) {
+            gain *= d_up_ramp[i];
+          }
+          if (i >= burst_len - down) {
+            gain *= d_down_ramp[i - (burst_len - down)];
+          }
+          out[i] = in[i] * gain;
+        }
+      }
+
+      memset(out + burst_len, 0, d_post_padding * sizeof(gr_complex));
+
+      // shift the burst's tags past the pre-padding; the length tag
+      // itself is maintained by the tagged_stream_block machinery
+      std::vector<tag_t> tags;
+      get_tags_in_range(tags, 0, nitems_read(0), nitems_read(0) + burst_len);
+      for (size_t i = 0; i < tags.size(); i++) {
+        add_item_tag(0,
+            nitems_written(0) + d_pre_padding
+              + (tags[i].offset - nitems_read(0)),
+            tags[i].key,
+            tags[i].value);
+      }
+
+      return burst_len + d_pre_padding + d_post_padding;
+    }
+
+  } /* namespace digital */
+} /* namespace gr */
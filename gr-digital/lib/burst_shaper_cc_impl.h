@@ -0,0 +1,60 @@
+/* -*- c++ -*- */
+/* Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_DIGITAL_BURST_SHAPER_CC_IMPL_H
+#define INCLUDED_DIGITAL_BURST_SHAPER_CC_IMPL_H
+
+#include <gnuradio/digital/burst_shaper_cc.h>
+
+namespace gr {
+  namespace digital {
+
+    class burst_shaper_cc_impl : public burst_shaper_cc
+    {
+     private:
+      std::vector<gr_complex> d_up_ramp;
+      std::vector<gr_complex> d_down_ramp;
+      int d_pre_padding;
+      int d_post_padding;
+
+     protected:
+      int calculate_output_stream_length(const gr_vector_int &ninput_items);
+
+     public:
+      burst_shaper_cc_impl(const std::vector<gr_complex> &taps,
+                           int pre_padding,
+                           int post_padding,
+                           const std::string &length_tag_name);
+      ~burst_shaper_cc_impl();
+
+      int pre_padding() const { return d_pre_padding; }
+      int post_padding() const { return d_post_padding; }
+
+      int work(int noutput_items,
+               gr_vector_int &ninput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } // namespace digital
+} // namespace gr
+
+#endif /* INCLUDED_DIGITAL_BURST_SHAPER_CC_IMPL_H */
@@ -110,6 +110,25 @@ namespace gr {
 
         std::vector<tag_t> tags;
         get_tags_in_range(tags, m, nitems_read(m), nitems_read(m)+noutput_items/d_D);
+
+        // fast path for the dominant D == 1 mappings (BPSK, QPSK,
+        // 16QAM, ...): no per-item tag bookkeeping or memcpy call,
+        // just table lookups unrolled four wide
+        if(d_D == 1 && tags.empty()) {
+          const @O_TYPE@ *table = &d_symbol_table[0];
+          int i = 0;
+          for(; i + 4 <= noutput_items; i += 4) {
+            out[0] = table[(unsigned int)in[i]];
+            out[1] = table[(unsigned int)in[i+1]];
+            out[2] = table[(unsigned int)in[i+2]];
+            out[3] = table[(unsigned int)in[i+3]];
+            out += 4;
+          }
+          for(; i < noutput_items; i++)
+            *out++ = table[(unsigned int)in[i]];
+          continue;
+        }
+
         tag_checker tchecker(tags);
 
         // per stream processing
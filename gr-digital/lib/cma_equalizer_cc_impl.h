@@ -41,6 +41,8 @@ namespace gr {
 
       float d_modulus;
       float d_mu;
+      int d_block_size;
+      std::vector<gr_complex> d_grad; // aggregated gradient of one block
 
     protected:
       gr_complex error(const gr_complex &out);
@@ -78,6 +80,19 @@ namespace gr {
 	d_modulus = mod;
       }
 
+      void set_block_size(int block_size)
+      {
+	if(block_size < 1) {
+	  throw std::out_of_range("cma_equalizer_cc_impl::set_block_size: Block size must be >= 1");
+	}
+	d_block_size = block_size;
+      }
+
+      int block_size() const
+      {
+	return d_block_size;
+      }
+
       int work(int noutput_items,
 	       gr_vector_const_void_star &input_items,
 	       gr_vector_void_star &output_items);
@@ -54,7 +54,9 @@ namespace gr {
       d_im_min(1e20),
       d_im_max(1e20),
       d_lut_precision(0),
-      d_lut_scale(0)
+      d_lut_scale(0),
+      d_hard_lut_precision(0),
+      d_maxlog_precision(0)
     {
       // Scale constellation points so that average magnitude is 1.
       float summed_mag = 0;
@@ -87,7 +89,9 @@ namespace gr {
       d_im_min(1e20),
       d_im_max(1e20),
       d_lut_precision(0.0),
-      d_lut_scale(0.0)
+      d_lut_scale(0.0),
+      d_hard_lut_precision(0),
+      d_maxlog_precision(0)
     {
       calc_arity();
     }
@@ -240,6 +244,81 @@ namespace gr {
       return decision_maker(&(sample[0]));
     }
 
+    void
+    constellation::decision_maker_v(const gr_complex *samples,
+                                    unsigned char *decisions,
+                                    unsigned int nsymbols)
+    {
+      if(has_hard_dec_lut()) {
+        int side = 1 << d_hard_lut_precision;
+        for(unsigned int i = 0; i < nsymbols; i++) {
+          int ix = static_cast<int>((samples[i].real() - d_hard_lut_re_min)
+                                    * d_hard_lut_re_scale);
+          int iy = static_cast<int>((samples[i].imag() - d_hard_lut_im_min)
+                                    * d_hard_lut_im_scale);
+          if(ix < 0) ix = 0; else if(ix >= side) ix = side-1;
+          if(iy < 0) iy = 0; else if(iy >= side) iy = side-1;
+          decisions[i] = d_hard_dec_lut[iy*side + ix];
+        }
+      }
+      else {
+        for(unsigned int i = 0; i < nsymbols; i++)
+          decisions[i] = decision_maker(&samples[i*d_dimensionality]);
+      }
+    }
+
+    unsigned int
+    constellation::hard_lut_decision(const gr_complex *sample)
+    {
+      int side = 1 << d_hard_lut_precision;
+      int ix = static_cast<int>((sample->real() - d_hard_lut_re_min)
+                                * d_hard_lut_re_scale);
+      int iy = static_cast<int>((sample->imag() - d_hard_lut_im_min)
+                                * d_hard_lut_im_scale);
+      if(ix < 0) ix = 0; else if(ix >= side) ix = side-1;
+      if(iy < 0) iy = 0; else if(iy >= side) iy = side-1;
+      return d_hard_dec_lut[iy*side + ix];
+    }
+
+    void
+    constellation::gen_hard_dec_lut(int precision)
+    {
+      if(d_dimensionality != 1)
+        throw std::runtime_error(
+          "gen_hard_dec_lut only works for dimensionality 1 constellations.");
+      if(d_arity > 256)
+        throw std::runtime_error(
+          "gen_hard_dec_lut only works for constellations of up to 256 points.");
+
+      max_min_axes();
+
+      int side = 1 << precision;
+      d_hard_lut_re_min = d_re_min;
+      d_hard_lut_im_min = d_im_min;
+      d_hard_lut_re_scale = side / (d_re_max - d_re_min);
+      d_hard_lut_im_scale = side / (d_im_max - d_im_min);
+
+      // Slice the center of every grid cell with the full
+      // nearest-neighbor search; lookups then reduce decisions to a
+      // quantize-and-index.
+      d_hard_dec_lut.resize(side*side);
+      for(int iy = 0; iy < side; iy++) {
+        for(int ix = 0; ix < side; ix++) {
+          gr_complex pt(d_hard_lut_re_min + (ix + 0.5f) / d_hard_lut_re_scale,
+                        d_hard_lut_im_min + (iy + 0.5f) / d_hard_lut_im_scale);
+          d_hard_dec_lut[iy*side + ix] = get_closest_point(&pt);
+        }
+      }
+
+      d_hard_lut_precision = precision;
+    }
+
+    bool
+    constellation::has_hard_dec_lut()
+    {
+      return d_hard_dec_lut.size() > 0;
+    }
+
 
     void
     constellation::gen_soft_dec_lut(int precision, float npwr)
@@ -362,6 +441,100 @@ namespace gr {
       }
     }
 
+    void
+    constellation::gen_max_log_dec_table(int precision, float npwr)
+    {
+      if(d_dimensionality != 1)
+        throw std::runtime_error(
+          "gen_max_log_dec_table only works for dimensionality 1 constellations.");
+
+      max_min_axes();
+
+      int side = 1 << precision;
+      int k = bits_per_symbol();
+      d_maxlog_re_min = d_re_min;
+      d_maxlog_im_min = d_im_min;
+      d_maxlog_re_scale = side / (d_re_max - d_re_min);
+      d_maxlog_im_scale = side / (d_im_max - d_im_min);
+
+      // For the center of every grid cell, find the closest
+      // constellation point carrying a 0 and the closest carrying a
+      // 1 in each bit. The max-log LLR of a sample in the cell is
+      // then just the difference of its distances to those two
+      // points.
+      d_maxlog_pairs.resize((size_t)side * side * 2 * k);
+      for(int iy = 0; iy < side; iy++) {
+        for(int ix = 0; ix < side; ix++) {
+          gr_complex pt(d_maxlog_re_min + (ix + 0.5f) / d_maxlog_re_scale,
+                        d_maxlog_im_min + (iy + 0.5f) / d_maxlog_im_scale);
+          unsigned short *pairs =
+            &d_maxlog_pairs[((size_t)iy*side + ix) * 2 * k];
+
+          for(int j = 0; j < k; j++) {
+            float mind[2] = { FLT_MAX, FLT_MAX };
+            for(unsigned int p = 0; p < d_arity; p++) {
+              int v = d_apply_pre_diff_code ? d_pre_diff_code[p] : (int)p;
+              int bit = (v >> j) & 1;
+              float dist = norm(pt - d_constellation[p]);
+              if(dist < mind[bit]) {
+                mind[bit] = dist;
+                pairs[2*j + bit] = p;
+              }
+            }
+          }
+        }
+      }
+
+      d_maxlog_gain = 1.0 / (2.0 * npwr);
+      d_maxlog_bits = k;
+      d_maxlog_precision = precision;
+    }
+
+    bool
+    constellation::has_max_log_dec_table()
+    {
+      return d_maxlog_pairs.size() > 0;
+    }
+
+    void
+    constellation::soft_decision_maker_v(const gr_complex *samples,
+                                         float *llrs,
+                                         unsigned int nsymbols)
+    {
+      if(has_max_log_dec_table()) {
+        int side = 1 << d_maxlog_precision;
+        int k = d_maxlog_bits;
+        for(unsigned int i = 0; i < nsymbols; i++) {
+          gr_complex s = samples[i];
+          int ix = static_cast<int>((s.real() - d_maxlog_re_min)
+                                    * d_maxlog_re_scale);
+          int iy = static_cast<int>((s.imag() - d_maxlog_im_min)
+                                    * d_maxlog_im_scale);
+          if(ix < 0) ix = 0; else if(ix >= side) ix = side-1;
+          if(iy < 0) iy = 0; else if(iy >= side) iy = side-1;
+
+          const unsigned short *pairs =
+            &d_maxlog_pairs[((size_t)iy*side + ix) * 2 * k];
+          float *o = &llrs[(size_t)i * k];
+
+          // Straight-line float arithmetic per bit; no exp/log
+          for(int j = 0; j < k; j++) {
+            float d0 = norm(s - d_constellation[pairs[2*j+0]]);
+            float d1 = norm(s - d_constellation[pairs[2*j+1]]);
+            o[k-1-j] = (d0 - d1) * d_maxlog_gain;
+          }
+        }
+      }
+      else {
+        int k = bits_per_symbol();
+        for(unsigned int i = 0; i < nsymbols; i++) {
+          std::vector<float> bits = soft_decision_maker(samples[i]);
+          for(int j = 0; j < k; j++)
+            llrs[(size_t)i*k + j] = bits[j];
+        }
+      }
+    }
+
     void
     constellation::max_min_axes()
     {
@@ -414,10 +587,12 @@ namespace gr {
     {}
     
     // Chooses points base on shortest distance.
-    // Inefficient.
+    // Inefficient unless the hard decision LUT has been generated.
     unsigned int
     constellation_calcdist::decision_maker(const gr_complex *sample)
     {
+      if(has_hard_dec_lut())
+        return hard_lut_decision(sample);
       return get_closest_point(sample);
     }
 
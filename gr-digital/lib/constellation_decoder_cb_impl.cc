@@ -72,9 +72,9 @@ namespace gr {
       gr_complex const *in = (const gr_complex*)input_items[0];
       unsigned char *out = (unsigned char*)output_items[0];
 
-      for(int i = 0; i < noutput_items; i++) {
-	out[i] = d_constellation->decision_maker(&(in[i*d_dim]));
-      }
+      // One call for the whole buffer; the constellation slices from
+      // its hard decision LUT when one has been generated.
+      d_constellation->decision_maker_v(in, out, noutput_items);
 
       consume_each(noutput_items * d_dim);
       return noutput_items;
@@ -26,6 +26,7 @@
 
 #include "correlate_access_code_bb_impl.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/blocks/bit_correlator.h>
 #include <gnuradio/blocks/count_bits.h>
 #include <stdexcept>
 #include <cstdio>
@@ -90,7 +91,43 @@ namespace gr {
       const unsigned char *in = (const unsigned char*)input_items[0];
       unsigned char *out = (unsigned char*)output_items[0];
 
-      for(int i = 0; i < noutput_items; i++) {
+      int i = 0;
+
+#if !VERBOSE
+      // Bit-parallel path: pack 64 input samples into one word, then
+      // every one of the 64 alignments inside the batch is available
+      // as a double shift of (previous register, packed word) -- one
+      // xor + popcount per alignment instead of rebuilding the shift
+      // register sample by sample.
+      for(; i + 64 <= noutput_items; i += 64) {
+	unsigned long long packed = gr::blocks::bit_correlator::pack64(&in[i]);
+
+	unsigned long long prev = d_data_reg;
+	for(int k = 0; k < 64; k++) {
+	  // The shift register as it would look before sample i+k is
+	  // shifted in
+	  unsigned long long data_reg =
+	    gr::blocks::bit_correlator::window(prev, packed, k);
+
+	  unsigned int t = 0;
+	  t |= ((data_reg >> 63) & 0x1) << 0;
+	  t |= ((d_flag_reg >> 63) & 0x1) << 1;	// flag bit
+	  out[i+k] = t;
+
+	  unsigned int nwrong =
+	    gr::blocks::bit_correlator::distance(data_reg, d_access_code,
+	                                         d_mask);
+
+	  d_flag_reg = (d_flag_reg << 1);
+	  if(nwrong <= d_threshold) {
+	    d_flag_reg |= d_flag_bit;
+	  }
+	}
+	d_data_reg = packed;
+      }
+#endif
+
+      for(; i < noutput_items; i++) {
 	// compute output value
 	unsigned int t = 0;
 
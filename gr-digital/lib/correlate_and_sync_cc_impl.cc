@@ -74,10 +74,12 @@ namespace gr {
 
       d_center_first_symbol = (padding.size() + 0.5) * d_sps;
 
-      //d_filter = new kernel::fft_filter_ccc(1, d_symbols);
-      d_filter = new kernel::fir_filter_ccc(1, d_symbols);
+      // Overlap-add frequency-domain correlator; the time-domain FIR
+      // is O(ntaps) per sample, which doesn't scale to long preambles
+      d_filter = new kernel::fft_filter_ccc(1, d_symbols);
+      set_output_multiple(d_filter->set_taps(d_symbols));
 
-      set_history(d_filter->ntaps());
+      set_history(d_symbols.size());
 
       const int alignment_multiple =
         volk_get_alignment() / sizeof(gr_complex);
@@ -100,8 +102,8 @@ namespace gr {
     {
       gr::thread::scoped_lock lock(d_setlock);
       d_symbols = symbols;
-      d_filter->set_taps(symbols);
-      set_history(d_filter->ntaps());
+      set_output_multiple(d_filter->set_taps(d_symbols));
+      set_history(d_symbols.size());
     }
 
     int
@@ -117,42 +119,60 @@ namespace gr {
 
       memcpy(out, in, sizeof(gr_complex)*noutput_items);
 
-      // Calculate the correlation with the known symbol
-      //d_filter->filter(noutput_items, in, corr);
-      d_filter->filterN(corr, in, noutput_items);
-      
-      // Find the magnitude squared of the correlation
-      std::vector<float> corr_mag(noutput_items);
-      volk_32fc_magnitude_squared_32f(&corr_mag[0], corr, noutput_items);
+      // Calculate the correlation with the known symbol; the kernel
+      // carries its own overlap tail, so feed it the new samples only
+      d_filter->filter(noutput_items, &in[history()-1], corr);
 
+      // Find the magnitude squared of the correlation
+      if((int)d_corr_mag.size() < noutput_items + 1)
+        d_corr_mag.resize(noutput_items + 1);
+      float *corr_mag = &d_corr_mag[0];
+      volk_32fc_magnitude_squared_32f(corr_mag, corr, noutput_items);
+      corr_mag[noutput_items] = 0; // stops the plateau walk at the buffer end
+
+      // Hierarchical peak search: since corr_mag is non-negative, no
+      // sample below the threshold can trigger the detector, so whole
+      // segments whose maximum doesn't reach it are skipped with one
+      // volk max search. Only segments containing a candidate get the
+      // per-sample scan.
+      const int seg_len = 4096;
       int i = d_sps;
       while(i < noutput_items) {
-        if((corr_mag[i] - corr_mag[i-d_sps]) > d_thresh) {
-          while(corr_mag[i] < corr_mag[i+1])
-            i++;
-
-          double nom = 0, den = 0;
-          for(int s = 0; s < 3; s++) {
-            nom += (s+1)*corr_mag[i+s-1];
-            den += corr_mag[i+s-1];
+        int seg_end = std::min(i + seg_len, noutput_items);
+        uint16_t max_offset = 0;
+        volk_32f_index_max_16u(&max_offset, &corr_mag[i], seg_end - i);
+        if(corr_mag[i + max_offset] <= d_thresh) {
+          i = seg_end;
+          continue;
+        }
+        while(i < seg_end) {
+          if((corr_mag[i] - corr_mag[i-d_sps]) > d_thresh) {
+            while(corr_mag[i] < corr_mag[i+1])
+              i++;
+
+            double nom = 0, den = 0;
+            for(int s = 0; s < 3; s++) {
+              nom += (s+1)*corr_mag[i+s-1];
+              den += corr_mag[i+s-1];
+            }
+            double center = nom / den;
+            center = (center - 2.0);
+
+            int index = i;
+
+            float phase = fast_atan2f(corr[index].imag(), corr[index].real());
+            add_item_tag(0, nitems_written(0) + index, pmt::intern("phase_est"),
+                         pmt::from_double(phase), pmt::intern(alias()));
+            add_item_tag(0, nitems_written(0) + index, pmt::intern("time_est"),
+                         pmt::from_double(center), pmt::intern(alias()));
+            add_item_tag(0, nitems_written(0) + index, pmt::intern("corr_est"),
+                         pmt::from_double(corr_mag[index]), pmt::intern(alias()));
+
+            i += d_sps;
           }
-          double center = nom / den;
-          center = (center - 2.0);
-
-          int index = i;
-
-          float phase = fast_atan2f(corr[index].imag(), corr[index].real());
-          add_item_tag(0, nitems_written(0) + index, pmt::intern("phase_est"),
-                       pmt::from_double(phase), pmt::intern(alias()));
-          add_item_tag(0, nitems_written(0) + index, pmt::intern("time_est"),
-                       pmt::from_double(center), pmt::intern(alias()));
-          add_item_tag(0, nitems_written(0) + index, pmt::intern("corr_est"),
-                       pmt::from_double(corr_mag[index]), pmt::intern(alias()));
-
-          i += d_sps;
+          else
+            i++;
         }
-        else
-          i++;
       }
 
       return noutput_items;
@@ -29,6 +29,7 @@
 #include <gnuradio/expj.h>
 #include <gnuradio/sincos.h>
 #include <gnuradio/math.h>
+#include <volk/volk.h>
 #include <boost/format.hpp>
 
 namespace gr {
@@ -46,7 +47,7 @@ namespace gr {
                    io_signature::make(1, 1, sizeof(gr_complex)),
                    io_signature::make2(1, 2, sizeof(gr_complex), sizeof(float))),
 	blocks::control_loop(loop_bw, 1.0, -1.0),
-	d_order(order), d_error(0), d_phase_detector(NULL)
+	d_order(order), d_error(0), d_chunk(1), d_phase_detector(NULL)
     {
       // Set up the phase detector to use based on the constellation order
       switch(d_order) {
@@ -119,6 +120,14 @@ namespace gr {
       return d_error;
     }
 
+    void
+    costas_loop_cc_impl::set_chunk_size(int chunk)
+    {
+      if(chunk < 1)
+	throw std::invalid_argument("costas_loop_cc: chunk size must be >= 1");
+      d_chunk = chunk;
+    }
+
     int
     costas_loop_cc_impl::work(int noutput_items,
 			      gr_vector_const_void_star &input_items,
@@ -130,54 +139,53 @@ namespace gr {
 
       bool write_foptr = output_items.size() >= 2;
 
-      gr_complex nco_out;
-
       std::vector<tag_t> tags;
       get_tags_in_range(tags, 0, nitems_read(0),
                         nitems_read(0)+noutput_items,
                         pmt::intern("phase_est"));
 
-      if(write_foptr) {
-        for(int i = 0; i < noutput_items; i++) {
-          if(tags.size() > 0) {
-            if(tags[0].offset-nitems_read(0) == (size_t)i) {
-              d_phase = (float)pmt::to_double(tags[0].value);
-              tags.erase(tags.begin());
-            }
-          }
-          
-          nco_out = gr_expj(-d_phase);
-          optr[i] = iptr[i] * nco_out;
-
-          d_error = (*this.*d_phase_detector)(optr[i]);
-          d_error = gr::branchless_clip(d_error, 1.0);
-       
-          advance_loop(d_error);
-          phase_wrap();
-          frequency_limit();
-
-          foptr[i] = d_freq;
-        } 
-      }
-      else {
-        for(int i = 0; i < noutput_items; i++) {
-          if(tags.size() > 0) {
-            if(tags[0].offset-nitems_read(0) == (size_t)i) {
-              d_phase = (float)pmt::to_double(tags[0].value);
-              tags.erase(tags.begin());
-            }
+      // Process d_chunk samples per loop update.  Within a chunk the
+      // phase advances linearly at the current frequency estimate, so
+      // the whole chunk is derotated with one volk rotator call and the
+      // loop is advanced once on the averaged phase detector output.
+      // With the default chunk size of 1 this is the classic
+      // sample-by-sample Costas loop.
+      int i = 0;
+      while(i < noutput_items) {
+        // an upstream phase_est tag resets the loop phase on its sample
+        if(tags.size() > 0) {
+          if(tags[0].offset-nitems_read(0) == (size_t)i) {
+            d_phase = (float)pmt::to_double(tags[0].value);
+            tags.erase(tags.begin());
           }
+        }
 
-          nco_out = gr_expj(-d_phase);
-          optr[i] = iptr[i] * nco_out;
-
-          d_error = (*this.*d_phase_detector)(optr[i]);
-          d_error = gr::branchless_clip(d_error, 1.0);
-
-          advance_loop(d_error);
-          phase_wrap();
-          frequency_limit();
+        int n = std::min(d_chunk, noutput_items - i);
+        if(tags.size() > 0)
+          n = std::min(n, (int)(tags[0].offset-nitems_read(0)) - i);
+
+        gr_complex phasor = gr_expj(-d_phase);
+        gr_complex incr = gr_expj(-d_freq);
+        volk_32fc_s32fc_x2_rotator_32fc(&optr[i], &iptr[i], incr, &phasor, n);
+
+        float error = 0;
+        for(int k = 0; k < n; k++)
+          error += (*this.*d_phase_detector)(optr[i+k]);
+        d_error = gr::branchless_clip(error/n, 1.0);
+
+        // account for the phase the rotator already advanced through,
+        // then make the usual single loop update
+        d_phase += (n-1)*d_freq;
+        advance_loop(d_error);
+        phase_wrap();
+        frequency_limit();
+
+        if(write_foptr) {
+          for(int k = 0; k < n; k++)
+            foptr[i+k] = d_freq;
         }
+
+        i += n;
       }
 
       return noutput_items;
@@ -34,6 +34,7 @@ namespace gr {
     private:
       int d_order;
       float d_error;
+      int d_chunk;
 
       /*! \brief the phase detector circuit for 8th-order PSK loops
        *  \param sample complex sample
@@ -61,6 +62,9 @@ namespace gr {
 
       float error() const;
 
+      void set_chunk_size(int chunk);
+      int chunk_size() const { return d_chunk; }
+
       void setup_rpc();
   
       int work(int noutput_items,
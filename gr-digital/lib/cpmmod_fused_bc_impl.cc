@@ -0,0 +1,178 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "cpmmod_fused_bc_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/fxpt.h>
+#include <stdexcept>
+
+namespace gr {
+  namespace digital {
+
+    cpmmod_fused_bc::sptr
+    cpmmod_fused_bc::make(analog::cpm::cpm_type type, float h,
+			  int samples_per_sym,
+			  int L, double beta)
+    {
+      return gnuradio::get_initial_sptr
+	(new cpmmod_fused_bc_impl("cpmmod_fused_bc",
+				  (analog::cpm::cpm_type)type,
+				  h, samples_per_sym,
+				  L, beta));
+    }
+
+    cpmmod_fused_bc::sptr
+    cpmmod_fused_bc::make_gmskmod_fused_bc(int samples_per_sym,
+					   int L, double beta)
+    {
+      return gnuradio::get_initial_sptr
+	(new cpmmod_fused_bc_impl("gmskmod_fused_bc",
+				  analog::cpm::GAUSSIAN, 0.5,
+				  samples_per_sym,
+				  L, beta));
+    }
+
+    cpmmod_fused_bc_impl::cpmmod_fused_bc_impl(const std::string &name,
+					       analog::cpm::cpm_type type, float h,
+					       int samples_per_sym,
+					       int L, double beta)
+      : sync_interpolator(name,
+			     io_signature::make(1, 1, sizeof(char)),
+			     io_signature::make(1, 1, sizeof(gr_complex)),
+			     samples_per_sym),
+	d_type(type), d_index(h), d_sps(samples_per_sym), d_length(L), d_beta(beta),
+	d_taps(analog::cpm::phase_response(type, samples_per_sym, L, beta)),
+	d_sensitivity(M_PI * h), d_phase(0)
+    {
+      switch(type) {
+      case analog::cpm::LRC:
+      case analog::cpm::LSRC:
+      case analog::cpm::LREC:
+      case analog::cpm::TFM:
+      case analog::cpm::GAUSSIAN:
+	break;
+
+      default:
+	throw std::invalid_argument("cpmmod_fused_bc_impl: invalid CPM type");
+      }
+
+      // Regroup the phase response into d_sps polyphase branches so
+      // each output sample is one short dot product over the last
+      // d_branch_len input symbols; output sample p of symbol n is
+      // sum over m of taps[m*sps + p] * x[n-m], which is exactly what
+      // the upsample-then-filter chain computes.
+      d_branch_len = (d_taps.size() + d_sps - 1) / d_sps;
+      d_ptaps.assign(d_sps * d_branch_len, 0);
+      for(unsigned j = 0; j < d_taps.size(); j++) {
+	int p = j % d_sps;
+	int m = j / d_sps;
+	d_ptaps[p * d_branch_len + m] = d_taps[j];
+      }
+
+      set_history(d_branch_len);
+    }
+
+    cpmmod_fused_bc_impl::~cpmmod_fused_bc_impl()
+    {
+    }
+
+    std::vector<float>
+    cpmmod_fused_bc_impl::taps() const
+    {
+      return d_taps;
+    }
+
+    int
+    cpmmod_fused_bc_impl::type() const
+    {
+      return d_type;
+    }
+
+    float
+    cpmmod_fused_bc_impl::index() const
+    {
+      return d_index;
+    }
+
+    int
+    cpmmod_fused_bc_impl::samples_per_sym() const
+    {
+      return d_sps;
+    }
+
+    int
+    cpmmod_fused_bc_impl::length() const
+    {
+      return d_length;
+    }
+
+    double cpmmod_fused_bc_impl::beta() const
+    {
+      return d_beta;
+    }
+
+    int
+    cpmmod_fused_bc_impl::work(int noutput_items,
+			       gr_vector_const_void_star &input_items,
+			       gr_vector_void_star &output_items)
+    {
+      const signed char *in = (const signed char*)input_items[0];
+      gr_complex *out = (gr_complex*)output_items[0];
+
+      int nsym = noutput_items / d_sps;
+
+      for(int n = 0; n < nsym; n++) {
+	// With history set, in[n + d_branch_len - 1] is the newest
+	// symbol for this group of d_sps output samples
+	const signed char *x = &in[n + d_branch_len - 1];
+
+	for(int p = 0; p < d_sps; p++) {
+	  const float *tp = &d_ptaps[p * d_branch_len];
+	  float f = 0;
+	  for(int m = 0; m < d_branch_len; m++)
+	    f += tp[m] * (float)x[-m];
+
+	  // Integrate the frequency and look the phasor up in the
+	  // fixed-point sincos table, as frequency_modulator_fc does
+	  d_phase = d_phase + d_sensitivity * f;
+
+	  while(d_phase > (float)(M_PI))
+	    d_phase -= (float)(2.0 * M_PI);
+	  while(d_phase < (float)(-M_PI))
+	    d_phase += (float)(2.0 * M_PI);
+
+	  float oi, oq;
+	  gr_int32 angle = gr::fxpt::float_to_fixed(d_phase);
+	  gr::fxpt::sincos(angle, &oq, &oi);
+	  out[n * d_sps + p] = gr_complex(oi, oq);
+	}
+      }
+
+      return nsym * d_sps;
+    }
+
+  } /* namespace digital */
+} /* namespace gr */
@@ -0,0 +1,70 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_DIGITAL_CPMMOD_FUSED_BC_IMPL_H
+#define INCLUDED_DIGITAL_CPMMOD_FUSED_BC_IMPL_H
+
+#include <gnuradio/digital/cpmmod_fused_bc.h>
+
+namespace gr {
+  namespace digital {
+
+    class cpmmod_fused_bc_impl : public cpmmod_fused_bc
+    {
+    private:
+      int d_type;
+      float d_index;
+      int d_sps;
+      int d_length;
+      double d_beta;
+
+      std::vector<float> d_taps;
+      //! Taps regrouped into d_sps polyphase branches of d_branch_len each
+      std::vector<float> d_ptaps;
+      int d_branch_len;
+
+      float d_sensitivity;
+      float d_phase;
+
+    public:
+      cpmmod_fused_bc_impl(const std::string &name,
+			   analog::cpm::cpm_type type, float h,
+			   int samples_per_sym,
+			   int L, double beta=0.3);
+      ~cpmmod_fused_bc_impl();
+
+      std::vector<float> taps() const;
+      int type() const;
+      float index() const;
+      int samples_per_sym() const;
+      int length() const;
+      double beta() const;
+
+      int work(int noutput_items,
+	       gr_vector_const_void_star &input_items,
+	       gr_vector_void_star &output_items);
+    };
+
+  } /* namespace digital */
+} /* namespace gr */
+
+#endif /* INCLUDED_DIGITAL_CPMMOD_FUSED_BC_IMPL_H */
@@ -30,15 +30,18 @@
 
 #include <gnuradio/digital/crc32.h>
 
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+#define CRC32_HAVE_PCLMUL 1
+#include <wmmintrin.h>
+#include <smmintrin.h>
+#endif
+
 namespace gr {
   namespace digital {
 
     // Automatically generated CRC function
     // polynomial: 0x104C11DB7
-    unsigned int
-    update_crc32(unsigned int crc, const unsigned char *data, size_t len)
-    {
-      static const unsigned int table[256] = {
+    static const unsigned int crc32_table[256] = {
 	0x00000000U,0x04C11DB7U,0x09823B6EU,0x0D4326D9U,
 	0x130476DCU,0x17C56B6BU,0x1A864DB2U,0x1E475005U,
 	0x2608EDB8U,0x22C9F00FU,0x2F8AD6D6U,0x2B4BCB61U,
@@ -103,11 +106,44 @@ namespace gr {
 	0x9ABC8BD5U,0x9E7D9662U,0x933EB0BBU,0x97FFAD0CU,
 	0xAFB010B1U,0xAB710D06U,0xA6322BDFU,0xA2F33668U,
 	0xBCB4666DU,0xB8757BDAU,0xB5365D03U,0xB1F740B4U,
-      };
-  
+    };
+
+    /*
+     * Slice-by-8 extension tables: crc32_slice[t][b] advances byte b
+     * through t+1 steps of the CRC register, so eight input bytes can
+     * be folded with eight independent lookups per iteration instead
+     * of a serial chain of eight.  Built once at load time.
+     */
+    static unsigned int crc32_slice[8][256];
+
+    static struct crc32_table_initializer {
+      crc32_table_initializer() {
+	for(unsigned int b = 0; b < 256; b++)
+	  crc32_slice[0][b] = crc32_table[b];
+	for(int t = 1; t < 8; t++)
+	  for(unsigned int b = 0; b < 256; b++)
+	    crc32_slice[t][b] = crc32_table[(crc32_slice[t-1][b] >> 24) & 0xff]
+	      ^ (crc32_slice[t-1][b] << 8);
+      }
+    } s_crc32_table_init;
+
+    unsigned int
+    update_crc32(unsigned int crc, const unsigned char *data, size_t len)
+    {
+      while(len >= 8) {
+	unsigned int x = crc
+	  ^ ((unsigned int)data[0] << 24 | (unsigned int)data[1] << 16
+	     | (unsigned int)data[2] << 8 | data[3]);
+	crc = crc32_slice[7][(x >> 24) & 0xff] ^ crc32_slice[6][(x >> 16) & 0xff]
+	  ^ crc32_slice[5][(x >> 8) & 0xff] ^ crc32_slice[4][x & 0xff]
+	  ^ crc32_slice[3][data[4]] ^ crc32_slice[2][data[5]]
+	  ^ crc32_slice[1][data[6]] ^ crc32_slice[0][data[7]];
+	data += 8;
+	len -= 8;
+      }
       while(len > 0)
 	{
-	  crc = table[*data ^ ((crc >> 24) & 0xff)] ^ (crc << 8);
+	  crc = crc32_table[*data ^ ((crc >> 24) & 0xff)] ^ (crc << 8);
 	  data++;
 	  len--;
 	}
@@ -132,5 +168,155 @@ namespace gr {
       return crc32((const unsigned char *) s.data(), s.size());
     }
 
+    /*
+     * Reflected CRC-32 (polynomial 0xEDB88320), the form used by
+     * crc32_bb.  Same slice-by-8 scheme as above, with the register
+     * running in reflected bit order.
+     */
+    static unsigned int crc32r_slice[8][256];
+
+    static struct crc32r_table_initializer {
+      crc32r_table_initializer() {
+	for(unsigned int b = 0; b < 256; b++) {
+	  unsigned int c = b;
+	  for(int k = 0; k < 8; k++)
+	    c = (c & 1) ? (c >> 1) ^ 0xEDB88320U : c >> 1;
+	  crc32r_slice[0][b] = c;
+	}
+	for(int t = 1; t < 8; t++)
+	  for(unsigned int b = 0; b < 256; b++)
+	    crc32r_slice[t][b] = crc32r_slice[0][crc32r_slice[t-1][b] & 0xff]
+	      ^ (crc32r_slice[t-1][b] >> 8);
+      }
+    } s_crc32r_table_init;
+
+    static unsigned int
+    update_crc32r_slice8(unsigned int crc, const unsigned char *data, size_t len)
+    {
+      while(len >= 8) {
+	// assembled low-byte-first to match the reflected register;
+	// compilers turn these into single loads on little-endian
+	unsigned int lo = (unsigned int)data[0] | (unsigned int)data[1] << 8
+	  | (unsigned int)data[2] << 16 | (unsigned int)data[3] << 24;
+	unsigned int hi = (unsigned int)data[4] | (unsigned int)data[5] << 8
+	  | (unsigned int)data[6] << 16 | (unsigned int)data[7] << 24;
+	lo ^= crc;
+	crc = crc32r_slice[7][lo & 0xff] ^ crc32r_slice[6][(lo >> 8) & 0xff]
+	  ^ crc32r_slice[5][(lo >> 16) & 0xff] ^ crc32r_slice[4][(lo >> 24) & 0xff]
+	  ^ crc32r_slice[3][hi & 0xff] ^ crc32r_slice[2][(hi >> 8) & 0xff]
+	  ^ crc32r_slice[1][(hi >> 16) & 0xff] ^ crc32r_slice[0][(hi >> 24) & 0xff];
+	data += 8;
+	len -= 8;
+      }
+      while(len > 0) {
+	crc = crc32r_slice[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+	len--;
+      }
+      return crc;
+    }
+
+#ifdef CRC32_HAVE_PCLMUL
+    /*
+     * Carry-less multiply folding (Gopal et al., "Fast CRC
+     * Computation for Generic Polynomials Using PCLMULQDQ
+     * Instruction").  Four 128-bit lanes are folded across the buffer
+     * with the x^512 constants, reduced to one lane with the x^128
+     * constants, and the 16-byte residue is finished with the table
+     * path, which keeps the reduction free of the Barrett step.
+     *
+     * Note the SSE4.2 crc32 instruction is of no use here: it is
+     * hard-wired to the Castagnoli polynomial, not 0x04C11DB7.
+     */
+    static unsigned int
+    update_crc32r_pclmul(unsigned int crc, const unsigned char *data, size_t len)
+    {
+      if(len < 64)
+	return update_crc32r_slice8(crc, data, len);
+
+      const __m128i k1k2 = _mm_set_epi64x(0x00000001c6e41596LL, 0x0000000154442bd4LL);
+      const __m128i k3k4 = _mm_set_epi64x(0x00000000ccaa009eLL, 0x00000001751997d0LL);
+
+      __m128i x0 = _mm_loadu_si128((const __m128i *)(data + 0));
+      __m128i x1 = _mm_loadu_si128((const __m128i *)(data + 16));
+      __m128i x2 = _mm_loadu_si128((const __m128i *)(data + 32));
+      __m128i x3 = _mm_loadu_si128((const __m128i *)(data + 48));
+      __m128i t;
+      x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128(crc));
+      data += 64;
+      len -= 64;
+
+      while(len >= 64) {
+	t = _mm_clmulepi64_si128(x0, k1k2, 0x00);
+	x0 = _mm_clmulepi64_si128(x0, k1k2, 0x11);
+	x0 = _mm_xor_si128(_mm_xor_si128(x0, t),
+			   _mm_loadu_si128((const __m128i *)(data + 0)));
+	t = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, t),
+			   _mm_loadu_si128((const __m128i *)(data + 16)));
+	t = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+	x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+	x2 = _mm_xor_si128(_mm_xor_si128(x2, t),
+			   _mm_loadu_si128((const __m128i *)(data + 32)));
+	t = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+	x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+	x3 = _mm_xor_si128(_mm_xor_si128(x3, t),
+			   _mm_loadu_si128((const __m128i *)(data + 48)));
+	data += 64;
+	len -= 64;
+      }
+
+      t = _mm_clmulepi64_si128(x0, k3k4, 0x00);
+      x0 = _mm_clmulepi64_si128(x0, k3k4, 0x11);
+      x1 = _mm_xor_si128(x1, _mm_xor_si128(x0, t));
+      t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+      x2 = _mm_xor_si128(x2, _mm_xor_si128(x1, t));
+      t = _mm_clmulepi64_si128(x2, k3k4, 0x00);
+      x2 = _mm_clmulepi64_si128(x2, k3k4, 0x11);
+      x3 = _mm_xor_si128(x3, _mm_xor_si128(x2, t));
+
+      while(len >= 16) {
+	t = _mm_clmulepi64_si128(x3, k3k4, 0x00);
+	x3 = _mm_clmulepi64_si128(x3, k3k4, 0x11);
+	x3 = _mm_xor_si128(_mm_xor_si128(x3, t),
+			   _mm_loadu_si128((const __m128i *)data));
+	data += 16;
+	len -= 16;
+      }
+
+      // The folds keep the processed prefix congruent to the 16
+      // residual bytes in x3; finish those (and the tail) by table.
+      unsigned char residual[16];
+      _mm_storeu_si128((__m128i *)residual, x3);
+      crc = update_crc32r_slice8(0, residual, 16);
+
+      return update_crc32r_slice8(crc, data, len);
+    }
+
+    static bool
+    crc32r_use_pclmul()
+    {
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8))
+      static const bool use = __builtin_cpu_supports("pclmul") != 0;
+      return use;
+#else
+      return true;	// the build was already restricted to such CPUs
+#endif
+    }
+#endif /* CRC32_HAVE_PCLMUL */
+
+    void
+    crc32_accum::update(const unsigned char *data, size_t len)
+    {
+#ifdef CRC32_HAVE_PCLMUL
+      if(crc32r_use_pclmul()) {
+	d_crc = update_crc32r_pclmul(d_crc, data, len);
+	return;
+      }
+#endif
+      d_crc = update_crc32r_slice8(d_crc, data, len);
+    }
+
   } /* namespace digital */
 } /* namespace gr */
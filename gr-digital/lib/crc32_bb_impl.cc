@@ -75,8 +75,8 @@ namespace gr {
 
       if (d_check) {
         d_crc_impl.reset();
-        d_crc_impl.process_bytes(in, packet_length-4);
-        crc = d_crc_impl();
+        d_crc_impl.update(in, packet_length-4);
+        crc = d_crc_impl.result();
 	if (crc != *(unsigned int *)(in+packet_length-4)) { // Drop package
 	  d_nfail++;
 	  return 0;
@@ -85,8 +85,8 @@ namespace gr {
 	memcpy((void *) out, (const void *) in, packet_length-4);
       } else {
         d_crc_impl.reset();
-        d_crc_impl.process_bytes(in, packet_length);
-        crc = d_crc_impl();
+        d_crc_impl.update(in, packet_length);
+        crc = d_crc_impl.result();
 	memcpy((void *) out, (const void *) in, packet_length);
 	memcpy((void *) (out + packet_length), &crc, 4); // FIXME big-endian/little-endian, this might be wrong
       }
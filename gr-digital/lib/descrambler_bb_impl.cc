@@ -26,6 +26,8 @@
 
 #include "descrambler_bb_impl.h"
 #include <gnuradio/io_signature.h>
+#include <stdexcept>
+#include <string.h>
 
 namespace gr {
   namespace digital {
@@ -41,8 +43,23 @@ namespace gr {
       : sync_block("descrambler_bb",
 		      io_signature::make(1, 1, sizeof(unsigned char)),
 		      io_signature::make(1, 1, sizeof(unsigned char))),
-	d_lfsr(mask, seed, len)
+	d_hist_len(len + 1)
     {
+      if(len < 0 || len > 31)
+	throw std::invalid_argument("reg_len must be <= 31");
+
+      // Register bit k holds the input from len+1-k steps back, so a
+      // feedback tap on bit k becomes a delay of len+1-k.
+      for(int k = 0; k <= len; k++) {
+	if((mask >> k) & 1)
+	  d_tap_delays.push_back(len + 1 - k);
+      }
+
+      // Virtual input history equivalent to starting the register
+      // loaded with the seed.
+      d_hist.resize(d_hist_len);
+      for(int j = 0; j < d_hist_len; j++)
+	d_hist[j] = (seed >> j) & 1;
     }
 
     descrambler_bb_impl::~descrambler_bb_impl()
@@ -56,11 +73,23 @@ namespace gr {
     {
       const unsigned char *in = (const unsigned char*)input_items[0];
       unsigned char *out = (unsigned char*)output_items[0];
+      const int hist = d_hist_len;
+
+      d_buf.resize(hist + noutput_items);
+      memcpy(&d_buf[0], &d_hist[0], hist);
+      for(int i = 0; i < noutput_items; i++)
+	d_buf[hist + i] = in[i] & 1;
 
-      for(int i = 0; i < noutput_items; i++) {
-	out[i] = d_lfsr.next_bit_descramble(in[i]);
+      // One full pass over the buffer per feedback tap; each pass is
+      // a straight byte XOR the compiler vectorizes.
+      memcpy(out, &d_buf[hist], noutput_items);
+      for(size_t t = 0; t < d_tap_delays.size(); t++) {
+	const unsigned char *delayed = &d_buf[hist - d_tap_delays[t]];
+	for(int i = 0; i < noutput_items; i++)
+	  out[i] ^= delayed[i];
       }
 
+      memcpy(&d_hist[0], &d_buf[d_buf.size() - hist], hist);
       return noutput_items;
     }
 
@@ -24,7 +24,7 @@
 #define INCLUDED_GR_DESCRAMBLER_BB_IMPL_H
 
 #include <gnuradio/digital/descrambler_bb.h>
-#include <gnuradio/digital/lfsr.h>
+#include <vector>
 
 namespace gr {
   namespace digital {
@@ -32,7 +32,16 @@ namespace gr {
     class descrambler_bb_impl : public descrambler_bb
     {
     private:
-      digital::lfsr d_lfsr;
+      // The descrambler's shift register only ever holds past input
+      // bits, so descrambling is a pure feed-forward XOR of delayed
+      // inputs: out[i] = in[i] ^ in[i-d] over one delay d per
+      // feedback tap.  We keep the last d_hist_len input bits (one
+      // per byte, unpacked) and run one vectorizable XOR pass per tap
+      // instead of clocking an LFSR bit by bit.
+      std::vector<int> d_tap_delays;
+      int d_hist_len;
+      std::vector<unsigned char> d_hist; //!< last d_hist_len input bits, seeded from \p seed
+      std::vector<unsigned char> d_buf;  //!< work scratch: history followed by current input
 
     public:
       descrambler_bb_impl(int mask, int seed, int len);
@@ -40,9 +40,20 @@ namespace gr {
       : sync_block("diff_decoder_bb",
 		      io_signature::make(1, 1, sizeof(unsigned char)),
 		      io_signature::make(1, 1, sizeof(unsigned char))),
-	d_modulus(modulus)
+	d_modulus(modulus),
+	d_mask((modulus & (modulus - 1)) == 0 ? modulus - 1 : 0)
     {
       set_history(2);	// need to look at two inputs
+
+      if(!d_mask) {
+	// table of ((a - b) mod 2^32) % modulus for all byte pairs,
+	// matching the unsigned arithmetic of the original expression
+	d_trans.resize(256 * 256);
+	for(unsigned a = 0; a < 256; a++)
+	  for(unsigned b = 0; b < 256; b++)
+	    d_trans[(a << 8) | b] =
+	      (unsigned char)((a - b) % modulus);
+      }
     }
 
     diff_decoder_bb_impl::~diff_decoder_bb_impl()
@@ -58,10 +69,19 @@ namespace gr {
       unsigned char *out = (unsigned char*)output_items[0];
       in += 1;	// ensure that in[-1] is valid
 
-      unsigned modulus = d_modulus;
-
-      for(int i = 0; i < noutput_items; i++) {
-	out[i] = (in[i] - in[i-1]) % modulus;
+      if(d_mask) {
+	// power-of-two modulus: the divide becomes a mask and the
+	// loop has no dependencies left, so it vectorizes
+	unsigned mask = d_mask;
+	for(int i = 0; i < noutput_items; i++) {
+	  out[i] = (in[i] - in[i-1]) & mask;
+	}
+      }
+      else {
+	const unsigned char *trans = &d_trans[0];
+	for(int i = 0; i < noutput_items; i++) {
+	  out[i] = trans[((unsigned)in[i] << 8) | in[i-1]];
+	}
       }
 
       return noutput_items;
@@ -25,6 +25,7 @@
 
 #include <gnuradio/digital/diff_decoder_bb.h>
 #include <gnuradio/sync_block.h>
+#include <vector>
 
 namespace gr {
   namespace digital {
@@ -41,6 +42,10 @@ namespace gr {
 
     private:
       unsigned int d_modulus;
+      unsigned int d_mask;   // modulus - 1 when the modulus is a power of two, else 0
+      // full (current byte, previous byte) difference table used for
+      // non-power-of-two moduli; replaces the per-symbol divide
+      std::vector<unsigned char> d_trans;
     };
 
   } /* namespace digital */
@@ -41,8 +41,18 @@ namespace gr {
       : sync_block("diff_encoder_bb",
 		      io_signature::make(1, 1, sizeof(unsigned char)),
 		      io_signature::make(1, 1, sizeof(unsigned char))),
-	d_last_out(0), d_modulus(modulus)
+	d_last_out(0), d_modulus(modulus),
+	d_mask((modulus & (modulus - 1)) == 0 ? modulus - 1 : 0)
     {
+      if(!d_mask) {
+	// any previous output is a byte, so a full 256x256 table
+	// covers every modulus without a range check
+	d_trans.resize(256 * 256);
+	for(unsigned in = 0; in < 256; in++)
+	  for(unsigned last = 0; last < 256; last++)
+	    d_trans[(in << 8) | last] =
+	      (unsigned char)((in + last) % modulus);
+      }
     }
 
     diff_encoder_bb_impl::~diff_encoder_bb_impl()
@@ -58,11 +68,25 @@ namespace gr {
       unsigned char *out = (unsigned char*)output_items[0];
 
       unsigned last_out = d_last_out;
-      unsigned modulus = d_modulus;
 
-      for(int i = 0; i < noutput_items; i++) {
-	out[i] = (in[i] + last_out) % modulus;
-	last_out = out[i];
+      if(d_mask) {
+	// power-of-two modulus: masking only the outputs is equivalent
+	// to masking every step, so the loop-carried dependency is a
+	// plain running sum
+	unsigned mask = d_mask;
+	unsigned acc = last_out;
+	for(int i = 0; i < noutput_items; i++) {
+	  acc += in[i];
+	  out[i] = acc & mask;
+	}
+	last_out = acc & mask;
+      }
+      else {
+	const unsigned char *trans = &d_trans[0];
+	for(int i = 0; i < noutput_items; i++) {
+	  out[i] = trans[((unsigned)in[i] << 8) | last_out];
+	  last_out = out[i];
+	}
       }
 
       d_last_out = last_out;
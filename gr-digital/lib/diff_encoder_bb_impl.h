@@ -24,6 +24,7 @@
 #define INCLUDED_GR_DIFF_ENCODER_BB_IMPL_H
 
 #include <gnuradio/digital/diff_encoder_bb.h>
+#include <vector>
 
 namespace gr {
   namespace digital {
@@ -41,6 +42,10 @@ namespace gr {
     private:
       unsigned int d_last_out;
       unsigned int d_modulus;
+      unsigned int d_mask;   // modulus - 1 when the modulus is a power of two, else 0
+      // full (input byte, previous output byte) transition table used
+      // for non-power-of-two moduli; replaces the per-symbol divide
+      std::vector<unsigned char> d_trans;
     };
 
   } /* namespace digital */
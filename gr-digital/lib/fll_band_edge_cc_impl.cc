@@ -27,6 +27,7 @@
 #include "fll_band_edge_cc_impl.h"
 #include <gnuradio/io_signature.h>
 #include <gnuradio/expj.h>
+#include <volk/volk.h>
 #include <cstdio>
 
 namespace gr {
@@ -86,8 +87,6 @@ namespace gr {
 
     fll_band_edge_cc_impl::~fll_band_edge_cc_impl()
     {
-      delete d_filter_upper;
-      delete d_filter_lower;
     }
 
     /*******************************************************************
@@ -187,10 +186,24 @@ namespace gr {
 
       d_updated = true;
 
+      // Split the lower band-edge taps (reversed, as the filter kernel
+      // would store them) into their real and imaginary parts.  Since
+      // the upper taps are the conjugates of the lower ones, the fused
+      // filter pass in work() recovers both filter outputs from these
+      // two real-tap dot products.
+      d_ftaps_re.resize(filter_size);
+      d_ftaps_im.resize(filter_size);
+      for(int i = 0; i < filter_size; i++) {
+	d_ftaps_re[i] = d_taps_lower[filter_size-i-1].real();
+	d_ftaps_im[i] = d_taps_lower[filter_size-i-1].imag();
+      }
+
+      // Doubled delay line so the filter window is always contiguous
+      d_fbuf.assign(2*filter_size, gr_complex(0,0));
+      d_fbuf_idx = 0;
+
       // Set the history to ensure enough input items for each filter
       set_history(filter_size+1);
-      d_filter_upper = new gr::filter::kernel::fir_filter_with_buffer_ccc(d_taps_upper);
-      d_filter_lower = new gr::filter::kernel::fir_filter_with_buffer_ccc(d_taps_lower);
     }
 
     void
@@ -236,18 +249,29 @@ namespace gr {
       int i;
       float error;
       gr_complex nco_out;
-      gr_complex out_upper, out_lower;
-      gr_complex out_uppersse, out_lowersse;
+      gr_complex s1, s2;
 
       for(i = 0; i < noutput_items; i++) {
 	nco_out = gr_expj(d_phase);
 	out[i] = in[i] * nco_out;
 
-	// Perform the dot product of the output with the filters
-	out_upper = d_filter_lower->filter(out[i]);
-	out_lower = d_filter_upper->filter(out[i]);
-
-	error = norm(out_lower) - norm(out_upper);
+	// Push the derotated sample into the shared delay line; the
+	// doubling keeps the filter window contiguous.
+	d_fbuf[d_fbuf_idx] = out[i];
+	d_fbuf[d_fbuf_idx + d_filter_size] = out[i];
+	d_fbuf_idx = (d_fbuf_idx + 1) % d_filter_size;
+
+	// Fused band-edge filter pass.  With s1 = sum(Re(t)*x) and
+	// s2 = sum(Im(t)*x) over the lower taps t, the lower filter
+	// output is s1 + j*s2 and the upper (conjugate taps) is
+	// s1 - j*s2, so the error norm(upper) - norm(lower) reduces to
+	// the cross term below.
+	volk_32fc_32f_dot_prod_32fc(&s1, &d_fbuf[d_fbuf_idx],
+				    &d_ftaps_re[0], d_filter_size);
+	volk_32fc_32f_dot_prod_32fc(&s2, &d_fbuf[d_fbuf_idx],
+				    &d_ftaps_im[0], d_filter_size);
+
+	error = 4*(s1.real()*s2.imag() - s1.imag()*s2.real());
 
 	advance_loop(error);
 	phase_wrap();
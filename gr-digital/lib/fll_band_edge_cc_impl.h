@@ -25,7 +25,6 @@
 
 #include <gnuradio/digital/fll_band_edge_cc.h>
 #include <gnuradio/blocks/control_loop.h>
-#include <gnuradio/filter/fir_filter_with_buffer.h>
 
 namespace gr {
   namespace digital {
@@ -41,8 +40,14 @@ namespace gr {
       std::vector<gr_complex> d_taps_lower;
       std::vector<gr_complex> d_taps_upper;
       bool		      d_updated;
-      gr::filter::kernel::fir_filter_with_buffer_ccc* d_filter_lower;
-      gr::filter::kernel::fir_filter_with_buffer_ccc* d_filter_upper;
+
+      // The upper band-edge taps are the conjugates of the lower ones,
+      // so both filters are evaluated in one fused pass: two real-tap
+      // dot products over a shared delay line of derotated samples.
+      std::vector<float>      d_ftaps_re;
+      std::vector<float>      d_ftaps_im;
+      std::vector<gr_complex> d_fbuf;
+      unsigned int            d_fbuf_idx;
 
       /*!
        * Design the band-edge filter based on the number of samples
@@ -24,6 +24,8 @@
 #endif
 
 #include <climits>
+#include <cstring>
+#include <stdint.h>
 #include <boost/format.hpp>
 #include <gnuradio/io_signature.h>
 #include "header_payload_demux_impl.h"
@@ -293,7 +295,18 @@ namespace gr {
       if (input_items.size() == 2) {
 	unsigned char *in_trigger = (unsigned char *) input_items[1];
 	in_trigger += nread;
-	for (int i = 0; i < noutput_items-nread; i++) {
+	int n = noutput_items - nread;
+	int i = 0;
+	// The trigger stream is almost always zero, so scan it a word
+	// at a time and only fall back to bytes once a word is hot.
+	for (; i + (int) sizeof(uint64_t) <= n; i += sizeof(uint64_t)) {
+	  uint64_t w;
+	  memcpy(&w, in_trigger + i, sizeof(w));
+	  if (w) {
+	    break;
+	  }
+	}
+	for (; i < n; i++) {
 	  if (in_trigger[i]) {
 	    return i;
 	  }
@@ -431,19 +444,23 @@ namespace gr {
 	}
       }
 
+      if (d_special_tags.empty()) {
+	return;
+      }
+      // One query for the whole range beats walking the tag list once
+      // per special tag; the newest match per key wins.
       std::vector<tag_t> tags;
-      for (unsigned i = 0; i < d_special_tags.size(); i++) {
-	uint64_t offset = 0;
-	// TODO figure out if it's better to get all tags at once instead of doing this for every tag individually
-	get_tags_in_range(tags, 0,
-	    nitems_read(0) + range_start,
-	    nitems_read(0) + range_end,
-	    d_special_tags[i]
-	);
-	for (unsigned t = 0; t < tags.size(); t++) {
-	  if(tags[t].offset >= offset) {
+      std::vector<uint64_t> newest(d_special_tags.size(), 0);
+      get_tags_in_range(tags, 0,
+	  nitems_read(0) + range_start,
+	  nitems_read(0) + range_end
+      );
+      for (unsigned t = 0; t < tags.size(); t++) {
+	for (unsigned i = 0; i < d_special_tags.size(); i++) {
+	  if (tags[t].offset >= newest[i]
+	      && pmt::equal(tags[t].key, d_special_tags[i])) {
 	    d_special_tags_last_value[i] = tags[t].value;
-	    offset = tags[t].offset;
+	    newest[i] = tags[t].offset;
 	  }
 	}
       }
@@ -27,6 +27,7 @@
 #include "lms_dd_equalizer_cc_impl.h"
 #include <gnuradio/io_signature.h>
 #include <gnuradio/misc.h>
+#include <algorithm>
 #include <volk/volk.h>
 
 namespace gr {
@@ -51,7 +52,8 @@ namespace gr {
 			  sps),
 	fir_filter_ccc(sps, std::vector<gr_complex>(num_taps, gr_complex(0,0))),
 	d_new_taps(num_taps, gr_complex(0,0)),
-	d_updated(false), d_cnst(cnst)
+	d_updated(false), d_cnst(cnst),
+	d_block_size(1)
     {
       set_gain(mu);
       if(num_taps > 0)
@@ -114,6 +116,38 @@ namespace gr {
 
       int j = 0;
       size_t k, l = d_taps.size();
+
+      if(d_block_size > 1) {
+	// Block-adaptive mode: filter a whole block with fixed taps,
+	// then apply one aggregated gradient update. The filter runs
+	// are independent volk dot products this way.
+	d_grad.resize(l);
+	for(int i = 0; i < noutput_items; i += d_block_size) {
+	  int nblock = std::min(d_block_size, noutput_items - i);
+
+	  for(int b = 0; b < nblock; b++) {
+	    out[i+b] = filter(&in[j + b*decimation()]);
+	  }
+
+	  std::fill(d_grad.begin(), d_grad.end(), gr_complex(0,0));
+	  for(int b = 0; b < nblock; b++) {
+	    d_error = error(out[i+b]);
+	    const gr_complex *x = &in[j + b*decimation()];
+	    for(k = 0; k < l; k++) {
+	      d_grad[k] += conj(x[k])*d_error;
+	    }
+	  }
+
+	  for(k = 0; k < l; k++) {
+	    d_taps[k] += d_mu*d_grad[k];
+	    fir_filter_ccc::update_tap(d_taps[k], k);
+	  }
+
+	  j += nblock*decimation();
+	}
+	return noutput_items;
+      }
+
       for(int i = 0; i < noutput_items; i++) {
 	out[i] = filter(&in[j]);
 
@@ -40,6 +40,8 @@ namespace gr {
 
       float d_mu;
       constellation_sptr d_cnst;
+      int d_block_size;
+      std::vector<gr_complex> d_grad; // aggregated gradient of one block
 
     protected:
       gr_complex error(const gr_complex &out);
@@ -68,7 +70,20 @@ namespace gr {
 	  d_mu = mu;
 	}
       }
-  
+
+      void set_block_size(int block_size)
+      {
+	if(block_size < 1) {
+	  throw std::out_of_range("lms_dd_equalizer_cc_impl::set_block_size: Block size must be >= 1");
+	}
+	d_block_size = block_size;
+      }
+
+      int block_size() const
+      {
+	return d_block_size;
+      }
+
       int work(int noutput_items,
 	       gr_vector_const_void_star &input_items,
 	       gr_vector_void_star &output_items);
@@ -28,6 +28,7 @@
 #include <gnuradio/io_signature.h>
 #include <gnuradio/math.h>
 #include <gnuradio/expj.h>
+#include <volk/volk.h>
 #include <stdexcept>
 
 namespace gr {
@@ -212,26 +213,36 @@ namespace gr {
     }
 
     void
-    mpsk_receiver_cc_impl::mm_sampler(const gr_complex symbol)
+    mpsk_receiver_cc_impl::mm_sampler(const gr_complex *in, int nsamples)
     {
-      gr_complex sample, nco;
-
-      d_mu--;             // skip a number of symbols between sampling
-      d_phase += d_freq;  // increment the phase based on the frequency of the rotation
+      // Derotate the whole inter-symbol chunk in one volk rotator call
+      // instead of computing gr_expj() once per sample.  The loop state
+      // (d_phase, d_freq) is constant over the chunk since the phase
+      // tracking loop only advances on sampled symbols.  The phase is
+      // incremented before each sample is used, so the first sample of
+      // the chunk sees d_phase + d_freq.
+      if(d_rot.size() < (size_t)nsamples)
+	d_rot.resize(nsamples);
+
+      gr_complex phasor = gr_expj(d_phase + d_freq + d_theta);
+      gr_complex incr = gr_expj(d_freq);
+      volk_32fc_s32fc_x2_rotator_32fc(&d_rot[0], in, incr, &phasor, nsamples);
+
+      d_mu -= nsamples;              // skip a number of symbols between sampling
+      d_phase += nsamples * d_freq;  // advance the phase past the chunk
 
       // Keep phase clamped and not walk to infinity
       while(d_phase > M_TWOPI)
 	d_phase -= M_TWOPI;
       while(d_phase < -M_TWOPI)
 	d_phase += M_TWOPI;
-  
-      nco = gr_expj(d_phase+d_theta);   // get the NCO value for derotating the current sample
-      sample = nco*symbol;      // get the downconverted symbol
-  
+
       // Fill up the delay line for the interpolator
-      d_dl[d_dl_idx] = sample;
-      d_dl[(d_dl_idx + DLLEN)] = sample;  // put this in the second half of the buffer for overflows
-      d_dl_idx = (d_dl_idx+1) % DLLEN;    // Keep the delay line index in bounds
+      for(int k = 0; k < nsamples; k++) {
+	d_dl[d_dl_idx] = d_rot[k];
+	d_dl[(d_dl_idx + DLLEN)] = d_rot[k];  // put this in the second half of the buffer for overflows
+	d_dl_idx = (d_dl_idx+1) % DLLEN;      // Keep the delay line index in bounds
+      }
     }
 
     void
@@ -302,11 +313,17 @@ namespace gr {
       int i=0, o=0;
 
       while((o < noutput_items) && (i < ninput_items[0])) {
-	while((d_mu > 1) && (i < ninput_items[0]))  {
-	  mm_sampler(in[i]);   // puts symbols into a buffer and adjusts d_mu
-	  i++;
+	if(d_mu > 1) {
+	  // number of samples the timing loop slides past before the
+	  // next symbol is taken; derotate them as one chunk
+	  int nskip = (int)ceilf(d_mu - 1.0f);
+	  int ntake = std::min(nskip, ninput_items[0] - i);
+	  mm_sampler(&in[i], ntake);   // derotates the chunk into the delay line, adjusts d_mu
+	  i += ntake;
+	  if(ntake < nskip)            // ran out of input mid-chunk
+	    break;
 	}
-    
+
 	if(i < ninput_items[0]) {
 	  gr_complex interp_sample = d_interp->interpolate(&d_dl[d_dl_idx], d_mu);
 
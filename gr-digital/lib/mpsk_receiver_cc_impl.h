@@ -99,7 +99,7 @@ namespace gr {
   
     protected:
       void make_constellation();
-      void mm_sampler(const gr_complex symbol);
+      void mm_sampler(const gr_complex *in, int nsamples);
       void mm_error_tracking(gr_complex sample);
       void phase_error_tracking(gr_complex sample);
 
@@ -236,6 +236,9 @@ namespace gr {
   
       //! index to delay line
       unsigned int d_dl_idx;
+
+      //! scratch space for the chunked derotator
+      std::vector<gr_complex> d_rot;
     };
 
   } /* namespace digital */
@@ -151,40 +151,45 @@ namespace gr {
 	out += d_fft_len;
       }
 
-      // Copy data symbols
+      // Copy data symbols, one OFDM symbol at a time.  The carrier
+      // vectors (shifted and wrapped in the constructor) serve as
+      // scatter index tables, so the inner loop is a branch-free
+      // scatter copy instead of per-item set bookkeeping.
       long n_ofdm_symbols = 0; // Number of output items
       int curr_set = 0;
-      int symbols_to_allocate = d_occupied_carriers[0].size();
-      int symbols_allocated = 0;
-      for (int i = 0; i < ninput_items[0]; i++) {
-	if (symbols_allocated == 0) {
-	  // Copy all tags associated with these input symbols onto this OFDM symbol
-	  get_tags_in_range(tags, 0,
-	      nitems_read(0)+i,
-	      nitems_read(0)+std::min(i+symbols_to_allocate, (int) ninput_items[0])
+      int i = 0; // Position in the input
+      while (i < ninput_items[0]) {
+	int n_k = std::min((int) d_occupied_carriers[curr_set].size(),
+			   ninput_items[0] - i);
+
+	// Copy all tags associated with these input symbols onto this OFDM symbol
+	get_tags_in_range(tags, 0, nitems_read(0)+i, nitems_read(0)+i+n_k);
+	for (unsigned t = 0; t < tags.size(); t++) {
+	  add_item_tag(
+	      0,
+	      nitems_written(0) + n_ofdm_symbols + (n_ofdm_symbols == 0 ? 0 : d_sync_words.size()),
+	      tags[t].key,
+	      tags[t].value
 	  );
-	  for (unsigned t = 0; t < tags.size(); t++) {
-	    add_item_tag(
-		0,
-		nitems_written(0) + n_ofdm_symbols + (n_ofdm_symbols == 0 ? 0 : d_sync_words.size()),
-		tags[t].key,
-		tags[t].value
-	    );
-	  }
-	  n_ofdm_symbols++;
 	}
-	out[(n_ofdm_symbols-1) * d_fft_len + d_occupied_carriers[curr_set][symbols_allocated]] = in[i];
-	symbols_allocated++;
-	if (symbols_allocated == symbols_to_allocate) {
-	  curr_set = (curr_set + 1) % d_occupied_carriers.size();
-	  symbols_to_allocate = d_occupied_carriers[curr_set].size();
-	  symbols_allocated = 0;
+
+	const int *idx = &d_occupied_carriers[curr_set][0];
+	gr_complex *o = out + n_ofdm_symbols * d_fft_len;
+	for (int k = 0; k < n_k; k++) {
+	  o[idx[k]] = in[i+k];
 	}
+
+	i += n_k;
+	n_ofdm_symbols++;
+	curr_set = (curr_set + 1) % d_occupied_carriers.size();
       }
       // Copy pilot symbols
       for (int i = 0; i < n_ofdm_symbols; i++) {
-	for (unsigned k = 0; k < d_pilot_carriers[i % d_pilot_carriers.size()].size(); k++) {
-	  out[i * d_fft_len + d_pilot_carriers[i % d_pilot_carriers.size()][k]] = d_pilot_symbols[i % d_pilot_symbols.size()][k];
+	const std::vector<int> &pc = d_pilot_carriers[i % d_pilot_carriers.size()];
+	const std::vector<gr_complex> &ps = d_pilot_symbols[i % d_pilot_symbols.size()];
+	gr_complex *o = out + i * d_fft_len;
+	for (unsigned k = 0; k < pc.size(); k++) {
+	  o[pc[k]] = ps[k];
 	}
       }
 
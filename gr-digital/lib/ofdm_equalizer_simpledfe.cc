@@ -24,6 +24,7 @@
 #endif
 
 #include <gnuradio/digital/ofdm_equalizer_simpledfe.h>
+#include <volk/volk.h>
 
 namespace gr {
   namespace digital {
@@ -66,11 +67,40 @@ namespace gr {
 	  d_constellation(constellation),
 	  d_alpha(alpha)
     {
+      // Precompute, for every pilot carrier set, the list of data
+      // carrier positions.  equalize() walks these scatter tables
+      // instead of testing the carrier masks per carrier per symbol.
+      int n_sets = d_pilot_carriers.empty() ? 1 : d_pilot_carriers.size();
+      d_data_carriers.resize(n_sets);
+      for (int s = 0; s < n_sets; s++) {
+	for (int k = 0; k < d_fft_len; k++) {
+	  if (d_occupied_carriers[k]
+	      && !(!d_pilot_carriers.empty() && d_pilot_carriers[s][k])) {
+	    d_data_carriers[s].push_back(k);
+	  }
+	}
+      }
+
+      const int al = volk_get_alignment();
+      d_in_buf    = (gr_complex*)volk_malloc(fft_len*sizeof(gr_complex), al);
+      d_chan_buf  = (gr_complex*)volk_malloc(fft_len*sizeof(gr_complex), al);
+      d_eq_buf    = (gr_complex*)volk_malloc(fft_len*sizeof(gr_complex), al);
+      d_est_buf   = (gr_complex*)volk_malloc(fft_len*sizeof(gr_complex), al);
+      d_mag_buf   = (float*)volk_malloc(fft_len*sizeof(float), al);
+      d_recip_buf = (float*)volk_malloc(fft_len*sizeof(float), al);
+      d_dec_buf   = (unsigned char*)volk_malloc(fft_len, al);
     }
 
 
     ofdm_equalizer_simpledfe::~ofdm_equalizer_simpledfe()
     {
+      volk_free(d_in_buf);
+      volk_free(d_chan_buf);
+      volk_free(d_eq_buf);
+      volk_free(d_est_buf);
+      volk_free(d_mag_buf);
+      volk_free(d_recip_buf);
+      volk_free(d_dec_buf);
     }
 
 
@@ -83,25 +113,58 @@ namespace gr {
       if (!initial_taps.empty()) {
 	d_channel_state = initial_taps;
       }
-      gr_complex sym_eq, sym_est;
 
       for (int i = 0; i < n_sym; i++) {
-	for (int k = 0; k < d_fft_len; k++) {
-	  if (!d_occupied_carriers[k]) {
-	    continue;
-	  }
-	  if (!d_pilot_carriers.empty() && d_pilot_carriers[d_pilot_carr_set][k]) {
-	    d_channel_state[k] = d_alpha * d_channel_state[k]
-			       + (1-d_alpha) * frame[i*d_fft_len + k] / d_pilot_symbols[d_pilot_carr_set][k];
-	    frame[i*d_fft_len+k] = d_pilot_symbols[d_pilot_carr_set][k];
-	  } else {
-	    sym_eq = frame[i*d_fft_len+k] / d_channel_state[k];
-	    d_constellation->map_to_points(d_constellation->decision_maker(&sym_eq), &sym_est);
-	    d_channel_state[k] = d_alpha * d_channel_state[k]
-                               + (1-d_alpha) * frame[i*d_fft_len + k] / sym_est;
-	    frame[i*d_fft_len+k] = sym_est;
+	gr_complex *sym = frame + i * d_fft_len;
+
+	// Pilot carriers: update the channel state from the known symbols
+	if (!d_pilot_carriers.empty()) {
+	  for (int k = 0; k < d_fft_len; k++) {
+	    if (d_pilot_carriers[d_pilot_carr_set][k]) {
+	      d_channel_state[k] = d_alpha * d_channel_state[k]
+				 + (1-d_alpha) * sym[k] / d_pilot_symbols[d_pilot_carr_set][k];
+	      sym[k] = d_pilot_symbols[d_pilot_carr_set][k];
+	    }
 	  }
 	}
+
+	// Data carriers: gather the received carriers and the channel
+	// state into aligned scratch, equalize and slice the whole
+	// symbol in batched passes, then update the channel state and
+	// scatter the decisions back.
+	const std::vector<int> &dc =
+	  d_data_carriers[d_pilot_carriers.empty() ? 0 : d_pilot_carr_set];
+	int n = dc.size();
+	for (int j = 0; j < n; j++) {
+	  d_in_buf[j] = sym[dc[j]];
+	  d_chan_buf[j] = d_channel_state[dc[j]];
+	}
+
+	// sym_eq = in/chan, computed as in*conj(chan) / |chan|^2
+	volk_32fc_x2_multiply_conjugate_32fc(d_eq_buf, d_in_buf, d_chan_buf, n);
+	volk_32fc_magnitude_squared_32f(d_mag_buf, d_chan_buf, n);
+	for (int j = 0; j < n; j++)
+	  d_recip_buf[j] = 1.0f / d_mag_buf[j];
+	volk_32fc_32f_multiply_32fc(d_eq_buf, d_eq_buf, d_recip_buf, n);
+
+	// Slice all carriers at once (table lookups when the
+	// constellation has a hard decision LUT)
+	d_constellation->decision_maker_v(d_eq_buf, d_dec_buf, n);
+	for (int j = 0; j < n; j++)
+	  d_constellation->map_to_points(d_dec_buf[j], &d_est_buf[j]);
+
+	// chan = alpha*chan + (1-alpha) * in/est, same division recipe
+	volk_32fc_x2_multiply_conjugate_32fc(d_in_buf, d_in_buf, d_est_buf, n);
+	volk_32fc_magnitude_squared_32f(d_mag_buf, d_est_buf, n);
+	for (int j = 0; j < n; j++)
+	  d_recip_buf[j] = (1-d_alpha) / d_mag_buf[j];
+	volk_32fc_32f_multiply_32fc(d_in_buf, d_in_buf, d_recip_buf, n);
+
+	for (int j = 0; j < n; j++) {
+	  d_channel_state[dc[j]] = d_alpha * d_chan_buf[j] + d_in_buf[j];
+	  sym[dc[j]] = d_est_buf[j];
+	}
+
 	if (!d_pilot_carriers.empty()) {
 	  d_pilot_carr_set = (d_pilot_carr_set + 1) % d_pilot_carriers.size();
 	}
@@ -0,0 +1,380 @@
+/* -*- c++ -*- */
+/* Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/expj.h>
+#include <gnuradio/io_signature.h>
+#include "ofdm_rx_engine_vcc_impl.h"
+
+#define M_TWOPI (2*M_PI)
+
+namespace gr {
+  namespace digital {
+
+    ofdm_rx_engine_vcc::sptr
+    ofdm_rx_engine_vcc::make(
+	const std::vector<gr_complex> &sync_symbol1,
+	const std::vector<gr_complex> &sync_symbol2,
+	int n_data_symbols,
+	ofdm_equalizer_base::sptr equalizer,
+	int cp_len,
+	const std::vector<std::vector<int> > &occupied_carriers,
+	const std::string &packet_len_tag_key,
+	int eq_noise_red_len,
+	int max_carr_offset,
+	bool force_one_sync_symbol,
+	bool input_is_shifted
+    )
+    {
+      return gnuradio::get_initial_sptr (
+	  new ofdm_rx_engine_vcc_impl(
+	    sync_symbol1,
+	    sync_symbol2,
+	    n_data_symbols,
+	    equalizer,
+	    cp_len,
+	    occupied_carriers,
+	    packet_len_tag_key,
+	    eq_noise_red_len,
+	    max_carr_offset,
+	    force_one_sync_symbol,
+	    input_is_shifted
+	  )
+      );
+    }
+
+    ofdm_rx_engine_vcc_impl::ofdm_rx_engine_vcc_impl(
+	    const std::vector<gr_complex> &sync_symbol1,
+	    const std::vector<gr_complex> &sync_symbol2,
+	    int n_data_symbols,
+	    ofdm_equalizer_base::sptr equalizer,
+	    int cp_len,
+	    const std::vector<std::vector<int> > &occupied_carriers,
+	    const std::string &packet_len_tag_key,
+	    int eq_noise_red_len,
+	    int max_carr_offset,
+	    bool force_one_sync_symbol,
+	    bool input_is_shifted
+    ) : block("ofdm_rx_engine_vcc",
+	      io_signature::make(1, 1, sizeof (gr_complex) * sync_symbol1.size()),
+	      io_signature::make(1, 1, sizeof (gr_complex))),
+      d_fft_len(sync_symbol1.size()),
+      d_n_data_syms(n_data_symbols),
+      d_n_sync_syms(1),
+      d_eq_noise_red_len(eq_noise_red_len),
+      d_ref_sym((sync_symbol2.size() && !force_one_sync_symbol) ? sync_symbol2 : sync_symbol1),
+      d_corr_v(sync_symbol2),
+      d_known_symbol_diffs(0, 0),
+      d_new_symbol_diffs(0, 0),
+      d_interpolate(false),
+      d_eq(equalizer),
+      d_cp_len(cp_len),
+      d_occupied_carriers(occupied_carriers),
+      d_packet_len_tag_key(pmt::string_to_symbol(packet_len_tag_key)),
+      d_symbols_per_frame(0),
+      d_eq_buffer(sync_symbol1.size() * n_data_symbols, 0),
+      d_chan_taps(sync_symbol1.size(), 0)
+    {
+      if (d_fft_len != equalizer->fft_len()) {
+	throw std::invalid_argument("Equalizer and sync symbols must have the same FFT length.");
+      }
+
+      // Set index of first and last active carrier
+      for (int i = 0; i < d_fft_len; i++) {
+	if (d_ref_sym[i] != gr_complex(0, 0)) {
+	  d_first_active_carrier = i;
+	  break;
+	}
+      }
+      for (int i = d_fft_len-1; i >= 0; i--) {
+	if (d_ref_sym[i] != gr_complex(0, 0)) {
+	  d_last_active_carrier = i;
+	  break;
+	}
+      }
+
+      // Sanity checks
+      if (sync_symbol2.size()) {
+	if (sync_symbol1.size() != sync_symbol2.size()) {
+	  throw std::invalid_argument("sync symbols must have equal length.");
+	}
+	if (!force_one_sync_symbol) {
+	  d_n_sync_syms = 2;
+	}
+      } else {
+	if (sync_symbol1[d_first_active_carrier+1] == gr_complex(0, 0)) {
+	  d_last_active_carrier++;
+	  d_interpolate = true;
+	}
+      }
+
+      // Set up coarse freq estimation info
+      // Allow all possible values:
+      d_max_neg_carr_offset = -d_first_active_carrier;
+      d_max_pos_carr_offset = d_fft_len - d_last_active_carrier - 1;
+      if (max_carr_offset != -1) {
+	d_max_neg_carr_offset = std::max(-max_carr_offset, d_max_neg_carr_offset);
+	d_max_pos_carr_offset = std::min(max_carr_offset, d_max_pos_carr_offset);
+      }
+      // Carrier offsets must be even
+      if (d_max_neg_carr_offset % 2)
+	d_max_neg_carr_offset++;
+      if (d_max_pos_carr_offset % 2)
+	d_max_pos_carr_offset--;
+
+      if (d_n_sync_syms == 2) {
+	for (int i = 0; i < d_fft_len; i++) {
+	  if (sync_symbol1[i] == gr_complex(0, 0)) {
+	    d_corr_v[i] = gr_complex(0, 0);
+	  } else {
+	    d_corr_v[i] /= sync_symbol1[i];
+	  }
+	}
+      } else {
+	d_corr_v.resize(0, 0);
+	d_known_symbol_diffs.resize(d_fft_len, 0);
+	d_new_symbol_diffs.resize(d_fft_len, 0);
+	for (int i = d_first_active_carrier; i < d_last_active_carrier-2 && i < d_fft_len-2; i += 2) {
+	  d_known_symbol_diffs[i] = std::norm(sync_symbol1[i] - sync_symbol1[i+2]);
+	}
+      }
+
+      // Normalize the occupied carriers the same way the serializer does
+      for (unsigned i = 0; i < d_occupied_carriers.size(); i++) {
+	for (unsigned k = 0; k < d_occupied_carriers[i].size(); k++) {
+	  if (input_is_shifted) {
+	    d_occupied_carriers[i][k] += d_fft_len/2;
+	    if (d_occupied_carriers[i][k] > d_fft_len) {
+	      d_occupied_carriers[i][k] -= d_fft_len;
+	    }
+	  } else {
+	    if (d_occupied_carriers[i][k] < 0) {
+	      d_occupied_carriers[i][k] += d_fft_len;
+	    }
+	  }
+	  if (d_occupied_carriers[i][k] >= d_fft_len || d_occupied_carriers[i][k] < 0) {
+	    throw std::invalid_argument("ofdm_rx_engine_vcc: trying to occupy a carrier outside the fft length.");
+	  }
+	}
+      }
+      for (int i = 0; i < d_n_data_syms; i++) {
+	d_symbols_per_frame += d_occupied_carriers[i % d_occupied_carriers.size()].size();
+      }
+
+      set_output_multiple(d_symbols_per_frame);
+      set_relative_rate((double) d_symbols_per_frame / (d_n_data_syms + d_n_sync_syms));
+      set_tag_propagation_policy(TPP_DONT);
+    }
+
+    ofdm_rx_engine_vcc_impl::~ofdm_rx_engine_vcc_impl()
+    {
+    }
+
+    void
+    ofdm_rx_engine_vcc_impl::forecast (int noutput_items, gr_vector_int &ninput_items_required)
+    {
+      ninput_items_required[0] = (noutput_items/d_symbols_per_frame) * (d_n_data_syms + d_n_sync_syms);
+    }
+
+    int
+    ofdm_rx_engine_vcc_impl::get_carr_offset(const gr_complex *sync_sym1, const gr_complex *sync_sym2)
+    {
+      int carr_offset = 0;
+      if (d_corr_v.size()) {
+	// Use Schmidl & Cox method
+	float Bg_max = 0;
+	// g here is 2g in the paper
+	for (int g = d_max_neg_carr_offset; g <= d_max_pos_carr_offset; g += 2) {
+	  gr_complex tmp = gr_complex(0, 0);
+	  for (int k = 0; k < d_fft_len; k++) {
+	    if (d_corr_v[k] != gr_complex(0, 0)) {
+	      tmp += std::conj(sync_sym1[k+g]) * std::conj(d_corr_v[k]) * sync_sym2[k+g];
+	    }
+	  }
+	  if (std::abs(tmp) > Bg_max) {
+	    Bg_max = std::abs(tmp);
+	    carr_offset = g;
+	  }
+	}
+      } else {
+	// Correlate
+	std::fill(d_new_symbol_diffs.begin(), d_new_symbol_diffs.end(), 0);
+	for(int i = 0; i < d_fft_len-2; i++) {
+	  d_new_symbol_diffs[i] = std::norm(sync_sym1[i] - sync_sym1[i+2]);
+	}
+
+	float sum;
+	float max = 0;
+	for (int g = d_max_neg_carr_offset; g <= d_max_pos_carr_offset; g += 2) {
+	  sum = 0;
+	  for (int j = 0; j < d_fft_len; j++) {
+	    if (d_known_symbol_diffs[j]) {
+	      sum += (d_known_symbol_diffs[j] * d_new_symbol_diffs[j + g]);
+	    }
+	    if(sum > max) {
+	      max = sum;
+	      carr_offset = g;
+	    }
+	  }
+	}
+      }
+      return carr_offset;
+    }
+
+    void
+    ofdm_rx_engine_vcc_impl::get_chan_taps(
+	const gr_complex *sync_sym1,
+	const gr_complex *sync_sym2,
+	int carr_offset,
+	std::vector<gr_complex> &taps)
+    {
+      const gr_complex *sym = ((d_n_sync_syms == 2) ? sync_sym2 : sync_sym1);
+      std::fill(taps.begin(), taps.end(), gr_complex(0, 0));
+      int loop_start = 0;
+      int loop_end = d_fft_len;
+      if (carr_offset > 0) {
+	loop_start = carr_offset;
+      } else if (carr_offset < 0) {
+	loop_end = d_fft_len + carr_offset;
+      }
+      for (int i = loop_start; i < loop_end; i++) {
+	if ((d_ref_sym[i-carr_offset] != gr_complex(0, 0))) {
+	  taps[i-carr_offset] = sym[i] / d_ref_sym[i-carr_offset];
+	}
+      }
+
+      if (d_interpolate) {
+	for (int i = d_first_active_carrier + 1; i < d_last_active_carrier; i += 2) {
+	  taps[i] = taps[i-1];
+	}
+	taps[d_last_active_carrier] = taps[d_last_active_carrier-1];
+      }
+
+      if (d_eq_noise_red_len) {
+	// TODO (same as in ofdm_chanest_vcvc)
+	// 1) IFFT
+	// 2) Set all elements > d_eq_noise_red_len to zero
+	// 3) FFT
+      }
+    }
+
+    // Operates on a per-frame basis
+    int
+    ofdm_rx_engine_vcc_impl::general_work (int noutput_items,
+                       gr_vector_int &ninput_items,
+                       gr_vector_const_void_star &input_items,
+                       gr_vector_void_star &output_items)
+    {
+      const gr_complex *in = (const gr_complex *) input_items[0];
+      gr_complex *out = (gr_complex *) output_items[0];
+      const int framesize = d_n_sync_syms + d_n_data_syms;
+      if (ninput_items[0] < framesize) {
+	return 0;
+      }
+
+      // Channel info estimation (stage 1, was ofdm_chanest_vcvc)
+      int carr_offset = get_carr_offset(in, in+d_fft_len);
+      get_chan_taps(in, in+d_fft_len, carr_offset, d_chan_taps);
+
+      // Shift the data symbols to the correct position and correct the
+      // frequency shift (stage 2, was ofdm_frame_equalizer_vcvc)
+      const gr_complex *data_syms = in + d_n_sync_syms * d_fft_len;
+      gr_complex *eq = &d_eq_buffer[0];
+      if (carr_offset < 0) {
+	memset((void *) eq, 0x00, sizeof(gr_complex) * (-carr_offset));
+	memcpy(
+	    (void *) &eq[-carr_offset], (void *) data_syms,
+	    sizeof(gr_complex) * (d_fft_len * d_n_data_syms + carr_offset)
+	);
+      } else {
+	memset((void *) (eq + d_fft_len * d_n_data_syms - carr_offset), 0x00, sizeof(gr_complex) * carr_offset);
+	memcpy(
+	    (void *) eq, (void *) (data_syms+carr_offset),
+	    sizeof(gr_complex) * (d_fft_len * d_n_data_syms - carr_offset)
+	);
+      }
+      gr_complex phase_correction;
+      for (int i = 0; i < d_n_data_syms; i++) {
+	phase_correction = gr_expj(-M_TWOPI * carr_offset * d_cp_len / d_fft_len * (i+1));
+	for (int k = 0; k < d_fft_len; k++) {
+	  eq[i*d_fft_len+k] *= phase_correction;
+	}
+      }
+
+      // Do the equalizing, right off the estimated taps
+      d_eq->reset();
+      d_eq->equalize(eq, d_n_data_syms, d_chan_taps);
+
+      // Pick the occupied carriers out into the output stream
+      // (stage 3, was ofdm_serializer_vcc)
+      long packet_length = 0; // If we find a length tag, this caps the output
+      std::vector<tag_t> tags;
+      get_tags_in_range(tags, 0, nitems_read(0), nitems_read(0)+framesize);
+      for (unsigned t = 0; t < tags.size(); t++) {
+	if (tags[t].key == d_packet_len_tag_key) {
+	  packet_length = pmt::to_long(tags[t].value);
+	}
+      }
+
+      int n_out_symbols = 0;
+      int curr_set = 0;
+      for (int i = 0; i < d_n_data_syms; i++) {
+	// Copy all tags associated with this input OFDM symbol onto the
+	// first output symbol; tags on the sync symbols go with the
+	// first data symbol
+	std::vector<tag_t> sym_tags;
+	uint64_t tag_rd_start = (i == 0) ? nitems_read(0) : (nitems_read(0) + d_n_sync_syms + i);
+	get_tags_in_range(sym_tags, 0, tag_rd_start, nitems_read(0) + d_n_sync_syms + i + 1);
+	for (unsigned t = 0; t < sym_tags.size(); t++) {
+	  if (sym_tags[t].key == d_packet_len_tag_key) {
+	    continue; // replaced below with the actual output length
+	  }
+	  add_item_tag(0, nitems_written(0)+n_out_symbols,
+	    sym_tags[t].key,
+	    sym_tags[t].value
+	  );
+	}
+	for (unsigned k = 0; k < d_occupied_carriers[curr_set].size(); k++) {
+	  out[n_out_symbols++] = eq[i * d_fft_len + d_occupied_carriers[curr_set][k]];
+	}
+	if (packet_length && n_out_symbols > packet_length) {
+	  n_out_symbols = packet_length;
+	  break;
+	}
+	curr_set = (curr_set + 1) % d_occupied_carriers.size();
+      }
+
+      add_item_tag(0, nitems_written(0),
+	  d_packet_len_tag_key,
+	  pmt::from_long(n_out_symbols));
+      add_item_tag(0, nitems_written(0),
+	  pmt::string_to_symbol("ofdm_sync_carr_offset"),
+	  pmt::from_long(carr_offset));
+
+      consume_each(framesize);
+      return n_out_symbols;
+    }
+
+  } /* namespace digital */
+} /* namespace gr */
@@ -0,0 +1,122 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/io_signature.h>
+#include <gnuradio/math.h>
+#include <volk/volk.h>
+#include "ofdm_sync_sc_cfb_detector.h"
+
+namespace gr {
+  namespace digital {
+
+    class ofdm_sync_sc_cfb_detector_impl : public ofdm_sync_sc_cfb_detector
+    {
+     private:
+      const int d_fft_len;
+      const int d_delay; //! fft_len/2, the autocorrelation lag
+      const float d_sign; //! -1 if the sync symbol uses the odd carriers
+      //! Scratch: in[n] * conj(in[n - d_delay])
+      std::vector<gr_complex> d_corr;
+      //! Scratch: |in[n]|^2
+      std::vector<float> d_magsq;
+
+     public:
+      ofdm_sync_sc_cfb_detector_impl(int fft_len, bool use_even_carriers)
+	: sync_block("ofdm_sync_sc_cfb_detector",
+	      io_signature::make(1, 1, sizeof (gr_complex)),
+	      io_signature::make2(2, 2, sizeof (float), sizeof (float))),
+	  d_fft_len(fft_len),
+	  d_delay(fft_len/2),
+	  d_sign(use_even_carriers ? 1.0 : -1.0)
+      {
+	set_history(fft_len);
+      }
+
+      ~ofdm_sync_sc_cfb_detector_impl()
+      {
+      }
+
+      int work(int noutput_items,
+	       gr_vector_const_void_star &input_items,
+	       gr_vector_void_star &output_items)
+      {
+	const gr_complex *in = (const gr_complex *) input_items[0];
+	float *out_angle = (float *) output_items[0];
+	float *out_metric = (float *) output_items[1];
+
+	// in[0] is the oldest history item; the first new item is
+	// in[d_fft_len-1]. For output item i we need the correlation
+	// window c[i..i+d_delay-1] and the energy window
+	// e[i..i+d_fft_len-1], with
+	//   c[k] = in[k+d_delay] * conj(in[k])
+	//   e[k] = |in[k]|^2
+	const int n_corr = noutput_items + d_delay - 1;
+	const int n_magsq = noutput_items + d_fft_len - 1;
+	if ((int) d_corr.size() < n_corr) {
+	  d_corr.resize(n_corr);
+	}
+	if ((int) d_magsq.size() < n_magsq) {
+	  d_magsq.resize(n_magsq);
+	}
+	volk_32fc_x2_multiply_conjugate_32fc(&d_corr[0], &in[d_delay], in, n_corr);
+	volk_32fc_magnitude_squared_32f(&d_magsq[0], in, n_magsq);
+
+	// Seed the sliding windows, then add/subtract per sample
+	gr_complex p_sum = 0;
+	for (int k = 0; k < d_delay; k++) {
+	  p_sum += d_corr[k];
+	}
+	float e_sum = 0;
+	for (int k = 0; k < d_fft_len; k++) {
+	  e_sum += d_magsq[k];
+	}
+
+	for (int i = 0; i < noutput_items; i++) {
+	  if (i) {
+	    p_sum += d_corr[i+d_delay-1] - d_corr[i-1];
+	    e_sum += d_magsq[i+d_fft_len-1] - d_magsq[i-1];
+	  }
+	  out_angle[i] = gr::fast_atan2f(d_sign * p_sum.imag(), d_sign * p_sum.real());
+	  // R(d) is the half-sum of the energy window, and the metric
+	  // is |P(d)|^2 / R(d)^2 -- same as the old divide_ff, so a
+	  // silent input still yields the same non-finite values
+	  float r = 0.5 * e_sum;
+	  out_metric[i] = (p_sum.real()*p_sum.real() + p_sum.imag()*p_sum.imag()) / (r*r);
+	}
+
+	return noutput_items;
+      }
+    };
+
+    ofdm_sync_sc_cfb_detector::sptr
+    ofdm_sync_sc_cfb_detector::make(int fft_len, bool use_even_carriers)
+    {
+      return gnuradio::get_initial_sptr(
+	  new ofdm_sync_sc_cfb_detector_impl(fft_len, use_even_carriers));
+    }
+
+  } /* namespace digital */
+} /* namespace gr */
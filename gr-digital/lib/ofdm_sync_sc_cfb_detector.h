@@ -0,0 +1,59 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_DIGITAL_OFDM_SYNC_SC_CFB_DETECTOR_H
+#define INCLUDED_DIGITAL_OFDM_SYNC_SC_CFB_DETECTOR_H
+
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace digital {
+
+    /*!
+     * \brief Monolithic Schmidl & Cox metric calculation for ofdm_sync_sc_cfb.
+     *
+     * Internal to ofdm_sync_sc_cfb; not part of the public API.
+     *
+     * Computes, in a single work() call, what used to be a chain of
+     * delay, conjugate multiply, two moving averages, mag-square and
+     * divide blocks: the delayed autocorrelation P(d), the energy R(d)
+     * and from those the timing metric |P(d)|^2 / R(d)^2 and the fine
+     * frequency estimate arg(P(d)). The moving sums are updated with
+     * sliding-window adds/subtracts and re-seeded at the start of every
+     * work() call, so rounding errors cannot accumulate.
+     *
+     * Input: complex samples
+     * Output 0: arg(P(d)) (float)
+     * Output 1: timing metric (float)
+     */
+    class ofdm_sync_sc_cfb_detector : virtual public sync_block
+    {
+     public:
+      typedef boost::shared_ptr<ofdm_sync_sc_cfb_detector> sptr;
+
+      static sptr make(int fft_len, bool use_even_carriers);
+    };
+
+  } // namespace digital
+} // namespace gr
+
+#endif /* INCLUDED_DIGITAL_OFDM_SYNC_SC_CFB_DETECTOR_H */
@@ -24,6 +24,7 @@
 #endif
 
 #include <string.h>
+#include <algorithm>
 #include <gnuradio/digital/packet_header_default.h>
 
 namespace gr {
@@ -61,6 +62,25 @@ namespace gr {
     {
     }
 
+    unsigned long long
+    packet_header_default::extract_header_word(const unsigned char *in, int nsyms)
+    {
+      unsigned long long word = 0;
+      for (int k = 0; k < nsyms; k++) {
+	word |= (unsigned long long) (in[k] & d_mask) << (k * d_bits_per_byte);
+      }
+      return word;
+    }
+
+    void
+    packet_header_default::insert_header_word(unsigned char *out, unsigned long long word, int nsyms)
+    {
+      for (int k = 0; k < nsyms; k++) {
+	out[k] = (unsigned char) (word & d_mask);
+	word >>= d_bits_per_byte;
+      }
+    }
+
     bool packet_header_default::header_formatter(
 	long packet_len,
         unsigned char *out,
@@ -74,17 +94,20 @@ namespace gr {
       d_crc_impl.process_bytes((void const *) &d_header_number, 2);
       unsigned char crc = d_crc_impl();
 
+      // Assemble the whole header in one 64-bit word and scatter it
+      // once.  Each field is padded out to a symbol boundary, as the
+      // symbol-by-symbol code always did.
+      int nsyms_12bit = (12 + d_bits_per_byte - 1) / d_bits_per_byte;
+      int nsyms_8bit = (8 + d_bits_per_byte - 1) / d_bits_per_byte;
+      int field_bits = nsyms_12bit * d_bits_per_byte;
+      unsigned long long word = (unsigned long long) packet_len
+	| (unsigned long long) d_header_number << field_bits
+	| (unsigned long long) crc << (2 * field_bits);
+
       memset(out, 0x00, d_header_len);
-      int k = 0; // Position in out
-      for (int i = 0; i < 12 && k < d_header_len; i += d_bits_per_byte, k++) {
-	out[k] = (unsigned char) ((packet_len >> i) & d_mask);
-      }
-      for (int i = 0; i < 12 && k < d_header_len; i += d_bits_per_byte, k++) {
-	out[k] = (unsigned char) ((d_header_number >> i) & d_mask);
-      }
-      for (int i = 0; i < 8 && k < d_header_len; i += d_bits_per_byte, k++) {
-	out[k] = (unsigned char) ((crc >> i) & d_mask);
-      }
+      insert_header_word(out, word,
+			 std::min((long) (2 * nsyms_12bit + nsyms_8bit), d_header_len));
+
       d_header_number++;
       d_header_number &= 0x0FFF;
 
@@ -99,10 +122,14 @@ namespace gr {
       unsigned header_num = 0;
       tag_t tag;
 
-      int k = 0; // Position in "in"
-      for (int i = 0; i < 12 && k < d_header_len; i += d_bits_per_byte, k++) {
-	header_len |= (((int) in[k]) & d_mask) << i;
-      }
+      // Gather each field's symbols into a 64-bit word and slice the
+      // value out with shifts; pmt values are only built once per
+      // field.
+      int nsyms_12bit = (12 + d_bits_per_byte - 1) / d_bits_per_byte;
+      int nsyms_8bit = (8 + d_bits_per_byte - 1) / d_bits_per_byte;
+
+      int k = (int) std::min((long) nsyms_12bit, d_header_len);
+      header_len = (unsigned) extract_header_word(in, k);
       tag.key = d_len_tag_key;
       tag.value = pmt::from_long(header_len);
       tags.push_back(tag);
@@ -112,9 +139,9 @@ namespace gr {
       if (d_num_tag_key == pmt::PMT_NIL) {
 	k += 12;
       } else {
-	for (int i = 0; i < 12 && k < d_header_len; i += d_bits_per_byte, k++) {
-	  header_num |= (((int) in[k]) & d_mask) << i;
-	}
+	int n = (int) std::min((long) nsyms_12bit, d_header_len - k);
+	header_num = (unsigned) extract_header_word(in + k, n);
+	k += n;
 	tag.key = d_num_tag_key;
 	tag.value = pmt::from_long(header_num);
 	tags.push_back(tag);
@@ -127,10 +154,15 @@ namespace gr {
       d_crc_impl.process_bytes((void const *) &header_len, 2);
       d_crc_impl.process_bytes((void const *) &header_num, 2);
       unsigned char crc_calcd = d_crc_impl();
-      for (int i = 0; i < 8 && k < d_header_len; i += d_bits_per_byte, k++) {
-	  if ( (((int) in[k]) & d_mask) != (((int) crc_calcd >> i) & d_mask) ) {
-	    return false;
-	  }
+      int n = (int) std::min((long) nsyms_8bit, d_header_len - k);
+      unsigned long long crc_rcvd = extract_header_word(in + k, n);
+      // compare under the per-symbol mask, like the received side
+      unsigned long long crc_mask = 0;
+      for (int i = 0; i < n; i++) {
+	crc_mask |= (unsigned long long) d_mask << (i * d_bits_per_byte);
+      }
+      if (crc_rcvd != ((unsigned long long) crc_calcd & crc_mask)) {
+	return false;
       }
 
       return true;
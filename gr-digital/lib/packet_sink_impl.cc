@@ -33,6 +33,8 @@
 #include <fcntl.h>
 #include <stdexcept>
 #include <gnuradio/blocks/count_bits.h>
+#include <gnuradio/blocks/bit_correlator.h>
+#include <stdint.h>
 #include <string.h>
 
 namespace gr {
@@ -123,6 +125,38 @@ static const int DEFAULT_THRESHOLD = 12;
 	  if(VERBOSE)
 	    fprintf(stderr, "SYNC Search, noutput=%d\n",noutput_items), fflush(stderr);
 
+	  {
+	    // Word-parallel search (same helpers as the access code
+	    // correlators): slice 64 samples into one word, then test
+	    // every alignment in the batch with one xor+popcount each,
+	    // with no serial shift-register dependency.
+	    bool found = false;
+	    while(!found && count + 64 <= noutput_items) {
+	      uint64_t packed = 0;
+	      for(int k = 0; k < 64; k++)
+		packed = (packed << 1) | slice(inbuf[count+k]);
+
+	      for(int k = 1; k <= 64; k++) {
+		uint64_t reg = gr::blocks::bit_correlator::window(d_shift_reg, packed, k);
+		if(gr::blocks::bit_correlator::distance(reg, d_sync_vector, ~0ULL) <= d_threshold) {
+		  // Found it, set up for header decode
+		  d_shift_reg = reg;
+		  count += k;
+		  enter_have_sync();
+		  found = true;
+		  break;
+		}
+	      }
+	      if(!found) {
+		d_shift_reg = packed;
+		count += 64;
+	      }
+	    }
+	    if(found)
+	      break;
+	  }
+
+	  // Tail of the buffer: bit at a time, as before
 	  while(count < noutput_items) {
 	    if(slice(inbuf[count++]))
 	      d_shift_reg = (d_shift_reg << 1) | 1;
@@ -172,7 +206,23 @@ static const int DEFAULT_THRESHOLD = 12;
 	  if(VERBOSE)
 	    fprintf(stderr,"Packet Build\n"),fflush(stderr);
 
-	  while(count < noutput_items) {   // shift bits into bytes of packet one at a time
+	  while(count < noutput_items) {   // shift bits into bytes of packet
+	    // Byte-aligned bulk path: pack 64 bits into 8 payload bytes
+	    // per pass.  Strictly more than 8 bytes must remain so the
+	    // packet is always completed (and the message sent) by the
+	    // bit-at-a-time path below.
+	    if(d_packet_byte_index == 0
+	       && noutput_items - count >= 64
+	       && d_packetlen - d_packetlen_cnt > 8) {
+	      uint64_t bits = 0;
+	      for(int k = 0; k < 64; k++)
+		bits = (bits << 1) | slice(inbuf[count+k]);
+	      count += 64;
+	      for(int b = 56; b >= 0; b -= 8)
+		d_packet[d_packetlen_cnt++] = (bits >> b) & 0xff;
+	      continue;
+	    }
+
 	    if(slice(inbuf[count++]))
 	      d_packet_byte = (d_packet_byte << 1) | 1;
 	    else
@@ -31,6 +31,7 @@
 #include "pfb_clock_sync_ccf_impl.h"
 #include <gnuradio/io_signature.h>
 #include <gnuradio/math.h>
+#include <volk/volk.h>
 #include <boost/format.hpp>
 #include <boost/math/special_functions/round.hpp>
 
@@ -65,6 +66,7 @@ namespace gr {
 		  io_signature::make(1, 1, sizeof(gr_complex)),
 		  io_signature::makev(1, 4, iosig)),
 	d_updated(false), d_nfilters(filter_size),
+	d_packed_taps(NULL),
 	d_max_dev(max_rate_deviation),
 	d_osps(osps), d_error(0), d_out_idx(0)
     {
@@ -114,6 +116,7 @@ namespace gr {
 	delete d_filters[i];
 	delete d_diff_filters[i];
       }
+      volk_free(d_packed_taps);
     }
 
     bool
@@ -271,6 +274,8 @@ namespace gr {
 	ourfilter[i]->set_taps(ourtaps[i]);
       }
 
+      pack_taps();
+
       // Set the history to ensure enough input items for each filter
       set_history(d_taps_per_filter + d_sps + d_sps);
 
@@ -280,6 +285,32 @@ namespace gr {
       d_updated = true;
     }
 
+    void
+    pfb_clock_sync_ccf_impl::pack_taps()
+    {
+      // fir_filter stores its taps reversed so it can run a straight
+      // dot product over the input; do the same here. Arm i gets its
+      // matched taps at 2*i*d_taps_per_filter and its derivative taps
+      // directly behind them.
+      volk_free(d_packed_taps);
+      d_packed_taps = (float*)volk_malloc(2*d_nfilters*d_taps_per_filter*sizeof(float),
+					  volk_get_alignment());
+      memset(d_packed_taps, 0, 2*d_nfilters*d_taps_per_filter*sizeof(float));
+      for(int i = 0; i < d_nfilters; i++) {
+	float *arm = d_packed_taps + 2*i*d_taps_per_filter;
+	if((int)d_taps.size() > i) {
+	  for(int j = 0; j < d_taps_per_filter; j++) {
+	    arm[j] = d_taps[i][d_taps_per_filter-1-j];
+	  }
+	}
+	if((int)d_dtaps.size() > i) {
+	  for(int j = 0; j < d_taps_per_filter; j++) {
+	    arm[d_taps_per_filter+j] = d_dtaps[i][d_taps_per_filter-1-j];
+	  }
+	}
+      }
+    }
+
     void
     pfb_clock_sync_ccf_impl::create_diff_taps(const std::vector<float> &newtaps,
 					      std::vector<float> &difftaps)
@@ -440,7 +471,9 @@ namespace gr {
 	    count -= 1;
 	  }
 
-	  out[i+d_out_idx] = d_filters[d_filtnum]->filter(&in[count+d_out_idx]);
+	  volk_32fc_32f_dot_prod_32fc(&out[i+d_out_idx], &in[count+d_out_idx],
+				      d_packed_taps + 2*d_filtnum*d_taps_per_filter,
+				      d_taps_per_filter);
 	  d_k = d_k + d_rate_i + d_rate_f; // update phase
 	  d_out_idx++;
 
@@ -461,8 +494,13 @@ namespace gr {
 	// the early return would take care of it.
 	d_out_idx = 0;
 
-	// Update the phase and rate estimates for this symbol
-	gr_complex diff = d_diff_filters[d_filtnum]->filter(&in[count]);
+	// Update the phase and rate estimates for this symbol; the
+	// derivative taps sit right behind the matched taps we just
+	// ran, so this second dot product reads warm cache lines
+	gr_complex diff;
+	volk_32fc_32f_dot_prod_32fc(&diff, &in[count],
+				    d_packed_taps + (2*d_filtnum+1)*d_taps_per_filter,
+				    d_taps_per_filter);
 	error_r = out[i].real() * diff.real();
 	error_i = out[i].imag() * diff.imag();
 	d_error = (error_i + error_r) / 2.0;       // average error from I&Q channel
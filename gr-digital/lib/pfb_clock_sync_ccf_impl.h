@@ -47,6 +47,10 @@ namespace gr {
       std::vector<kernel::fir_filter_ccf*> d_diff_filters;
       std::vector< std::vector<float> >    d_taps;
       std::vector< std::vector<float> >    d_dtaps;
+      //! Matched and derivative taps of each arm, reversed and packed
+      //  back to back in one aligned allocation so the filter pair of a
+      //  symbol is evaluated off adjacent cache lines.
+      float                               *d_packed_taps;
 
       float d_k;
       float d_rate;
@@ -61,6 +65,9 @@ namespace gr {
       void create_diff_taps(const std::vector<float> &newtaps,
 			    std::vector<float> &difftaps);
 
+      //! Rebuild d_packed_taps from d_taps and d_dtaps
+      void pack_taps();
+
     public:
       pfb_clock_sync_ccf_impl(double sps, float loop_bw,
 			      const std::vector<float> &taps,
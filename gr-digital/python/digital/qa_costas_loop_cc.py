@@ -149,5 +149,32 @@ class test_costas_loop_cc(gr_unittest.TestCase):
         # not exactly on, the target data
         self.assertComplexTuplesAlmostEqual(expected_result, dst_data, 2)
 
+    def test06(self):
+        # QPSK Convergence test with static rotation, chunked updates
+        natfreq = 0.25
+        order = 4
+        self.test = digital.costas_loop_cc(natfreq, order)
+        self.test.set_chunk_size(4)
+
+        rot = cmath.exp(0.2j) # some small rotation
+        data = [complex(2*random.randint(0,1)-1, 2*random.randint(0,1)-1)
+                for i in xrange(200)]
+
+        N = 100 # settling time; the loop updates once per chunk
+        expected_result = data[N:]
+        data = [rot*d for d in data]
+
+        self.src = blocks.vector_source_c(data, False)
+        self.snk = blocks.vector_sink_c()
+
+        self.tb.connect(self.src, self.test, self.snk)
+        self.tb.run()
+
+        dst_data = self.snk.data()[N:]
+
+        # generously compare results; the loop will converge near to, but
+        # not exactly on, the target data
+        self.assertComplexTuplesAlmostEqual(expected_result, dst_data, 2)
+
 if __name__ == '__main__':
     gr_unittest.run(test_costas_loop_cc, "test_costas_loop_cc.xml")
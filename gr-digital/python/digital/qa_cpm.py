@@ -81,6 +81,22 @@ class test_cpm(gr_unittest.TestCase):
         self.assertFloatTuplesAlmostEqual(tuple(phase_diff), (0.5 * numpy.pi,) * len(phase_diff), 5,
                                           msg="Phase shift was not correct for GMSK")
 
+    def test_fused_equals_hier(self):
+        sps = 4
+        L = 3
+        in_bits = tuple(numpy.random.randint(0, 2) * 2 - 1 for i in range(50))
+        src = blocks.vector_source_b(in_bits, False)
+        hier = digital.cpmmod_bc(analog.cpm.LRC, 0.5, sps, L)
+        fused = digital.cpmmod_fused_bc(analog.cpm.LRC, 0.5, sps, L)
+        sink_hier = blocks.vector_sink_c()
+        sink_fused = blocks.vector_sink_c()
+
+        self.tb.connect(src, hier, sink_hier)
+        self.tb.connect(src, fused, sink_fused)
+        self.tb.run()
+
+        self.assertComplexTuplesAlmostEqual(sink_hier.data(), sink_fused.data(), 4)
+
     def test_phase_response(self):
         phase_response = analog.cpm.phase_response(analog.cpm.LREC, 2, 4)
         self.assertAlmostEqual(numpy.sum(phase_response), 1)
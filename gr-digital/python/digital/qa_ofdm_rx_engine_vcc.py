@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+#
+# Copyright 2013 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+import numpy
+
+from gnuradio import gr, gr_unittest, digital, blocks
+import pmt
+
+class qa_ofdm_rx_engine_vcc (gr_unittest.TestCase):
+
+    def setUp (self):
+        self.tb = gr.top_block ()
+
+    def tearDown (self):
+        self.tb = None
+
+    def test_001_simple (self):
+        """ Flat channel, no carrier offset:
+        - 2 sync symbols, 2 data symbols
+        - The occupied carriers come out the other end, in order
+        - The packet length tag caps the output
+        - Other tags land on the output item of their symbol
+        """
+        fft_len = 8
+        occupied_carriers = ((1, 2, 6, 7),)
+        sync_symbol = (1,) * fft_len
+        data_sym_1 = (0, 1, 2, 0, 0, 0, 3, 4)
+        data_sym_2 = (0, 5, 6, 0, 0, 0, 7, 8)
+        tx_data = sync_symbol * 2 + data_sym_1 + data_sym_2
+        packet_len_tag = gr.tag_t()
+        packet_len_tag.offset = 0
+        packet_len_tag.key = pmt.string_to_symbol("packet_len")
+        packet_len_tag.value = pmt.from_long(7)
+        random_tag = gr.tag_t()
+        random_tag.offset = 3 # Second data symbol
+        random_tag.key = pmt.string_to_symbol("foo")
+        random_tag.value = pmt.from_long(42)
+        src = blocks.vector_source_c(tx_data, False, fft_len, (packet_len_tag, random_tag))
+        equalizer = digital.ofdm_equalizer_static(fft_len)
+        rx_engine = digital.ofdm_rx_engine_vcc(
+                sync_symbol, sync_symbol, 2,
+                equalizer.base(), 0,
+                occupied_carriers,
+                "packet_len",
+                input_is_shifted=False
+        )
+        sink = blocks.vector_sink_c()
+        self.tb.connect(src, rx_engine, sink)
+        self.tb.run ()
+        self.assertComplexTuplesAlmostEqual(sink.data(), (1, 2, 3, 4, 5, 6, 7), places=5)
+        tag_dict = dict()
+        for tag in sink.tags():
+            ptag = gr.tag_to_python(tag)
+            tag_dict[ptag.key] = (ptag.offset, ptag.value)
+        self.assertEqual(tag_dict['packet_len'], (0, 7))
+        self.assertEqual(tag_dict['ofdm_sync_carr_offset'], (0, 0))
+        self.assertEqual(tag_dict['foo'], (4, 42))
+
+    def test_002_attenuated (self):
+        """ Same as before, but attenuate the channel; the engine must
+        estimate the taps off the sync symbols and equalize with them. """
+        fft_len = 8
+        occupied_carriers = ((1, 2, 6, 7),)
+        sync_symbol = (1,) * fft_len
+        data_sym_1 = (0, 1, 2, 0, 0, 0, 3, 4)
+        data_sym_2 = (0, 5, 6, 0, 0, 0, 7, 8)
+        channel = 0.5 + 0.5j
+        tx_data = [channel * x for x in sync_symbol * 2 + data_sym_1 + data_sym_2]
+        src = blocks.vector_source_c(tx_data, False, fft_len)
+        equalizer = digital.ofdm_equalizer_static(fft_len)
+        rx_engine = digital.ofdm_rx_engine_vcc(
+                sync_symbol, sync_symbol, 2,
+                equalizer.base(), 0,
+                occupied_carriers,
+                "packet_len",
+                input_is_shifted=False
+        )
+        sink = blocks.vector_sink_c()
+        self.tb.connect(src, rx_engine, sink)
+        self.tb.run ()
+        self.assertComplexTuplesAlmostEqual(sink.data(), (1, 2, 3, 4, 5, 6, 7, 8), places=5)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_ofdm_rx_engine_vcc, "qa_ofdm_rx_engine_vcc.xml")
@@ -39,6 +39,7 @@
 %{
 #include "gnuradio/digital/additive_scrambler_bb.h"
 #include "gnuradio/digital/binary_slicer_fb.h"
+#include "gnuradio/digital/burst_shaper_cc.h"
 #include "gnuradio/digital/chunks_to_symbols_bc.h"
 #include "gnuradio/digital/chunks_to_symbols_bf.h"
 #include "gnuradio/digital/chunks_to_symbols_ic.h"
@@ -57,6 +58,7 @@
 #include "gnuradio/digital/correlate_and_sync_cc.h"
 #include "gnuradio/digital/costas_loop_cc.h"
 #include "gnuradio/digital/cpmmod_bc.h"
+#include "gnuradio/digital/cpmmod_fused_bc.h"
 #include "gnuradio/digital/crc32.h"
 #include "gnuradio/digital/crc32_bb.h"
 #include "gnuradio/digital/descrambler_bb.h"
@@ -87,6 +89,7 @@
 #include "gnuradio/digital/ofdm_frame_sink.h"
 #include "gnuradio/digital/ofdm_insert_preamble.h"
 #include "gnuradio/digital/ofdm_mapper_bcv.h"
+#include "gnuradio/digital/ofdm_rx_engine_vcc.h"
 #include "gnuradio/digital/ofdm_sampler.h"
 #include "gnuradio/digital/ofdm_serializer_vcc.h"
 #include "gnuradio/digital/ofdm_sync_sc_cfb.h"
@@ -110,6 +113,7 @@
 
 %include "gnuradio/digital/additive_scrambler_bb.h"
 %include "gnuradio/digital/binary_slicer_fb.h"
+%include "gnuradio/digital/burst_shaper_cc.h"
 %include "gnuradio/digital/chunks_to_symbols_bc.h"
 %include "gnuradio/digital/chunks_to_symbols_bf.h"
 %include "gnuradio/digital/chunks_to_symbols_ic.h"
@@ -128,6 +132,7 @@
 %include "gnuradio/digital/correlate_and_sync_cc.h"
 %include "gnuradio/digital/costas_loop_cc.h"
 %include "gnuradio/digital/cpmmod_bc.h"
+%include "gnuradio/digital/cpmmod_fused_bc.h"
 %include "gnuradio/digital/crc32.h"
 %include "gnuradio/digital/crc32_bb.h"
 %include "gnuradio/digital/descrambler_bb.h"
@@ -158,6 +163,7 @@
 %include "gnuradio/digital/ofdm_frame_sink.h"
 %include "gnuradio/digital/ofdm_insert_preamble.h"
 %include "gnuradio/digital/ofdm_mapper_bcv.h"
+%include "gnuradio/digital/ofdm_rx_engine_vcc.h"
 %include "gnuradio/digital/ofdm_sampler.h"
 %include "gnuradio/digital/ofdm_serializer_vcc.h"
 %include "gnuradio/digital/ofdm_sync_sc_cfb.h"
@@ -177,6 +183,7 @@
 
 GR_SWIG_BLOCK_MAGIC2(digital, additive_scrambler_bb);
 GR_SWIG_BLOCK_MAGIC2(digital, binary_slicer_fb);
+GR_SWIG_BLOCK_MAGIC2(digital, burst_shaper_cc);
 GR_SWIG_BLOCK_MAGIC2(digital, chunks_to_symbols_bc);
 GR_SWIG_BLOCK_MAGIC2(digital, chunks_to_symbols_bf);
 GR_SWIG_BLOCK_MAGIC2(digital, chunks_to_symbols_ic);
@@ -195,6 +202,7 @@ GR_SWIG_BLOCK_MAGIC2(digital, correlate_and_sync_cc);
 GR_SWIG_BLOCK_MAGIC2(digital, costas_loop_cc);
 GR_SWIG_BLOCK_MAGIC2(digital, crc32_bb);
 GR_SWIG_BLOCK_MAGIC2(digital, cpmmod_bc);
+GR_SWIG_BLOCK_MAGIC2(digital, cpmmod_fused_bc);
 GR_SWIG_BLOCK_MAGIC2(digital, descrambler_bb);
 GR_SWIG_BLOCK_MAGIC2(digital, diff_decoder_bb);
 GR_SWIG_BLOCK_MAGIC2(digital, diff_encoder_bb);
@@ -217,6 +225,7 @@ GR_SWIG_BLOCK_MAGIC2(digital, ofdm_frame_equalizer_vcvc);
 GR_SWIG_BLOCK_MAGIC2(digital, ofdm_frame_sink);
 GR_SWIG_BLOCK_MAGIC2(digital, ofdm_insert_preamble);
 GR_SWIG_BLOCK_MAGIC2(digital, ofdm_mapper_bcv);
+GR_SWIG_BLOCK_MAGIC2(digital, ofdm_rx_engine_vcc);
 GR_SWIG_BLOCK_MAGIC2(digital, ofdm_sampler);
 GR_SWIG_BLOCK_MAGIC2(digital, ofdm_serializer_vcc);
 GR_SWIG_BLOCK_MAGIC2(digital, ofdm_sync_sc_cfb);
@@ -233,6 +242,7 @@ GR_SWIG_BLOCK_MAGIC2(digital, simple_correlator);
 GR_SWIG_BLOCK_MAGIC2(digital, simple_framer);
 
 GR_SWIG_BLOCK_MAGIC_FACTORY(digital, cpmmod_bc, gmskmod_bc);
+GR_SWIG_BLOCK_MAGIC_FACTORY(digital, cpmmod_fused_bc, gmskmod_fused_bc);
 
 // Properly package up non-block objects
 %include "constellation.i"
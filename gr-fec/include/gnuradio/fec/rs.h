@@ -11,6 +11,18 @@ FEC_API void *init_rs_char(unsigned int symsize,unsigned int gfpoly,
                            unsigned int fcr,unsigned int prim,unsigned int nroots);
 FEC_API void free_rs_char(void *rs);
 
+/* Batched entry points for the 8-bit codec.  The decoder screens the
+ * whole batch with vectorized syndrome computation (SSSE3 when
+ * available) and runs the full error-correction path only on words
+ * whose syndromes are nonzero; returns total corrected symbols, or
+ * -1 if any word was uncorrectable, with per-word counts in nerrs
+ * when non-NULL.
+ */
+FEC_API void encode_rs_char_batch(void *rs, unsigned char **data,
+                                  unsigned char **parity, int nwords);
+FEC_API int decode_rs_char_batch(void *rs, unsigned char **data,
+                                 int *nerrs, int nwords);
+
 /* General purpose RS codec, integer symbols */
 FEC_API void encode_rs_int(void *rs,int *data,int *parity);
 FEC_API int decode_rs_int(void *rs,int *data,int *eras_pos,int no_eras);
@@ -51,3 +51,34 @@ viterbi_butterfly2(unsigned char *symbols, int mettab[2][256],
 
 FEC_API unsigned char
 viterbi_get_output(struct viterbi_state *state, unsigned char *outbuf);
+
+/* SIMD (SSE2) decoder for the same K=7 rate=1/2 code.  Path metrics
+ * for all 64 states are kept as unsigned bytes in four vector
+ * registers and updated with a 16-wide add-compare-select per step;
+ * one packed 64-bit decision word per bit is kept in a circular
+ * history so the output byte is recovered by chainback with the same
+ * 24-bit latency as viterbi_get_output().
+ */
+
+#define VITERBI_SIMD_HISTORY 64	/* decision history depth in bits, power of 2 */
+
+struct viterbi_simd_state {
+  unsigned char metrics[64];	/* 8-bit path metric per state (lower = better) */
+  unsigned long long decisions[VITERBI_SIMD_HISTORY]; /* four packed 16-lane masks per bit */
+  unsigned int nbits;		/* total bits processed */
+};
+
+/* Nonzero when this build has the SSE2 implementation */
+FEC_API int
+viterbi_simd_available(void);
+
+FEC_API void
+viterbi_simd_init(struct viterbi_simd_state *state);
+
+/* Run nbits add-compare-select steps over 2*nbits input symbols */
+FEC_API void
+viterbi_simd_update(struct viterbi_simd_state *state,
+		    const unsigned char *symbols, int nbits);
+
+FEC_API unsigned char
+viterbi_simd_get_output(struct viterbi_simd_state *state);
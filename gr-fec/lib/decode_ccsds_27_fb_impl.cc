@@ -48,6 +48,10 @@ namespace gr {
       gen_met(d_mettab, 100, esn0, 0.0, 256);
       viterbi_chunks_init(d_state0);
       viterbi_chunks_init(d_state1);
+
+      d_use_simd = (viterbi_simd_available() != 0);
+      if (d_use_simd)
+	viterbi_simd_init(&d_simd_state);
     }
 
     int
@@ -70,13 +74,22 @@ namespace gr {
 	d_viterbi_in[d_count % 4] = sym;
 	if ((d_count % 4) == 3) {
 	  // Every fourth symbol, perform butterfly operation
-	  viterbi_butterfly2(d_viterbi_in, d_mettab, d_state0, d_state1);
-	  
-	  // Every sixteenth symbol, read out a byte
-	  if (d_count % 16 == 11) {
-	    // long metric =
-	    viterbi_get_output(d_state0, out++);
-	    // printf("%li\n", *(out-1), metric);
+	  if (d_use_simd) {
+	    viterbi_simd_update(&d_simd_state, d_viterbi_in, 2);
+
+	    // Every sixteenth symbol, read out a byte
+	    if (d_count % 16 == 11)
+	      *out++ = viterbi_simd_get_output(&d_simd_state);
+	  }
+	  else {
+	    viterbi_butterfly2(d_viterbi_in, d_mettab, d_state0, d_state1);
+
+	    // Every sixteenth symbol, read out a byte
+	    if (d_count % 16 == 11) {
+	      // long metric =
+	      viterbi_get_output(d_state0, out++);
+	      // printf("%li\n", *(out-1), metric);
+	    }
 	  }
 	}
 	
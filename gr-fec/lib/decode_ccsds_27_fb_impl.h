@@ -40,7 +40,11 @@ namespace gr {
       struct viterbi_state d_state0[64];
       struct viterbi_state d_state1[64];
       unsigned char d_viterbi_in[16];
-      
+
+      // SSE2 16-wide ACS path, used when the build supports it
+      struct viterbi_simd_state d_simd_state;
+      bool d_use_simd;
+
       int d_count;
 
     public:
@@ -0,0 +1,177 @@
+/* Batched Reed-Solomon codec entry points, 8-bit symbols
+ *
+ * Copyright 2014 Free Software Foundation, Inc.
+ * May be used under the terms of the GNU General Public License (GPL)
+ *
+ * Decoding a stream of codewords one at a time leaves the decoder
+ * bound on the serial log/antilog table lookups of the syndrome
+ * computation, even though after a Viterbi inner code almost every
+ * codeword arrives clean.  decode_rs_char_batch() therefore screens
+ * a whole batch first: syndromes are computed for 16 codewords at a
+ * time with pshufb nibble-table GF multiplies (when SSSE3 is
+ * available), words whose syndromes are all zero are done, and only
+ * the rare dirty word takes the full scalar Berlekamp-Massey/Chien/
+ * Forney path in decode_rs_char().
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "char.h"
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#define BATCH 16
+
+/* GF multiply through the codec's log/antilog tables */
+static DTYPE gfmul(struct rs *rs, DTYPE a, DTYPE b){
+  if(a == 0 || b == 0)
+    return 0;
+  return ALPHA_TO[MODNN(INDEX_OF[a] + INDEX_OF[b])];
+}
+
+/* Scalar syndrome computation, one codeword; the same recurrence as
+ * the top of DECODE_RS.  Returns nonzero if any syndrome is nonzero.
+ */
+static int syndromes(struct rs *rs, const DTYPE *data){
+  DTYPE s;
+  unsigned int i, j;
+  int nonzero = 0;
+
+  for(i = 0; i < NROOTS; i++){
+    s = data[0];
+    for(j = 1; j < NN; j++){
+      if(s == 0)
+	s = data[j];
+      else
+	s = data[j] ^ ALPHA_TO[MODNN(INDEX_OF[s] + (FCR+i)*PRIM)];
+    }
+    nonzero |= s;
+  }
+  return nonzero;
+}
+
+#if defined(__SSSE3__)
+/* Per-root multiply-by-constant nibble tables: the Horner recurrence
+ * multiplies every syndrome accumulator by the fixed root
+ * alpha^((FCR+i)*PRIM), and multiplication by a constant is linear
+ * over GF(2), so c*b = c*(b & 0xf) ^ c*(b & 0xf0) splits into two
+ * 16-entry tables pshufb can apply to 16 accumulators at once.
+ */
+static void build_mul_tables(struct rs *rs, unsigned char *mtab){
+  unsigned int i, n;
+  DTYPE r;
+
+  for(i = 0; i < NROOTS; i++){
+    r = ALPHA_TO[MODNN((FCR+i)*PRIM)];
+    for(n = 0; n < 16; n++){
+      mtab[i*32 + n] = gfmul(rs, r, (DTYPE)n);
+      mtab[i*32 + 16 + n] = gfmul(rs, r, (DTYPE)(n << 4));
+    }
+  }
+}
+
+/* Syndromes for 16 codewords at once.  The batch is transposed so
+ * symbol position j of all 16 words sits in one 16-byte lane; each
+ * root then runs the Horner recurrence with two pshufb lookups and
+ * two xors per position, with no serial table-latency chain.
+ */
+static void syndromes_x16(struct rs *rs, unsigned char **data,
+			  const unsigned char *mtab, unsigned char *tr,
+			  unsigned char *syn){
+  const __m128i lomask = _mm_set1_epi8(0x0f);
+  unsigned int i, j, w;
+
+  for(j = 0; j < NN; j++)
+    for(w = 0; w < BATCH; w++)
+      tr[j*BATCH + w] = data[w][j];
+
+  for(i = 0; i < NROOTS; i++){
+    __m128i lo = _mm_loadu_si128((const __m128i *)(mtab + i*32));
+    __m128i hi = _mm_loadu_si128((const __m128i *)(mtab + i*32 + 16));
+    __m128i s = _mm_loadu_si128((const __m128i *)tr); /* j = 0 */
+
+    for(j = 1; j < NN; j++){
+      __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(s, lomask));
+      __m128i h = _mm_shuffle_epi8(hi,
+		    _mm_and_si128(_mm_srli_epi64(s, 4), lomask));
+      s = _mm_xor_si128(_mm_xor_si128(l, h),
+			_mm_loadu_si128((const __m128i *)(tr + j*BATCH)));
+    }
+    _mm_storeu_si128((__m128i *)(syn + i*BATCH), s);
+  }
+}
+#endif
+
+/* The encoder's LFSR feedback serializes on the data, and encoding is
+ * already cheap next to decoding, so the batch encoder just amortizes
+ * the call overhead.
+ */
+void encode_rs_char_batch(void *p, unsigned char **data,
+			  unsigned char **parity, int nwords){
+  int w;
+
+  for(w = 0; w < nwords; w++)
+    encode_rs_char(p, data[w], parity[w]);
+}
+
+/* Decode nwords codewords of NN symbols each.  Returns the total
+ * number of corrected symbol errors, or -1 if any codeword was
+ * uncorrectable; per-word error counts land in nerrs when non-NULL.
+ */
+int decode_rs_char_batch(void *p, unsigned char **data,
+			 int *nerrs, int nwords){
+  struct rs *rs = (struct rs *)p;
+  int w = 0;
+  int total = 0;
+  int failed = 0;
+  int count;
+
+#if defined(__SSSE3__)
+  if(nwords >= BATCH){
+    unsigned char *mtab = (unsigned char *)malloc(NROOTS*32);
+    unsigned char *tr = (unsigned char *)malloc(NN*BATCH);
+    unsigned char *syn = (unsigned char *)malloc(NROOTS*BATCH);
+
+    if(mtab != NULL && tr != NULL && syn != NULL){
+      build_mul_tables(rs, mtab);
+
+      for(; w + BATCH <= nwords; w += BATCH){
+	unsigned int i, l;
+
+	syndromes_x16(rs, &data[w], mtab, tr, syn);
+
+	for(l = 0; l < BATCH; l++){
+	  int dirty = 0;
+	  for(i = 0; i < NROOTS; i++)
+	    dirty |= syn[i*BATCH + l];
+
+	  count = dirty ? decode_rs_char(p, data[w + l], NULL, 0) : 0;
+	  if(nerrs != NULL)
+	    nerrs[w + l] = count;
+	  if(count < 0)
+	    failed = 1;
+	  else
+	    total += count;
+	}
+      }
+    }
+    free(syn);
+    free(tr);
+    free(mtab);
+  }
+#endif
+
+  for(; w < nwords; w++){
+    count = syndromes(rs, data[w]) ? decode_rs_char(p, data[w], NULL, 0) : 0;
+    if(nerrs != NULL)
+      nerrs[w] = count;
+    if(count < 0)
+      failed = 1;
+    else
+      total += count;
+  }
+
+  return failed ? -1 : total;
+}
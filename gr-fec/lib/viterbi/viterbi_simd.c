@@ -0,0 +1,220 @@
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * SSE2 Viterbi decoder for the K=7 rate=1/2 code in viterbi.c.
+ *
+ * The 64 path metrics live in four 16-byte vectors, so each trellis
+ * step is four 16-wide add-compare-select operations instead of 32
+ * scalar butterflies.  Metrics are unsigned distances (lower is
+ * better) rather than the log-likelihoods of gen_met(): branch
+ * metrics are quantized to 4 bits, which bounds metric growth to 15
+ * per bit and the metric spread to 6*15, so an unconditional
+ * subtract-the-minimum renormalization every 8 bits keeps everything
+ * inside 8 bits without any data-dependent branch.
+ */
+
+#include <gnuradio/fec/viterbi.h>
+
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+
+#include <emmintrin.h>
+#include <string.h>
+
+/* Expected symbol pair (2*symA + symB) for the 0-branch out of each
+ * even/odd state pair; same table as the BUTTERFLY call list in
+ * viterbi.c.  The 1-branch (predecessor +32) expects the complement.
+ */
+static const unsigned char symtab[32] = {
+  0,1,3,2,3,2,0,1,0,1,3,2,3,2,0,1,
+  2,3,1,0,1,0,2,3,2,3,1,0,1,0,2,3
+};
+
+int
+viterbi_simd_available(void)
+{
+  return 1;
+}
+
+void
+viterbi_simd_init(struct viterbi_simd_state *state)
+{
+  int i;
+
+  /* Initialize starting metrics to prefer 0 state */
+  state->metrics[0] = 0;
+  for(i = 1; i < 64; i++)
+    state->metrics[i] = 63;
+  memset(state->decisions, 0, sizeof(state->decisions));
+  state->nbits = 0;
+}
+
+void
+viterbi_simd_update(struct viterbi_simd_state *state,
+		    const unsigned char *symbols, int nbits)
+{
+  __m128i m[4], n[4];
+  __m128i b0[2], b1[2];
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i lownibble = _mm_set1_epi8(0x0f);
+  unsigned char branch0[32], branch1[32];
+  int i, bit;
+
+  /* Expected soft symbols (0 or 255) per predecessor pair */
+  for(i = 0; i < 32; i++) {
+    branch0[i] = (symtab[i] & 2) ? 255 : 0;
+    branch1[i] = (symtab[i] & 1) ? 255 : 0;
+  }
+  for(i = 0; i < 2; i++) {
+    b0[i] = _mm_loadu_si128((const __m128i *)(branch0 + 16*i));
+    b1[i] = _mm_loadu_si128((const __m128i *)(branch1 + 16*i));
+  }
+
+  for(i = 0; i < 4; i++)
+    m[i] = _mm_loadu_si128((const __m128i *)(state->metrics + 16*i));
+
+  for(bit = 0; bit < nbits; bit++) {
+    __m128i sym0v = _mm_set1_epi8((char)symbols[0]);
+    __m128i sym1v = _mm_set1_epi8((char)symbols[1]);
+    unsigned long long decision = 0;
+    symbols += 2;
+
+    for(i = 0; i < 2; i++) {
+      __m128i bm, bmi, m0, m1, m2, m3, d0, d1, s0, s1;
+
+      /* 4-bit branch metric: distance to the expected symbol pair */
+      bm = _mm_avg_epu8(_mm_xor_si128(b0[i], sym0v),
+			_mm_xor_si128(b1[i], sym1v));
+      bm = _mm_and_si128(_mm_srli_epi16(bm, 4), lownibble);
+      bmi = _mm_xor_si128(bm, lownibble);
+
+      /* ACS for the even and odd successors of predecessors
+       * 16*i..16*i+15 (paired with +32); decision bit 1 means the
+       * +32 predecessor survived, matching BUTTERFLY's tie-break.
+       */
+      m0 = _mm_adds_epu8(m[i], bm);
+      m1 = _mm_adds_epu8(m[i + 2], bmi);
+      m2 = _mm_adds_epu8(m[i], bmi);
+      m3 = _mm_adds_epu8(m[i + 2], bm);
+      d0 = _mm_cmpeq_epi8(_mm_subs_epu8(m1, m0), zero);
+      d1 = _mm_cmpeq_epi8(_mm_subs_epu8(m3, m2), zero);
+      s0 = _mm_min_epu8(m0, m1);
+      s1 = _mm_min_epu8(m2, m3);
+
+      /* Interleave even/odd survivors back into state order */
+      n[2*i] = _mm_unpacklo_epi8(s0, s1);
+      n[2*i + 1] = _mm_unpackhi_epi8(s0, s1);
+
+      decision |= ((unsigned long long)(unsigned)_mm_movemask_epi8(d0)) << (i ? 32 : 0);
+      decision |= ((unsigned long long)(unsigned)_mm_movemask_epi8(d1)) << (i ? 48 : 16);
+    }
+
+    state->decisions[state->nbits & (VITERBI_SIMD_HISTORY - 1)] = decision;
+    state->nbits++;
+    for(i = 0; i < 4; i++)
+      m[i] = n[i];
+
+    /* Unconditional renormalization on a fixed schedule; no
+     * data-dependent branch.
+     */
+    if((state->nbits & 7) == 0) {
+      __m128i t = _mm_min_epu8(_mm_min_epu8(m[0], m[1]),
+			       _mm_min_epu8(m[2], m[3]));
+      t = _mm_min_epu8(t, _mm_srli_si128(t, 8));
+      t = _mm_min_epu8(t, _mm_srli_si128(t, 4));
+      t = _mm_min_epu8(t, _mm_srli_si128(t, 2));
+      t = _mm_min_epu8(t, _mm_srli_si128(t, 1));
+      t = _mm_set1_epi8((char)(_mm_cvtsi128_si32(t) & 0xff));
+      for(i = 0; i < 4; i++)
+	m[i] = _mm_subs_epu8(m[i], t);
+    }
+  }
+
+  for(i = 0; i < 4; i++)
+    _mm_storeu_si128((__m128i *)(state->metrics + 16*i), m[i]);
+}
+
+unsigned char
+viterbi_simd_get_output(struct viterbi_simd_state *state)
+{
+  unsigned int i, beststate, st, t;
+  int bestmetric, k;
+  unsigned char out = 0;
+
+  /* Find current best path */
+  bestmetric = state->metrics[0];
+  beststate = 0;
+  for(i = 1; i < 64; i++)
+    if(state->metrics[i] < bestmetric) {
+      bestmetric = state->metrics[i];
+      beststate = i;
+    }
+
+  /* Chain back 32 bits; bits 25..32 deep are the output byte, the
+   * same latency as the 32-bit path register in viterbi_get_output().
+   * Decisions from before the first bit read as zero.
+   */
+  t = state->nbits;
+  st = beststate;
+  for(k = 1; k <= 32; k++) {
+    unsigned long long w =
+      (t >= (unsigned int)k) ? state->decisions[(t - k) & (VITERBI_SIMD_HISTORY - 1)] : 0;
+    unsigned int b =
+      (unsigned int)(w >> (((st & 1) ? 16 : 0) + ((st >> 5) ? 32 : 0) + ((st >> 1) & 15))) & 1;
+    if(k >= 25)
+      out |= (unsigned char)(b << (k - 25));
+    st = (st >> 1) | (b << 5);
+  }
+  return out;
+}
+
+#else  /* no SSE2: stubs so the scalar decoder is used instead */
+
+int
+viterbi_simd_available(void)
+{
+  return 0;
+}
+
+void
+viterbi_simd_init(struct viterbi_simd_state *state)
+{
+  (void)state;
+}
+
+void
+viterbi_simd_update(struct viterbi_simd_state *state,
+		    const unsigned char *symbols, int nbits)
+{
+  (void)state;
+  (void)symbols;
+  (void)nbits;
+}
+
+unsigned char
+viterbi_simd_get_output(struct viterbi_simd_state *state)
+{
+  (void)state;
+  return 0;
+}
+
+#endif
@@ -62,6 +62,22 @@ namespace gr {
        * Return reference to planner mutex
        */
       static boost::mutex &mutex();
+
+      /*!
+       * Select the planner effort for plans created from here on.
+       * The default (false) plans with FFTW_MEASURE, which gives the
+       * fastest transforms but can take seconds the first time a new
+       * size is planned.  Estimate mode plans with FFTW_ESTIMATE
+       * instead: transforms run somewhat slower, but plan creation is
+       * near instant, which keeps flowgraph startup short on hosts
+       * that have not yet accumulated a wisdom file.
+       */
+      static void set_estimate_mode(bool estimate);
+
+      /*!
+       * True when new plans are created with FFTW_ESTIMATE.
+       */
+      static bool estimate_mode();
     };
 
     /*!
@@ -71,40 +87,66 @@ namespace gr {
     class FFT_API fft_complex {
       int	      d_fft_size;
       int         d_nthreads;
+      bool        d_forward;
+      int         d_batch_size;
       gr_complex *d_inbuf;
       gr_complex *d_outbuf;
       void	     *d_plan;
+      void	     *d_batch_plan;
 
     public:
       fft_complex(int fft_size, bool forward = true, int nthreads=1);
       virtual ~fft_complex();
-      
+
       /*
        * These return pointers to buffers owned by fft_impl_fft_complex
        * into which input and output take place. It's done this way in
        * order to ensure optimal alignment for SIMD instructions.
+       * With a batch size > 1 the buffers hold batch_size() vectors
+       * of inbuf_length() items laid end to end.
        */
       gr_complex *get_inbuf()  const { return d_inbuf; }
       gr_complex *get_outbuf() const { return d_outbuf; }
-      
+
       int inbuf_length()  const { return d_fft_size; }
       int outbuf_length() const { return d_fft_size; }
-      
+
       /*!
        *  Set the number of threads to use for caclulation.
        */
       void set_nthreads(int n);
-      
+
       /*!
        *  Get the number of threads being used by FFTW
        */
       int nthreads() const { return d_nthreads; }
-      
+
+      /*!
+       * Reserve room for \p nbatch vectors and plan a multi-FFT over
+       * all of them, so execute_batch() transforms the whole batch
+       * with a single FFTW call.  Reallocates the I/O buffers and
+       * replans with FFTW_MEASURE (cached in the wisdom file like the
+       * single-vector plan), so call this once at setup time, never
+       * from work().
+       */
+      void set_batch_size(int nbatch);
+
+      /*!
+       *  Number of vectors transformed per execute_batch() call
+       */
+      int batch_size() const { return d_batch_size; }
+
       /*!
        * compute FFT. The input comes from inbuf, the output is placed in
        * outbuf.
        */
       void execute();
+
+      /*!
+       * Transform batch_size() vectors laid end to end in inbuf into
+       * outbuf with one FFTW call.
+       */
+      void execute_batch();
     };
 
     /*!
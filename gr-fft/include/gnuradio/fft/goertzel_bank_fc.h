@@ -0,0 +1,75 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FFT_GOERTZEL_BANK_FC_H
+#define INCLUDED_FFT_GOERTZEL_BANK_FC_H
+
+#include <gnuradio/fft/api.h>
+#include <gnuradio/sync_decimator.h>
+#include <vector>
+
+namespace gr {
+  namespace fft {
+
+    /*!
+     * \brief Goertzel DFT calculation for a bank of tones.
+     * \ingroup fourier_analysis_blk
+     *
+     * \details
+     * Evaluates the Goertzel algorithm for every configured tone in
+     * a single pass over each input block.  The per-tone recurrence
+     * state is kept in structure-of-arrays form so the inner loop
+     * runs across the tones for each sample and vectorizes; one
+     * instance of this block replaces one goertzel_fc per tone.
+     *
+     * Output is one vector of ntones() complex bin values per \p len
+     * input samples.
+     */
+    class FFT_API goertzel_bank_fc : virtual public sync_decimator
+    {
+    public:
+      // gr::fft::goertzel_bank_fc::sptr
+      typedef boost::shared_ptr<goertzel_bank_fc> sptr;
+
+      /*!
+       * \param rate sample rate of the input stream
+       * \param len number of samples evaluated per output vector
+       * \param freqs center frequencies of the tones to detect
+       */
+      static sptr make(int rate, int len, const std::vector<float> &freqs);
+
+      virtual void set_freqs(const std::vector<float> &freqs) = 0;
+
+      virtual void set_rate(int rate) = 0;
+
+      virtual std::vector<float> freqs() const = 0;
+
+      virtual int rate() const = 0;
+
+      //! Number of tones, which is also the output vector length.
+      virtual unsigned int ntones() const = 0;
+    };
+
+  } /* namespace fft */
+} /* namespace gr */
+
+#endif /* INCLUDED_FFT_GOERTZEL_BANK_FC_H */
@@ -0,0 +1,83 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FFT_PSD_WELCH_VCF_H
+#define INCLUDED_FFT_PSD_WELCH_VCF_H
+
+#include <gnuradio/fft/api.h>
+#include <gnuradio/fft/window.h>
+#include <gnuradio/sync_decimator.h>
+
+namespace gr {
+  namespace fft {
+
+    /*!
+     * \brief Welch power spectral density estimate of a complex stream.
+     * \ingroup fourier_analysis_blk
+     *
+     * \details
+     * Produces one PSD vector of \p fft_size bins per \p fft_size -
+     * \p overlap new input samples.  Each segment is windowed,
+     * transformed, converted to magnitude squared and folded into a
+     * single-pole average in one pass; the whole block replaces the
+     * stream_to_vector / window multiply / FFT / mag^2 / filter
+     * chains built by hand in sensing flowgraphs.
+     *
+     * The PSD is normalized by the window power, so a rectangular
+     * window gives the standard |X|^2 / N periodogram.  With \p
+     * shift set, the output vector is fft-shifted (DC in the
+     * middle).
+     */
+    class FFT_API psd_welch_vcf : virtual public sync_decimator
+    {
+    public:
+      // gr::fft::psd_welch_vcf::sptr
+      typedef boost::shared_ptr<psd_welch_vcf> sptr;
+
+      /*!
+       * \param fft_size segment length and output vector length
+       * \param overlap samples shared between consecutive segments;
+       *                must be in [0, fft_size)
+       * \param alpha averaging coefficient of the single-pole
+       *              averager in (0, 1]; 1 disables averaging
+       * \param wintype window to apply to each segment, as a
+       *                gr::fft::window::win_type
+       * \param beta shaping parameter, used only for Kaiser windows
+       * \param shift true moves DC to the middle of the output vector
+       */
+      static sptr make(int fft_size, int overlap, double alpha,
+                       int wintype = window::WIN_HAMMING,
+                       double beta = 6.76, bool shift = false);
+
+      virtual void set_alpha(double alpha) = 0;
+
+      virtual double alpha() const = 0;
+
+      virtual int fft_size() const = 0;
+
+      virtual int overlap() const = 0;
+    };
+
+  } /* namespace fft */
+} /* namespace gr */
+
+#endif /* INCLUDED_FFT_PSD_WELCH_VCF_H */
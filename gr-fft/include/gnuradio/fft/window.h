@@ -289,6 +289,30 @@ namespace gr {
        * \param beta Used only for building Kaiser windows.
        */
       static std::vector<float> build(win_type type, int ntaps, double beta);
+
+      /*!
+       * \brief Like build(), but served from a process-wide cache
+       * keyed by (type, ntaps, beta).
+       *
+       * Reconfiguring displays and filters rebuild the same windows
+       * over and over; the cache makes every build after the first a
+       * lookup instead of a round of cosine evaluations.  The
+       * returned reference stays valid for the life of the process.
+       */
+      static const std::vector<float>& build_cached(win_type type, int ntaps,
+                                                    double beta);
+
+      /*!
+       * \brief Multiply \p in by \p win into \p out with a single
+       * volk pass.  \p in and \p out may be the same buffer; \p win
+       * must hold at least \p nitems entries.
+       */
+      static void apply(const std::vector<float> &win,
+                        const gr_complex *in, gr_complex *out, int nitems);
+
+      //! Float version of apply().
+      static void apply(const std::vector<float> &win,
+                        const float *in, float *out, int nitems);
     };
 
   } /* namespace fft */
@@ -82,6 +82,21 @@ namespace gr {
       return s_planning_mutex;
     }
 
+    static bool s_planner_estimate = false;
+
+    void
+    planner::set_estimate_mode(bool estimate)
+    {
+      scoped_lock lock(mutex());
+      s_planner_estimate = estimate;
+    }
+
+    bool
+    planner::estimate_mode()
+    {
+      return s_planner_estimate;
+    }
+
     static const char *
     wisdom_filename()
     {
@@ -93,6 +108,14 @@ namespace gr {
     static void
     import_wisdom()
     {
+      // Wisdom accumulates in the process once read, so a single
+      // import per process is enough; later plan constructions come
+      // straight out of the in-memory store without touching disk.
+      static bool imported = false;
+      if (imported)
+	return;
+      imported = true;
+
       const char *filename = wisdom_filename ();
       FILE *fp = fopen (filename, "r");
       if (fp != 0){
@@ -135,6 +158,106 @@ namespace gr {
       }
     }
 
+    /*
+     * The plan_* helpers below first ask the planner for a plan that
+     * can be built purely from the wisdom already in memory.  A size
+     * we have planned before -- in this run or in a previous one via
+     * the wisdom file -- comes back immediately, so only a genuinely
+     * new transform pays for a full FFTW_MEASURE pass.  *new_wisdom
+     * tells the caller whether that happened, i.e. whether there is
+     * anything worth exporting afterwards.
+     */
+    static fftwf_plan
+    plan_dft_1d (int fft_size, gr_complex *inbuf, gr_complex *outbuf,
+		 int sign, bool *new_wisdom)
+    {
+      fftwf_complex *in = reinterpret_cast<fftwf_complex *>(inbuf);
+      fftwf_complex *out = reinterpret_cast<fftwf_complex *>(outbuf);
+
+      *new_wisdom = false;
+      if (s_planner_estimate)
+	return fftwf_plan_dft_1d (fft_size, in, out, sign, FFTW_ESTIMATE);
+
+#ifdef FFTW_WISDOM_ONLY
+      fftwf_plan p = fftwf_plan_dft_1d (fft_size, in, out, sign,
+					FFTW_MEASURE | FFTW_WISDOM_ONLY);
+      if (p != NULL)
+	return p;
+#endif
+      *new_wisdom = true;
+      return fftwf_plan_dft_1d (fft_size, in, out, sign, FFTW_MEASURE);
+    }
+
+    static fftwf_plan
+    plan_many_dft (int fft_size, int nbatch,
+		   gr_complex *inbuf, gr_complex *outbuf,
+		   int sign, bool *new_wisdom)
+    {
+      fftwf_complex *in = reinterpret_cast<fftwf_complex *>(inbuf);
+      fftwf_complex *out = reinterpret_cast<fftwf_complex *>(outbuf);
+
+      *new_wisdom = false;
+      if (s_planner_estimate)
+	return fftwf_plan_many_dft (1, &fft_size, nbatch,
+				    in, NULL, 1, fft_size,
+				    out, NULL, 1, fft_size,
+				    sign, FFTW_ESTIMATE);
+
+#ifdef FFTW_WISDOM_ONLY
+      fftwf_plan p = fftwf_plan_many_dft (1, &fft_size, nbatch,
+					  in, NULL, 1, fft_size,
+					  out, NULL, 1, fft_size,
+					  sign, FFTW_MEASURE | FFTW_WISDOM_ONLY);
+      if (p != NULL)
+	return p;
+#endif
+      *new_wisdom = true;
+      return fftwf_plan_many_dft (1, &fft_size, nbatch,
+				  in, NULL, 1, fft_size,
+				  out, NULL, 1, fft_size,
+				  sign, FFTW_MEASURE);
+    }
+
+    static fftwf_plan
+    plan_dft_r2c_1d (int fft_size, float *inbuf, gr_complex *outbuf,
+		     bool *new_wisdom)
+    {
+      fftwf_complex *out = reinterpret_cast<fftwf_complex *>(outbuf);
+
+      *new_wisdom = false;
+      if (s_planner_estimate)
+	return fftwf_plan_dft_r2c_1d (fft_size, inbuf, out, FFTW_ESTIMATE);
+
+#ifdef FFTW_WISDOM_ONLY
+      fftwf_plan p = fftwf_plan_dft_r2c_1d (fft_size, inbuf, out,
+					    FFTW_MEASURE | FFTW_WISDOM_ONLY);
+      if (p != NULL)
+	return p;
+#endif
+      *new_wisdom = true;
+      return fftwf_plan_dft_r2c_1d (fft_size, inbuf, out, FFTW_MEASURE);
+    }
+
+    static fftwf_plan
+    plan_dft_c2r_1d (int fft_size, gr_complex *inbuf, float *outbuf,
+		     bool *new_wisdom)
+    {
+      fftwf_complex *in = reinterpret_cast<fftwf_complex *>(inbuf);
+
+      *new_wisdom = false;
+      if (s_planner_estimate)
+	return fftwf_plan_dft_c2r_1d (fft_size, in, outbuf, FFTW_ESTIMATE);
+
+#ifdef FFTW_WISDOM_ONLY
+      fftwf_plan p = fftwf_plan_dft_c2r_1d (fft_size, in, outbuf,
+					    FFTW_MEASURE | FFTW_WISDOM_ONLY);
+      if (p != NULL)
+	return p;
+#endif
+      *new_wisdom = true;
+      return fftwf_plan_dft_c2r_1d (fft_size, in, outbuf, FFTW_MEASURE);
+    }
+
 // ----------------------------------------------------------------
 
     fft_complex::fft_complex(int fft_size, bool forward, int nthreads)
@@ -148,31 +271,34 @@ namespace gr {
 	throw std::out_of_range ("fft_impl_fftw: invalid fft_size");
 
       d_fft_size = fft_size;
+      d_forward = forward;
+      d_batch_size = 1;
+      d_batch_plan = 0;
       d_inbuf = (gr_complex *) fftwf_malloc (sizeof (gr_complex) * inbuf_length ());
       if (d_inbuf == 0)
 	throw std::runtime_error ("fftwf_malloc");
-      
+
       d_outbuf = (gr_complex *) fftwf_malloc (sizeof (gr_complex) * outbuf_length ());
       if (d_outbuf == 0){
 	fftwf_free (d_inbuf);
 	throw std::runtime_error ("fftwf_malloc");
       }
-      
+
       d_nthreads = nthreads;
       config_threading(nthreads);
-      import_wisdom();	// load prior wisdom from disk
-      
-      d_plan = fftwf_plan_dft_1d (fft_size,
-				  reinterpret_cast<fftwf_complex *>(d_inbuf),
-				  reinterpret_cast<fftwf_complex *>(d_outbuf),
-				  forward ? FFTW_FORWARD : FFTW_BACKWARD,
-				  FFTW_MEASURE);
+      import_wisdom();	// load prior wisdom from disk (once per process)
+
+      bool new_wisdom;
+      d_plan = plan_dft_1d (fft_size, d_inbuf, d_outbuf,
+			    forward ? FFTW_FORWARD : FFTW_BACKWARD,
+			    &new_wisdom);
 
       if (d_plan == NULL) {
 	fprintf(stderr, "gr::fft: error creating plan\n");
 	throw std::runtime_error ("fftwf_plan_dft_1d failed");
       }
-      export_wisdom();	// store new wisdom to disk
+      if (new_wisdom)
+	export_wisdom();	// store new wisdom to disk
     }
 
     fft_complex::~fft_complex()
@@ -181,10 +307,70 @@ namespace gr {
       planner::scoped_lock lock(planner::mutex());
 
       fftwf_destroy_plan ((fftwf_plan) d_plan);
+      if (d_batch_plan)
+	fftwf_destroy_plan ((fftwf_plan) d_batch_plan);
       fftwf_free (d_inbuf);
       fftwf_free (d_outbuf);
     }
 
+    void
+    fft_complex::set_batch_size(int nbatch)
+    {
+      // Hold global mutex during plan construction and destruction.
+      planner::scoped_lock lock(planner::mutex());
+
+      if (nbatch <= 0)
+	throw std::out_of_range ("fft_impl_fftw: invalid batch size");
+      if (nbatch == d_batch_size)
+	return;
+
+      fftwf_destroy_plan ((fftwf_plan) d_plan);
+      if (d_batch_plan) {
+	fftwf_destroy_plan ((fftwf_plan) d_batch_plan);
+	d_batch_plan = 0;
+      }
+      fftwf_free (d_inbuf);
+      fftwf_free (d_outbuf);
+
+      d_batch_size = nbatch;
+      d_inbuf = (gr_complex *) fftwf_malloc (sizeof (gr_complex) * inbuf_length () * nbatch);
+      if (d_inbuf == 0)
+	throw std::runtime_error ("fftwf_malloc");
+
+      d_outbuf = (gr_complex *) fftwf_malloc (sizeof (gr_complex) * outbuf_length () * nbatch);
+      if (d_outbuf == 0){
+	fftwf_free (d_inbuf);
+	throw std::runtime_error ("fftwf_malloc");
+      }
+
+      config_threading(d_nthreads);
+      import_wisdom();	// load prior wisdom from disk (once per process)
+
+      // Replan the single-vector transform against the new buffers
+      bool new_wisdom, new_batch_wisdom = false;
+      d_plan = plan_dft_1d (d_fft_size, d_inbuf, d_outbuf,
+			    d_forward ? FFTW_FORWARD : FFTW_BACKWARD,
+			    &new_wisdom);
+
+      if (d_plan == NULL) {
+	fprintf(stderr, "gr::fft: error creating plan\n");
+	throw std::runtime_error ("fftwf_plan_dft_1d failed");
+      }
+
+      if (nbatch > 1) {
+	d_batch_plan = plan_many_dft (d_fft_size, nbatch, d_inbuf, d_outbuf,
+				      d_forward ? FFTW_FORWARD : FFTW_BACKWARD,
+				      &new_batch_wisdom);
+
+	if (d_batch_plan == NULL) {
+	  fprintf(stderr, "gr::fft: error creating batch plan\n");
+	  throw std::runtime_error ("fftwf_plan_many_dft failed");
+	}
+      }
+      if (new_wisdom || new_batch_wisdom)
+	export_wisdom();	// store new wisdom to disk
+    }
+
     void
     fft_complex::set_nthreads(int n)
     {
@@ -203,6 +389,15 @@ namespace gr {
       fftwf_execute((fftwf_plan) d_plan);
     }
 
+    void
+    fft_complex::execute_batch()
+    {
+      if (d_batch_plan)
+	fftwf_execute((fftwf_plan) d_batch_plan);
+      else
+	fftwf_execute((fftwf_plan) d_plan);
+    }
+
 // ----------------------------------------------------------------
 
     fft_real_fwd::fft_real_fwd (int fft_size, int nthreads)
@@ -228,18 +423,17 @@ namespace gr {
 
       d_nthreads = nthreads;
       config_threading(nthreads);
-      import_wisdom();	// load prior wisdom from disk
+      import_wisdom();	// load prior wisdom from disk (once per process)
 
-      d_plan = fftwf_plan_dft_r2c_1d (fft_size,
-				      d_inbuf,
-				      reinterpret_cast<fftwf_complex *>(d_outbuf),
-				      FFTW_MEASURE);
+      bool new_wisdom;
+      d_plan = plan_dft_r2c_1d (fft_size, d_inbuf, d_outbuf, &new_wisdom);
 
       if (d_plan == NULL) {
 	fprintf(stderr, "gr::fft::fft_real_fwd: error creating plan\n");
 	throw std::runtime_error ("fftwf_plan_dft_r2c_1d failed");
       }
-      export_wisdom();	// store new wisdom to disk
+      if (new_wisdom)
+	export_wisdom();	// store new wisdom to disk
     }
 
     fft_real_fwd::~fft_real_fwd()
@@ -295,21 +489,20 @@ namespace gr {
 
       d_nthreads = nthreads;
       config_threading(nthreads);
-      import_wisdom();	// load prior wisdom from disk
+      import_wisdom();	// load prior wisdom from disk (once per process)
 
       // FIXME If there's ever a chance that the planning functions
       // will be called in multiple threads, we've got to ensure single
       // threaded access.  They are not thread-safe.
-      d_plan = fftwf_plan_dft_c2r_1d (fft_size,
-				      reinterpret_cast<fftwf_complex *>(d_inbuf),
-				      d_outbuf,
-				      FFTW_MEASURE);
+      bool new_wisdom;
+      d_plan = plan_dft_c2r_1d (fft_size, d_inbuf, d_outbuf, &new_wisdom);
 
       if (d_plan == NULL) {
 	fprintf(stderr, "gr::fft::fft_real_rev: error creating plan\n");
 	throw std::runtime_error ("fftwf_plan_dft_c2r_1d failed");
       }
-      export_wisdom ();	// store new wisdom to disk
+      if (new_wisdom)
+	export_wisdom ();	// store new wisdom to disk
     }
 
     fft_real_rev::~fft_real_rev ()
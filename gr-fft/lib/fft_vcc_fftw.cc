@@ -26,12 +26,19 @@
 
 #include "fft_vcc_fftw.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/fft/window.h>
+#include <volk/volk.h>
 #include <math.h>
 #include <string.h>
 
 namespace gr {
   namespace fft {
-    
+
+    // How many vectors go through one fftwf_plan_many_dft call; the
+    // per-call FFTW overhead is amortized over the batch and leftover
+    // vectors fall back to the single-vector plan.
+    static const int FFT_VCC_BATCH_SIZE = 8;
+
     fft_vcc::sptr fft_vcc::make(int fft_size, bool forward,
 				const std::vector<float> &window,
 				bool shift, int nthreads)
@@ -50,6 +57,7 @@ namespace gr {
 	d_fft_size(fft_size), d_forward(forward), d_shift(shift)
     {
       d_fft = new fft_complex(d_fft_size, forward, nthreads);
+      d_fft->set_batch_size(FFT_VCC_BATCH_SIZE);
       if(!set_window(window))
         throw std::runtime_error("fft_vcc: window not the same length as fft_size\n");
     }
@@ -82,6 +90,52 @@ namespace gr {
 	return false;
     }
 
+    // copy one input vector into the optimally aligned buffer
+    void
+    fft_vcc_fftw::copy_vector_in(gr_complex *dst, const gr_complex *in)
+    {
+      if(d_window.size()) {
+	if(!d_forward && d_shift) {
+	  // apply window; each shifted half is contiguous, so each
+	  // gets one volk pass
+	  unsigned int offset = (!d_forward && d_shift)?(d_fft_size/2):0;
+	  int fft_m_offset = d_fft_size - offset;
+	  volk_32fc_32f_multiply_32fc(&dst[fft_m_offset], &in[0],
+				      &d_window[0], offset);
+	  volk_32fc_32f_multiply_32fc(&dst[0], &in[offset],
+				      &d_window[offset],
+				      d_fft_size - offset);
+	}
+	else {
+	  window::apply(d_window, in, dst, d_fft_size);
+	}
+      }
+      else {
+	if(!d_forward && d_shift) {  // apply an ifft shift on the data
+	  unsigned int len = (unsigned int)(floor(d_fft_size/2.0)); // half length of complex array
+	  memcpy(&dst[0], &in[len], sizeof(gr_complex)*(d_fft_size - len));
+	  memcpy(&dst[d_fft_size - len], &in[0], sizeof(gr_complex)*len);
+	}
+	else {
+	  memcpy(dst, in, d_fft_size * sizeof(gr_complex));
+	}
+      }
+    }
+
+    // copy one transformed vector to our output
+    void
+    fft_vcc_fftw::copy_vector_out(gr_complex *out, const gr_complex *src)
+    {
+      if(d_forward && d_shift) {  // apply a fft shift on the data
+	unsigned int len = (unsigned int)(ceil(d_fft_size/2.0));
+	memcpy(&out[0], &src[len], sizeof(gr_complex)*(d_fft_size - len));
+	memcpy(&out[d_fft_size - len], &src[0], sizeof(gr_complex)*len);
+      }
+      else {
+	memcpy(out, src, d_fft_size * sizeof(gr_complex));
+      }
+    }
+
     int
     fft_vcc_fftw::work(int noutput_items,
 		       gr_vector_const_void_star &input_items,
@@ -89,59 +143,36 @@ namespace gr {
     {
       const gr_complex *in = (const gr_complex *) input_items[0];
       gr_complex *out = (gr_complex *) output_items[0];
-      
-      unsigned int input_data_size = input_signature()->sizeof_stream_item (0);
-      unsigned int output_data_size = output_signature()->sizeof_stream_item (0);
-      
+
       int count = 0;
-      
-      while(count++ < noutput_items) {
-	
-	// copy input into optimally aligned buffer
-	if(d_window.size()) {
-	  gr_complex *dst = d_fft->get_inbuf();
-	  if(!d_forward && d_shift) {
-	    unsigned int offset = (!d_forward && d_shift)?(d_fft_size/2):0;
-	    int fft_m_offset = d_fft_size - offset;
-	    for(unsigned int i = 0; i < offset; i++)		// apply window
-	      dst[i+fft_m_offset] = in[i] * d_window[i];
-	    for(unsigned int i = offset; i < d_fft_size; i++)	// apply window
-	      dst[i-offset] = in[i] * d_window[i];
-	  } 
-	  else {
-	    for(unsigned int i = 0; i < d_fft_size; i++)		// apply window
-	      dst[i] = in[i] * d_window[i];
-	  }
-	}
-	else {
-	  if(!d_forward && d_shift) {  // apply an ifft shift on the data
-	    gr_complex *dst = d_fft->get_inbuf();
-	    unsigned int len = (unsigned int)(floor(d_fft_size/2.0)); // half length of complex array
-	    memcpy(&dst[0], &in[len], sizeof(gr_complex)*(d_fft_size - len));
-	    memcpy(&dst[d_fft_size - len], &in[0], sizeof(gr_complex)*len);
-	  }
-	  else {
-	    memcpy(d_fft->get_inbuf(), in, input_data_size);
-	  }
-	}
-	
-	// compute the fft
-	d_fft->execute();
-	
-	// copy result to our output
-	if(d_forward && d_shift) {  // apply a fft shift on the data
-	  unsigned int len = (unsigned int)(ceil(d_fft_size/2.0));
-	  memcpy(&out[0], &d_fft->get_outbuf()[len], sizeof(gr_complex)*(d_fft_size - len));
-	  memcpy(&out[d_fft_size - len], &d_fft->get_outbuf()[0], sizeof(gr_complex)*len);
-	}
-	else {
-	  memcpy (out, d_fft->get_outbuf (), output_data_size);
-	}
-	
-	in  += d_fft_size;
-	out += d_fft_size;
+
+      while(count < noutput_items) {
+	// Fill a whole batch when enough vectors are pending and
+	// transform it with one FFTW call; leftovers go one at a
+	// time through the single-vector plan.
+	int nbatch = noutput_items - count;
+	if(nbatch >= d_fft->batch_size())
+	  nbatch = d_fft->batch_size();
+	else
+	  nbatch = 1;
+
+	for(int j = 0; j < nbatch; j++)
+	  copy_vector_in(d_fft->get_inbuf() + j*d_fft_size, in + j*d_fft_size);
+
+	// compute the ffts
+	if(nbatch > 1)
+	  d_fft->execute_batch();
+	else
+	  d_fft->execute();
+
+	for(int j = 0; j < nbatch; j++)
+	  copy_vector_out(out + j*d_fft_size, d_fft->get_outbuf() + j*d_fft_size);
+
+	in    += nbatch * d_fft_size;
+	out   += nbatch * d_fft_size;
+	count += nbatch;
       }
-      
+
       return noutput_items;
     }
 
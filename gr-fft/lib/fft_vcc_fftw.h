@@ -38,6 +38,9 @@ namespace gr {
       bool                  d_forward;
       bool                  d_shift;
 
+      void copy_vector_in(gr_complex *dst, const gr_complex *in);
+      void copy_vector_out(gr_complex *out, const gr_complex *src);
+
     public:
       fft_vcc_fftw(int fft_size, bool forward,
 		   const std::vector<float> &window,
@@ -26,6 +26,7 @@
 
 #include "fft_vfc_fftw.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/fft/window.h>
 #include <math.h>
 #include <string.h>
 
@@ -49,7 +50,17 @@ namespace gr {
 		      io_signature::make(1, 1, fft_size * sizeof(gr_complex))),
 	d_fft_size(fft_size), d_forward(forward)
     {
-      d_fft = new fft_complex(d_fft_size, forward, nthreads);
+      // Real input only needs an r2c transform in the forward
+      // direction; it runs in half the time and touches half the
+      // memory of the complex plan.
+      if(forward) {
+	d_fft = 0;
+	d_rfft = new fft_real_fwd(d_fft_size, nthreads);
+      }
+      else {
+	d_fft = new fft_complex(d_fft_size, forward, nthreads);
+	d_rfft = 0;
+      }
       if(!set_window(window))
         throw std::runtime_error("fft_vfc: window not the same length as fft_size\n");
     }
@@ -57,17 +68,23 @@ namespace gr {
     fft_vfc_fftw::~fft_vfc_fftw()
     {
       delete d_fft;
+      delete d_rfft;
     }
 
     void
     fft_vfc_fftw::set_nthreads(int n)
     {
-      d_fft->set_nthreads(n);
+      if(d_rfft)
+	d_rfft->set_nthreads(n);
+      else
+	d_fft->set_nthreads(n);
     }
 
     int
     fft_vfc_fftw::nthreads() const
     {
+      if(d_rfft)
+	return d_rfft->nthreads();
       return d_fft->nthreads();
     }
     
@@ -95,25 +112,42 @@ namespace gr {
       int count = 0;
       
       while(count++ < noutput_items) {
-	
-	// copy input into optimally aligned buffer
-	if(d_window.size()) {
-	  gr_complex *dst = d_fft->get_inbuf();
-	  for(unsigned int i = 0; i < d_fft_size; i++)    // apply window
-	    dst[i] = in[i] * d_window[i];
+
+	if(d_rfft) {
+	  // window (or just copy) in the float domain, then r2c
+	  float *dst = d_rfft->get_inbuf();
+	  if(d_window.size())
+	    window::apply(d_window, in, dst, d_fft_size);
+	  else
+	    memcpy(dst, in, d_fft_size * sizeof(float));
+
+	  d_rfft->execute();
+
+	  // the r2c transform only computes bins 0 .. N/2; the rest
+	  // of the output follows from conjugate symmetry
+	  unsigned int nhalf = d_fft_size/2 + 1;
+	  memcpy(out, d_rfft->get_outbuf(), nhalf * sizeof(gr_complex));
+	  for(unsigned int k = 1; k < d_fft_size - nhalf + 1; k++)
+	    out[d_fft_size - k] = conj(out[k]);
 	}
 	else {
+	  // reverse transform; the complex plan needs a float to
+	  // complex conversion on the way in
 	  gr_complex *dst = d_fft->get_inbuf();
-	  for(unsigned int i = 0; i < d_fft_size; i++)    // float to complex conversion
-	    dst[i] = in[i];
+	  if(d_window.size()) {
+	    for(unsigned int i = 0; i < d_fft_size; i++)    // apply window
+	      dst[i] = in[i] * d_window[i];
+	  }
+	  else {
+	    for(unsigned int i = 0; i < d_fft_size; i++)    // float to complex conversion
+	      dst[i] = in[i];
+	  }
+
+	  d_fft->execute();
+
+	  memcpy(out, d_fft->get_outbuf(), output_data_size);
 	}
-	
-	// compute the fft
-	d_fft->execute();
-	
-	// copy result to output stream
-	memcpy(out, d_fft->get_outbuf(), output_data_size);
-	
+
 	in  += d_fft_size;
 	out += d_fft_size;
       }
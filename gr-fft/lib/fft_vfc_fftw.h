@@ -32,11 +32,15 @@ namespace gr {
     class FFT_API fft_vfc_fftw : public fft_vfc
     {
     private:
+      // Forward transforms of real input use the half-size r2c plan
+      // (d_rfft); the upper output bins are filled in by conjugate
+      // symmetry. Reverse transforms keep the full complex plan.
       fft_complex          *d_fft;
+      fft_real_fwd         *d_rfft;
       unsigned int          d_fft_size;
       std::vector<float>    d_window;
       bool                  d_forward;
-      
+
     public:
       fft_vfc_fftw(int fft_size, bool forward,
 		   const std::vector<float> &window,
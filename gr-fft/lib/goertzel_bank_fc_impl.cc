@@ -0,0 +1,144 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "goertzel_bank_fc_impl.h"
+#include <gnuradio/io_signature.h>
+#include <stdexcept>
+#include <cmath>
+
+namespace gr {
+  namespace fft {
+
+    goertzel_bank_fc::sptr
+    goertzel_bank_fc::make(int rate, int len, const std::vector<float> &freqs)
+    {
+      return gnuradio::get_initial_sptr
+        (new goertzel_bank_fc_impl(rate, len, freqs));
+    }
+
+    goertzel_bank_fc_impl::goertzel_bank_fc_impl(
+        int rate, int len, const std::vector<float> &freqs)
+      : sync_decimator("goertzel_bank_fc",
+                       io_signature::make(1, 1, sizeof(float)),
+                       io_signature::make(1, 1,
+                                          sizeof(gr_complex)*freqs.size()),
+                       len),
+        d_rate(rate), d_len(len), d_freqs(freqs)
+    {
+      if(freqs.empty()) {
+        throw std::invalid_argument(
+          "goertzel_bank_fc: need at least one tone frequency");
+      }
+      update_coefs();
+    }
+
+    goertzel_bank_fc_impl::~goertzel_bank_fc_impl()
+    {
+    }
+
+    void
+    goertzel_bank_fc_impl::update_coefs()
+    {
+      size_t n = d_freqs.size();
+      d_coef.resize(n);
+      d_wi.resize(n);
+      d_d1.resize(n);
+      d_d2.resize(n);
+      for(size_t t = 0; t < n; t++) {
+        float w = 2.0*M_PI*d_freqs[t]/d_rate;
+        d_coef[t] = 2.0*std::cos(w);
+        d_wi[t] = std::sin(w);
+      }
+    }
+
+    void
+    goertzel_bank_fc_impl::set_freqs(const std::vector<float> &freqs)
+    {
+      // the output vector length is fixed by the io signature
+      if(freqs.size() != d_freqs.size()) {
+        throw std::invalid_argument(
+          "goertzel_bank_fc: number of tones cannot change after construction");
+      }
+      gr::thread::scoped_lock lock(d_mutex);
+      d_freqs = freqs;
+      update_coefs();
+    }
+
+    void
+    goertzel_bank_fc_impl::set_rate(int rate)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      d_rate = rate;
+      update_coefs();
+    }
+
+    int
+    goertzel_bank_fc_impl::work(int noutput_items,
+                                gr_vector_const_void_star &input_items,
+                                gr_vector_void_star &output_items)
+    {
+      const float *in = (const float*)input_items[0];
+      gr_complex *out = (gr_complex*)output_items[0];
+
+      gr::thread::scoped_lock lock(d_mutex);
+
+      int ntones = (int)d_freqs.size();
+      float *coef = &d_coef[0];
+      float *wi = &d_wi[0];
+      float *d1 = &d_d1[0];
+      float *d2 = &d_d2[0];
+
+      for(int i = 0; i < noutput_items; i++) {
+        for(int t = 0; t < ntones; t++) {
+          d1[t] = 0;
+          d2[t] = 0;
+        }
+
+        // one pass over the block; the tone loop carries no
+        // dependencies between tones, so it runs as SIMD lanes
+        for(int j = 0; j < d_len; j++) {
+          float x = in[j];
+          for(int t = 0; t < ntones; t++) {
+            float y = x + coef[t]*d1[t] - d2[t];
+            d2[t] = d1[t];
+            d1[t] = y;
+          }
+        }
+
+        for(int t = 0; t < ntones; t++) {
+          out[t] = gr_complex((0.5f*coef[t]*d1[t] - d2[t])/d_len,
+                              (wi[t]*d1[t])/d_len);
+        }
+
+        in += d_len;
+        out += ntones;
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace fft */
+} /* namespace gr */
@@ -0,0 +1,68 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FFT_GOERTZEL_BANK_FC_IMPL_H
+#define INCLUDED_FFT_GOERTZEL_BANK_FC_IMPL_H
+
+#include <gnuradio/fft/goertzel_bank_fc.h>
+#include <gnuradio/thread/thread.h>
+
+namespace gr {
+  namespace fft {
+
+    class FFT_API goertzel_bank_fc_impl : public goertzel_bank_fc
+    {
+    private:
+      int d_rate;
+      int d_len;
+      std::vector<float> d_freqs;
+      // structure-of-arrays per-tone state so the inner loop runs
+      // across tones and vectorizes
+      std::vector<float> d_coef;   // 2*cos(w) per tone
+      std::vector<float> d_wi;     // sin(w) per tone
+      std::vector<float> d_d1;
+      std::vector<float> d_d2;
+      gr::thread::mutex d_mutex;
+
+      void update_coefs();
+
+    public:
+      goertzel_bank_fc_impl(int rate, int len,
+                            const std::vector<float> &freqs);
+      ~goertzel_bank_fc_impl();
+
+      void set_freqs(const std::vector<float> &freqs);
+      void set_rate(int rate);
+
+      std::vector<float> freqs() const { return d_freqs; }
+      int rate() const { return d_rate; }
+      unsigned int ntones() const { return (unsigned int)d_freqs.size(); }
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace fft */
+} /* namespace gr */
+
+#endif /* INCLUDED_FFT_GOERTZEL_BANK_FC_IMPL_H */
@@ -0,0 +1,139 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "psd_welch_vcf_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <stdexcept>
+
+namespace gr {
+  namespace fft {
+
+    psd_welch_vcf::sptr
+    psd_welch_vcf::make(int fft_size, int overlap, double alpha,
+                        int wintype, double beta, bool shift)
+    {
+      return gnuradio::get_initial_sptr
+        (new psd_welch_vcf_impl(fft_size, overlap, alpha,
+                                wintype, beta, shift));
+    }
+
+    psd_welch_vcf_impl::psd_welch_vcf_impl(int fft_size, int overlap,
+                                           double alpha, int wintype,
+                                           double beta, bool shift)
+      : sync_decimator("psd_welch_vcf",
+                       io_signature::make(1, 1, sizeof(gr_complex)),
+                       io_signature::make(1, 1, fft_size*sizeof(float)),
+                       fft_size - overlap),
+        d_fft_size(fft_size), d_overlap(overlap), d_shift(shift),
+        d_mag(fft_size), d_avg(fft_size), d_avg_valid(false)
+    {
+      if(fft_size <= 0)
+        throw std::invalid_argument("psd_welch_vcf: fft_size must be > 0");
+      if(overlap < 0 || overlap >= fft_size)
+        throw std::invalid_argument("psd_welch_vcf: overlap must be in [0, fft_size)");
+
+      set_alpha(alpha);
+
+      d_fft = new fft_complex(fft_size, true);
+
+      d_window = window::build_cached((window::win_type)wintype,
+                                      fft_size, beta);
+      float power = 0;
+      for(int i = 0; i < fft_size; i++)
+        power += d_window[i]*d_window[i];
+      d_norm = 1.0/power;
+
+      // every output segment reaches back overlap samples past the
+      // stride consumed for it
+      set_history(d_overlap + 1);
+    }
+
+    psd_welch_vcf_impl::~psd_welch_vcf_impl()
+    {
+      delete d_fft;
+    }
+
+    void
+    psd_welch_vcf_impl::set_alpha(double alpha)
+    {
+      if(alpha <= 0 || alpha > 1)
+        throw std::invalid_argument("psd_welch_vcf: alpha must be in (0, 1]");
+      gr::thread::scoped_lock lock(d_mutex);
+      d_alpha = alpha;
+    }
+
+    int
+    psd_welch_vcf_impl::work(int noutput_items,
+                             gr_vector_const_void_star &input_items,
+                             gr_vector_void_star &output_items)
+    {
+      const gr_complex *in = (const gr_complex*)input_items[0];
+      float *out = (float*)output_items[0];
+
+      gr::thread::scoped_lock lock(d_mutex);
+
+      int stride = d_fft_size - d_overlap;
+      float one_m_alpha = 1.0 - d_alpha;
+      int half = d_fft_size/2;
+
+      for(int i = 0; i < noutput_items; i++) {
+        window::apply(d_window, in, d_fft->get_inbuf(), d_fft_size);
+        d_fft->execute();
+
+        volk_32fc_magnitude_squared_32f(&d_mag[0], d_fft->get_outbuf(),
+                                        d_fft_size);
+
+        // normalize, fold into the running average and write the
+        // (optionally shifted) output in one pass
+        if(!d_avg_valid) {
+          for(int j = 0; j < d_fft_size; j++)
+            d_avg[j] = d_mag[j]*d_norm;
+          d_avg_valid = true;
+        }
+        else {
+          for(int j = 0; j < d_fft_size; j++)
+            d_avg[j] = one_m_alpha*d_avg[j] + d_alpha*d_mag[j]*d_norm;
+        }
+
+        if(d_shift) {
+          for(int j = 0; j < d_fft_size; j++)
+            out[(j + half) % d_fft_size] = d_avg[j];
+        }
+        else {
+          for(int j = 0; j < d_fft_size; j++)
+            out[j] = d_avg[j];
+        }
+
+        in  += stride;
+        out += d_fft_size;
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace fft */
+} /* namespace gr */
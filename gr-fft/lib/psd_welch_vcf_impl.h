@@ -0,0 +1,67 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FFT_PSD_WELCH_VCF_IMPL_H
+#define INCLUDED_FFT_PSD_WELCH_VCF_IMPL_H
+
+#include <gnuradio/fft/psd_welch_vcf.h>
+#include <gnuradio/fft/fft.h>
+#include <gnuradio/thread/thread.h>
+
+namespace gr {
+  namespace fft {
+
+    class FFT_API psd_welch_vcf_impl : public psd_welch_vcf
+    {
+    private:
+      int d_fft_size;
+      int d_overlap;
+      double d_alpha;
+      bool d_shift;
+      fft_complex *d_fft;
+      std::vector<float> d_window;  // from window::build_cached
+      float d_norm;                 // 1 / window power
+      std::vector<float> d_mag;     // per-segment |X|^2 scratch
+      std::vector<float> d_avg;     // running average, unshifted order
+      bool d_avg_valid;
+      gr::thread::mutex d_mutex;
+
+    public:
+      psd_welch_vcf_impl(int fft_size, int overlap, double alpha,
+                         int wintype, double beta, bool shift);
+      ~psd_welch_vcf_impl();
+
+      void set_alpha(double alpha);
+
+      double alpha() const { return d_alpha; }
+      int fft_size() const { return d_fft_size; }
+      int overlap() const { return d_overlap; }
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace fft */
+} /* namespace gr */
+
+#endif /* INCLUDED_FFT_PSD_WELCH_VCF_IMPL_H */
@@ -25,7 +25,11 @@
 #endif
 
 #include <gnuradio/fft/window.h>
+#include <gnuradio/thread/thread.h>
+#include <volk/volk.h>
 #include <stdexcept>
+#include <map>
+#include <utility>
 
 namespace gr {
   namespace fft {
@@ -348,5 +352,39 @@ namespace gr {
       }
     }
 
+    // cache key: (type, ntaps) then beta, which only matters for Kaiser
+    typedef std::pair<std::pair<int, int>, double> window_key_t;
+    static std::map<window_key_t, std::vector<float> > s_window_cache;
+    static gr::thread::mutex s_window_cache_mutex;
+
+    const std::vector<float>&
+    window::build_cached(win_type type, int ntaps, double beta)
+    {
+      window_key_t key(std::make_pair((int)type, ntaps), beta);
+
+      gr::thread::scoped_lock lock(s_window_cache_mutex);
+      std::map<window_key_t, std::vector<float> >::iterator it =
+        s_window_cache.find(key);
+      if(it == s_window_cache.end()) {
+        it = s_window_cache.insert(
+          std::make_pair(key, build(type, ntaps, beta))).first;
+      }
+      return it->second;
+    }
+
+    void
+    window::apply(const std::vector<float> &win,
+                  const gr_complex *in, gr_complex *out, int nitems)
+    {
+      volk_32fc_32f_multiply_32fc(out, in, &win.front(), nitems);
+    }
+
+    void
+    window::apply(const std::vector<float> &win,
+                  const float *in, float *out, int nitems)
+    {
+      volk_32f_x2_multiply_32f(out, in, &win.front(), nitems);
+    }
+
   } /* namespace fft */
 } /* namespace gr */
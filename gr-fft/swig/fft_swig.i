@@ -30,18 +30,24 @@
 %{
 #include "gnuradio/fft/fft_vcc.h"
 #include "gnuradio/fft/fft_vfc.h"
+#include "gnuradio/fft/goertzel_bank_fc.h"
 #include "gnuradio/fft/goertzel_fc.h"
+#include "gnuradio/fft/psd_welch_vcf.h"
 #include "gnuradio/fft/window.h"
 %}
 
 %include "gnuradio/fft/fft_vcc.h"
 %include "gnuradio/fft/fft_vfc.h"
+%include "gnuradio/fft/goertzel_bank_fc.h"
 %include "gnuradio/fft/goertzel_fc.h"
+%include "gnuradio/fft/psd_welch_vcf.h"
 %include "gnuradio/fft/window.h"
 
 GR_SWIG_BLOCK_MAGIC2(fft, fft_vcc);
 GR_SWIG_BLOCK_MAGIC2(fft, fft_vfc);
+GR_SWIG_BLOCK_MAGIC2(fft, goertzel_bank_fc);
 GR_SWIG_BLOCK_MAGIC2(fft, goertzel_fc);
+GR_SWIG_BLOCK_MAGIC2(fft, psd_welch_vcf);
 
 #ifdef GR_CTRLPORT
 
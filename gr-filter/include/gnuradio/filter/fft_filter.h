@@ -27,6 +27,7 @@
 #include <vector>
 #include <gnuradio/gr_complex.h>
 #include <gnuradio/fft/fft.h>
+#include <gnuradio/thread/thread.h>
 
 namespace gr {
   namespace filter {
@@ -122,14 +123,39 @@ l	 * \brief Perform the filter operation
 	int                      d_decimation;
 	fft::fft_complex        *d_fwdfft;	    // forward "plan"
 	fft::fft_complex        *d_invfft;          // inverse "plan"
-	int                      d_nthreads;        // number of FFTW threads to use
+	int                      d_nthreads;        // number of segment pipeline workers
 	std::vector<gr_complex>  d_tail;	    // state carried between blocks for overlap-add
 	std::vector<gr_complex>  d_taps;            // stores time domain taps
 	gr_complex              *d_xformed_taps;    // Fourier xformed taps
 
+	// Worker pool for the segment pipeline.  Each worker owns its
+	// own FFT pair so the forward transform, tap multiply and
+	// inverse transform of successive overlap-save segments run
+	// concurrently; the tail recombination stays on the caller's
+	// thread since it is serial across segments.
+	std::vector<fft::fft_complex*>   d_seg_fwd;
+	std::vector<fft::fft_complex*>   d_seg_inv;
+	std::vector<gr_complex>          d_seg_out;  // inverse xforms of one batch
+	std::vector<gr::thread::thread*> d_workers;
+	gr::thread::mutex                d_pipe_mutex;
+	gr::thread::condition_variable   d_pipe_cond;
+	gr::thread::condition_variable   d_pipe_done;
+	unsigned long                    d_pipe_generation;
+	int                              d_pipe_nworking;
+	bool                             d_pipe_exit;
+	const gr_complex                *d_job_input; // batch being filtered
+	int                              d_job_seg0;
+	int                              d_job_nsegs;
+
 	void compute_sizes(int ntaps);
 	int tailsize() const { return d_ntaps - 1; }
 
+	void pipe_worker(int which);
+	void stop_workers();
+	void alloc_worker_ffts();
+	void filter_segment(fft::fft_complex *fwd, fft::fft_complex *inv,
+			    const gr_complex *in, gr_complex *out);
+
       public:
 	/*!
 	 * \brief Construct an FFT filter for complex vectors with the given taps and decimation rate.
@@ -139,7 +165,7 @@ l	 * \brief Perform the filter operation
 	 *
 	 * \param decimation The decimation rate of the filter (int)
 	 * \param taps       The filter taps (complex)
-	 * \param nthreads   The number of threads for the FFT to use (int)
+	 * \param nthreads   The number of worker threads filtering segments (int)
 	 */
 	fft_filter_ccc(int decimation,
 		       const std::vector<gr_complex> &taps,
@@ -157,6 +183,11 @@ l	 * \brief Perform the filter operation
 
 	/*!
 	 * \brief Set number of threads to use.
+	 *
+	 * Threads here are workers that each transform whole
+	 * overlap-save segments, not FFTW's internal threads; the
+	 * per-segment transforms are far too small for the latter to
+	 * pay off.
 	 */
 	void set_nthreads(int n);
 
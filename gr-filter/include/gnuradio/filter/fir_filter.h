@@ -59,6 +59,17 @@ namespace gr {
 	float        *d_output;
 	int           d_align;
 	int           d_naligned;
+	// Fully unrolled kernel for common small tap counts;
+	// NULL means use the generic volk dot product
+	float       (*d_dot_fixed)(const float*, const float*);
+	// Folded mode for linear-phase (symmetric) designs,
+	// auto-detected in set_taps: mirrored input pairs are
+	// pre-added so the dot product runs over half the taps
+	bool          d_symmetric;
+	unsigned int  d_nhalf;
+	float         d_center;
+	float        *d_half_taps;
+	float        *d_folded;
       };
 
       /**************************************************************/
@@ -91,6 +102,17 @@ namespace gr {
 	gr_complex  *d_output;
 	int          d_align;
 	int          d_naligned;
+	// Fully unrolled kernel for common small tap counts;
+	// NULL means use the generic volk dot product
+	gr_complex  (*d_dot_fixed)(const gr_complex*, const float*);
+	// Folded mode for linear-phase (symmetric) designs,
+	// auto-detected in set_taps: mirrored input pairs are
+	// pre-added so the dot product runs over half the taps
+	bool          d_symmetric;
+	unsigned int  d_nhalf;
+	float         d_center;
+	float        *d_half_taps;
+	gr_complex   *d_folded;
       };
 
       /**************************************************************/
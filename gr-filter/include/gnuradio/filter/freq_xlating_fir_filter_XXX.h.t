@@ -81,6 +81,23 @@ namespace gr {
 
       virtual void set_taps(const std::vector<@TAP_TYPE@> &taps) = 0;
       virtual std::vector<@TAP_TYPE@> taps() const = 0;
+
+      /*!
+       * \brief Enable or disable the fast retune architecture.
+       *
+       * When enabled, the frequency translation is performed by a
+       * rotator stage ahead of a static FIR holding the prototype
+       * taps, so set_center_freq() only changes the rotator
+       * increment and never recomputes the tap set.  Use this when
+       * the block is retuned often (e.g. scanning); the default
+       * composite architecture folds the translation into the taps,
+       * which is cheaper per sample but rebuilds them on every
+       * retune.
+       *
+       * Only available on the complex input versions of this block;
+       * enabling it elsewhere throws.
+       */
+      virtual void set_fast_retune(bool enable) = 0;
     };
 
   } /* namespace filter */
@@ -0,0 +1,77 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FILTER_HALFBAND_DECIMATOR_CC_H
+#define INCLUDED_FILTER_HALFBAND_DECIMATOR_CC_H
+
+#include <gnuradio/filter/api.h>
+#include <gnuradio/sync_decimator.h>
+
+namespace gr {
+  namespace filter {
+
+    /*!
+     * \brief Decimate-by-2 FIR filter specialized for halfband taps
+     * \ingroup filter_blk
+     *
+     * \details
+     * A halfband low-pass design has a symmetric, odd-length impulse
+     * response in which every other tap is zero except the center
+     * one.  A generic fir_filter_ccf multiplies all of them anyway;
+     * this block drops the zero taps at construction and folds each
+     * symmetric pair into one add before the multiply, so a length-N
+     * halfband filter costs about N/4 multiplies per output instead
+     * of N.
+     *
+     * The full symmetric tap vector (as produced by
+     * firdes::low_pass() with cutoff at a quarter of the input rate)
+     * is passed in; the block checks the symmetry and rejects tap
+     * sets that are not symmetric and odd-length.
+     */
+    class FILTER_API halfband_decimator_cc : virtual public sync_decimator
+    {
+    public:
+      // gr::filter::halfband_decimator_cc::sptr
+      typedef boost::shared_ptr<halfband_decimator_cc> sptr;
+
+      /*!
+       * Build a halfband decimator.
+       *
+       * \param taps full symmetric tap vector of odd length; zero
+       *             taps are skipped by the kernel.
+       */
+      static sptr make(const std::vector<float> &taps);
+
+      //! Replace the taps; takes effect on the next work call.
+      virtual void set_taps(const std::vector<float> &taps) = 0;
+
+      //! Return the full tap vector.
+      virtual std::vector<float> taps() const = 0;
+
+      //! Number of multiplies the kernel performs per output sample.
+      virtual unsigned int nmults() const = 0;
+    };
+
+  } /* namespace filter */
+} /* namespace gr */
+
+#endif /* INCLUDED_FILTER_HALFBAND_DECIMATOR_CC_H */
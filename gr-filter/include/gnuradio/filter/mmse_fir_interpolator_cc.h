@@ -69,8 +69,28 @@ namespace gr {
        */
       gr_complex interpolate(const gr_complex input[], float mu) const;
 
+      /*!
+       * \brief compute a whole buffer of interpolated output values.
+       *
+       * Runs the fractional-delay phase accumulator across \p noutput
+       * output samples in one call, reading from \p input and writing
+       * to \p output.  \p input must have
+       * ceil(noutput * mu_inc) + ntaps() valid entries.
+       *
+       * \p mu is the fractional delay in [0, 1) on entry and is
+       * updated to its value after the last output sample; \p mu_inc
+       * is the (fixed) phase increment per output sample.
+       *
+       * \returns the number of input samples consumed.
+       */
+      int resample(gr_complex *output, int noutput,
+                   const gr_complex *input,
+                   double &mu, double mu_inc) const;
+
     protected:
       std::vector<kernel::fir_filter_ccf *> filters;
+      //! taps copied row-per-phase into one contiguous block
+      std::vector<float> d_flat_taps;
     };
 
   }  /* namespace filter */
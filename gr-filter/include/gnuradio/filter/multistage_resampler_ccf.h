@@ -0,0 +1,86 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FILTER_MULTISTAGE_RESAMPLER_CCF_H
+#define INCLUDED_FILTER_MULTISTAGE_RESAMPLER_CCF_H
+
+#include <gnuradio/filter/api.h>
+#include <gnuradio/hier_block2.h>
+
+namespace gr {
+  namespace filter {
+
+    /*!
+     * \brief Automatically designed multi-stage resampler
+     * \ingroup resamplers_blk
+     *
+     * \details
+     * Resamples the input stream by \p rate, factoring the rate at
+     * construction into a cascade of filter-by-2 stages plus one
+     * polyphase arbitrary resampler for the residual fraction.
+     *
+     * Each intermediate stage only has to keep aliases (or images)
+     * out of the final passband, so its transition band is much
+     * wider than a single-stage design's and its filter much
+     * shorter; for large rate changes the cascade needs a small
+     * fraction of the multiplies of the equivalent single-stage
+     * filter.  All stage filters are designed with
+     * firdes::low_pass_2() to the requested stopband attenuation.
+     *
+     * For decimation the by-2 stages run first and the arbitrary
+     * resampler last (at the lowest rate); for interpolation the
+     * order is reversed.
+     */
+    class FILTER_API multistage_resampler_ccf : virtual public hier_block2
+    {
+    public:
+      // gr::filter::multistage_resampler_ccf::sptr
+      typedef boost::shared_ptr<multistage_resampler_ccf> sptr;
+
+      /*!
+       * Build the multi-stage resampler.
+       *
+       * \param rate resampling rate (output rate / input rate); must be > 0.
+       * \param attenuation_dB stopband attenuation of every stage, in dB.
+       * \param passband_frac fraction of the narrower Nyquist band
+       *                      occupied by the signal of interest
+       *                      (sets the stage transition bands); must
+       *                      be in (0, 1).
+       */
+      static sptr make(double rate,
+                       double attenuation_dB=60.0,
+                       double passband_frac=0.8);
+
+      //! Return the overall resampling rate.
+      virtual double rate() const = 0;
+
+      //! Return the number of cascaded filter stages.
+      virtual unsigned int num_stages() const = 0;
+
+      //! Return the total prototype filter taps across all stages.
+      virtual unsigned int total_taps() const = 0;
+    };
+
+  } /* namespace filter */
+} /* namespace gr */
+
+#endif /* INCLUDED_FILTER_MULTISTAGE_RESAMPLER_CCF_H */
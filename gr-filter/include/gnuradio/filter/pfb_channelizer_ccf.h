@@ -158,6 +158,19 @@ namespace gr {
        */
       virtual void print_taps() = 0;
 
+      /*!
+       * Set the number of worker threads that split the filter arms
+       * among themselves; the arm filtering is then overlapped with
+       * the output FFT. The default of 1 runs everything on the
+       * block's own thread.
+       */
+      virtual void set_nthreads(int nthreads) = 0;
+
+      /*!
+       * Get the number of worker threads filtering the arms.
+       */
+      virtual int nthreads() const = 0;
+
       /*!
        * Return a vector<vector<>> of the filterbank taps
        */
@@ -28,6 +28,8 @@
 #include <gnuradio/filter/fir_filter.h>
 #include <gnuradio/filter/fft_filter.h>
 #include <gnuradio/fft/fft.h>
+#include <gnuradio/thread/thread.h>
+#include <boost/function.hpp>
 
 namespace gr {
   namespace filter {
@@ -108,6 +110,38 @@ namespace gr {
 	unsigned int             d_taps_per_filter;
 	fft::fft_complex        *d_fft;
 
+	// Internal worker pool that partitions the filter arms
+	// across threads.  The pool only exists with nthreads > 1;
+	// otherwise jobs run synchronously on the caller's thread.
+	int                      d_nthreads;
+	std::vector<gr::thread::thread*> d_threads;
+	gr::thread::mutex        d_pool_mutex;
+	gr::thread::condition_variable d_pool_cond;
+	gr::thread::condition_variable d_pool_done;
+	boost::function<void(unsigned int, unsigned int)> d_job;
+	unsigned long            d_pool_generation;
+	int                      d_pool_nworking;
+	bool                     d_pool_exit;
+
+	void pool_worker(int which);
+	void stop_pool();
+
+	/*!
+	 * Hand \p job to the worker pool.  Each worker calls
+	 * job(lo, hi) on its slice of [0, nfilts) and the call
+	 * returns immediately, so the caller can overlap other work
+	 * (such as the output FFT of the previous round) with the
+	 * filtering; job must therefore be safe to run concurrently
+	 * on distinct arms.  With one thread the job runs
+	 * synchronously and wait_arm_job() is a no-op.
+	 */
+	void start_arm_job(const boost::function<void(unsigned int, unsigned int)> &job);
+
+	/*!
+	 * Wait for the job handed to start_arm_job() to finish.
+	 */
+	void wait_arm_job();
+
       public:
 	/*!
 	 * Build the polyphase filterbank decimator.
@@ -141,6 +175,18 @@ namespace gr {
 	 * Return a vector<vector<>> of the filterbank taps
 	 */
 	std::vector<std::vector<float> > taps() const;
+
+	/*!
+	 * Set the number of worker threads that partition the filter
+	 * arms among themselves.  The default of 1 keeps all
+	 * filtering on the caller's thread.
+	 */
+	void set_nthreads(int nthreads);
+
+	/*!
+	 * Get the number of worker threads filtering the arms.
+	 */
+	int nthreads() const { return d_nthreads; }
       };
 
     } /* namespace kernel */
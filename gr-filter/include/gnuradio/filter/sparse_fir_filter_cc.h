@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FILTER_SPARSE_FIR_FILTER_CC_H
+#define INCLUDED_FILTER_SPARSE_FIR_FILTER_CC_H
+
+#include <gnuradio/filter/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace filter {
+
+    /*!
+     * \brief Sparse FIR filter with gr_complex input, gr_complex
+     * output and gr_complex taps
+     * \ingroup filter_blk
+     *
+     * \details
+     * Filters with an explicit list of (delay, tap) pairs instead of a
+     * dense tap vector.  Each tap costs one multiply-accumulate pass
+     * over the output block, so the work scales with the number of
+     * non-zero taps rather than the overall delay spread.  This is the
+     * natural form for multipath channel models, where a handful of
+     * echoes may be spread over many hundreds of samples and a dense
+     * FIR burns almost all of its cycles multiplying by zero.
+     */
+    class FILTER_API sparse_fir_filter_cc : virtual public sync_block
+    {
+    public:
+      // gr::filter::sparse_fir_filter_cc::sptr
+      typedef boost::shared_ptr<sparse_fir_filter_cc> sptr;
+
+      /*!
+       * \brief Create a sparse FIR filter.
+       *
+       * \param delays tap positions in samples; need not be sorted,
+       *               but must be non-negative and unique
+       * \param taps   complex tap values, one per delay
+       */
+      static sptr make(const std::vector<int> &delays,
+                       const std::vector<gr_complex> &taps);
+
+      //! Replace the (delay, tap) set; vectors must be the same length
+      virtual void set_taps(const std::vector<int> &delays,
+                            const std::vector<gr_complex> &taps) = 0;
+
+      virtual std::vector<int> delays() const = 0;
+      virtual std::vector<gr_complex> taps() const = 0;
+    };
+
+  } /* namespace filter */
+} /* namespace gr */
+
+#endif /* INCLUDED_FILTER_SPARSE_FIR_FILTER_CC_H */
@@ -0,0 +1,312 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Throughput benchmarks for the gr-filter kernels. Each benchmark
+ * prints a CSV row so results can be diffed between builds:
+ *
+ *   bench_gr_filter [--output FILE]
+ *
+ * Covered: fir_filter_ccf across tap counts, fft_filter_ccc across
+ * tap counts, pfb_arb_resampler_ccf across rates (items/sec counts
+ * input samples) and the pfb_channelizer_ccf block across channel
+ * counts (run in a small flowgraph; items/sec counts total input
+ * samples over all channels).
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/filter/fir_filter.h>
+#include <gnuradio/filter/fft_filter.h>
+#include <gnuradio/filter/pfb_arb_resampler.h>
+#include <gnuradio/filter/pfb_channelizer_ccf.h>
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/top_block.h>
+#include <gnuradio/sync_block.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/high_res_timer.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  using namespace gr;
+  using namespace gr::filter;
+
+  static const double MIN_BENCH_SECONDS = 0.25;
+
+  static double
+  to_seconds(high_res_timer_type ticks)
+  {
+    return (double)ticks / (double)high_res_timer_tps();
+  }
+
+  static std::vector<std::string> s_rows;
+
+  static void
+  record(const std::string &bench, const std::string &params,
+         uint64_t items, double seconds)
+  {
+    std::ostringstream os;
+    os << bench << "," << params << "," << items << ","
+       << seconds << "," << (double)items / seconds;
+    s_rows.push_back(os.str());
+  }
+
+  // ------------------------------------------------------------------
+  // fir_filter_ccf across tap counts
+  // ------------------------------------------------------------------
+  static void
+  bench_fir_filter_ccf()
+  {
+    static const int NTAPS[] = { 8, 16, 32, 64, 128, 256 };
+    static const int CHUNK = 32768;
+
+    for(size_t t = 0; t < sizeof(NTAPS)/sizeof(NTAPS[0]); t++) {
+      int ntaps = NTAPS[t];
+      std::vector<float> taps(ntaps, 1.0f/ntaps);
+      kernel::fir_filter_ccf fir(1, taps);
+
+      std::vector<gr_complex> in(CHUNK + ntaps, gr_complex(1, -1));
+      std::vector<gr_complex> out(CHUNK);
+
+      uint64_t items = 0;
+      high_res_timer_type start = high_res_timer_now();
+      do {
+        fir.filterN(&out[0], &in[0], CHUNK);
+        items += CHUNK;
+      } while(to_seconds(high_res_timer_now() - start) < MIN_BENCH_SECONDS);
+      double secs = to_seconds(high_res_timer_now() - start);
+
+      std::ostringstream p;
+      p << "ntaps=" << ntaps;
+      record("fir_filter_ccf", p.str(), items, secs);
+    }
+  }
+
+  // ------------------------------------------------------------------
+  // fft_filter_ccc across tap counts
+  // ------------------------------------------------------------------
+  static void
+  bench_fft_filter_ccc()
+  {
+    static const int NTAPS[] = { 64, 256, 1024 };
+
+    for(size_t t = 0; t < sizeof(NTAPS)/sizeof(NTAPS[0]); t++) {
+      int ntaps = NTAPS[t];
+      std::vector<gr_complex> taps(ntaps, gr_complex(1.0f/ntaps, 0));
+      kernel::fft_filter_ccc fil(1, taps);
+      int nsamples = fil.set_taps(taps);
+
+      // filter() wants a multiple of the overlap-add block size
+      int chunk = std::max(1, 32768 / nsamples) * nsamples;
+      std::vector<gr_complex> in(chunk, gr_complex(1, -1));
+      std::vector<gr_complex> out(chunk);
+
+      uint64_t items = 0;
+      high_res_timer_type start = high_res_timer_now();
+      do {
+        fil.filter(chunk, &in[0], &out[0]);
+        items += chunk;
+      } while(to_seconds(high_res_timer_now() - start) < MIN_BENCH_SECONDS);
+      double secs = to_seconds(high_res_timer_now() - start);
+
+      std::ostringstream p;
+      p << "ntaps=" << ntaps;
+      record("fft_filter_ccc", p.str(), items, secs);
+    }
+  }
+
+  // ------------------------------------------------------------------
+  // pfb_arb_resampler_ccf across rates; items/sec counts input samples
+  // ------------------------------------------------------------------
+  static void
+  bench_pfb_arb_resampler()
+  {
+    static const float RATES[] = { 0.5f, 1.33f, 3.2f, 7.0f };
+    static const int FILTER_SIZE = 32;
+    static const int CHUNK = 16384;
+
+    std::vector<float> taps =
+      firdes::low_pass(FILTER_SIZE, FILTER_SIZE, 0.45, 0.1);
+
+    for(size_t r = 0; r < sizeof(RATES)/sizeof(RATES[0]); r++) {
+      float rate = RATES[r];
+      kernel::pfb_arb_resampler_ccf resamp(rate, taps, FILTER_SIZE);
+
+      std::vector<gr_complex> in(CHUNK, gr_complex(1, -1));
+      std::vector<gr_complex> out((int)std::ceil(CHUNK * rate) + FILTER_SIZE);
+
+      uint64_t items = 0;
+      high_res_timer_type start = high_res_timer_now();
+      do {
+        int nread = 0;
+        resamp.filter(&in[0], &out[0], CHUNK, nread);
+        items += nread;
+      } while(to_seconds(high_res_timer_now() - start) < MIN_BENCH_SECONDS);
+      double secs = to_seconds(high_res_timer_now() - start);
+
+      std::ostringstream p;
+      p << "rate=" << rate;
+      record("pfb_arb_resampler_ccf", p.str(), items, secs);
+    }
+  }
+
+  // ------------------------------------------------------------------
+  // pfb_channelizer_ccf across channel counts, run as a flowgraph.
+  // The source and sink are defined locally so the benchmark only
+  // needs gr-filter and the runtime.
+  // ------------------------------------------------------------------
+
+  //! Emits a fixed number of zero samples on each of its outputs
+  class bench_csource : public sync_block
+  {
+  private:
+    uint64_t d_per_stream;
+    uint64_t d_sent;
+
+  public:
+    typedef boost::shared_ptr<bench_csource> sptr;
+
+    bench_csource(int nstreams, uint64_t per_stream)
+      : sync_block("bench_csource",
+                   io_signature::make(0, 0, 0),
+                   io_signature::make(nstreams, nstreams, sizeof(gr_complex))),
+        d_per_stream(per_stream), d_sent(0)
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star &input_items,
+             gr_vector_void_star &output_items)
+    {
+      if(d_sent >= d_per_stream)
+        return -1;  // WORK_DONE
+
+      int n = (int)std::min((uint64_t)noutput_items, d_per_stream - d_sent);
+      for(size_t o = 0; o < output_items.size(); o++)
+        memset(output_items[o], 0, n * sizeof(gr_complex));
+      d_sent += n;
+      return n;
+    }
+  };
+
+  //! Discards everything on all of its inputs
+  class bench_csink : public sync_block
+  {
+  public:
+    typedef boost::shared_ptr<bench_csink> sptr;
+
+    bench_csink(int nstreams)
+      : sync_block("bench_csink",
+                   io_signature::make(nstreams, nstreams, sizeof(gr_complex)),
+                   io_signature::make(0, 0, 0))
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star &input_items,
+             gr_vector_void_star &output_items)
+    {
+      return noutput_items;
+    }
+  };
+
+  static void
+  bench_pfb_channelizer()
+  {
+    static const int NCHANS[] = { 4, 16, 64 };
+    static const uint64_t TOTAL_ITEMS = 4 * 1000 * 1000;
+
+    for(size_t c = 0; c < sizeof(NCHANS)/sizeof(NCHANS[0]); c++) {
+      int nchans = NCHANS[c];
+      uint64_t per_stream = TOTAL_ITEMS / nchans;
+
+      std::vector<float> taps =
+        firdes::low_pass(1.0, nchans, 0.45, 0.1);
+
+      top_block_sptr tb = make_top_block("bench_pfb_channelizer");
+      bench_csource::sptr src(new bench_csource(nchans, per_stream));
+      filter::pfb_channelizer_ccf::sptr chan =
+        filter::pfb_channelizer_ccf::make(nchans, taps, 1.0);
+      bench_csink::sptr snk(new bench_csink(nchans));
+
+      for(int i = 0; i < nchans; i++) {
+        tb->connect(src, i, chan, i);
+        tb->connect(chan, i, snk, i);
+      }
+
+      high_res_timer_type start = high_res_timer_now();
+      tb->run();
+      double secs = to_seconds(high_res_timer_now() - start);
+
+      std::ostringstream p;
+      p << "nchans=" << nchans;
+      record("pfb_channelizer_ccf", p.str(), per_stream * nchans, secs);
+    }
+  }
+
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  std::string output;
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+      output = argv[++i];
+    else {
+      std::cerr << "usage: bench_gr_filter [--output FILE]" << std::endl;
+      return 1;
+    }
+  }
+
+  bench_fir_filter_ccf();
+  bench_fft_filter_ccc();
+  bench_pfb_arb_resampler();
+  bench_pfb_channelizer();
+
+  std::ostringstream os;
+  os << "bench,params,items,seconds,items_per_sec\n";
+  for(size_t i = 0; i < s_rows.size(); i++)
+    os << s_rows[i] << "\n";
+
+  if(output.empty())
+    std::cout << os.str();
+  else {
+    std::ofstream f(output.c_str());
+    f << os.str();
+  }
+
+  return 0;
+}
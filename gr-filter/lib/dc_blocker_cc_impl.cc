@@ -26,36 +26,11 @@
 
 #include "dc_blocker_cc_impl.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
 #include <cstdio>
 
 namespace gr {
   namespace filter {
-    
-    moving_averager_c::moving_averager_c(int D)
-      : d_length(D), d_out(0), d_out_d1(0), d_out_d2(0)
-    {
-      d_delay_line = std::deque<gr_complex>(d_length-1, gr_complex(0,0));
-    }
-
-    moving_averager_c::~moving_averager_c()
-    {
-    }
-
-    gr_complex
-    moving_averager_c::filter(gr_complex x)
-    {
-      d_out_d1 = d_out;
-      d_delay_line.push_back(x);
-      d_out = d_delay_line[0];
-      d_delay_line.pop_front();
-      
-      gr_complex y = x - d_out_d1 + d_out_d2;
-      d_out_d2 = y;
-      
-      return (y / (float)(d_length));
-    }
-
-
 
     dc_blocker_cc::sptr dc_blocker_cc::make(int D, bool long_form)
     {
@@ -69,33 +44,17 @@ namespace gr {
 		      io_signature::make (1, 1, sizeof(gr_complex))),
 	d_length(D), d_long_form(long_form)
     {
-      if(d_long_form) {
-	d_ma_0 = new moving_averager_c(D);
-	d_ma_1 = new moving_averager_c(D);
-	d_ma_2 = new moving_averager_c(D);
-	d_ma_3 = new moving_averager_c(D);
-	d_delay_line = std::deque<gr_complex>(d_length-1, gr_complex(0,0));
-      }
-      else {
-	d_ma_0 = new moving_averager_c(D);
-	d_ma_1 = new moving_averager_c(D);
-        d_ma_2 = NULL;
-        d_ma_3 = NULL;
-      }
+      // Each cascaded averager looks back D-1 samples; let the
+      // scheduler's history keep them for us so the stages can run as
+      // bulk moving sums over the whole input buffer.
+      if(d_long_form)
+	set_history(4*(d_length-1) + 1);
+      else
+	set_history(2*(d_length-1) + 1);
     }
 
     dc_blocker_cc_impl::~dc_blocker_cc_impl()
     {
-      if(d_long_form) {
-	delete d_ma_0;
-	delete d_ma_1;
-	delete d_ma_2;
-	delete d_ma_3;
-      }
-      else {
-	delete d_ma_0;
-	delete d_ma_1;
-      }
     }
 
     int
@@ -114,31 +73,51 @@ namespace gr {
     {
       const gr_complex *in = (const gr_complex*)input_items[0];
       gr_complex *out = (gr_complex*)output_items[0];
-      
+      float scale = (float)d_length;
+
       if(d_long_form) {
-	gr_complex y1, y2, y3, y4, d;
-	for(int i = 0; i < noutput_items; i++) {
-	  y1 = d_ma_0->filter(in[i]);
-	  y2 = d_ma_1->filter(y1);
-	  y3 = d_ma_2->filter(y2);
-	  y4 = d_ma_3->filter(y3);
-	  
-	  d_delay_line.push_back(d_ma_0->delayed_sig());
-	  d = d_delay_line[0];
-	  d_delay_line.pop_front();
-	  
-	  out[i] = d - y4;
-	}
+	int n1 = noutput_items + 3*(d_length-1);
+	int n2 = noutput_items + 2*(d_length-1);
+	int n3 = noutput_items + (d_length-1);
+
+	d_ms1.resize(n1);
+	d_ms2.resize(n2);
+	d_ms3.resize(n3);
+	d_ms4.resize(noutput_items);
+
+	volk_32fc_s32f_moving_sum_32fc(&d_ms1[0], in, scale, n1);
+	for(int i = 0; i < n1; i++)
+	  d_ms1[i] /= scale;
+
+	volk_32fc_s32f_moving_sum_32fc(&d_ms2[0], &d_ms1[0], scale, n2);
+	for(int i = 0; i < n2; i++)
+	  d_ms2[i] /= scale;
+
+	volk_32fc_s32f_moving_sum_32fc(&d_ms3[0], &d_ms2[0], scale, n3);
+	for(int i = 0; i < n3; i++)
+	  d_ms3[i] /= scale;
+
+	volk_32fc_s32f_moving_sum_32fc(&d_ms4[0], &d_ms3[0], scale,
+				       noutput_items);
+	for(int i = 0; i < noutput_items; i++)
+	  out[i] = in[i + 2*(d_length-1)] - d_ms4[i] / scale;
       }
       else {
-	gr_complex y1, y2;
-	for(int i = 0; i < noutput_items; i++) {
-	  y1 = d_ma_0->filter(in[i]);
-	  y2 = d_ma_1->filter(y1);
-	  out[i] = d_ma_0->delayed_sig() - y2;
-	}
+	int n1 = noutput_items + (d_length-1);
+
+	d_ms1.resize(n1);
+	d_ms2.resize(noutput_items);
+
+	volk_32fc_s32f_moving_sum_32fc(&d_ms1[0], in, scale, n1);
+	for(int i = 0; i < n1; i++)
+	  d_ms1[i] /= scale;
+
+	volk_32fc_s32f_moving_sum_32fc(&d_ms2[0], &d_ms1[0], scale,
+				       noutput_items);
+	for(int i = 0; i < noutput_items; i++)
+	  out[i] = in[i + d_length - 1] - d_ms2[i] / scale;
       }
-      
+
       return noutput_items;
     }
 
@@ -26,6 +26,7 @@
 
 #include <gnuradio/filter/fft_filter.h>
 #include <volk/volk.h>
+#include <boost/bind.hpp>
 #include <iostream>
 #include <cstring>
 
@@ -59,6 +60,13 @@ namespace gr {
       fft_filter_fff::set_taps(const std::vector<float> &taps)
       {
 	int i = 0;
+
+	// Identical taps leave the frequency-domain image and all of
+	// the sizes unchanged; skip the transform and keep the tail
+	// so the output stream is unbroken.
+	if(d_xformed_taps != NULL && taps == d_taps)
+	  return d_nsamples;
+
         d_taps = taps;
 	compute_sizes(taps.size());
 
@@ -196,13 +204,20 @@ namespace gr {
 				     const std::vector<gr_complex> &taps,
 				     int nthreads)
 	: d_fftsize(-1), d_decimation(decimation), d_fwdfft(NULL),
-	  d_invfft(NULL), d_nthreads(nthreads), d_xformed_taps(NULL)
+	  d_invfft(NULL), d_nthreads(1), d_xformed_taps(NULL),
+	  d_pipe_generation(0), d_pipe_nworking(0), d_pipe_exit(false)
       {
 	set_taps(taps);
+	set_nthreads(nthreads);
       }
 
       fft_filter_ccc::~fft_filter_ccc()
       {
+	stop_workers();
+	for(size_t i = 0; i < d_seg_fwd.size(); i++) {
+	  delete d_seg_fwd[i];
+	  delete d_seg_inv[i];
+	}
 	delete d_fwdfft;
 	delete d_invfft;
         if(d_xformed_taps != NULL)
@@ -216,6 +231,13 @@ namespace gr {
       fft_filter_ccc::set_taps(const std::vector<gr_complex> &taps)
       {
 	int i = 0;
+
+	// Identical taps leave the frequency-domain image and all of
+	// the sizes unchanged; skip the transform and keep the tail
+	// so the output stream is unbroken.
+	if(d_xformed_taps != NULL && taps == d_taps)
+	  return d_nsamples;
+
         d_taps = taps;
 	compute_sizes(taps.size());
 
@@ -266,21 +288,124 @@ namespace gr {
 	  delete d_invfft;
           if(d_xformed_taps != NULL)
             volk_free(d_xformed_taps);
-	  d_fwdfft = new fft::fft_complex(d_fftsize, true, d_nthreads);
-	  d_invfft = new fft::fft_complex(d_fftsize, false, d_nthreads);
+	  d_fwdfft = new fft::fft_complex(d_fftsize, true);
+	  d_invfft = new fft::fft_complex(d_fftsize, false);
 	  d_xformed_taps = (gr_complex*)volk_malloc(sizeof(gr_complex)*d_fftsize,
                                                     volk_get_alignment());
+	  if(d_nthreads > 1) {
+	    alloc_worker_ffts();
+	    d_seg_out.resize(d_nthreads * d_fftsize);
+	  }
 	}
       }
 
       void
       fft_filter_ccc::set_nthreads(int n)
       {
+	if(n < 1)
+	  n = 1;
+	if(n == d_nthreads && !(n > 1 && d_workers.empty()))
+	  return;
+
+	stop_workers();
 	d_nthreads = n;
-	if(d_fwdfft)
-	  d_fwdfft->set_nthreads(n);
-	if(d_invfft)
-	  d_invfft->set_nthreads(n);
+
+	if(d_nthreads > 1) {
+	  alloc_worker_ffts();
+	  d_seg_out.resize(d_nthreads * d_fftsize);
+	  for(int i = 0; i < d_nthreads; i++) {
+	    d_workers.push_back(new gr::thread::thread
+				(boost::bind(&fft_filter_ccc::pipe_worker, this, i)));
+	  }
+	}
+      }
+
+      void
+      fft_filter_ccc::alloc_worker_ffts()
+      {
+	for(size_t i = 0; i < d_seg_fwd.size(); i++) {
+	  delete d_seg_fwd[i];
+	  delete d_seg_inv[i];
+	}
+	d_seg_fwd.clear();
+	d_seg_inv.clear();
+	for(int i = 0; i < d_nthreads; i++) {
+	  d_seg_fwd.push_back(new fft::fft_complex(d_fftsize, true));
+	  d_seg_inv.push_back(new fft::fft_complex(d_fftsize, false));
+	}
+      }
+
+      void
+      fft_filter_ccc::stop_workers()
+      {
+	if(d_workers.empty())
+	  return;
+
+	{
+	  gr::thread::scoped_lock lock(d_pipe_mutex);
+	  d_pipe_exit = true;
+	  d_pipe_cond.notify_all();
+	}
+	for(size_t i = 0; i < d_workers.size(); i++) {
+	  d_workers[i]->join();
+	  delete d_workers[i];
+	}
+	d_workers.clear();
+	d_pipe_exit = false;
+      }
+
+      void
+      fft_filter_ccc::filter_segment(fft::fft_complex *fwd, fft::fft_complex *inv,
+				     const gr_complex *in, gr_complex *out)
+      {
+	memcpy(fwd->get_inbuf(), in, d_nsamples * sizeof(gr_complex));
+
+	for(int j = d_nsamples; j < d_fftsize; j++)
+	  fwd->get_inbuf()[j] = 0;
+
+	fwd->execute();
+
+	volk_32fc_x2_multiply_32fc_a(inv->get_inbuf(), fwd->get_outbuf(),
+				     d_xformed_taps, d_fftsize);
+
+	inv->execute();
+
+	memcpy(out, inv->get_outbuf(), d_fftsize * sizeof(gr_complex));
+      }
+
+      void
+      fft_filter_ccc::pipe_worker(int which)
+      {
+	unsigned long generation = 0;
+	const gr_complex *input;
+	int seg0, nsegs;
+
+	while(1) {
+	  {
+	    gr::thread::scoped_lock lock(d_pipe_mutex);
+	    while(!d_pipe_exit && (d_pipe_generation == generation))
+	      d_pipe_cond.wait(lock);
+	    if(d_pipe_exit)
+	      return;
+	    generation = d_pipe_generation;
+	    input = d_job_input;
+	    seg0 = d_job_seg0;
+	    nsegs = d_job_nsegs;
+	  }
+
+	  // One segment per worker per batch
+	  if(which < nsegs) {
+	    filter_segment(d_seg_fwd[which], d_seg_inv[which],
+			   &input[(seg0 + which) * d_nsamples],
+			   &d_seg_out[which * d_fftsize]);
+	  }
+
+	  {
+	    gr::thread::scoped_lock lock(d_pipe_mutex);
+	    if(--d_pipe_nworking == 0)
+	      d_pipe_done.notify_all();
+	  }
+	}
       }
 
       std::vector<gr_complex>
@@ -308,6 +433,60 @@ namespace gr {
 	int j = 0;
 	int ninput_items = nitems * d_decimation;
 
+	if(!d_workers.empty()) {
+	  // Pipelined path: hand each worker one segment of the
+	  // batch; the transforms and tap multiplies run in
+	  // parallel, then this thread does the serial tail
+	  // recombination in segment order.
+	  int nsegs = (ninput_items + d_nsamples - 1) / d_nsamples;
+	  int seg = 0;
+
+	  while(seg < nsegs) {
+	    int batch = (int)d_workers.size();
+	    if(batch > nsegs - seg)
+	      batch = nsegs - seg;
+
+	    {
+	      gr::thread::scoped_lock lock(d_pipe_mutex);
+	      d_job_input = input;
+	      d_job_seg0 = seg;
+	      d_job_nsegs = batch;
+	      d_pipe_nworking = (int)d_workers.size();
+	      d_pipe_generation++;
+	      d_pipe_cond.notify_all();
+	    }
+	    {
+	      gr::thread::scoped_lock lock(d_pipe_mutex);
+	      while(d_pipe_nworking != 0)
+		d_pipe_done.wait(lock);
+	    }
+
+	    for(int s = 0; s < batch; s++) {
+	      gr_complex *buf = &d_seg_out[s * d_fftsize];
+
+	      // add in the overlapping tail
+	      for(j = 0; j < tailsize(); j++)
+		buf[j] += d_tail[j];
+
+	      // copy nsamples to output
+	      j = dec_ctr;
+	      while(j < d_nsamples) {
+		*output++ = buf[j];
+		j += d_decimation;
+	      }
+	      dec_ctr = (j - d_nsamples);
+
+	      // stash the tail
+	      memcpy(&d_tail[0], buf + d_nsamples,
+		     tailsize() * sizeof(gr_complex));
+	    }
+
+	    seg += batch;
+	  }
+
+	  return nitems;
+	}
+
 	for(int i = 0; i < ninput_items; i += d_nsamples) {
 	  memcpy(d_fwdfft->get_inbuf(), &input[i], d_nsamples * sizeof(gr_complex));
 
@@ -373,6 +552,13 @@ namespace gr {
       fft_filter_ccf::set_taps(const std::vector<float> &taps)
       {
 	int i = 0;
+
+	// Identical taps leave the frequency-domain image and all of
+	// the sizes unchanged; skip the transform and keep the tail
+	// so the output stream is unbroken.
+	if(d_xformed_taps != NULL && taps == d_taps)
+	  return d_nsamples;
+
         d_taps = taps;
 	compute_sizes(taps.size());
 
@@ -29,7 +29,34 @@
 namespace gr {
   namespace filter {
     namespace kernel {
-    
+
+      // Dot products with a compile-time tap count.  The constant
+      // trip count lets the compiler fully unroll and vectorize the
+      // loop (using FMA where the build targets it) and skips volk's
+      // runtime-length dispatch; the taps come from the aligned,
+      // zero-padded replica built in set_taps.
+      template <unsigned int N>
+      static float
+      dot_fixed_fff(const float *in, const float *taps)
+      {
+	float sum = 0.0f;
+	for(unsigned int i = 0; i < N; i++)
+	  sum += in[i] * taps[i];
+	return sum;
+      }
+
+      template <unsigned int N>
+      static gr_complex
+      dot_fixed_ccf(const gr_complex *in, const float *taps)
+      {
+	float re = 0.0f, im = 0.0f;
+	for(unsigned int i = 0; i < N; i++) {
+	  re += in[i].real() * taps[i];
+	  im += in[i].imag() * taps[i];
+	}
+	return gr_complex(re, im);
+      }
+
       fir_filter_fff::fir_filter_fff(int decimation,
 				     const std::vector<float> &taps)
       {
@@ -37,12 +64,14 @@ namespace gr {
 	d_naligned = std::max((size_t)1, d_align / sizeof(float));
 
 	d_aligned_taps = NULL;
+	d_half_taps = NULL;
+	d_folded = NULL;
 	set_taps(taps);
 
 	// Make sure the output sample is always aligned, too.
 	d_output = (float*)volk_malloc(1*sizeof(float), d_align);
       }
-      
+
       fir_filter_fff::~fir_filter_fff()
       {
 	// Free all aligned taps
@@ -54,6 +83,11 @@ namespace gr {
 	  d_aligned_taps = NULL;
 	}
 
+	if(d_half_taps != NULL) {
+	  volk_free(d_half_taps);
+	  volk_free(d_folded);
+	}
+
 	// Free output sample
 	volk_free(d_output);
       }
@@ -82,6 +116,40 @@ namespace gr {
 	  for(unsigned int j = 0; j < d_ntaps; j++)
 	    d_aligned_taps[i][i+j] = d_taps[j];
 	}
+
+	// Use a fully unrolled kernel when the tap count matches one
+	// of the common power-of-two sizes
+	switch(d_ntaps) {
+	case 8:  d_dot_fixed = dot_fixed_fff<8>;  break;
+	case 16: d_dot_fixed = dot_fixed_fff<16>; break;
+	case 32: d_dot_fixed = dot_fixed_fff<32>; break;
+	case 64: d_dot_fixed = dot_fixed_fff<64>; break;
+	default: d_dot_fixed = NULL;
+	}
+
+	// Detect linear-phase designs (firdes computes the mirror
+	// taps identically, so exact comparison is safe) and fold
+	// them: pre-adding mirrored input pairs halves the dot
+	// product.
+	if(d_half_taps != NULL) {
+	  volk_free(d_half_taps);
+	  volk_free(d_folded);
+	  d_half_taps = NULL;
+	  d_folded = NULL;
+	}
+	d_symmetric = (d_ntaps >= 8);
+	for(unsigned int j = 0; j < d_ntaps/2 && d_symmetric; j++) {
+	  if(d_taps[j] != d_taps[d_ntaps-1-j])
+	    d_symmetric = false;
+	}
+	if(d_symmetric) {
+	  d_nhalf = d_ntaps/2;
+	  d_center = (d_ntaps & 1) ? d_taps[d_nhalf] : 0;
+	  d_half_taps = (float*)volk_malloc(d_nhalf*sizeof(float), d_align);
+	  for(unsigned int j = 0; j < d_nhalf; j++)
+	    d_half_taps[j] = d_taps[j];
+	  d_folded = (float*)volk_malloc(d_nhalf*sizeof(float), d_align);
+	}
       }
 
       void
@@ -91,6 +159,8 @@ namespace gr {
 	for(int i = 0; i < d_naligned; i++) {
 	  d_aligned_taps[i][i+index] = t;
 	}
+	// a single-tap change can break the symmetry
+	d_symmetric = false;
       }
 
       std::vector<float>
@@ -110,6 +180,20 @@ namespace gr {
       float
       fir_filter_fff::filter(const float input[])
       {
+	if(d_dot_fixed)
+	  return d_dot_fixed(input, d_aligned_taps[0]);
+
+	if(d_symmetric) {
+	  for(unsigned int j = 0; j < d_nhalf; j++)
+	    d_folded[j] = input[j] + input[d_ntaps-1-j];
+	  volk_32f_x2_dot_prod_32f_a(d_output, d_folded,
+				     d_half_taps, d_nhalf);
+	  float r = *d_output;
+	  if(d_ntaps & 1)
+	    r += d_center * input[d_nhalf];
+	  return r;
+	}
+
 	const float *ar = (float *)((unsigned long) input & ~(d_align-1));
 	unsigned al = input - ar;
 
@@ -151,12 +235,14 @@ namespace gr {
 	d_naligned = std::max((size_t)1, d_align / sizeof(gr_complex));
 
 	d_aligned_taps = NULL;
+	d_half_taps = NULL;
+	d_folded = NULL;
 	set_taps(taps);
 
 	// Make sure the output sample is always aligned, too.
 	d_output = (gr_complex*)volk_malloc(1*sizeof(gr_complex), d_align);
       }
-      
+
       fir_filter_ccf::~fir_filter_ccf()
       {
 	// Free all aligned taps
@@ -168,6 +254,11 @@ namespace gr {
 	  d_aligned_taps = NULL;
 	}
 
+	if(d_half_taps != NULL) {
+	  volk_free(d_half_taps);
+	  volk_free(d_folded);
+	}
+
 	// Free output sample
 	volk_free(d_output);
       }
@@ -196,8 +287,42 @@ namespace gr {
 	  for(unsigned int j = 0; j < d_ntaps; j++)
 	    d_aligned_taps[i][i+j] = d_taps[j];
 	}
+
+	// Use a fully unrolled kernel when the tap count matches one
+	// of the common power-of-two sizes
+	switch(d_ntaps) {
+	case 8:  d_dot_fixed = dot_fixed_ccf<8>;  break;
+	case 16: d_dot_fixed = dot_fixed_ccf<16>; break;
+	case 32: d_dot_fixed = dot_fixed_ccf<32>; break;
+	case 64: d_dot_fixed = dot_fixed_ccf<64>; break;
+	default: d_dot_fixed = NULL;
+	}
+
+	// Detect linear-phase designs (firdes computes the mirror
+	// taps identically, so exact comparison is safe) and fold
+	// them: pre-adding mirrored input pairs halves the dot
+	// product.
+	if(d_half_taps != NULL) {
+	  volk_free(d_half_taps);
+	  volk_free(d_folded);
+	  d_half_taps = NULL;
+	  d_folded = NULL;
+	}
+	d_symmetric = (d_ntaps >= 8);
+	for(unsigned int j = 0; j < d_ntaps/2 && d_symmetric; j++) {
+	  if(d_taps[j] != d_taps[d_ntaps-1-j])
+	    d_symmetric = false;
+	}
+	if(d_symmetric) {
+	  d_nhalf = d_ntaps/2;
+	  d_center = (d_ntaps & 1) ? d_taps[d_nhalf] : 0;
+	  d_half_taps = (float*)volk_malloc(d_nhalf*sizeof(float), d_align);
+	  for(unsigned int j = 0; j < d_nhalf; j++)
+	    d_half_taps[j] = d_taps[j];
+	  d_folded = (gr_complex*)volk_malloc(d_nhalf*sizeof(gr_complex), d_align);
+	}
       }
-      
+
       void
       fir_filter_ccf::update_tap(float t, unsigned int index)
       {
@@ -205,6 +330,8 @@ namespace gr {
 	for(int i = 0; i < d_naligned; i++) {
 	  d_aligned_taps[i][i+index] = t;
 	}
+	// a single-tap change can break the symmetry
+	d_symmetric = false;
       }
 
       std::vector<float>
@@ -224,6 +351,20 @@ namespace gr {
       gr_complex
       fir_filter_ccf::filter(const gr_complex input[])
       {
+	if(d_dot_fixed)
+	  return d_dot_fixed(input, d_aligned_taps[0]);
+
+	if(d_symmetric) {
+	  for(unsigned int j = 0; j < d_nhalf; j++)
+	    d_folded[j] = input[j] + input[d_ntaps-1-j];
+	  volk_32fc_32f_dot_prod_32fc_a(d_output, d_folded,
+					d_half_taps, d_nhalf);
+	  gr_complex r = *d_output;
+	  if(d_ntaps & 1)
+	    r += input[d_nhalf] * d_center;
+	  return r;
+	}
+
 	const gr_complex *ar = (gr_complex *)((unsigned long) input & ~(d_align-1));
 	unsigned al = input - ar;
 
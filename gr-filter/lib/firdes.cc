@@ -35,7 +35,9 @@ namespace gr {
     std::vector<float>
     firdes::window(win_type type, int ntaps, double beta)
     {
-      return fft::window::build(static_cast<fft::window::win_type>(type), ntaps, beta);
+      // served from the process-wide window cache; repeated designs
+      // and display reconfigurations stop re-evaluating the cosines
+      return fft::window::build_cached(static_cast<fft::window::win_type>(type), ntaps, beta);
     }
     
     //
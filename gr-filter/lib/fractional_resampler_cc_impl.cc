@@ -83,15 +83,11 @@ namespace gr {
       int oo = 0; // output index
 
       if(ninput_items.size() == 1) {
-        while(oo < noutput_items) {
-          out[oo++] = d_resamp->interpolate(&in[ii], d_mu);
-
-          double s = d_mu + d_mu_inc;
-          double f = floor(s);
-          int incr = (int)f;
-          d_mu = s - f;
-          ii += incr;
-        }
+        // fixed ratio: run the whole buffer through the batched
+        // resampling engine
+        double mu = d_mu;
+        ii = d_resamp->resample(out, noutput_items, in, mu, d_mu_inc);
+        d_mu = mu;
 
         consume_each(ii);
         return noutput_items;
@@ -32,10 +32,55 @@
 #include "@IMPL_NAME@.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
+#include <stdexcept>
 
 namespace gr {
   namespace filter {
-    
+
+    // The fast retune path needs a complex input stream; these
+    // helpers resolve at compile time so the non-complex versions of
+    // this block keep the composite architecture.
+    static inline bool
+    is_complex_input(const gr_complex *)
+    {
+      return true;
+    }
+
+    template <typename i_type>
+    static inline bool
+    is_complex_input(const i_type *)
+    {
+      return false;
+    }
+
+    template <typename fir_type>
+    static inline bool
+    fast_retune_filter(blocks::rotator &r, fir_type *fir,
+		       const gr_complex *in, gr_complex *out,
+		       std::vector<gr_complex> &scratch,
+		       int noutput_items, int decimation, int ninput)
+    {
+      if((int)scratch.size() < ninput)
+	scratch.resize(ninput);
+      r.rotateN(&scratch[0], in, ninput);
+
+      unsigned j = 0;
+      for(int i = 0; i < noutput_items; i++) {
+	out[i] = fir->filter(&scratch[j]);
+	j += decimation;
+      }
+      return true;
+    }
+
+    template <typename fir_type, typename i_type, typename o_type>
+    static inline bool
+    fast_retune_filter(blocks::rotator&, fir_type*,
+		       const i_type*, o_type*,
+		       std::vector<gr_complex>&, int, int, int)
+    {
+      return false;
+    }
+
     @BASE_NAME@::sptr
     @BASE_NAME@::make(int decimation,
 		      const std::vector<@TAP_TYPE@> &taps,
@@ -58,7 +103,8 @@ namespace gr {
 			decimation),
       d_proto_taps(taps), d_center_freq(center_freq),
       d_sampling_freq(sampling_freq),
-      d_updated(false)
+      d_updated(false), d_fast_retune(false),
+      d_fwT0(0), d_rot_phase(0), d_rot_index(0)
     {
       std::vector<gr_complex> dummy_taps;
       d_composite_fir = new kernel::@CFIR_TYPE@(decimation, dummy_taps);
@@ -86,6 +132,20 @@ namespace gr {
       // with -fwT0 to downshift the signal to baseband.
 
       float fwT0 = 2 * M_PI * d_center_freq / d_sampling_freq;
+      d_fwT0 = fwT0;
+
+      if(d_fast_retune) {
+	// The static FIR holds the prototype taps; the translation
+	// comes from the rotator stage ahead of it, so retuning only
+	// touches the rotator increment.
+	for(unsigned int i = 0; i < d_proto_taps.size(); i++) {
+	  ctaps[i] = d_proto_taps[i];
+	}
+	d_composite_fir->set_taps(ctaps);
+	d_r.set_phase_incr(exp(gr_complex(0, -fwT0)));
+	return;
+      }
+
       for(unsigned int i = 0; i < d_proto_taps.size(); i++) {
 	ctaps[i] = d_proto_taps[i] * exp(gr_complex(0, i * fwT0));
       }
@@ -98,7 +158,26 @@ namespace gr {
     @IMPL_NAME@::set_center_freq(double center_freq)
     {
       d_center_freq = center_freq;
-      d_updated = true;
+      if(d_fast_retune) {
+	// Only the rotator increment changes; the taps stay put and
+	// work() is never interrupted.
+	gr::thread::scoped_lock l(d_setlock);
+	d_fwT0 = 2 * M_PI * d_center_freq / d_sampling_freq;
+	d_r.set_phase_incr(exp(gr_complex(0, -d_fwT0)));
+      }
+      else {
+	d_updated = true;
+      }
+    }
+
+    void
+    @IMPL_NAME@::set_fast_retune(bool enable)
+    {
+      if(enable && !is_complex_input((const @I_TYPE@ *)0))
+	throw std::runtime_error("@BASE_NAME@: fast retune requires complex input");
+
+      d_fast_retune = enable;
+      d_updated = true;   // rebuild the taps for the new architecture
     }
 
     double
@@ -136,6 +215,24 @@ namespace gr {
 	return 0;		     // history requirements may have changed.
       }
 
+      if(d_fast_retune) {
+	gr::thread::scoped_lock l(d_setlock);
+
+	// Align the rotator phase with the absolute index of in[0],
+	// which sits history()-1 items before the first new sample;
+	// re-rotating the history each call keeps the filter input
+	// coherent across buffer boundaries and retunes.
+	int ninput = noutput_items * decimation() + history() - 1;
+	int64_t n0 = (int64_t)nitems_read(0) - (int64_t)(history() - 1);
+	d_rot_phase = fmod(d_rot_phase - d_fwT0 * (double)(n0 - d_rot_index), 2*M_PI);
+	d_rot_index = n0;
+	d_r.set_phase(exp(gr_complex(0, d_rot_phase)));
+
+	if(fast_retune_filter(d_r, d_composite_fir, in, out, d_rotbuf,
+			      noutput_items, decimation(), ninput))
+	  return noutput_items;
+      }
+
       unsigned j = 0;
       for (int i = 0; i < noutput_items; i++){
         out[i] = d_r.rotate(d_composite_fir->filter(&in[j]));
@@ -32,6 +32,7 @@
 #include <gnuradio/filter/fir_filter.h>
 #include <gnuradio/filter/@BASE_NAME@.h>
 #include <gnuradio/blocks/rotator.h>
+#include <stdint.h>
 
 namespace gr {
   namespace filter {
@@ -45,7 +46,16 @@ namespace gr {
       double			d_center_freq;
       double			d_sampling_freq;
       bool			d_updated;
-      
+
+      // Fast retune architecture: rotator stage ahead of a static
+      // FIR holding the prototype taps.  The rotator phase is
+      // re-aligned each call from the absolute input position.
+      bool			d_fast_retune;
+      double			d_fwT0;
+      double			d_rot_phase;
+      int64_t			d_rot_index;
+      std::vector<gr_complex>	d_rotbuf;
+
       virtual void build_composite_fir();
     public:
 
@@ -58,6 +68,8 @@ namespace gr {
       void set_center_freq(double center_freq);
       double center_freq() const;
 
+      void set_fast_retune(bool enable);
+
       void set_taps(const std::vector<@TAP_TYPE@> &taps);
       std::vector<@TAP_TYPE@> taps() const;
 
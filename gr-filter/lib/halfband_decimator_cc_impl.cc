@@ -0,0 +1,140 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "halfband_decimator_cc_impl.h"
+#include <gnuradio/io_signature.h>
+#include <stdexcept>
+#include <cmath>
+
+namespace gr {
+  namespace filter {
+
+    halfband_decimator_cc::sptr
+    halfband_decimator_cc::make(const std::vector<float> &taps)
+    {
+      return gnuradio::get_initial_sptr
+        (new halfband_decimator_cc_impl(taps));
+    }
+
+    halfband_decimator_cc_impl::halfband_decimator_cc_impl(
+        const std::vector<float> &taps)
+      : sync_decimator("halfband_decimator_cc",
+                       io_signature::make(1, 1, sizeof(gr_complex)),
+                       io_signature::make(1, 1, sizeof(gr_complex)),
+                       2),
+        d_updated(false)
+    {
+      fold_taps(taps);
+      set_history(d_ntaps);
+    }
+
+    halfband_decimator_cc_impl::~halfband_decimator_cc_impl()
+    {
+    }
+
+    void
+    halfband_decimator_cc_impl::fold_taps(const std::vector<float> &taps)
+    {
+      if(taps.size() < 3 || (taps.size() % 2) == 0) {
+        throw std::invalid_argument(
+          "halfband_decimator_cc: taps must have odd length >= 3");
+      }
+
+      int ntaps = (int)taps.size();
+      int mid = (ntaps - 1) / 2;
+
+      float mag = 0;
+      for(int j = 0; j < ntaps; j++) {
+        mag = std::max(mag, (float)::fabs(taps[j]));
+      }
+
+      std::vector<float> coef;
+      std::vector<int> off_lo, off_hi;
+      for(int j = 0; j < mid; j++) {
+        if(::fabs(taps[j] - taps[ntaps-1-j]) > 1e-5*mag) {
+          throw std::invalid_argument(
+            "halfband_decimator_cc: taps are not symmetric");
+        }
+        if(::fabs(taps[j]) > 0) {
+          coef.push_back(taps[j]);
+          off_lo.push_back(j);
+          off_hi.push_back(ntaps - 1 - j);
+        }
+      }
+
+      d_taps = taps;
+      d_coef = coef;
+      d_off_lo = off_lo;
+      d_off_hi = off_hi;
+      d_center = taps[mid];
+      d_center_off = mid;
+      d_ntaps = ntaps;
+    }
+
+    void
+    halfband_decimator_cc_impl::set_taps(const std::vector<float> &taps)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      fold_taps(taps);
+      d_updated = true;
+    }
+
+    int
+    halfband_decimator_cc_impl::work(int noutput_items,
+                                     gr_vector_const_void_star &input_items,
+                                     gr_vector_void_star &output_items)
+    {
+      const gr_complex *in = (const gr_complex*)input_items[0];
+      gr_complex *out = (gr_complex*)output_items[0];
+
+      gr::thread::scoped_lock lock(d_mutex);
+
+      if(d_updated) {
+        set_history(d_ntaps);
+        d_updated = false;
+        return 0;    // history changed; redo the I/O alignment
+      }
+
+      int npairs = (int)d_coef.size();
+      const float *coef = npairs ? &d_coef[0] : NULL;
+      const int *lo = npairs ? &d_off_lo[0] : NULL;
+      const int *hi = npairs ? &d_off_hi[0] : NULL;
+
+      for(int n = 0; n < noutput_items; n++) {
+        const gr_complex *ip = &in[2*n];
+        // fold each symmetric pair into one add, then multiply once
+        gr_complex acc = ip[d_center_off] * d_center;
+        for(int k = 0; k < npairs; k++) {
+          acc += (ip[lo[k]] + ip[hi[k]]) * coef[k];
+        }
+        out[n] = acc;
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace filter */
+} /* namespace gr */
@@ -0,0 +1,67 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FILTER_HALFBAND_DECIMATOR_CC_IMPL_H
+#define INCLUDED_FILTER_HALFBAND_DECIMATOR_CC_IMPL_H
+
+#include <gnuradio/filter/halfband_decimator_cc.h>
+#include <gnuradio/thread/thread.h>
+#include <gnuradio/gr_complex.h>
+#include <vector>
+
+namespace gr {
+  namespace filter {
+
+    class halfband_decimator_cc_impl : public halfband_decimator_cc
+    {
+    private:
+      std::vector<float> d_taps;        // full vector, as given
+      // folded kernel: coefficient per symmetric pair plus the two
+      // offsets it reads, and the lone center tap
+      std::vector<float> d_coef;
+      std::vector<int> d_off_lo;
+      std::vector<int> d_off_hi;
+      float d_center;
+      int d_center_off;
+      int d_ntaps;
+      bool d_updated;
+      gr::thread::mutex d_mutex;
+
+      void fold_taps(const std::vector<float> &taps);
+
+    public:
+      halfband_decimator_cc_impl(const std::vector<float> &taps);
+      ~halfband_decimator_cc_impl();
+
+      void set_taps(const std::vector<float> &taps);
+      std::vector<float> taps() const { return d_taps; }
+      unsigned int nmults() const { return (unsigned int)d_coef.size() + 1; }
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace filter */
+} /* namespace gr */
+
+#endif /* INCLUDED_FILTER_HALFBAND_DECIMATOR_CC_IMPL_H */
@@ -48,7 +48,7 @@ namespace gr {
 			   io_signature::make(1, 1, sizeof(@I_TYPE@)),
 			   io_signature::make(1, 1, sizeof(@O_TYPE@)),
 			   interpolation),
-      d_updated(false), d_firs(interpolation)
+      d_updated(false), d_taps(NULL), d_ntaps(0)
     {
       if(interpolation == 0) {
 	throw std::out_of_range("@IMPL_NAME@: interpolation must be > 0\n");
@@ -58,20 +58,14 @@ namespace gr {
 	throw std::runtime_error("@IMPL_NAME@: no filter taps provided.\n");
       }
 
-      std::vector<@TAP_TYPE@> dummy_taps;
-
-      for(unsigned i = 0; i < interpolation; i++) {
-	d_firs[i] = new kernel::@FIR_TYPE@(1, dummy_taps);
-      }
-
       set_taps(taps);
       install_taps(d_new_taps);
     }
 
     @IMPL_NAME@::~@IMPL_NAME@()
     {
-      for(unsigned i = 0; i < interpolation(); i++) {
-	delete d_firs[i];
+      if(d_taps) {
+	volk_free(d_taps);
       }
     }
 
@@ -98,24 +92,24 @@ namespace gr {
     void
     @IMPL_NAME@::install_taps(const std::vector<@TAP_TYPE@> &taps)
     {
-      unsigned nfilters = interpolation();
-      int nt = taps.size() / nfilters;
-
-      std::vector< std::vector <@TAP_TYPE@> > xtaps(nfilters);
-
-      for(unsigned n = 0; n < nfilters; n++) {
-	xtaps[n].resize (nt);
-      }
+      // keep an aligned flat copy in natural order; the scatter kernel
+      // reads it contiguously, one span per input sample
+      unsigned int ntaps = taps.size();
 
-      for(size_t i = 0; i < taps.size(); i++) {
-	xtaps[i % nfilters][i / nfilters] = taps[i];
+      if(ntaps != d_ntaps) {
+	if(d_taps) {
+	  volk_free(d_taps);
+	}
+	d_taps = (@TAP_TYPE@*)volk_malloc(ntaps * sizeof(@TAP_TYPE@),
+					  volk_get_alignment());
+	d_ntaps = ntaps;
       }
 
-      for(unsigned n = 0; n < nfilters; n++) {
-	d_firs[n]->set_taps (xtaps[n]);
+      for(unsigned int i = 0; i < ntaps; i++) {
+	d_taps[i] = taps[i];
       }
 
-      set_history(nt);
+      set_history(ntaps / interpolation());
       d_updated = false;
     }
 
@@ -138,15 +132,8 @@ namespace gr {
 	return 0;	     // history requirements may have changed.
       }
 
-      int nfilters = interpolation();
-      int ni = noutput_items / interpolation();
-
-      for(int i = 0; i < ni; i++) {
-	for(int nf = 0; nf < nfilters; nf++) {
-	  out[nf] = d_firs[nf]->filter(&in[i]);
-	}
-	out += nfilters;
-      }
+      kernel::interp_fir_scatter(out, in, d_taps, noutput_items,
+				 interpolation(), d_ntaps, d_scratch);
 
       return noutput_items;
     }
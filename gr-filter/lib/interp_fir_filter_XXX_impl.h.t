@@ -26,8 +26,8 @@
 #define	@GUARD_NAME@
 
 #include <gnuradio/filter/api.h>
-#include <gnuradio/filter/fir_filter.h>
 #include <gnuradio/filter/@BASE_NAME@.h>
+#include "interp_fir_scatter.h"
 #include <vector>
 
 namespace gr {
@@ -37,8 +37,10 @@ namespace gr {
     {
     private:
       bool d_updated;
-      std::vector<kernel::@FIR_TYPE@ *> d_firs;
       std::vector<@TAP_TYPE@> d_new_taps;
+      @TAP_TYPE@ *d_taps;	// flat padded taps, volk-aligned
+      unsigned int d_ntaps;
+      kernel::interp_fir_scatter_scratch d_scratch;
 
       void install_taps(const std::vector<@TAP_TYPE@> &taps);
 
@@ -0,0 +1,234 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "interp_fir_scatter.h"
+#include <volk/volk.h>
+#include <cstring>
+
+namespace gr {
+  namespace filter {
+    namespace kernel {
+
+      interp_fir_scatter_scratch::interp_fir_scatter_scratch()
+	: d_buf(0), d_len(0)
+      {
+      }
+
+      interp_fir_scatter_scratch::~interp_fir_scatter_scratch()
+      {
+	if(d_buf)
+	  volk_free(d_buf);
+      }
+
+      void *
+      interp_fir_scatter_scratch::get(size_t nbytes)
+      {
+	if(nbytes > d_len) {
+	  if(d_buf)
+	    volk_free(d_buf);
+	  d_buf = volk_malloc(nbytes, volk_get_alignment());
+	  d_len = nbytes;
+	}
+	return d_buf;
+      }
+
+      /*
+       * Each overload runs the same scatter loop; only the per-sample
+       * scaled-tap product differs.  For input sample in[m] the
+       * contribution span starts at (m+1)*interp - ntaps in the output
+       * and is clipped to [0, nout); the interior spans cover the full
+       * tap vector, so all interp phases are updated at once.
+       */
+
+      void
+      interp_fir_scatter(float *out, const float *in,
+			 const float *taps,
+			 int nout, unsigned int interp,
+			 unsigned int ntaps,
+			 interp_fir_scatter_scratch &scratch)
+      {
+	float *tmp = (float*)scratch.get(ntaps * sizeof(float));
+	int nin = nout / (int)interp + (int)(ntaps / interp) - 1;
+
+	memset(out, 0, nout * sizeof(float));
+
+	for(int m = 0; m < nin; m++) {
+	  int base = (m + 1) * (int)interp - (int)ntaps;
+	  int lo = (base < 0) ? -base : 0;
+	  int hi = (nout - base < (int)ntaps) ? nout - base : (int)ntaps;
+	  if(hi <= lo)
+	    continue;
+	  volk_32f_s32f_multiply_32f(tmp, taps + lo, in[m], hi - lo);
+	  volk_32f_x2_add_32f(out + base + lo, out + base + lo,
+			      tmp, hi - lo);
+	}
+      }
+
+      void
+      interp_fir_scatter(gr_complex *out, const gr_complex *in,
+			 const gr_complex *taps,
+			 int nout, unsigned int interp,
+			 unsigned int ntaps,
+			 interp_fir_scatter_scratch &scratch)
+      {
+	gr_complex *tmp = (gr_complex*)scratch.get(ntaps * sizeof(gr_complex));
+	int nin = nout / (int)interp + (int)(ntaps / interp) - 1;
+
+	memset(out, 0, nout * sizeof(gr_complex));
+
+	for(int m = 0; m < nin; m++) {
+	  int base = (m + 1) * (int)interp - (int)ntaps;
+	  int lo = (base < 0) ? -base : 0;
+	  int hi = (nout - base < (int)ntaps) ? nout - base : (int)ntaps;
+	  if(hi <= lo)
+	    continue;
+	  volk_32fc_s32fc_multiply_32fc(tmp, taps + lo, in[m], hi - lo);
+	  volk_32f_x2_add_32f((float*)(out + base + lo),
+			      (const float*)(out + base + lo),
+			      (const float*)tmp, 2 * (hi - lo));
+	}
+      }
+
+      void
+      interp_fir_scatter(gr_complex *out, const gr_complex *in,
+			 const float *taps,
+			 int nout, unsigned int interp,
+			 unsigned int ntaps,
+			 interp_fir_scatter_scratch &scratch)
+      {
+	// promote the real taps once per call; multiplying the complex
+	// sample by (tap + 0j) scales the real and imaginary parts
+	gr_complex *ctaps = (gr_complex*)scratch.get(2 * ntaps * sizeof(gr_complex));
+	gr_complex *tmp = ctaps + ntaps;
+	int nin = nout / (int)interp + (int)(ntaps / interp) - 1;
+
+	for(unsigned int t = 0; t < ntaps; t++)
+	  ctaps[t] = gr_complex(taps[t], 0);
+
+	memset(out, 0, nout * sizeof(gr_complex));
+
+	for(int m = 0; m < nin; m++) {
+	  int base = (m + 1) * (int)interp - (int)ntaps;
+	  int lo = (base < 0) ? -base : 0;
+	  int hi = (nout - base < (int)ntaps) ? nout - base : (int)ntaps;
+	  if(hi <= lo)
+	    continue;
+	  volk_32fc_s32fc_multiply_32fc(tmp, ctaps + lo, in[m], hi - lo);
+	  volk_32f_x2_add_32f((float*)(out + base + lo),
+			      (const float*)(out + base + lo),
+			      (const float*)tmp, 2 * (hi - lo));
+	}
+      }
+
+      void
+      interp_fir_scatter(gr_complex *out, const float *in,
+			 const gr_complex *taps,
+			 int nout, unsigned int interp,
+			 unsigned int ntaps,
+			 interp_fir_scatter_scratch &scratch)
+      {
+	// real sample times complex taps; scale the interleaved tap
+	// floats directly
+	gr_complex *tmp = (gr_complex*)scratch.get(ntaps * sizeof(gr_complex));
+	int nin = nout / (int)interp + (int)(ntaps / interp) - 1;
+
+	memset(out, 0, nout * sizeof(gr_complex));
+
+	for(int m = 0; m < nin; m++) {
+	  int base = (m + 1) * (int)interp - (int)ntaps;
+	  int lo = (base < 0) ? -base : 0;
+	  int hi = (nout - base < (int)ntaps) ? nout - base : (int)ntaps;
+	  if(hi <= lo)
+	    continue;
+	  volk_32f_s32f_multiply_32f((float*)tmp,
+				     (const float*)(taps + lo),
+				     in[m], 2 * (hi - lo));
+	  volk_32f_x2_add_32f((float*)(out + base + lo),
+			      (const float*)(out + base + lo),
+			      (const float*)tmp, 2 * (hi - lo));
+	}
+      }
+
+      void
+      interp_fir_scatter(gr_complex *out, const short *in,
+			 const gr_complex *taps,
+			 int nout, unsigned int interp,
+			 unsigned int ntaps,
+			 interp_fir_scatter_scratch &scratch)
+      {
+	gr_complex *tmp = (gr_complex*)scratch.get(ntaps * sizeof(gr_complex));
+	int nin = nout / (int)interp + (int)(ntaps / interp) - 1;
+
+	memset(out, 0, nout * sizeof(gr_complex));
+
+	for(int m = 0; m < nin; m++) {
+	  int base = (m + 1) * (int)interp - (int)ntaps;
+	  int lo = (base < 0) ? -base : 0;
+	  int hi = (nout - base < (int)ntaps) ? nout - base : (int)ntaps;
+	  if(hi <= lo)
+	    continue;
+	  volk_32f_s32f_multiply_32f((float*)tmp,
+				     (const float*)(taps + lo),
+				     (float)in[m], 2 * (hi - lo));
+	  volk_32f_x2_add_32f((float*)(out + base + lo),
+			      (const float*)(out + base + lo),
+			      (const float*)tmp, 2 * (hi - lo));
+	}
+      }
+
+      void
+      interp_fir_scatter(short *out, const float *in,
+			 const float *taps,
+			 int nout, unsigned int interp,
+			 unsigned int ntaps,
+			 interp_fir_scatter_scratch &scratch)
+      {
+	// accumulate in floats and convert once, matching the float
+	// accumulator inside volk_32f_x2_dot_prod_16i
+	float *acc = (float*)scratch.get((nout + ntaps) * sizeof(float));
+	float *tmp = acc + nout;
+	int nin = nout / (int)interp + (int)(ntaps / interp) - 1;
+
+	memset(acc, 0, nout * sizeof(float));
+
+	for(int m = 0; m < nin; m++) {
+	  int base = (m + 1) * (int)interp - (int)ntaps;
+	  int lo = (base < 0) ? -base : 0;
+	  int hi = (nout - base < (int)ntaps) ? nout - base : (int)ntaps;
+	  if(hi <= lo)
+	    continue;
+	  volk_32f_s32f_multiply_32f(tmp, taps + lo, in[m], hi - lo);
+	  volk_32f_x2_add_32f(acc + base + lo, acc + base + lo,
+			      tmp, hi - lo);
+	}
+
+	for(int j = 0; j < nout; j++)
+	  out[j] = (short)acc[j];
+      }
+
+    } /* namespace kernel */
+  } /* namespace filter */
+} /* namespace gr */
@@ -0,0 +1,112 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FILTER_INTERP_FIR_SCATTER_H
+#define INCLUDED_FILTER_INTERP_FIR_SCATTER_H
+
+#include <gnuradio/gr_complex.h>
+#include <cstddef>
+
+namespace gr {
+  namespace filter {
+    namespace kernel {
+
+      /*!
+       * \brief Reusable volk-aligned workspace for interp_fir_scatter().
+       *
+       * The scatter kernels need a per-sample product buffer (and, for
+       * the short-output variant, a float accumulator).  The buffer is
+       * grown on demand and kept across calls so that work() never
+       * allocates.
+       */
+      class interp_fir_scatter_scratch
+      {
+      public:
+	interp_fir_scatter_scratch();
+	~interp_fir_scatter_scratch();
+
+	//! Return a volk-aligned buffer of at least \p nbytes.
+	void *get(size_t nbytes);
+
+      private:
+	void *d_buf;
+	size_t d_len;
+      };
+
+      /*!
+       * \brief Transposed-form polyphase interpolating filter pass.
+       *
+       * Computes \p nout output items at \p interp times the input
+       * rate.  Rather than evaluating each output phase with its own
+       * short dot product over a strided tap bank, each input sample
+       * is scattered into the output: in[m] adds taps[t] * in[m] to
+       * out[(m + 1)*interp - ntaps + t] for t over the whole flat tap
+       * vector, so every phase is updated with one contiguous
+       * multiply/accumulate span per input sample.
+       *
+       * \p taps is the full tap vector in natural order, zero-padded
+       * to a multiple of \p interp.  \p in must provide
+       * ntaps/interp - 1 items of history in front of the
+       * nout/interp new items; this is the same convention as the
+       * direct form running with set_history(ntaps/interp).
+       */
+      void interp_fir_scatter(float *out, const float *in,
+			      const float *taps,
+			      int nout, unsigned int interp,
+			      unsigned int ntaps,
+			      interp_fir_scatter_scratch &scratch);
+
+      void interp_fir_scatter(gr_complex *out, const gr_complex *in,
+			      const gr_complex *taps,
+			      int nout, unsigned int interp,
+			      unsigned int ntaps,
+			      interp_fir_scatter_scratch &scratch);
+
+      void interp_fir_scatter(gr_complex *out, const gr_complex *in,
+			      const float *taps,
+			      int nout, unsigned int interp,
+			      unsigned int ntaps,
+			      interp_fir_scatter_scratch &scratch);
+
+      void interp_fir_scatter(gr_complex *out, const float *in,
+			      const gr_complex *taps,
+			      int nout, unsigned int interp,
+			      unsigned int ntaps,
+			      interp_fir_scatter_scratch &scratch);
+
+      void interp_fir_scatter(gr_complex *out, const short *in,
+			      const gr_complex *taps,
+			      int nout, unsigned int interp,
+			      unsigned int ntaps,
+			      interp_fir_scatter_scratch &scratch);
+
+      void interp_fir_scatter(short *out, const float *in,
+			      const float *taps,
+			      int nout, unsigned int interp,
+			      unsigned int ntaps,
+			      interp_fir_scatter_scratch &scratch);
+
+    } /* namespace kernel */
+  } /* namespace filter */
+} /* namespace gr */
+
+#endif /* INCLUDED_FILTER_INTERP_FIR_SCATTER_H */
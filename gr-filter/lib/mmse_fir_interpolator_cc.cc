@@ -39,6 +39,16 @@ namespace gr {
 	std::vector<float> t (&taps[i][0], &taps[i][NTAPS]);
 	filters[i] = new kernel::fir_filter_ccf(1, t);
       }
+
+      // one contiguous row per phase step, so resample() can index a
+      // tap row without chasing the per-filter pointers; rows are
+      // reversed to match the fir_filter kernel's convolution order
+      d_flat_taps.resize((NSTEPS + 1) * NTAPS);
+      for(int i = 0; i < NSTEPS + 1; i++) {
+	for(int j = 0; j < NTAPS; j++) {
+	  d_flat_taps[i*NTAPS + j] = taps[i][NTAPS - 1 - j];
+	}
+      }
     }
 
     mmse_fir_interpolator_cc::~mmse_fir_interpolator_cc()
@@ -73,5 +83,40 @@ namespace gr {
       return r;
     }
 
+    int
+    mmse_fir_interpolator_cc::resample(gr_complex *output, int noutput,
+				       const gr_complex *input,
+				       double &mu, double mu_inc) const
+    {
+      if((mu < 0) || (mu > 1)) {
+	throw std::runtime_error("mmse_fir_interpolator_cc: mu out of bounds.\n");
+      }
+
+      // The whole filter is only NTAPS (8) wide, so a straight-line
+      // complex-by-real MAC on the flat tap row beats a per-sample
+      // trip through the fir_filter kernel; the compiler keeps the
+      // unrolled loop in SIMD registers.
+      int ii = 0;
+      for(int oo = 0; oo < noutput; oo++) {
+	int imu = (int)rint(mu * NSTEPS);
+	const float *t = &d_flat_taps[imu * NTAPS];
+	const gr_complex *ip = &input[ii];
+
+	float re = 0, im = 0;
+	for(int k = 0; k < NTAPS; k++) {
+	  re += ip[k].real() * t[k];
+	  im += ip[k].imag() * t[k];
+	}
+	output[oo] = gr_complex(re, im);
+
+	double s = mu + mu_inc;
+	double f = floor(s);
+	ii += (int)f;
+	mu = s - f;
+      }
+
+      return ii;
+    }
+
   }  /* namespace filter */
 }  /* namespace gr */
@@ -0,0 +1,158 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "multistage_resampler_ccf_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/filter/fir_filter_ccf.h>
+#include <gnuradio/filter/interp_fir_filter_ccf.h>
+#include <gnuradio/filter/pfb_arb_resampler_ccf.h>
+#include <stdexcept>
+#include <cmath>
+
+namespace gr {
+  namespace filter {
+
+    // number of arms in the arbitrary-resampler filterbank
+    static const unsigned int ARB_FLT_SIZE = 32;
+
+    multistage_resampler_ccf::sptr
+    multistage_resampler_ccf::make(double rate,
+                                   double attenuation_dB,
+                                   double passband_frac)
+    {
+      return gnuradio::get_initial_sptr
+        (new multistage_resampler_ccf_impl(rate, attenuation_dB,
+                                           passband_frac));
+    }
+
+    multistage_resampler_ccf_impl::multistage_resampler_ccf_impl(
+        double rate, double attenuation_dB, double passband_frac)
+      : hier_block2("multistage_resampler_ccf",
+                    io_signature::make(1, 1, sizeof(gr_complex)),
+                    io_signature::make(1, 1, sizeof(gr_complex))),
+        d_rate(rate), d_total_taps(0)
+    {
+      if(rate <= 0)
+        throw std::out_of_range("multistage_resampler_ccf: rate must be > 0");
+      if(passband_frac <= 0 || passband_frac >= 1)
+        throw std::out_of_range("multistage_resampler_ccf: passband_frac must be in (0, 1)");
+
+      if(rate < 1) {
+        // Decimation: by-2 stages first, residual arbitrary
+        // resampler last, running at the lowest rate.  All
+        // frequencies below are in units of the block input rate.
+        const double Fout = rate;
+        const double Fc = passband_frac * Fout / 2;  // final passband edge
+
+        double Fi = 1.0;   // current stage input rate
+        while(Fi / 2 >= Fout * (1 - 1e-12)) {
+          // after decimating to Fi/2, anything above Fi/2 - Fc
+          // aliases onto the passband; everything between is free
+          // transition band
+          std::vector<float> t =
+            design_stage(1.0, Fi, Fc, Fi/2 - 2*Fc, attenuation_dB);
+          d_stages.push_back(fir_filter_ccf::make(2, t));
+          Fi /= 2;
+        }
+
+        double residual = Fout / Fi;   // in (0.5, 1]
+        if(::fabs(residual - 1.0) > 1e-9) {
+          double fc = Fc / Fi;
+          std::vector<float> t =
+            design_stage(ARB_FLT_SIZE, ARB_FLT_SIZE,
+                         fc, residual - 2*fc, attenuation_dB);
+          d_stages.push_back(
+            pfb_arb_resampler_ccf::make(residual, t, ARB_FLT_SIZE));
+        }
+      }
+      else {
+        // Interpolation: residual arbitrary resampler first (at the
+        // lowest rate), then interp-by-2 stages.  Frequencies in
+        // units of the block input rate; the signal occupies
+        // [0, Fc] throughout.
+        const double Fc = passband_frac * 0.5;
+
+        int nhalf = 0;
+        double residual = rate;
+        while(residual >= 2 * (1 - 1e-12)) {
+          residual /= 2;
+          nhalf++;
+        }
+
+        if(::fabs(residual - 1.0) > 1e-9) {
+          std::vector<float> t =
+            design_stage(ARB_FLT_SIZE, ARB_FLT_SIZE,
+                         Fc, 1.0 - 2*Fc, attenuation_dB);
+          d_stages.push_back(
+            pfb_arb_resampler_ccf::make(residual, t, ARB_FLT_SIZE));
+        }
+
+        double Fi = residual;   // current stage input rate
+        for(int i = 0; i < nhalf; i++) {
+          // interpolating to 2*Fi leaves an image centered at Fi;
+          // it only has to be pushed below Fi - Fc
+          std::vector<float> t =
+            design_stage(2.0, 2*Fi, Fc, Fi - 2*Fc, attenuation_dB);
+          d_stages.push_back(interp_fir_filter_ccf::make(2, t));
+          Fi *= 2;
+        }
+      }
+
+      if(d_stages.empty()) {
+        // unity rate: single-tap filter keeps the hierarchy valid
+        std::vector<float> t(1, 1.0f);
+        d_stages.push_back(fir_filter_ccf::make(1, t));
+        d_total_taps += 1;
+      }
+
+      connect(self(), 0, d_stages.front(), 0);
+      for(size_t i = 1; i < d_stages.size(); i++) {
+        connect(d_stages[i-1], 0, d_stages[i], 0);
+      }
+      connect(d_stages.back(), 0, self(), 0);
+    }
+
+    multistage_resampler_ccf_impl::~multistage_resampler_ccf_impl()
+    {
+    }
+
+    std::vector<float>
+    multistage_resampler_ccf_impl::design_stage(double gain,
+                                                double sampling_freq,
+                                                double cutoff,
+                                                double transition,
+                                                double attenuation_dB)
+    {
+      std::vector<float> t =
+        firdes::low_pass_2(gain, sampling_freq, cutoff, transition,
+                           attenuation_dB);
+      d_total_taps += t.size();
+      return t;
+    }
+
+  } /* namespace filter */
+} /* namespace gr */
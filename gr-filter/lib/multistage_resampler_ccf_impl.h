@@ -0,0 +1,58 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FILTER_MULTISTAGE_RESAMPLER_CCF_IMPL_H
+#define INCLUDED_FILTER_MULTISTAGE_RESAMPLER_CCF_IMPL_H
+
+#include <gnuradio/filter/multistage_resampler_ccf.h>
+#include <vector>
+
+namespace gr {
+  namespace filter {
+
+    class FILTER_API multistage_resampler_ccf_impl : public multistage_resampler_ccf
+    {
+    private:
+      double d_rate;
+      unsigned int d_total_taps;
+      std::vector<basic_block_sptr> d_stages;
+
+      //! Design one anti-alias/anti-image filter with firdes::low_pass_2
+      std::vector<float> design_stage(double gain, double sampling_freq,
+                                      double cutoff, double transition,
+                                      double attenuation_dB);
+
+    public:
+      multistage_resampler_ccf_impl(double rate,
+                                    double attenuation_dB,
+                                    double passband_frac);
+      ~multistage_resampler_ccf_impl();
+
+      double rate() const { return d_rate; }
+      unsigned int num_stages() const { return (unsigned int)d_stages.size(); }
+      unsigned int total_taps() const { return d_total_taps; }
+    };
+
+  } /* namespace filter */
+} /* namespace gr */
+
+#endif /* INCLUDED_FILTER_MULTISTAGE_RESAMPLER_CCF_IMPL_H */
@@ -26,7 +26,9 @@
 
 #include "pfb_channelizer_ccf_impl.h"
 #include <gnuradio/io_signature.h>
+#include <boost/bind.hpp>
 #include <stdio.h>
+#include <string.h>
 
 namespace gr {
   namespace filter {
@@ -91,6 +93,10 @@ namespace gr {
 	d_output_multiple++;
       set_output_multiple(d_output_multiple);
 
+      // Staging buffers for the worker-pool path
+      d_stage[0].resize(d_nfilts);
+      d_stage[1].resize(d_nfilts);
+
       // Use set_taps to also set the history requirement
       set_taps(taps);
     }
@@ -122,6 +128,37 @@ namespace gr {
       return polyphase_filterbank::taps();
     }
 
+    void
+    pfb_channelizer_ccf_impl::set_nthreads(int nthreads)
+    {
+      gr::thread::scoped_lock guard(d_mutex);
+
+      polyphase_filterbank::set_nthreads(nthreads);
+    }
+
+    int
+    pfb_channelizer_ccf_impl::nthreads() const
+    {
+      return polyphase_filterbank::nthreads();
+    }
+
+    void
+    pfb_channelizer_ccf_impl::filter_arm_range(gr_vector_const_void_star *input_items,
+					       gr_complex *dst, int last, int n,
+					       unsigned int lo, unsigned int hi)
+    {
+      // Same arm/offset mapping as the sequential loops in
+      // general_work, but indexed directly by j so any slice of
+      // [0, d_nfilts) can run on its own thread.
+      for(unsigned int j = lo; j < hi; j++) {
+	const gr_complex *in = (const gr_complex*)(*input_items)[j];
+	if((int)j <= last)
+	  dst[d_idxlut[j]] = d_fir_filters[last - j]->filter(&in[n]);
+	else
+	  dst[d_idxlut[j]] = d_fir_filters[d_nfilts - (j - last)]->filter(&in[n-1]);
+      }
+    }
+
     void
     pfb_channelizer_ccf_impl::set_channel_map(const std::vector<int> &map)
     {
@@ -174,6 +211,55 @@ namespace gr {
 
       int n=1, i=-1, j=0, oo=0, last;
       int toconsume = (int)rintf(noutput_items/d_oversample_rate);
+
+      if(nthreads() > 1) {
+	// Worker-pool path: the pool filters one round's arms into a
+	// staging buffer while this thread despins the previous
+	// round through the FFT.
+	int cur = 0;
+	bool pending = false;
+
+	while(n <= toconsume) {
+	  i = (i + d_rate_ratio) % d_nfilts;
+	  last = i;
+	  start_arm_job(boost::bind(&pfb_channelizer_ccf_impl::filter_arm_range,
+				    this, &input_items, &d_stage[cur][0],
+				    last, n, _1, _2));
+	  n += (last + d_rate_ratio) >= (int)d_nfilts;
+
+	  if(pending) {
+	    memcpy(d_fft->get_inbuf(), &d_stage[cur ^ 1][0],
+		   d_nfilts*sizeof(gr_complex));
+	    d_fft->execute();
+
+	    for(unsigned int nn = 0; nn < noutputs; nn++) {
+	      out = (gr_complex*)output_items[nn];
+	      out[oo] = d_fft->get_outbuf()[d_channel_map[nn]];
+	    }
+	    oo++;
+	  }
+
+	  wait_arm_job();
+	  cur ^= 1;
+	  pending = true;
+	}
+
+	if(pending) {
+	  memcpy(d_fft->get_inbuf(), &d_stage[cur ^ 1][0],
+		 d_nfilts*sizeof(gr_complex));
+	  d_fft->execute();
+
+	  for(unsigned int nn = 0; nn < noutputs; nn++) {
+	    out = (gr_complex*)output_items[nn];
+	    out[oo] = d_fft->get_outbuf()[d_channel_map[nn]];
+	  }
+	  oo++;
+	}
+
+	consume_each(toconsume);
+	return noutput_items;
+      }
+
       while(n <= toconsume) {
 	j = 0;
 	i = (i + d_rate_ratio) % d_nfilts;
@@ -43,6 +43,16 @@ namespace gr {
       std::vector<int> d_channel_map;
       gr::thread::mutex     d_mutex; // mutex to protect set/work access
 
+      // Double-buffered staging for the worker-pool path: while the
+      // pool filters one round's arms, the block's thread runs the
+      // FFT of the previous round.
+      std::vector<gr_complex> d_stage[2];
+
+      //! Filter arms [lo, hi) of one round into \p dst; pool job
+      void filter_arm_range(gr_vector_const_void_star *input_items,
+			    gr_complex *dst, int last, int n,
+			    unsigned int lo, unsigned int hi);
+
     public:
       pfb_channelizer_ccf_impl(unsigned int nfilts,
 			       const std::vector<float> &taps,
@@ -54,6 +64,9 @@ namespace gr {
       void print_taps();
       std::vector<std::vector<float> > taps() const;
 
+      void set_nthreads(int nthreads);
+      int nthreads() const;
+
       void set_channel_map(const std::vector<int> &map);
       std::vector<int> channel_map() const;
 
@@ -25,6 +25,7 @@
 #endif
 
 #include <gnuradio/filter/polyphase_filterbank.h>
+#include <boost/bind.hpp>
 #include <cstdio>
 
 namespace gr {
@@ -34,7 +35,8 @@ namespace gr {
       polyphase_filterbank::polyphase_filterbank(unsigned int nfilts,
 						 const std::vector<float> &taps,
                                                  bool fft_forward)
-	: d_nfilts(nfilts)
+	: d_nfilts(nfilts), d_nthreads(1),
+	  d_pool_generation(0), d_pool_nworking(0), d_pool_exit(false)
     {
       d_fir_filters = std::vector<kernel::fir_filter_ccf*>(d_nfilts);
       d_fft_filters = std::vector<kernel::fft_filter_ccf*>(d_nfilts);
@@ -55,6 +57,7 @@ namespace gr {
 
     polyphase_filterbank::~polyphase_filterbank()
     {
+      stop_pool();
       delete d_fft;
       for(unsigned int i = 0; i < d_nfilts; i++) {
         delete d_fir_filters[i];
@@ -112,6 +115,100 @@ namespace gr {
       return d_taps;
     }
 
+    void
+    polyphase_filterbank::set_nthreads(int nthreads)
+    {
+      if(nthreads < 1)
+	nthreads = 1;
+      if(nthreads == d_nthreads)
+	return;
+
+      stop_pool();
+      d_nthreads = nthreads;
+
+      if(nthreads > 1) {
+	d_pool_exit = false;
+	d_pool_generation = 0;
+	d_pool_nworking = 0;
+	for(int i = 0; i < nthreads; i++) {
+	  d_threads.push_back(new gr::thread::thread
+	    (boost::bind(&polyphase_filterbank::pool_worker, this, i)));
+	}
+      }
+    }
+
+    void
+    polyphase_filterbank::stop_pool()
+    {
+      if(d_threads.empty())
+	return;
+
+      {
+	gr::thread::scoped_lock lock(d_pool_mutex);
+	d_pool_exit = true;
+	d_pool_cond.notify_all();
+      }
+      for(size_t i = 0; i < d_threads.size(); i++) {
+	d_threads[i]->join();
+	delete d_threads[i];
+      }
+      d_threads.clear();
+    }
+
+    void
+    polyphase_filterbank::pool_worker(int which)
+    {
+      unsigned long my_generation = 0;
+      gr::thread::scoped_lock lock(d_pool_mutex);
+
+      while(1) {
+	while(d_pool_generation == my_generation && !d_pool_exit)
+	  d_pool_cond.wait(lock);
+	if(d_pool_exit)
+	  return;
+
+	my_generation = d_pool_generation;
+	boost::function<void(unsigned int, unsigned int)> job = d_job;
+	unsigned int nworkers = (unsigned int)d_threads.size();
+
+	lock.unlock();
+	unsigned int lo = (unsigned int)(((unsigned long long)which * d_nfilts) / nworkers);
+	unsigned int hi = (unsigned int)(((unsigned long long)(which + 1) * d_nfilts) / nworkers);
+	if(lo < hi)
+	  job(lo, hi);
+	lock.lock();
+
+	if(--d_pool_nworking == 0)
+	  d_pool_done.notify_all();
+      }
+    }
+
+    void
+    polyphase_filterbank::start_arm_job(const boost::function<void(unsigned int, unsigned int)> &job)
+    {
+      if(d_threads.empty()) {
+	job(0, d_nfilts);
+	return;
+      }
+
+      gr::thread::scoped_lock lock(d_pool_mutex);
+      d_job = job;
+      d_pool_nworking = (int)d_threads.size();
+      d_pool_generation++;
+      d_pool_cond.notify_all();
+    }
+
+    void
+    polyphase_filterbank::wait_arm_job()
+    {
+      if(d_threads.empty())
+	return;
+
+      gr::thread::scoped_lock lock(d_pool_mutex);
+      while(d_pool_nworking != 0)
+	d_pool_done.wait(lock);
+    }
+
     } /* namespace kernel */
   } /* namespace filter */
 } /* namespace gr */
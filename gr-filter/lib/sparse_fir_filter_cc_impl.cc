@@ -0,0 +1,135 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "sparse_fir_filter_cc_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+namespace gr {
+  namespace filter {
+
+    sparse_fir_filter_cc::sptr
+    sparse_fir_filter_cc::make(const std::vector<int> &delays,
+                               const std::vector<gr_complex> &taps)
+    {
+      return gnuradio::get_initial_sptr
+        (new sparse_fir_filter_cc_impl(delays, taps));
+    }
+
+    sparse_fir_filter_cc_impl::sparse_fir_filter_cc_impl(
+        const std::vector<int> &delays,
+        const std::vector<gr_complex> &taps)
+      : sync_block("sparse_fir_filter_cc",
+                      io_signature::make(1, 1, sizeof(gr_complex)),
+                      io_signature::make(1, 1, sizeof(gr_complex))),
+        d_updated(false)
+    {
+      check_taps(delays, taps);
+      d_delays = delays;
+      d_taps = taps;
+      d_max_delay = *std::max_element(delays.begin(), delays.end());
+      set_history(d_max_delay + 1);
+    }
+
+    sparse_fir_filter_cc_impl::~sparse_fir_filter_cc_impl()
+    {
+    }
+
+    void
+    sparse_fir_filter_cc_impl::check_taps(const std::vector<int> &delays,
+                                          const std::vector<gr_complex> &taps)
+    {
+      if(delays.empty() || delays.size() != taps.size()) {
+        throw std::invalid_argument(
+          "sparse_fir_filter_cc: need matching, non-empty delay and tap vectors");
+      }
+      for(size_t i = 0; i < delays.size(); i++) {
+        if(delays[i] < 0) {
+          throw std::invalid_argument(
+            "sparse_fir_filter_cc: delays must be non-negative");
+        }
+      }
+    }
+
+    void
+    sparse_fir_filter_cc_impl::set_taps(const std::vector<int> &delays,
+                                        const std::vector<gr_complex> &taps)
+    {
+      check_taps(delays, taps);
+      gr::thread::scoped_lock lock(d_mutex);
+      d_delays = delays;
+      d_taps = taps;
+      d_max_delay = *std::max_element(delays.begin(), delays.end());
+      d_updated = true;
+    }
+
+    int
+    sparse_fir_filter_cc_impl::work(int noutput_items,
+                                    gr_vector_const_void_star &input_items,
+                                    gr_vector_void_star &output_items)
+    {
+      const gr_complex *in = (const gr_complex*)input_items[0];
+      gr_complex *out = (gr_complex*)output_items[0];
+
+      gr::thread::scoped_lock lock(d_mutex);
+
+      if(d_updated) {
+        set_history(d_max_delay + 1);
+        d_updated = false;
+        return 0;    // history changed; redo the I/O alignment
+      }
+
+      // in[i + d_max_delay] is the newest sample for output i, so tap
+      // k reads from a span starting at d_max_delay - d_delays[k].
+      // One multiply (plus one accumulate after the first tap) pass
+      // over the whole block per tap.
+      if((int)d_scratch.size() < noutput_items) {
+        d_scratch.resize(noutput_items);
+      }
+
+      for(size_t k = 0; k < d_taps.size(); k++) {
+        const gr_complex *src = in + (d_max_delay - d_delays[k]);
+        if(k == 0) {
+          volk_32fc_s32fc_multiply_32fc(out, src, d_taps[k],
+                                        noutput_items);
+        }
+        else {
+          volk_32fc_s32fc_multiply_32fc(&d_scratch[0], src, d_taps[k],
+                                        noutput_items);
+          volk_32f_x2_add_32f((float*)out, (const float*)out,
+                              (const float*)&d_scratch[0],
+                              2 * noutput_items);
+        }
+      }
+
+      return noutput_items;
+    }
+
+  } /* namespace filter */
+} /* namespace gr */
@@ -0,0 +1,65 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_FILTER_SPARSE_FIR_FILTER_CC_IMPL_H
+#define INCLUDED_FILTER_SPARSE_FIR_FILTER_CC_IMPL_H
+
+#include <gnuradio/filter/sparse_fir_filter_cc.h>
+#include <gnuradio/thread/thread.h>
+#include <gnuradio/gr_complex.h>
+#include <vector>
+
+namespace gr {
+  namespace filter {
+
+    class sparse_fir_filter_cc_impl : public sparse_fir_filter_cc
+    {
+    private:
+      std::vector<int> d_delays;
+      std::vector<gr_complex> d_taps;
+      int d_max_delay;
+      bool d_updated;
+      std::vector<gr_complex> d_scratch;  // per-tap product buffer
+      gr::thread::mutex d_mutex;
+
+      void check_taps(const std::vector<int> &delays,
+                      const std::vector<gr_complex> &taps);
+
+    public:
+      sparse_fir_filter_cc_impl(const std::vector<int> &delays,
+                                const std::vector<gr_complex> &taps);
+      ~sparse_fir_filter_cc_impl();
+
+      void set_taps(const std::vector<int> &delays,
+                    const std::vector<gr_complex> &taps);
+      std::vector<int> delays() const { return d_delays; }
+      std::vector<gr_complex> taps() const { return d_taps; }
+
+      int work(int noutput_items,
+               gr_vector_const_void_star &input_items,
+               gr_vector_void_star &output_items);
+    };
+
+  } /* namespace filter */
+} /* namespace gr */
+
+#endif /* INCLUDED_FILTER_SPARSE_FIR_FILTER_CC_IMPL_H */
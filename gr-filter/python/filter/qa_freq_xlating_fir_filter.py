@@ -298,6 +298,25 @@ class test_freq_xlating_filter(gr_unittest.TestCase):
         result_data = dst.data()
         self.assertComplexTuplesAlmostEqual(expected_data, result_data, 4)
 
+    def test_fir_filter_ccf_fast_retune(self):
+        # The rotator-ahead-of-static-FIR architecture must produce
+        # the same output as the composite taps.
+        self.generate_ccf_source()
+
+        decim = 4
+        lo = sig_source_c(self.fs, -self.fc, 1, len(self.src_data))
+        despun = mix(lo, self.src_data)
+        expected_data = fir_filter(despun, self.taps, decim)
+
+        src = blocks.vector_source_c(self.src_data)
+        op  = filter.freq_xlating_fir_filter_ccf(decim, self.taps, self.fc, self.fs)
+        op.set_fast_retune(True)
+        dst = blocks.vector_sink_c()
+        self.tb.connect(src, op, dst)
+        self.tb.run()
+        result_data = dst.data()
+        self.assertComplexTuplesAlmostEqual(expected_data, result_data, 4)
+
 if __name__ == '__main__':
     gr_unittest.run(test_freq_xlating_filter, "test_freq_xlating_filter.xml")
 
@@ -52,6 +52,7 @@
 #include "gnuradio/filter/freq_xlating_fir_filter_fcf.h"
 #include "gnuradio/filter/freq_xlating_fir_filter_scf.h"
 #include "gnuradio/filter/freq_xlating_fir_filter_scc.h"
+#include "gnuradio/filter/halfband_decimator_cc.h"
 #include "gnuradio/filter/hilbert_fc.h"
 #include "gnuradio/filter/iir_filter_ffd.h"
 #include "gnuradio/filter/interp_fir_filter_ccc.h"
@@ -60,6 +61,7 @@
 #include "gnuradio/filter/interp_fir_filter_fff.h"
 #include "gnuradio/filter/interp_fir_filter_fsf.h"
 #include "gnuradio/filter/interp_fir_filter_scc.h"
+#include "gnuradio/filter/multistage_resampler_ccf.h"
 #include "gnuradio/filter/pfb_arb_resampler_ccf.h"
 #include "gnuradio/filter/pfb_arb_resampler_ccc.h"
 #include "gnuradio/filter/pfb_arb_resampler_fff.h"
@@ -74,6 +76,7 @@
 #include "gnuradio/filter/rational_resampler_base_fsf.h"
 #include "gnuradio/filter/rational_resampler_base_scc.h"
 #include "gnuradio/filter/single_pole_iir_filter_cc.h"
+#include "gnuradio/filter/sparse_fir_filter_cc.h"
 #include "gnuradio/filter/single_pole_iir_filter_ff.h"
 %}
 
@@ -101,6 +104,7 @@
 %include "gnuradio/filter/freq_xlating_fir_filter_fcf.h"
 %include "gnuradio/filter/freq_xlating_fir_filter_scf.h"
 %include "gnuradio/filter/freq_xlating_fir_filter_scc.h"
+%include "gnuradio/filter/halfband_decimator_cc.h"
 %include "gnuradio/filter/hilbert_fc.h"
 %include "gnuradio/filter/iir_filter_ffd.h"
 %include "gnuradio/filter/interp_fir_filter_ccc.h"
@@ -109,6 +113,7 @@
 %include "gnuradio/filter/interp_fir_filter_fff.h"
 %include "gnuradio/filter/interp_fir_filter_fsf.h"
 %include "gnuradio/filter/interp_fir_filter_scc.h"
+%include "gnuradio/filter/multistage_resampler_ccf.h"
 %include "gnuradio/filter/pfb_arb_resampler_ccf.h"
 %include "gnuradio/filter/pfb_arb_resampler_ccc.h"
 %include "gnuradio/filter/pfb_arb_resampler_fff.h"
@@ -123,6 +128,7 @@
 %include "gnuradio/filter/rational_resampler_base_fsf.h"
 %include "gnuradio/filter/rational_resampler_base_scc.h"
 %include "gnuradio/filter/single_pole_iir_filter_cc.h"
+%include "gnuradio/filter/sparse_fir_filter_cc.h"
 %include "gnuradio/filter/single_pole_iir_filter_ff.h"
 
 GR_SWIG_BLOCK_MAGIC2(filter, dc_blocker_cc);
@@ -147,6 +153,7 @@ GR_SWIG_BLOCK_MAGIC2(filter, freq_xlating_fir_filter_fcc);
 GR_SWIG_BLOCK_MAGIC2(filter, freq_xlating_fir_filter_fcf);
 GR_SWIG_BLOCK_MAGIC2(filter, freq_xlating_fir_filter_scf);
 GR_SWIG_BLOCK_MAGIC2(filter, freq_xlating_fir_filter_scc);
+GR_SWIG_BLOCK_MAGIC2(filter, halfband_decimator_cc);
 GR_SWIG_BLOCK_MAGIC2(filter, hilbert_fc);
 GR_SWIG_BLOCK_MAGIC2(filter, iir_filter_ffd);
 GR_SWIG_BLOCK_MAGIC2(filter, interp_fir_filter_ccc);
@@ -155,6 +162,7 @@ GR_SWIG_BLOCK_MAGIC2(filter, interp_fir_filter_fcc);
 GR_SWIG_BLOCK_MAGIC2(filter, interp_fir_filter_fff);
 GR_SWIG_BLOCK_MAGIC2(filter, interp_fir_filter_fsf);
 GR_SWIG_BLOCK_MAGIC2(filter, interp_fir_filter_scc);
+GR_SWIG_BLOCK_MAGIC2(filter, multistage_resampler_ccf);
 GR_SWIG_BLOCK_MAGIC2(filter, pfb_arb_resampler_ccf);
 GR_SWIG_BLOCK_MAGIC2(filter, pfb_arb_resampler_ccc);
 GR_SWIG_BLOCK_MAGIC2(filter, pfb_arb_resampler_fff);
@@ -169,4 +177,5 @@ GR_SWIG_BLOCK_MAGIC2(filter, rational_resampler_base_fff);
 GR_SWIG_BLOCK_MAGIC2(filter, rational_resampler_base_fsf);
 GR_SWIG_BLOCK_MAGIC2(filter, rational_resampler_base_scc);
 GR_SWIG_BLOCK_MAGIC2(filter, single_pole_iir_filter_cc);
+GR_SWIG_BLOCK_MAGIC2(filter, sparse_fir_filter_cc);
 GR_SWIG_BLOCK_MAGIC2(filter, single_pole_iir_filter_ff);
@@ -0,0 +1,63 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_NOAA_BIT_CORRELATOR_H
+#define INCLUDED_NOAA_BIT_CORRELATOR_H
+
+namespace gr {
+  namespace noaa {
+
+    /*!
+     * \brief Shift-register correlator for bit-serial sync patterns.
+     *
+     * Bits are shifted in MSB first and compared against a fixed
+     * pattern under a mask, so sync words up to 64 bits long can be
+     * hunted with a single compare per input bit.
+     */
+    class bit_correlator
+    {
+    private:
+      unsigned long long d_shifter;
+      unsigned long long d_pattern;
+      unsigned long long d_mask;
+
+    public:
+      bit_correlator(unsigned long long pattern, unsigned long long mask)
+	: d_shifter(0), d_pattern(pattern), d_mask(mask)
+      {
+      }
+
+      //! Shift in one bit and test for a pattern match.
+      bool update(unsigned char bit)
+      {
+	d_shifter = (d_shifter << 1) | bit;
+	return (d_shifter & d_mask) == d_pattern;
+      }
+
+      //! Forget any bits collected so far.
+      void reset() { d_shifter = 0; }
+    };
+
+  } /* namespace noaa */
+} /* namespace gr */
+
+#endif /* INCLUDED_NOAA_BIT_CORRELATOR_H */
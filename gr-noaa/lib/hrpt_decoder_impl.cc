@@ -96,35 +96,48 @@ namespace gr {
 
       int i = 0;
       while(i < noutput_items) {
-	d_current_word = in[i++] & 0x3FF;
-	d_word_num++;
+	if(d_word_num >= 12) {
+	  // The words past the timestamp carry no header fields, so
+	  // hop to the end of the minor frame in one step instead of
+	  // walking the switch below for every word
+	  int span = HRPT_MINOR_FRAME_WORDS - d_word_num;
+	  if(span > noutput_items - i)
+	    span = noutput_items - i;
+	  i += span;
+	  d_word_num += span;
+	  d_current_word = in[i-1] & 0x3FF;
+	}
+	else {
+	  d_current_word = in[i++] & 0x3FF;
+	  d_word_num++;
 
-	// Per HRPT word processing here
+	  // Per HRPT word processing here
 
-	switch(d_word_num) {
-	case 7:
-	  process_mfnum();
-	  process_address();
-	  break;
+	  switch(d_word_num) {
+	  case 7:
+	    process_mfnum();
+	    process_address();
+	    break;
 
-	case 9:
-	  process_day_of_year();
-	  break;
+	  case 9:
+	    process_day_of_year();
+	    break;
 
-	case 10:
-	  process_milli1();
-	  break;
+	  case 10:
+	    process_milli1();
+	    break;
 
-	case 11:
-	  process_milli2();
-	  break;
+	  case 11:
+	    process_milli2();
+	    break;
 
-	case 12:
-	  process_milli3();
-	  break;
+	  case 12:
+	    process_milli3();
+	    break;
 
-	default:
-	  break;
+	  default:
+	    break;
+	  }
 	}
 
 	if(d_word_num == HRPT_MINOR_FRAME_WORDS) {
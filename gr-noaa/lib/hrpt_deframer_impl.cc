@@ -46,7 +46,8 @@ namespace gr {
     hrpt_deframer_impl::hrpt_deframer_impl()
       : block("noaa_hrpt_deframer",
 		 io_signature::make(1, 1, sizeof(char)),
-		 io_signature::make(1, 1, sizeof(short)))
+		 io_signature::make(1, 1, sizeof(short))),
+	d_sync(HRPT_MINOR_FRAME_SYNC, 0x0FFFFFFFFFFFFFFFULL)
     {
       set_output_multiple(6); // room for writing full sync when received
       d_mid_bit = true;
@@ -85,17 +86,15 @@ namespace gr {
 
       int i = 0, j = 0;
       while(i < ninputs && j < noutput_items) {
-	char bit = in[i++];
-	char diff = bit^d_last_bit;
-	d_last_bit = bit;
-
-	// Wait for transition if not synced, otherwise, alternate bits
-	if(d_mid_bit && (diff | (d_state == ST_SYNCED))) {
-	  switch(d_state) {
-	  case ST_IDLE:
-	    d_shifter = (d_shifter << 1) | bit; // MSB transmitted first
-
-	    if((d_shifter & 0x0FFFFFFFFFFFFFFFLL) == HRPT_MINOR_FRAME_SYNC) {
+	if(d_state == ST_IDLE) {
+	  char bit = in[i++];
+	  char diff = bit^d_last_bit;
+	  d_last_bit = bit;
+
+	  // Wait for a transition to find the mid-bit phase, then
+	  // correlate against the minor frame sync pattern
+	  if(d_mid_bit && diff) {
+	    if(d_sync.update(bit)) { // MSB transmitted first
 	      out[j++] = HRPT_SYNC1;
 	      out[j++] = HRPT_SYNC2;
 	      out[j++] = HRPT_SYNC3;
@@ -104,28 +103,59 @@ namespace gr {
 	      out[j++] = HRPT_SYNC6;
 	      enter_synced();
 	    }
-	    break;
-
-	  case ST_SYNCED:
-	    d_word = (d_word << 1) | bit; // MSB transmitted first
-	    if(--d_bit_count == 0) {
-	      out[j++] = d_word;
-	      d_word = 0;
-	      d_bit_count = HRPT_BITS_PER_WORD;
+
+	    d_mid_bit = false;
+	  }
+	  else {
+	    d_mid_bit = true;
+	  }
+	}
+	else { // ST_SYNCED
+	  if(!d_mid_bit) {
+	    // Skip the half-bit sample before the next data bit
+	    d_last_bit = in[i++];
+	    d_mid_bit = true;
+	    continue;
+	  }
+
+	  // Once the phase is known the data bits ride on every other
+	  // sample, so shift whole words in a tight loop instead of
+	  // revisiting the state machine per sample
+	  int nbits = (ninputs - i + 1)/2;
+	  unsigned short word = d_word;
+	  unsigned int bit_count = d_bit_count;
+	  while(nbits > 0 && j < noutput_items) {
+	    int take = ((unsigned int)nbits < bit_count) ? nbits : (int)bit_count;
+	    nbits -= take;
+	    bit_count -= take;
+	    while(take-- > 0) {
+	      word = (word << 1) | in[i]; // MSB transmitted first
+	      i += 2;
+	    }
+
+	    if(bit_count == 0) {
+	      out[j++] = word;
+	      word = 0;
+	      bit_count = HRPT_BITS_PER_WORD;
 	      if(--d_word_count == 0) {
 		enter_idle();
+		break;
 	      }
 	    }
-	    break;
-
-	  default:
-	    throw std::runtime_error("hrpt_deframer_impl: bad state\n");
 	  }
-
-	  d_mid_bit = false;
-	}
-	else {
-	  d_mid_bit = true;
+	  d_word = word;
+	  d_bit_count = bit_count;
+
+	  // The loop above steps two samples past each data bit; the
+	  // trailing half-bit sample may not have arrived yet
+	  if(i > ninputs) {
+	    i = ninputs;
+	    d_mid_bit = false;
+	  }
+	  else {
+	    d_mid_bit = true;
+	  }
+	  d_last_bit = in[i-1];
 	}
       }
 
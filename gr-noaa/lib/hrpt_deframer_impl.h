@@ -24,6 +24,7 @@
 #define INCLUDED_NOAA_HRPT_DEFRAMER_IMPL_H
 
 #include <gnuradio/noaa/hrpt_deframer.h>
+#include "bit_correlator.h"
 
 namespace gr {
   namespace noaa {
@@ -36,7 +37,7 @@ namespace gr {
       unsigned char      d_last_bit;
       unsigned int       d_bit_count;
       unsigned int       d_word_count;
-      unsigned long long d_shifter;     // 60 bit sync word
+      bit_correlator     d_sync;        // 60 bit sync word
       unsigned short     d_word;        // 10 bit HRPT word
 
       void enter_idle();
@@ -29,6 +29,7 @@
 #include "bch3221.h"
 #include "util.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/blocks/bit_correlator.h>
 #include <gnuradio/blocks/count_bits.h>
 #include <cstdio>
 
@@ -123,6 +124,82 @@ namespace gr {
       return false;
     }
 
+    int
+    flex_sync_impl::idle_scan(const unsigned char *in, int nsamples)
+    {
+      // Word-parallel version of test_sync()'s marker check for the
+      // idle state. Each trial synchronizer owns every d_spb'th
+      // symbol; its sliced bits are packed into 64-bit words so the
+      // register at every alignment is a double shift of (previous
+      // register, packed word) and each check is one xor+popcount in
+      // a tight loop instead of a trip through the per-sample state
+      // machine. Returns how many symbols were consumed, stopping
+      // just before the first marker candidate so the regular path
+      // takes over there and checks it against the full mode table.
+
+      int stop = nsamples;
+      int base = (d_index + 1) % d_spb;
+
+      for(int p = 0; p < d_spb; p++) {
+        // first symbol of this batch belonging to trial synchronizer p
+        int t0 = p - base;
+        if(t0 < 0)
+          t0 += d_spb;
+
+        uint64_t reg = (uint64_t)d_sync[p];
+        bool hit = false;
+
+        for(int t = t0; t < stop && !hit; ) {
+          uint64_t packed = 0;
+          int nb = 0;
+          while(t < stop && nb < 64) {
+            packed = (packed << 1) | (in[t] < 2);
+            nb++;
+            t += d_spb;
+          }
+          uint64_t batch = packed << (64 - nb);
+
+          for(int k = 1; k <= nb; k++) {
+            uint64_t w = gr::blocks::bit_correlator::window(reg, batch, k);
+            int32_t marker = (w & 0x0000FFFFFFFF0000ULL) >> 16;
+            if(gr::blocks::count_bits32(marker^FLEX_SYNC_MARKER) < 4) {
+              int cand = t - nb*d_spb + (k - 1)*d_spb;
+              if(cand < stop)
+                stop = cand;
+              hit = true;
+              break;
+            }
+          }
+
+          if(!hit)
+            reg = gr::blocks::bit_correlator::window(reg, batch, nb);
+        }
+      }
+
+      // advance every trial register over the symbols actually consumed
+      for(int p = 0; p < d_spb; p++) {
+        int t0 = p - base;
+        if(t0 < 0)
+          t0 += d_spb;
+
+        uint64_t reg = (uint64_t)d_sync[p];
+        for(int t = t0; t < stop; ) {
+          uint64_t packed = 0;
+          int nb = 0;
+          while(t < stop && nb < 64) {
+            packed = (packed << 1) | (in[t] < 2);
+            nb++;
+            t += d_spb;
+          }
+          reg = gr::blocks::bit_correlator::window(reg, packed << (64 - nb), nb);
+        }
+        d_sync[p] = (int64_t)reg;
+      }
+
+      d_index = (d_index + stop) % d_spb;
+      return stop;
+    }
+
     void
     flex_sync_impl::enter_idle()
     {
@@ -295,6 +372,18 @@ namespace gr {
       int ninputs = ninput_items[0];
 
       while(i < ninputs && j < noutput_items) {
+	// Burn through idle input with the word-parallel scan; it
+	// leaves the trial synchronizers positioned just before the
+	// first sync candidate, which the state machine below then
+	// examines symbol by symbol.
+	if(d_state == ST_IDLE) {
+	  int skipped = idle_scan(in, ninputs - i);
+	  in += skipped;
+	  i += skipped;
+	  if(i >= ninputs)
+	    break;
+	}
+
         unsigned char sym = *in++; i++;
 	d_index = (d_index+1) % d_spb;
 
@@ -40,6 +40,7 @@ namespace gr {
 
       int index_avg(int start, int end);
       bool test_sync(unsigned char sym);
+      int idle_scan(const unsigned char *in, int nsamples);
       void parse_fiw();
       int output_symbol(unsigned char sym);
 
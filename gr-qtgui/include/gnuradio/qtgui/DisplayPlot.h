@@ -119,6 +119,9 @@ public:
 
   virtual void replot() = 0;
 
+  //! Ask the central DisplayScheduler to replot this plot on the next frame.
+  void queueReplot();
+
   const QColor getLineColor1 () const;
   const QColor getLineColor2 () const;
   const QColor getLineColor3 () const;
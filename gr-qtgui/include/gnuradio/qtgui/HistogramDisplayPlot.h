@@ -43,6 +43,9 @@ public:
   void plotNewData(const std::vector<double*> dataPoints,
 		   const int64_t numDataPoints, const double timeInterval);
 
+  void plotNewBinData(const std::vector<double*> bins,
+		      const int64_t numBins);
+
   void replot();
 
 public slots:
@@ -75,6 +75,9 @@ public:
   float getPowerValue();
   void setPowerValue(const float);
 
+  float getFFTAverage();
+  void setFFTAverage(const float);
+
   int getWindowType();
   void setWindowType(const int);
 
@@ -114,6 +117,7 @@ private:
   double _startFrequency;
   double _stopFrequency;
   float _powerValue;
+  float _fftAverage;
   bool _windowOpennedFlag;
   int _windowType;
   int64_t _lastDataPointCount;
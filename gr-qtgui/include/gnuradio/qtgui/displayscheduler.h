@@ -0,0 +1,70 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_QTGUI_DISPLAYSCHEDULER_H
+#define INCLUDED_QTGUI_DISPLAYSCHEDULER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+#include <QtCore/QTimer>
+
+class DisplayPlot;
+
+/*!
+ * \brief Coalesces replots from all display plots into one batch per frame.
+ * \ingroup qtgui_blk
+ *
+ * Every sink used to replot as soon as its update event arrived, so a
+ * console full of displays repainted at thirty independent rates and
+ * the event loop spent most of its time in paint handlers. Plots now
+ * queue themselves here when they receive new data; a single timer
+ * fires once per frame (nominally 60 Hz) and replots everything
+ * queued since the previous frame. A plot whose data did not change
+ * never queues, so it is skipped for free.
+ *
+ * The timer only runs while replots are pending, and all calls must
+ * come from the GUI thread (the plots already require this).
+ */
+class DisplayScheduler : public QObject
+{
+  Q_OBJECT
+
+public:
+  static DisplayScheduler* instance();
+
+  //! Replot \p plot on the next frame; duplicate requests coalesce.
+  void queueReplot(DisplayPlot *plot);
+
+  //! Forget a pending replot; called when a plot is destroyed.
+  void cancel(DisplayPlot *plot);
+
+private slots:
+  void frame();
+
+private:
+  DisplayScheduler();
+
+  QTimer d_timer;
+  QList<DisplayPlot*> d_pending;
+};
+
+#endif /* INCLUDED_QTGUI_DISPLAYSCHEDULER_H */
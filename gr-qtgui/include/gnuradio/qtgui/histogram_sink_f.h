@@ -60,6 +60,16 @@ namespace gr {
      * accumulates the data between calls to work. When accumulate is
      * activated, the y-axis autoscaling is turned on by default as
      * the values will quickly grow in the this direction.
+     *
+     * For high-rate streams, enable_incremental turns on incremental
+     * binning: every sample seen by work is counted into a set of
+     * per-input bin accumulators in the block itself, and only the
+     * bin counts are posted to the GUI. This counts all samples
+     * instead of just the snapshot displayed per update, at a cost
+     * independent of the update rate. set_decay_rate sets a factor
+     * applied to the accumulated bins at each GUI update; 1.0 (the
+     * default) accumulates forever, while values below 1.0 give an
+     * exponentially-weighted history.
      */
     class QTGUI_API histogram_sink_f : virtual public sync_block
     {
@@ -110,6 +120,8 @@ namespace gr {
       virtual void enable_semilogx(bool en=true) = 0;
       virtual void enable_semilogy(bool en=true) = 0;
       virtual void enable_accumulate(bool en=true) = 0;
+      virtual void enable_incremental(bool en=true) = 0;
+      virtual void set_decay_rate(const double r) = 0;
       virtual void autoscalex() = 0;
       virtual int nsamps() const = 0;
       virtual int bins() const = 0;
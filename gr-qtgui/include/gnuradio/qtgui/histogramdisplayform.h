@@ -62,6 +62,7 @@ public slots:
 
 private slots:
   void newData(const QEvent*);
+  void newBinData(const QEvent*);
 
 private:
   QIntValidator* d_int_validator;
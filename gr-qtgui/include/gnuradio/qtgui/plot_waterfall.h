@@ -83,6 +83,8 @@ protected:
 #endif
 
 private:
+    void updateRasterCache() const;
+
     class PrivateData;
     PrivateData *d_data;
 };
@@ -31,11 +31,13 @@
 #include <gnuradio/high_res_timer.h>
 #include <gnuradio/qtgui/api.h>
 #include <gnuradio/tags.h>
+#include <boost/shared_ptr.hpp>
 
 static const int SpectrumUpdateEventType = 10005;
 static const int SpectrumWindowCaptionEventType = 10008;
 static const int SpectrumWindowResetEventType = 10009;
 static const int SpectrumFrequencyRangeEventType = 10010;
+static const int HistogramBinsEventType = 10011;
 
 class SpectrumUpdateEvent:public QEvent{
 
@@ -119,6 +121,20 @@ private:
 };
 
 
+/*!
+ * \brief Interface for handing display buffers back to their owner.
+ *
+ * An update event built on recycled buffers notifies the recycler on
+ * destruction instead of freeing, so a block can post updates from a
+ * fixed set of snapshot buffers without per-update allocation.
+ */
+class buffer_recycler
+{
+public:
+  virtual ~buffer_recycler() {}
+  virtual void recycle(int slot) = 0;
+};
+
 class TimeUpdateEvent: public QEvent
 {
 public:
@@ -126,6 +142,14 @@ public:
 		  const uint64_t numTimeDomainDataPoints,
                   const std::vector< std::vector<gr::tag_t> > tags);
 
+  //! As above, but reference \p timeDomainPoints directly instead of
+  //! copying; destruction recycles \p slot instead of freeing
+  TimeUpdateEvent(const std::vector<double*> timeDomainPoints,
+		  const uint64_t numTimeDomainDataPoints,
+                  const std::vector< std::vector<gr::tag_t> > tags,
+                  boost::shared_ptr<buffer_recycler> recycler,
+                  int slot);
+
   ~TimeUpdateEvent();
 
   int which() const;
@@ -145,6 +169,8 @@ private:
   std::vector<double*> _dataTimeDomainPoints;
   uint64_t _numTimeDomainDataPoints;
   std::vector< std::vector<gr::tag_t> > _tags;
+  boost::shared_ptr<buffer_recycler> _recycler;
+  int _slot;
 };
 
 
@@ -298,6 +324,32 @@ private:
 /********************************************************************/
 
 
+class HistogramBinsEvent: public QEvent
+{
+public:
+  HistogramBinsEvent(const std::vector<double*> bins,
+                     const uint64_t nbins);
+
+  ~HistogramBinsEvent();
+
+  const std::vector<double*> getBins() const;
+  uint64_t getNumBins() const;
+
+  static QEvent::Type Type()
+  { return QEvent::Type(HistogramBinsEventType); }
+
+protected:
+
+private:
+  size_t _nplots;
+  std::vector<double*> _bins;
+  uint64_t _nbins;
+};
+
+
+/********************************************************************/
+
+
 class NumberUpdateEvent: public QEvent
 {
 public:
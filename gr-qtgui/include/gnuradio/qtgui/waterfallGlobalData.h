@@ -54,6 +54,10 @@ public:
   virtual uint64_t getNumFFTPoints()const;
   virtual void addFFTData(const double*, const uint64_t, const int);
 
+  //! Total lines scrolled into the display; advances by the history
+  //! length on reset/rewrite so render caches repaint in full
+  virtual uint64_t getLinesAppended()const;
+
   virtual double* getSpectrumDataBuffer()const;
   virtual void setSpectrumDataBuffer(const double*);
 
@@ -67,6 +71,7 @@ protected:
   uint64_t _fftPoints;
   uint64_t _historyLength;
   int _numLinesToUpdate;
+  uint64_t _linesAppended;
 
 #if QWT_VERSION < 0x060000
   QwtDoubleInterval _intensityRange;
@@ -101,6 +101,15 @@ namespace gr {
 				       const double max) = 0;
 
       virtual void set_update_time(double t) = 0;
+
+      /*!
+       * Set the policy for FFT frames that fall between display
+       * updates: 0 drops them untransformed (the default), 1 averages
+       * them into the next displayed frame with the FFT average
+       * setting, and 2 max-holds them into the next displayed frame.
+       */
+      virtual void set_frame_hold(int mode) = 0;
+      virtual int frame_hold() const = 0;
       virtual void set_title(const std::string &title) = 0;
       virtual void set_line_label(int which, const std::string &line) = 0;
       virtual void set_line_alpha(int which, double alpha) = 0;
@@ -228,7 +228,7 @@ ConstellationDisplayPlot::plotNewData(const std::vector<double*> realDataPoints,
 	_autoScale(bottom, top);
       }      
 
-      replot();
+      queueReplot();
 
     }
   }
@@ -21,6 +21,7 @@
  */
 
 #include <gnuradio/qtgui/DisplayPlot.h>
+#include <gnuradio/qtgui/displayscheduler.h>
 
 #include <qwt_scale_draw.h>
 #include <qwt_legend.h>
@@ -99,9 +100,17 @@ DisplayPlot::DisplayPlot(int nplots, QWidget* parent)
 
 DisplayPlot::~DisplayPlot()
 {
+  DisplayScheduler::instance()->cancel(this);
+
   // d_zoomer and d_panner deleted when parent deleted
 }
 
+void
+DisplayPlot::queueReplot()
+{
+  DisplayScheduler::instance()->queueReplot(this);
+}
+
 
 void
 DisplayPlot::setYaxis(double min, double max)
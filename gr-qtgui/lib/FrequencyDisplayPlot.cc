@@ -397,7 +397,7 @@ FrequencyDisplayPlot::plotNewData(const std::vector<double*> dataPoints,
       
       setUpperIntensityLevel(d_peak_amplitude);
 
-      replot();
+      queueReplot();
     }
   }
 }
@@ -253,7 +253,36 @@ HistogramDisplayPlot::plotNewData(const std::vector<double*> dataPoints,
       if(d_autoscale_state)
         _autoScaleY(0, height);
 
-      replot();
+      queueReplot();
+    }
+  }
+}
+
+void
+HistogramDisplayPlot::plotNewBinData(const std::vector<double*> bins,
+				     const int64_t numBins)
+{
+  if(!d_stop) {
+    if(numBins > 0) {
+      // The sink binned against its own x-axis settings, so the bin
+      // counts map onto the current axis as-is; accumulate/decay
+      // policy was already applied upstream.
+      if((int)numBins != d_bins)
+        setNumBins(numBins);
+
+      for(int n = 0; n < d_nplots; n++) {
+        memcpy(d_ydata[n], bins[n], d_bins*sizeof(double));
+      }
+
+      double height = *std::max_element(d_ydata[0], d_ydata[0]+d_bins);
+      for(int n = 1; n < d_nplots; n++) {
+        height = std::max(height, *std::max_element(d_ydata[n], d_ydata[n]+d_bins));
+      }
+
+      if(d_autoscale_state)
+        _autoScaleY(0, height);
+
+      queueReplot();
     }
   }
 }
@@ -61,6 +61,7 @@ SpectrumGUIClass::SpectrumGUIClass(const uint64_t maxDataSize,
   _fftBuffersCreatedFlag = false;
 
   _powerValue = 1;
+  _fftAverage = 1.0;
 }
 
 SpectrumGUIClass::~SpectrumGUIClass()
@@ -329,6 +330,22 @@ SpectrumGUIClass::setPowerValue(const float value)
   _powerValue = value;
 }
 
+float
+SpectrumGUIClass::getFFTAverage()
+{
+  gr::thread::scoped_lock lock(d_mutex);
+  float returnValue = 1.0;
+  returnValue = _fftAverage;
+  return returnValue;
+}
+
+void
+SpectrumGUIClass::setFFTAverage(const float newAverage)
+{
+  gr::thread::scoped_lock lock(d_mutex);
+  _fftAverage = newAverage;
+}
+
 int
 SpectrumGUIClass::getWindowType()
 {
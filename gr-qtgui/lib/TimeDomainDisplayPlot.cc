@@ -375,7 +375,7 @@ TimeDomainDisplayPlot::plotNewData(const std::vector<double*> dataPoints,
 	_autoScale(bottom, top);
       }      
 
-      replot();
+      queueReplot();
     }
   }
 }
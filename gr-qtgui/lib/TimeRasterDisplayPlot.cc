@@ -383,7 +383,7 @@ TimeRasterDisplayPlot::plotNewData(const std::vector<double*> dataPoints,
 	d_raster[i]->itemChanged();
       }
 
-      replot();
+      queueReplot();
     }
   }
 }
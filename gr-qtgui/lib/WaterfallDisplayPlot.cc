@@ -286,7 +286,7 @@ WaterfallDisplayPlot::plotNewData(const std::vector<double*> dataPoints,
 	}
 
 	if(isVisible()) {
-	  replot();
+	  queueReplot();
 	}
       }
 
@@ -304,7 +304,7 @@ WaterfallDisplayPlot::plotNewData(const std::vector<double*> dataPoints,
 	d_spectrogram[i]->itemChanged();
       }
 
-      replot();
+      queueReplot();
     }
   }
 }
@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <gnuradio/qtgui/displayscheduler.h>
+#include <gnuradio/qtgui/DisplayPlot.h>
+
+DisplayScheduler*
+DisplayScheduler::instance()
+{
+  // Constructed on first use from the GUI thread; torn down with the
+  // rest of the static objects.
+  static DisplayScheduler s;
+  return &s;
+}
+
+DisplayScheduler::DisplayScheduler()
+  : QObject(), d_timer(this)
+{
+  // One batch of replots per frame. There is no portable way to lock
+  // onto the display's vertical refresh, so run at the nominal 60 Hz
+  // and let the compositor absorb the difference.
+  d_timer.setInterval(16);
+  connect(&d_timer, SIGNAL(timeout()), this, SLOT(frame()));
+}
+
+void
+DisplayScheduler::queueReplot(DisplayPlot *plot)
+{
+  if(!d_pending.contains(plot))
+    d_pending.append(plot);
+  if(!d_timer.isActive())
+    d_timer.start();
+}
+
+void
+DisplayScheduler::cancel(DisplayPlot *plot)
+{
+  d_pending.removeAll(plot);
+}
+
+void
+DisplayScheduler::frame()
+{
+  if(d_pending.isEmpty()) {
+    d_timer.stop();
+    return;
+  }
+
+  // Swap the queue out first: a replot may queue follow-up work, and
+  // that belongs to the next frame.
+  QList<DisplayPlot*> batch;
+  batch.swap(d_pending);
+  for(int i = 0; i < batch.size(); i++)
+    batch[i]->replot();
+}
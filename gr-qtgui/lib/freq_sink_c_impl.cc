@@ -75,7 +75,7 @@ namespace gr {
       // this is usually desired when plotting
       d_shift = true;
 
-      d_fft = new fft::fft_complex(d_fftsize, true);
+      d_fft = spectrum_fft_service::acquire(d_fftsize);
       d_fbuf = (float*)volk_malloc(d_fftsize*sizeof(float),
                                    volk_get_alignment());
       memset(d_fbuf, 0, d_fftsize*sizeof(float));
@@ -105,7 +105,6 @@ namespace gr {
 	volk_free(d_residbufs[i]);
 	volk_free(d_magbufs[i]);
       }
-      delete d_fft;
       volk_free(d_fbuf);
 
       delete d_argv;
@@ -360,18 +359,7 @@ namespace gr {
     void
     freq_sink_c_impl::fft(float *data_out, const gr_complex *data_in, int size)
     {
-      if(d_window.size()) {
-	volk_32fc_32f_multiply_32fc(d_fft->get_inbuf(), data_in,
-                                    &d_window.front(), size);
-      }
-      else {
-	memcpy(d_fft->get_inbuf(), data_in, sizeof(gr_complex)*size);
-      }
-
-      d_fft->execute();     // compute the fft
-
-      volk_32fc_s32f_x2_power_spectral_density_32f(data_out, d_fft->get_outbuf(),
-                                                   size, 1.0, size);
+      d_fft->execute_psd(data_out, data_in, d_window, size);
 
       // Perform shift operation
       unsigned int len = (unsigned int)(floor(size/2.0));
@@ -434,8 +422,7 @@ namespace gr {
 	buildwindow();
 
 	// Reset FFTW plan for new size
-	delete d_fft;
-	d_fft = new fft::fft_complex(d_fftsize, true);
+	d_fft = spectrum_fft_service::acquire(d_fftsize);
 
 	volk_free(d_fbuf);
 	d_fbuf = (float*)volk_malloc(d_fftsize*sizeof(float),
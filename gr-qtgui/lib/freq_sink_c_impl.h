@@ -26,6 +26,7 @@
 #include <gnuradio/qtgui/freq_sink_c.h>
 #include <gnuradio/filter/firdes.h>
 #include <gnuradio/fft/fft.h>
+#include "spectrum_fft_service.h"
 #include <gnuradio/high_res_timer.h>
 #include <gnuradio/thread/thread.h>
 #include <gnuradio/qtgui/freqdisplayform.h>
@@ -52,7 +53,7 @@ namespace gr {
       int d_nconnections;
 
       bool d_shift;
-      fft::fft_complex *d_fft;
+      spectrum_fft_service::sptr d_fft;
 
       int d_index;
       std::vector<gr_complex*> d_residbufs;
@@ -55,7 +55,8 @@ namespace gr {
                    io_signature::make(nconnections, nconnections, sizeof(float)),
                    io_signature::make(0, 0, 0)),
 	d_size(size), d_bins(bins), d_xmin(xmin), d_xmax(xmax), d_name(name),
-	d_nconnections(nconnections), d_parent(parent)
+	d_nconnections(nconnections), d_incremental(false), d_decay(1.0),
+	d_parent(parent)
     {
       // Required now for Qt; argc must be greater than 0 and argv
       // must have at least one valid character. Must be valid through
@@ -73,6 +74,10 @@ namespace gr {
 	d_residbufs.push_back((double*)volk_malloc(d_size*sizeof(double),
                                                    volk_get_alignment()));
 	memset(d_residbufs[i], 0, d_size*sizeof(double));
+
+	d_binbufs.push_back((double*)volk_malloc(d_bins*sizeof(double),
+                                                 volk_get_alignment()));
+	memset(d_binbufs[i], 0, d_bins*sizeof(double));
       }
 
       // Set alignment properties for VOLK
@@ -91,6 +96,7 @@ namespace gr {
       // d_main_gui is a qwidget destroyed with its parent
       for(int i = 0; i < d_nconnections; i++) {
 	volk_free(d_residbufs[i]);
+	volk_free(d_binbufs[i]);
       }
 
       delete d_argv;
@@ -298,7 +304,15 @@ namespace gr {
     histogram_sink_f_impl::set_bins(const int bins)
     {
       gr::thread::scoped_lock lock(d_mutex);
-      d_bins = bins;
+      if(bins != d_bins) {
+	d_bins = bins;
+	for(int i = 0; i < d_nconnections; i++) {
+	  volk_free(d_binbufs[i]);
+	  d_binbufs[i] = (double*)volk_malloc(d_bins*sizeof(double),
+                                              volk_get_alignment());
+	  memset(d_binbufs[i], 0, d_bins*sizeof(double));
+	}
+      }
       d_main_gui->setNumBins(d_bins);
     }
 
@@ -357,6 +371,22 @@ namespace gr {
       d_main_gui->setAccumulate(en);
     }
 
+    void
+    histogram_sink_f_impl::enable_incremental(bool en)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      d_incremental = en;
+      for(int i = 0; i < d_nconnections; i++)
+	memset(d_binbufs[i], 0, d_bins*sizeof(double));
+    }
+
+    void
+    histogram_sink_f_impl::set_decay_rate(const double r)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      d_decay = r;
+    }
+
     void
     histogram_sink_f_impl::autoscalex()
     {
@@ -366,7 +396,10 @@ namespace gr {
     void
     histogram_sink_f_impl::reset()
     {
+      gr::thread::scoped_lock lock(d_mutex);
       d_index = 0;
+      for(int i = 0; i < d_nconnections; i++)
+	memset(d_binbufs[i], 0, d_bins*sizeof(double));
     }
 
     int
@@ -379,6 +412,38 @@ namespace gr {
 
       npoints_resize();
 
+      if(d_incremental) {
+	gr::thread::scoped_lock lock(d_mutex);
+
+	// count every sample into the accumulators; the cost per
+	// sample is constant, so this can stay running at high rates
+	const double scale = d_bins / (d_xmax - d_xmin);
+	for(n = 0; n < d_nconnections; n++) {
+	  in = (const float*)input_items[n];
+	  for(int i = 0; i < noutput_items; i++) {
+	    int bin = static_cast<int>((in[i] - d_xmin) * scale);
+	    if((bin >= 0) && (bin < d_bins))
+	      d_binbufs[n][bin] += 1.0;
+	  }
+	}
+
+	if(gr::high_res_timer_now() - d_last_time > d_update_time) {
+	  d_last_time = gr::high_res_timer_now();
+	  d_qApplication->postEvent(d_main_gui,
+				    new HistogramBinsEvent(d_binbufs, d_bins));
+
+	  // exponentially forget the history once it has been shown
+	  if(d_decay < 1.0) {
+	    for(n = 0; n < d_nconnections; n++) {
+	      for(int x = 0; x < d_bins; x++)
+		d_binbufs[n][x] *= d_decay;
+	    }
+	  }
+	}
+
+	return noutput_items;
+      }
+
       for(int i=0; i < noutput_items; i+=d_size) {
 	unsigned int datasize = noutput_items - i;
 	unsigned int resid = d_size-d_index;
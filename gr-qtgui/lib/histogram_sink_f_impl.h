@@ -47,6 +47,12 @@ namespace gr {
       int d_index;
       std::vector<double*> d_residbufs;
 
+      // incremental mode: bins accumulated in work() so every sample
+      // is counted, decayed once per posted GUI update
+      bool d_incremental;
+      double d_decay;
+      std::vector<double*> d_binbufs;
+
       int d_argc;
       char *d_argv;
       QWidget *d_parent;
@@ -105,6 +111,8 @@ namespace gr {
       void enable_semilogx(bool en);
       void enable_semilogy(bool en);
       void enable_accumulate(bool en);
+      void enable_incremental(bool en);
+      void set_decay_rate(const double r);
       void autoscalex();
       int  nsamps() const;
       int  bins() const;
@@ -117,12 +117,24 @@ HistogramDisplayForm::newData(const QEvent* updateEvent)
 			 d_update_time);
 }
 
+void
+HistogramDisplayForm::newBinData(const QEvent* updateEvent)
+{
+  HistogramBinsEvent *hevent = (HistogramBinsEvent*)updateEvent;
+
+  getPlot()->plotNewBinData(hevent->getBins(),
+			    hevent->getNumBins());
+}
+
 void
 HistogramDisplayForm::customEvent(QEvent * e)
 {
   if(e->type() == HistogramUpdateEvent::Type()) {
     newData(e);
   }
+  else if(e->type() == HistogramBinsEvent::Type()) {
+    newBinData(e);
+  }
 }
 
 void
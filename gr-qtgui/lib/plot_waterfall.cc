@@ -27,6 +27,8 @@
 #include "qwt_scale_map.h"
 #include "qwt_color_map.h"
 #include <gnuradio/qtgui/plot_waterfall.h>
+#include <string.h>
+#include <vector>
 
 #if QWT_VERSION < 0x060000
 #include "qwt_double_interval.h"
@@ -62,6 +64,8 @@ public:
   {
     data = NULL;
     colorMap = new QwtLinearColorMap();
+    cachedLines = 0;
+    cacheValid = false;
   }
   ~PrivateData()
   {
@@ -70,6 +74,17 @@ public:
 
   WaterfallData *data;
   QwtColorMap *colorMap;
+
+  // scroll-blit cache: the waterfall rasterized at one pixel per data
+  // sample; each frame scrolls the cache and colormaps only new rows
+  QImage cache;
+  uint64_t cachedLines;
+  bool cacheValid;
+#if QWT_VERSION < 0x060000
+  QwtDoubleInterval cachedRange;
+#else
+  QwtInterval cachedRange;
+#endif
 };
 
 /*!
@@ -126,6 +141,7 @@ int PlotWaterfall::rtti() const
 */
 void PlotWaterfall::setColorMap(const QwtColorMap &colorMap)
 {
+    d_data->cacheValid = false;
     delete d_data->colorMap;
 #if QWT_VERSION < 0x060000
     d_data->colorMap = colorMap.copy();
@@ -171,6 +187,79 @@ QSize PlotWaterfall::rasterHint(const QwtDoubleRect &rect) const
 }
 #endif
 
+/*!
+  \brief Bring the raster cache up to date with the data.
+
+  The cache holds the waterfall at one pixel per data sample. New
+  lines since the last call are rendered through the color map and
+  the rest of the image just scrolls up, so the per-frame rasterizing
+  cost is proportional to the new rows, not the display. A change of
+  color map, intensity range or geometry repaints the cache in full.
+*/
+void PlotWaterfall::updateRasterCache() const
+{
+#if QWT_VERSION < 0x060000
+    const QwtDoubleInterval intensityRange = d_data->data->range();
+    const int h = static_cast<int>(d_data->data->boundingRect().height());
+#else
+    const QwtInterval intensityRange = d_data->data->interval(Qt::ZAxis);
+    const int h = static_cast<int>(d_data->data->interval(Qt::YAxis).maxValue());
+#endif
+    const int w = static_cast<int>(d_data->data->getNumFFTPoints());
+
+    const QwtColorMap::Format fmt = d_data->colorMap->format();
+    const QImage::Format qfmt = fmt == QwtColorMap::RGB
+        ? QImage::Format_ARGB32 : QImage::Format_Indexed8;
+
+    const bool full = !d_data->cacheValid
+        || d_data->cache.size() != QSize(w, h)
+        || d_data->cache.format() != qfmt
+        || !(d_data->cachedRange == intensityRange);
+
+    const uint64_t lines = d_data->data->getLinesAppended();
+    int newrows = h;
+    if(!full) {
+        const uint64_t delta = lines - d_data->cachedLines;
+        if(delta == 0)
+            return;
+        newrows = delta > static_cast<uint64_t>(h) ? h : static_cast<int>(delta);
+    }
+
+    if(full) {
+        d_data->cache = QImage(QSize(w, h), qfmt);
+    }
+    else if(newrows < h) {
+        // scroll the still-valid rows up by the number of new lines
+        for(int y = 0; y < h - newrows; y++) {
+            memcpy(d_data->cache.scanLine(y),
+                   d_data->cache.scanLine(y + newrows),
+                   d_data->cache.bytesPerLine());
+        }
+    }
+
+    if(fmt == QwtColorMap::Indexed)
+        d_data->cache.setColorTable(d_data->colorMap->colorTable(intensityRange));
+
+    const double *buf = d_data->data->getSpectrumDataBuffer();
+    for(int y = h - newrows; y < h; y++) {
+        const double *row = &buf[static_cast<uint64_t>(y) * w];
+        if(fmt == QwtColorMap::RGB) {
+            QRgb *line = (QRgb *)d_data->cache.scanLine(y);
+            for(int x = 0; x < w; x++)
+                *line++ = d_data->colorMap->rgb(intensityRange, row[x]);
+        }
+        else {
+            unsigned char *line = d_data->cache.scanLine(y);
+            for(int x = 0; x < w; x++)
+                *line++ = d_data->colorMap->colorIndex(intensityRange, row[x]);
+        }
+    }
+
+    d_data->cachedLines = lines;
+    d_data->cachedRange = intensityRange;
+    d_data->cacheValid = true;
+}
+
 /*!
   \brief Render an image from the data and color map.
 
@@ -261,38 +350,72 @@ QImage PlotWaterfall::renderImage(const QwtScaleMap &xMap,
 
     d_data->data->initRaster(area, rect.size());
 
+    updateRasterCache();
+
+    const int cw = d_data->cache.width();
+    const int ch = d_data->cache.height();
+
+#if QWT_VERSION < 0x060000
+    const double yheight = d_data->data->boundingRect().height();
+    const double xleft = d_data->data->boundingRect().left();
+    const double xwidth = d_data->data->boundingRect().width();
+#else
+    const double yheight = d_data->data->interval(Qt::YAxis).maxValue();
+    const double xleft = d_data->data->interval(Qt::XAxis).minValue();
+    const double xwidth = d_data->data->interval(Qt::XAxis).width();
+#endif
+
+    // precompute the source column of every output column; the same
+    // nearest-sample mapping WaterfallData::value() uses
+    std::vector<int> xindex;
+    for ( int x = rect.left(); x <= rect.right(); x++ )
+    {
+        const double tx = xxMap.invTransform(x);
+        int sx = static_cast<int>(((tx - xleft) / xwidth) *
+                                  static_cast<double>(cw - 1) + 0.5);
+        if ( sx < 0 )
+            sx = 0;
+        if ( sx > cw - 1 )
+            sx = cw - 1;
+        xindex.push_back(sx);
+    }
+
     if ( d_data->colorMap->format() == QwtColorMap::RGB )
     {
         for ( int y = rect.top(); y <= rect.bottom(); y++ )
         {
             const double ty = yyMap.invTransform(y);
-
+            int sy = static_cast<int>((1.0 - ty/yheight) *
+                                      static_cast<double>(ch - 1));
+            if ( sy < 0 )
+                sy = 0;
+            if ( sy > ch - 1 )
+                sy = ch - 1;
+
+            const QRgb *src = (const QRgb *)d_data->cache.scanLine(sy);
             QRgb *line = (QRgb *)image.scanLine(y - rect.top());
-            for ( int x = rect.left(); x <= rect.right(); x++ )
-            {
-                const double tx = xxMap.invTransform(x);
-
-                *line++ = d_data->colorMap->rgb(intensityRange,
-						d_data->data->value(tx, ty));
-            }
+            for ( size_t x = 0; x < xindex.size(); x++ )
+                *line++ = src[xindex[x]];
         }
     }
     else if ( d_data->colorMap->format() == QwtColorMap::Indexed )
     {
-        image.setColorTable(d_data->colorMap->colorTable(intensityRange));
+        image.setColorTable(d_data->cache.colorTable());
 
         for ( int y = rect.top(); y <= rect.bottom(); y++ )
         {
             const double ty = yyMap.invTransform(y);
-
+            int sy = static_cast<int>((1.0 - ty/yheight) *
+                                      static_cast<double>(ch - 1));
+            if ( sy < 0 )
+                sy = 0;
+            if ( sy > ch - 1 )
+                sy = ch - 1;
+
+            const unsigned char *src = d_data->cache.scanLine(sy);
             unsigned char *line = image.scanLine(y - rect.top());
-            for ( int x = rect.left(); x <= rect.right(); x++ )
-            {
-                const double tx = xxMap.invTransform(x);
-
-                *line++ = d_data->colorMap->colorIndex(intensityRange,
-						       d_data->data->value(tx, ty));
-            }
+            for ( size_t x = 0; x < xindex.size(); x++ )
+                *line++ = src[xindex[x]];
         }
     }
 
@@ -79,13 +79,17 @@ namespace gr {
       // this is usually desired when plotting
       d_shift = true;
 
-      d_fft = new fft::fft_complex(d_fftsize, true);
+      d_fft = spectrum_fft_service::acquire(d_fftsize);
 
       d_index = 0;
       d_residbuf = (gr_complex*)volk_malloc(d_fftsize*sizeof(gr_complex),
                                             volk_get_alignment());
       d_magbuf = (float*)volk_malloc(d_fftsize*sizeof(float),
                                      volk_get_alignment());
+      d_avgbuf = (float*)volk_malloc(d_fftsize*sizeof(float),
+                                     volk_get_alignment());
+      memset(d_avgbuf, 0, d_fftsize*sizeof(float));
+      d_fftavg = 1.0;
 
       buildwindow();
 
@@ -95,10 +99,10 @@ namespace gr {
     sink_c_impl::~sink_c_impl()
     {
       delete d_main_gui;
-      delete d_fft;
       delete d_argv;
       volk_free(d_residbuf);
       volk_free(d_magbuf);
+      volk_free(d_avgbuf);
     }
 
     bool
@@ -249,17 +253,7 @@ namespace gr {
     void
     sink_c_impl::fft(float *data_out, const gr_complex *data_in, int size)
     {
-      if (d_window.size()) {
-	volk_32fc_32f_multiply_32fc_a(d_fft->get_inbuf(), data_in,
-				      &d_window.front(), size);
-      }
-      else {
-	memcpy (d_fft->get_inbuf(), data_in, sizeof(gr_complex)*size);
-      }
-
-      d_fft->execute ();     // compute the fft
-      volk_32fc_s32f_x2_power_spectral_density_32f_a(data_out, d_fft->get_outbuf(),
-						     size, 1.0, size);
+      d_fft->execute_psd(data_out, data_in, d_window, size);
 }
 
     void
@@ -298,6 +292,11 @@ namespace gr {
         d_magbuf = (float*)volk_malloc(newfftsize*sizeof(float),
                                        volk_get_alignment());
 
+        volk_free(d_avgbuf);
+        d_avgbuf = (float*)volk_malloc(newfftsize*sizeof(float),
+                                       volk_get_alignment());
+        memset(d_avgbuf, 0, newfftsize*sizeof(float));
+
 	// Set new fft size and reset buffer index
 	// (throws away any currently held data, but who cares?)
 	d_fftsize = newfftsize;
@@ -307,8 +306,7 @@ namespace gr {
 	buildwindow();
 
 	// Reset FFTW plan for new size
-	delete d_fft;
-	d_fft = new fft::fft_complex (d_fftsize, true);
+	d_fft = spectrum_fft_service::acquire(d_fftsize);
       }
     }
 
@@ -349,7 +347,22 @@ namespace gr {
 	  j += resid;
 	  fft(d_magbuf, d_residbuf, d_fftsize);
 
-	  d_main_gui->updateWindow(true, d_magbuf, d_fftsize,
+	  // Run the spectral averaging over the bins here, in the
+	  // block's thread, so the Qt event thread only has to draw
+	  // already-reduced frames
+	  d_fftavg = d_main_gui->getFFTAverage();
+	  if(d_fftavg < 1.0) {
+	    volk_32f_s32f_multiply_32f(d_avgbuf, d_avgbuf,
+				       1.0f - d_fftavg, d_fftsize);
+	    volk_32f_s32f_multiply_32f(d_magbuf, d_magbuf,
+				       d_fftavg, d_fftsize);
+	    volk_32f_x2_add_32f(d_avgbuf, d_avgbuf, d_magbuf, d_fftsize);
+	  }
+	  else {
+	    memcpy(d_avgbuf, d_magbuf, d_fftsize*sizeof(float));
+	  }
+
+	  d_main_gui->updateWindow(true, d_avgbuf, d_fftsize,
 				   NULL, 0, (float*)d_residbuf, d_fftsize,
 				   currentTime, true);
 	  d_update_active = false;
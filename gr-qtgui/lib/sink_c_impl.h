@@ -26,6 +26,7 @@
 #include <gnuradio/qtgui/sink_c.h>
 #include <gnuradio/filter/firdes.h>
 #include <gnuradio/fft/fft.h>
+#include "spectrum_fft_service.h"
 #include <gnuradio/high_res_timer.h>
 #include <gnuradio/qtgui/SpectrumGUIClass.h>
 
@@ -49,11 +50,13 @@ namespace gr {
       bool d_update_active;
 
       bool d_shift;
-      fft::fft_complex *d_fft;
+      spectrum_fft_service::sptr d_fft;
 
       int d_index;
       gr_complex *d_residbuf;
       float *d_magbuf;
+      float *d_avgbuf;
+      float d_fftavg;
 
       bool d_plotfreq, d_plotwaterfall, d_plottime, d_plotconst;
 
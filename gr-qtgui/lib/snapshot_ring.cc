@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "snapshot_ring.h"
+
+namespace gr {
+  namespace qtgui {
+
+    snapshot_ring::snapshot_ring()
+      : d_nbuffers(0), d_bufsize(0)
+    {
+      for(int i = 0; i < s_nslots; i++)
+        d_slots[i].busy = false;
+    }
+
+    void
+    snapshot_ring::set_geometry(int nbuffers, int bufsize)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      d_nbuffers = nbuffers;
+      d_bufsize = bufsize;
+    }
+
+    int
+    snapshot_ring::write_slot()
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      for(int i = 0; i < s_nslots; i++) {
+        slot_t &slot = d_slots[i];
+        if(slot.busy)
+          continue;
+
+        // stale geometry is fixed lazily, once the slot is ours
+        if((int)slot.data.size() != d_nbuffers ||
+           (d_nbuffers > 0 && (int)slot.data[0].size() != d_bufsize)) {
+          slot.data.assign(d_nbuffers, std::vector<double>(d_bufsize));
+          slot.ptrs.resize(d_nbuffers);
+          for(int n = 0; n < d_nbuffers; n++)
+            slot.ptrs[n] = &slot.data[n].front();
+        }
+
+        slot.busy = true;
+        return i;
+      }
+      return -1;
+    }
+
+    std::vector<double*> &
+    snapshot_ring::buffers(int slot)
+    {
+      return d_slots[slot].ptrs;
+    }
+
+    void
+    snapshot_ring::recycle(int slot)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+      d_slots[slot].busy = false;
+    }
+
+  } /* namespace qtgui */
+} /* namespace gr */
@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_QTGUI_SNAPSHOT_RING_H
+#define INCLUDED_QTGUI_SNAPSHOT_RING_H
+
+#include <gnuradio/qtgui/spectrumUpdateEvents.h>
+#include <gnuradio/thread/thread.h>
+#include <vector>
+
+namespace gr {
+  namespace qtgui {
+
+    /*!
+     * \brief Fixed set of snapshot buffers shared between a display
+     * block and the GUI thread.
+     *
+     * The time sinks used to post every GUI update as a freshly
+     * allocated copy, and the allocation/free churn at high update
+     * rates shows up as scheduler jitter. The ring keeps three
+     * preallocated snapshots: work() claims a free slot, fills it
+     * sequentially, and posts it; the event destructor hands the slot
+     * back from the GUI thread via recycle(). When every slot is
+     * still in flight the caller drops the frame instead of queueing
+     * another copy behind a stalled display. Slot storage is only
+     * reallocated when the geometry changes, and then lazily as each
+     * slot comes free.
+     */
+    class snapshot_ring : public buffer_recycler
+    {
+    public:
+      snapshot_ring();
+
+      //! Set buffer count/length; applied to each slot on its next use
+      void set_geometry(int nbuffers, int bufsize);
+
+      //! Claim a free slot, or -1 if all are in flight to the GUI
+      int write_slot();
+
+      //! The claimed slot's buffers, one per plot
+      std::vector<double*> &buffers(int slot);
+
+      //! Called from the event destructor in the GUI thread
+      void recycle(int slot);
+
+    private:
+      static const int s_nslots = 3;
+
+      struct slot_t {
+        std::vector<std::vector<double> > data;
+        std::vector<double*> ptrs;
+        bool busy;
+      };
+
+      slot_t d_slots[s_nslots];
+      int d_nbuffers, d_bufsize;
+      gr::thread::mutex d_mutex;
+    };
+
+  } /* namespace qtgui */
+} /* namespace gr */
+
+#endif /* INCLUDED_QTGUI_SNAPSHOT_RING_H */
@@ -225,12 +225,40 @@ TimeUpdateEvent::TimeUpdateEvent(const std::vector<double*> timeDomainPoints,
   }
 
   _tags = tags;
+  _slot = 0;
+}
+
+TimeUpdateEvent::TimeUpdateEvent(const std::vector<double*> timeDomainPoints,
+				 const uint64_t numTimeDomainDataPoints,
+                                 const std::vector< std::vector<gr::tag_t> > tags,
+                                 boost::shared_ptr<buffer_recycler> recycler,
+                                 int slot)
+  : QEvent(QEvent::Type(SpectrumUpdateEventType))
+{
+  if(numTimeDomainDataPoints < 1) {
+    _numTimeDomainDataPoints = 1;
+  }
+  else {
+    _numTimeDomainDataPoints = numTimeDomainDataPoints;
+  }
+
+  // recycled storage: reference the caller's buffers, no copy
+  _nplots = timeDomainPoints.size();
+  _dataTimeDomainPoints = timeDomainPoints;
+  _tags = tags;
+  _recycler = recycler;
+  _slot = slot;
 }
 
 TimeUpdateEvent::~TimeUpdateEvent()
 {
-  for(size_t i = 0; i < _nplots; i++) {
-    delete[] _dataTimeDomainPoints[i];
+  if(_recycler) {
+    _recycler->recycle(_slot);
+  }
+  else {
+    for(size_t i = 0; i < _nplots; i++) {
+      delete[] _dataTimeDomainPoints[i];
+    }
   }
 }
 
@@ -490,6 +518,49 @@ HistogramUpdateEvent::getNumDataPoints() const
 }
 
 
+/***************************************************************************/
+
+
+HistogramBinsEvent::HistogramBinsEvent(const std::vector<double*> bins,
+                                       const uint64_t nbins)
+  : QEvent(QEvent::Type(HistogramBinsEventType))
+{
+  if(nbins < 1) {
+    _nbins = 1;
+  }
+  else {
+    _nbins = nbins;
+  }
+
+  _nplots = bins.size();
+  for(size_t i = 0; i < _nplots; i++) {
+    _bins.push_back(new double[_nbins]);
+    if(nbins > 0) {
+      memcpy(_bins[i], bins[i], _nbins*sizeof(double));
+    }
+  }
+}
+
+HistogramBinsEvent::~HistogramBinsEvent()
+{
+  for(size_t i = 0; i < _nplots; i++) {
+    delete[] _bins[i];
+  }
+}
+
+const std::vector<double*>
+HistogramBinsEvent::getBins() const
+{
+  return _bins;
+}
+
+uint64_t
+HistogramBinsEvent::getNumBins() const
+{
+  return _nbins;
+}
+
+
 
 /***************************************************************************/
 
@@ -0,0 +1,102 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "spectrum_fft_service.h"
+#include <volk/volk.h>
+#include <string.h>
+
+namespace gr {
+  namespace qtgui {
+
+    std::map<int, boost::weak_ptr<spectrum_fft_service> > spectrum_fft_service::s_plans;
+    gr::thread::mutex spectrum_fft_service::s_plans_mutex;
+
+    spectrum_fft_service::spectrum_fft_service(int fftsize)
+      : d_fftsize(fftsize), d_fft(fftsize, true), d_rfft(fftsize)
+    {
+    }
+
+    spectrum_fft_service::sptr
+    spectrum_fft_service::acquire(int fftsize)
+    {
+      gr::thread::scoped_lock lock(s_plans_mutex);
+      sptr plan = s_plans[fftsize].lock();
+      if(!plan) {
+        plan = sptr(new spectrum_fft_service(fftsize));
+        s_plans[fftsize] = plan;
+      }
+      return plan;
+    }
+
+    void
+    spectrum_fft_service::execute_psd(float *data_out, const gr_complex *data_in,
+                                      const std::vector<float> &window, int size)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+
+      if(window.size()) {
+	volk_32fc_32f_multiply_32fc(d_fft.get_inbuf(), data_in,
+                                    &window.front(), size);
+      }
+      else {
+	memcpy(d_fft.get_inbuf(), data_in, sizeof(gr_complex)*size);
+      }
+
+      d_fft.execute();     // compute the fft
+
+      volk_32fc_s32f_x2_power_spectral_density_32f(data_out, d_fft.get_outbuf(),
+                                                   size, 1.0, size);
+    }
+
+    void
+    spectrum_fft_service::execute_psd(float *data_out, const float *data_in,
+                                      const std::vector<float> &window, int size)
+    {
+      gr::thread::scoped_lock lock(d_mutex);
+
+      // real input: window in the float domain and run the half-size
+      // r2c transform instead of converting to complex first
+      float *dst = d_rfft.get_inbuf();
+      if(window.size()) {
+	volk_32f_x2_multiply_32f(dst, data_in, &window.front(), size);
+      }
+      else {
+	memcpy(dst, data_in, sizeof(float)*size);
+      }
+
+      d_rfft.execute();    // compute the fft
+
+      // the r2c transform only produces bins 0 .. size/2; the PSD of
+      // the remaining bins follows from conjugate symmetry
+      int nhalf = size/2 + 1;
+      volk_32fc_s32f_x2_power_spectral_density_32f(data_out, d_rfft.get_outbuf(),
+                                                   size, 1.0, nhalf);
+      for(int k = 1; k < size - nhalf + 1; k++)
+	data_out[size - k] = data_out[k];
+    }
+
+  } /* namespace qtgui */
+} /* namespace gr */
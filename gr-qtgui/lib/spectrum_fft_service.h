@@ -0,0 +1,90 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2013 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_QTGUI_SPECTRUM_FFT_SERVICE_H
+#define INCLUDED_QTGUI_SPECTRUM_FFT_SERVICE_H
+
+#include <gnuradio/fft/fft.h>
+#include <gnuradio/gr_complex.h>
+#include <gnuradio/thread/thread.h>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+#include <vector>
+#include <map>
+
+namespace gr {
+  namespace qtgui {
+
+    /*!
+     * \brief Shared FFT backend for the spectral display sinks.
+     *
+     * Every frequency-domain display used to build its own fftw plan;
+     * a flowgraph with a freq sink and a waterfall of the same size
+     * paid the planner time and plan memory twice. The service keeps
+     * one forward plan per unique FFT size, handed out by reference
+     * count so the last display of a size releases it.
+     *
+     * The plan's in/out buffers are shared between subscribers, so
+     * execute_psd() serializes access internally. Displays transform
+     * at GUI update rates, so the lock is uncontended in practice.
+     */
+    class spectrum_fft_service
+    {
+    public:
+      typedef boost::shared_ptr<spectrum_fft_service> sptr;
+
+      //! Get the shared forward plan of this size, creating it if needed
+      static sptr acquire(int fftsize);
+
+      /*!
+       * Window the input, transform it, and write the power spectral
+       * density (not fftshifted) to \p data_out. An empty \p window
+       * skips the windowing step. \p size must not exceed the plan
+       * size this service was acquired for.
+       */
+      void execute_psd(float *data_out, const gr_complex *data_in,
+                       const std::vector<float> &window, int size);
+
+      /*!
+       * Float input version. Real input runs through a half-size r2c
+       * plan; the PSD of the upper bins is filled in by symmetry so
+       * \p data_out still gets all \p size bins.
+       */
+      void execute_psd(float *data_out, const float *data_in,
+                       const std::vector<float> &window, int size);
+
+    private:
+      spectrum_fft_service(int fftsize);
+
+      int d_fftsize;
+      fft::fft_complex d_fft;
+      fft::fft_real_fwd d_rfft;
+      gr::thread::mutex d_mutex;
+
+      static std::map<int, boost::weak_ptr<spectrum_fft_service> > s_plans;
+      static gr::thread::mutex s_plans_mutex;
+    };
+
+  } /* namespace qtgui */
+} /* namespace gr */
+
+#endif /* INCLUDED_QTGUI_SPECTRUM_FFT_SERVICE_H */
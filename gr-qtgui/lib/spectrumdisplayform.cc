@@ -445,6 +445,9 @@ SpectrumDisplayForm::setFrequencyRange(const double newCenterFrequency,
 int
 SpectrumDisplayForm::getAverageCount()
 {
+  if(_systemSpecifiedFlag) {
+    return AvgLineEdit->value();
+  }
   return _historyVector->size();
 }
 
@@ -452,6 +455,15 @@ void
 SpectrumDisplayForm::setAverageCount(const int newCount)
 {
   if(newCount > -1) {
+    // With a system attached, the averaging runs vectorized in the
+    // block's work() thread; hand over the equivalent single-pole
+    // weight and keep no per-frame history on the event thread.
+    if(_systemSpecifiedFlag) {
+      _system->setFFTAverage((newCount > 1) ? 1.0f/newCount : 1.0f);
+      averageDataReset();
+      return;
+    }
+
     if(newCount != static_cast<int>(_historyVector->size())) {
       std::vector<double*>::iterator pos;
       while(newCount < static_cast<int>(_historyVector->size())) {
@@ -514,7 +526,9 @@ SpectrumDisplayForm::resizeBuffers(const uint64_t numFFTDataPoints,
     _averagedValues = new double[_numRealDataPoints];
     memset(_realFFTDataPoints, 0x0, _numRealDataPoints*sizeof(double));
 
-    const int historySize = _historyVector->size();
+    // With a system attached the count lives in AvgLineEdit, not in
+    // _historyVector; getAverageCount() reads the right one.
+    const int historySize = getAverageCount();
     setAverageCount(0); // Clear the existing history
     setAverageCount(historySize);
 
@@ -73,6 +73,10 @@ namespace gr {
 	memset(d_buffers[n], 0, d_buffer_size*sizeof(double));
       }
 
+      // triple-buffered snapshots handed to the GUI thread
+      d_ring = boost::shared_ptr<snapshot_ring>(new snapshot_ring());
+      d_ring->set_geometry(d_nconnections, d_size);
+
       // Set alignment properties for VOLK
       const int alignment_multiple =
 	volk_get_alignment() / sizeof(float);
@@ -322,6 +326,7 @@ namespace gr {
                                               volk_get_alignment());
 	  memset(d_buffers[n], 0, d_buffer_size*sizeof(double));
 	}
+        d_ring->set_geometry(d_nconnections, d_size);
 
         // If delay was set beyond the new boundary, pull it back.
         if(d_trigger_delay >= d_size) {
@@ -617,9 +622,19 @@ namespace gr {
 
         // Plot if we are able to update
         if(gr::high_res_timer_now() - d_last_time > d_update_time) {
-          d_last_time = gr::high_res_timer_now();
-          d_qApplication->postEvent(d_main_gui,
-                                    new TimeUpdateEvent(d_buffers, d_size, d_tags));
+          // snapshot into a recycled slot; when every slot is still in
+          // flight to the GUI, drop the frame instead of allocating
+          const int slot = d_ring->write_slot();
+          if(slot >= 0) {
+            d_last_time = gr::high_res_timer_now();
+            std::vector<double*> &snap = d_ring->buffers(slot);
+            for(n = 0; n < d_nconnections; n++) {
+              memcpy(snap[n], d_buffers[n], d_size*sizeof(double));
+            }
+            d_qApplication->postEvent(d_main_gui,
+                                      new TimeUpdateEvent(snap, d_size, d_tags,
+                                                          d_ring, slot));
+          }
         }
 
         // We've plotting, so reset the state
@@ -27,6 +27,7 @@
 #include <gnuradio/qtgui/timedisplayform.h>
 #include <gnuradio/thread/thread.h>
 #include <gnuradio/high_res_timer.h>
+#include "snapshot_ring.h"
 
 namespace gr {
   namespace qtgui {
@@ -45,6 +46,7 @@ namespace gr {
 
       int d_index, d_start, d_end;
       std::vector<double*> d_buffers;
+      boost::shared_ptr<snapshot_ring> d_ring;
       std::vector< std::vector<gr::tag_t> > d_tags;
 
       int d_argc;
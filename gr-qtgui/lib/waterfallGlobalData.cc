@@ -42,6 +42,7 @@ WaterfallData::WaterfallData(const double minimumFrequency,
 
   _fftPoints = fftPoints;
   _historyLength = historyExtent;
+  _linesAppended = 0;
 
   _spectrumData = new double[_fftPoints * _historyLength];
 
@@ -64,6 +65,7 @@ void WaterfallData::reset()
   memset(_spectrumData, 0x0, _fftPoints*_historyLength*sizeof(double));
 
   _numLinesToUpdate = -1;
+  _linesAppended += _historyLength;
 }
 
 void WaterfallData::copy(const WaterfallData* rhs)
@@ -221,6 +223,8 @@ void WaterfallData::addFFTData(const double* fftData,
     // add the new buffer
     memcpy(&_spectrumData[(_historyLength - 1) * _fftPoints], fftData,
 	   _fftPoints*sizeof(double));
+
+    _linesAppended += static_cast<uint64_t>(droppedFrames) + 1;
   }
 }
 
@@ -232,6 +236,12 @@ double* WaterfallData::getSpectrumDataBuffer() const
 void WaterfallData::setSpectrumDataBuffer(const double* newData)
 {
   memcpy(_spectrumData, newData, _fftPoints * _historyLength * sizeof(double));
+  _linesAppended += _historyLength;
+}
+
+uint64_t WaterfallData::getLinesAppended() const
+{
+  return _linesAppended;
 }
 
 int WaterfallData::getNumLinesToUpdate() const
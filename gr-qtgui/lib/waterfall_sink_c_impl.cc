@@ -59,7 +59,8 @@ namespace gr {
 	d_fftsize(fftsize), d_fftavg(1.0),
 	d_wintype((filter::firdes::win_type)(wintype)),
 	d_center_freq(fc), d_bandwidth(bw), d_name(name),
-	d_nconnections(nconnections), d_parent(parent)
+	d_nconnections(nconnections), d_parent(parent),
+	d_frame_hold(0), d_frame_held(false)
     {
       // Required now for Qt; argc must be greater than 0 and argv
       // must have at least one valid character. Must be valid through
@@ -75,7 +76,7 @@ namespace gr {
       // this is usually desired when plotting
       d_shift = true;
 
-      d_fft = new fft::fft_complex(d_fftsize, true);
+      d_fft = spectrum_fft_service::acquire(d_fftsize);
       d_fbuf = (float*)volk_malloc(d_fftsize*sizeof(float),
                                    volk_get_alignment());
       memset(d_fbuf, 0, d_fftsize*sizeof(float));
@@ -104,7 +105,6 @@ namespace gr {
 	volk_free(d_residbufs[i]);
 	volk_free(d_magbufs[i]);
       }
-      delete d_fft;
       volk_free(d_fbuf);
 
       delete d_argv;
@@ -249,6 +249,19 @@ namespace gr {
       d_last_time = 0;
     }
 
+    void
+    waterfall_sink_c_impl::set_frame_hold(int mode)
+    {
+      d_frame_hold = mode;
+      d_frame_held = false;
+    }
+
+    int
+    waterfall_sink_c_impl::frame_hold() const
+    {
+      return d_frame_hold;
+    }
+
     void
     waterfall_sink_c_impl::set_title(const std::string &title)
     {
@@ -336,18 +349,7 @@ namespace gr {
     void
     waterfall_sink_c_impl::fft(float *data_out, const gr_complex *data_in, int size)
     {
-      if(d_window.size()) {
-	volk_32fc_32f_multiply_32fc(d_fft->get_inbuf(), data_in,
-                                    &d_window.front(), size);
-      }
-      else {
-	memcpy(d_fft->get_inbuf(), data_in, sizeof(gr_complex)*size);
-      }
-
-      d_fft->execute();     // compute the fft
-
-      volk_32fc_s32f_x2_power_spectral_density_32f(data_out, d_fft->get_outbuf(),
-                                                   size, 1.0, size);
+      d_fft->execute_psd(data_out, data_in, d_window, size);
       // Perform shift operation
       unsigned int len = (unsigned int)(floor(size/2.0));
       float *tmp = (float*)malloc(sizeof(float)*len);
@@ -408,8 +410,7 @@ namespace gr {
 	buildwindow();
 
 	// Reset FFTW plan for new size
-	delete d_fft;
-	d_fft = new fft::fft_complex(d_fftsize, true);
+	d_fft = spectrum_fft_service::acquire(d_fftsize);
 
 	volk_free(d_fbuf);
 	d_fbuf = (float*)volk_malloc(d_fftsize*sizeof(float),
@@ -437,24 +438,42 @@ namespace gr {
 	// If we have enough input for one full FFT, do it
 	if(datasize >= resid) {
 
-	  if(gr::high_res_timer_now() - d_last_time > d_update_time) {
+	  const bool update =
+	    gr::high_res_timer_now() - d_last_time > d_update_time;
+
+	  // Frames between updates are dropped untransformed unless a
+	  // hold policy folds them into the next displayed frame
+	  if(update || d_frame_hold != 0) {
             for(int n = 0; n < d_nconnections; n++) {
               // Fill up residbuf with d_fftsize number of items
               in = (const gr_complex*)input_items[n];
               memcpy(d_residbufs[n]+d_index, &in[j], sizeof(gr_complex)*resid);
 
               fft(d_fbuf, d_residbufs[n], d_fftsize);
-              for(int x = 0; x < d_fftsize; x++) {
-                d_magbufs[n][x] = (double)((1.0-d_fftavg)*d_magbufs[n][x] + (d_fftavg)*d_fbuf[x]);
+              if(d_frame_hold == 2) {
+                for(int x = 0; x < d_fftsize; x++) {
+                  // max-hold restarts from the first frame after each row
+                  if(!d_frame_held || d_fbuf[x] > d_magbufs[n][x])
+                    d_magbufs[n][x] = (double)d_fbuf[x];
+                }
+              }
+              else {
+                for(int x = 0; x < d_fftsize; x++) {
+                  d_magbufs[n][x] = (double)((1.0-d_fftavg)*d_magbufs[n][x] + (d_fftavg)*d_fbuf[x]);
+                }
               }
               //volk_32f_convert_64f_a(d_magbufs[n], d_fbuf, d_fftsize);
             }
+	    d_frame_held = true;
+	  }
 
+	  if(update) {
 	    d_last_time = gr::high_res_timer_now();
 	    d_qApplication->postEvent(d_main_gui,
 				      new WaterfallUpdateEvent(d_magbufs,
 							       d_fftsize,
 							       d_last_time));
+	    d_frame_held = false;
 	  }
 
 	  d_index = 0;
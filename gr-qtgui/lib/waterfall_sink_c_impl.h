@@ -26,6 +26,7 @@
 #include <gnuradio/qtgui/waterfall_sink_c.h>
 #include <gnuradio/filter/firdes.h>
 #include <gnuradio/fft/fft.h>
+#include "spectrum_fft_service.h"
 #include <gnuradio/high_res_timer.h>
 #include <gnuradio/thread/thread.h>
 #include <gnuradio/qtgui/waterfalldisplayform.h>
@@ -50,7 +51,7 @@ namespace gr {
       int d_nconnections;
 
       bool d_shift;
-      fft::fft_complex *d_fft;
+      spectrum_fft_service::sptr d_fft;
 
       int d_index;
       std::vector<gr_complex*> d_residbufs;
@@ -65,6 +66,9 @@ namespace gr {
       gr::high_res_timer_type d_update_time;
       gr::high_res_timer_type d_last_time;
 
+      int d_frame_hold;
+      bool d_frame_held;
+
       void windowreset();
       void buildwindow();
       void fftresize();
@@ -102,6 +106,8 @@ namespace gr {
       void set_intensity_range(const double min, const double max);
 
       void set_update_time(double t);
+      void set_frame_hold(int mode);
+      int frame_hold() const;
       void set_title(const std::string &title);
       void set_line_label(int which, const std::string &label);
       void set_line_alpha(int which, double alpha);
@@ -34,6 +34,11 @@ namespace gr {
     void calc_metric(int O, int D, const std::vector<T> &TABLE, const T *input,
 		     float *metric, digital::trellis_metric_type_t type);
 
+    //! float observations have their Euclidean distances batched through volk
+    template <>
+    void calc_metric<float>(int O, int D, const std::vector<float> &TABLE, const float *input,
+			    float *metric, digital::trellis_metric_type_t type);
+
     /*
       void calc_metric(int O, int D, const std::vector<short> &TABLE, const short *input,
       float *metric, digital::trellis_metric_type_t type);
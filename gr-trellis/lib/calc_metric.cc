@@ -22,7 +22,9 @@
 
 #include <float.h>
 #include <stdexcept>
+#include <vector>
 #include <gnuradio/trellis/calc_metric.h>
+#include <volk/volk.h>
 
 namespace gr {
   namespace trellis {
@@ -80,9 +82,61 @@ namespace gr {
     void calc_metric<int>(int O, int D, const std::vector<int> &TABLE, const int *input,
 			  float *metric, digital::trellis_metric_type_t type);
 
-    template
+    // Euclidean distances for float observations, one difference and
+    // one self dot product per observation through volk.  Short branch
+    // vectors (the usual 1-4 dimensions) stay in the scalar loop where
+    // the arithmetic is cheaper than the kernel dispatch.
+    static void
+    euclidean_metric_f(int O, int D, const std::vector<float> &TABLE,
+		       const float *input, float *metric)
+    {
+      if(D >= 8) {
+	std::vector<float> diff(D);
+	for(int o = 0; o < O; o++) {
+	  volk_32f_x2_subtract_32f(&diff[0], input, &TABLE[o*D], D);
+	  volk_32f_x2_dot_prod_32f(&metric[o], &diff[0], &diff[0], D);
+	}
+	return;
+      }
+      for(int o = 0; o < O; o++) {
+	metric[o] = 0.0;
+	for(int m = 0; m < D; m++) {
+	  float s = input[m]-TABLE[o*D+m];
+	  metric[o] += s * s;
+	}
+      }
+    }
+
+    template <>
     void calc_metric<float>(int O, int D, const std::vector<float> &TABLE, const float *input,
-			    float *metric, digital::trellis_metric_type_t type);
+			    float *metric, digital::trellis_metric_type_t type)
+    {
+      float minm = FLT_MAX;
+      int minmi = 0;
+
+      switch(type) {
+      case digital::TRELLIS_EUCLIDEAN:
+	euclidean_metric_f(O, D, TABLE, input, metric);
+	break;
+      case digital::TRELLIS_HARD_SYMBOL:
+	euclidean_metric_f(O, D, TABLE, input, metric);
+	for(int o = 0; o < O; o++) {
+	  if(metric[o] < minm) {
+	    minm = metric[o];
+	    minmi = o;
+	  }
+	}
+	for(int o = 0; o < O; o++) {
+	  metric[o] = (o == minmi ? 0.0 : 1.0);
+	}
+	break;
+      case digital::TRELLIS_HARD_BIT:
+	throw std::runtime_error("calc_metric: Invalid metric type (not yet implemented).");
+	break;
+      default:
+	throw std::runtime_error("calc_metric: Invalid metric type.");
+      }
+    }
 
     void calc_metric(int O, int D, const std::vector<short> &TABLE, const short *input,
 		     float *metric, digital::trellis_metric_type_t type)
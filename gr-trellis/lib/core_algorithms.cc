@@ -26,6 +26,10 @@
 #include <gnuradio/trellis/core_algorithms.h>
 #include <gnuradio/trellis/calc_metric.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace gr {
   namespace trellis {
 
@@ -43,6 +47,111 @@ namespace gr {
       return (a <= b ? a : b)-log(1+exp(a <= b ? a-b : b-a));
     }
 
+    // The recursions below spend their time in the innermost loop
+    // over the predecessors PS[j][i], and the vector-of-vectors
+    // layout costs two pointer chases per branch on top of the
+    // OS[PS[j][i]*I+PI[j][i]] lookup.  When every state has the same
+    // number of predecessors (true for any shift-register FSM, i.e.
+    // the power-of-two state counts that matter in practice) the
+    // tables flatten into contiguous arrays with the branch metric
+    // index folded in, and the add-compare-select step becomes a
+    // tight loop the compiler can keep in registers.
+    struct acs_tables {
+      int R;			// predecessors per state; 0 if ragged
+      std::vector<int> ps;	// [S*R] predecessor state
+      std::vector<int> pi;	// [S*R] input driving that branch
+      std::vector<int> bmi;	// [S*R] branch metric index
+    };
+
+    static void
+    make_acs_tables(int I, int S,
+		    const std::vector<int> &OS,
+		    const std::vector< std::vector<int> > &PS,
+		    const std::vector< std::vector<int> > &PI,
+		    acs_tables &t)
+    {
+      t.R = S > 0 ? (int)PS[0].size() : 0;
+      for(int j=0;j<S;j++)
+	if((int)PS[j].size() != t.R) {
+	  t.R = 0;		// ragged trellis; caller keeps the generic loop
+	  return;
+	}
+      t.ps.resize(S*t.R);
+      t.pi.resize(S*t.R);
+      t.bmi.resize(S*t.R);
+      for(int j=0;j<S;j++) {
+	for(int i=0;i<t.R;i++) {
+	  t.ps[j*t.R+i] = PS[j][i];
+	  t.pi[j*t.R+i] = PI[j][i];
+	  t.bmi[j*t.R+i] = OS[PS[j][i]*I+PI[j][i]];
+	}
+      }
+    }
+
+    // One Viterbi add-compare-select pass over all S states; returns
+    // the step's minimum metric for the normalization.  Ties resolve
+    // toward the lower branch index, like the generic loop.
+    static float
+    acs_step(int S, int R, const int *ps, const int *bmi,
+	     const float *alpha_in, const float *metric,
+	     float *alpha_out, int *trace)
+    {
+#if defined(__SSE2__)
+      if(R == 2 && (S & 3) == 0) {	// radix-2, four states at a time
+	__m128 vnorm = _mm_set1_ps(INF);
+	for(int j=0;j<S;j+=4) {
+	  float c0[4], c1[4];
+	  for(int l=0;l<4;l++) {	// gathers stay scalar on SSE2
+	    c0[l] = alpha_in[ps[(j+l)*2+0]] + metric[bmi[(j+l)*2+0]];
+	    c1[l] = alpha_in[ps[(j+l)*2+1]] + metric[bmi[(j+l)*2+1]];
+	  }
+	  __m128 v0 = _mm_loadu_ps(c0);
+	  __m128 v1 = _mm_loadu_ps(c1);
+	  __m128 vmin = _mm_min_ps(v0, v1);
+	  int sel = _mm_movemask_ps(_mm_cmplt_ps(v1, v0));
+	  _mm_storeu_ps(&alpha_out[j], vmin);
+	  trace[j+0] = sel & 1;
+	  trace[j+1] = (sel >> 1) & 1;
+	  trace[j+2] = (sel >> 2) & 1;
+	  trace[j+3] = (sel >> 3) & 1;
+	  vnorm = _mm_min_ps(vnorm, vmin);
+	}
+	float n4[4];
+	_mm_storeu_ps(n4, vnorm);
+	return min(min(n4[0],n4[1]), min(n4[2],n4[3]));
+      }
+#endif
+      float norm=INF;
+      for(int j=0;j<S;j++) {
+	const int *psj = &ps[j*R];
+	const int *bj = &bmi[j*R];
+	float minm=INF;
+	int minmi=0;
+	for(int i=0;i<R;i++) {
+	  float mm = alpha_in[psj[i]] + metric[bj[i]];
+	  if(mm<minm)
+	    minm=mm,minmi=i;
+	}
+	trace[j]=minmi;
+	alpha_out[j]=minm;
+	if(minm<norm) norm=minm;
+      }
+      return norm;
+    }
+
+    static void
+    normalize_metrics(int S, float norm, float *alpha)
+    {
+      int j=0;
+#if defined(__SSE2__)
+      __m128 vn = _mm_set1_ps(norm);
+      for(;j+4<=S;j+=4)
+	_mm_storeu_ps(&alpha[j], _mm_sub_ps(_mm_loadu_ps(&alpha[j]), vn));
+#endif
+      for(;j<S;j++)
+	alpha[j]-=norm;
+    }
+
     template <class T> void
     viterbi_algorithm(int I, int S, int O,
 		      const std::vector<int> &NS,
@@ -56,11 +165,14 @@ namespace gr {
     {
       std::vector<int> trace(S*K);
       std::vector<float> alpha(S*2);
+      acs_tables tbl;
       int alphai;
       float norm,mm,minm;
       int minmi;
       int st;
 
+      make_acs_tables(I, S, OS, PS, PI, tbl);
+
       if(S0<0) { // initial state not specified
 	for(int i=0;i<S;i++) alpha[0*S+i]=0;
       }
@@ -71,21 +183,27 @@ namespace gr {
 
       alphai=0;
       for(int k=0;k<K;k++) {
-	norm=INF;
-	for(int j=0;j<S;j++) { // for each next state do ACS
-          minm=INF;
-          minmi=0;
-          for(unsigned int i=0;i<PS[j].size();i++) {
-	    //int i0 = j*I+i;
-	    if((mm=alpha[alphai*S+PS[j][i]]+in[k*O+OS[PS[j][i]*I+PI[j][i]]])<minm)
-	      minm=mm,minmi=i;
-          }
-          trace[k*S+j]=minmi;
-          alpha[((alphai+1)%2)*S+j]=minm;
-          if(minm<norm) norm=minm;
+	if(tbl.R) {
+	  norm = acs_step(S, tbl.R, &tbl.ps[0], &tbl.bmi[0],
+			  &alpha[alphai*S], &in[k*O],
+			  &alpha[((alphai+1)%2)*S], &trace[k*S]);
 	}
-	for(int j=0;j<S;j++)
-          alpha[((alphai+1)%2)*S+j]-=norm; // normalize total metrics so they do not explode
+	else {
+	  norm=INF;
+	  for(int j=0;j<S;j++) { // for each next state do ACS
+	    minm=INF;
+	    minmi=0;
+	    for(unsigned int i=0;i<PS[j].size();i++) {
+	      //int i0 = j*I+i;
+	      if((mm=alpha[alphai*S+PS[j][i]]+in[k*O+OS[PS[j][i]*I+PI[j][i]]])<minm)
+		minm=mm,minmi=i;
+	    }
+	    trace[k*S+j]=minmi;
+	    alpha[((alphai+1)%2)*S+j]=minm;
+	    if(minm<norm) norm=minm;
+	  }
+	}
+	normalize_metrics(S, norm, &alpha[((alphai+1)%2)*S]); // so total metrics do not explode
 	alphai=(alphai+1)%2;
       }
 
@@ -155,11 +273,14 @@ namespace gr {
       std::vector<int> trace(S*K);
       std::vector<float> alpha(S*2);
       float *metric = new float[O];
+      acs_tables tbl;
       int alphai;
       float norm,mm,minm;
       int minmi;
       int st;
 
+      make_acs_tables(I, S, OS, PS, PI, tbl);
+
       if(S0<0) { // initial state not specified
 	for(int i=0;i<S;i++) alpha[0*S+i]=0;
       }
@@ -171,21 +292,27 @@ namespace gr {
       alphai=0;
       for(int k=0;k<K;k++) {
 	calc_metric(O, D, TABLE, &(in[k*D]), metric,TYPE); // calc metrics
-	norm=INF;
-	for(int j=0;j<S;j++) { // for each next state do ACS
-          minm=INF;
-          minmi=0;
-          for(unsigned int i=0;i<PS[j].size();i++) {
-	    //int i0 = j*I+i;
-	    if((mm=alpha[alphai*S+PS[j][i]]+metric[OS[PS[j][i]*I+PI[j][i]]])<minm)
-	      minm=mm,minmi=i;
-          }
-          trace[k*S+j]=minmi;
-          alpha[((alphai+1)%2)*S+j]=minm;
-          if(minm<norm) norm=minm;
+	if(tbl.R) {
+	  norm = acs_step(S, tbl.R, &tbl.ps[0], &tbl.bmi[0],
+			  &alpha[alphai*S], metric,
+			  &alpha[((alphai+1)%2)*S], &trace[k*S]);
 	}
-	for(int j=0;j<S;j++)
-          alpha[((alphai+1)%2)*S+j]-=norm; // normalize total metrics so they do not explode
+	else {
+	  norm=INF;
+	  for(int j=0;j<S;j++) { // for each next state do ACS
+	    minm=INF;
+	    minmi=0;
+	    for(unsigned int i=0;i<PS[j].size();i++) {
+	      //int i0 = j*I+i;
+	      if((mm=alpha[alphai*S+PS[j][i]]+metric[OS[PS[j][i]*I+PI[j][i]]])<minm)
+		minm=mm,minmi=i;
+	    }
+	    trace[k*S+j]=minmi;
+	    alpha[((alphai+1)%2)*S+j]=minm;
+	    if(minm<norm) norm=minm;
+	  }
+	}
+	normalize_metrics(S, norm, &alpha[((alphai+1)%2)*S]); // so total metrics do not explode
 	alphai=(alphai+1)%2;
       }
 
@@ -394,6 +521,9 @@ namespace gr {
       float norm,mm,minm;
       std::vector<float> alpha(S*(K+1));
       std::vector<float> beta(S*(K+1));
+      acs_tables tbl;
+
+      make_acs_tables(I, S, OS, PS, PI, tbl);
 
       if(S0<0) { // initial state not specified
 	for(int i=0;i<S;i++) alpha[0*S+i]=0;
@@ -405,18 +535,34 @@ namespace gr {
 
       for(int k=0;k<K;k++) { // forward recursion
 	norm=INF;
-	for(int j=0;j<S;j++) {
-          minm=INF;
-          for(unsigned int i=0;i<PS[j].size();i++) {
-	    //int i0 = j*I+i;
-	    mm=alpha[k*S+PS[j][i]]+priori[k*I+PI[j][i]]+prioro[k*O+OS[PS[j][i]*I+PI[j][i]]];
-	    minm=(*p2mymin)(minm,mm);
-          }
-          alpha[(k+1)*S+j]=minm;
-          if(minm<norm) norm=minm;
+	if(tbl.R) {	// p2mymin may be min_star, so no SSE here; the
+			// flat tables still drop the double indirection
+	  for(int j=0;j<S;j++) {
+	    const int *psj=&tbl.ps[j*tbl.R];
+	    const int *pij=&tbl.pi[j*tbl.R];
+	    const int *bj=&tbl.bmi[j*tbl.R];
+	    minm=INF;
+	    for(int i=0;i<tbl.R;i++) {
+	      mm=alpha[k*S+psj[i]]+priori[k*I+pij[i]]+prioro[k*O+bj[i]];
+	      minm=(*p2mymin)(minm,mm);
+	    }
+	    alpha[(k+1)*S+j]=minm;
+	    if(minm<norm) norm=minm;
+	  }
 	}
-	for(int j=0;j<S;j++)
-          alpha[(k+1)*S+j]-=norm; // normalize total metrics so they do not explode
+	else {
+	  for(int j=0;j<S;j++) {
+	    minm=INF;
+	    for(unsigned int i=0;i<PS[j].size();i++) {
+	      //int i0 = j*I+i;
+	      mm=alpha[k*S+PS[j][i]]+priori[k*I+PI[j][i]]+prioro[k*O+OS[PS[j][i]*I+PI[j][i]]];
+	      minm=(*p2mymin)(minm,mm);
+	    }
+	    alpha[(k+1)*S+j]=minm;
+	    if(minm<norm) norm=minm;
+	  }
+	}
+	normalize_metrics(S, norm, &alpha[(k+1)*S]); // so total metrics do not explode
       }
 
       if(SK<0) { // final state not specified
@@ -538,6 +684,9 @@ namespace gr {
       std::vector<float> alpha(S*(K+1));
       std::vector<float> beta(S*(K+1));
       float *prioro = new float[O*K];
+      acs_tables tbl;
+
+      make_acs_tables(I, S, OS, PS, PI, tbl);
 
       if(S0<0) { // initial state not specified
 	for(int i=0;i<S;i++) alpha[0*S+i]=0;
@@ -550,18 +699,33 @@ namespace gr {
       for(int k=0;k<K;k++) { // forward recursion
 	calc_metric(O, D, TABLE, &(observations[k*D]), &(prioro[k*O]),TYPE); // calc metrics
 	norm=INF;
-	for(int j=0;j<S;j++) {
-          minm=INF;
-          for(unsigned int i=0;i<PS[j].size();i++) {
-	    //int i0 = j*I+i;
-	    mm=alpha[k*S+PS[j][i]]+priori[k*I+PI[j][i]]+prioro[k*O+OS[PS[j][i]*I+PI[j][i]]];
-	    minm=(*p2mymin)(minm,mm);
-          }
-          alpha[(k+1)*S+j]=minm;
-          if(minm<norm) norm=minm;
+	if(tbl.R) {	// see siso_algorithm
+	  for(int j=0;j<S;j++) {
+	    const int *psj=&tbl.ps[j*tbl.R];
+	    const int *pij=&tbl.pi[j*tbl.R];
+	    const int *bj=&tbl.bmi[j*tbl.R];
+	    minm=INF;
+	    for(int i=0;i<tbl.R;i++) {
+	      mm=alpha[k*S+psj[i]]+priori[k*I+pij[i]]+prioro[k*O+bj[i]];
+	      minm=(*p2mymin)(minm,mm);
+	    }
+	    alpha[(k+1)*S+j]=minm;
+	    if(minm<norm) norm=minm;
+	  }
 	}
-	for(int j=0;j<S;j++)
-          alpha[(k+1)*S+j]-=norm; // normalize total metrics so they do not explode
+	else {
+	  for(int j=0;j<S;j++) {
+	    minm=INF;
+	    for(unsigned int i=0;i<PS[j].size();i++) {
+	      //int i0 = j*I+i;
+	      mm=alpha[k*S+PS[j][i]]+priori[k*I+PI[j][i]]+prioro[k*O+OS[PS[j][i]*I+PI[j][i]]];
+	      minm=(*p2mymin)(minm,mm);
+	    }
+	    alpha[(k+1)*S+j]=minm;
+	    if(minm<norm) norm=minm;
+	  }
+	}
+	normalize_metrics(S, norm, &alpha[(k+1)*S]); // so total metrics do not explode
       }
 
       if(SK<0) { // final state not specified
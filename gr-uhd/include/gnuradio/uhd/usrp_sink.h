@@ -133,6 +133,26 @@ namespace gr {
        */
       virtual void set_start_time(const ::uhd::time_spec_t &time) = 0;
 
+      /*!
+       * *Advanced use only:*
+       * Enable an asynchronous queue for tagged bursts.
+       *
+       * When the depth is non-zero, work() copies each tagged burst
+       * into a queue and returns immediately; a dedicated transmit
+       * thread streams the queued bursts at their scheduled times.
+       * This lets upstream blocks run ahead while a timed send waits
+       * inside UHD, at the price of one extra copy per burst. work()
+       * blocks only when the queue already holds \p depth bursts.
+       * Set this before starting the flow graph.
+       *
+       * A depth of zero (the default) keeps the synchronous inline
+       * behavior. Only effective when GNU Radio is built against the
+       * UHD streamer API.
+       *
+       * \param depth maximum number of queued bursts, 0 to disable
+       */
+      virtual void set_burst_queue_depth(size_t depth) = 0;
+
       /*!
        * Returns identifying information about this USRP's configuration.
        * Returns motherboard ID, name, and serial.
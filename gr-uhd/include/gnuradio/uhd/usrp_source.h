@@ -108,6 +108,14 @@ namespace gr {
        * (uint64 seconds, and double fractional seconds).
        * A timestamp tag is produced at start() and after overflows.
        *
+       * Stream args:
+       *
+       * In addition to the arguments passed through to the streamer,
+       * this block understands the following stream args:
+       *  - recv_batching: the number of packets to span per receive
+       *    call; larger batches amortize the per-call overhead of the
+       *    transport and sample converters on multi-channel devices
+       *
        * See the UHD manual for more detailed documentation:
        * http://code.ettus.com/redmine/ettus/projects/uhd/wiki
        *
@@ -131,6 +139,24 @@ namespace gr {
        */
       virtual void set_start_time(const ::uhd::time_spec_t &time) = 0;
 
+      /*!
+       * *Advanced use only:*
+       * Align scheduler work calls to whole receive packets.
+       *
+       * When enabled, the block requests output in multiples of the
+       * streamer's maximum samples per packet, so each recv() unloads
+       * complete transport buffers directly into the downstream
+       * buffer. This avoids UHD's internal rebuffering of partial
+       * packets, which otherwise costs an extra copy of the remainder
+       * at high sample rates. Set this before starting the flow graph.
+       *
+       * Only effective when GNU Radio is built against the UHD
+       * streamer API.
+       *
+       * \param enable true to align receives to packet boundaries
+       */
+      virtual void set_recv_packet_aligned(bool enable) = 0;
+
       /*!
        * *Advanced use only:*
        * Issue a stream command to all channels in this source block.
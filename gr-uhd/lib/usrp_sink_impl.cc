@@ -24,6 +24,7 @@
 #include "gr_uhd_common.h"
 #include <gnuradio/io_signature.h>
 #include <boost/make_shared.hpp>
+#include <boost/bind.hpp>
 #include <stdexcept>
 
 namespace gr {
@@ -66,7 +67,11 @@ namespace gr {
         _stream_args(stream_args),
         _nchan(stream_args.channels.size()),
         _stream_now(_nchan == 1),
-        _start_time_set(false)
+        _start_time_set(false),
+#ifdef GR_UHD_USE_STREAM_API
+        _send_running(false),
+#endif
+        _burst_queue_depth(0)
     {
       if(stream_args.cpu_format == "fc32")
         _type = boost::make_shared< ::uhd::io_type_t >(::uhd::io_type_t::COMPLEX_FLOAT32);
@@ -77,6 +82,11 @@ namespace gr {
 
     usrp_sink_impl::~usrp_sink_impl()
     {
+#ifdef GR_UHD_USE_STREAM_API
+      if(_send_running) {
+        this->stop_send_thread();
+      }
+#endif
     }
 
     ::uhd::dict<std::string, std::string>
@@ -477,6 +487,14 @@ namespace gr {
         this->tag_work(ninput_items);
 
 #ifdef GR_UHD_USE_STREAM_API
+      //in async burst mode, deposit the samples and return;
+      //the send thread streams them at their scheduled time
+      if(_send_running) {
+        this->queue_burst(input_items, ninput_items);
+        _metadata.time_spec += ::uhd::time_spec_t(0, ninput_items, _sample_rate);
+        return ninput_items;
+      }
+
       //send all ninput_items with metadata
       const size_t num_sent = _tx_stream->send
         (input_items, ninput_items, _metadata, 1.0);
@@ -491,6 +509,76 @@ namespace gr {
       return num_sent;
     }
 
+    /***********************************************************************
+     * Async burst queue
+     **********************************************************************/
+#ifdef GR_UHD_USE_STREAM_API
+    void
+    usrp_sink_impl::queue_burst(const gr_vector_const_void_star &input_items,
+                                int nsamps)
+    {
+      const size_t bpi = ::uhd::convert::get_bytes_per_item(_stream_args.cpu_format);
+
+      async_burst_sptr burst(new async_burst_t());
+      burst->meta = _metadata;
+      burst->nsamps = nsamps;
+      burst->buffs.resize(_nchan);
+      for(size_t i = 0; i < _nchan; i++) {
+        const char *in = (const char *)input_items[i];
+        burst->buffs[i].assign(in, in + nsamps*bpi);
+      }
+
+      gr::thread::scoped_lock lock(_queue_mutex);
+      while(_send_running and _burst_queue.size() >= _burst_queue_depth) {
+        _queue_not_full.wait(lock);
+      }
+      if(not _send_running)
+        return;
+      _burst_queue.push_back(burst);
+      _queue_not_empty.notify_one();
+    }
+
+    void
+    usrp_sink_impl::send_loop(void)
+    {
+      while(true) {
+        async_burst_sptr burst;
+        {
+          gr::thread::scoped_lock lock(_queue_mutex);
+          while(_send_running and _burst_queue.empty()) {
+            _queue_not_empty.wait(lock);
+          }
+          //drain any queued bursts before shutting down
+          if(_burst_queue.empty())
+            return;
+          burst = _burst_queue.front();
+          _burst_queue.pop_front();
+          _queue_not_full.notify_one();
+        }
+
+        gr_vector_const_void_star buffs(_nchan);
+        for(size_t i = 0; i < _nchan; i++) {
+          buffs[i] = &burst->buffs[i].front();
+        }
+
+        //a timed burst now waits for its slot here, not in work()
+        _tx_stream->send(buffs, burst->nsamps, burst->meta, 1.0);
+      }
+    }
+
+    void
+    usrp_sink_impl::stop_send_thread(void)
+    {
+      {
+        gr::thread::scoped_lock lock(_queue_mutex);
+        _send_running = false;
+        _queue_not_empty.notify_one();
+        _queue_not_full.notify_all();
+      }
+      _send_thread.join();
+    }
+#endif
+
     /***********************************************************************
      * Tag Work
      **********************************************************************/
@@ -558,6 +646,12 @@ namespace gr {
       _stream_now = false;
     }
 
+    void
+    usrp_sink_impl::set_burst_queue_depth(size_t depth)
+    {
+      _burst_queue_depth = depth;
+    }
+
     //Send an empty start-of-burst packet to begin streaming.
     //Set at a time in the near future to avoid late packets.
     bool
@@ -565,6 +659,12 @@ namespace gr {
     {
 #ifdef GR_UHD_USE_STREAM_API
       _tx_stream = _dev->get_tx_stream(_stream_args);
+
+      if(_burst_queue_depth > 0 and not _send_running) {
+        _send_running = true;
+        _send_thread =
+          gr::thread::thread(boost::bind(&usrp_sink_impl::send_loop, this));
+      }
 #endif
 
       _metadata.start_of_burst = true;
@@ -594,6 +694,11 @@ namespace gr {
     bool
     usrp_sink_impl::stop(void)
     {
+#ifdef GR_UHD_USE_STREAM_API
+      if(_send_running) {
+        this->stop_send_thread();
+      }
+#endif
       _metadata.start_of_burst = false;
       _metadata.end_of_burst = true;
       _metadata.has_time_spec = false;
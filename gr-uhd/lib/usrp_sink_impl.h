@@ -21,7 +21,9 @@
  */
 
 #include <gnuradio/uhd/usrp_sink.h>
+#include <gnuradio/thread/thread.h>
 #include <uhd/convert.hpp>
+#include <deque>
 
 static const pmt::pmt_t SOB_KEY = pmt::string_to_symbol("tx_sob");
 static const pmt::pmt_t EOB_KEY = pmt::string_to_symbol("tx_eob");
@@ -108,6 +110,7 @@ namespace gr {
       void clear_command_time(size_t mboard);
       void set_user_register(const uint8_t addr, const uint32_t data, size_t mboard);
       void set_start_time(const ::uhd::time_spec_t &time);
+      void set_burst_queue_depth(size_t depth);
 
       bool start(void);
       bool stop(void);
@@ -135,6 +138,27 @@ namespace gr {
 
       //stream tags related stuff
       std::vector<tag_t> _tags;
+
+#ifdef GR_UHD_USE_STREAM_API
+      //async burst queue (see set_burst_queue_depth)
+      struct async_burst_t {
+        ::uhd::tx_metadata_t meta;
+        size_t nsamps;
+        std::vector<std::vector<char> > buffs;
+      };
+      typedef boost::shared_ptr<async_burst_t> async_burst_sptr;
+
+      void queue_burst(const gr_vector_const_void_star &input_items, int nsamps);
+      void send_loop();
+      void stop_send_thread();
+
+      std::deque<async_burst_sptr> _burst_queue;
+      gr::thread::mutex _queue_mutex;
+      gr::thread::condition_variable _queue_not_full, _queue_not_empty;
+      gr::thread::thread _send_thread;
+      bool _send_running;
+#endif
+      size_t _burst_queue_depth;
     };
 
   } /* namespace uhd */
@@ -23,6 +23,7 @@
 #include "usrp_source_impl.h"
 #include "gr_uhd_common.h"
 #include <gnuradio/io_signature.h>
+#include <gnuradio/high_res_timer.h>
 #include <boost/format.hpp>
 #include <boost/thread/thread.hpp>
 #include <boost/make_shared.hpp>
@@ -70,6 +71,7 @@ namespace gr {
       _nchan(stream_args.channels.size()),
       _stream_now(_nchan == 1),
       _tag_now(false),
+      _recv_packet_aligned(false),
       _start_time_set(false)
     {
       if(stream_args.cpu_format == "fc32")
@@ -479,6 +481,12 @@ namespace gr {
       _stream_now = false;
     }
 
+    void
+    usrp_source_impl::set_recv_packet_aligned(bool enable)
+    {
+      _recv_packet_aligned = enable;
+    }
+
     void
     usrp_source_impl::issue_stream_cmd(const ::uhd::stream_cmd_t &cmd)
     {
@@ -497,6 +505,19 @@ namespace gr {
         _rx_stream = _dev->get_rx_stream(_stream_args);
         _samps_per_packet = _rx_stream->get_max_num_samps();
       }
+      //the stream args can specify whole-packet batching for the work
+      //call: recv_batching=N makes every recv span N packets, so the
+      //per-call transport and converter overhead (which dominates on
+      //multi-channel devices) is amortized across the batch
+      const size_t batching = _stream_args.args.cast<size_t>("recv_batching", 0);
+      if(batching > 0) {
+        set_output_multiple(_samps_per_packet * batching);
+      }
+      //whole-packet work calls keep recv() from splitting a packet
+      //across calls, which would rebuffer the remainder inside UHD
+      else if(_recv_packet_aligned) {
+        set_output_multiple(_samps_per_packet);
+      }
 #endif
       //setup a stream command that starts streaming slightly in the future
       static const double reasonable_delay = 0.1; //order of magnitude over RTT
@@ -648,6 +669,11 @@ namespace gr {
                                pmt::from_double(_samp_rate), _id);
             this->add_item_tag(i, nitems_written(0), FREQ_KEY,
                                pmt::from_double(_center_freq), _id);
+            //stamp the host timer next to rx_time so latency probes
+            //downstream can measure antenna-to-block delay
+            this->add_item_tag(i, nitems_written(0), LATENCY_KEY,
+                               pmt::from_uint64((uint64_t)gr::high_res_timer_now()),
+                               _id);
           }
         }
         break;
@@ -27,6 +27,7 @@
 static const pmt::pmt_t TIME_KEY = pmt::string_to_symbol("rx_time");
 static const pmt::pmt_t RATE_KEY = pmt::string_to_symbol("rx_rate");
 static const pmt::pmt_t FREQ_KEY = pmt::string_to_symbol("rx_freq");
+static const pmt::pmt_t LATENCY_KEY = pmt::string_to_symbol("latency");
 
 namespace gr {
   namespace uhd {
@@ -111,6 +112,7 @@ namespace gr {
       void set_command_time(const ::uhd::time_spec_t &time_spec, size_t mboard);
       void set_user_register(const uint8_t addr, const uint32_t data, size_t mboard);
       void set_start_time(const ::uhd::time_spec_t &time);
+      void set_recv_packet_aligned(bool enable);
 
       void issue_stream_cmd(const ::uhd::stream_cmd_t &cmd);
       void clear_command_time(size_t mboard);
@@ -134,6 +136,7 @@ namespace gr {
 #endif
       size_t _nchan;
       bool _stream_now, _tag_now;
+      bool _recv_packet_aligned;
       ::uhd::rx_metadata_t _metadata;
       pmt::pmt_t _id;
 
@@ -0,0 +1,72 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOCODER_CODEC2_ENCODE_NCHAN_SP_H
+#define INCLUDED_VOCODER_CODEC2_ENCODE_NCHAN_SP_H
+
+#include <gnuradio/vocoder/api.h>
+#include <gnuradio/sync_decimator.h>
+
+namespace gr {
+  namespace vocoder {
+
+    /*!
+     * \brief Multi-channel CODEC2 Vocoder Encoder
+     * \ingroup audio_blk
+     *
+     * Encodes \p nchan voice channels in one block, spreading the
+     * channels over an internal thread pool. When transcoding many
+     * channels, one codec2_encode_sp per channel spends more time in
+     * per-block scheduler overhead than in the codec for its 20 ms
+     * frames; this block amortizes that overhead over all channels
+     * while keeping an independent Codec2 state per channel.
+     *
+     * Input: Vector of \p nchan interleaved 16-bit shorts per sample
+     * time (channel 0 first), sampling rate 8 kHz.
+     *
+     * Output: Vector of \p nchan * 50 unpacked bits per 160 input
+     * vectors, the 50 bits of channel 0 first. Each channel's bits
+     * are laid out exactly as codec2_encode_sp produces them, so a
+     * deinterleaved channel feeds gr::vocoder::codec2_decode_ps
+     * unchanged.
+     */
+    class VOCODER_API codec2_encode_nchan_sp : virtual public sync_decimator
+    {
+    public:
+      // gr::vocoder::codec2_encode_nchan_sp::sptr
+      typedef boost::shared_ptr<codec2_encode_nchan_sp> sptr;
+
+      /*!
+       * \brief Make multi-channel Codec2 encoder block.
+       *
+       * \param nchan number of interleaved voice channels.
+       * \param nthreads encoder threads to use, capped at \p nchan;
+       *        0 means one per hardware thread. With 1 the encoding
+       *        runs inline in work() with no handoff at all.
+       */
+      static sptr make(int nchan, int nthreads = 0);
+    };
+
+  } /* namespace vocoder */
+} /* namespace gr */
+
+#endif /* INCLUDED_VOCODER_CODEC2_ENCODE_NCHAN_SP_H */
@@ -0,0 +1,199 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "codec2_encode_nchan_sp_impl.h"
+
+extern "C" {
+#include "codec2/codec2.h"
+}
+
+#include <gnuradio/io_signature.h>
+#include <boost/bind.hpp>
+#include <stdexcept>
+
+namespace gr {
+  namespace vocoder {
+
+    codec2_encode_nchan_sp::sptr
+    codec2_encode_nchan_sp::make(int nchan, int nthreads)
+    {
+      return gnuradio::get_initial_sptr
+	(new codec2_encode_nchan_sp_impl(nchan, nthreads));
+    }
+
+    codec2_encode_nchan_sp_impl::codec2_encode_nchan_sp_impl(int nchan, int nthreads)
+      : sync_decimator("vocoder_codec2_encode_nchan_sp",
+			  io_signature::make(1, 1, nchan * sizeof(short)),
+			  io_signature::make(1, 1, nchan * CODEC2_BITS_PER_FRAME * sizeof(char)),
+			  CODEC2_SAMPLES_PER_FRAME),
+	d_nchan(nchan),
+	d_in(0), d_out(0), d_nframes(0),
+	d_next_chan(0), d_nworking(0), d_gen(0), d_exit(false)
+    {
+      if(nchan < 1)
+	throw std::invalid_argument("codec2_encode_nchan_sp_impl: nchan must be >= 1");
+
+      if(nthreads <= 0)
+	nthreads = boost::thread::hardware_concurrency();
+      if(nthreads < 1)
+	nthreads = 1;
+      if(nthreads > nchan)
+	nthreads = nchan;		// never more threads than channels
+      d_nthreads = nthreads;
+
+      for(int i = 0; i < nchan; i++) {
+	void *c = codec2_create();
+	if(c == 0) {
+	  for(int j = 0; j < i; j++)
+	    codec2_destroy(d_codec2[j]);
+	  throw std::runtime_error("codec2_encode_nchan_sp_impl: codec2_create failed");
+	}
+	d_codec2.push_back(c);
+      }
+
+      // The scheduler thread that calls work() encodes too, so spawn
+      // one worker fewer than the requested width.
+      for(int i = 0; i < d_nthreads - 1; i++)
+	d_threads.create_thread(
+	  boost::bind(&codec2_encode_nchan_sp_impl::worker_loop, this));
+    }
+
+    codec2_encode_nchan_sp_impl::~codec2_encode_nchan_sp_impl()
+    {
+      {
+	gr::thread::scoped_lock lock(d_mutex);
+	d_exit = true;
+	d_task_cond.notify_all();
+      }
+      d_threads.join_all();
+
+      for(int i = 0; i < d_nchan; i++)
+	codec2_destroy(d_codec2[i]);
+    }
+
+    void
+    codec2_encode_nchan_sp_impl::worker_loop()
+    {
+      unsigned int seen_gen = 0;
+
+      while(1) {
+	{
+	  gr::thread::scoped_lock lock(d_mutex);
+	  while(d_gen == seen_gen && !d_exit)
+	    d_task_cond.wait(lock);
+	  if(d_exit)
+	    return;
+	  seen_gen = d_gen;
+	}
+	encode_channels();
+      }
+    }
+
+    void
+    codec2_encode_nchan_sp_impl::encode_channels()
+    {
+      unsigned char frame_buf[CODEC2_BYTES_PER_FRAME];
+      short samples[CODEC2_SAMPLES_PER_FRAME];
+
+      while(1) {
+	int chan;
+	{
+	  gr::thread::scoped_lock lock(d_mutex);
+	  if(d_next_chan >= d_nchan)
+	    return;
+	  chan = d_next_chan++;
+	}
+
+	encode_channel(chan, frame_buf, samples);
+
+	{
+	  gr::thread::scoped_lock lock(d_mutex);
+	  if(--d_nworking == 0)
+	    d_done_cond.notify_all();
+	}
+      }
+    }
+
+    void
+    codec2_encode_nchan_sp_impl::encode_channel(int chan,
+						unsigned char *frame_buf,
+						short *samples)
+    {
+      for(int f = 0; f < d_nframes; f++) {
+	// gather this channel's frame out of the interleave
+	const short *in = d_in + ((size_t)f * CODEC2_SAMPLES_PER_FRAME) * d_nchan + chan;
+	for(int s = 0; s < CODEC2_SAMPLES_PER_FRAME; s++)
+	  samples[s] = in[(size_t)s * d_nchan];
+
+	codec2_encode(d_codec2[chan], frame_buf, samples);
+	unpack_frame(frame_buf,
+		     d_out + ((size_t)f * d_nchan + chan) * CODEC2_BITS_PER_FRAME);
+      }
+    }
+
+    int
+    codec2_encode_nchan_sp_impl::work(int noutput_items,
+				      gr_vector_const_void_star &input_items,
+				      gr_vector_void_star &output_items)
+    {
+      {
+	gr::thread::scoped_lock lock(d_mutex);
+	d_in = (const short*)input_items[0];
+	d_out = (unsigned char*)output_items[0];
+	d_nframes = noutput_items;
+	d_next_chan = 0;
+	d_nworking = d_nchan;
+	d_gen++;
+	d_task_cond.notify_all();
+      }
+
+      // pull our weight alongside the workers
+      encode_channels();
+
+      {
+	gr::thread::scoped_lock lock(d_mutex);
+	while(d_nworking > 0)
+	  d_done_cond.wait(lock);
+      }
+
+      return noutput_items;
+    }
+
+    void
+    codec2_encode_nchan_sp_impl::unpack_frame(const unsigned char *packed, unsigned char *out)
+    {
+      int byte_idx = 0, bit_idx = 0;
+      for(int k = 0; k < CODEC2_BITS_PER_FRAME; k++) {
+	out[k] = (packed[byte_idx] >> (7-bit_idx)) & 0x01;
+	bit_idx = (bit_idx + 1) % 8;
+	if (bit_idx == 0) {
+	  byte_idx++;
+	}
+      }
+    }
+
+  } /* namespace vocoder */
+} /* namespace gr */
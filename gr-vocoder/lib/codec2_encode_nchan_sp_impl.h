@@ -0,0 +1,77 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2014 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOCODER_CODEC2_ENCODE_NCHAN_SP_IMPL_H
+#define INCLUDED_VOCODER_CODEC2_ENCODE_NCHAN_SP_IMPL_H
+
+#include <gnuradio/vocoder/codec2_encode_nchan_sp.h>
+#include <gnuradio/thread/thread.h>
+#include <boost/thread/thread.hpp>
+#include <vector>
+
+namespace gr {
+  namespace vocoder {
+
+    class codec2_encode_nchan_sp_impl : public codec2_encode_nchan_sp
+    {
+    private:
+      int d_nchan;
+      int d_nthreads;
+      std::vector<void*> d_codec2;	//!< one stateful encoder per channel
+
+      // One encode pass per work() call: work publishes the in/out
+      // pointers and frame count, bumps d_gen to release the pool,
+      // and then claims channels itself alongside the workers.  A
+      // worker owns a channel for all frames of the pass, since the
+      // codec2 state must see that channel's samples in order.
+      const short    *d_in;
+      unsigned char  *d_out;
+      int             d_nframes;
+      int             d_next_chan;	//!< next channel to claim
+      int             d_nworking;	//!< channels not yet finished
+      unsigned int    d_gen;		//!< bumped to start a pass
+      bool            d_exit;
+
+      gr::thread::mutex d_mutex;
+      gr::thread::condition_variable d_task_cond;	//!< new pass or exit
+      gr::thread::condition_variable d_done_cond;	//!< pass complete
+      boost::thread_group d_threads;
+
+      void worker_loop();
+      //! claim and encode channels until the pass runs dry
+      void encode_channels();
+      void encode_channel(int chan, unsigned char *frame_buf, short *samples);
+      void unpack_frame(const unsigned char *packed, unsigned char *out); //!< Unpack the bytes from codec2 into unpacked bits
+
+    public:
+      codec2_encode_nchan_sp_impl(int nchan, int nthreads);
+      ~codec2_encode_nchan_sp_impl();
+
+      int work(int noutput_items,
+	       gr_vector_const_void_star &input_items,
+	       gr_vector_void_star &output_items);
+    };
+
+  } /* namespace vocoder */
+} /* namespace gr */
+
+#endif /* INCLUDED_VOCODER_CODEC2_ENCODE_NCHAN_SP_IMPL_H */
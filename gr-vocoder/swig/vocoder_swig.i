@@ -31,6 +31,7 @@
 #include "gnuradio/vocoder/alaw_decode_bs.h"
 #include "gnuradio/vocoder/alaw_encode_sb.h"
 #include "gnuradio/vocoder/codec2_decode_ps.h"
+#include "gnuradio/vocoder/codec2_encode_nchan_sp.h"
 #include "gnuradio/vocoder/codec2_encode_sp.h"
 #include "gnuradio/vocoder/cvsd_decode_bs.h"
 #include "gnuradio/vocoder/cvsd_encode_sb.h"
@@ -49,6 +50,7 @@
 %include "gnuradio/vocoder/alaw_decode_bs.h"
 %include "gnuradio/vocoder/alaw_encode_sb.h"
 %include "gnuradio/vocoder/codec2_decode_ps.h"
+%include "gnuradio/vocoder/codec2_encode_nchan_sp.h"
 %include "gnuradio/vocoder/codec2_encode_sp.h"
 %include "gnuradio/vocoder/cvsd_decode_bs.h"
 %include "gnuradio/vocoder/cvsd_encode_sb.h"
@@ -66,6 +68,7 @@
 GR_SWIG_BLOCK_MAGIC2(vocoder, alaw_decode_bs);
 GR_SWIG_BLOCK_MAGIC2(vocoder, alaw_encode_sb);
 GR_SWIG_BLOCK_MAGIC2(vocoder, codec2_decode_ps);
+GR_SWIG_BLOCK_MAGIC2(vocoder, codec2_encode_nchan_sp);
 GR_SWIG_BLOCK_MAGIC2(vocoder, codec2_encode_sp);
 GR_SWIG_BLOCK_MAGIC2(vocoder, cvsd_decode_bs);
 GR_SWIG_BLOCK_MAGIC2(vocoder, cvsd_encode_sb);
@@ -15,56 +15,23 @@
 
 namespace fs = boost::filesystem;
 
-int main(int argc, char *argv[]) {
-    // Adding program options
-    boost::program_options::options_description desc("Options");
-    desc.add_options()
-      ("help,h", "Print help messages")
-      ("benchmark,b",
-            boost::program_options::value<bool>()->default_value( false )
-                                                ->implicit_value( true ),
-            "Run all kernels (benchmark mode)")
-      ("tests-regex,R",
-            boost::program_options::value<std::string>(),
-            "Run tests matching regular expression.")
-      ;
+//a nonzero override replaces the default vector length of every profiled
+//kernel; used to characterize the small call-size class (--sized)
+static int g_vlen_override = 0;
 
-    // Handle the options that were given
-    boost::program_options::variables_map vm;
-    bool benchmark_mode;
-    std::string kernel_regex;
-    bool store_results = true;
-    try {
-        boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
-        boost::program_options::notify(vm);
-        benchmark_mode = vm.count("benchmark")?vm["benchmark"].as<bool>():false;
-        if ( vm.count("tests-regex" ) ) {
-            kernel_regex = vm["tests-regex"].as<std::string>();
-            store_results = false;
-            std::cout << "Warning: using a regexp will not save results to a config" << std::endl;
-        }
-        else {
-            kernel_regex = ".*";
-            store_results = true;
-        }
-    } catch (boost::program_options::error& error) {
-        std::cerr << "Error: " << error.what() << std::endl << std::endl;
-        std::cerr << desc << std::endl;
-        return 1;
-    }
-    /** --help option
-*/
-    if ( vm.count("help") )
-    {
-      std::cout << "The VOLK profiler." << std::endl
-                << desc << std::endl;
-      return 0;
-    }
+static int vlen_or(int len)
+{
+    return (g_vlen_override > 0)? g_vlen_override : len;
+}
 
+#undef VOLK_PROFILE
+#define VOLK_PROFILE(func, tol, scalar, len, iter, results, bnmode, kernel_regex) run_volk_tests(func##_get_func_desc(), (void (*)())func##_manual, std::string(#func), tol, scalar, vlen_or(len), iter, results, "NULL", bnmode, kernel_regex)
+#undef VOLK_PUPPET_PROFILE
+#define VOLK_PUPPET_PROFILE(func, puppet_master_func, tol, scalar, len, iter, results, bnmode, kernel_regex) run_volk_tests(func##_get_func_desc(), (void (*)())func##_manual, std::string(#func), tol, scalar, vlen_or(len), iter, results, std::string(#puppet_master_func), bnmode, kernel_regex)
 
-    // Run tests
-    std::vector<std::string> results;
 
+void run_profile(std::vector<std::string> &results, bool benchmark_mode, std::string kernel_regex)
+{
     //VOLK_PROFILE(volk_16i_x5_add_quad_16i_x4, 1e-4, 2046, 10000, &results, benchmark_mode, kernel_regex);
     //VOLK_PROFILE(volk_16i_branch_4_state_8, 1e-4, 2046, 10000, &results, benchmark_mode, kernel_regex);
     VOLK_PUPPET_PROFILE(volk_32fc_s32fc_rotatorpuppet_32fc, volk_32fc_s32fc_x2_rotator_32fc, 1e-2, (lv_32fc_t)lv_cmake(0.953939201, 0.3), 20462, 10000, &results, benchmark_mode, kernel_regex);
@@ -153,6 +120,70 @@ int main(int argc, char *argv[]) {
     //VOLK_PROFILE(volk_32fc_s32fc_multiply_32fc, 1e-4, lv_32fc_t(1.0, 0.5), 204602, 1000, &results, benchmark_mode, kernel_regex);
     VOLK_PROFILE(volk_32fc_s32fc_multiply_32fc, 1e-4, 0, 204602, 1000, &results, benchmark_mode, kernel_regex);
     VOLK_PROFILE(volk_32f_s32f_multiply_32f, 1e-4, 1.0, 204602, 10000, &results, benchmark_mode, kernel_regex);
+}
+
+int main(int argc, char *argv[]) {
+    // Adding program options
+    boost::program_options::options_description desc("Options");
+    desc.add_options()
+      ("help,h", "Print help messages")
+      ("benchmark,b",
+            boost::program_options::value<bool>()->default_value( false )
+                                                ->implicit_value( true ),
+            "Run all kernels (benchmark mode)")
+      ("tests-regex,R",
+            boost::program_options::value<std::string>(),
+            "Run tests matching regular expression.")
+      ("sized,s",
+            boost::program_options::value<bool>()->default_value( false )
+                                                ->implicit_value( true ),
+            "Also profile a small call-size class and write a sized dispatch table")
+      ("sized-vlen",
+            boost::program_options::value<int>()->default_value( 1024 ),
+            "Vector length of the small call-size class")
+      ;
+
+    // Handle the options that were given
+    boost::program_options::variables_map vm;
+    bool benchmark_mode;
+    bool sized_mode = false;
+    int sized_vlen = 1024;
+    std::string kernel_regex;
+    bool store_results = true;
+    try {
+        boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+        boost::program_options::notify(vm);
+        benchmark_mode = vm.count("benchmark")?vm["benchmark"].as<bool>():false;
+        sized_mode = vm.count("sized")?vm["sized"].as<bool>():false;
+        sized_vlen = vm["sized-vlen"].as<int>();
+        if ( vm.count("tests-regex" ) ) {
+            kernel_regex = vm["tests-regex"].as<std::string>();
+            store_results = false;
+            std::cout << "Warning: using a regexp will not save results to a config" << std::endl;
+        }
+        else {
+            kernel_regex = ".*";
+            store_results = true;
+        }
+    } catch (boost::program_options::error& error) {
+        std::cerr << "Error: " << error.what() << std::endl << std::endl;
+        std::cerr << desc << std::endl;
+        return 1;
+    }
+    /** --help option
+*/
+    if ( vm.count("help") )
+    {
+      std::cout << "The VOLK profiler." << std::endl
+                << desc << std::endl;
+      return 0;
+    }
+
+
+    // Run tests
+    std::vector<std::string> results;
+
+    run_profile(results, benchmark_mode, kernel_regex);
 
     // Until we can update the config on a kernel by kernel basis
     // do not overwrite volk_config when using a regex.
@@ -187,4 +218,48 @@ int main(int argc, char *argv[]) {
     else {
         std::cout << "Warning: config not generated" << std::endl;
     }
+
+    // Profile the small call-size class and write the size-classed
+    // dispatch table consumed by volk_sized_pref_impl at init time.
+    if(sized_mode && store_results) {
+        std::cout << "Profiling small call-size class (vlen " << sized_vlen << ")..." << std::endl;
+
+        std::vector<std::string> small_results;
+        g_vlen_override = sized_vlen;
+        run_profile(small_results, benchmark_mode, kernel_regex);
+        g_vlen_override = 0;
+
+        char path[1024];
+        volk_get_sized_config_path(path);
+
+        const fs::path config_path(path);
+
+        if (not fs::exists(config_path.branch_path()))
+        {
+            std::cout << "Creating " << config_path.branch_path() << "..." << std::endl;
+            fs::create_directories(config_path.branch_path());
+        }
+
+        std::cout << "Writing " << config_path << "..." << std::endl;
+        std::ofstream config(config_path.string().c_str());
+        if(!config.is_open()) {
+            std::cout << "Error opening file " << config_path << std::endl;
+        }
+
+        config << "\
+#this file is generated by volk_profile --sized.\n\
+#lines are: kernel_name max_points impl_a impl_u\n\
+";
+
+        BOOST_FOREACH(std::string result, small_results) {
+            //results are "name impl_a impl_u"; insert the class bound after the name
+            const size_t split = result.find(' ');
+            if(split == std::string::npos) continue;
+            config << result.substr(0, split) << " " << sized_vlen << result.substr(split) << std::endl;
+        }
+        config.close();
+    }
+    else if(sized_mode) {
+        std::cout << "Warning: sized config not generated" << std::endl;
+    }
 }
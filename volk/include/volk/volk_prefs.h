@@ -13,16 +13,35 @@ typedef struct volk_arch_pref
     char impl_u[128]; //best unaligned impl
 } volk_arch_pref_t;
 
+//size-classed preference: applies to calls with up to max_points points
+typedef struct volk_sized_pref
+{
+    char name[128];          //name of the kernel
+    unsigned int max_points; //upper bound of the call-size class
+    char impl_a[128];        //best aligned impl for this class
+    char impl_u[128];        //best unaligned impl for this class
+} volk_sized_pref_t;
+
 ////////////////////////////////////////////////////////////////////////
 // get path to volk_config profiling info
 ////////////////////////////////////////////////////////////////////////
 VOLK_API void volk_get_config_path(char *);
 
+////////////////////////////////////////////////////////////////////////
+// get path to the size-classed dispatch table
+////////////////////////////////////////////////////////////////////////
+VOLK_API void volk_get_sized_config_path(char *);
+
 ////////////////////////////////////////////////////////////////////////
 // load prefs into global prefs struct
 ////////////////////////////////////////////////////////////////////////
 VOLK_API size_t volk_load_preferences(volk_arch_pref_t **);
 
+////////////////////////////////////////////////////////////////////////
+// load size-classed prefs, written by volk_profile --sized
+////////////////////////////////////////////////////////////////////////
+VOLK_API size_t volk_load_preferences_sized(volk_sized_pref_t **);
+
 __VOLK_DECL_END
 
 #endif //INCLUDED_VOLK_PREFS_H
@@ -0,0 +1,149 @@
+#ifndef INCLUDED_volk_16h_convert_32f_u_H
+#define INCLUDED_volk_16h_convert_32f_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*!
+  \brief Converts a single IEEE 754 half precision (binary16) value to float.
+  \param half The half precision value to convert
+*/
+static inline float volk_16h_convert_32f_scalar(uint16_t half){
+  uint32_t sign = ((uint32_t)(half & 0x8000)) << 16;
+  uint32_t exp  = (half >> 10) & 0x1f;
+  uint32_t mant = half & 0x03ff;
+  uint32_t bits;
+  float value;
+
+  if(exp == 0){
+    if(mant == 0){
+      bits = sign;              // signed zero
+    }
+    else{
+      // Half subnormal: renormalize into a float normal
+      exp = 113;
+      while((mant & 0x0400) == 0){
+        mant <<= 1;
+        exp--;
+      }
+      mant &= 0x03ff;
+      bits = sign | (exp << 23) | (mant << 13);
+    }
+  }
+  else if(exp == 0x1f){
+    bits = sign | 0x7f800000 | (mant << 13); // Inf/NaN
+  }
+  else{
+    bits = sign | ((exp + 112) << 23) | (mant << 13);
+  }
+
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+  /*!
+    \brief Converts the IEEE 754 half precision (binary16) input vector to floats
+    \param outputVector The floating point output data buffer
+    \param inputVector The 16 bit input data buffer
+    \param num_points The number of data values to be converted
+    \note Input buffer does NOT need to be properly aligned
+  */
+static inline void volk_16h_convert_32f_u_f16c(float* outputVector, const uint16_t* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  const unsigned int eighthPoints = num_points / 8;
+
+  const uint16_t* inputVectorPtr = inputVector;
+  float* outputVectorPtr = outputVector;
+  __m128i halfVal;
+  __m256 floatVal;
+
+  for(;number < eighthPoints; number++){
+    halfVal = _mm_loadu_si128((const __m128i*)inputVectorPtr); inputVectorPtr += 8;
+    floatVal = _mm256_cvtph_ps(halfVal);
+    _mm256_storeu_ps(outputVectorPtr, floatVal);
+    outputVectorPtr += 8;
+  }
+
+  number = eighthPoints * 8;
+  for(; number < num_points; number++){
+    outputVector[number] = volk_16h_convert_32f_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Converts the IEEE 754 half precision (binary16) input vector to floats
+    \param outputVector The floating point output data buffer
+    \param inputVector The 16 bit input data buffer
+    \param num_points The number of data values to be converted
+  */
+static inline void volk_16h_convert_32f_generic(float* outputVector, const uint16_t* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  for(number = 0; number < num_points; number++){
+    outputVector[number] = volk_16h_convert_32f_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_16h_convert_32f_u_H */
+#ifndef INCLUDED_volk_16h_convert_32f_a_H
+#define INCLUDED_volk_16h_convert_32f_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+  /*!
+    \brief Converts the IEEE 754 half precision (binary16) input vector to floats
+    \param outputVector The floating point output data buffer
+    \param inputVector The 16 bit input data buffer
+    \param num_points The number of data values to be converted
+  */
+static inline void volk_16h_convert_32f_a_f16c(float* outputVector, const uint16_t* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  const unsigned int eighthPoints = num_points / 8;
+
+  const uint16_t* inputVectorPtr = inputVector;
+  float* outputVectorPtr = outputVector;
+  __m128i halfVal;
+  __m256 floatVal;
+
+  for(;number < eighthPoints; number++){
+    halfVal = _mm_load_si128((const __m128i*)inputVectorPtr); inputVectorPtr += 8;
+    floatVal = _mm256_cvtph_ps(halfVal);
+    _mm256_store_ps(outputVectorPtr, floatVal);
+    outputVectorPtr += 8;
+  }
+
+  number = eighthPoints * 8;
+  for(; number < num_points; number++){
+    outputVector[number] = volk_16h_convert_32f_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Converts the IEEE 754 half precision (binary16) input vector to floats
+    \param outputVector The floating point output data buffer
+    \param inputVector The 16 bit input data buffer
+    \param num_points The number of data values to be converted
+  */
+static inline void volk_16h_convert_32f_a_generic(float* outputVector, const uint16_t* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  for(number = 0; number < num_points; number++){
+    outputVector[number] = volk_16h_convert_32f_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_16h_convert_32f_a_H */
@@ -0,0 +1,161 @@
+#ifndef INCLUDED_volk_32f_convert_16h_u_H
+#define INCLUDED_volk_32f_convert_16h_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*!
+  \brief Converts a single float to IEEE 754 half precision (binary16)
+  with round-to-nearest-even.
+  \param value The floating point value to convert
+*/
+static inline uint16_t volk_32f_convert_16h_scalar(float value){
+  uint32_t bits;
+  uint32_t sign, mant, rem, halfway;
+  int32_t exp;
+  uint16_t half;
+  unsigned int shift;
+
+  memcpy(&bits, &value, sizeof(bits));
+  sign = (bits >> 16) & 0x8000;
+  exp  = (int32_t)((bits >> 23) & 0xff) - 127 + 15;
+  mant = bits & 0x007fffff;
+
+  if(((bits >> 23) & 0xff) == 0xff){
+    // Inf stays Inf; NaN stays NaN (keep it quiet)
+    return (uint16_t)(sign | 0x7c00 | (mant ? 0x0200 : 0));
+  }
+  if(exp >= 0x1f){
+    // Too large for half; overflow to Inf
+    return (uint16_t)(sign | 0x7c00);
+  }
+  if(exp <= 0){
+    // Half subnormal or zero
+    if(exp < -10)
+      return (uint16_t)sign;
+    mant |= 0x00800000;
+    shift = (unsigned int)(14 - exp);
+    rem = mant & ((1u << shift) - 1);
+    halfway = 1u << (shift - 1);
+    mant >>= shift;
+    if(rem > halfway || (rem == halfway && (mant & 1)))
+      mant++;
+    return (uint16_t)(sign | mant);
+  }
+
+  // Normal number: drop 13 mantissa bits with round-to-nearest-even.
+  // A mantissa carry bumps the exponent field, rolling 0x7bff over to
+  // Inf as it should.
+  half = (uint16_t)(sign | (exp << 10) | (mant >> 13));
+  rem = mant & 0x1fff;
+  if(rem > 0x1000 || (rem == 0x1000 && (half & 1)))
+    half++;
+  return half;
+}
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+  /*!
+    \brief Converts the float input vector to IEEE 754 half precision (binary16)
+    \param outputVector The 16 bit output data buffer
+    \param inputVector The floating point input data buffer
+    \param num_points The number of data values to be converted
+    \note Input buffer does NOT need to be properly aligned
+  */
+static inline void volk_32f_convert_16h_u_f16c(uint16_t* outputVector, const float* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  const unsigned int eighthPoints = num_points / 8;
+
+  const float* inputVectorPtr = inputVector;
+  uint16_t* outputVectorPtr = outputVector;
+  __m256 inputVal;
+  __m128i halfVal;
+
+  for(;number < eighthPoints; number++){
+    inputVal = _mm256_loadu_ps(inputVectorPtr); inputVectorPtr += 8;
+    halfVal = _mm256_cvtps_ph(inputVal, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128((__m128i*)outputVectorPtr, halfVal);
+    outputVectorPtr += 8;
+  }
+
+  number = eighthPoints * 8;
+  for(; number < num_points; number++){
+    outputVector[number] = volk_32f_convert_16h_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Converts the float input vector to IEEE 754 half precision (binary16)
+    \param outputVector The 16 bit output data buffer
+    \param inputVector The floating point input data buffer
+    \param num_points The number of data values to be converted
+  */
+static inline void volk_32f_convert_16h_generic(uint16_t* outputVector, const float* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  for(number = 0; number < num_points; number++){
+    outputVector[number] = volk_32f_convert_16h_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_32f_convert_16h_u_H */
+#ifndef INCLUDED_volk_32f_convert_16h_a_H
+#define INCLUDED_volk_32f_convert_16h_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+  /*!
+    \brief Converts the float input vector to IEEE 754 half precision (binary16)
+    \param outputVector The 16 bit output data buffer
+    \param inputVector The floating point input data buffer
+    \param num_points The number of data values to be converted
+  */
+static inline void volk_32f_convert_16h_a_f16c(uint16_t* outputVector, const float* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  const unsigned int eighthPoints = num_points / 8;
+
+  const float* inputVectorPtr = inputVector;
+  uint16_t* outputVectorPtr = outputVector;
+  __m256 inputVal;
+  __m128i halfVal;
+
+  for(;number < eighthPoints; number++){
+    inputVal = _mm256_load_ps(inputVectorPtr); inputVectorPtr += 8;
+    halfVal = _mm256_cvtps_ph(inputVal, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_store_si128((__m128i*)outputVectorPtr, halfVal);
+    outputVectorPtr += 8;
+  }
+
+  number = eighthPoints * 8;
+  for(; number < num_points; number++){
+    outputVector[number] = volk_32f_convert_16h_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Converts the float input vector to IEEE 754 half precision (binary16)
+    \param outputVector The 16 bit output data buffer
+    \param inputVector The floating point input data buffer
+    \param num_points The number of data values to be converted
+  */
+static inline void volk_32f_convert_16h_a_generic(uint16_t* outputVector, const float* inputVector, unsigned int num_points){
+  unsigned int number = 0;
+
+  for(number = 0; number < num_points; number++){
+    outputVector[number] = volk_32f_convert_16h_scalar(inputVector[number]);
+  }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_32f_convert_16h_a_H */
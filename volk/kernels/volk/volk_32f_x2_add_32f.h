@@ -43,6 +43,45 @@ static inline void volk_32f_x2_add_32f_u_sse(float* cVector, const float* aVecto
 }
 #endif /* LV_HAVE_SSE */
 
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+/*!
+  \brief Adds the two input vectors and store their results in the third vector
+  \param cVector The vector where the results will be stored
+  \param aVector One of the vectors to be added
+  \param bVector One of the vectors to be added
+  \param num_points The number of values in aVector and bVector to be added together and stored into cVector
+*/
+static inline void volk_32f_x2_add_32f_u_avx(float* cVector, const float* aVector, const float* bVector, unsigned int num_points){
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const float* bPtr=  bVector;
+
+    __m256 aVal, bVal, cVal;
+    for(;number < eighthPoints; number++){
+
+      aVal = _mm256_loadu_ps(aPtr);
+      bVal = _mm256_loadu_ps(bPtr);
+
+      cVal = _mm256_add_ps(aVal, bVal);
+
+      _mm256_storeu_ps(cPtr,cVal); // Store the results back into the C container
+
+      aPtr += 8;
+      bPtr += 8;
+      cPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for(;number < num_points; number++){
+      *cPtr++ = (*aPtr++) + (*bPtr++);
+    }
+}
+#endif /* LV_HAVE_AVX */
+
 #ifdef LV_HAVE_GENERIC
 /*!
   \brief Adds the two input vectors and store their results in the third vector
@@ -109,6 +148,45 @@ static inline void volk_32f_x2_add_32f_a_sse(float* cVector, const float* aVecto
 }
 #endif /* LV_HAVE_SSE */
 
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+/*!
+  \brief Adds the two input vectors and store their results in the third vector
+  \param cVector The vector where the results will be stored
+  \param aVector One of the vectors to be added
+  \param bVector One of the vectors to be added
+  \param num_points The number of values in aVector and bVector to be added together and stored into cVector
+*/
+static inline void volk_32f_x2_add_32f_a_avx(float* cVector, const float* aVector, const float* bVector, unsigned int num_points){
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const float* bPtr=  bVector;
+
+    __m256 aVal, bVal, cVal;
+    for(;number < eighthPoints; number++){
+
+      aVal = _mm256_load_ps(aPtr);
+      bVal = _mm256_load_ps(bPtr);
+
+      cVal = _mm256_add_ps(aVal, bVal);
+
+      _mm256_store_ps(cPtr,cVal); // Store the results back into the C container
+
+      aPtr += 8;
+      bPtr += 8;
+      cPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for(;number < num_points; number++){
+      *cPtr++ = (*aPtr++) + (*bPtr++);
+    }
+}
+#endif /* LV_HAVE_AVX */
+
 #ifdef LV_HAVE_GENERIC
 /*!
   \brief Adds the two input vectors and store their results in the third vector
@@ -0,0 +1,198 @@
+#ifndef INCLUDED_volk_32fc_magnitude_est_32f_u_H
+#define INCLUDED_volk_32fc_magnitude_est_32f_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+  /*!
+    \brief Estimates the magnitude of the complexVector and stores the results in the magnitudeVector
+    \param complexVector The vector containing the complex input values
+    \param magnitudeVector The vector containing the real output values
+    \param num_points The number of complex values in complexVector to be calculated and stored into cVector
+
+    Uses the hardware reciprocal square root estimate with one
+    Newton-Raphson refinement instead of a full square root; the
+    result is within a few ulp of the true magnitude.
+  */
+static inline void volk_32fc_magnitude_est_32f_u_sse(float* magnitudeVector, const lv_32fc_t* complexVector, unsigned int num_points){
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* complexVectorPtr = (float*)complexVector;
+    float* magnitudeVectorPtr = magnitudeVector;
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 oneHalf = _mm_set_ps1(0.5f);
+    const __m128 threeHalves = _mm_set_ps1(1.5f);
+
+    __m128 cplxValue1, cplxValue2, iValue, qValue, magSq, est, result;
+    for(;number < quarterPoints; number++){
+      cplxValue1 = _mm_loadu_ps(complexVectorPtr);
+      complexVectorPtr += 4;
+
+      cplxValue2 = _mm_loadu_ps(complexVectorPtr);
+      complexVectorPtr += 4;
+
+      // Arrange in i1i2i3i4 format
+      iValue = _mm_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(2,0,2,0));
+      // Arrange in q1q2q3q4 format
+      qValue = _mm_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(3,1,3,1));
+
+      iValue = _mm_mul_ps(iValue, iValue); // Square the I values
+      qValue = _mm_mul_ps(qValue, qValue); // Square the Q Values
+
+      magSq = _mm_add_ps(iValue, qValue); // Add the I2 and Q2 values
+
+      // |z| = |z|^2 * rsqrt(|z|^2), with one Newton-Raphson step:
+      // y' = y * (1.5 - 0.5 * x * y * y)
+      est = _mm_rsqrt_ps(magSq);
+      est = _mm_mul_ps(est, _mm_sub_ps(threeHalves,
+              _mm_mul_ps(_mm_mul_ps(oneHalf, magSq), _mm_mul_ps(est, est))));
+      result = _mm_mul_ps(magSq, est);
+
+      // rsqrt(0) is inf and 0*inf is NaN; force those lanes to zero
+      result = _mm_and_ps(result, _mm_cmpneq_ps(magSq, zero));
+
+      _mm_storeu_ps(magnitudeVectorPtr, result);
+      magnitudeVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for(; number < num_points; number++){
+      float val1Real = *complexVectorPtr++;
+      float val1Imag = *complexVectorPtr++;
+      *magnitudeVectorPtr++ = sqrtf((val1Real * val1Real) + (val1Imag * val1Imag));
+    }
+}
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Estimates the magnitude of the complexVector and stores the results in the magnitudeVector
+    \param complexVector The vector containing the complex input values
+    \param magnitudeVector The vector containing the real output values
+    \param num_points The number of complex values in complexVector to be calculated and stored into cVector
+
+    Alpha-max-plus-beta-min estimate: no square root at all, within
+    4% of the true magnitude, which is plenty for display consumers.
+  */
+static inline void volk_32fc_magnitude_est_32f_generic(float* magnitudeVector, const lv_32fc_t* complexVector, unsigned int num_points){
+  const float* complexVectorPtr = (float*)complexVector;
+  float* magnitudeVectorPtr = magnitudeVector;
+  const float alpha = 0.960433870103f;
+  const float beta = 0.397824734759f;
+  unsigned int number = 0;
+  for(number = 0; number < num_points; number++){
+    const float real = fabsf(*complexVectorPtr++);
+    const float imag = fabsf(*complexVectorPtr++);
+    if(real > imag)
+      *magnitudeVectorPtr++ = alpha * real + beta * imag;
+    else
+      *magnitudeVectorPtr++ = alpha * imag + beta * real;
+  }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_32fc_magnitude_est_32f_u_H */
+#ifndef INCLUDED_volk_32fc_magnitude_est_32f_a_H
+#define INCLUDED_volk_32fc_magnitude_est_32f_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+  /*!
+    \brief Estimates the magnitude of the complexVector and stores the results in the magnitudeVector
+    \param complexVector The vector containing the complex input values
+    \param magnitudeVector The vector containing the real output values
+    \param num_points The number of complex values in complexVector to be calculated and stored into cVector
+
+    Uses the hardware reciprocal square root estimate with one
+    Newton-Raphson refinement instead of a full square root; the
+    result is within a few ulp of the true magnitude.
+  */
+static inline void volk_32fc_magnitude_est_32f_a_sse(float* magnitudeVector, const lv_32fc_t* complexVector, unsigned int num_points){
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* complexVectorPtr = (float*)complexVector;
+    float* magnitudeVectorPtr = magnitudeVector;
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 oneHalf = _mm_set_ps1(0.5f);
+    const __m128 threeHalves = _mm_set_ps1(1.5f);
+
+    __m128 cplxValue1, cplxValue2, iValue, qValue, magSq, est, result;
+    for(;number < quarterPoints; number++){
+      cplxValue1 = _mm_load_ps(complexVectorPtr);
+      complexVectorPtr += 4;
+
+      cplxValue2 = _mm_load_ps(complexVectorPtr);
+      complexVectorPtr += 4;
+
+      // Arrange in i1i2i3i4 format
+      iValue = _mm_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(2,0,2,0));
+      // Arrange in q1q2q3q4 format
+      qValue = _mm_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(3,1,3,1));
+
+      iValue = _mm_mul_ps(iValue, iValue); // Square the I values
+      qValue = _mm_mul_ps(qValue, qValue); // Square the Q Values
+
+      magSq = _mm_add_ps(iValue, qValue); // Add the I2 and Q2 values
+
+      // |z| = |z|^2 * rsqrt(|z|^2), with one Newton-Raphson step:
+      // y' = y * (1.5 - 0.5 * x * y * y)
+      est = _mm_rsqrt_ps(magSq);
+      est = _mm_mul_ps(est, _mm_sub_ps(threeHalves,
+              _mm_mul_ps(_mm_mul_ps(oneHalf, magSq), _mm_mul_ps(est, est))));
+      result = _mm_mul_ps(magSq, est);
+
+      // rsqrt(0) is inf and 0*inf is NaN; force those lanes to zero
+      result = _mm_and_ps(result, _mm_cmpneq_ps(magSq, zero));
+
+      _mm_store_ps(magnitudeVectorPtr, result);
+      magnitudeVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for(; number < num_points; number++){
+      float val1Real = *complexVectorPtr++;
+      float val1Imag = *complexVectorPtr++;
+      *magnitudeVectorPtr++ = sqrtf((val1Real * val1Real) + (val1Imag * val1Imag));
+    }
+}
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Estimates the magnitude of the complexVector and stores the results in the magnitudeVector
+    \param complexVector The vector containing the complex input values
+    \param magnitudeVector The vector containing the real output values
+    \param num_points The number of complex values in complexVector to be calculated and stored into cVector
+
+    Alpha-max-plus-beta-min estimate: no square root at all, within
+    4% of the true magnitude, which is plenty for display consumers.
+  */
+static inline void volk_32fc_magnitude_est_32f_a_generic(float* magnitudeVector, const lv_32fc_t* complexVector, unsigned int num_points){
+  const float* complexVectorPtr = (float*)complexVector;
+  float* magnitudeVectorPtr = magnitudeVector;
+  const float alpha = 0.960433870103f;
+  const float beta = 0.397824734759f;
+  unsigned int number = 0;
+  for(number = 0; number < num_points; number++){
+    const float real = fabsf(*complexVectorPtr++);
+    const float imag = fabsf(*complexVectorPtr++);
+    if(real > imag)
+      *magnitudeVectorPtr++ = alpha * real + beta * imag;
+    else
+      *magnitudeVectorPtr++ = alpha * imag + beta * real;
+  }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_32fc_magnitude_est_32f_a_H */
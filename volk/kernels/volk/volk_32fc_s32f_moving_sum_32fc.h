@@ -0,0 +1,116 @@
+#ifndef INCLUDED_volk_32fc_s32f_moving_sum_32fc_u_H
+#define INCLUDED_volk_32fc_s32f_moving_sum_32fc_u_H
+
+#include <volk/volk_common.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+/*!
+  \brief Computes the sliding-window sum of the complex input buffer.
+
+  outputVector[n] = sum of inputVector[n .. n+length-1], so inputVector
+  must hold (num_points + length - 1) valid samples.
+
+  \param outputVector The vector of window sums
+  \param inputVector The input samples, including length-1 samples of look-ahead
+  \param length The window length, passed as a float scalar
+  \param num_points The number of window sums to produce
+*/
+static inline void volk_32fc_s32f_moving_sum_32fc_u_sse2(lv_32fc_t* outputVector, const lv_32fc_t* inputVector, const float length, unsigned int num_points){
+  const unsigned int window = (unsigned int)length;
+  unsigned int number;
+  lv_32fc_t running = lv_cmake(0.f, 0.f);
+  __VOLK_ATTR_ALIGNED(16) float tempBuffer[4];
+
+  if(num_points == 0)
+    return;
+
+  for(number = 0; number < window; number++)
+    running += inputVector[number];
+  outputVector[0] = running;
+
+  // Two complex outputs per vector: the previous running sum plus the
+  // prefix-scanned difference of the samples entering and leaving the
+  // window (the scan step shifts by one complex, i.e. eight bytes).
+  number = 1;
+  for(; number + 1 < num_points; number += 2){
+    __m128 hi = _mm_loadu_ps((const float*)&inputVector[number + window - 1]);
+    __m128 lo = _mm_loadu_ps((const float*)&inputVector[number - 1]);
+    __m128 d = _mm_sub_ps(hi, lo);
+    __m128 run = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&running));
+    d = _mm_add_ps(d, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(d), 8)));
+    d = _mm_add_ps(d, _mm_movelh_ps(run, run));
+    _mm_storeu_ps((float*)&outputVector[number], d);
+    _mm_store_ps(tempBuffer, d);
+    running = lv_cmake(tempBuffer[2], tempBuffer[3]);
+  }
+
+  for(; number < num_points; number++){
+    running += inputVector[number + window - 1] - inputVector[number - 1];
+    outputVector[number] = running;
+  }
+}
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_GENERIC
+/*!
+  \brief Computes the sliding-window sum of the complex input buffer.
+
+  outputVector[n] = sum of inputVector[n .. n+length-1], so inputVector
+  must hold (num_points + length - 1) valid samples.
+
+  \param outputVector The vector of window sums
+  \param inputVector The input samples, including length-1 samples of look-ahead
+  \param length The window length, passed as a float scalar
+  \param num_points The number of window sums to produce
+*/
+static inline void volk_32fc_s32f_moving_sum_32fc_generic(lv_32fc_t* outputVector, const lv_32fc_t* inputVector, const float length, unsigned int num_points){
+  const unsigned int window = (unsigned int)length;
+  unsigned int number;
+  lv_32fc_t running = lv_cmake(0.f, 0.f);
+
+  if(num_points == 0)
+    return;
+
+  for(number = 0; number < window; number++)
+    running += inputVector[number];
+  outputVector[0] = running;
+
+  for(number = 1; number < num_points; number++){
+    running += inputVector[number + window - 1] - inputVector[number - 1];
+    outputVector[number] = running;
+  }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_32fc_s32f_moving_sum_32fc_u_H */
+#ifndef INCLUDED_volk_32fc_s32f_moving_sum_32fc_a_H
+#define INCLUDED_volk_32fc_s32f_moving_sum_32fc_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+/*!
+  \brief Computes the sliding-window sum of the complex input buffer.
+
+  The window loads are offset by the window length and can never all
+  be aligned at once, so this is the same code as the unaligned
+  version.
+
+  \param outputVector The vector of window sums
+  \param inputVector The input samples, including length-1 samples of look-ahead
+  \param length The window length, passed as a float scalar
+  \param num_points The number of window sums to produce
+*/
+static inline void volk_32fc_s32f_moving_sum_32fc_a_sse2(lv_32fc_t* outputVector, const lv_32fc_t* inputVector, const float length, unsigned int num_points){
+  volk_32fc_s32f_moving_sum_32fc_u_sse2(outputVector, inputVector, length, num_points);
+}
+#endif /* LV_HAVE_SSE2 */
+
+#endif /* INCLUDED_volk_32fc_s32f_moving_sum_32fc_a_H */
@@ -0,0 +1,182 @@
+#ifndef INCLUDED_volk_32fc_s32f_power_decimate_32f_u_H
+#define INCLUDED_volk_32fc_s32f_power_decimate_32f_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+  /*!
+    \brief Calculates the scaled magnitude squared of every decimation-th complex value, fusing the power calculation and keep-one-in-N into a single pass over the input
+    \param outputVector The vector containing the real output values, one per decimation input values
+    \param complexVector The vector containing the complex input values
+    \param scalar The scale factor applied to each output power value
+    \param decimation Keep one output for every decimation input values
+    \param num_points The number of complex values in complexVector; the number of outputs produced is num_points / decimation
+  */
+static inline void volk_32fc_s32f_power_decimate_32f_u_sse3(float* outputVector, const lv_32fc_t* complexVector, const float scalar, unsigned int decimation, unsigned int num_points){
+    unsigned int number = 0;
+    const unsigned int outPoints = num_points / decimation;
+
+    const float* complexVectorPtr = (float*)complexVector;
+    float* outputVectorPtr = outputVector;
+
+    if(decimation == 1) {
+      const unsigned int quarterPoints = num_points / 4;
+      const __m128 vScalar = _mm_set_ps1(scalar);
+
+      __m128 cplxValue1, cplxValue2, result;
+      for(;number < quarterPoints; number++){
+        cplxValue1 = _mm_loadu_ps(complexVectorPtr);
+        complexVectorPtr += 4;
+
+        cplxValue2 = _mm_loadu_ps(complexVectorPtr);
+        complexVectorPtr += 4;
+
+        cplxValue1 = _mm_mul_ps(cplxValue1, cplxValue1); // Square the values
+        cplxValue2 = _mm_mul_ps(cplxValue2, cplxValue2); // Square the Values
+
+        result = _mm_hadd_ps(cplxValue1, cplxValue2); // Add the I2 and Q2 values
+
+        result = _mm_mul_ps(result, vScalar);
+
+        _mm_storeu_ps(outputVectorPtr, result);
+        outputVectorPtr += 4;
+      }
+      number = quarterPoints * 4;
+      for(; number < num_points; number++){
+        float val1Real = *complexVectorPtr++;
+        float val1Imag = *complexVectorPtr++;
+        *outputVectorPtr++ = ((val1Real * val1Real) + (val1Imag * val1Imag)) * scalar;
+      }
+    }
+    else {
+      // the strided access is memory bound; the win over two passes is
+      // that the skipped values are never touched
+      for(; number < outPoints; number++){
+        float val1Real = complexVectorPtr[0];
+        float val1Imag = complexVectorPtr[1];
+        *outputVectorPtr++ = ((val1Real * val1Real) + (val1Imag * val1Imag)) * scalar;
+        complexVectorPtr += 2*decimation;
+      }
+    }
+}
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Calculates the scaled magnitude squared of every decimation-th complex value, fusing the power calculation and keep-one-in-N into a single pass over the input
+    \param outputVector The vector containing the real output values, one per decimation input values
+    \param complexVector The vector containing the complex input values
+    \param scalar The scale factor applied to each output power value
+    \param decimation Keep one output for every decimation input values
+    \param num_points The number of complex values in complexVector; the number of outputs produced is num_points / decimation
+  */
+static inline void volk_32fc_s32f_power_decimate_32f_generic(float* outputVector, const lv_32fc_t* complexVector, const float scalar, unsigned int decimation, unsigned int num_points){
+    const unsigned int outPoints = num_points / decimation;
+    const float* complexVectorPtr = (float*)complexVector;
+    float* outputVectorPtr = outputVector;
+    unsigned int number = 0;
+
+    for(; number < outPoints; number++){
+      const float real = complexVectorPtr[0];
+      const float imag = complexVectorPtr[1];
+      *outputVectorPtr++ = ((real * real) + (imag * imag)) * scalar;
+      complexVectorPtr += 2*decimation;
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_32fc_s32f_power_decimate_32f_u_H */
+#ifndef INCLUDED_volk_32fc_s32f_power_decimate_32f_a_H
+#define INCLUDED_volk_32fc_s32f_power_decimate_32f_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+  /*!
+    \brief Calculates the scaled magnitude squared of every decimation-th complex value, fusing the power calculation and keep-one-in-N into a single pass over the input
+    \param outputVector The vector containing the real output values, one per decimation input values
+    \param complexVector The vector containing the complex input values
+    \param scalar The scale factor applied to each output power value
+    \param decimation Keep one output for every decimation input values
+    \param num_points The number of complex values in complexVector; the number of outputs produced is num_points / decimation
+  */
+static inline void volk_32fc_s32f_power_decimate_32f_a_sse3(float* outputVector, const lv_32fc_t* complexVector, const float scalar, unsigned int decimation, unsigned int num_points){
+    unsigned int number = 0;
+    const unsigned int outPoints = num_points / decimation;
+
+    const float* complexVectorPtr = (float*)complexVector;
+    float* outputVectorPtr = outputVector;
+
+    if(decimation == 1) {
+      const unsigned int quarterPoints = num_points / 4;
+      const __m128 vScalar = _mm_set_ps1(scalar);
+
+      __m128 cplxValue1, cplxValue2, result;
+      for(;number < quarterPoints; number++){
+        cplxValue1 = _mm_load_ps(complexVectorPtr);
+        complexVectorPtr += 4;
+
+        cplxValue2 = _mm_load_ps(complexVectorPtr);
+        complexVectorPtr += 4;
+
+        cplxValue1 = _mm_mul_ps(cplxValue1, cplxValue1); // Square the values
+        cplxValue2 = _mm_mul_ps(cplxValue2, cplxValue2); // Square the Values
+
+        result = _mm_hadd_ps(cplxValue1, cplxValue2); // Add the I2 and Q2 values
+
+        result = _mm_mul_ps(result, vScalar);
+
+        _mm_store_ps(outputVectorPtr, result);
+        outputVectorPtr += 4;
+      }
+      number = quarterPoints * 4;
+      for(; number < num_points; number++){
+        float val1Real = *complexVectorPtr++;
+        float val1Imag = *complexVectorPtr++;
+        *outputVectorPtr++ = ((val1Real * val1Real) + (val1Imag * val1Imag)) * scalar;
+      }
+    }
+    else {
+      // the strided access is memory bound; the win over two passes is
+      // that the skipped values are never touched
+      for(; number < outPoints; number++){
+        float val1Real = complexVectorPtr[0];
+        float val1Imag = complexVectorPtr[1];
+        *outputVectorPtr++ = ((val1Real * val1Real) + (val1Imag * val1Imag)) * scalar;
+        complexVectorPtr += 2*decimation;
+      }
+    }
+}
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_GENERIC
+  /*!
+    \brief Calculates the scaled magnitude squared of every decimation-th complex value, fusing the power calculation and keep-one-in-N into a single pass over the input
+    \param outputVector The vector containing the real output values, one per decimation input values
+    \param complexVector The vector containing the complex input values
+    \param scalar The scale factor applied to each output power value
+    \param decimation Keep one output for every decimation input values
+    \param num_points The number of complex values in complexVector; the number of outputs produced is num_points / decimation
+  */
+static inline void volk_32fc_s32f_power_decimate_32f_a_generic(float* outputVector, const lv_32fc_t* complexVector, const float scalar, unsigned int decimation, unsigned int num_points){
+    const unsigned int outPoints = num_points / decimation;
+    const float* complexVectorPtr = (float*)complexVector;
+    float* outputVectorPtr = outputVector;
+    unsigned int number = 0;
+
+    for(; number < outPoints; number++){
+      const float real = complexVectorPtr[0];
+      const float imag = complexVectorPtr[1];
+      *outputVectorPtr++ = ((real * real) + (imag * imag)) * scalar;
+      complexVectorPtr += 2*decimation;
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_32fc_s32f_power_decimate_32f_a_H */
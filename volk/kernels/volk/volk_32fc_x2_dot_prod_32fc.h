@@ -236,6 +236,60 @@ static inline void volk_32fc_x2_dot_prod_32fc_u_sse3(lv_32fc_t* result, const lv
 
 #endif /*LV_HAVE_SSE3*/
 
+#if defined(LV_HAVE_AVX2) && defined(LV_HAVE_FMA)
+
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* input, const lv_32fc_t* taps, unsigned int num_points) {
+
+  lv_32fc_t dotProduct;
+  memset(&dotProduct, 0x0, 2*sizeof(float));
+
+  unsigned int number = 0;
+  const unsigned int quarterPoints = num_points/4;
+
+  __m256 x, y, yl, yh, z, tmp2, dotProdVal;
+
+  const lv_32fc_t* a = input;
+  const lv_32fc_t* b = taps;
+
+  dotProdVal = _mm256_setzero_ps();
+
+  for(;number < quarterPoints; number++){
+
+    x = _mm256_loadu_ps((float*)a); // Load the ar + ai, br + bi ... as ar,ai,br,bi ...
+    y = _mm256_loadu_ps((float*)b); // Load the cr + ci, dr + di ... as cr,ci,dr,di ...
+
+    yl = _mm256_moveldup_ps(y); // Load yl with cr,cr,dr,dr ...
+    yh = _mm256_movehdup_ps(y); // Load yh with ci,ci,di,di ...
+
+    tmp2 = _mm256_mul_ps(_mm256_shuffle_ps(x,x,0xB1), yh); // tmp2 = ai*ci,ar*ci,bi*di,br*di ...
+
+    z = _mm256_fmaddsub_ps(x, yl, tmp2); // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di ...
+
+    dotProdVal = _mm256_add_ps(dotProdVal, z); // Add the complex multiplication results together
+
+    a += 4;
+    b += 4;
+  }
+
+  __VOLK_ATTR_ALIGNED(32) lv_32fc_t dotProductVector[4];
+
+  _mm256_storeu_ps((float*)dotProductVector,dotProdVal); // Store the results back into the dot product vector
+
+  dotProduct += ( dotProductVector[0] + dotProductVector[1] +
+                  dotProductVector[2] + dotProductVector[3] );
+
+  number = quarterPoints*4;
+  for(;number < num_points; number++) {
+    dotProduct += input[number] * taps[number];
+  }
+
+  *result = dotProduct;
+}
+
+#endif /*LV_HAVE_AVX2 && LV_HAVE_FMA*/
+
 #ifdef LV_HAVE_SSE4_1
 
 #include <smmintrin.h>
@@ -680,6 +734,60 @@ static inline void volk_32fc_x2_dot_prod_32fc_a_sse3(lv_32fc_t* result, const lv
 
 #endif /*LV_HAVE_SSE3*/
 
+#if defined(LV_HAVE_AVX2) && defined(LV_HAVE_FMA)
+
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_a_avx2_fma(lv_32fc_t* result, const lv_32fc_t* input, const lv_32fc_t* taps, unsigned int num_points) {
+
+  lv_32fc_t dotProduct;
+  memset(&dotProduct, 0x0, 2*sizeof(float));
+
+  unsigned int number = 0;
+  const unsigned int quarterPoints = num_points/4;
+
+  __m256 x, y, yl, yh, z, tmp2, dotProdVal;
+
+  const lv_32fc_t* a = input;
+  const lv_32fc_t* b = taps;
+
+  dotProdVal = _mm256_setzero_ps();
+
+  for(;number < quarterPoints; number++){
+
+    x = _mm256_load_ps((float*)a); // Load the ar + ai, br + bi ... as ar,ai,br,bi ...
+    y = _mm256_load_ps((float*)b); // Load the cr + ci, dr + di ... as cr,ci,dr,di ...
+
+    yl = _mm256_moveldup_ps(y); // Load yl with cr,cr,dr,dr ...
+    yh = _mm256_movehdup_ps(y); // Load yh with ci,ci,di,di ...
+
+    tmp2 = _mm256_mul_ps(_mm256_shuffle_ps(x,x,0xB1), yh); // tmp2 = ai*ci,ar*ci,bi*di,br*di ...
+
+    z = _mm256_fmaddsub_ps(x, yl, tmp2); // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di ...
+
+    dotProdVal = _mm256_add_ps(dotProdVal, z); // Add the complex multiplication results together
+
+    a += 4;
+    b += 4;
+  }
+
+  __VOLK_ATTR_ALIGNED(32) lv_32fc_t dotProductVector[4];
+
+  _mm256_storeu_ps((float*)dotProductVector,dotProdVal); // Store the results back into the dot product vector
+
+  dotProduct += ( dotProductVector[0] + dotProductVector[1] +
+                  dotProductVector[2] + dotProductVector[3] );
+
+  number = quarterPoints*4;
+  for(;number < num_points; number++) {
+    dotProduct += input[number] * taps[number];
+  }
+
+  *result = dotProduct;
+}
+
+#endif /*LV_HAVE_AVX2 && LV_HAVE_FMA*/
+
 #ifdef LV_HAVE_SSE4_1
 
 #include <smmintrin.h>
@@ -38,6 +38,9 @@ VOLK_RUN_TESTS(volk_32fc_32f_dot_prod_32fc, 1e-4, 0, 204602, 1);
 VOLK_RUN_TESTS(volk_32fc_index_max_16u, 3, 0, 20462, 1);
 VOLK_RUN_TESTS(volk_32fc_s32f_magnitude_16i, 1, 32768, 20462, 1);
 VOLK_RUN_TESTS(volk_32fc_magnitude_32f, 1e-4, 0, 20462, 1);
+// generic is alpha-max-beta-min (4% contract); the simd variants are
+// rsqrt+Newton and much tighter, hence the loose comparison
+VOLK_RUN_TESTS(volk_32fc_magnitude_est_32f, 1e-1, 0, 20462, 1);
 VOLK_RUN_TESTS(volk_32f_s32f_convert_16i, 1, 32768, 20462, 1);
 VOLK_RUN_TESTS(volk_32f_s32f_convert_32i, 1, 1<<31, 20462, 1);
 VOLK_RUN_TESTS(volk_32f_convert_64f, 1e-4, 0, 20462, 1);
@@ -21,6 +21,20 @@ void volk_get_config_path(char *path)
     strcat(path, suffix);
 }
 
+void volk_get_sized_config_path(char *path)
+{
+    const char *suffix = "/.volk/volk_config_sized";
+    char *home = NULL;
+    if (home == NULL) home = getenv("HOME");
+    if (home == NULL) home = getenv("APPDATA");
+    if (home == NULL){
+        path = NULL;
+        return;
+    }
+    strcpy(path, home);
+    strcat(path, suffix);
+}
+
 size_t volk_load_preferences(volk_arch_pref_t **prefs_res)
 {
     FILE *config_file;
@@ -48,3 +62,32 @@ size_t volk_load_preferences(volk_arch_pref_t **prefs_res)
     *prefs_res = prefs;
     return n_arch_prefs;
 }
+
+size_t volk_load_preferences_sized(volk_sized_pref_t **prefs_res)
+{
+    FILE *config_file;
+    char path[512], line[512];
+    size_t n_prefs = 0;
+    volk_sized_pref_t *prefs = NULL;
+
+    //get the sized config path
+    volk_get_sized_config_path(path);
+    if (path == NULL) return n_prefs; //no prefs found
+    config_file = fopen(path, "r");
+    if(!config_file) return n_prefs; //no prefs found
+
+    //lines are: kernel_name max_points impl_a impl_u
+    while(fgets(line, sizeof(line), config_file) != NULL)
+    {
+        prefs = (volk_sized_pref_t *) realloc(prefs, (n_prefs+1) * sizeof(*prefs));
+        volk_sized_pref_t *p = prefs + n_prefs;
+        if(sscanf(line, "%s %u %s %s", p->name, &p->max_points, p->impl_a, p->impl_u) == 4
+           && !strncmp(p->name, "volk_", 5))
+        {
+            n_prefs++;
+        }
+    }
+    fclose(config_file);
+    *prefs_res = prefs;
+    return n_prefs;
+}
@@ -110,3 +110,28 @@ int volk_rank_archs(
     //otherwise return the best unaligned
     return best_index_u;
 }
+
+const char *volk_sized_pref_impl(
+    const char *kern_name,
+    const bool align,
+    unsigned int *max_points
+){
+    size_t i;
+    static volk_sized_pref_t *volk_sized_prefs;
+    static size_t n_sized_prefs = 0;
+    static int sized_prefs_loaded = 0;
+    if(!sized_prefs_loaded) {
+        n_sized_prefs = volk_load_preferences_sized(&volk_sized_prefs);
+        sized_prefs_loaded = 1;
+    }
+
+    for(i = 0; i < n_sized_prefs; i++)
+    {
+        if(!strncmp(kern_name, volk_sized_prefs[i].name, sizeof(volk_sized_prefs[i].name)))
+        {
+            *max_points = volk_sized_prefs[i].max_points;
+            return align? volk_sized_prefs[i].impl_a : volk_sized_prefs[i].impl_u;
+        }
+    }
+    return NULL;
+}
@@ -44,6 +44,16 @@ int volk_rank_archs(
     const bool align          //if false, filter aligned implementations
 );
 
+//! Look up the size-classed preference for a kernel, if one exists.
+//  Returns the preferred implementation name (or NULL when the sized
+//  dispatch table has no entry for this kernel) and writes the upper
+//  bound of the small call-size class to *max_points.
+const char *volk_sized_pref_impl(
+    const char *kern_name,    //name of the kernel
+    const bool align,         //aligned or unaligned preference
+    unsigned int *max_points  //out: size-class upper bound
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -119,6 +119,10 @@ bool volk_is_aligned(const void *ptr)
 #include <volk/$(kern.name).h> //pulls in the dispatcher
 #end if
 
+static unsigned int $(kern.name)_small_max = 0;
+static $kern.pname $(kern.name)_small_a = NULL;
+static $kern.pname $(kern.name)_small_u = NULL;
+
 static inline void __$(kern.name)_d($kern.arglist_full)
 {
     #if $kern.has_dispatcher
@@ -126,7 +130,7 @@ static inline void __$(kern.name)_d($kern.arglist_full)
     return;
     #end if
 
-    if (volk_is_aligned(
+    const bool aligned = volk_is_aligned(
     #set $num_open_parens = 0
     #for $arg_type, $arg_name in $kern.args
         #if '*' in $arg_type
@@ -135,7 +139,20 @@ static inline void __$(kern.name)_d($kern.arglist_full)
         #end if
     #end for
         0$(')'*$num_open_parens)
-    )){
+    );
+
+    //size-classed dispatch: small calls may prefer another machine
+    if ($(kern.name)_small_max && $(kern.args[-1][1]) <= $(kern.name)_small_max){
+        if (aligned){
+            $(kern.name)_small_a($kern.arglist_names);
+        }
+        else{
+            $(kern.name)_small_u($kern.arglist_names);
+        }
+        return;
+    }
+
+    if (aligned){
         $(kern.name)_a($kern.arglist_names);
     }
     else{
@@ -158,6 +175,21 @@ static inline void __init_$(kern.name)(void)
     assert($(kern.name)_a);
     assert($(kern.name)_u);
 
+    //install the small call-size class impls when the sized dispatch
+    //table (written by volk_profile --sized) has an entry for us
+    {
+        unsigned int small_max = 0;
+        const char *small_a_name = volk_sized_pref_impl(name, true, &small_max);
+        const char *small_u_name = volk_sized_pref_impl(name, false, &small_max);
+        if (small_a_name && small_u_name){
+            $(kern.name)_small_a = get_machine()->$(kern.name)_impls[
+                volk_get_index(impl_names, n_impls, small_a_name)];
+            $(kern.name)_small_u = get_machine()->$(kern.name)_impls[
+                volk_get_index(impl_names, n_impls, small_u_name)];
+            $(kern.name)_small_max = small_max;
+        }
+    }
+
     $(kern.name) = &__$(kern.name)_d;
 }
 
@@ -183,6 +215,12 @@ $kern.pname $(kern.name)_a = &__$(kern.name)_a;
 $kern.pname $(kern.name)_u = &__$(kern.name)_u;
 $kern.pname $(kern.name)   = &__$(kern.name);
 
+$kern.pname $(kern.name)_get_impl(const bool aligned)
+{
+    __init_$(kern.name)();
+    return aligned? $(kern.name)_a : $(kern.name)_u;
+}
+
 void $(kern.name)_manual($kern.arglist_full, const char* impl_name)
 {
     const int index = volk_get_index(
@@ -82,6 +82,10 @@ extern VOLK_API $kern.pname $(kern.name)_a;
 //! A function pointer to the fastest unaligned implementation
 extern VOLK_API $kern.pname $(kern.name)_u;
 
+//! Resolve and return the concrete impl behind the aligned or unaligned
+//  dispatch, so callers can cache it and skip the double-indirection
+extern VOLK_API $kern.pname $(kern.name)_get_impl(const bool aligned);
+
 //! Call into a specific implementation given by name
 extern VOLK_API void $(kern.name)_manual($kern.arglist_full, const char* impl_name);
 
@@ -39,6 +39,7 @@ struct VOLK_CPU volk_cpu;
         #include "gcc_x86_cpuid.h"
     #endif
     #define cpuid_x86(op, r) __get_cpuid(op, (unsigned int *)r+0, (unsigned int *)r+1, (unsigned int *)r+2, (unsigned int *)r+3)
+    #define cpuid_x86_count(op, count, regs) __cpuid_count(op, count, ((unsigned int*)regs)[0], ((unsigned int*)regs)[1], ((unsigned int*)regs)[2], ((unsigned int*)regs)[3])
 
     /* Return Intel AVX extended CPU capabilities register.
      * This function will bomb on non-AVX-capable machines, so
@@ -59,6 +60,7 @@ struct VOLK_CPU volk_cpu;
 #elif defined(_MSC_VER) && defined(HAVE_INTRIN_H)
     #include <intrin.h>
     #define cpuid_x86(op, r) __cpuid(((int*)r), op)
+    #define cpuid_x86_count(op, count, regs) __cpuidex(((int*)regs), op, count)
 
     #if defined(_XCR_XFEATURE_ENABLED_MASK)
     #define __xgetbv() _xgetbv(_XCR_XFEATURE_ENABLED_MASK)
@@ -82,6 +84,16 @@ static inline unsigned int cpuid_x86_bit(unsigned int reg, unsigned int op, unsi
 #endif
 }
 
+static inline unsigned int cpuid_count_x86_bit(unsigned int level, unsigned int count, unsigned int reg, unsigned int bit) {
+#if defined(VOLK_CPU_x86)
+    unsigned int regs[4];
+    cpuid_x86_count(level, count, regs);
+    return regs[reg] >> bit & 0x01;
+#else
+    return 0;
+#endif
+}
+
 static inline unsigned int check_extended_cpuid(unsigned int val) {
 #if defined(VOLK_CPU_x86)
     unsigned int regs[4];